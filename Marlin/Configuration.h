@@ -83,7 +83,11 @@
  *
  * :[-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
  */
-#define SERIAL_PORT 1
+#if MB(CREALITY_V453_GD32_MFL)
+  #define SERIAL_PORT 0   // GD32 MFL UARTs start from 0
+#else
+  #define SERIAL_PORT 1
+#endif
 
 /**
  * Serial Port Baud Rate
@@ -379,6 +383,7 @@
   //#define MIXING_PRESETS         // Assign 8 default V-tool presets for 2 or 3 MIXING_STEPPERS
   #if ENABLED(GRADIENT_MIX)
     //#define GRADIENT_VTOOL       // Add M166 T to use a V-tool index as a Gradient alias
+    //#define GRADIENT_MIX_PER_STEP // Blend the gradient across each move in the stepper instead of per move
   #endif
 #endif
 
@@ -774,6 +779,21 @@
                                                       // 0.00515 J/K/mm for 1.75mm ABS (0.0137 J/K/mm for 2.85mm ABS).
                                                       // 0.00522 J/K/mm for 1.75mm Nylon (0.0138 J/K/mm for 2.85mm Nylon).
 
+  // Look ahead over the queued moves and raise the heater power before high-flow moves arrive
+  //#define MPC_FEEDFORWARD
+  #if ENABLED(MPC_FEEDFORWARD)
+    #define MPC_FEEDFORWARD_MS 500                    // (ms) Time span of queued moves to average the extrusion rate over.
+    #define MPC_FEEDFORWARD_GAIN 1.0f                 // (0.0...2.0) Share of the coming filament heat loss to supply in advance.
+  #endif
+
+  // Limit the extrusion speed of new moves while the heater is out of headroom, to what the model says it can melt
+  //#define MPC_FLOW_LIMIT
+  #if ENABLED(MPC_FLOW_LIMIT)
+    #define MPC_FLOW_LIMIT_DUTY 95                    // (%) Heater output (of MPC_MAX) at which the limit starts. It ends 10% below.
+    #define MPC_FLOW_LIMIT_MARGIN 0.9f                // (0.1...1.0) Share of the modeled melt capacity to allow.
+    #define MPC_FLOW_LIMIT_MIN 0.5f                   // (mm/s) Lowest filament speed to limit to.
+  #endif
+
   // Advanced options
   #define MPC_SMOOTHING_FACTOR 0.5f                   // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
   #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
@@ -824,6 +844,10 @@
   #define DEFAULT_bedKd 1349.52
 
   // FIND YOUR OWN: "M303 E-1 C8 S90" to run autotune on the bed at 90 degreesC for 8 cycles.
+
+  // Heat up at full power until the bed is predicted to coast to the target within this
+  // time at its measured heating rate. PID then starts fresh, with no integral windup.
+  //#define BED_PREHEAT_COAST_TIME 30 // (s)
 #else
   //#define BED_LIMIT_SWITCHING   // Keep the bed temperature within BED_HYSTERESIS of the target
 #endif
@@ -920,6 +944,16 @@
 
   //#define PID_EDIT_MENU         // Add PID editing to the "Advanced Settings" menu. (~700 bytes of flash)
   //#define PID_AUTOTUNE_MENU     // Add PID auto-tuning to the "Advanced Settings" menu. (~250 bytes of flash)
+
+  /**
+   * Fit a first-order plus dead time model to the M303 relay cycles and
+   * derive the PID from it (AMIGO rules). Autotune ends early, before C
+   * cycles, once two fits in a row agree within PID_AUTOTUNE_FIT_TOLERANCE.
+   */
+  //#define PID_AUTOTUNE_FIT
+  #if ENABLED(PID_AUTOTUNE_FIT)
+    #define PID_AUTOTUNE_FIT_TOLERANCE 0.05 // Largest change of Kp, Ki and Kd between fits, as a fraction
+  #endif
 #endif
 
 // @section safety
@@ -1019,6 +1053,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Compute the tower positions only at knots a few segments apart and follow a
+  // quadratic between them, halving the span until it stays within the error.
+  //#define DELTA_IK_INTERPOLATION
+  #if ENABLED(DELTA_IK_INTERPOLATION)
+    #define DELTA_IK_KNOT_SEGMENTS  8     // Most segments between knots
+    #define DELTA_IK_MAX_ERROR  0.002     // (mm) Largest tower error of the quadratic
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1183,6 +1225,10 @@
   #define FEEDRATE_SCALING                  // Convert XY feedrate from mm/s to degrees/s on the fly
 #endif
 
+// For SCARA, TPARA, and POLAR use an interpolated table for the arctangents of
+// inverse kinematics. Much faster without an FPU and within 0.0004°.
+//#define KINEMATICS_TRIG_TABLE
+
 //===========================================================================
 //============================== Endstop Settings ===========================
 //===========================================================================
@@ -1281,6 +1327,38 @@
  */
 #define ENDSTOP_NOISE_THRESHOLD 3 // (number of consecutive readings @1kHz)
 
+/**
+ * Endstop Edge Capture
+ *
+ * Record the stepper position at each endstop change and use it for the
+ * triggered position once ENDSTOP_NOISE_THRESHOLD has confirmed the change,
+ * instead of the position the axis reached during the confirmation delay.
+ * Improves homing and probing repeatability at higher speeds.
+ *
+ * With ENDSTOP_INTERRUPTS_FEATURE the position is taken in the pin interrupt
+ * at the edge. Otherwise it's taken at the 1kHz poll that saw the change.
+ * On STM32F1 pins with the same number share one interrupt line (e.g., PA4 and
+ * PC4) so only one of them can use ENDSTOP_INTERRUPTS_FEATURE.
+ */
+//#define ENDSTOP_EDGE_CAPTURE
+
+/**
+ * Filtered Probe Sampling
+ *
+ * While the probe is enabled read it PROBE_SAMPLE_BURST times in each 1kHz
+ * poll and keep the majority, then trigger once PROBE_SAMPLE_VOTES of the last
+ * PROBE_SAMPLE_WINDOW polls agree. The probe skips ENDSTOP_NOISE_THRESHOLD, so
+ * it is confirmed sooner and noise on other endstops doesn't delay it. Allows
+ * a faster probing approach with the same repeatability.
+ */
+//#define PROBE_FILTERED_SAMPLING
+#if ENABLED(PROBE_FILTERED_SAMPLING)
+  #define PROBE_SAMPLE_BURST   5  // Reads per poll
+  #define PROBE_SAMPLE_GAP_US 10  // (µs) Time between reads
+  #define PROBE_SAMPLE_VOTES   2  // Polls that must agree on a change...
+  #define PROBE_SAMPLE_WINDOW  3  // ...out of this many recent polls
+#endif
+
 // Check for stuck or disconnected endstops during homing moves.
 #define DETECT_BROKEN_ENDSTOP
 
@@ -1393,6 +1471,10 @@
   #define JUNCTION_DEVIATION_MM 0.05 // (mm) Distance from real junction edge
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  //#define JD_JUNCTION_CACHE         // Reuse the limits of recent junctions with the same geometry, like infill zigzags
+  #if ENABLED(JD_JUNCTION_CACHE)
+    #define JD_JUNCTION_CACHE_SIZE 4  // Junctions remembered :[1-16]
+  #endif
 #endif
 
 /**
@@ -1519,6 +1601,11 @@
 //#define BD_SENSOR
 #if ENABLED(BD_SENSOR)
   //#define BD_SENSOR_PROBE_NO_STOP // Probe bed without stopping at each probe point
+  //#define BD_SENSOR_FILTER        // Filter readings for the live Z adjust of 'M102 S<height>'
+  #if ENABLED(BD_SENSOR_FILTER)
+    #define BD_SENSOR_ADJUST_MS    25 // (ms) Time between readings while adjusting Z
+    #define BD_SENSOR_ADJUST_GAIN 0.5 // Part of the measured error corrected after each reading
+  #endif
 #endif
 
 /**
@@ -1722,6 +1809,25 @@
   #endif
 #endif
 
+/**
+ * Pipelined G29 Probing
+ * After each G29 grid point only lift the nozzle a little, then rise to the
+ * probing clearance during the XY travel to the next point. With PROBE_TARE
+ * the probe is tared while traveling. Only for probes that can tare in motion.
+ */
+//#define PROBE_PIPELINED_TRAVEL
+#if ENABLED(PROBE_PIPELINED_TRAVEL)
+  #define PROBE_PIPELINE_LIFT 1.0   // (mm) Straight lift off the bed before the travel
+#endif
+
+/**
+ * Deploy in Travel
+ * Deploy a servo probe or BLTouch during the travel to each probe point and
+ * stow it while rising afterward, so the deploy / stow delay runs while the
+ * axes move. The travel is made at the deploy height (Z_CLEARANCE_DEPLOY_PROBE).
+ */
+//#define PROBE_DEPLOY_IN_TRAVEL
+
 /**
  * Probe Enable / Disable
  * The probe only provides a triggered signal when enabled.
@@ -1744,6 +1850,19 @@
 #define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Adaptive slow approach for double-probing (MULTIPLE_PROBING 2)
+ * The fast probe only bounds the contact height. The probe then retracts
+ * just enough to release and approaches slowly from there. The retract
+ * starts at Z_CLEARANCE_MULTI_PROBE and shrinks point by point to a multiple
+ * of the previous fast/slow discrepancy. The slow probe result is returned.
+ */
+//#define PROBE_ADAPTIVE_APPROACH
+#if ENABLED(PROBE_ADAPTIVE_APPROACH)
+  #define PROBE_APPROACH_MIN    0.2 // (mm) Shortest retract before the slow probe
+  #define PROBE_APPROACH_FACTOR   3 // Retract this multiple of the last discrepancy
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -2102,6 +2221,15 @@
         //#define FIL_MOTION8_PULLUP
         //#define FIL_MOTION8_PULLDOWN
       #endif // FILAMENT_SWITCH_AND_MOTION
+
+      // Compare the sensor edges with the E steps taken, Linear Advance included,
+      // to catch a jam or a slipping feed within a few mm of filament.
+      //#define FILAMENT_MOTION_TRACKING
+      #if ENABLED(FILAMENT_MOTION_TRACKING)
+        #define FILAMENT_MOTION_MM_PER_EDGE 1.44 // (mm) Filament moved per change of the sensor state
+        #define FILAMENT_MOTION_SLIP_MM     4.0  // (mm) Missing filament allowed at low speed
+        #define FILAMENT_MOTION_SLIP_TIME   0.25 // (s) More allowed per mm/s of E speed, for latency and compression
+      #endif
     #endif // FILAMENT_MOTION_SENSOR
   #endif // FILAMENT_RUNOUT_DISTANCE_MM
 #endif // FILAMENT_RUNOUT_SENSOR
@@ -2255,8 +2383,27 @@
     #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       // Number of subdivisions between probe points
       #define BILINEAR_SUBDIVISIONS 3
+
+      // Compute the subdivided boxes as they are used and keep only the latest
+      // few, instead of the whole subdivided grid. Allows more subdivisions.
+      //#define ABL_BILINEAR_LAZY_SUBDIVISION
+      #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+        #define ABL_LAZY_CACHE_BOXES 8  // Boxes kept. 18 bytes SRAM each.
+      #endif
     #endif
 
+    //
+    // Precompute the interpolation coefficients of every grid box so each
+    // leveled segment only costs a few multiply-adds. 16 bytes SRAM per box.
+    //
+    //#define ABL_BILINEAR_CELL_CACHE
+
+    //
+    // Add 'G29 K' to probe only the grid points around a given area, such as
+    // the print's bounding box. The rest of the mesh is kept or extrapolated.
+    //
+    //#define G29_ADAPTIVE_PROBING
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2276,6 +2423,9 @@
   //#define UBL_TILT_ON_MESH_POINTS         // Use nearest mesh points with G29 J for better Z reference
   //#define UBL_TILT_ON_MESH_POINTS_3POINT  // Use nearest mesh points with G29 J0 (3-point)
 
+  //#define UBL_SMART_FILL_WINDOW 3 // With UBL_G29_P31, weight by distance only within this many points.
+                                    // Farther points count as in P3.10. Much faster on large meshes.
+
   #define UBL_MESH_EDIT_MOVES_Z     // Sophisticated users prefer no movement of nozzle
   #define UBL_SAVE_ACTIVE_ON_M500   // Save the currently active mesh in the current slot on M500
 
@@ -2317,6 +2467,34 @@
 
 #endif // BED_LEVELING
 
+/**
+ * Selectable order for probing the leveling grid with G29 (Bilinear / Linear ABL)
+ * and G29 P1 (UBL). Use 'M215 S<order>' to pick the order. The XY travel is reported
+ * after probing so the orders can be compared. (M215 with no parameters to report.)
+ *   0 : Serpentine - Row by row, alternating direction
+ *   1 : Hilbert    - Along a Hilbert space-filling curve
+ *   2 : Nearest    - Always the closest point not yet probed
+ */
+//#define SELECTABLE_PROBE_ORDER
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+  #define PROBE_ORDER_DEFAULT 0     // Order used at startup
+#endif
+
+/**
+ * Probe statistics for Bilinear ABL G29 and UBL G29 P1
+ * Keep the heights probed at each grid point over the last runs and report
+ * the spread, drift and outliers of each point with 'M216'. (R to reset.)
+ * Use this to decide whether the bed has moved enough to need a new mesh.
+ * The runs are kept in PROBESTA.BIN on the SD card, when one is mounted.
+ * RAM use is 2 bytes per grid point per run.
+ */
+//#define PROBE_STATISTICS
+#if ENABLED(PROBE_STATISTICS)
+  #define PROBE_STATS_RUNS          8 // Number of G29 runs to keep (2-16)
+  #define PROBE_STATS_OUTLIER_SIGMA 3 // A height this many sigma from the mean is an outlier
+  #define PROBE_STATS_REPROBE_MM 0.05 // (mm) Advise a new mesh when the bed shape changes this much
+#endif
+
 /**
  * Add a bed leveling sub-menu for ABL or MBL.
  * Include a guided procedure if manual probing is enabled.
@@ -2485,6 +2663,10 @@
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT    // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+  //#define FLASH_EEPROM_JOURNAL // With FLASH_EEPROM_EMULATION on STM32F1, write only the changes, in the background
+  //#define EEPROM_BACKGROUND_WRITE // With IIC_BL24CXX_EEPROM on STM32, write changed pages from a RAM copy, in the background
+  #define EEPROM_SECTION_SAVE  // Save one section (probe offset, mesh, PID, LCD) without rewriting the rest
+  //#define EEPROM_LAZY_LOAD     // With AUTO_BED_LEVELING_BILINEAR, read and check the stored mesh on first use, not at boot
 #endif
 
 // @section host
@@ -3321,7 +3503,11 @@
 #if DGUS_UI_IS(CR6_COMM)
   #define DGUS_LCD_UI_CR6_COMM_ORIENTATION 3 // 0=0°, 1=90°, 2=180°, 3=270°// Portrait Mode
   //#define CR6_BOOT_DELAY 1500       // (ms)
-  #define LCD_SERIAL_PORT 3
+  #if MB(CREALITY_V453_GD32_MFL)
+    #define LCD_SERIAL_PORT 2
+  #else
+    #define LCD_SERIAL_PORT 3
+  #endif
 #endif
 
 #if DGUS_UI_IS(MKS)
@@ -3534,6 +3720,7 @@
 
 #if ENABLED(TFT_LVGL_UI)
   //#define MKS_WIFI_MODULE // MKS WiFi module
+  //#define TFT_LVGL_DMA_FLUSH // Send with DMA and draw into a second buffer meanwhile. Uses 16K more RAM.
 #endif
 
 /**
@@ -3717,6 +3904,7 @@
   #define NEOPIXEL_IS_SEQUENTIAL          // Sequential display for temperature change - LED by LED. Disable to change all LEDs at once.
   #define NEOPIXEL_BRIGHTNESS         127 // Initial brightness (0-255)
   //#define NEOPIXEL_STARTUP_TEST         // Cycle through colors at startup
+  //#define NEOPIXEL_DMA                  // (STM32F1/F4) Send by SPI DMA with interrupts enabled. NEOPIXEL_PIN must be an SPI MOSI pin.
 
   // Support for second Adafruit NeoPixel LED driver controlled with M150 S1 ...
   //#define NEOPIXEL2_SEPARATE
@@ -187,6 +187,7 @@
 //#define MAX31865_USE_AUTO_MODE                  // Read faster and more often than 1-shot; bias voltage always on; slight effect on RTD temperature.
 //#define MAX31865_MIN_SAMPLING_TIME_MSEC     100 // (ms) 1-shot: minimum read interval. Reduces bias voltage effects by leaving sensor unpowered for longer intervals.
 //#define MAX31865_IGNORE_INITIAL_FAULTY_READS 10 // Ignore some read faults (keeping the temperature reading) to work around a possible issue (#23439).
+                                                // 1-shot: Define TEMP_0_DRDY_PIN (etc.) to read each conversion as soon as DRDY signals it's done.
 
 //#define MAX31865_WIRE_OHMS_0              0.95f // For 2-wire, set the wire resistances for more accurate readings.
 //#define MAX31865_WIRE_OHMS_1              0.0f
@@ -212,6 +213,30 @@
   #endif
 #endif
 
+/**
+ * Heater PWM Interleave
+ * Move the bed's soft PWM on-time to the end of each cycle, so it follows
+ * the hotends' on-time instead of starting with it. Together they only draw
+ * at the same time when their duties add up to more than 100%.
+ * This lowers the peak load on the power supply and the ripple on its rails.
+ */
+//#define HEATER_PWM_INTERLEAVE
+#if ENABLED(HEATER_PWM_INTERLEAVE)
+  //#define HEATER_PWM_EXCLUSIVE    // Never power the bed while a hotend is on. The hotends get priority.
+#endif
+
+/**
+ * Hardware PWM Heaters
+ * Drive the hotend, bed, and chamber heaters, and the FAN_SOFT_PWM fans, from hardware
+ * timers where the pin has a free timer channel. The temperature ISR no longer toggles
+ * those pins. Pins without a free timer go on using soft PWM. Pins that share a timer
+ * also share its frequency. (STM32 only)
+ */
+//#define HEATER_HW_PWM
+#if ENABLED(HEATER_HW_PWM)
+  #define HEATER_HW_PWM_FREQUENCY 50 // (Hz) Keep this low for heater MOSFETs
+#endif
+
 //
 // Heated Chamber options
 //
@@ -410,6 +435,14 @@
     // Keep in mind that some heaters heat up faster than others.
     //#define THERMAL_PROTECTION_VARIANCE_MONITOR_PERIOD 30  // (s) Override all watch periods
   #endif
+
+  /**
+   * Run the thermal runaway and heating watch checks for the hotends and bed at this
+   * interval instead of on every temperature reading. Their periods are in seconds, so a
+   * fraction of a second more in finding a fault doesn't matter. MAXTEMP is still checked
+   * on every reading, and a heater stable at its target takes a short path.
+   */
+  //#define THERMAL_CHECK_INTERVAL 250 // (ms)
 #endif
 
 #if ENABLED(PIDTEMP)
@@ -559,6 +592,7 @@
   #define HOTEND_IDLE_MIN_TRIGGER   180     // (°C) Minimum temperature to enable hotend protection
   #define HOTEND_IDLE_NOZZLE_TARGET   0     // (°C) Safe temperature for the nozzle after timeout
   #define HOTEND_IDLE_BED_TARGET      0     // (°C) Safe temperature for the bed after timeout
+  //#define HOTEND_IDLE_REHEAT              // Restore the temperatures as soon as extrusion, homing, probing or a print start is queued
 #endif
 
 // @section temperature
@@ -570,6 +604,30 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Resample the thermistor tables at compile time into evenly spaced tables
+ * indexed by the raw ADC value. A reading converts with one shift and one lerp
+ * instead of a table search. Custom thermistors (1000) are resampled into RAM.
+ * Each table takes 2 * (2^THERMISTOR_LOOKUP_BITS + 1) bytes.
+ */
+//#define THERMISTOR_FAST_LOOKUP
+#if ENABLED(THERMISTOR_FAST_LOOKUP)
+  #define THERMISTOR_LOOKUP_BITS 10 // 2^N segments over the raw ADC range
+#endif
+
+/**
+ * Continuous DMA scan of the ADC (STM32F1 with the STM32 HAL)
+ * Convert all sensor pins without end into a ring of scans, so the
+ * temperature ISR only filters the ring instead of waiting on analogRead.
+ * Pins read with M43 will upset the scan until the next reset.
+ */
+//#define ADC_DMA_SCAN
+#if ENABLED(ADC_DMA_SCAN)
+  #define ADC_DMA_SCANS      16 // Scans in the ring (2, 4, 8, 16 or 32)
+  #define ADC_DMA_FILTER      0 // Filter over the ring. 0:Mean 1:Median
+  #define ADC_DMA_IIR_SHIFT   0 // Low-pass after the filter, weight 1/2^N. 0 to disable.
+#endif
+
 // @section fans
 
 /**
@@ -679,6 +737,25 @@
   //#define NUM_REDUNDANT_FANS 1        // Number of sequential fans to synchronize with Fan 0
 #endif
 
+/**
+ * Layer Time Fan
+ * Raise the part cooling fan on short layers, which have less time to cool.
+ * A new layer starts with the first extruding move above the last layer. The
+ * fan speed for the layer comes from the planned time of the layer before it
+ * and is applied a little ahead, to the moves already in the buffer, to give
+ * the fan time to spin up. Only raises a fan already turned on with M106.
+ * Set with M228.
+ */
+//#define LAYER_TIME_FAN
+#if ENABLED(LAYER_TIME_FAN)
+  #define LAYER_FAN_INDEX        0  // Part cooling fan to raise
+  #define LAYER_FAN_FAST_TIME   10  // (s) Layer time for the maximum speed
+  #define LAYER_FAN_SLOW_TIME   30  // (s) Layer time for no boost. Speed is linear in between.
+  #define LAYER_FAN_MAX_SPEED  255  // (0-255) Speed on the fastest layers
+  #define LAYER_FAN_MIN_HEIGHT 0.05 // (mm) Smaller rises (Z-hop, leveling) are not a new layer
+  #define LAYER_FAN_LEAD_MS    500  // (ms) Queued move time at the end of a layer to raise in advance
+#endif
+
 /**
  * Extruder cooling fans
  *
@@ -718,6 +795,17 @@
  * NOTE: Only works with fans up to 7000 RPM.
  */
 //#define FOURWIRES_FANS      // Needed with AUTO_FAN when 4-wire PWM fans are installed
+
+/**
+ * Time each tachometer pulse with a pin interrupt instead of reading the
+ * pins in the 1kHz Temperature ISR. Gives the speed from the last pulse
+ * period, without the RPM limit. Tacho pins must support interrupts.
+ */
+//#define FAN_TACHO_INTERRUPTS
+#if ENABLED(FAN_TACHO_INTERRUPTS)
+  //#define FAN_TACHO_TARGET_RPM     4000 // Hold auto fans at this speed, adjusting the PWM once a second. Set with M123 T.
+  #define FAN_TACHO_RPM_PER_PWM        40 // Speed error per PWM step of adjustment
+#endif
 //#define E0_FAN_TACHO_PIN -1
 //#define E0_FAN_TACHO_PULLUP
 //#define E0_FAN_TACHO_PULLDOWN
@@ -938,10 +1026,23 @@
 #define HOMING_BUMP_MM      { 5, 5, 2 }       // (linear=mm, rotational=°) Backoff from endstops after first bump
 #define HOMING_BUMP_DIVISOR { 2, 2, 4 }       // Re-Bump Speed Divisor (Divides the Homing Feedrate)
 
+/**
+ * Single-pass homing
+ * Home each axis with only the fast move, skipping the backoff and slow bump.
+ * The axis is set from the position captured at the endstop edge, corrected for
+ * the distance it moved before it stopped. Requires ENDSTOP_EDGE_CAPTURE.
+ * The broken endstop check (DETECT_BROKEN_ENDSTOP) is done in the bump so it's skipped.
+ */
+//#define SINGLE_PASS_HOMING
+#if ENABLED(SINGLE_PASS_HOMING)
+  //#define SINGLE_PASS_HOMING_VERIFY         // Also do the bump, home from it, and report how far the single pass was off
+#endif
+
 //#define HOMING_BACKOFF_POST_MM { 2, 2, 2 }  // (linear=mm, rotational=°) Backoff from endstops after homing
 //#define XY_COUNTERPART_BACKOFF_MM 0         // (mm) Backoff X after homing Y, and vice-versa
 
 #define QUICK_HOME                            // If G28 contains XY do a diagonal move first
+//#define HOME_XY_TOGETHER                    // If G28 contains XY home X and Y at the same time (overrides QUICK_HOME)
 //#define HOME_Y_BEFORE_X                     // If G28 contains XY home Y before X
 //#define HOME_Z_FIRST                        // Home Z first. Requires a real endstop (not a probe).
 //#define CODEPENDENT_XY_HOMING               // If X/Y can't home without homing Y/X first
@@ -1077,6 +1178,11 @@
     // Amplification factor. Used to scale the correction step up or down in case
     // the stepper (spindle) position is farther out than the test point.
     #define Z_STEPPER_ALIGN_AMP 1.0       // Use a value > 1.0 NOTE: This may cause instability!
+
+    // Measure how much each stepper's last correction actually changed its
+    // misalignment and scale the next correction to match, instead of using
+    // a fixed amplification. Converges in fewer iterations.
+    //#define Z_STEPPER_ALIGN_FIT
   #endif
 
   // On a 300mm bed a 5% grade would give a misalignment of ~1.5cm
@@ -1124,6 +1230,12 @@
   #define RESTORE_LEVELING_AFTER_G35    // Enable to restore leveling setup after operation
   //#define REPORT_TRAMMING_MM          // Report Z deviation (mm) for each point relative to the first
 
+  //#define ASSISTED_TRAMMING_LIVE      // G35 L: Reprobe each point while its screw is turned, until it matches the first
+  #if ENABLED(ASSISTED_TRAMMING_LIVE)
+    #define TRAMMING_LIVE_TOLERANCE 0.02 // (mm) A point is done when this close to the first point
+    #define TRAMMING_LIVE_TIMEOUT     60 // (s) Give up on a point after this long
+  #endif
+
   //#define ASSISTED_TRAMMING_WIZARD    // Add a Tramming Wizard to the LCD menu
 
   //#define ASSISTED_TRAMMING_WAIT_POSITION { X_CENTER, Y_CENTER, 30 } // Move the nozzle out of the way for adjustment
@@ -1230,6 +1342,16 @@
   #endif
 
   #define FTM_MIN_SHAPE_FREQ           10       // (Hz) Minimum shaping frequency, lower consumes more RAM
+
+  //#define FTM_FIXED_POINT                     // Use integer math for each trajectory sample, shaping, smoothing,
+                                                // and step generation. Float is only used once per block.
+                                                // Recommended for MCUs without an FPU (e.g., STM32F1).
+  //#define FTM_BUDGET_REPORT                   // Report the time taken per batch with M493, against the time it covers
+
+  //#define FTM_CUSTOM_SHAPER                   // Custom shaper (M493 X9) from a measured impulse table, set with M495
+  #if ENABLED(FTM_CUSTOM_SHAPER)
+    #define FTM_CUSTOM_IMPULSES          7      // Maximum impulses per axis. Each impulse adds a tap per sample.
+  #endif
 #endif // FT_MOTION
 
 /**
@@ -1245,12 +1367,14 @@
  * If the buffer is too small at runtime, input shaping will have reduced
  * effectiveness during high speed movements.
  *
- * Tune with M593 D<factor> F<frequency>
+ * Tune with M593 D<factor> F<frequency>, and select
+ * a shaper type with M593 T<type> if SHAPING_MAX_IMPULSES > 2.
  */
 #define INPUT_SHAPING_X
 #define INPUT_SHAPING_Y
 //#define INPUT_SHAPING_Z
-#if ANY(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z)
+//#define INPUT_SHAPING_E                 // Shape extruder and Linear Advance steps to follow the shaped head motion
+#if ANY(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z, INPUT_SHAPING_E)
   #if ENABLED(INPUT_SHAPING_X)
     #define SHAPING_FREQ_X  55.0        // (Hz) The default dominant resonant frequency on the X axis.
     #define SHAPING_ZETA_X   0.30       // Damping ratio of the X axis (range: 0.0 = no damping to 1.0 = critical damping).
@@ -1263,9 +1387,66 @@
     #define SHAPING_FREQ_Z  40.0        // (Hz) The default dominant resonant frequency on the Z axis.
     #define SHAPING_ZETA_Z   0.15       // Damping ratio of the Z axis (range: 0.0 = no damping to 1.0 = critical damping).
   #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    #define SHAPING_FREQ_E  55.0        // (Hz) Usually the frequency of the shaped X or Y axis that dominates the print moves.
+    #define SHAPING_ZETA_E   0.30       // Damping ratio to match the same axis.
+  #endif
   //#define SHAPING_MIN_FREQ  20.0      // (Hz) By default the minimum of the shaping frequencies. Override to affect SRAM usage.
   //#define SHAPING_MAX_STEPRATE 10000  // By default the maximum total step rate of the shaped axes. Override to affect SRAM usage.
+  //#define SHAPING_RUN_QUEUE           // Queue runs of evenly spaced steps per axis instead of every step. Much less SRAM
+                                        // for low frequencies and high step rates. Not sized by SHAPING_MIN_FREQ / SHAPING_MAX_STEPRATE.
+  #if ENABLED(SHAPING_RUN_QUEUE)
+    #define SHAPING_QUEUE_RUNS      64  // Runs queued per shaped axis (8 bytes each). If full, the oldest echoes are applied early.
+    #define SHAPING_RUN_TOLERANCE   50  // (µs) Maximum echo timing error allowed to add a step to a run
+  #endif
+  //#define SHAPING_MAX_IMPULSES 3      // Allow shapers with more impulses for wider vibration suppression: 3 adds ZVD, MZV and EI,
+                                        // 4 also adds ZVDD and 2HEI. The step buffer grows with the longest shaper. (Not for AVR)
   //#define SHAPING_MENU                // Add a menu to the LCD to set shaping parameters.
+
+  /**
+   * Measure the X / Y resonances with M958, using an SPI accelerometer fixed to the
+   * toolhead, and set the shaping frequency and damping ratio of each axis.
+   * The axis is shaken through a rising frequency sweep while the sensor FIFO
+   * is read by SPI DMA, and the spectrum is found with a fixed-point FFT.
+   * (STM32 only)
+   */
+  //#define RESONANCE_TUNING
+  #if ENABLED(RESONANCE_TUNING)
+    #define ACCEL_ADXL345                 // Sensor type: ACCEL_ADXL345 or ACCEL_LIS2DW
+    //#define ACCEL_LIS2DW
+    #define ACCEL_CS_PIN            -1    // Chip select. Required.
+    //#define ACCEL_SCK_PIN         -1    // The SPI bus defaults to the SD card pins
+    //#define ACCEL_MISO_PIN        -1
+    //#define ACCEL_MOSI_PIN        -1
+    #define ACCEL_AXIS_X             0    // Sensor axis (0=X, 1=Y, 2=Z) along the printer X axis
+    #define ACCEL_AXIS_Y             1    // Sensor axis along the printer Y axis
+    #define RESONANCE_FREQ_MIN    10.0    // (Hz) Sweep start frequency
+    #define RESONANCE_FREQ_MAX   120.0    // (Hz) Sweep end frequency, below 400
+    #define RESONANCE_ACCEL_PER_HZ  75    // (mm/s² per Hz) Shaking acceleration, rising with the frequency
+    #define RESONANCE_SWEEP_RATE   2.0    // (Hz/s) Sweep rate. Slower gives a sharper spectrum.
+  #endif
+#endif
+
+/**
+ * Find the highest safe acceleration and feedrate of X / Y with M959.
+ * The axis makes cycles of long strokes with rising acceleration, then rising
+ * feedrate, until a stage skips steps or rings too much. Skipped steps show as
+ * a shift in the homing endstop position, checked after each stage. With
+ * RESONANCE_TUNING the accelerometer also measures the ringing after each stop.
+ * The last good stage, less a margin, is set with M201 / M203. Save with M500.
+ */
+//#define LIMITS_CALIBRATION
+#if ENABLED(LIMITS_CALIBRATION)
+  #define LIMITS_CAL_ACCEL_START   1000   // (mm/s²) First acceleration stage
+  #define LIMITS_CAL_ACCEL_MAX    20000   // (mm/s²) Stop ramping here
+  #define LIMITS_CAL_FEED_START     100   // (mm/s) First feedrate stage
+  #define LIMITS_CAL_FEED_MAX       500   // (mm/s) Stop ramping here
+  #define LIMITS_CAL_RAMP          1.2    // Factor from one stage to the next
+  #define LIMITS_CAL_STROKE        100    // (mm) Stroke length, centred on the axis
+  #define LIMITS_CAL_CYCLES          5    // Strokes out and back per stage
+  #define LIMITS_CAL_TOLERANCE     0.1    // (mm) Endstop shift taken as skipped steps
+  #define LIMITS_CAL_MARGIN         20    // (%) Taken off the last good stage
+  #define LIMITS_CAL_RINGING       0.5    // Highest ringing after a stop, as a part of the stage acceleration
 #endif
 
 // @section motion
@@ -1347,6 +1528,11 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Play the correction steps from a Stepper ISR phase of their own, spread over the
+  // block that needs them, instead of adding them to the block. Planned speeds and
+  // block timing are then unaffected by the correction. Cartesian XYZ only.
+  //#define BACKLASH_STEPPER
+
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
 
@@ -1438,6 +1624,18 @@
  */
 #define MULTISTEPPING_LIMIT   16  // :[1, 2, 4, 8, 16, 32, 64, 128]
 
+/**
+ * Smooth Multi-stepping
+ * Choose the steps per ISR from the step rate instead of doubling and halving
+ * them as the ISR runs out of time or sits idle. A burst size is only dropped
+ * once the rate falls MULTISTEPPING_HYSTERESIS percent below the limit that
+ * raised it, so ramps and curves near a limit don't keep toggling it.
+ */
+//#define SMOOTH_MULTISTEPPING
+#if ENABLED(SMOOTH_MULTISTEPPING)
+  #define MULTISTEPPING_HYSTERESIS 10 // (%) :[1-50]
+#endif
+
 /**
  * Adaptive Step Smoothing increases the resolution of multi-axis moves, particularly at step frequencies
  * below 1kHz (for AVR) or 10kHz (for ARM), where aliasing between axes in multi-axis moves causes audible
@@ -1446,6 +1644,15 @@
  */
 #define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Step Interval Table
+ * On 32-bit MCUs get the step timer interval from a reciprocal table with
+ * linear interpolation instead of a division by the step rate. May help MCUs
+ * with slow or no hardware divide. The table is 516 bytes of flash.
+ * Build with MARLIN_TEST_BUILD to report its accuracy and speed at startup.
+ */
+//#define STEP_INTERVAL_TABLE
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1738,6 +1945,10 @@
   #endif
 #endif
 
+// Estimate the remaining SD print time from the planned time of each block and the file position.
+// Used when no remaining time is set by M73 R. Motion only, so heating and dwell time are excluded.
+//#define PLANNER_TIME_ESTIMATE
+
 // LCD Print Progress options. Multiple times may be displayed in turn.
 #if HAS_DISPLAY && ANY(HAS_MEDIA, SET_PROGRESS_MANUALLY)
   #define SHOW_PROGRESS_PERCENT           // Show print progress percentage (doesn't affect progress bar)
@@ -1772,14 +1983,116 @@
    */
   //#define SD_SPI_SPEED SPI_HALF_SPEED
 
+  //#define SD_MULTIBLOCK_READ              // Read contiguous blocks from SPI SD cards (or STM32 SDIO) with one CMD18 multi-block read
+  //#define SD_READ_BENCHMARK               // Add M35 to measure the read speed of a file on the media
+  //#define SD_FAT_RUN_CACHE                // Remember runs of contiguous clusters so reads cross clusters without a FAT lookup
+  //#define SD_MULTIBLOCK_WRITE             // Write contiguous blocks to SPI SD cards with one CMD25 multi-block write
+  //#define SD_SPI_DMA                      // Move SPI SD card blocks by DMA instead of byte by byte (HAL/STM32)
+
   // The standard SD detect circuit reads LOW when media is inserted and HIGH when empty.
   // Enable this option and set to HIGH if your SD cards are incorrectly detected.
   //#define SD_DETECT_STATE HIGH
 
   //#define SD_IGNORE_AT_STARTUP            // Don't mount the SD card when starting up
+  //#define SD_ASYNC_MOUNT                  // Mount the SD card in the idle loop after startup and read its directory in a later idle
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
+  //#define SD_COMPACT_MOVES                // Write G0/G1 lines received with M28 without spaces and with at most 5 decimals
+
+  /**
+   * Read ahead of the print job into RAM buffers of one 512-byte block each.
+   * The buffers are filled in the idle loop while printing, so G-code is usually
+   * read from RAM and slow card accesses (e.g., at a FAT cluster boundary) are
+   * absorbed before the command queue runs dry.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BUFFERS 2         // (2..8) Number of 512-byte buffers
+  #endif
+
+  /**
+   * Copy the job being printed into SPI flash in the idle loop and read it from there once
+   * copied. The card can be removed once the copy is complete ("Job cached" is reported),
+   * but anything that writes to the card (power-loss file, layer index) fails until it's back.
+   * Erase and program run in the background, one 256-byte page per idle call.
+   * Requires SPI_FLASH and SD_READ_AHEAD. Jobs larger than SD_JOB_CACHE_SIZE aren't cached.
+   */
+  //#define SD_JOB_CACHE
+  #if ENABLED(SD_JOB_CACHE)
+    #define SD_JOB_CACHE_ADDR 0x100000      // Start of the cache, on a 4K sector
+    #define SD_JOB_CACHE_SIZE 0x600000      // Size of the cache, a multiple of 4K
+  #endif
+
+  /**
+   * Print heatshrink-compressed G-code (e.g., "CUBE.GCO.HS") by decoding it as it's read.
+   * A compressed job is about a third the size, to upload faster and read less from the card.
+   * Compress with window 8 and lookahead 4: 'heatshrink -e -w 8 -l 4 cube.gco cube.gco.hs'
+   * (window 12 with SD_BINARY_GCODE). Positions (M26, M808, power-loss resume) are in the
+   * decoded G-code, so a seek decodes from the start of the file.
+   * Uses about 300 bytes of RAM (4.2K with SD_BINARY_GCODE) plus the buffer.
+   */
+  //#define SD_HEATSHRINK
+
+  /**
+   * Print binary G-code (e.g., "CUBE.BGCODE" from PrusaSlicer) with G-code blocks that are
+   * uncompressed or heatshrink 12/4, plain or MeatPack. The CRC of each block is checked as
+   * it's read, aborting the print on an error. With GCODE_METADATA_INDEX and GCODE_THUMBNAILS
+   * the metadata and thumbnail blocks at the start of the file are read directly.
+   * Uses about 4.2K of RAM for the heatshrink decoder and its window.
+   */
+  //#define SD_BINARY_GCODE
+
+  #if ANY(SD_HEATSHRINK, SD_BINARY_GCODE)
+    #define SD_DECODE_BUFFER 128            // (16..512) Bytes of decoded G-code to buffer
+  #endif
+
+  /**
+   * Build a sidecar index (e.g., "CUBE.LYR" for "CUBE.GCO") of the file position and Z
+   * of each layer change while printing. Once a print has completed the index is used
+   * to report "Layer n/total" with M27 and to start at a layer with 'M26 L<layer>'.
+   * Requires POWER_LOSS_RECOVERY for the file position of each command.
+   */
+  //#define SD_LAYER_INDEX
+  #if ENABLED(SD_LAYER_INDEX)
+    #define SD_LAYER_INDEX_BUFFER 16        // Layers to buffer in RAM between writes
+  #endif
+
+  /**
+   * Read the base64 thumbnails that slicers embed in the G-code header (PNG, JPG or QOI).
+   * The image is decoded as it is read, a chunk at a time, for displays to show in the
+   * file browser. Recently seen files are cached so scrolling doesn't scan them again.
+   */
+  /**
+   * Print the jobs listed in "QUEUE.TXT" one after another, for unattended batches.
+   * Each line is '<file> [<copies>] [<G-code>]', the G-code running before each copy.
+   * SD_JOB_QUEUE_CLEAR_GCODE runs after each job (e.g., to push the part off the bed).
+   * The queue position is kept in "QUEUE.POS" on the media so it survives a power loss.
+   * Start with 'M229 S1', stop after the current job with 'M229 S0', rewind with 'M229 R'.
+   * Aborting a job stops the queue.
+   */
+  //#define SD_JOB_QUEUE
+  #if ENABLED(SD_JOB_QUEUE)
+    //#define SD_JOB_QUEUE_CLEAR_GCODE "M190 R30\nG28 X\nG1 Z200 F600"  // Bed-clear macro
+  #endif
+
+  //#define GCODE_THUMBNAILS
+  #if ENABLED(GCODE_THUMBNAILS)
+    #define GCODE_THUMBNAIL_CACHE 8         // Files whose thumbnail location is remembered
+  #endif
+
+  /**
+   * Read the slicer's estimated time, filament and layer height (and the thumbnail location)
+   * from a file once and keep them in an index file (GCODEMD.IDX) in its folder, keyed by
+   * name, size and date. Displays show them when a file is selected and 'M20 I' lists them.
+   */
+  //#define GCODE_METADATA_INDEX
+  #if ENABLED(GCODE_METADATA_INDEX)
+    #define GCODE_METADATA_TAIL 32768       // (bytes) End of the file to scan, for slicers that put the estimates there. 0 to scan only the header.
+  #endif
 
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
+  #if ENABLED(GCODE_REPEAT_MARKERS)
+    //#define GCODE_REPEAT_CACHE 2048       // (bytes) Replay the innermost loop body from RAM if it fits, instead of reading it again
+  #endif
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
@@ -1831,6 +2144,22 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE    0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Append small records (position, SD position, temperatures) to a preallocated
+    // recovery file between full saves. Each record is a single sector write, so
+    // saves can be made much more often without stalling on the SD card.
+    #define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_RECORDS 64 // Records between full saves
+
+      // On outage save the record to a faster store instead of the SD card.
+      // It's copied to the SD file on the next boot.
+      //#define POWER_LOSS_STORE_SPI_FLASH    // W25Qxx SPI flash. Requires SPI_FLASH.
+      #if ENABLED(POWER_LOSS_STORE_SPI_FLASH)
+        #define POWER_LOSS_STORE_ADDR 0x7FF000 // A 4K sector reserved for the record
+      #endif
+      //#define POWER_LOSS_STORE_BACKUP_SRAM  // STM32F1/F4/F7 backup domain. Requires a battery on VBAT.
+    #endif
+
     //#define BACKUP_POWER_SUPPLY           // Backup power / UPS to move the steppers on power-loss
     #if ENABLED(BACKUP_POWER_SUPPLY)
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
@@ -1882,6 +2211,16 @@
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
   #endif
 
+  /**
+   * Index the visible items of the current folder in RAM, at 2 bytes each.
+   * File browsers and sorting then read any item directly instead of
+   * scanning the folder from the start, which is slow in big folders.
+   */
+  //#define SD_DIR_INDEX
+  #if ENABLED(SD_DIR_INDEX)
+    #define SD_DIR_INDEX_LIMIT 256    // Maximum number of indexed items. Later items are found by scanning.
+  #endif
+
   // Allow international symbols in long filenames. To display correctly, the
   // LCD's font must contain the characters. Check your selected LCD language.
   //#define UTF_FILENAME_SUPPORT
@@ -1980,6 +2319,14 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Let the host send this many packets before waiting for an 'ok'. The serial receive buffer
+    // must hold them while the media is written: RX_BUFFER_SIZE >= WINDOW * (MAX_CMD_SIZE + 10).
+    //#define BINARY_STREAM_WINDOW 4
+
+    // Hold the packets of the window in RAM (WINDOW * MAX_CMD_SIZE bytes) so they may arrive out of
+    // order. Only missing packets are sent again, and the serial buffer only needs to hold one packet.
+    //#define BINARY_STREAM_SELECTIVE_REPEAT
   #endif
 
   // "Over-the-air" Firmware Update with M936 - Required to set EEPROM flag
@@ -2019,6 +2366,14 @@
  */
 //#define NO_SD_HOST_DRIVE   // Disable SD Card access over USB (for security).
 
+/**
+ * Let the USB host read the onboard SD card and write new files while printing (HAL/STM32).
+ * The host waits while Marlin uses the card, and its transfers run below the stepper and
+ * temperature interrupts. Writes to the job being printed or to blocks Marlin is changing
+ * are refused. Files added by the host show up in the menu after a refresh.
+ */
+//#define MSC_SHARED_PRINTING
+
 /**
  * Additional options for Graphical Displays
  *
@@ -2102,6 +2457,21 @@
   //#define GAMES_EASTER_EGG          // Add extra blank lines above the "Games" sub-menu
 #endif
 
+//
+// Additional options for Extensible UI displays
+//
+#if ENABLED(EXTENSIBLE_UI)
+  /**
+   * Queue the mesh, status and print timer events for the display and send them
+   * on the next UI update, so probing and moves don't wait on display traffic.
+   * Only the latest status message and the latest value of a mesh point are sent.
+   */
+  //#define EXTUI_EVENT_QUEUE
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+    #define EXTUI_EVENT_QUEUE_SIZE 16     // Events held until the next UI update
+  #endif
+#endif
+
 //
 // Additional options for DGUS / DWIN displays
 //
@@ -2114,6 +2484,21 @@
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
 
+  /**
+   * Reduce LCD serial traffic and the time spent updating the screen.
+   * Not for the IA_CREALITY and ANYCUBIC_LCD_VYPER UIs.
+   * DGUS_VP_BATCHING merges the screen updates of adjacent VPs into a single write.
+   * DGUS_VP_CACHE skips writes of VPs that still hold the last value sent.
+   */
+  //#define DGUS_VP_BATCHING
+  #if ENABLED(DGUS_VP_BATCHING)
+    #define DGUS_VP_BATCH_SIZE 32         // (bytes) Largest merged write. Keep below DGUS_TX_BUFFER_SIZE - 6.
+  #endif
+  //#define DGUS_VP_CACHE
+  #if ENABLED(DGUS_VP_CACHE)
+    #define DGUS_VP_CACHE_SIZE 64         // Number of VP values kept to detect unchanged VPs
+  #endif
+
   #if DGUS_UI_IS(FYSETC, MKS, HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
     #define DGUS_PREHEAT_UI               // Display a preheat screen during heatup
@@ -2151,6 +2536,27 @@
 
     #define DGUS_ADVANCED_SDCARD            // Allow more than 20 files and navigating directories
     #define DGUS_USERCONFIRM                // Reuse the SD Card page to show various messages
+
+  #elif DGUS_UI_IS(CR6_COMM)
+    #define DGUS_RX_QUEUE_SIZE 256          // (bytes) Touch datagrams kept while the UI is busy (e.g., homing)
+
+    /**
+     * With GCODE_THUMBNAILS, send the JPG thumbnail of a selected file to the display.
+     * The image is written from DGUS_THUMBNAIL_VP + 1 a few bytes per loop, then its
+     * length in bytes goes to DGUS_THUMBNAIL_VP (0 while loading or when there is none).
+     * Requires display firmware with a JPEG control reading from that VP.
+     */
+    //#define DGUS_THUMBNAIL_VP 0x8000
+    #ifdef DGUS_THUMBNAIL_VP
+      #define DGUS_THUMBNAIL_MAX_WIDTH 200  // (px) Largest thumbnail the control shows
+    #endif
+
+    /**
+     * Diagnostics page with the planner fill, command queue depth, longest main loop,
+     * Stepper ISR load (with STEPPER_ISR_PROFILER) and longest SD block read since the
+     * last screen update. Requires display firmware with page 84 and the VP_PERF_* VPs.
+     */
+    //#define DGUS_PERF_PAGE
   #endif
 #endif // HAS_DGUS_LCD
 
@@ -2353,6 +2759,11 @@
   #define BABYSTEP_MULTIPLICATOR_Z  40      // (steps or mm) Steps or millimeter distance for each Z babystep
   #define BABYSTEP_MULTIPLICATOR_XY 1       // (steps or mm) Steps or millimeter distance for each XY babystep
 
+  //#define BABYSTEP_PLANNER                // Apply Z babysteps as an offset ramped into the next planned moves instead of stepping Z
+  #if ENABLED(BABYSTEP_PLANNER)
+    #define BABYSTEP_PLANNER_SLOPE 0.02     // (mm/mm) Largest Z offset change per mm of XY travel
+  #endif
+
   //#define DOUBLECLICK_FOR_Z_BABYSTEPPING  // Double-click on the Status Screen for Z Babystepping.
   #if ENABLED(DOUBLECLICK_FOR_Z_BABYSTEPPING)
     #define DOUBLECLICK_MAX_INTERVAL 1250   // (ms) Maximum interval between clicks.
@@ -2403,6 +2814,8 @@
   //#define ADVANCE_K_EXTRA       // Add a second linear advance constant, configurable with M900 L.
   //#define LA_DEBUG              // Print debug information to serial during operation. Disable for production use.
   //#define EXPERIMENTAL_I2S_LA   // Allow I2S_STEPPER_STREAM to be used with LA. Performance degrades as the LA step rate reaches ~20kHz.
+  //#define LA_JUNCTION_LIMIT     // Slow corners where the flow per mm changes, keeping the E speed step within the E jerk.
+                                  // For Junction Deviation. CLASSIC_JERK already limits E at junctions.
 
   //#define SMOOTH_LIN_ADVANCE    // Remove limits on acceleration by gradual increase of nozzle pressure
   #if ENABLED(SMOOTH_LIN_ADVANCE)
@@ -2419,6 +2832,7 @@
       #define ADVANCE_TAU 0.02       // (s) Smoothing time to reduce extruder acceleration
     #endif
     #define SMOOTH_LIN_ADV_HZ 1000   // (Hz) How often to update extruder speed
+    #define SMOOTH_LIN_ADV_LOOKAHEAD 16 // (blocks) Most planner blocks to search ahead per update. Bounds the cost with short segments.
     #define INPUT_SHAPING_E_SYNC     // Synchronize the extruder-shaped XY axes (to increase precision)
   #endif
 #endif
@@ -2496,8 +2910,8 @@
   //#define MESH_MAX_Y Y_BED_SIZE - (MESH_INSET)
 #endif
 
-#if ALL(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
-  //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+#if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL) && ENABLED(EEPROM_SETTINGS)
+  //#define OPTIMIZED_MESH_STORAGE  // Store mesh in 1µm steps from its mean to halve its EEPROM space
 #endif
 
 /**
@@ -2542,6 +2956,14 @@
    */
   //#define PTC_LINEAR_EXTRAPOLATION 4
 
+  /**
+   * Fit a quadratic to each table and compensate with it instead of the straight
+   * segments between samples. The curve is smooth across the whole range, so probing
+   * can start while the probe and bed are still heating, each point compensated for
+   * its own temperatures. Outside the table the curve goes on in a straight line.
+   */
+  //#define PTC_POLYNOMIAL
+
   #if ENABLED(PTC_PROBE)
     // Probe temperature calibration generates a table of values starting at PTC_PROBE_START
     // (e.g., 30), in steps of PTC_PROBE_RES (e.g., 5) with PTC_PROBE_COUNT (e.g., 10) samples.
@@ -2602,6 +3024,10 @@
   #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  //#define ARC_ADAPTIVE_SEGMENTS     // Size segments by chord tolerance (and ARC_SEGMENTS_PER_SEC). Plan arc junctions at one speed.
+  #if ENABLED(ARC_ADAPTIVE_SEGMENTS)
+    //#define ARC_CHORD_TOLERANCE 0.01 // (mm) Max distance from a segment to the arc. Default: JUNCTION_DEVIATION_MM
+  #endif
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
@@ -2609,11 +3035,22 @@
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
 //#define BEZIER_CURVE_SUPPORT        // Requires ~2666 bytes
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  //#define BEZIER_ADAPTIVE_SEGMENTS  // Size segments by curvature like ARC_ADAPTIVE_SEGMENTS, with the same ARC_* settings
+#endif
 
 #if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
 #endif
 
+// Combine runs of short collinear G0/G1 moves into one planner block
+//#define SEGMENT_MERGE
+#if ENABLED(SEGMENT_MERGE)
+  #define SEGMENT_MERGE_MAX_LENGTH  1.0   // (mm) Only moves shorter than this are merged
+  #define SEGMENT_MERGE_DEVIATION   0.005 // (mm) Max distance of a merged point from the line of the first segment
+  #define SEGMENT_MERGE_E_DEVIATION 0.001 // (mm) Max E difference of a merged point from the first segment's extrusion ratio
+#endif
+
 /**
  * Direct Stepping
  *
@@ -2623,6 +3060,11 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  //#define STEPPER_PAGES        16         // Pages in the pool, a multiple of 4 up to 256. Each uses 256 bytes of SRAM.
+  //#define STEPPER_PAGE_FORMAT  SP_4x2_256 // SP_4x4D_128, SP_4x2_256, or SP_4x1_512
+  //#define DIRECT_STEPPING_RLE             // Accept pages as PackBits runs. Cruising segments repeat and shrink the most.
+#endif
 
 /**
  * G38 Probe Target
@@ -2686,6 +3128,38 @@
  */
 //#define MAXIMUM_STEPPER_RATE 250000
 
+/**
+ * DMA Step Stream (STM32F1 high density, e.g., STM32F103RE)
+ * Play STEP / DIR edges from a buffer with timer-triggered DMA writes to GPIO
+ * instead of setting the pins in the Stepper ISR. The Stepper runs once per half
+ * buffer, so there's no interrupt per step and every edge is exactly on time.
+ * STEP / DIR pins should be on GPIOB and GPIOC. Requires MULTISTEPPING_LIMIT 1.
+ */
+//#define STEP_DMA_STREAM
+#if ENABLED(STEP_DMA_STREAM)
+  #define STEP_DMA_STREAM_RATE 200000   // (Hz) Samples per second. Pulses are one sample long, at up to half this rate.
+#endif
+
+/**
+ * Step Port Batching (STM32)
+ * Start and stop the X, Y, Z, and E step pulses with one BSRR write per GPIO port
+ * instead of one write per axis. Axes on the same port then step on the same edge
+ * and the Stepper ISR spends less time setting pins. The ports and bits for each
+ * step pin are worked out once at startup.
+ * Not for dual / multiple steppers on an axis or a MIXING_EXTRUDER.
+ */
+//#define STEP_PORT_BATCHING
+
+/**
+ * Dual-Core Motion (RP2040, ESP32)
+ * Service the Stepper and Temperature ISRs (or the ESP32 I2S stepper task) on the
+ * second core, leaving the first core to parse G-code, apply leveling, and plan.
+ * Blocks reach the Stepper through the planner buffer as usual, and critical
+ * sections (hal.isr_off) hold off the ISRs on both cores.
+ * On ESP32 the motion core is also the WiFi core.
+ */
+//#define DUAL_CORE_MOTION
+
 // @section temperature
 
 // Control heater 0 and heater 1 in parallel.
@@ -2697,21 +3171,162 @@
 
 // @section gcode
 
+/**
+ * Compact Planner Blocks
+ * Leave out the planner block fields that are quick to derive on a 32-bit MCU
+ * with a hardware divide: the acceleration in steps/s² (from mm/s² and steps/mm)
+ * and the S-Curve period inverses. Along with the byte-sized fields sharing words
+ * this takes about 28 bytes off each block, so the look-ahead can be doubled.
+ */
+//#define COMPACT_PLANNER_BLOCKS
+#if ENABLED(COMPACT_PLANNER_BLOCKS)
+  //#define PLANNER_BLOCK_MAX_BYTES 112   // Fail the build if a block grows past this size
+#endif
+
 // The number of linear moves that can be in the planner at once.
 #if ALL(HAS_MEDIA, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif HAS_MEDIA
-  #define BLOCK_BUFFER_SIZE 16
+  #define BLOCK_BUFFER_SIZE TERN(COMPACT_PLANNER_BLOCKS, 32, 16)
 #else
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Incremental Look-ahead
+ * Remember the last junction that the reverse pass left untouched so the forward pass
+ * in Planner::recalculate() starts there instead of walking the whole block buffer.
+ * Helps the planner keep up with dense small-segment G-code (e.g., arcs sliced into short chords).
+ */
+//#define PLANNER_INCREMENTAL_LOOKAHEAD
+
+// Count the blocks visited by each look-ahead pass. Report and reset with M212.
+//#define PLANNER_LOOKAHEAD_STATS
+
+/**
+ * Planner Monitor
+ * Track how close the planner comes to starving the stepper, to help tune
+ * BLOCK_BUFFER_SIZE and slicer resolution. Report with M213, auto-report with M213 S<seconds>.
+ *   - Blocks planned and consumed by the stepper per second
+ *   - Lowest number of blocks buffered when the stepper took a block
+ *   - Stepper underruns during a print job
+ *   - Time spent in Planner::recalculate()
+ */
+//#define PLANNER_MONITOR
+
+/**
+ * Fixed-point Trapezoid
+ * Calculate block trapezoids (and S-Curve timing) with integer math instead of float.
+ * For MCUs without an FPU (e.g., STM32F103) where soft-float limits the block rate.
+ */
+//#define PLANNER_FIXED_POINT_TRAPEZOID
+
+/**
+ * Feedrate Override Re-plan
+ * Apply feedrate percentage changes (M220, LCD, realtime commands) to the moves already
+ * in the planner buffer instead of only to new moves, so the speed responds within a block.
+ * The move in progress keeps its speed and speed-ups are held to the axis max feedrates.
+ */
+//#define FEEDRATE_OVERRIDE_REPLAN
+
+/**
+ * Planner Segment Batch
+ * Buffer the segments of a split move (leveling, kinematics, arcs, Bezier curves) in
+ * batches of up to this many blocks with a single look-ahead pass per batch instead of
+ * one per segment. A batch is planned early whenever the stepper could run short of blocks.
+ */
+//#define PLANNER_SEGMENT_BATCH 4
+
+/**
+ * Stepper ISR Profiler
+ * Measure the time spent in each phase of the Stepper ISR (pulse, block,
+ * input shaping, linear advance, babystepping) and report it with M214.
+ * Uses the DWT cycle counter on STM32, micros() on other platforms.
+ * Adds some overhead to every Stepper ISR, so only enable it for tuning.
+ */
+//#define STEPPER_ISR_PROFILER
+
+/**
+ * Run the Stepper and Temperature ISRs from SRAM (STM32)
+ * Flash wait states and prefetch misses add jitter to the ISRs. This copies their
+ * code to SRAM at startup, costing a few KB of RAM. (CCM RAM can't hold code.)
+ * Compare the timing with STEPPER_ISR_PROFILER and M214.
+ */
+//#define ISR_CODE_IN_RAM
+
+/**
+ * Idle Task Scheduler
+ * Run the low priority work in idle() (UI, media, runout, print timer and
+ * auto-reports) at its own rate, one task per idle() call, so heaters, serial
+ * and planner feeding are never held up by more than one of them. Report the
+ * run time of each task with M223.
+ */
+//#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define IDLE_TASK_UI_MS       10  // (ms) Screen update and input
+  #define IDLE_TASK_RUNOUT_MS   10  // (ms) Filament runout sensors
+  #define IDLE_TASK_MEDIA_MS   100  // (ms) SD card insert / remove
+  #define IDLE_TASK_REPORT_MS  100  // (ms) Print job timer, auto-reports, network check
+#endif
+
+/**
+ * Loop Latency Monitor
+ * Measure the longest gaps between idle() calls and between command queue
+ * advances, blame each gap on the G-code command, settings save / load,
+ * SD card mount or UI update that caused it, and keep a histogram of recent
+ * gaps. Report with M224, reset with M224 R.
+ */
+//#define LOOP_LATENCY_MONITOR
+
+/**
+ * Flight Recorder
+ * Keep the last events in a timestamped ring to look back on after a stutter
+ * or blob: blocks planned and started, command queue depth, SD read times,
+ * settings saves, DGUS handlers, and late Temperature ISRs.
+ * Dump with M230 (serial) or M230 S (FLIGHT.BIN on the media), reset with M230 R.
+ * Decode with buildroot/share/scripts/flightRecorder.py.
+ */
+//#define FLIGHT_RECORDER
+#if ENABLED(FLIGHT_RECORDER)
+  #define FLIGHT_RECORDER_SIZE 256  // (events) 8 bytes each
+#endif
+
+/**
+ * Boot Profiler
+ * Record the time taken by each step of setup() and report it with M225,
+ * to find what delays the first command and the first heater response.
+ */
+//#define BOOT_PROFILER
+#if ENABLED(BOOT_PROFILER)
+  #define BOOT_PROFILER_STEPS 48  // Steps recorded. Later steps are added to the last one.
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+/**
+ * Packed Command Queue
+ * Store the queued commands end-to-end in a shared pool instead of giving each
+ * of the BUFSIZE slots a full MAX_CMD_SIZE buffer. Most G-code lines are short,
+ * so BUFSIZE can be raised 3-4x while using the same SRAM as before.
+ */
+//#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define COMMAND_POOL_SIZE 384     // (bytes) Shared by all queued commands. At least 2 * MAX_CMD_SIZE.
+
+  /**
+   * Buffer Arena
+   * Size the planner and the command pool at boot from a saved setting. 'M227 B'
+   * sets the planner blocks (up to BLOCK_BUFFER_SIZE) and M500 saves it. From the
+   * next boot the RAM of the unused blocks is added to the command pool, to queue
+   * more commands from a host. Raise BUFSIZE so the pool can be filled.
+   */
+  //#define BUFFER_ARENA
+#endif
+
 /**
  * Host Transmit Buffer Size
  *  - Costs 386 bytes of flash and TX_BUFFER_SIZE+3 bytes of SRAM (if not 0).
@@ -2781,6 +3396,15 @@
 //#define REALTIME_REPORTING_COMMANDS
 #if ENABLED(REALTIME_REPORTING_COMMANDS)
   //#define FULL_REPORT_TO_HOST_FEATURE   // Auto-report the machine status like Grbl CNC
+  /**
+   * Grbl single-byte realtime commands, handled as they arrive and kept out of the
+   * command queue. Send them between lines.
+   *  ? : Report State and Position    0x90/0x91/0x92/0x93/0x94 : Feedrate 100% / +10 / -10 / +1 / -1
+   *  ! : Pause / Hold                 0x99/0x9A/0x9B/0x9C/0x9D : Flow 100% / +10 / -10 / +1 / -1
+   *  ~ : Resume
+   * Overrides apply to moves planned after the change.
+   */
+  //#define REALTIME_OVERRIDE_COMMANDS
 #endif
 
 /**
@@ -2794,6 +3418,49 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+// Let a host ask with 'M219 S1' for one "ok N<line> P<planner> B<buffer> C<count>" to acknowledge several
+// numbered lines at once. M115 reports the number of lines the host may send ahead as Cap:OK_WINDOW.
+//#define OK_COALESCE
+#if ENABLED(OK_COALESCE)
+  #define OK_COALESCE_LINES 4   // Most lines acknowledged by one "ok"
+  #define OK_COALESCE_MS   20   // (ms) Longest delay of an "ok"
+#endif
+
+/**
+ * Check the line number and checksum of each numbered line as its characters arrive,
+ * instead of scanning the whole line again once it's complete.
+ */
+//#define SERIAL_LINE_CHECK
+#if ENABLED(SERIAL_LINE_CHECK)
+  // Also accept a line ending in '^' and the CRC16 (CCITT, decimal) of everything before it,
+  // for hosts that check M115 for Cap:CRC16_CHECKSUM. Stronger than the XOR '*' checksum.
+  //#define SERIAL_CRC16_CHECKSUM
+#endif
+
+/**
+ * Selective Resend
+ * After a bad or missing numbered line keep the good lines that follow it and only ask
+ * for the missing line, instead of clearing the receive buffer and rejecting everything
+ * after it. Lines a host resends again are ignored. Uses SERIAL_RESEND_WINDOW * (MAX_CMD_SIZE + 4)
+ * bytes of RAM per serial port.
+ */
+//#define SERIAL_SELECTIVE_RESEND
+#if ENABLED(SERIAL_SELECTIVE_RESEND)
+  #define SERIAL_RESEND_WINDOW 4  // Lines held after a missing one (1-8)
+#endif
+
+/**
+ * Serial Port Fairness
+ * With more than one host connected (SERIAL_PORT_2) take the serial ports in turn and keep a
+ * monitoring host from slowing the print. The port sending numbered lines (the printing host)
+ * may fill the whole command queue while each other port gets a small quota.
+ */
+//#define SERIAL_PORT_FAIRNESS
+#if ENABLED(SERIAL_PORT_FAIRNESS)
+  #define SERIAL_PORT_QUEUE_QUOTA   1   // Commands other hosts may have in the queue at a time
+  #define SERIAL_PRIORITY_TIMEOUT 5000  // (ms) Quiet time before another host can take priority
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -2801,6 +3468,17 @@
 // For serial echo, the number of digits after the decimal point
 //#define SERIAL_FLOAT_PRECISION 4
 
+/**
+ * Serial Line Buffer
+ * Assemble each line of output (e.g., M105, M114, auto-reports) and write it to
+ * the port(s) in a single call instead of passing every byte through the serial chain.
+ * Partial lines are sent when the buffer fills up and from the idle loop.
+ */
+//#define SERIAL_LINE_BUFFER
+#if ENABLED(SERIAL_LINE_BUFFER)
+  #define SERIAL_LINE_BUFFER_SIZE 96  // (bytes) Longer lines are sent in pieces
+#endif
+
 /**
  * This feature is EXPERIMENTAL so use with caution and test thoroughly.
  * Enable this option to receive data on the serial ports via the onboard DMA
@@ -2810,6 +3488,23 @@
  */
 //#define SERIAL_DMA
 
+#if ENABLED(SERIAL_DMA)
+  // Also send by DMA on these serial ports, e.g., SERIAL_PORT and LCD_SERIAL_PORT (STM32F1 USART1-3).
+  // USART1-3 use DMA1 channels 4, 7 and 2, which SPI DMA must not share.
+  // A larger TX_BUFFER_SIZE lets long reports go out in one transfer.
+  //#define SERIAL_DMA_TX_PORTS { 1, 3 }
+#endif
+
+/**
+ * Read the native USB serial port (HAL/STM32) a whole packet at a time into a larger ring,
+ * so the USB endpoint is rearmed as soon as possible. When the ring is full the core's queue
+ * fills and the endpoint NAKs, holding the host back without losing any bytes.
+ */
+//#define USB_CDC_BULK_RX
+#if ENABLED(USB_CDC_BULK_RX)
+  #define USB_CDC_RX_BUFFER_SIZE 1024 // (bytes) A power of 2, at least 128
+#endif
+
 /**
  * Set the number of proportional font spaces required to fill up a typical character space.
  * This can help to better align the output of commands like 'G29 O' Mesh Output.
@@ -2861,6 +3556,11 @@
   #define RETRACT_RECOVER_LENGTH_SWAP   0   // (mm) Default additional swap recover length (added to retract length on recover from toolchange)
   #define RETRACT_RECOVER_FEEDRATE      8   // (mm/s) Default feedrate for recovering from retraction
   #define RETRACT_RECOVER_FEEDRATE_SWAP 8   // (mm/s) Default feedrate for recovering from swap retraction
+  //#define FWRETRACT_BLEND                 // Retract (and hop) along the start of the next travel, and recover with the Z drop
+  #if ENABLED(FWRETRACT_BLEND)
+    //#define FWRETRACT_WIPE                // Retract while wiping back along the last extruded move
+    #define FWRETRACT_WIPE_LENGTH       2   // (mm) Longest wipe, if the move was as long
+  #endif
   #if ENABLED(MIXING_EXTRUDER)
     //#define RETRACT_SYNC_MIXING           // Retract and restore all mixing steppers simultaneously
   #endif
@@ -2881,6 +3581,19 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  /**
+   * Plan the tool-change moves without waiting for each one to finish, so the
+   * raise, park and return blend into each other. Cartesian machines with a
+   * plain multi-extruder or multi-hotend setup only.
+   */
+  //#define TOOLCHANGE_PLANNED_MOVES
+
+  /**
+   * Look this many commands ahead for a tool-change and heat the new tool back to
+   * the temperature it had when it was put away. Requires more than one hotend.
+   */
+  //#define TOOLCHANGE_PREHEAT_LINES 8
+
   /**
    * Extra G-code to run while executing tool-change commands. Can be used to use an additional
    * stepper motor (e.g., I axis in Configuration.h) to drive the tool-changer.
@@ -3023,6 +3736,7 @@
                                                   //   Filament can be extruded repeatedly from the Filament Change menu
                                                   //   until extrusion is consistent, and to purge old filament.
   #define ADVANCED_PAUSE_RESUME_PRIME          0  // (mm) Extra distance to prime nozzle after returning from park.
+  //#define ADVANCED_PAUSE_HEAT_DURING_RETURN     // Reach the resume temperature (M600 R) while moving back from park, before the unretract.
   #define ADVANCED_PAUSE_FANS_PAUSE             // Turn off print-cooling fans while the machine is paused.
 
                                                   // Filament Unload does a Retract, Delay, and Purge first:
@@ -3037,6 +3751,13 @@
   //#define FILAMENT_CHANGE_RESUME_ON_INSERT      // Automatically continue / load filament when runout sensor is triggered again.
   //#define PAUSE_REHEAT_FAST_RESUME              // Reduce number of waits by not prompting again post-timeout before continuing.
 
+  /**
+   * Wait for the user from the main loop instead of inside M600 / M125, so host commands (M105, M104, M108, M876...)
+   * keep running while the nozzle is parked. Moves and other pause commands are held in the queue until the print resumes.
+   * Parking, loading and purging still run to completion. Not for multiple extruders.
+   */
+  //#define ADVANCED_PAUSE_NONBLOCKING
+
   #define PARK_HEAD_ON_PAUSE                    // Park the nozzle during pause and filament change.
   //#define HOME_BEFORE_FILAMENT_CHANGE           // If needed, home before parking for filament change
 
@@ -3470,6 +4191,19 @@
     #define CURRENT_STEP_DOWN     50  // [mA]
     #define REPORT_CURRENT_CHANGE
     #define STOP_ON_ERROR
+    //#define MONITOR_DRIVER_STATUS_SPREAD  // Poll one axis per loop so the driver reads don't stall the loop all at once
+  #endif
+
+  /**
+   * Lower the X and Y run current while a move cruises at constant speed, and raise it
+   * again TMC_CRUISE_MARGIN_MS before the move decelerates or the next one accelerates.
+   * The current is set from the main loop, so the margin must be longer than the slowest
+   * loop iteration (see M224) and the cruise current must hold the axes at full speed.
+   */
+  //#define TMC_CRUISE_CURRENT
+  #if ENABLED(TMC_CRUISE_CURRENT)
+    #define TMC_CRUISE_CURRENT_PERCENT  70  // (%) Run current while cruising
+    #define TMC_CRUISE_MARGIN_MS        25  // (ms) Cruise time left to restore the full current
   #endif
 
   // @section tmc/hybrid
@@ -3506,6 +4240,16 @@
   #define E6_HYBRID_THRESHOLD     30
   #define E7_HYBRID_THRESHOLD     30
 
+  /**
+   * Switch X, Y and Z to spreadCycle ahead of the queued moves that go over their
+   * HYBRID_THRESHOLD, instead of waiting for the driver to see the speed. Switch back
+   * to stealthChop once all queued moves are under the threshold less the hysteresis.
+   */
+  //#define HYBRID_THRESHOLD_LOOKAHEAD
+  #if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+    #define HYBRID_LOOKAHEAD_HYSTERESIS 20  // (%) Speed under the threshold to go back to stealthChop
+  #endif
+
   /**
    * Use StallGuard to home / probe X, Y, Z.
    *
@@ -3555,6 +4299,21 @@
     //#define SENSORLESS_STALLGUARD_DELAY   0 // (ms) Delay to allow drivers to settle
   #endif
 
+  /**
+   * Watch the X and Y StallGuard load (SG_RESULT) while printing to catch skipped steps.
+   * SG_RESULT drops as the load rises. STALL_DETECT_SAMPLES readings in a row under the
+   * axis minimum log the axis, the planner block and the position, then run the script.
+   * SG_RESULT is only valid in stealthChop above TCOOLTHRS, so tune the minimums with
+   * M122 S1 on a known good print.   *** TMC2209 Only ***
+   */
+  //#define TMC_STALL_DETECT
+  #if ENABLED(TMC_STALL_DETECT)
+    #define STALL_DETECT_SG_MIN        { 40, 40 } // X, Y SG_RESULT counted as a stall
+    #define STALL_DETECT_SAMPLES        3         // Readings in a row under the minimum
+    #define STALL_DETECT_INTERVAL_MS   50         // Reading interval, alternating X and Y
+    //#define STALL_DETECT_SCRIPT "M25\nG28XY"    // Pause the print and rehome X and Y
+  #endif
+
   // @section tmc/config
 
   /**
@@ -3831,6 +4590,9 @@
      * - Due to the limited power resolution this is only approximate.
      */
     //#define LASER_POWER_TRAP
+    #if ENABLED(LASER_POWER_TRAP)
+      //#define LASER_POWER_TRAP_RATE   // Set the power from the step rate, following the speed curve exactly
+    #endif
 
     //
     // Laser I2C Ammeter (High precision INA226 low/high side module)
@@ -3945,6 +4707,22 @@
   #define POWER_MONITOR_VOLTAGE_OFFSET  0         // Offset (in volts) applied to the calculated voltage
 #endif
 
+/**
+ * Power Budget
+ * Use the power monitor readings to hold back the bed, then the hotends,
+ * when the supply draw is over budget or the supply voltage sags. While
+ * the voltage is low new moves also get less acceleration.
+ * Heaters held back for a long time can trip thermal protection, so set
+ * the budget above the steady draw of a print.
+ */
+//#define POWER_BUDGET
+#if ENABLED(POWER_BUDGET)
+  #define POWER_BUDGET_WATTS       300  // (W) Highest supply draw. Requires POWER_MONITOR_CURRENT.
+  //#define POWER_BUDGET_MIN_VOLTS  22.8  // (V) Lowest supply voltage. Requires POWER_MONITOR_VOLTAGE.
+  #define POWER_BUDGET_SAG_ACCEL    50  // (%) Acceleration of new moves while the voltage is low
+  #define POWER_BUDGET_MIN_HOTEND   50  // (%) Hotends are never held below this share of their duty
+#endif
+
 // @section cnc
 
 /**
@@ -4036,6 +4814,17 @@
   //#define AUTO_REPORT_REAL_POSITION // Auto-report the real position
 #endif
 
+/**
+ * Binary telemetry frames with M156 S<rate>, sent up to 20 times per second
+ * A compact status frame (temperatures, heater power, position, feedrate, queue
+ * depth, SD position) for hosts to parse instead of M105 / M114 text.
+ * See src/feature/telemetry.h for the frame layout.
+ */
+//#define BINARY_TELEMETRY
+#if ENABLED(BINARY_TELEMETRY)
+  #define BINARY_TELEMETRY_MAX_RATE 20  // (Hz) Highest rate allowed by M156
+#endif
+
 /**
  * M115 - Report capabilities. Disable to save ~1150 bytes of flash.
  *        Some hosts (and serial TFT displays) rely on this feature.
@@ -4059,6 +4848,20 @@
   #define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
 #endif
 
+/**
+ * Parse plain decimal parameters (e.g., "X-12.345") with integer math instead
+ * of strtof, which is slow and large on newlib. Values with more than 9 digits
+ * or 5 decimal places still go to strtof.
+ */
+//#define FAST_FLOAT_PARSER
+
+/**
+ * Take plain G0/G1 lines (only axis and F parameters with numeric values) through a
+ * short parsing loop. Other lines, and moves with anything unusual, use the full parser.
+ * Requires FASTER_GCODE_PARSER. Compare the timings with M222 (MARLIN_TEST_BUILD).
+ */
+//#define FAST_MOVE_PARSER
+
 /**
  * Variables
  *
@@ -4074,6 +4877,14 @@
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Binary Move Commands
+ * Accept G0/G1 moves in a compact binary frame with fixed-point X Y Z E F
+ * values. These are queued without the G-code parser. Hosts can check for
+ * the BINARY_MOVES capability in M115. See feature/binary_moves.h for the format.
+ */
+//#define BINARY_MOVE_COMMANDS
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4267,6 +5078,9 @@
  * Implement M486 to allow Marlin to skip objects
  */
 #define CANCEL_OBJECTS
+#if ENABLED(CANCEL_OBJECTS)
+  //#define CANCEL_OBJECTS_SD_SKIP  // Drop the moves of canceled objects as they're read from media instead of running them
+#endif
 
 /**
  * I2C position encoders for closed loop control.
@@ -4463,6 +5277,14 @@
  */
 #if HAS_ETHERNET
   #define MAC_ADDRESS { 0xDE, 0xAD, 0xBE, 0xEF, 0xF0, 0x0D }  // A MAC address unique to your network
+
+  // A TCP port taking G-code straight into the command queue, with no line numbers or "ok" per line,
+  // and "@UPLOAD <bytes> <file>" to write a file straight to the media. See feature/ethernet.cpp.
+  //#define ETHERNET_STREAM
+  #if ENABLED(ETHERNET_STREAM)
+    #define ETHERNET_STREAM_PORT      8000
+    #define ETHERNET_STREAM_ACK_LINES   32  // Lines queued between "ok <lines>" replies
+  #endif
 #endif
 
 /**
@@ -4711,6 +5533,14 @@
   //#define SERVICE_INTERVAL_2  200 // print hours
   //#define SERVICE_NAME_3      "Service 3"
   //#define SERVICE_INTERVAL_3    1 // print hours
+
+  /**
+   * Keep statistics for the current job in RAM: filament used, layers and
+   * layer times, and average filament rate. M78 reports them. The totals are
+   * only written at the end of the job (set PRINTCOUNTER_SAVE_INTERVAL 0), and
+   * power-loss recovery keeps the job's filament and layers until then.
+   */
+  //#define PRINTCOUNTER_JOB_STATS
 #endif
 
 // @section develop
@@ -4720,6 +5550,12 @@
 //
 //#define M100_FREE_MEMORY_WATCHER
 
+//
+// M101 Memory Monitor. Paint free RAM at boot and report the stack high-water
+// mark, free RAM and the size of the main buffers. (Cortex-M only)
+//
+//#define MEMORY_MONITOR
+
 //
 // M42 - Set pin states
 //
@@ -4730,7 +5566,7 @@
 //
 //#define PINS_DEBUGGING
 
-// Enable Tests that will run at startup and produce a report
+// Enable Tests that will run at startup and produce a report, and M222 to benchmark core kernels
 //#define MARLIN_TEST_BUILD
 
 // Enable Marlin dev mode which adds some special commands
@@ -4762,3 +5598,8 @@
 
 // Shrink the build for smaller boards by sacrificing some serial feedback
 //#define MARLIN_SMALL_BUILD
+
+// Shrink the build by compressing the serial messages (SERIAL_ECHOPGM, SERIAL_ECHO_MSG, etc.) at compile time
+// with a shared dictionary. They're expanded as they're sent. Make a new dictionary for your messages with
+// buildroot/share/scripts/createStringDictionary.py
+//#define COMPRESSED_STRINGS
@@ -53,6 +53,10 @@
 // ------------------------
 
 portMUX_TYPE MarlinHAL::spinlock = portMUX_INITIALIZER_UNLOCKED;
+#if ENABLED(DUAL_CORE_MOTION)
+  volatile int8_t MarlinHAL::isr_core = -1;
+  uint8_t MarlinHAL::isr_depth; // = 0
+#endif
 
 // ------------------------
 // Local defines
@@ -63,6 +63,10 @@
 #define CRITICAL_SECTION_START() portENTER_CRITICAL(&hal.spinlock)
 #define CRITICAL_SECTION_END()   portEXIT_CRITICAL(&hal.spinlock)
 
+#if ENABLED(DUAL_CORE_MOTION)
+  #define MOTION_CORE (1 - (CONFIG_ARDUINO_RUNNING_CORE)) // Core for the Stepper and Temperature ISRs
+#endif
+
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
 #define PWM_FREQUENCY  1000u   // Default PWM frequency when set_pwm_duty() is called without set_pwm_frequency()
 #define PWM_RESOLUTION   10u   // Default PWM bit resolution
@@ -188,9 +192,18 @@ public:
 
   // Interrupts
   static portMUX_TYPE spinlock;
-  static bool isr_state() { return spinlock.owner == portMUX_FREE_VAL; }
-  static void isr_on()  { if (spinlock.owner != portMUX_FREE_VAL) portEXIT_CRITICAL(&spinlock); }
-  static void isr_off() { portENTER_CRITICAL(&spinlock); }
+  #if ENABLED(DUAL_CORE_MOTION)
+    // The motion ISRs run on the other core, so track which core holds the lock
+    static volatile int8_t isr_core;
+    static uint8_t isr_depth;
+    static bool isr_state() { return isr_core != xPortGetCoreID(); }
+    static void isr_on()  { if (isr_core == xPortGetCoreID()) { if (!--isr_depth) isr_core = -1; portEXIT_CRITICAL(&spinlock); } }
+    static void isr_off() { portENTER_CRITICAL(&spinlock); isr_core = xPortGetCoreID(); ++isr_depth; }
+  #else
+    static bool isr_state() { return spinlock.owner == portMUX_FREE_VAL; }
+    static void isr_on()  { if (spinlock.owner != portMUX_FREE_VAL) portEXIT_CRITICAL(&spinlock); }
+    static void isr_off() { portENTER_CRITICAL(&spinlock); }
+  #endif
 
   static void delay_ms(const int ms) { delay(ms); }
 
@@ -156,6 +156,8 @@ void stepperTask(void *parameter) {
 
     while (dma.rw_pos < DMA_SAMPLE_COUNT) {
 
+      TERN_(DUAL_CORE_MOTION, hal.isr_off()); // Hold off critical sections on the other core
+
       #if ENABLED(FT_MOTION)
 
         if (using_ftMotion) {
@@ -189,6 +191,8 @@ void stepperTask(void *parameter) {
             nextAdvanceISR--;
         #endif
       }
+
+      TERN_(DUAL_CORE_MOTION, hal.isr_on());
     }
   }
 }
@@ -335,7 +339,8 @@ int i2s_init() {
   esp_intr_enable(i2s_isr_handle);
 
   // Create the task that will feed the buffer
-  xTaskCreatePinnedToCore(stepperTask, "StepperTask", 10000, nullptr, 1, nullptr, CONFIG_ARDUINO_RUNNING_CORE); // run I2S stepper task on same core as rest of Marlin
+  // Run the I2S stepper task on the same core as the rest of Marlin, or on the other core with DUAL_CORE_MOTION
+  xTaskCreatePinnedToCore(stepperTask, "StepperTask", 10000, nullptr, 1, nullptr, TERN(DUAL_CORE_MOTION, MOTION_CORE, CONFIG_ARDUINO_RUNNING_CORE));
 
   // Route the i2s pins to the appropriate GPIO
   // If a pin is not defined, no need to configure
@@ -29,6 +29,10 @@
 
 #include "../../inc/MarlinConfig.h"
 
+#if ENABLED(DUAL_CORE_MOTION)
+  #include <esp_ipc.h>
+#endif
+
 // ------------------------
 // Local defines
 // ------------------------
@@ -69,13 +73,29 @@ void IRAM_ATTR timer_isr(void *para) {
     }
   }
 
-  timer.fn();
+  #if ENABLED(DUAL_CORE_MOTION)
+    // Hold off critical sections on the other core for the whole ISR
+    const bool motion = (int)para == MF_TIMER_STEP || (int)para == MF_TIMER_TEMP;
+    if (motion) hal.isr_off();
+    timer.fn();
+    if (motion) hal.isr_on();
+  #else
+    timer.fn();
+  #endif
 
   // After the alarm has been triggered
   // Enable it again so it gets triggered the next time
   TG[timer.group]->hw_timer[timer.idx].config.alarm_en = TIMER_ALARM_EN;
 }
 
+#if ENABLED(DUAL_CORE_MOTION)
+  // An interrupt is allocated on the core that registers it
+  static void timer_isr_register_ipc(void *para) {
+    const tTimerConfig &timer = timer_config[(int)para];
+    timer_isr_register(timer.group, timer.idx, timer_isr, para, 0, nullptr);
+  }
+#endif
+
 /**
  * Enable and initialize the timer
  * @param timer_num timer number to initialize
@@ -103,7 +123,12 @@ void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
 
   timer_enable_intr(timer.group, timer.idx);
 
-  timer_isr_register(timer.group, timer.idx, timer_isr, (void*)(uint32_t)timer_num, 0, nullptr);
+  #if ENABLED(DUAL_CORE_MOTION)
+    if (timer_num == MF_TIMER_STEP || timer_num == MF_TIMER_TEMP)
+      esp_ipc_call_blocking(MOTION_CORE, timer_isr_register_ipc, (void*)(uint32_t)timer_num);
+    else
+  #endif
+      timer_isr_register(timer.group, timer.idx, timer_isr, (void*)(uint32_t)timer_num, 0, nullptr);
 
   timer_start(timer.group, timer.idx);
 }
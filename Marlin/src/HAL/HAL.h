@@ -32,6 +32,11 @@ extern MarlinHAL hal;
 
 #define HAL_ADC_RANGE _BV(HAL_ADC_RESOLUTION)
 
+// Place hot ISR code in RAM where the HAL supports it
+#ifndef HAL_RAMFUNC
+  #define HAL_RAMFUNC
+#endif
+
 #ifndef I2C_ADDRESS
   #define I2C_ADDRESS(A) uint8_t(A)
 #endif
@@ -35,6 +35,10 @@ unsigned long millis() {
   return (unsigned long)Clock::millis();
 }
 
+unsigned long micros() {
+  return (unsigned long)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
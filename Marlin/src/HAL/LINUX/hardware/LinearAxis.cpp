@@ -26,7 +26,14 @@
 #include "Clock.h"
 #include "LinearAxis.h"
 
-LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max) {
+#ifdef MOTION_TRACE
+  #include "Timer.h"
+  #include "MotionTrace.h"
+  extern Timer timers[2];
+#endif
+
+LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max, char axis_name) {
+  name = axis_name;
   enable_pin = enable;
   dir_pin = dir;
   step_pin = step;
@@ -54,7 +61,11 @@ void LinearAxis::interrupt(GpioEvent ev) {
   if (ev.pin_id == step_pin && !Gpio::pin_map[enable_pin].value) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
-      position += -1 + 2 * Gpio::pin_map[dir_pin].value;
+      const int8_t dir = -1 + 2 * Gpio::pin_map[dir_pin].value;
+      position += dir;
+      #ifdef MOTION_TRACE
+        if (motion_trace) motion_trace->add(timers[0].getElapsed(), name, dir);
+      #endif
       Gpio::pin_map[min_pin].value = (position < min_position);
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
@@ -26,7 +26,7 @@
 
 class LinearAxis: public Peripheral {
 public:
-  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max);
+  LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max, char axis_name='?');
   virtual ~LinearAxis();
   void update();
   void interrupt(GpioEvent ev);
@@ -36,6 +36,7 @@ public:
   pin_type step_pin;
   pin_type min_pin;
   pin_type max_pin;
+  char name;
 
   int32_t position;
   int32_t min_position;
@@ -0,0 +1,138 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * MotionTrace - Step traces for motion regression tests
+ *
+ * With MOTION_TRACE each simulated LinearAxis adds its steps to the trace,
+ * stamped with the ideal stepper timer time (the sum of the programmed
+ * compare intervals) so the trace doesn't depend on host scheduling.
+ *
+ * A trace is saved as CSV lines of "ticks,axis,dir" and compared against a
+ * golden trace axis by axis: the same steps in the same directions, with each
+ * step within a tolerance in timer ticks of the golden one. The times of both
+ * traces are taken from their first step. A tolerance of 0 is bit-for-bit.
+ *
+ * Only standard C++ is used so the comparison is also covered by a native test.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <string>
+#include <vector>
+
+class MotionTrace {
+public:
+  typedef struct { uint64_t ticks; char axis; int8_t dir; } step_t;
+
+  typedef struct {
+    bool ok;
+    uint64_t max_dt;      // Largest time difference of a matching step
+    std::string message;  // Description of the first difference
+  } result_t;
+
+  std::vector<step_t> steps;
+
+  void add(const uint64_t ticks, const char axis, const int8_t dir) { steps.push_back({ ticks, axis, dir }); }
+  void clear() { steps.clear(); }
+
+  bool save(const char * const path) const {
+    FILE * const f = fopen(path, "w");
+    if (!f) return false;
+    for (const step_t &s : steps) fprintf(f, "%" PRIu64 ",%c,%d\n", s.ticks, s.axis, s.dir);
+    fclose(f);
+    return true;
+  }
+
+  bool load(const char * const path) {
+    FILE * const f = fopen(path, "r");
+    if (!f) return false;
+    clear();
+    uint64_t ticks; char axis; int dir;
+    while (fscanf(f, "%" SCNu64 ",%c,%d\n", &ticks, &axis, &dir) == 3) add(ticks, axis, int8_t(dir));
+    fclose(f);
+    return true;
+  }
+
+  // Net steps of one axis over the whole trace
+  int32_t position(const char axis) const {
+    int32_t pos = 0;
+    for (const step_t &s : steps) if (s.axis == axis) pos += s.dir;
+    return pos;
+  }
+
+  static result_t compare(const MotionTrace &golden, const MotionTrace &trace, const uint64_t tolerance) {
+    result_t res = { true, 0, "" };
+    const uint64_t g0 = golden.steps.empty() ? 0 : golden.steps.front().ticks,
+                   t0 = trace.steps.empty() ? 0 : trace.steps.front().ticks;
+
+    for (const char axis : axes(golden, trace)) {
+      const std::vector<step_t> g = golden.of_axis(axis), t = trace.of_axis(axis);
+      char msg[96];
+      for (size_t i = 0; i < g.size() && i < t.size(); ++i) {
+        if (g[i].dir != t[i].dir) {
+          snprintf(msg, sizeof(msg), "%c step %zu: direction %d, expected %d", axis, i, t[i].dir, g[i].dir);
+          return fail(res, msg);
+        }
+        const uint64_t gt = g[i].ticks - g0, tt = t[i].ticks - t0,
+                       dt = gt > tt ? gt - tt : tt - gt;
+        if (dt > res.max_dt) res.max_dt = dt;
+        if (dt > tolerance) {
+          snprintf(msg, sizeof(msg), "%c step %zu: at %" PRIu64 ", expected %" PRIu64, axis, i, tt, gt);
+          return fail(res, msg);
+        }
+      }
+      if (g.size() != t.size()) {
+        snprintf(msg, sizeof(msg), "%c: %zu steps, expected %zu", axis, t.size(), g.size());
+        return fail(res, msg);
+      }
+    }
+    return res;
+  }
+
+private:
+  std::vector<step_t> of_axis(const char axis) const {
+    std::vector<step_t> out;
+    for (const step_t &s : steps) if (s.axis == axis) out.push_back(s);
+    return out;
+  }
+
+  // The axes seen in either trace
+  static std::string axes(const MotionTrace &a, const MotionTrace &b) {
+    std::string out;
+    for (const MotionTrace * const m : { &a, &b })
+      for (const step_t &s : m->steps)
+        if (out.find(s.axis) == std::string::npos) out += s.axis;
+    return out;
+  }
+
+  static result_t fail(result_t &res, const char * const msg) {
+    res.ok = false;
+    res.message = msg;
+    return res;
+  }
+};
+
+// The trace being recorded, if any
+extern MotionTrace *motion_trace;
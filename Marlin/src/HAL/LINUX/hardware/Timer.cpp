@@ -34,6 +34,7 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  elapsed = 0;
 }
 
 Timer::~Timer() {
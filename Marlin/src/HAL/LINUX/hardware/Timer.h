@@ -47,6 +47,7 @@ public:
   uint32_t getCompare() {return compare;}
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
+  uint64_t getElapsed() {return elapsed;} // Sum of the compare intervals that have run out, in timer ticks
 
   intptr_t getID() {
     return (*(intptr_t*)timerid);
@@ -57,6 +58,7 @@ public:
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
     _this->avg_error /= 2; //very crude precision analysis (actually within +-500ns usually)
     _this->start_time = Clock::nanos(); // wrap
+    _this->elapsed += _this->compare;
     _this->cbfn();
     _this->overruns += timer_getoverrun(_this->timerid); // even at 50Khz this doesn't stay zero, again demonstrating the limitations
                                                          // using a realtime linux kernel would help somewhat
@@ -73,4 +75,5 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t elapsed;
 };
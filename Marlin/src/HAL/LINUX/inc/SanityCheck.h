@@ -45,3 +45,9 @@
 #if ENABLED(POSTMORTEM_DEBUGGING)
   #error "POSTMORTEM_DEBUGGING is not yet supported for HAL/LINUX."
 #endif
+
+#if ENABLED(MOTION_BENCHMARK) && DISABLED(PLANNER_MONITOR)
+  #error "MOTION_BENCHMARK requires PLANNER_MONITOR."
+#elif ENABLED(MOTION_TRACE) && DISABLED(MOTION_BENCHMARK)
+  #error "MOTION_TRACE requires MOTION_BENCHMARK."
+#endif
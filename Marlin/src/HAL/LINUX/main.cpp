@@ -31,6 +31,20 @@
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
+#if ENABLED(MOTION_BENCHMARK)
+  #include "../../gcode/queue.h"
+  #include "../../module/planner.h"
+  #include "../../feature/planner_monitor.h"
+  #include <chrono>
+#endif
+
+#if ENABLED(MOTION_TRACE)
+  #include "hardware/MotionTrace.h"
+  MotionTrace *motion_trace = nullptr;
+  static const char *trace_file = nullptr, *golden_file = nullptr;
+  static uint64_t trace_tolerance = 0;
+#endif
+
 #include <stdio.h>
 #include <stdarg.h>
 #include <thread>
@@ -61,13 +75,90 @@ void read_serial_thread() {
   }
 }
 
+#if ENABLED(MOTION_BENCHMARK)
+
+  /**
+   * Motion benchmark
+   *
+   * Feed a G-code file through the serial port, so it goes through GCodeQueue,
+   * GCodeParser, the Planner and the simulated stepper timer as it would on a
+   * board. When the file is done and all moves are finished report the lines
+   * and blocks per second, with the Planner Monitor's underruns and peaks.
+   *
+   * With MOTION_TRACE the steps are recorded to a trace file and, if given,
+   * compared against a golden trace. The exit code is 1 if they differ.
+   */
+  void benchmark_serial_thread(const char * const filename) {
+    std::ifstream file(filename);
+    if (!file) { fprintf(stderr, "Can't open %s\n", filename); exit(1); }
+
+    // Wait for setup() to finish
+    while (marlin_state != MarlinState::MF_RUNNING) std::this_thread::yield();
+
+    planner_monitor.reset();
+
+    #if ENABLED(MOTION_TRACE)
+      static MotionTrace trace;
+      trace.steps.reserve(1UL << 20);
+      motion_trace = &trace;
+    #endif
+
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t lines = 0;
+    std::string line;
+
+    auto send = [](const std::string &s) {
+      for (const char c : s + '\n') {
+        while (!usb_serial.receive_buffer.free()) std::this_thread::yield();
+        usb_serial.receive_buffer.write(c);
+      }
+    };
+
+    while (std::getline(file, line)) { send(line); lines++; }
+
+    // Wait for the queue to empty and all moves to finish
+    send("M400");
+    do { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    while (usb_serial.receive_buffer.available() || queue.has_commands_queued() || planner.busy());
+
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    TERN_(MOTION_TRACE, motion_trace = nullptr);
+
+    // Let the Planner Monitor add the last second to its totals
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    printf("\nBenchmark: %s\n", filename);
+    printf("  %u lines, %u blocks in %.3f s\n", lines, planner_monitor.total_planned, secs);
+    printf("  %.1f lines/s, %.1f blocks/s\n", lines / secs, planner_monitor.total_planned / secs);
+    printf("  Underruns: %u, fewest blocks buffered: %u\n", planner_monitor.underruns, planner_monitor.min_buffered);
+    printf("  Peak planner time: %u us/s, total %u us\n", planner_monitor.peak.recalc_us, planner_monitor.total_recalc_us);
+
+    #if ENABLED(MOTION_TRACE)
+      printf("  %zu steps traced (X%d Y%d Z%d E%d)\n", trace.steps.size(), trace.position('X'), trace.position('Y'), trace.position('Z'), trace.position('E'));
+      if (!trace.save(trace_file)) { fprintf(stderr, "Can't write %s\n", trace_file); exit(1); }
+      if (golden_file) {
+        MotionTrace golden;
+        if (!golden.load(golden_file)) { fprintf(stderr, "Can't open %s\n", golden_file); exit(1); }
+        const MotionTrace::result_t res = MotionTrace::compare(golden, trace, trace_tolerance);
+        printf("  Golden trace %s: %s (max difference %" PRIu64 " ticks)\n", golden_file, res.ok ? "match" : res.message.c_str(), res.max_dt);
+        fflush(stdout);
+        exit(res.ok ? 0 : 1);
+      }
+    #endif
+
+    fflush(stdout);
+    exit(0);
+  }
+
+#endif
+
 void simulation_loop() {
   Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
   Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN, 'X');
+  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN, 'Y');
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN, 'Z');
+  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC, 'E');
 
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
@@ -106,9 +197,22 @@ void simulation_loop() {
   }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
   std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+
+  #if ENABLED(MOTION_TRACE)
+    if (argc < 3) { fprintf(stderr, "Usage: %s file.gcode trace.csv [golden.csv [tolerance ticks]]\n", argv[0]); return 1; }
+    trace_file = argv[2];
+    if (argc > 3) golden_file = argv[3];
+    if (argc > 4) trace_tolerance = strtoull(argv[4], nullptr, 10);
+    std::thread read_serial (benchmark_serial_thread, argv[1]);
+  #elif ENABLED(MOTION_BENCHMARK)
+    if (argc < 2) { fprintf(stderr, "Usage: %s file.gcode [time multiplier]\n", argv[0]); return 1; }
+    std::thread read_serial (benchmark_serial_thread, argv[1]);
+  #else
+    UNUSED(argc); UNUSED(argv);
+    std::thread read_serial (read_serial_thread);
+  #endif
 
   #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
@@ -117,7 +221,7 @@ int main() {
   #endif
 
   Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
+  Clock::setTimeMultiplier(ENABLED(MOTION_BENCHMARK) && DISABLED(MOTION_TRACE) && argc > 2 ? atof(argv[2]) : 1.0); // some testing at 10x
 
   HAL_timer_init();
 
@@ -116,6 +116,13 @@ extern volatile uint32_t systick_uptime_millis;
 
 int freeMemory();
 
+#if ENABLED(DUAL_CORE_MOTION)
+  // Lock shared by critical sections and the ISRs serviced by core 1
+  void HAL_motion_lock();
+  void HAL_motion_unlock();
+  void HAL_motion_wait();
+#endif
+
 // ------------------------
 // MarlinHAL Class
 // ------------------------
@@ -136,8 +143,13 @@ public:
 
   // Interrupts
   static bool isr_state() { return !__get_PRIMASK(); }
-  static void isr_on()  { __enable_irq(); }
-  static void isr_off() { __disable_irq(); }
+  #if ENABLED(DUAL_CORE_MOTION)
+    static void isr_on()  { HAL_motion_unlock(); __enable_irq(); }
+    static void isr_off() { __disable_irq(); HAL_motion_lock(); }
+  #else
+    static void isr_on()  { __enable_irq(); }
+    static void isr_off() { __disable_irq(); }
+  #endif
 
   static void delay_ms(const int ms) { delay(ms); }
 
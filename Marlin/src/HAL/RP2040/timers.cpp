@@ -37,17 +37,77 @@ struct repeating_timer HAL_timer_3;
 
 volatile bool HAL_timer_irq_en[4] = { false, false, false, false };
 
+#if ENABLED(DUAL_CORE_MOTION)
+
+  #include <hardware/sync.h>
+
+  /**
+   * Core 1 creates the Stepper / Temperature alarm pool, so those callbacks are
+   * serviced by core 1 while core 0 does everything else. A hardware spin lock
+   * taken by hal.isr_off() on either core and held by core 1 over each callback
+   * keeps critical sections exclusive of the ISRs, as on a single core.
+   */
+  static spin_lock_t * const motion_spin = spin_lock_init(spin_lock_claim_unused(true));
+  static volatile int8_t motion_owner = -1; // Core holding the lock
+  static uint8_t motion_depth;              // Nesting on the owning core
+  static volatile bool motion_core_ready;
+
+  // Always called with the local interrupts off or from the alarm callback
+  void HAL_motion_lock() {
+    const int8_t core = get_core_num();
+    if (motion_owner != core) {
+      spin_lock_unsafe_blocking(motion_spin);
+      motion_owner = core;
+    }
+    ++motion_depth;
+  }
+
+  void HAL_motion_unlock() {
+    if (motion_owner != int8_t(get_core_num()) || !motion_depth) return;
+    if (!--motion_depth) {
+      motion_owner = -1;
+      spin_unlock_unsafe(motion_spin);
+    }
+  }
+
+  // Wait for a callback running on the other core to finish
+  void HAL_motion_wait() {
+    if (motion_owner == int8_t(get_core_num())) return;
+    spin_unlock(motion_spin, spin_lock_blocking(motion_spin));
+  }
+
+  // Core 1 entry points, started by the Arduino core
+  void setup1() {
+    HAL_timer_pool_1 = alarm_pool_create(1, 6);
+    HAL_timer_pool_0 = HAL_timer_pool_1;
+    irq_set_priority(TIMER_IRQ_1, 0x80);
+    motion_core_ready = true;
+  }
+  void loop1() { __wfi(); }
+
+  #define MOTION_CALLBACK(N) do{ HAL_motion_lock(); HAL_timer_##N##_callback(); HAL_motion_unlock(); }while(0)
+
+#else
+
+  #define MOTION_CALLBACK(N) HAL_timer_##N##_callback()
+
+#endif
+
 void HAL_timer_init() {
   //reserve all the available alarm pools to use as "pseudo" hardware timers
   //HAL_timer_pool_0 = alarm_pool_create(0,2);
-  HAL_timer_pool_1 = alarm_pool_create(1, 6);
-  HAL_timer_pool_0 = HAL_timer_pool_1;
+  #if ENABLED(DUAL_CORE_MOTION)
+    while (!motion_core_ready) tight_loop_contents(); // Core 1 owns the Stepper / Temperature pool
+  #else
+    HAL_timer_pool_1 = alarm_pool_create(1, 6);
+    HAL_timer_pool_0 = HAL_timer_pool_1;
+  #endif
   HAL_timer_pool_2 = alarm_pool_create(2, 6);
   HAL_timer_pool_3 = HAL_timer_pool_2;
   //HAL_timer_pool_3 = alarm_pool_create(3, 6);
 
   irq_set_priority(TIMER_IRQ_0, 0xC0);
-  irq_set_priority(TIMER_IRQ_1, 0x80);
+  IF_DISABLED(DUAL_CORE_MOTION, irq_set_priority(TIMER_IRQ_1, 0x80));
   irq_set_priority(TIMER_IRQ_2, 0x40);
   irq_set_priority(TIMER_IRQ_3, 0x00);
 
@@ -85,11 +145,11 @@ void HAL_timer_stop(const uint8_t timer_num) {
 }
 
 int64_t HAL_timer_alarm_pool_0_callback(long int, void*) {
-  if (HAL_timer_irq_en[0]) HAL_timer_0_callback();
+  if (HAL_timer_irq_en[0]) MOTION_CALLBACK(0);
   return 0;
 }
 int64_t HAL_timer_alarm_pool_1_callback(long int, void*) {
-  if (HAL_timer_irq_en[1]) HAL_timer_1_callback();
+  if (HAL_timer_irq_en[1]) MOTION_CALLBACK(1);
   return 0;
 }
 int64_t HAL_timer_alarm_pool_2_callback(long int, void*) {
@@ -102,11 +162,11 @@ int64_t HAL_timer_alarm_pool_3_callback(long int, void*) {
 }
 
 bool HAL_timer_repeating_0_callback(repeating_timer* timer) {
-  if (HAL_timer_irq_en[0]) HAL_timer_0_callback();
+  if (HAL_timer_irq_en[0]) MOTION_CALLBACK(0);
   return true;
 }
 bool HAL_timer_repeating_1_callback(repeating_timer* timer) {
-  if (HAL_timer_irq_en[1]) HAL_timer_1_callback();
+  if (HAL_timer_irq_en[1]) MOTION_CALLBACK(1);
   return true;
 }
 bool HAL_timer_repeating_2_callback(repeating_timer* timer) {
@@ -164,6 +164,7 @@ FORCE_INLINE static void HAL_timer_enable_interrupt(const uint8_t timer_num) {
 
 FORCE_INLINE static void HAL_timer_disable_interrupt(const uint8_t timer_num) {
   HAL_timer_irq_en[timer_num] = 0;
+  TERN_(DUAL_CORE_MOTION, HAL_motion_wait()); // Let a callback running on core 1 finish
 }
 
 FORCE_INLINE static bool HAL_timer_interrupt_enabled(const uint8_t timer_num) {
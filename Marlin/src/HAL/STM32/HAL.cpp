@@ -28,8 +28,12 @@
 
 #include "usb_serial.h"
 
+#if ENABLED(EEPROM_BACKGROUND_WRITE)
+  #include "../../libs/BL24CXX.h"
+#endif
+
 #ifdef USBCON
-  DefaultSerial1 MSerialUSB(false, SerialUSB);
+  DefaultSerial1 MSerialUSB(false, TERN(USB_CDC_BULK_RX, usbBulkSerial, SerialUSB));
 #endif
 
 #if ENABLED(SRAM_EEPROM_EMULATION)
@@ -111,7 +115,10 @@ void MarlinHAL::idletask() {
   #endif
 }
 
-void MarlinHAL::reboot() { NVIC_SystemReset(); }
+void MarlinHAL::reboot() {
+  TERN_(EEPROM_BACKGROUND_WRITE, BL24CXX::flush()); // Finish a settings save first
+  NVIC_SystemReset();
+}
 
 uint8_t MarlinHAL::get_reset_source() {
   return
@@ -111,6 +111,10 @@ extern volatile uint32_t systick_uptime_millis;
 
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
 
+#if ENABLED(ISR_CODE_IN_RAM)
+  #define HAL_RAMFUNC __attribute__((section(".RamFunc"))) // Copied to SRAM with .data at startup
+#endif
+
 // ------------------------
 // Class Utilities
 // ------------------------
@@ -173,16 +177,31 @@ public:
 
   static uint16_t adc_result;
 
-  // Called by Temperature::init once at startup
-  static void adc_init() {
-    analogReadResolution(HAL_ADC_RESOLUTION);
-  }
+  #if ENABLED(ADC_DMA_SCAN)
+
+    // Called by Temperature::init once at startup. Start the DMA scan of all sensor pins.
+    static void adc_init();
+
+    // Called by Temperature::init for each sensor at startup. Set up by adc_init.
+    static void adc_enable(const pin_t) {}
+
+    // Get the filtered reading of the given pin. Called from Temperature::isr!
+    static void adc_start(const pin_t pin);
+
+  #else
 
-  // Called by Temperature::init for each sensor at startup
-  static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+    // Called by Temperature::init once at startup
+    static void adc_init() {
+      analogReadResolution(HAL_ADC_RESOLUTION);
+    }
 
-  // Begin ADC sampling on the given pin. Called from Temperature::isr!
-  static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+    // Called by Temperature::init for each sensor at startup
+    static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+
+    // Begin ADC sampling on the given pin. Called from Temperature::isr!
+    static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+
+  #endif
 
   // Is the ADC ready for reading?
   static bool adc_ready() { return true; }
@@ -203,4 +222,10 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  /**
+   * True if the pin has a timer channel that isn't used by the stepper or
+   * temperature interrupts, so it can be given to set_pwm_duty.
+   */
+  static bool pwm_timer_free(const pin_t pin);
+
 };
@@ -132,6 +132,11 @@ static SPISettings spiConfig;
   // Hardware SPI
   // ------------------------
 
+  #if ENABLED(SD_SPI_DMA)
+    #include "MarlinSPI.h"
+    static MarlinSPI sdSPI(SD_MOSI_PIN, SD_MISO_PIN, SD_SCK_PIN);
+  #endif
+
   /**
    * VGPV SPI speed start and PCLK2/2, by default 108/2 = 54Mhz
    */
@@ -165,11 +170,16 @@ static SPISettings spiConfig;
     }
     spiConfig = SPISettings(clock, MSBFIRST, SPI_MODE0);
 
-    SPI.setMISO(SD_MISO_PIN);
-    SPI.setMOSI(SD_MOSI_PIN);
-    SPI.setSCLK(SD_SCK_PIN);
+    #if ENABLED(SD_SPI_DMA)
+      sdSPI.setClockFrequency(clock);
+      sdSPI.begin();
+    #else
+      SPI.setMISO(SD_MISO_PIN);
+      SPI.setMOSI(SD_MOSI_PIN);
+      SPI.setSCLK(SD_SCK_PIN);
 
-    SPI.begin();
+      SPI.begin();
+    #endif
   }
 
   /**
@@ -180,7 +190,7 @@ static SPISettings spiConfig;
    * @details
    */
   uint8_t spiRec() {
-    uint8_t returnByte = SPI.transfer(0xFF);
+    uint8_t returnByte = TERN(SD_SPI_DMA, sdSPI, SPI).transfer(0xFF);
     return returnByte;
   }
 
@@ -195,8 +205,12 @@ static SPISettings spiConfig;
    */
   void spiRead(uint8_t *buf, uint16_t nbyte) {
     if (nbyte == 0) return;
-    memset(buf, 0xFF, nbyte);
-    SPI.transfer(buf, nbyte);
+    #if ENABLED(SD_SPI_DMA)
+      sdSPI.dmaTransfer(nullptr, buf, nbyte); // Sends 0xFF while receiving
+    #else
+      memset(buf, 0xFF, nbyte);
+      SPI.transfer(buf, nbyte);
+    #endif
   }
 
   /**
@@ -207,7 +221,7 @@ static SPISettings spiConfig;
    * @details
    */
   void spiSend(uint8_t b) {
-    SPI.transfer(b);
+    TERN(SD_SPI_DMA, sdSPI, SPI).transfer(b);
   }
 
   /**
@@ -219,9 +233,14 @@ static SPISettings spiConfig;
    * @details Use DMA
    */
   void spiSendBlock(uint8_t token, const uint8_t *buf) {
-    uint8_t rxBuf[512];
-    SPI.transfer(token);
-    SPI.transfer((uint8_t*)buf, &rxBuf, 512);
+    #if ENABLED(SD_SPI_DMA)
+      sdSPI.transfer(token);
+      sdSPI.dmaSend(buf, 512);
+    #else
+      uint8_t rxBuf[512];
+      SPI.transfer(token);
+      SPI.transfer((uint8_t*)buf, &rxBuf, 512);
+    #endif
   }
 
 #endif // SOFTWARE_SPI
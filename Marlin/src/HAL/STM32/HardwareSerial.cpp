@@ -124,6 +124,11 @@
   void serialEvent6() __attribute__((weak));
 #endif
 
+#ifdef SERIAL_DMA_TX_PORTS
+  // USART1-3 sending by DMA, for the DMA interrupt handlers
+  static HAL_HardwareSerial *tx_dma_serial[3];
+#endif
+
 // Constructors ////////////////////////////////////////////////////////////////
 
 HAL_HardwareSerial::HAL_HardwareSerial(void *peripheral) {
@@ -214,6 +219,21 @@ HAL_HardwareSerial::HAL_HardwareSerial(void *peripheral) {
     _serial.pin_tx = pinmap_pin(peripheral, PinMap_UART_TX);
   }
 
+  #ifdef SERIAL_DMA_TX_PORTS
+    // Ports listed in SERIAL_DMA_TX_PORTS send on their DMA1 TX channel
+    TX_DMA = nullptr;
+    _tx_dma_len = 0;
+    const int8_t port = peripheral == USART1 ? 1 : peripheral == USART2 ? 2 : peripheral == USART3 ? 3 : 0;
+    constexpr int8_t tx_dma_ports[] = SERIAL_DMA_TX_PORTS;
+    for (const int8_t p : tx_dma_ports) if (port && p == port) {
+      switch (port) {
+        case 1: TX_DMA = DMA1_Channel4; _tx_dma_channel = 4; break;
+        case 2: TX_DMA = DMA1_Channel7; _tx_dma_channel = 7; break;
+        case 3: TX_DMA = DMA1_Channel2; _tx_dma_channel = 2; break;
+      }
+    }
+  #endif
+
   init(_serial.pin_rx, _serial.pin_tx);
 }
 
@@ -271,6 +291,34 @@ void HAL_HardwareSerial::init(PinName _rx, PinName _tx) {
 
 #endif
 
+#ifdef SERIAL_DMA_TX_PORTS
+
+  // Send the TX ring from the tail up to the head, or to the end of the ring if it wraps.
+  // The ring takes new data while it's sent, and the next transfer starts when this one ends.
+  void HAL_HardwareSerial::tx_dma_start() {
+    const tx_buffer_index_t head = _serial.tx_head, tail = _serial.tx_tail;
+    _tx_dma_len = (head >= tail ? head : TX_BUFFER_SIZE) - tail;
+    if (!_tx_dma_len) return;
+    TX_DMA->CCR &= ~DMA_CCR_EN;
+    TX_DMA->CMAR = (uint32_t)&_serial.tx_buff[tail];
+    TX_DMA->CNDTR = _tx_dma_len;
+    TX_DMA->CCR |= DMA_CCR_EN;
+  }
+
+  void HAL_HardwareSerial::_tx_dma_complete_irq() {
+    DMA1->IFCR = DMA_IFCR_CGIF1 << (4 * (_tx_dma_channel - 1));   // Clear the channel's interrupt flags
+    _serial.tx_tail = (_serial.tx_tail + _tx_dma_len) % TX_BUFFER_SIZE;
+    tx_dma_start();
+  }
+
+  extern "C" {
+    void DMA1_Channel4_IRQHandler() { if (tx_dma_serial[0]) tx_dma_serial[0]->_tx_dma_complete_irq(); }
+    void DMA1_Channel7_IRQHandler() { if (tx_dma_serial[1]) tx_dma_serial[1]->_tx_dma_complete_irq(); }
+    void DMA1_Channel2_IRQHandler() { if (tx_dma_serial[2]) tx_dma_serial[2]->_tx_dma_complete_irq(); }
+  }
+
+#endif // SERIAL_DMA_TX_PORTS
+
 // Public Methods //////////////////////////////////////////////////////////////
 
 void HAL_HardwareSerial::begin(unsigned long baud, uint8_t config) {
@@ -312,10 +360,16 @@ void HAL_HardwareSerial::begin(unsigned long baud, uint8_t config) {
 
   uart_init(&_serial, (uint32_t)baud, databits, parity, stopbits);
   Serial_DMA_Read_Enable(); // Start the circular DMA serial reading process, no callback needed
+  #ifdef SERIAL_DMA_TX_PORTS
+    if (TX_DMA) Serial_DMA_Write_Enable();
+  #endif
 }
 
 void HAL_HardwareSerial::end() {
   flush();                              // Wait for transmission of outgoing data
+  #ifdef SERIAL_DMA_TX_PORTS
+    if (TX_DMA) TX_DMA->CCR = 0;        // Stop the DMA channel and its interrupt
+  #endif
   uart_deinit(&_serial);
   _serial.rx_head = _serial.rx_tail;    // Clear any received data
 }
@@ -375,6 +429,15 @@ size_t HAL_HardwareSerial::write(uint8_t c) {             // Interrupt based wri
   _serial.tx_buff[_serial.tx_head] = c;
   _serial.tx_head = i;
 
+  #ifdef SERIAL_DMA_TX_PORTS
+    if (TX_DMA) {
+      CRITICAL_SECTION_START();
+      if (!_tx_dma_len) tx_dma_start();                     // Idle, else the DMA interrupt sends it next
+      CRITICAL_SECTION_END();
+      return 1;
+    }
+  #endif
+
   #ifdef STM32H7xx // Support STM32H7xx with different uart_attach_tx_callback
     if ((!serial_tx_active(&_serial)) && (_serial.tx_head != _serial.tx_tail)) {
       size_t remaining_data = (TX_BUFFER_SIZE + _serial.tx_head -_serial.tx_tail) % TX_BUFFER_SIZE;
@@ -391,6 +454,10 @@ size_t HAL_HardwareSerial::write(uint8_t c) {             // Interrupt based wri
   return 1;
 }
 
+int HAL_HardwareSerial::availableForWrite() {
+  return (TX_BUFFER_SIZE + _serial.tx_tail - _serial.tx_head - 1) % TX_BUFFER_SIZE;
+}
+
 void HAL_HardwareSerial::flush() {
   while ((_serial.tx_head != _serial.tx_tail)) { /* nada */ } // nop, the interrupt handler will free up space for us
 }
@@ -523,6 +590,27 @@ void HAL_HardwareSerial::flush() {
     RX_DMA.uart->CR1            |= USART_CR1_UE;                  // UART Enable
   }
 
+  #ifdef SERIAL_DMA_TX_PORTS
+
+    void HAL_HardwareSerial::Serial_DMA_Write_Enable() {
+      __HAL_RCC_DMA1_CLK_ENABLE();                                // enable DMA1 clock
+
+      TX_DMA->CCR                  = 0;                           // DMA channel clear/disable
+      TX_DMA->CPAR                 = (uint32_t)(&RX_DMA.uart->DR); // DMA channel Peripheral Address Register = USART Data Register
+      TX_DMA->CCR                 |= DMA_CCR_MINC;                // DMA channel Memory Increment enable
+      TX_DMA->CCR                 |= DMA_CCR_DIR;                 // DMA channel Data Transfer direction: Read memory
+      TX_DMA->CCR                 |= DMA_CCR_TCIE;                // DMA channel Transfer Complete Interrupt, to send the rest of the ring
+
+      tx_dma_serial[RX_DMA.uart == USART1 ? 0 : RX_DMA.uart == USART2 ? 1 : 2] = this;
+      const IRQn_Type irq = IRQn_Type(DMA1_Channel1_IRQn + _tx_dma_channel - 1);
+      HAL_NVIC_SetPriority(irq, UART_IRQ_PRIO, UART_IRQ_SUBPRIO);
+      HAL_NVIC_EnableIRQ(irq);
+
+      RX_DMA.uart->CR3            |= USART_CR3_DMAT;              // UART DMA Transmitter enabled
+    }
+
+  #endif
+
 #endif // STM32F0xx || STM32F1xx
 
 #endif // SERIAL_DMA && HAL_UART_MODULE_ENABLED && !HAL_UART_MODULE_ONLY
@@ -63,6 +63,7 @@ class HAL_HardwareSerial : public Stream {
     virtual int read();
     virtual int peek();
     virtual size_t write(uint8_t);
+    virtual int availableForWrite();
     virtual void flush();
     operator bool() { return true; }
 
@@ -71,6 +72,10 @@ class HAL_HardwareSerial : public Stream {
 
     static int _tx_complete_irq(serial_t *obj); // Interrupt handler
 
+    #ifdef SERIAL_DMA_TX_PORTS
+      void _tx_dma_complete_irq();              // DMA TX interrupt handler
+    #endif
+
   private:
     uint8_t _uart_index;
     bool    _rx_enabled;
@@ -80,4 +85,12 @@ class HAL_HardwareSerial : public Stream {
     void update_rx_head();
     DMA_CFG RX_DMA;
     void Serial_DMA_Read_Enable();
+
+    #ifdef SERIAL_DMA_TX_PORTS
+      DMA_Channel_TypeDef *TX_DMA;              // DMA1 channel sending the TX ring, or nullptr
+      uint8_t _tx_dma_channel;
+      volatile tx_buffer_index_t _tx_dma_len;   // Bytes of the TX ring being sent
+      void Serial_DMA_Write_Enable();
+      void tx_dma_start();
+    #endif
 };
@@ -168,6 +168,10 @@ uint8_t MarlinSPI::dmaSend(const void * transmitBuf, uint16_t length, bool minc)
   HAL_DMA_Abort(&_dmaTx);
   // DeInit objects
   HAL_DMA_DeInit(&_dmaTx);
+  // Wait for the last byte to go out, then drop the bytes received meanwhile
+  while (!__HAL_SPI_GET_FLAG(&_spi.handle, SPI_FLAG_TXE)) { /* nada */ }
+  while ( __HAL_SPI_GET_FLAG(&_spi.handle, SPI_FLAG_BSY)) { /* nada */ }
+  __HAL_SPI_CLEAR_OVRFLAG(&_spi.handle);
   return 1;
 }
 
@@ -88,6 +88,7 @@ public:
   }
 
   void setClockDivider(uint8_t _div);
+  void setClockFrequency(const uint32_t hz) { _speed = hz; } // The fastest clock to use, set by begin()
 
 private:
   void setupDma(SPI_HandleTypeDef &_spiHandle, DMA_HandleTypeDef &_dmaHandle, uint32_t direction, bool minc = false);
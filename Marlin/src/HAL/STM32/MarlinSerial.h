@@ -35,7 +35,12 @@
 
 #ifdef USBCON
   #include <USBSerial.h>
-  typedef ForwardSerial1Class< decltype(SerialUSB) > DefaultSerial1;
+  #if ENABLED(USB_CDC_BULK_RX)
+    #include "usb_serial.h"
+    typedef ForwardSerial1Class< USBBulkSerial > DefaultSerial1;
+  #else
+    typedef ForwardSerial1Class< decltype(SerialUSB) > DefaultSerial1;
+  #endif
   extern DefaultSerial1 MSerialUSB;
   #define USB_SERIAL_PORT(...) MSerialUSB
 #endif
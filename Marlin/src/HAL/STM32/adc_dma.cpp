@@ -0,0 +1,159 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ADC_DMA_SCAN)
+
+/**
+ * Continuous ADC scan of all sensor channels by DMA (STM32F1)
+ *
+ * ADC1 converts every channel in turn, without end, and DMA1 Channel 1 writes
+ * the results into a ring of ADC_DMA_SCANS scans. MarlinHAL::adc_start only
+ * filters the ring for the requested channel, so Temperature::isr never waits
+ * on a conversion. The Arduino analogRead re-initializes the ADC on each call
+ * at a cost of tens of microseconds.
+ */
+
+static const pin_t adc_dma_pins[] = {
+  OPTITEM(HAS_TEMP_ADC_0,         TEMP_0_PIN               )
+  OPTITEM(HAS_TEMP_ADC_1,         TEMP_1_PIN               )
+  OPTITEM(HAS_TEMP_ADC_2,         TEMP_2_PIN               )
+  OPTITEM(HAS_TEMP_ADC_3,         TEMP_3_PIN               )
+  OPTITEM(HAS_TEMP_ADC_4,         TEMP_4_PIN               )
+  OPTITEM(HAS_TEMP_ADC_5,         TEMP_5_PIN               )
+  OPTITEM(HAS_TEMP_ADC_6,         TEMP_6_PIN               )
+  OPTITEM(HAS_TEMP_ADC_7,         TEMP_7_PIN               )
+  OPTITEM(HAS_TEMP_ADC_BED,       TEMP_BED_PIN             )
+  OPTITEM(HAS_TEMP_ADC_CHAMBER,   TEMP_CHAMBER_PIN         )
+  OPTITEM(HAS_TEMP_ADC_PROBE,     TEMP_PROBE_PIN           )
+  OPTITEM(HAS_TEMP_ADC_COOLER,    TEMP_COOLER_PIN          )
+  OPTITEM(HAS_TEMP_ADC_BOARD,     TEMP_BOARD_PIN           )
+  OPTITEM(HAS_FILWIDTH_ADC,       FILWIDTH_PIN             )
+  OPTITEM(HAS_FILWIDTH2_ADC,      FILWIDTH2_PIN            )
+  OPTITEM(HAS_ADC_BUTTONS,        ADC_KEYPAD_PIN           )
+  OPTITEM(HAS_JOY_ADC_X,          JOY_X_PIN                )
+  OPTITEM(HAS_JOY_ADC_Y,          JOY_Y_PIN                )
+  OPTITEM(HAS_JOY_ADC_Z,          JOY_Z_PIN                )
+  OPTITEM(POWER_MONITOR_CURRENT,  POWER_MONITOR_CURRENT_PIN)
+  OPTITEM(POWER_MONITOR_VOLTAGE,  POWER_MONITOR_VOLTAGE_PIN)
+};
+
+#define ADC_DMA_CHANNELS COUNT(adc_dma_pins)
+
+static ADC_HandleTypeDef adc_handle;
+static DMA_HandleTypeDef dma_handle;
+
+// Ring of complete scans, written by DMA
+static volatile uint16_t adc_dma_buffer[ADC_DMA_SCANS][ADC_DMA_CHANNELS];
+
+#if ADC_DMA_IIR_SHIFT
+  // IIR filter state per channel, with ADC_DMA_IIR_SHIFT extra bits
+  static uint32_t adc_iir[ADC_DMA_CHANNELS];
+#endif
+
+void MarlinHAL::adc_init() {
+  __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  // ADC clock must not exceed 14MHz
+  RCC_PeriphCLKInitTypeDef clk = {};
+  clk.PeriphClockSelection = RCC_PERIPHCLK_ADC;
+  clk.AdcClockSelection = RCC_ADCPCLK2_DIV6;
+  HAL_RCCEx_PeriphCLKConfig(&clk);
+
+  dma_handle.Instance = DMA1_Channel1;
+  dma_handle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  dma_handle.Init.PeriphInc = DMA_PINC_DISABLE;
+  dma_handle.Init.MemInc = DMA_MINC_ENABLE;
+  dma_handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  dma_handle.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  dma_handle.Init.Mode = DMA_CIRCULAR;
+  dma_handle.Init.Priority = DMA_PRIORITY_LOW;
+  if (HAL_DMA_Init(&dma_handle) != HAL_OK) return;
+
+  adc_handle.Instance = ADC1;
+  adc_handle.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  adc_handle.Init.ScanConvMode = ADC_SCAN_ENABLE;
+  adc_handle.Init.ContinuousConvMode = ENABLE;
+  adc_handle.Init.NbrOfConversion = ADC_DMA_CHANNELS;
+  adc_handle.Init.DiscontinuousConvMode = DISABLE;
+  adc_handle.Init.NbrOfDiscConversion = 0;
+  adc_handle.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  if (HAL_ADC_Init(&adc_handle) != HAL_OK) return;
+  __HAL_LINKDMA(&adc_handle, DMA_Handle, dma_handle);
+
+  // One rank per sensor pin, in the order of adc_dma_pins
+  for (uint8_t i = 0; i < ADC_DMA_CHANNELS; ++i) {
+    const PinName pn = digitalPinToPinName(adc_dma_pins[i]);
+    pinmap_pinout(pn, PinMap_ADC);  // Set the pin to analog mode
+    ADC_ChannelConfTypeDef chan = {};
+    chan.Channel = STM_PIN_CHANNEL(pinmap_function(pn, PinMap_ADC));
+    chan.Rank = ADC_REGULAR_RANK_1 + i;
+    chan.SamplingTime = ADC_SAMPLETIME_71CYCLES_5;
+    HAL_ADC_ConfigChannel(&adc_handle, &chan);
+  }
+
+  HAL_ADCEx_Calibration_Start(&adc_handle);
+
+  // The DMA interrupts are left disabled in the NVIC. The ring is just read.
+  HAL_ADC_Start_DMA(&adc_handle, (uint32_t*)adc_dma_buffer, ADC_DMA_SCANS * ADC_DMA_CHANNELS);
+}
+
+// Filter the ring for the given pin. Called from Temperature::isr!
+void MarlinHAL::adc_start(const pin_t pin) {
+  uint8_t c = 0;
+  while (c < ADC_DMA_CHANNELS - 1 && adc_dma_pins[c] != pin) c++;
+
+  #if ADC_DMA_FILTER == 1
+    // Median of the ring
+    uint16_t s[ADC_DMA_SCANS];
+    for (uint8_t i = 0; i < ADC_DMA_SCANS; ++i) {
+      const uint16_t v = adc_dma_buffer[i][c];
+      uint8_t j = i;
+      for (; j && s[j - 1] > v; --j) s[j] = s[j - 1];
+      s[j] = v;
+    }
+    uint32_t v = s[ADC_DMA_SCANS / 2];
+  #else
+    // Mean of the ring
+    uint32_t v = 0;
+    for (uint8_t i = 0; i < ADC_DMA_SCANS; ++i) v += adc_dma_buffer[i][c];
+    v /= ADC_DMA_SCANS;
+  #endif
+
+  #if ADC_DMA_IIR_SHIFT
+    // Single pole low-pass, primed with the first reading
+    uint32_t &f = adc_iir[c];
+    if (!f) f = v << (ADC_DMA_IIR_SHIFT);
+    f = f - (f >> (ADC_DMA_IIR_SHIFT)) + v;
+    v = f >> (ADC_DMA_IIR_SHIFT);
+  #endif
+
+  adc_result = (v & 0xFFF) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
+}
+
+#endif // ADC_DMA_SCAN
+#endif // HAL_STM32
@@ -35,6 +35,9 @@
 
 #include "../../shared/eeprom_if.h"
 #include "../../shared/eeprom_api.h"
+#if ENABLED(EEPROM_BACKGROUND_WRITE)
+  #include "../../../libs/BL24CXX.h"
+#endif
 
 //
 // PersistentStore
@@ -50,22 +53,34 @@ bool PersistentStore::access_start()  { eeprom_init(); return true; }
 bool PersistentStore::access_finish() { return true; }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  uint16_t written = 0;
-  while (size--) {
-    uint8_t v = *value;
-    uint8_t * const p = (uint8_t * const)REAL_EEPROM_ADDR(pos);
-    if (v != eeprom_read_byte(p)) { // EEPROM has only ~100,000 write cycles, so only write bytes that have changed!
-      eeprom_write_byte(p, v);
-      if (++written & 0x7F) delay(2); else safe_delay(2); // Avoid triggering watchdog during long EEPROM writes
-      if (eeprom_read_byte(p) != v) {
-        SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
-        return true;
+  #if ENABLED(EEPROM_BACKGROUND_WRITE)
+
+    // Change the RAM image. Its pages are written and checked from idle().
+    for (; size--; ++pos, ++value) {
+      BL24CXX::stage(REAL_EEPROM_ADDR(pos), value, 1);
+      crc16(crc, value, 1);
+    }
+
+  #else
+
+    uint16_t written = 0;
+    while (size--) {
+      uint8_t v = *value;
+      uint8_t * const p = (uint8_t * const)REAL_EEPROM_ADDR(pos);
+      if (v != eeprom_read_byte(p)) { // EEPROM has only ~100,000 write cycles, so only write bytes that have changed!
+        eeprom_write_byte(p, v);
+        if (++written & 0x7F) delay(2); else safe_delay(2); // Avoid triggering watchdog during long EEPROM writes
+        if (eeprom_read_byte(p) != v) {
+          SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
+          return true;
+        }
       }
+      crc16(crc, &v, 1);
+      pos++;
+      value++;
     }
-    crc16(crc, &v, 1);
-    pos++;
-    value++;
-  }
+
+  #endif
   return false;
 }
 
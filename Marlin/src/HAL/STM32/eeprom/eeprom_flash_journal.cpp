@@ -0,0 +1,260 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+
+#include "../../shared/eeprom_api.h"
+#include <stm32_def.h>
+
+/**
+ * Journaled EEPROM emulation in flash for STM32F1 (page-erased flash)
+ *
+ * Two areas of FLASH_JOURNAL_PAGES pages at the end of flash take turns. The active area holds
+ * a header, a copy of the EEPROM image, and then a log of 32-bit records, each one a half-word
+ * of the image that changed. A save only marks the changed half-words, and journal_task() adds
+ * their records a few at a time from idle(). When the log is full the image is copied into the
+ * other area and the log starts over. Page erases stall the CPU for tens of ms so they only run
+ * while no moves are queued. Programming a half-word stalls it for about 50µs.
+ *
+ * At startup the valid area with the newest header is loaded and its records applied in order.
+ * A header is written last, so an interrupted copy leaves the older area in use.
+ */
+
+#define DEBUG_OUT ENABLED(EEPROM_CHITCHAT)
+#include "../../../core/debug_out.h"
+
+#ifndef MARLIN_EEPROM_SIZE
+  #define MARLIN_EEPROM_SIZE    0x800U // 2K
+#endif
+#ifndef FLASH_JOURNAL_PAGES
+  #define FLASH_JOURNAL_PAGES   4
+#endif
+#ifndef FLASH_JOURNAL_END
+  #ifdef FLASH_BANK2_END
+    #define FLASH_JOURNAL_END   FLASH_BANK2_END
+  #else
+    #define FLASH_JOURNAL_END   FLASH_BANK1_END
+  #endif
+#endif
+
+#define JOURNAL_AREA_SIZE       ((FLASH_JOURNAL_PAGES) * (FLASH_PAGE_SIZE))
+#define JOURNAL_AREA(A)         ((FLASH_JOURNAL_END) + 1 - (2 - (A)) * (JOURNAL_AREA_SIZE))
+#define JOURNAL_MAGIC           0x4A4EU                               // High half-word of the header
+#define JOURNAL_IMAGE           4                                     // Offset of the image, after the header
+#define JOURNAL_LOG             (JOURNAL_IMAGE + (MARLIN_EEPROM_SIZE)) // Offset of the first record
+#define JOURNAL_BATCH           4                                     // Half-word pairs written per call
+#define JOURNAL_WORDS           ((MARLIN_EEPROM_SIZE) / 2)
+
+static_assert(0 == (MARLIN_EEPROM_SIZE) % 64, "MARLIN_EEPROM_SIZE must be a multiple of 64 for FLASH_EEPROM_JOURNAL.");
+static_assert(JOURNAL_AREA_SIZE - (JOURNAL_LOG) >= 2 * (MARLIN_EEPROM_SIZE), "FLASH_JOURNAL_PAGES is too small for MARLIN_EEPROM_SIZE.");
+
+static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+static uint16_t * const ram_words = reinterpret_cast<uint16_t*>(ram_eeprom);
+
+static uint32_t dirty[JOURNAL_WORDS / 32];  // Half-words changed since they were written to flash
+static uint16_t dirty_count;
+
+static int8_t active = -1;                  // Area with the image, -1 before the first access
+static uint16_t sequence;                   // Header sequence of the active area
+static uint32_t log_pos;                    // Offset of the next record in the active area
+
+static bool compacting;                     // Copying the image into the other area
+static uint8_t erased_pages;                // Pages of the other area erased so far
+static uint16_t copy_pos;                   // Bytes of the image copied so far
+
+static uint32_t flash_word(const uint32_t addr) { return *(__IO uint32_t*)addr; }
+static bool header_valid(const uint8_t a) { return (flash_word(JOURNAL_AREA(a)) >> 16) == JOURNAL_MAGIC; }
+static uint16_t header_sequence(const uint8_t a) { return uint16_t(flash_word(JOURNAL_AREA(a))); }
+
+static bool program_half(const uint32_t addr, const uint16_t value) {
+  const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, addr, value);
+  if (status != HAL_OK) DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status, " address=", addr);
+  return status == HAL_OK;
+}
+
+static void mark_all_dirty() {
+  for (uint32_t &d : dirty) d = UINT32_MAX;
+  dirty_count = JOURNAL_WORDS;
+}
+
+// Load the image from the newest area and apply its records
+static void journal_load() {
+  const bool valid0 = header_valid(0), valid1 = header_valid(1);
+  if (!valid0 && !valid1) {
+    // Nothing stored yet. The first save starts with a copy into area 0.
+    for (uint8_t &b : ram_eeprom) b = 0xFF;
+    active = 1;
+    log_pos = JOURNAL_AREA_SIZE;
+    return;
+  }
+
+  active = valid0 && valid1 ? (int16_t(header_sequence(1) - header_sequence(0)) > 0) : valid1;
+  sequence = header_sequence(active);
+
+  const uint32_t base = JOURNAL_AREA(active);
+  memcpy(ram_eeprom, (const void*)(base + JOURNAL_IMAGE), MARLIN_EEPROM_SIZE);
+
+  // Records are written value first, index last. An index of 0xFFFF ends the log.
+  for (log_pos = JOURNAL_LOG; log_pos < JOURNAL_AREA_SIZE; log_pos += 4) {
+    const uint32_t record = flash_word(base + log_pos);
+    const uint16_t index = uint16_t(record);
+    if (index == 0xFFFF) {
+      if (record != UINT32_MAX) log_pos += 4; // Skip a record cut short
+      break;
+    }
+    if (index < JOURNAL_WORDS) ram_words[index] = record >> 16;
+  }
+
+  DEBUG_ECHOLNPGM("EEPROM journal loaded from area ", active, ", ", (log_pos - (JOURNAL_LOG)) / 4, " records.");
+}
+
+// Add the records of a few changed half-words to the log
+static void journal_append() {
+  const uint32_t base = JOURNAL_AREA(active);
+  uint8_t n = JOURNAL_BATCH;
+  for (uint16_t i = 0; n && dirty_count && i < JOURNAL_WORDS; i++) {
+    if (!dirty[i >> 5]) { i |= 31; continue; }
+    if (!TEST32(dirty[i >> 5], i & 31)) continue;
+    if (!program_half(base + log_pos + 2, ram_words[i]) || !program_half(base + log_pos, i)) {
+      log_pos = JOURNAL_AREA_SIZE;            // Don't use this log any more, copy into the other area
+      return;
+    }
+    CBI32(dirty[i >> 5], i & 31);
+    dirty_count--;
+    log_pos += 4;
+    n--;
+  }
+}
+
+// Erase the other area one page at a time, then copy the image and write its header
+static void journal_compact(const bool can_erase) {
+  const uint8_t target = !active;
+  const uint32_t base = JOURNAL_AREA(target);
+
+  if (erased_pages < FLASH_JOURNAL_PAGES) {
+    if (!can_erase) return;
+    FLASH_EraseInitTypeDef erase;
+    erase.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase.Banks = FLASH_BANK_1;
+    erase.PageAddress = base + erased_pages * (FLASH_PAGE_SIZE);
+    erase.NbPages = 1;
+    uint32_t page_error = 0;
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &page_error);
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status, " PageError=", page_error);
+      return;                                 // Try again later
+    }
+    if (++erased_pages == FLASH_JOURNAL_PAGES) {
+      // The copy takes the image as it is, so later changes go into the new log
+      for (uint32_t &d : dirty) d = 0;
+      dirty_count = 0;
+      copy_pos = 0;
+    }
+    return;
+  }
+
+  for (uint8_t n = JOURNAL_BATCH * 2; n && copy_pos < MARLIN_EEPROM_SIZE; n--, copy_pos += 2)
+    if (!program_half(base + JOURNAL_IMAGE + copy_pos, ram_words[copy_pos / 2])) {
+      erased_pages = 0;                       // Start over, keeping every change pending
+      mark_all_dirty();
+      return;
+    }
+
+  if (copy_pos < MARLIN_EEPROM_SIZE) return;
+
+  const uint16_t seq = sequence + 1;
+  if (!program_half(base, seq) || !program_half(base + 2, JOURNAL_MAGIC)) {
+    erased_pages = 0;
+    mark_all_dirty();
+    return;
+  }
+
+  active = target;
+  sequence = seq;
+  log_pos = JOURNAL_LOG;
+  compacting = false;
+  DEBUG_ECHOLNPGM("EEPROM journal copied to area ", target, ".");
+}
+
+void PersistentStore::journal_task(const bool can_erase) {
+  if (active < 0 || !(dirty_count || compacting)) return;
+
+  if (!compacting && log_pos + 4UL * dirty_count > JOURNAL_AREA_SIZE) {
+    compacting = true;
+    erased_pages = 0;
+  }
+
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
+  if (compacting) journal_compact(can_erase); else journal_append();
+  HAL_FLASH_Lock();
+}
+
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
+
+bool PersistentStore::access_start() {
+  if (active < 0) journal_load();
+  return true;
+}
+
+// Changes go to flash from journal_task()
+bool PersistentStore::access_finish() { return true; }
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  while (size--) {
+    const uint8_t v = *value;
+    const int p = REAL_EEPROM_ADDR(pos);
+    if (v != ram_eeprom[p]) {
+      ram_eeprom[p] = v;
+      const uint16_t i = p >> 1;
+      if (!TEST32(dirty[i >> 5], i & 31)) {
+        SBI32(dirty[i >> 5], i & 31);
+        dirty_count++;
+      }
+    }
+    crc16(crc, &v, 1);
+    pos++;
+    value++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  do {
+    const uint8_t c = ram_eeprom[REAL_EEPROM_ADDR(pos)];
+    if (writing) *value = c;
+    crc16(crc, &c, 1);
+    pos++;
+    value++;
+  } while (--size);
+  return false;
+}
+
+#endif // FLASH_EEPROM_JOURNAL
+#endif // HAL_STM32
@@ -36,7 +36,10 @@
 #include "../../../libs/BL24CXX.h"
 #include "../../shared/eeprom_if.h"
 
-void eeprom_init() { BL24CXX::init(); }
+void eeprom_init() {
+  BL24CXX::init();
+  TERN_(EEPROM_BACKGROUND_WRITE, BL24CXX::load());
+}
 
 // ------------------------
 // Public functions
@@ -44,12 +47,12 @@ void eeprom_init() { BL24CXX::init(); }
 
 void eeprom_write_byte(uint8_t *pos, uint8_t value) {
   const unsigned eeprom_address = (unsigned)pos;
-  BL24CXX::writeOneByte(eeprom_address, value);
+  TERN(EEPROM_BACKGROUND_WRITE, BL24CXX::stage(eeprom_address, &value, 1), BL24CXX::writeOneByte(eeprom_address, value));
 }
 
 uint8_t eeprom_read_byte(uint8_t *pos) {
   const unsigned eeprom_address = (unsigned)pos;
-  return BL24CXX::readOneByte(eeprom_address);
+  return TERN(EEPROM_BACKGROUND_WRITE, BL24CXX::cached(eeprom_address), BL24CXX::readOneByte(eeprom_address));
 }
 
 #endif // IIC_BL24CXX_EEPROM
@@ -61,22 +61,34 @@ void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v
   }
 }
 
-void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
-  if (!PWM_PIN(pin)) return; // Don't proceed if no hardware timer
-  const PinName pin_name = digitalPinToPinName(pin);
-  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM); // Get HAL timer instance
-  const timer_index_t index = get_timer_index(Instance);
-
-  // Protect used timers.
+// Protect used timers.
+static bool is_used_timer(const timer_index_t index) {
   #ifdef STEP_TIMER
-    if (index == TIMER_INDEX(STEP_TIMER)) return;
+    if (index == TIMER_INDEX(STEP_TIMER)) return true;
   #endif
   #ifdef TEMP_TIMER
-    if (index == TIMER_INDEX(TEMP_TIMER)) return;
+    if (index == TIMER_INDEX(TEMP_TIMER)) return true;
   #endif
   #if defined(PULSE_TIMER) && MF_TIMER_PULSE != MF_TIMER_STEP
-    if (index == TIMER_INDEX(PULSE_TIMER)) return;
+    if (index == TIMER_INDEX(PULSE_TIMER)) return true;
   #endif
+  UNUSED(index);
+  return false;
+}
+
+bool MarlinHAL::pwm_timer_free(const pin_t pin) {
+  if (!PWM_PIN(pin)) return false;
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(digitalPinToPinName(pin), PinMap_PWM);
+  return !is_used_timer(get_timer_index(Instance));
+}
+
+void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
+  if (!PWM_PIN(pin)) return; // Don't proceed if no hardware timer
+  const PinName pin_name = digitalPinToPinName(pin);
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM); // Get HAL timer instance
+  const timer_index_t index = get_timer_index(Instance);
+
+  if (is_used_timer(index)) return;
 
   if (HardwareTimer_Handle[index] == nullptr) // If frequency is set before duty we need to create a handle here.
     HardwareTimer_Handle[index]->__this = new HardwareTimer((TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM));
@@ -58,6 +58,10 @@ void FastIO_init(); // Must be called before using fast io macros
   #define _WRITE(IO, V) (FastIOPortMap[STM_PORT(digitalPinToPinName(IO))]->BSRR = _BV32(STM_PIN(digitalPinToPinName(IO)) + ((V) ? 0 : 16)))
 #endif
 
+// Port and BSRR bit of a pin, for writing several pins on one port at once
+#define FASTIO_PORT(IO)         FastIOPortMap[STM_PORT(digitalPinToPinName(IO))]
+#define FASTIO_BIT(IO)          _BV32(STM_PIN(digitalPinToPinName(IO)))
+
 #define _READ(IO)               bool(READ_BIT(FastIOPortMap[STM_PORT(digitalPinToPinName(IO))]->IDR, _BV32(STM_PIN(digitalPinToPinName(IO)))))
 #define _TOGGLE(IO)             TBI32(FastIOPortMap[STM_PORT(digitalPinToPinName(IO))]->ODR, STM_PIN(digitalPinToPinName(IO)))
 
@@ -40,6 +40,20 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4/H7 hardware." // IRON
 #endif
 
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #if DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_JOURNAL requires FLASH_EEPROM_EMULATION."
+  #elif !defined(STM32F1xx)
+    #error "FLASH_EEPROM_JOURNAL is currently only supported on STM32F1 hardware."
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
+    #error "FLASH_EEPROM_JOURNAL and FLASH_EEPROM_LEVELING can't be used together."
+  #endif
+#endif
+
+#if ENABLED(NEOPIXEL_DMA) && NOT_TARGET(STM32F1xx, STM32F4xx)
+  #error "NEOPIXEL_DMA is currently only supported on STM32F1 and STM32F4 hardware."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
@@ -54,6 +68,28 @@
   #error "TEMP_SENSOR_SOC requires 'TEMP_SOC_PIN ATEMP' on STM32."
 #endif
 
+#if ENABLED(ADC_DMA_SCAN)
+  #ifndef STM32F1xx
+    #error "ADC_DMA_SCAN is currently only supported on STM32F1 hardware."
+  #elif TEMP_SENSOR_SOC
+    #error "ADC_DMA_SCAN does not support TEMP_SENSOR_SOC."
+  #elif !(ADC_DMA_SCANS == 2 || ADC_DMA_SCANS == 4 || ADC_DMA_SCANS == 8 || ADC_DMA_SCANS == 16 || ADC_DMA_SCANS == 32)
+    #error "ADC_DMA_SCANS must be 2, 4, 8, 16 or 32."
+  #elif !WITHIN(ADC_DMA_FILTER, 0, 1)
+    #error "ADC_DMA_FILTER must be 0 (Mean) or 1 (Median)."
+  #elif !WITHIN(ADC_DMA_IIR_SHIFT, 0, 8)
+    #error "ADC_DMA_IIR_SHIFT must be from 0 to 8."
+  #endif
+#endif
+
+#if ENABLED(SD_SPI_DMA)
+  #ifdef STM32H7xx
+    #error "SD_SPI_DMA is not supported on STM32H7 hardware."
+  #elif ANY(SOFTWARE_SPI, FORCE_SOFT_SPI)
+    #error "SD_SPI_DMA requires hardware SPI."
+  #endif
+#endif
+
 /**
  * Check for common serial pin conflicts
  */
@@ -0,0 +1,152 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(NEOPIXEL_DMA)
+
+#include "neopixel_dma.h"
+#include "pinconfig.h"
+
+#define NEOPIXEL_SPI_MAX_HZ 3000000UL // Pulses of 1 and 2 SPI bits are in WS2812 timing from 2.1 to 3.0MHz
+#define NEOPIXEL_LATCH_US         300 // Low time ending a frame (280µs for WS2812B-V5 and SK6812)
+
+// A zero lead-in byte, then three SPI bytes for each byte of pixel data
+static uint8_t buffer[1 + (NEOPIXEL_PIXELS) * 4 * 3];
+
+static SPI_HandleTypeDef spi;
+static DMA_HandleTypeDef dma;
+static uint32_t byte_ns,        // SPI time of a byte
+                next_frame_us;  // When the last frame is sent and latched
+
+void neopixel_dma_init(const pin_t pin) {
+  const PinName pn = digitalPinToPinName(pin);
+  spi.Instance = (SPI_TypeDef *)pinmap_peripheral(pn, PinMap_SPI_MOSI);
+  if (!spi.Instance) return;
+
+  // The SPI TX DMA requests, as in MarlinSPI::setupDma
+  uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+  #ifdef SPI1_BASE
+    if (spi.Instance == SPI1) {
+      __HAL_RCC_SPI1_CLK_ENABLE();
+      pclk = HAL_RCC_GetPCLK2Freq();
+      #ifdef STM32F1xx
+        __HAL_RCC_DMA1_CLK_ENABLE();
+        dma.Instance = DMA1_Channel3;
+      #else
+        __HAL_RCC_DMA2_CLK_ENABLE();
+        dma.Init.Channel = DMA_CHANNEL_3;
+        dma.Instance = DMA2_Stream3;
+      #endif
+    }
+  #endif
+  #ifdef SPI2_BASE
+    if (spi.Instance == SPI2) {
+      __HAL_RCC_SPI2_CLK_ENABLE();
+      __HAL_RCC_DMA1_CLK_ENABLE();
+      #ifdef STM32F1xx
+        dma.Instance = DMA1_Channel5;
+      #else
+        dma.Init.Channel = DMA_CHANNEL_0;
+        dma.Instance = DMA1_Stream4;
+      #endif
+    }
+  #endif
+  #ifdef SPI3_BASE
+    if (spi.Instance == SPI3) {
+      __HAL_RCC_SPI3_CLK_ENABLE();
+      #ifdef STM32F1xx
+        __HAL_RCC_DMA2_CLK_ENABLE();
+        dma.Instance = DMA2_Channel2;
+      #else
+        __HAL_RCC_DMA1_CLK_ENABLE();
+        dma.Init.Channel = DMA_CHANNEL_0;
+        dma.Instance = DMA1_Stream5;
+      #endif
+    }
+  #endif
+  if (!dma.Instance) { spi.Instance = nullptr; return; }
+
+  // The smallest prescaler (2 to 256) that keeps under the maximum clock
+  uint8_t shift = 1;
+  while ((pclk >> shift) > NEOPIXEL_SPI_MAX_HZ && shift < 8) shift++;
+  byte_ns = 8000000000ULL / (pclk >> shift);
+
+  spi.State                  = HAL_SPI_STATE_RESET;
+  spi.Init.Mode              = SPI_MODE_MASTER;
+  spi.Init.Direction         = SPI_DIRECTION_2LINES;
+  spi.Init.DataSize          = SPI_DATASIZE_8BIT;
+  spi.Init.CLKPolarity       = SPI_POLARITY_LOW;
+  spi.Init.CLKPhase          = SPI_PHASE_1EDGE;
+  spi.Init.NSS               = SPI_NSS_SOFT;
+  spi.Init.BaudRatePrescaler = uint32_t(shift - 1) << SPI_CR1_BR_Pos;
+  spi.Init.FirstBit          = SPI_FIRSTBIT_MSB;
+  spi.Init.TIMode            = SPI_TIMODE_DISABLE;
+  spi.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+  spi.Init.CRCPolynomial     = 10;
+  HAL_SPI_Init(&spi);
+
+  dma.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  dma.Init.PeriphInc           = DMA_PINC_DISABLE;
+  dma.Init.MemInc              = DMA_MINC_ENABLE;
+  dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  dma.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  dma.Init.Mode                = DMA_NORMAL;
+  dma.Init.Priority            = DMA_PRIORITY_HIGH;   // A late byte would stretch a pulse
+  #ifdef STM32F4xx
+    dma.Init.FIFOMode          = DMA_FIFOMODE_DISABLE;
+  #endif
+  HAL_DMA_Init(&dma);
+
+  // Only MOSI is given to the SPI. SCK and MISO stay free for other uses.
+  pinmap_pinout(pn, PinMap_SPI_MOSI);
+  SET_BIT(spi.Instance->CR2, SPI_CR2_TXDMAEN);
+  __HAL_SPI_ENABLE(&spi);
+}
+
+bool neopixel_dma_show(const uint8_t * const pixels, const uint16_t count) {
+  if (!spi.Instance) return false;
+
+  // Wait for the last frame to go out and latch, with interrupts enabled
+  while (int32_t(micros() - next_frame_us) < 0) { /* nada */ }
+  HAL_DMA_Abort(&dma);  // Ready for the next transfer
+
+  uint8_t *b = buffer;
+  *b++ = 0;
+  const uint16_t n = _MIN(count, uint16_t((sizeof(buffer) - 1) / 3));
+  for (uint16_t i = 0; i < n; ++i) {
+    uint32_t bits = 0;
+    for (uint8_t m = 0x80; m; m >>= 1) bits = (bits << 3) | (pixels[i] & m ? 0b110 : 0b100);
+    *b++ = uint8_t(bits >> 16); *b++ = uint8_t(bits >> 8); *b++ = uint8_t(bits);
+  }
+  const uint16_t len = b - buffer;
+
+  HAL_DMA_Start(&dma, (uint32_t)buffer, (uint32_t)&spi.Instance->DR, len);
+  next_frame_us = micros() + len * byte_ns / 1000 + NEOPIXEL_LATCH_US;
+  return true;
+}
+
+#endif // NEOPIXEL_DMA
+#endif // HAL_STM32
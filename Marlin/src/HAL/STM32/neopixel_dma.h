@@ -0,0 +1,38 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * NeoPixel output by SPI DMA for STM32F1 / STM32F4 (NEOPIXEL_DMA)
+ *
+ * Each bit of pixel data is encoded as three SPI bits (100 for a 0, 110 for
+ * a 1) and sent out the MOSI pin by DMA with the SPI clock near 2.4MHz, so
+ * the strip sees WS2812 timing while interrupts stay enabled.
+ *
+ * The pin must be a MOSI pin of SPI1, SPI2 or SPI3. Otherwise the strip is
+ * left to the NeoPixel library, which bit-bangs it with interrupts disabled.
+ */
+
+void neopixel_dma_init(const pin_t pin);
+
+// Send the pixels (in strip order) and return true, or false to bit-bang them
+bool neopixel_dma_show(const uint8_t * const pixels, const uint16_t count);
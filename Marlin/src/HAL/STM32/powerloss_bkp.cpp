@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HAL/STM32/powerloss_bkp.cpp - Power-loss outage record in the backup domain
+ *
+ * STM32F4/F7 keep the record in backup SRAM, STM32F1 in the backup data registers.
+ * Either one is written in a few microseconds, but it's only retained through an
+ * outage with a battery on VBAT.
+ */
+
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(POWER_LOSS_STORE_BACKUP_SRAM)
+
+#include "../../feature/powerloss.h"
+
+#if STM32F7xx
+  #include <stm32f7xx_ll_pwr.h>
+#elif STM32F4xx
+  #include <stm32f4xx_ll_pwr.h>
+#endif
+
+PowerLossStore plr_store;
+
+#ifdef STM32F1xx
+
+  // 16-bit data registers DR1-DR10 and, on high-density parts, DR11-DR42
+  #ifdef BKP_DR42_D
+    #define PLR_BKP_REGS 42
+  #else
+    #define PLR_BKP_REGS 10
+  #endif
+  static_assert(sizeof(job_recovery_record_t) <= PLR_BKP_REGS * 2, "job_recovery_record_t doesn't fit in the backup registers.");
+
+  static __IO uint32_t* bkp_reg(const uint8_t i) { return i < 10 ? &BKP->DR1 + i : &BKP->DR11 + (i - 10); }
+
+  void PowerLossStore::init() {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_RCC_BKP_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+  }
+
+  void PowerLossStore::write(const job_recovery_record_t &rec) {
+    const uint8_t *p = (const uint8_t*)&rec;
+    for (uint8_t i = 0; i < (sizeof(rec) + 1) / 2; ++i, p += 2)
+      *bkp_reg(i) = p[0] | (2 * i + 1 < sizeof(rec) ? p[1] << 8 : 0);
+  }
+
+  void PowerLossStore::read(job_recovery_record_t &rec) {
+    uint8_t *p = (uint8_t*)&rec;
+    for (uint8_t i = 0; i < sizeof(rec); ++i)
+      p[i] = uint8_t(*bkp_reg(i / 2) >> ((i & 1) * 8));
+  }
+
+  void PowerLossStore::clear() {
+    for (uint8_t i = 0; i < (sizeof(job_recovery_record_t) + 1) / 2; ++i) *bkp_reg(i) = 0;
+  }
+
+#else // STM32F4xx, STM32F7xx
+
+  // The start of backup SRAM, which SRAM_EEPROM_EMULATION would also use
+  #define PLR_BKPSRAM ((__IO uint8_t *)BKPSRAM_BASE)
+
+  void PowerLossStore::init() {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();           // Enable access to backup SRAM
+    __HAL_RCC_BKPSRAM_CLK_ENABLE();
+    LL_PWR_EnableBkUpRegulator();         // Enable backup regulator
+    while (!LL_PWR_IsActiveFlag_BRR());   // Wait until backup regulator is initialized
+  }
+
+  void PowerLossStore::write(const job_recovery_record_t &rec) {
+    const uint8_t *p = (const uint8_t*)&rec;
+    for (uint16_t i = 0; i < sizeof(rec); ++i) PLR_BKPSRAM[i] = p[i];
+  }
+
+  void PowerLossStore::read(job_recovery_record_t &rec) {
+    uint8_t *p = (uint8_t*)&rec;
+    for (uint16_t i = 0; i < sizeof(rec); ++i) p[i] = PLR_BKPSRAM[i];
+  }
+
+  void PowerLossStore::clear() {
+    for (uint16_t i = 0; i < sizeof(job_recovery_record_t); ++i) PLR_BKPSRAM[i] = 0;
+  }
+
+#endif
+
+// Nothing to erase before a write
+void PowerLossStore::prepare() {}
+
+#endif // POWER_LOSS_STORE_BACKUP_SRAM
+#endif // HAL_STM32
@@ -39,6 +39,27 @@
 #define BLOCK_SIZE 512
 #define PRODUCT_ID 0x29
 
+#if ENABLED(MSC_SHARED_PRINTING)
+
+  #include "../../../feature/media_share.h"
+
+  #ifdef USE_USB_HS
+    #define MSC_USB_IRQn OTG_HS_IRQn
+  #elif defined(USB_OTG_FS)
+    #define MSC_USB_IRQn OTG_FS_IRQn
+  #elif defined(STM32F1xx)
+    #define MSC_USB_IRQn USB_LP_CAN1_RX0_IRQn
+  #else
+    #define MSC_USB_IRQn USB_LP_IRQn
+  #endif
+
+  // The host's requests run in the USB interrupt, so it waits while Marlin uses the media
+  static uint8_t lock_depth;
+  void media_lock() { NVIC_DisableIRQ(MSC_USB_IRQn); lock_depth++; }
+  void media_unlock() { if (!--lock_depth) NVIC_EnableIRQ(MSC_USB_IRQn); }
+
+#endif
+
 #ifndef SD_MULTIBLOCK_RETRY_CNT
   #define SD_MULTIBLOCK_RETRY_CNT 1
 #elif SD_MULTIBLOCK_RETRY_CNT < 1
@@ -67,6 +88,9 @@ public:
   }
 
   bool Write(uint8_t *pBuf, uint32_t blkAddr, uint16_t blkLen) {
+    // Keep off the job being printed and the changes in Marlin's cache
+    if (TERN0(MSC_SHARED_PRINTING, !mediashare.host_may_write(blkAddr, blkLen))) return false;
+
     auto sd2card = diskIODriver();
     // single block
     if (blkLen == 1) {
@@ -155,6 +179,8 @@ void MSC_SD_init() {
   delay(200);
   USBDevice.registerMscHandlers(1, &pSingleMscHandler, Marlin_STORAGE_Inquirydata);
   USBDevice.begin();
+  // Host transfers go below the stepper and temperature interrupts
+  TERN_(MSC_SHARED_PRINTING, HAL_NVIC_SetPriority(MSC_USB_IRQn, 15, 0));
 }
 
 #endif // HAS_SD_HOST_DRIVE
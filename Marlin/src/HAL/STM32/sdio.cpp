@@ -148,6 +148,9 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     #define SDIO_READ_RETRIES 3
   #endif
 
+  // Divider known to work on all cards, as found on the MKS Robin (48MHz / (8 + 2) = 4.8MHz)
+  #define SDIO_SAFE_CLOCK_DIV 8
+
   // F4 supports one DMA for RX and another for TX, but Marlin will never
   // do read and write at same time, so we use the same DMA for both.
   DMA_HandleTypeDef hdma_sdio;
@@ -267,63 +270,18 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     hsd.Instance = SDIO;
   }
 
-  bool SDIO_Init() {
-    uint8_t retryCnt = SDIO_READ_RETRIES;
-
-    bool status;
-    hsd.Instance = SDIO;
-    hsd.State = HAL_SD_STATE_RESET;
-
-    SD_LowLevel_Init();
-
-    uint8_t retry_Cnt = retryCnt;
-    for (;;) {
-      hal.watchdog_refresh();
-      status = (bool) HAL_SD_Init(&hsd);
-      if (!status) break;
-      if (!--retry_Cnt) return false;   // return failing status if retries are exhausted
-    }
-
-    go_to_transfer_speed();
-
-    hsd.Init.ClockPowerSave = SDIO_CLOCK_POWER_SAVE_ENABLE;
-    hsd.Init.ClockDiv = 8;
-
-    #if PINS_EXIST(SDIO_D1, SDIO_D2, SDIO_D3) // go to 4 bit wide mode if pins are defined
-      retry_Cnt = retryCnt;
-      for (;;) {
-        hal.watchdog_refresh();
-        if (!HAL_SD_ConfigWideBusOperation(&hsd, SDIO_BUS_WIDE_4B)) break;  // some cards are only 1 bit wide so a pass here is not required
-        if (!--retry_Cnt) break;
-      }
-      if (!retry_Cnt) {  // wide bus failed, go back to one bit wide mode
-        hsd.State = (HAL_SD_StateTypeDef) 0;  // HAL_SD_STATE_RESET
-        SD_LowLevel_Init();
-        retry_Cnt = retryCnt;
-        for (;;) {
-          hal.watchdog_refresh();
-          status = (bool) HAL_SD_Init(&hsd);
-          if (!status) break;
-          if (!--retry_Cnt) return false;   // return failing status if retries are exhausted
-        }
-        go_to_transfer_speed();
-      }
-    #endif
-
-    return true;
-  }
-
   /**
-   * @brief Read or Write a block
-   * @details Read or Write a block with SDIO
+   * @brief Read or Write blocks
+   * @details Read or Write contiguous blocks with SDIO, in one transfer
    *
-   * @param block The block index
+   * @param block The first block index
    * @param src The data buffer source for a write
    * @param dst The data buffer destination for a read
+   * @param count The number of blocks
    *
    * @return true on success
    */
-  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst) {
+  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst, const uint16_t count=1) {
     if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return false;
 
     hal.watchdog_refresh();
@@ -332,12 +290,12 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     if (src) {
       hdma_sdio.Init.Direction = DMA_MEMORY_TO_PERIPH;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, 1);
+      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, count);
     }
     else {
       hdma_sdio.Init.Direction = DMA_PERIPH_TO_MEMORY;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1);
+      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, count);
     }
 
     if (ret != HAL_OK) {
@@ -368,18 +326,76 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     return true;
   }
 
+  bool SDIO_Init() {
+    uint8_t retryCnt = SDIO_READ_RETRIES;
+
+    bool status;
+    hsd.Instance = SDIO;
+    hsd.State = HAL_SD_STATE_RESET;
+
+    SD_LowLevel_Init();
+
+    uint8_t retry_Cnt = retryCnt;
+    for (;;) {
+      hal.watchdog_refresh();
+      status = (bool) HAL_SD_Init(&hsd);
+      if (!status) break;
+      if (!--retry_Cnt) return false;   // return failing status if retries are exhausted
+    }
+
+    go_to_transfer_speed();
+
+    hsd.Init.ClockPowerSave = SDIO_CLOCK_POWER_SAVE_ENABLE;
+    hsd.Init.ClockDiv = SDIO_SAFE_CLOCK_DIV;
+
+    #if PINS_EXIST(SDIO_D1, SDIO_D2, SDIO_D3) // go to 4 bit wide mode if pins are defined
+      retry_Cnt = retryCnt;
+      for (;;) {
+        hal.watchdog_refresh();
+        if (!HAL_SD_ConfigWideBusOperation(&hsd, SDIO_BUS_WIDE_4B)) break;  // some cards are only 1 bit wide so a pass here is not required
+        if (!--retry_Cnt) break;
+      }
+      if (retry_Cnt) {  // The bus was negotiated at the safe clock. Go back up to the transfer clock.
+        hsd.Init.BusWide = SDIO_BUS_WIDE_4B;
+        go_to_transfer_speed();
+      }
+      else {  // wide bus failed, go back to one bit wide mode
+        hsd.State = (HAL_SD_StateTypeDef) 0;  // HAL_SD_STATE_RESET
+        SD_LowLevel_Init();
+        retry_Cnt = retryCnt;
+        for (;;) {
+          hal.watchdog_refresh();
+          status = (bool) HAL_SD_Init(&hsd);
+          if (!status) break;
+          if (!--retry_Cnt) return false;   // return failing status if retries are exhausted
+        }
+        go_to_transfer_speed();
+      }
+    #endif
+
+    // Cards or wiring that can't keep up with the transfer clock get the safe clock
+    uint32_t buf[512 / 4];
+    if (!SDIO_ReadWriteBlock_DMA(0, nullptr, (uint8_t*)buf)) {
+      hsd.Init.ClockDiv = SDIO_SAFE_CLOCK_DIV;
+      SDIO_Init(hsd.Instance, hsd.Init);
+    }
+
+    return true;
+  }
+
 #endif // !SDIO_FOR_STM32H7
 
 /**
- * @brief Read a block
- * @details Read a block from media with SDIO
+ * @brief Read blocks
+ * @details Read contiguous blocks from media with one SDIO transfer
  *
- * @param block The block index
- * @param src The block buffer
+ * @param block The first block index
+ * @param dst The buffer for all the blocks
+ * @param count The number of blocks
  *
  * @return true on success
  */
-bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
+bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, const uint16_t count) {
   #ifdef SDIO_FOR_STM32H7
 
     uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
@@ -388,7 +404,7 @@ bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
       if (HAL_GetTick() >= timeout) return false;
 
     waitingRxCplt = 1;
-    if (HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1) != HAL_OK)
+    if (HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, count) != HAL_OK)
       return false;
 
     timeout = HAL_GetTick() + SD_TIMEOUT;
@@ -400,12 +416,23 @@ bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
   #else
 
     uint8_t retries = SDIO_READ_RETRIES;
-    while (retries--) if (SDIO_ReadWriteBlock_DMA(block, nullptr, dst)) return true;
+    while (retries--) if (SDIO_ReadWriteBlock_DMA(block, nullptr, dst, count)) return true;
     return false;
 
   #endif
 }
 
+/**
+ * @brief Read a block
+ * @details Read a block from media with SDIO
+ *
+ * @param block The block index
+ * @param src The block buffer
+ *
+ * @return true on success
+ */
+bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) { return SDIO_ReadBlocks(block, dst, 1); }
+
 /**
  * @brief Write a block
  * @details Write a block to media with SDIO
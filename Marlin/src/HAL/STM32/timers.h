@@ -71,10 +71,10 @@ extern void Step_Handler();
 extern void Temp_Handler();
 
 #ifndef HAL_STEP_TIMER_ISR
-  #define HAL_STEP_TIMER_ISR() void Step_Handler()
+  #define HAL_STEP_TIMER_ISR() HAL_RAMFUNC void Step_Handler()
 #endif
 #ifndef HAL_TEMP_TIMER_ISR
-  #define HAL_TEMP_TIMER_ISR() void Temp_Handler()
+  #define HAL_TEMP_TIMER_ISR() HAL_RAMFUNC void Temp_Handler()
 #endif
 
 // ------------------------
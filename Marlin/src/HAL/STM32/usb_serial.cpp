@@ -26,6 +26,22 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
+#if ENABLED(USB_CDC_BULK_RX)
+
+#include "usb_serial.h"
+
+USBBulkSerial usbBulkSerial;
+
+void USBBulkSerial::fill() {
+  // Up to the end of the ring, since readBytes() copies to one place
+  const uint16_t h = head & (USB_CDC_RX_BUFFER_SIZE - 1);
+  uint16_t n = _MIN(room(), uint16_t(USB_CDC_RX_BUFFER_SIZE - h));
+  NOMORE(n, uint16_t(SerialUSB.available()));
+  if (n) head += SerialUSB.readBytes((char*)&buffer[h], n);
+}
+
+#endif // USB_CDC_BULK_RX
+
 #if ENABLED(EMERGENCY_PARSER) && ANY(USBD_USE_CDC, USBD_USE_CDC_MSC)
 
 #include "usb_serial.h"
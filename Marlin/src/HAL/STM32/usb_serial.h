@@ -22,3 +22,47 @@
 #pragma once
 
 void USB_Hook_init();
+
+#if ENABLED(USB_CDC_BULK_RX)
+
+  #include <USBSerial.h>
+
+  /**
+   * SerialUSB with reads served from a ring filled a whole USB packet at a time.
+   * Each fill copies all the bytes in the core's receive queue with one readBytes(),
+   * so the endpoint is rearmed at once instead of after a read() per byte. Nothing
+   * is taken while the ring has no room, so the core's queue fills and the endpoint
+   * NAKs the host until Marlin catches up.
+   */
+  class USBBulkSerial {
+    public:
+      void begin(const long br) { head = tail = 0; SerialUSB.begin(br); }
+      void end()                { SerialUSB.end(); }
+      void flush()              { SerialUSB.flush(); }
+      size_t write(const uint8_t c) { return SerialUSB.write(c); }
+      size_t write(const uint8_t *buffer, size_t size) { return SerialUSB.write(buffer, size); }
+      explicit operator bool()  { return bool(SerialUSB); }
+
+      int available() {
+        if (room() >= CDC_PACKET_SIZE) fill();
+        return used();
+      }
+
+      int read() {
+        if (!used()) fill();
+        return used() ? buffer[tail++ & (USB_CDC_RX_BUFFER_SIZE - 1)] : -1;
+      }
+
+    private:
+      static constexpr uint16_t CDC_PACKET_SIZE = 64;
+      uint8_t buffer[USB_CDC_RX_BUFFER_SIZE];
+      uint16_t head, tail;    // Free-running, masked on use
+
+      uint16_t used() const { return uint16_t(head - tail); }
+      uint16_t room() const { return USB_CDC_RX_BUFFER_SIZE - used(); }
+      void fill();
+  };
+
+  extern USBBulkSerial usbBulkSerial;
+
+#endif
@@ -39,6 +39,24 @@
   #error "SERIAL_STATS_DROPPED_RX is not supported on the STM32F1 platform."
 #endif
 
+#if ENABLED(STEP_DMA_STREAM)
+  #ifndef STM32_HIGH_DENSITY
+    #error "STEP_DMA_STREAM requires DMA2, only found on high density STM32F1 (e.g., STM32F103RE)."
+  #elif MF_TIMER_STEP != 5
+    #error "STEP_DMA_STREAM requires the Stepper timer to be Timer 5 (MF_TIMER_STEP 5)."
+  #elif MULTISTEPPING_LIMIT != 1
+    #error "STEP_DMA_STREAM requires MULTISTEPPING_LIMIT 1."
+  #elif ANY(FT_MOTION, HAS_ZV_SHAPING, SMOOTH_LIN_ADVANCE)
+    #error "STEP_DMA_STREAM is not compatible with FT_MOTION, INPUT_SHAPING_* or SMOOTH_LIN_ADVANCE."
+  #elif ENABLED(EDGE_STEPPING) && HAS_TRINAMIC_CONFIG
+    #error "STEP_DMA_STREAM is not compatible with EDGE_STEPPING."
+  #elif 1000000000UL / (STEP_DMA_STREAM_RATE) < MINIMUM_STEPPER_PULSE_NS
+    #error "STEP_DMA_STREAM_RATE is too high for MINIMUM_STEPPER_PULSE_NS."
+  #elif !WITHIN(STEP_DMA_STREAM_RATE, 20000, 500000)
+    #error "STEP_DMA_STREAM_RATE must be between 20000 and 500000."
+  #endif
+#endif
+
 #if ENABLED(NEOPIXEL_LED) && DISABLED(FYSETC_MINI_12864_2_1)
   #error "NEOPIXEL_LED (Adafruit NeoPixel) is not supported for HAL/STM32F1. Comment out this line to proceed at your own risk!"
 #endif
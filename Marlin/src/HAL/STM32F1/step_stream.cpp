@@ -0,0 +1,191 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __STM32F1__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_DMA_STREAM)
+
+#include "step_stream.h"
+#include "../../module/stepper.h"
+
+#include <libmaple/dma.h>
+#include <libmaple/nvic.h>
+
+#if ENABLED(BABYSTEPPING)
+  #include "../../feature/babystep.h"
+#endif
+
+#define HALF_SAMPLES ((STEP_STREAM_SAMPLES) / 2)
+#define CARRY_SAMPLES 8   // Room for the samples pushed by the last event of a half
+
+uint32_t step_stream_bsrr[2], step_stream_odr[2];
+bool step_stream_dir_changed;
+
+static uint32_t buffer[2][STEP_STREAM_SAMPLES], // The samples played by DMA, one array per port
+                carry[2][CARRY_SAMPLES];        // Samples pushed past the end of the half being filled
+static uint16_t fill_pos, fill_end;             // The next sample to fill and the end of the half
+static uint8_t carry_count;
+static bool awake;
+
+void step_stream_push_sample() {
+  if (fill_pos < fill_end) {
+    buffer[0][fill_pos] = step_stream_bsrr[0];
+    buffer[1][fill_pos] = step_stream_bsrr[1];
+    fill_pos++;
+  }
+  else if (carry_count < CARRY_SAMPLES) {
+    carry[0][carry_count] = step_stream_bsrr[0];
+    carry[1][carry_count] = step_stream_bsrr[1];
+    carry_count++;
+  }
+  step_stream_bsrr[0] = step_stream_bsrr[1] = 0;
+  step_stream_dir_changed = false;
+}
+
+// Samples with no edges, up to the end of the half
+static void push_idle(uint32_t count) {
+  NOMORE(count, uint32_t(fill_end - fill_pos));
+  memset(&buffer[0][fill_pos], 0, count * sizeof(uint32_t));
+  memset(&buffer[1][fill_pos], 0, count * sizeof(uint32_t));
+  fill_pos += count;
+}
+
+/**
+ * Fill the half of the buffer that just played, as Stepper::isr() would run
+ * the phases, but with each interval taken as samples instead of timer ticks.
+ */
+void step_stream_fill() {
+  static hal_timer_t nextMainISR = 0;   // Samples until the next Pulse / Block phase
+  static uint32_t wait = 0;             // Samples until the next phase of any kind
+
+  // The half not being played, by the count of transfers left in the circular buffer
+  fill_pos = dma_channel_regs(DMA2, DMA_CH2)->CNDTR > HALF_SAMPLES ? HALF_SAMPLES : 0;
+  fill_end = fill_pos + HALF_SAMPLES;
+
+  // Samples pushed past the end of the last half are played first
+  for (uint8_t i = 0; i < carry_count; ++i) {
+    buffer[0][fill_pos] = carry[0][i];
+    buffer[1][fill_pos] = carry[1][i];
+    fill_pos++;
+  }
+  carry_count = 0;
+
+  // While the stepper is suspended the stream only marks time
+  if (!awake) { push_idle(HALF_SAMPLES); return; }
+
+  while (fill_pos < fill_end) {
+
+    if (wait) {
+      const uint32_t n = _MIN(wait, uint32_t(fill_end - fill_pos));
+      push_idle(n);
+      wait -= n;
+      continue;
+    }
+
+    const uint32_t start = fill_pos + carry_count;
+
+    if (!nextMainISR) stepper.pulse_phase_isr();
+
+    #if ENABLED(LIN_ADVANCE)
+      if (!stepper.nextAdvanceISR) {
+        stepper.advance_isr();
+        stepper.nextAdvanceISR = stepper.la_interval;
+      }
+      else if (stepper.nextAdvanceISR > stepper.la_interval)
+        stepper.nextAdvanceISR = stepper.la_interval;
+    #endif
+
+    #if ENABLED(BACKLASH_STEPPER)
+      if (!stepper.nextBacklashISR) stepper.nextBacklashISR = stepper.backlash_isr();
+    #endif
+
+    #if ENABLED(BABYSTEPPING)
+      const bool is_babystep = (stepper.nextBabystepISR == 0);
+      if (is_babystep) stepper.nextBabystepISR = stepper.babystepping_isr();
+    #endif
+
+    if (!nextMainISR) nextMainISR = stepper.block_phase_isr();
+
+    #if ENABLED(BABYSTEPPING)
+      if (is_babystep) NOLESS(nextMainISR, (BABYSTEP_TICKS) / 8);
+      if (stepper.nextBabystepISR != stepper.BABYSTEP_NEVER) NOLESS(stepper.nextBabystepISR, nextMainISR / 2);
+    #endif
+
+    uint32_t interval = nextMainISR;
+    TERN_(LIN_ADVANCE, NOMORE(interval, stepper.nextAdvanceISR));
+    TERN_(BACKLASH_STEPPER, NOMORE(interval, stepper.nextBacklashISR));
+    TERN_(BABYSTEPPING, NOMORE(interval, stepper.nextBabystepISR));
+
+    nextMainISR -= interval;
+    TERN_(LIN_ADVANCE, if (stepper.nextAdvanceISR != stepper.LA_ADV_NEVER) stepper.nextAdvanceISR -= interval);
+    TERN_(BACKLASH_STEPPER, if (stepper.nextBacklashISR != stepper.BACKLASH_NEVER) stepper.nextBacklashISR -= interval);
+    TERN_(BABYSTEPPING, if (stepper.nextBabystepISR != stepper.BABYSTEP_NEVER) stepper.nextBabystepISR -= interval);
+
+    // The samples pushed by the phases are part of the interval. Always play at least one.
+    const uint32_t used = fill_pos + carry_count - start;
+    if (interval > used) wait = interval - used;
+    else if (!used) step_stream_push_sample();
+  }
+}
+
+void step_stream_awake(const bool on) { awake = on; }
+bool step_stream_is_awake() { return awake; }
+
+void step_stream_init() {
+  timer_dev * const tim = STEP_TIMER_DEV;
+  const uint16_t reload = (HAL_TIMER_RATE) / (STEPPER_TIMER_RATE) - 1;
+
+  timer_pause(tim);
+  timer_set_prescaler(tim, 0);
+  timer_set_reload(tim, reload);
+  timer_set_count(tim, 0);
+  timer_set_mode(tim, 1, TIMER_OUTPUT_COMPARE);
+  timer_oc_set_mode(tim, 1, TIMER_OC_MODE_FROZEN, TIMER_OC_NO_PRELOAD); // No output pin change
+  timer_set_compare(tim, 1, reload / 2);  // The second port is written half a sample after the first
+  timer_generate_update(tim);             // Load the prescaler before any DMA request is enabled
+
+  // Start with every sample empty
+  memset(buffer, 0, sizeof(buffer));
+
+  dma_init(DMA2);
+  // TIM5_UP requests DMA2 channel 2, TIM5_CH1 requests DMA2 channel 5
+  dma_setup_transfer(DMA2, DMA_CH2, &STEP_STREAM_GPIO1->regs->BSRR, DMA_SIZE_32BITS,
+                     buffer[0], DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_CIRC_MODE | DMA_FROM_MEM | DMA_HALF_TRNS | DMA_TRNS_CMPLT);
+  dma_setup_transfer(DMA2, DMA_CH5, &STEP_STREAM_GPIO2->regs->BSRR, DMA_SIZE_32BITS,
+                     buffer[1], DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_CIRC_MODE | DMA_FROM_MEM);
+  dma_set_num_transfers(DMA2, DMA_CH2, STEP_STREAM_SAMPLES);
+  dma_set_num_transfers(DMA2, DMA_CH5, STEP_STREAM_SAMPLES);
+  dma_set_priority(DMA2, DMA_CH2, DMA_PRIORITY_VERY_HIGH);
+  dma_set_priority(DMA2, DMA_CH5, DMA_PRIORITY_VERY_HIGH);
+  dma_attach_interrupt(DMA2, DMA_CH2, step_stream_fill);
+  nvic_irq_set_priority(NVIC_DMA2_CH2, STEP_TIMER_IRQ_PRIO);
+  dma_enable(DMA2, DMA_CH2);
+  dma_enable(DMA2, DMA_CH5);
+
+  timer_dma_enable_upd_req(tim);
+  timer_dma_enable_req(tim, 1);
+  timer_resume(tim);
+}
+
+#endif // STEP_DMA_STREAM
+#endif // __STM32F1__
@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * DMA step stream for STM32F1 (STEP_DMA_STREAM)
+ *
+ * The stepper timer runs at a fixed sample rate (STEPPER_TIMER_RATE) and on
+ * every tick DMA2 writes one word from a circular buffer to the BSRR register
+ * of each streamed GPIO port: the update event for the first port, the CH1
+ * compare event half a tick later for the second. STEP and DIR writes set bits
+ * in the sample being built instead of the pins, so every edge is played at
+ * its exact tick and a STEP pulse lasts one sample.
+ *
+ * The DMA half / complete interrupt runs the Stepper phases to fill the half
+ * that just played, jumping over the samples between events, so the CPU is
+ * interrupted once per half buffer instead of once or twice per step.
+ *
+ * Pins on other ports are written directly, at the time they are buffered.
+ */
+
+#include <libmaple/gpio.h>
+
+#ifndef STEP_STREAM_GPIO1
+  #define STEP_STREAM_GPIO1 GPIOB
+#endif
+#ifndef STEP_STREAM_GPIO2
+  #define STEP_STREAM_GPIO2 GPIOC
+#endif
+#ifndef STEP_STREAM_SAMPLES
+  #define STEP_STREAM_SAMPLES 256   // Samples in the whole buffer, played in two halves
+#endif
+
+// BSRR words for the next sample, and the pin states they leave (for READ)
+extern uint32_t step_stream_bsrr[2], step_stream_odr[2];
+// A DIR pin changed in the next sample, so a STEP edge has to wait for the one after
+extern bool step_stream_dir_changed;
+
+void step_stream_init();
+void step_stream_push_sample();
+void step_stream_awake(const bool awake);
+bool step_stream_is_awake();
+
+// The streamed port of a pin (0 or 1) or -1 if the pin is written directly
+FORCE_INLINE int8_t step_stream_port(const pin_t pin) {
+  const gpio_dev * const dev = PIN_MAP[pin].gpio_device;
+  return dev == STEP_STREAM_GPIO1 ? 0 : dev == STEP_STREAM_GPIO2 ? 1 : -1;
+}
+
+FORCE_INLINE void step_stream_write(const pin_t pin, const bool v, const bool is_dir) {
+  const int8_t p = step_stream_port(pin);
+  if (p < 0) { WRITE(pin, v); return; }
+
+  const uint32_t bit = _BV32(PIN_MAP[pin].gpio_bit),
+                 set = v ? bit : bit << 16, undo = v ? bit << 16 : bit;
+
+  // An edge undoing one in the same sample (a pulse with no gap) or a STEP edge
+  // right after a DIR change goes in the next sample so the driver sees both.
+  if ((step_stream_bsrr[p] & undo) || (!is_dir && step_stream_dir_changed)) step_stream_push_sample();
+
+  step_stream_bsrr[p] |= set;
+  if (v) step_stream_odr[p] |= bit; else step_stream_odr[p] &= ~bit;
+  if (is_dir) step_stream_dir_changed = true;
+}
+
+FORCE_INLINE bool step_stream_read(const pin_t pin) {
+  const int8_t p = step_stream_port(pin);
+  return p < 0 ? bool(READ(pin)) : TEST32(step_stream_odr[p], PIN_MAP[pin].gpio_bit);
+}
@@ -98,8 +98,14 @@ typedef uint16_t hal_timer_t;
 #define TEMP_TIMER_PRESCALE     1000 // prescaler for setting Temp timer, 72Khz
 #define TEMP_TIMER_FREQUENCY    1000 // temperature interrupt frequency
 
-#define STEPPER_TIMER_PRESCALE      18                                          // prescaler for setting stepper timer, 4Mhz
-#define STEPPER_TIMER_RATE          (HAL_TIMER_RATE / STEPPER_TIMER_PRESCALE)   // frequency of stepper timer
+#if ENABLED(STEP_DMA_STREAM)
+  // The stepper timer clocks the DMA step stream, one tick per sample
+  #define STEPPER_TIMER_PRESCALE    1
+  #define STEPPER_TIMER_RATE        (HAL_TIMER_RATE / ((HAL_TIMER_RATE) / (STEP_DMA_STREAM_RATE)))
+#else
+  #define STEPPER_TIMER_PRESCALE    18                                          // prescaler for setting stepper timer, 4Mhz
+  #define STEPPER_TIMER_RATE        (HAL_TIMER_RATE / STEPPER_TIMER_PRESCALE)   // frequency of stepper timer
+#endif
 #define STEPPER_TIMER_TICKS_PER_US  ((STEPPER_TIMER_RATE) / 1000000)            // stepper timer ticks per µs
 
 #define PULSE_TIMER_RATE            STEPPER_TIMER_RATE   // frequency of pulse timer
@@ -111,9 +117,18 @@ timer_dev* HAL_get_timer_dev(int number);
 #define STEP_TIMER_DEV TIMER_DEV(MF_TIMER_STEP)
 #define TEMP_TIMER_DEV TIMER_DEV(MF_TIMER_TEMP)
 
-#define ENABLE_STEPPER_DRIVER_INTERRUPT() timer_enable_irq(STEP_TIMER_DEV, STEP_TIMER_CHAN)
-#define DISABLE_STEPPER_DRIVER_INTERRUPT() timer_disable_irq(STEP_TIMER_DEV, STEP_TIMER_CHAN)
-#define STEPPER_ISR_ENABLED() HAL_timer_interrupt_enabled(MF_TIMER_STEP)
+#if ENABLED(STEP_DMA_STREAM)
+  // The stream keeps playing, with no steps while the Stepper is suspended
+  void step_stream_awake(const bool awake);
+  bool step_stream_is_awake();
+  #define ENABLE_STEPPER_DRIVER_INTERRUPT() step_stream_awake(true)
+  #define DISABLE_STEPPER_DRIVER_INTERRUPT() step_stream_awake(false)
+  #define STEPPER_ISR_ENABLED() step_stream_is_awake()
+#else
+  #define ENABLE_STEPPER_DRIVER_INTERRUPT() timer_enable_irq(STEP_TIMER_DEV, STEP_TIMER_CHAN)
+  #define DISABLE_STEPPER_DRIVER_INTERRUPT() timer_disable_irq(STEP_TIMER_DEV, STEP_TIMER_CHAN)
+  #define STEPPER_ISR_ENABLED() HAL_timer_interrupt_enabled(MF_TIMER_STEP)
+#endif
 
 #define ENABLE_TEMPERATURE_INTERRUPT() timer_enable_irq(TEMP_TIMER_DEV, TEMP_TIMER_CHAN)
 #define DISABLE_TEMPERATURE_INTERRUPT() timer_disable_irq(TEMP_TIMER_DEV, TEMP_TIMER_CHAN)
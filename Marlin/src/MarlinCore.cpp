@@ -164,6 +164,10 @@
   #include "feature/spindle_laser.h"
 #endif
 
+#if ENABLED(SD_JOB_QUEUE)
+  #include "feature/job_queue.h"
+#endif
+
 #if HAS_MEDIA
   CardReader card;
 #endif
@@ -231,6 +235,32 @@
   #include "feature/fancheck.h"
 #endif
 
+#if ENABLED(PLANNER_MONITOR)
+  #include "feature/planner_monitor.h"
+#endif
+
+#if ENABLED(BINARY_TELEMETRY)
+  #include "feature/telemetry.h"
+#endif
+
+#if ENABLED(LOOP_LATENCY_MONITOR)
+  #include "feature/loop_latency.h"
+#endif
+
+#if ENABLED(BOOT_PROFILER)
+  #include "feature/boot_profile.h"
+#endif
+
+#if ENABLED(MEMORY_MONITOR)
+  #include "feature/mem_monitor.h"
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #include "feature/idle_tasks.h"
+#else
+  #define IDLE_TASK(T, SEL, V...) do{ V; }while(0)
+#endif
+
 #if ENABLED(USE_CONTROLLER_FAN)
   #include "feature/controllerfan.h"
 #endif
@@ -374,6 +404,7 @@ void startOrResumeJob() {
     TERN_(CANCEL_OBJECTS, cancelable.reset());
     TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
     TERN_(SET_REMAINING_TIME, ui.reset_remaining_time());
+    TERN_(PLANNER_TIME_ESTIMATE, planner.reset_print_time());
     TERN_(HAS_PRUSA_MMU3, MMU3::operation_statistics.reset_per_print_stats());
   }
   print_job_timer.start();
@@ -383,6 +414,7 @@ void startOrResumeJob() {
 
   inline void abortSDPrinting() {
     IF_DISABLED(NO_SD_AUTOSTART, card.autofile_cancel());
+    TERN_(SD_JOB_QUEUE, jobqueue.stop()); // An aborted job stops the queue
     card.abortFilePrintNow(TERN_(SD_RESORT, true));
 
     queue.clear();
@@ -396,6 +428,8 @@ void startOrResumeJob() {
 
     wait_for_heatup = false;
 
+    TERN_(ADVANCED_PAUSE_NONBLOCKING, pause_wait_abort());
+
     TERN_(POWER_LOSS_RECOVERY, recovery.purge());
 
     #ifdef EVENT_GCODE_SD_ABORT
@@ -733,6 +767,12 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
 
   TERN_(MONITOR_DRIVER_STATUS, monitor_tmc_drivers());
 
+  TERN_(HYBRID_THRESHOLD_LOOKAHEAD, tmc_hybrid_lookahead());
+
+  TERN_(TMC_STALL_DETECT, tmc_stall_detect());
+
+  TERN_(TMC_CRUISE_CURRENT, tmc_cruise_current());
+
   // Limit check_axes_activity frequency to 10Hz
   static millis_t next_check_axes_ms = 0;
   if (ELAPSED(ms, next_check_axes_ms)) {
@@ -770,6 +810,7 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Handle USB Flash Drive insert / remove
  *  - Announce Host Keepalive state (if any)
  *  - Update the Print Job Timer state
+ *  - Update the Planner Monitor counts
  *  - Update the Beeper queue
  *  - Read Buttons and Update the LCD
  *  - Run i2c Position Encoders
@@ -787,14 +828,22 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
   #endif
 
+  TERN_(LOOP_LATENCY_MONITOR, loop_latency.tick(LATENCY_IDLE));
+
+  // Plan a pending segment batch so the stepper isn't held up while idle
+  TERN_(PLANNER_SEGMENT_BATCH, planner.flush_segments());
+
+  // The one periodic task to run in this call
+  TERN_(IDLE_TASK_SCHEDULER, IdleTaskID idle_task = IDLE_TASK_COUNT);
+
   // Bed Distance Sensor task
   TERN_(BD_SENSOR, bdl.process());
 
   // Core Marlin activities
-  manage_inactivity(no_stepper_sleep);
+  IDLE_TASK(INACTIVITY, idle_task, manage_inactivity(no_stepper_sleep));
 
   // Manage Heaters (and Watchdog)
-  thermalManager.task();
+  IDLE_TASK(THERMAL, idle_task, thermalManager.task());
 
   // Max7219 heartbeat, animation, etc
   TERN_(MAX7219_DEBUG, max7219.idle_tasks());
@@ -802,20 +851,24 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Return if setup() isn't completed
   if (marlin_state == MarlinState::MF_INITIALIZING) goto IDLE_DONE;
 
+  TERN_(IDLE_TASK_SCHEDULER, idle_task = idle_tasks.select());
+
   // TODO: Still causing errors
   TERN_(TOOL_SENSOR, (void)check_tool_sensor_stats(active_extruder, true));
 
   // Handle filament runout sensors
   #if HAS_FILAMENT_SENSOR
     if (TERN1(HAS_PRUSA_MMU2, !mmu2.enabled()) && TERN1(HAS_PRUSA_MMU3, !mmu3.enabled()))
-      runout.run();
+      IDLE_TASK(RUNOUT, idle_task, runout.run());
   #endif
 
   // Run HAL idle tasks
-  hal.idletask();
+  IDLE_TASK(HAL, idle_task, hal.idletask());
 
   // Check network connection
-  TERN_(HAS_ETHERNET, ethernet.check());
+  #if HAS_ETHERNET
+    IDLE_TASK(NETWORK, idle_task, ethernet.check());
+  #endif
 
   // Handle Power-Loss Recovery
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
@@ -829,22 +882,32 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #endif
 
   // Handle SD Card insert / remove
-  TERN_(HAS_MEDIA, card.manage_media());
+  #if HAS_MEDIA
+    IDLE_TASK(MEDIA, idle_task, card.manage_media());
+  #endif
+
+  // Fill the SD read-ahead buffers
+  TERN_(SD_READ_AHEAD, card.read_ahead());
 
   // Announce Host Keepalive state (if any)
   TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
 
   // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+  #if ENABLED(PRINTCOUNTER)
+    IDLE_TASK(TIMER, idle_task, print_job_timer.tick());
+  #endif
+
+  // Roll over the per-second planner counts
+  TERN_(PLANNER_MONITOR, planner_monitor.tick());
 
   // Update the Beeper queue
   TERN_(HAS_BEEPER, buzzer.tick());
 
   // Handle UI input / draw events
   #if ENABLED(SOVOL_SV06_RTS)
-    RTS_Update();
+    IDLE_TASK(UI, idle_task, TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(UI)); RTS_Update());
   #else
-    ui.update();
+    IDLE_TASK(UI, idle_task, TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(UI)); ui.update());
   #endif
 
   // Run i2c Position Encoders
@@ -861,15 +924,29 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   }
   #endif
 
+  // Write saved settings to flash, erasing only while no moves are queued
+  TERN_(FLASH_EEPROM_JOURNAL, persistentStore.journal_task(!planner.has_blocks_queued()));
+
+  // Write changed EEPROM pages, one per call
+  TERN_(EEPROM_BACKGROUND_WRITE, BL24CXX::task());
+
+  // Send an "ok" held back too long
+  TERN_(OK_COALESCE, queue.flush_ok(false));
+
+  // Send a partial line of output
+  TERN_(SERIAL_LINE_BUFFER, SERIAL_IMPL.flushLine());
+
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
+    if (!gcode.autoreport_paused) IDLE_TASK(REPORT, idle_task,
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(PLANNER_MONITOR, planner_monitor.auto_reporter.tick());
+      TERN_(BINARY_TELEMETRY, telemetry.auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
-    }
+    );
   #endif
 
   // Update the Průša MMU2
@@ -890,6 +967,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Direct Stepping
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
 
+  // Apply a feedrate override to the queued moves
+  TERN_(FEEDRATE_OVERRIDE_REPLAN, planner.apply_feedrate_override());
+
   // Update the LVGL interface
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
 
@@ -1152,6 +1232,8 @@ inline void tmc_standby_setup() {
  *  - Set Marlin to RUNNING State
  */
 void setup() {
+  TERN_(MEMORY_MONITOR, mem_monitor.paint()); // Before anything can use the free RAM
+
   #ifdef FASTIO_INIT
     FASTIO_INIT();
   #endif
@@ -1166,11 +1248,14 @@ void setup() {
   const byte mcu = hal.get_reset_source();
   hal.clear_reset_source();
 
-  #if ENABLED(MARLIN_DEV_MODE)
+  #if ANY(MARLIN_DEV_MODE, BOOT_PROFILER)
     auto log_current_ms = [&](PGM_P const msg) {
-      SERIAL_ECHO_START();
-      TSS('[', millis(), F("] ")).echo();
-      SERIAL_ECHOLNPGM_P(msg);
+      TERN_(BOOT_PROFILER, boot_profile.step(msg));
+      #if ENABLED(MARLIN_DEV_MODE)
+        SERIAL_ECHO_START();
+        TSS('[', millis(), F("] ")).echo();
+        SERIAL_ECHOLNPGM_P(msg);
+      #endif
     };
     #define SETUP_LOG(M) log_current_ms(PSTR(M))
   #else
@@ -1178,14 +1263,12 @@ void setup() {
   #endif
   #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
 
+  TERN_(BOOT_PROFILER, boot_profile.step(PSTR("serial connect")));
+
   MYSERIAL1.begin(BAUDRATE);
-  millis_t serial_connect_timeout = millis() + 1000UL;
-  while (!MYSERIAL1.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
 
   #if ENABLED(SOVOL_SV06_RTS)
     LCD_SERIAL.begin(BAUDRATE);
-    serial_connect_timeout = millis() + 1000UL;
-    while (!LCD_SERIAL.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
   #endif
 
   #if HAS_MULTI_SERIAL && !HAS_ETHERNET
@@ -1193,17 +1276,30 @@ void setup() {
       #define BAUDRATE_2 BAUDRATE
     #endif
     MYSERIAL2.begin(BAUDRATE_2);
-    serial_connect_timeout = millis() + 1000UL;
-    while (!MYSERIAL2.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
     #ifdef SERIAL_PORT_3
       #ifndef BAUDRATE_3
         #define BAUDRATE_3 BAUDRATE
       #endif
       MYSERIAL3.begin(BAUDRATE_3);
-      serial_connect_timeout = millis() + 1000UL;
-      while (!MYSERIAL3.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
     #endif
   #endif
+
+  // Wait for all ports together, up to 1s in all instead of 1s for each
+  auto serial_connected = []{
+    return MYSERIAL1.connected()
+      #if ENABLED(SOVOL_SV06_RTS)
+        && LCD_SERIAL.connected()
+      #endif
+      #if HAS_MULTI_SERIAL && !HAS_ETHERNET
+        && MYSERIAL2.connected()
+        #ifdef SERIAL_PORT_3
+          && MYSERIAL3.connected()
+        #endif
+      #endif
+    ;
+  };
+  const millis_t serial_connect_timeout = millis() + 1000UL;
+  while (!serial_connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
   SERIAL_ECHOLNPGM("start");
 
   // Set up these pins early to prevent suicide
@@ -1321,7 +1417,7 @@ void setup() {
   SERIAL_ECHO_MSG(STR_FREE_MEMORY, hal.freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(block_t) * (BLOCK_BUFFER_SIZE));
 
   // Some HAL need precise delay adjustment
-  calibrate_delay_loop();
+  SETUP_RUN(calibrate_delay_loop());
 
   // Init buzzer pin(s)
   #if HAS_BEEPER
@@ -1362,7 +1458,7 @@ void setup() {
 
   #if HAS_MEDIA
     SETUP_RUN(card.init());           // Prepare for media usage
-    #if ANY(SDCARD_EEPROM_EMULATION, POWER_LOSS_RECOVERY)
+    #if ENABLED(SDCARD_EEPROM_EMULATION) || (ENABLED(POWER_LOSS_RECOVERY) && DISABLED(SD_ASYNC_MOUNT))
       SETUP_RUN(card.mount());        // Mount media with settings before first_load
     #endif
   #endif
@@ -1380,6 +1476,10 @@ void setup() {
   SETUP_RUN(settings.first_load());   // Load data from EEPROM if available (or use defaults)
                                       // This also updates variables in the planner, elsewhere
 
+  #if ENABLED(BUFFER_ARENA)
+    SETUP_RUN(planner.apply_arena()); // Split the block buffer between the planner and command queue
+  #endif
+
   #if ENABLED(CONFIGURABLE_MACHINE_NAME)
     SETUP_RUN(ui.reset_status(false)); // machine_name Initialized by settings.load()
   #endif
@@ -1638,6 +1738,7 @@ void setup() {
   #endif
 
   #if ENABLED(IIC_BL24CXX_EEPROM)
+    SETUP_LOG("BL24CXX::check()");
     BL24CXX::init();
     const uint8_t err = BL24CXX::check();
     SERIAL_ECHO_TERNARY(err, "BL24CXX Check ", "failed", "succeeded", "!\n");
@@ -1739,8 +1840,16 @@ void loop() {
       if (marlin_state == MarlinState::MF_SD_COMPLETE) finishSDPrinting();
     #endif
 
+    TERN_(ADVANCED_PAUSE_NONBLOCKING, pause_wait_update());
+
     queue.advance();
 
+    // Don't hold a merged move while waiting for more commands
+    TERN_(SEGMENT_MERGE, if (!queue.has_commands_queued()) flush_segment_merge());
+
+    // Nor a retract
+    TERN_(FWRETRACT_BLEND, if (!queue.has_commands_queued()) fwretract.flush_retract());
+
     #if ANY(POWER_OFF_TIMER, POWER_OFF_WAIT_FOR_COOLDOWN)
       powerManager.checkAutoPowerOff();
     #endif
@@ -398,7 +398,7 @@
 #define BOARD_CREALITY_V431_C         5047  // Creality v4.3.1c (STM32F103RC / STM32F103RE)
 #define BOARD_CREALITY_V431_D         5048  // Creality v4.3.1d (STM32F103RC / STM32F103RE)
 #define BOARD_CREALITY_V452           5049  // Creality v4.5.2 (STM32F103RC / STM32F103RE)
-#define BOARD_CREALITY_V453           5050  // Creality v4.5.3 (STM32F103RC / STM32F103RE)
+#define BOARD_CREALITY_V453           5050  // Creality v4.5.3 (STM32F103RC / STM32F103RE) ... GD32 Variant Below!
 #define BOARD_CREALITY_V521           5051  // Creality v5.2.1 (STM32F103VE) as found in the SV04
 #define BOARD_CREALITY_V24S1          5052  // Creality v2.4.S1 (STM32F103RC / STM32F103RE) CR-FDM-v2.4.S1_v101 as found in the Ender-7
 #define BOARD_CREALITY_V24S1_301      5053  // Creality v2.4.S1_301 (STM32F103RC / STM32F103RE) CR-FDM-v24S1_301 as found in the Ender-3 S1
@@ -568,6 +568,7 @@
 
 #define BOARD_CREALITY_V422_GD32_MFL  7400  // Creality V4.2.2 MFL (GD32F303RE) ... STM32 Variant Above!
 #define BOARD_CREALITY_V427_GD32_MFL  7401  // Creality V4.2.7 MFL (GD32F303RE) ... STM32 Variant Above!
+#define BOARD_CREALITY_V453_GD32_MFL  7402  // Creality V4.5.3 MFL (GD32F303RE) ... STM32 Variant Above!
 
 //
 // Raspberry Pi
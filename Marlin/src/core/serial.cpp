@@ -71,6 +71,11 @@ MAP(_N_LBL, LOGICAL_AXIS_NAMES); MAP(_SP_N_LBL, LOGICAL_AXIS_NAMES);
 
 #endif
 
+// Step 3: Collect the output into lines
+#if ENABLED(SERIAL_LINE_BUFFER)
+  SerialLineT lineSerial(_SERIAL_IMPL);
+#endif
+
 // Specializations for float, p_float_t, w_float_t
 template <> void SERIAL_ECHO(const float f)      { SERIAL_IMPL.print(f, SERIAL_FLOAT_PRECISION); }
 template <> void SERIAL_ECHO(const p_float_t pf) { SERIAL_IMPL.print(pf.value, pf.prec); }
@@ -89,6 +94,20 @@ void SERIAL_FLUSH()    { SERIAL_IMPL.flush(); }
 void SERIAL_FLUSHTX()  { SERIAL_IMPL.flushTX(); }
 
 void SERIAL_ECHO_P(PGM_P pstr) {
+  #if ENABLED(COMPRESSED_STRINGS)
+    // Expand the dictionary words in a compressed string
+    if (pgm_read_byte(pstr) == STRZ_MARK) {
+      while (const uint8_t c = pgm_read_byte(++pstr)) {
+        if (c == STRZ_ESC)
+          SERIAL_CHAR(pgm_read_byte(++pstr));
+        else if (c >= 0x80)
+          SERIAL_ECHO_P(&MarlinStrz::dict[pgm_read_word(&MarlinStrz::offsets.at[c - 0x80])]);
+        else
+          SERIAL_CHAR(c);
+      }
+      return;
+    }
+  #endif
   while (const char c = pgm_read_byte(pstr++)) SERIAL_CHAR(c);
 }
 void SERIAL_ECHOLN_P(PGM_P pstr) { SERIAL_ECHO_P(pstr); SERIAL_EOL(); }
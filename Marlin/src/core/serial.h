@@ -112,12 +112,21 @@ extern uint8_t marlin_debug_flags;
   #undef _S_MULTI
 
   extern SerialOutputT        multiSerial;
-  #define SERIAL_IMPL         multiSerial
+  #define _SERIAL_IMPL        multiSerial
 #else
   #define _PORT_REDIRECT(n,p) NOOP
   #define _PORT_RESTORE(n)    NOOP
   #define SERIAL_ASSERT(P)    NOOP
-  #define SERIAL_IMPL         SERIAL_LEAF_1
+  #define _SERIAL_IMPL        SERIAL_LEAF_1
+#endif
+
+// Step 3: Collect the output into lines, each written in one call
+#if ENABLED(SERIAL_LINE_BUFFER)
+  typedef LineBufferSerial<decltype(_SERIAL_IMPL), SERIAL_LINE_BUFFER_SIZE> SerialLineT;
+  extern SerialLineT lineSerial;
+  #define SERIAL_IMPL lineSerial
+#else
+  #define SERIAL_IMPL _SERIAL_IMPL
 #endif
 
 #define PORT_REDIRECT(p)   _PORT_REDIRECT(1,p)
@@ -185,12 +194,20 @@ void SERIAL_ECHOLN(T arg1, Args ... args) { SERIAL_ECHO(arg1); SERIAL_ECHO(args
 //                   all the odd loose string elements as PROGMEM strings.
 //
 
+// Literal strings in the macros below, compressed with COMPRESSED_STRINGS
+#if ENABLED(COMPRESSED_STRINGS)
+  #include "strz.h"
+  #define _SF(s) CF(s)
+#else
+  #define _SF(s) F(s)
+#endif
+
 // Print pairs of values. Odd elements must be literal strings.
 #define __SEP_N(N,V...)           _SEP_##N(V)
 #define _SEP_N(N,V...)            __SEP_N(N,V)
 #define _SEP_N_REF()              _SEP_N
-#define _SEP_1(s)                 SERIAL_ECHO(F(s));
-#define _SEP_2(s,v)               SERIAL_ECHO(F(s),v);
+#define _SEP_1(s)                 SERIAL_ECHO(_SF(s));
+#define _SEP_2(s,v)               SERIAL_ECHO(_SF(s),v);
 #define _SEP_3(s,v,V...)          _SEP_2(s,v); DEFER2(_SEP_N_REF)()(TWO_ARGS(V),V);
 #define SERIAL_ECHOPGM(V...)      do{ EVAL(_SEP_N(TWO_ARGS(V),V)); }while(0)
 
@@ -198,8 +215,8 @@ void SERIAL_ECHOLN(T arg1, Args ... args) { SERIAL_ECHO(arg1); SERIAL_ECHO(args
 #define __SELP_N(N,V...)          _SELP_##N(V)
 #define _SELP_N(N,V...)           __SELP_N(N,V)
 #define _SELP_N_REF()             _SELP_N
-#define _SELP_1(s)                SERIAL_ECHO(F(s "\n"));
-#define _SELP_2(s,v)              SERIAL_ECHOLN(F(s),v);
+#define _SELP_1(s)                SERIAL_ECHO(_SF(s "\n"));
+#define _SELP_2(s,v)              SERIAL_ECHOLN(_SF(s),v);
 #define _SELP_3(s,v,V...)         _SEP_2(s,v); DEFER2(_SELP_N_REF)()(TWO_ARGS(V),V);
 #define SERIAL_ECHOLNPGM(V...)    do{ EVAL(_SELP_N(TWO_ARGS(V),V)); }while(0)
 
@@ -231,6 +231,22 @@ struct SerialBase {
       number = -number;
     }
 
+    // Print typical values (temperatures, positions) as a scaled integer, without more double math
+    if (digits <= 6) {
+      static constexpr uint32_t scale[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+      const double scaled = number * scale[digits] + 0.5;
+      if (scaled < 4294967295.0) {
+        const uint32_t n = uint32_t(scaled);
+        printNumber_unsigned(n / scale[digits], PrintBase::Dec);
+        if (digits) {
+          write('.');
+          uint32_t frac = n % scale[digits];
+          for (uint32_t d = scale[digits] / 10; d; d /= 10) { write(char('0' + frac / d)); frac %= d; }
+        }
+        return;
+      }
+    }
+
     // Round correctly so that print(1.999, 2) prints as "2.00"
     double rounding = 0.5;
     for (uint8_t i = 0; i < digits; ++i) rounding *= 0.1;
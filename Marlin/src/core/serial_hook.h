@@ -23,6 +23,15 @@
 
 #include "serial_base.h"
 
+// Write a whole buffer with one call where the serial class supports it, otherwise a byte at a time
+namespace Private {
+  template <typename T>
+  FORCE_INLINE auto write_buffer(T * const t, const uint8_t *buffer, const size_t size, int) -> decltype(t->write(buffer, size), void()) { t->write(buffer, size); }
+  template <typename T>
+  FORCE_INLINE void write_buffer(T * const t, const uint8_t *buffer, size_t size, long) { while (size--) t->write(*buffer++); }
+}
+#define WRITE_BUFFER(That, B, N) Private::write_buffer(That, B, N, 0)
+
 // A mask containing a bitmap of the serial port to act upon
 // This is written to ensure a serial index is never used as a serial mask
 class SerialMask {
@@ -37,6 +46,7 @@ public:
   inline constexpr bool enabled(const SerialMask PortMask) const    { return mask & PortMask.mask; }
   inline constexpr SerialMask combine(const SerialMask other) const { return SerialMask(mask | other.mask); }
   inline constexpr SerialMask operator<< (const int offset) const   { return SerialMask(mask << offset); }
+  inline constexpr bool operator!= (const SerialMask other) const  { return mask != other.mask; }
   static SerialMask from(const serial_index_t index) {
     if (index.valid()) return SerialMask(_BV(index.index));
     return SerialMask(0); // A invalid index mean no output
@@ -94,6 +104,7 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   bool    & condition;
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { if (condition) return out.write(c); return 0; }
+  using BaseClassT::write;
   void flush()                      { if (condition) out.flush();  }
   void begin(long br)               { out.begin(br); }
   void end()                        { out.end(); }
@@ -118,6 +129,8 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
 
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { return out.write(c); }
+  void write(const uint8_t *buffer, size_t size) { WRITE_BUFFER(&out, buffer, size); }
+  using BaseClassT::write;
   void flush()            { out.flush();  }
   void begin(long br)     { out.begin(br); }
   void end()              { out.end(); }
@@ -136,6 +149,57 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   ForwardSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
 };
 
+// A serial output that collects whole lines and writes each one to the port(s) in a single call.
+// A partial line goes out when the buffer is full, on flush, and from idle() with flushLine().
+template <class SerialT, const uint8_t SIZE>
+struct LineBufferSerial : public SerialBase< LineBufferSerial<SerialT, SIZE> > {
+  typedef SerialBase< LineBufferSerial<SerialT, SIZE> > BaseClassT;
+
+  SerialT & out;
+  uint8_t buffer[SIZE], count;
+  #if HAS_MULTI_SERIAL
+    SerialMask mask;  // The ports the buffered bytes are meant for
+  #endif
+
+  NO_INLINE size_t write(uint8_t c) {
+    #if HAS_MULTI_SERIAL
+      // Send the bytes for other ports, like the end of a PORT_REDIRECT block, before any for the new port(s)
+      if (count && out.portMask != mask) flushLine();
+      mask = out.portMask;
+    #endif
+    buffer[count++] = c;
+    if (c == '\n' || count >= SIZE) flushLine();
+    return 1;
+  }
+
+  NO_INLINE void flushLine() {
+    if (!count) return;
+    #if HAS_MULTI_SERIAL
+      const SerialMask current = out.portMask;
+      out.portMask = mask;
+    #endif
+    WRITE_BUFFER(&out, buffer, count);
+    count = 0;
+    TERN_(HAS_MULTI_SERIAL, out.portMask = current);
+  }
+
+  void flush()            { flushLine(); out.flush(); }
+  void flushTX()          { flushLine(); CALL_IF_EXISTS(void, &out, flushTX); }
+  void msgDone()          { flushLine(); out.msgDone(); }
+  void begin(long br)     { out.begin(br); }
+  void end()              { flushLine(); out.end(); }
+
+  bool connected()                { return CALL_IF_EXISTS(bool, &out, connected); }
+  int available(serial_index_t index) { return (int)out.available(index); }
+  int read(serial_index_t index)      { return (int)out.read(index); }
+  SerialFeature features(serial_index_t index) const { return CALL_IF_EXISTS(SerialFeature, &out, features, index); }
+
+  using BaseClassT::available;
+  using BaseClassT::read;
+
+  LineBufferSerial(SerialT & out) : BaseClassT(false), out(out), count(0) OPTARG(HAS_MULTI_SERIAL, mask(out.portMask)) {}
+};
+
 // A class that can be hooked and unhooked at runtime, useful to capture the output of the serial interface
 template <class SerialT>
 struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public SerialT {
@@ -151,6 +215,7 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
     if (writeHook) writeHook(userPointer, c);
     return SerialT::write(c);
   }
+  using BaseClassT::write;  // Whole buffers still go through the hook one byte at a time
 
   NO_INLINE void msgDone() {
     if (eofHook) eofHook(userPointer);
@@ -228,6 +293,12 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     REPEAT(NUM_SERIAL, _S_WRITE);
     #undef _S_WRITE
   }
+  NO_INLINE void write(const uint8_t *buffer, size_t size) {
+    #define _S_WRITE_BUF(N) if (portMask.enabled(output[N])) WRITE_BUFFER(&serial##N, buffer, size);
+    REPEAT(NUM_SERIAL, _S_WRITE_BUF);
+    #undef _S_WRITE_BUF
+  }
+  using BaseClassT::write;
   NO_INLINE void msgDone() {
     #define _S_DONE(N) if (portMask.enabled(output[N])) serial##N.msgDone();
     REPEAT(NUM_SERIAL, _S_DONE);
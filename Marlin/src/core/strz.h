@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * strz.h - Compressed serial messages for COMPRESSED_STRINGS
+ *
+ * The literal strings in SERIAL_ECHOPGM, SERIAL_ECHOLNPGM and SERIAL_*_MSG are
+ * compressed at compile time. Each longest word found in the shared dictionary
+ * (strz_dict.h) becomes one byte from 0x80 to 0xFE, and a byte over 0x7F in the
+ * message is escaped by 0xFF. A compressed string starts with STRZ_MARK so that
+ * SERIAL_ECHO_P can tell it apart and expand it as it goes out.
+ */
+
+#include "strz_dict.h"
+
+#define STRZ_MARK '\x01'
+#define STRZ_ESC  0xFF
+
+namespace MarlinStrz {
+
+  inline constexpr char dict[] PROGMEM = STRZ_DICT;
+
+  struct Offsets { uint16_t at[STRZ_DICT_WORDS]; };
+
+  constexpr Offsets make_offsets() {
+    Offsets o{};
+    for (uint16_t i = 0, w = 0; w < STRZ_DICT_WORDS; ++i)
+      if (i == 0 || dict[i - 1] == '\0') o.at[w++] = i;
+    return o;
+  }
+
+  // Where each word starts in dict
+  inline constexpr Offsets offsets PROGMEM = make_offsets();
+
+  // The length of the longest word at s[i], and its token
+  struct Match { uint8_t len, token; };
+
+  template<size_t N>
+  constexpr Match longest(const char (&s)[N], const size_t i) {
+    Match m{0, 0};
+    for (uint8_t w = 0; w < STRZ_DICT_WORDS; ++w) {
+      const char * const word = &dict[offsets.at[w]];
+      uint8_t n = 0;
+      while (word[n] && i + n < N - 1 && word[n] == s[i + n]) ++n;
+      if (!word[n] && n > m.len) m = { n, uint8_t(0x80 + w) };
+    }
+    return m;
+  }
+
+  // The compressed size of a literal, with the mark and the terminator
+  template<size_t N>
+  constexpr size_t size(const char (&s)[N]) {
+    size_t z = 2;
+    for (size_t i = 0; i < N - 1; ++z) {
+      const Match m = longest(s, i);
+      if (m.len) i += m.len;
+      else z += (uint8_t(s[i++]) >= 0x80);
+    }
+    return z;
+  }
+
+  template<size_t Z>
+  struct Packed { char data[Z]; };
+
+  template<size_t Z, size_t N>
+  constexpr Packed<Z> compress(const char (&s)[N]) {
+    Packed<Z> p{};
+    size_t z = 0;
+    p.data[z++] = STRZ_MARK;
+    for (size_t i = 0; i < N - 1;) {
+      const Match m = longest(s, i);
+      if (m.len) { p.data[z++] = char(m.token); i += m.len; continue; }
+      if (uint8_t(s[i]) >= 0x80) p.data[z++] = char(STRZ_ESC);
+      p.data[z++] = s[i++];
+    }
+    p.data[z] = '\0';
+    return p;
+  }
+
+} // MarlinStrz
+
+// A literal string compressed at compile time, as an FSTR_P for SERIAL_ECHO. Kept as-is if it isn't smaller.
+#define CF(S) ([]{ \
+  if constexpr (MarlinStrz::size(S) < sizeof(S)) { \
+    static constexpr auto z PROGMEM = MarlinStrz::compress<MarlinStrz::size(S)>(S); \
+    return reinterpret_cast<FSTR_P>(z.data); \
+  } \
+  else return F(S); \
+}())
@@ -0,0 +1,157 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The COMPRESSED_STRINGS dictionary, as words separated by '\0'.
+ * Generated by buildroot/share/scripts/createStringDictionary.py
+ */
+#define STRZ_DICT_WORDS 127
+#define STRZ_DICT \
+  "ing \0" \
+  "     \0" \
+  "============\0" \
+  "ed \0" \
+  "Invalid \0" \
+  " out of rang\0" \
+  "to \0" \
+  "tion\0" \
+  "[DEBUG] \0" \
+  "or \0" \
+  "res\0" \
+  "DBG_PROBE: \0" \
+  "EEPROM\0" \
+  "er \0" \
+  "Special Menu\0" \
+  "emperature\0" \
+  "ent\0" \
+  "?Wrong mode \0" \
+  "ing\0" \
+  "sta\0" \
+  " not \0" \
+  "plausible\0" \
+  "robe\0" \
+  " value\0" \
+  "int\0" \
+  "able\0" \
+  "block\0" \
+  "M1125: \0" \
+  "ctive\0" \
+  "set\0" \
+  "ile\0" \
+  "ted\0" \
+  "requ\0" \
+  "st \0" \
+  "is \0" \
+  "  M\0" \
+  "esh \0" \
+  "   \0" \
+  "and\0" \
+  "SPI Flash\0" \
+  "out\0" \
+  "trigg\0" \
+  " paramet\0" \
+  "s: \0" \
+  " of \0" \
+  " in\0" \
+  "pecifi\0" \
+  "writ\0" \
+  "e: \0" \
+  "end\0" \
+  "easur\0" \
+  "err\0" \
+  " co\0" \
+  " pr\0" \
+  "ime\0" \
+  "tart\0" \
+  "alibra\0" \
+  "t: \0" \
+  "se \0" \
+  "tep\0" \
+  "from \0" \
+  "xtrud\0" \
+  "sto\0" \
+  "Err\0" \
+  "PROBE\0" \
+  "Level\0" \
+  "at \0" \
+  "orrec\0" \
+  "ree\0" \
+  "utotune\0" \
+  "Check \0" \
+  "ot \0" \
+  "ail\0" \
+  "temp\0" \
+  " de\0" \
+  "with \0" \
+  "et \0" \
+  "ate\0" \
+  "ove\0" \
+  "ead\0" \
+  "ound\0" \
+  "curr\0" \
+  "emory\0" \
+  "r: \0" \
+  "one\0" \
+  " (0\0" \
+  "onfirm\0" \
+  " 0.85 x V bi\0" \
+  " -> \0" \
+  "age\0" \
+  "pos\0" \
+  "pen\0" \
+  "index\0" \
+  "enc\0" \
+  "al \0" \
+  "ce \0" \
+  "mple\0" \
+  "red\0" \
+  "ard\0" \
+  "ect\0" \
+  "all\0" \
+  "max\0" \
+  "DGUS: \0" \
+  "ess\0" \
+  "the\0" \
+  "ume\0" \
+  "min\0" \
+  "atch\0" \
+  " fa\0" \
+  " - \0" \
+  "arg\0" \
+  "ang\0" \
+  "sion\0" \
+  "ali\0" \
+  " byte\0" \
+  " ; \0" \
+  " too\0" \
+  "ode\0" \
+  "add\0" \
+  "igh\0" \
+  "ait\0" \
+  "act\0" \
+  "ack\0" \
+  "...\0" \
+  "() \0" \
+  "ort\0" \
+  "sav\0" \
+  ""
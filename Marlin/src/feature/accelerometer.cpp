@@ -0,0 +1,142 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * accelerometer.cpp - SPI accelerometer for resonance measurement
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(RESONANCE_TUNING)
+
+#include "accelerometer.h"
+#include "../HAL/shared/Delay.h"
+
+Accelerometer accelerometer;
+
+MarlinSPI Accelerometer::spi(ACCEL_MOSI_PIN, ACCEL_MISO_PIN, ACCEL_SCK_PIN, NC);
+
+#if ENABLED(ACCEL_ADXL345)
+  #define ACCEL_READ        0x80
+  #define ACCEL_MULTI       0x40  // Address increment, set in the read command
+  #define ACCEL_ID_REG      0x00  // DEVID
+  #define ACCEL_ID          0xE5
+  #define ACCEL_DATA_REG    0x32  // DATAX0
+  #define ACCEL_FIFO_REG    0x39  // FIFO_STATUS
+#else // ACCEL_LIS2DW
+  #define ACCEL_READ        0x80
+  #define ACCEL_MULTI       0x00  // Address increment set by IF_ADD_INC
+  #define ACCEL_ID_REG      0x0F  // WHO_AM_I
+  #define ACCEL_ID          0x44
+  #define ACCEL_DATA_REG    0x28  // OUT_X_L
+  #define ACCEL_FIFO_REG    0x2F  // FIFO_SAMPLES
+#endif
+
+#define ACCEL_CS_L() WRITE(ACCEL_CS_PIN, LOW)
+#define ACCEL_CS_H() WRITE(ACCEL_CS_PIN, HIGH)
+
+uint8_t Accelerometer::read_reg(const uint8_t reg) {
+  ACCEL_CS_L();
+  spi.transfer(ACCEL_READ | reg);
+  const uint8_t val = spi.transfer(0xFF);
+  ACCEL_CS_H();
+  return val;
+}
+
+void Accelerometer::write_reg(const uint8_t reg, const uint8_t val) {
+  ACCEL_CS_L();
+  spi.transfer(reg);
+  spi.transfer(val);
+  ACCEL_CS_H();
+}
+
+void Accelerometer::read_burst(const uint8_t reg, void * const dst, const uint16_t len) {
+  ACCEL_CS_L();
+  spi.transfer(ACCEL_READ | ACCEL_MULTI | reg);
+  spi.dmaTransfer(nullptr, dst, len);
+  ACCEL_CS_H();
+}
+
+bool Accelerometer::begin() {
+  OUT_WRITE(ACCEL_CS_PIN, HIGH);
+
+  // Both parts take up to 5 MHz in SPI mode 3
+  spi.setClockDivider(SPI_CLOCK_DIV16);
+  spi.setBitOrder(MSBFIRST);
+  spi.setDataMode(SPI_MODE3);
+  spi.begin();
+
+  if (read_reg(ACCEL_ID_REG) != ACCEL_ID) return false;
+
+  #if ENABLED(ACCEL_ADXL345)
+    write_reg(0x2D, 0x00);      // POWER_CTL: Standby while configuring
+    write_reg(0x31, 0x0B);      // DATA_FORMAT: Full resolution, ±16g
+    write_reg(0x2C, 0x0D);      // BW_RATE: 800 Hz
+    write_reg(0x38, 0x00);      // FIFO_CTL: Bypass, to empty the FIFO
+    write_reg(0x38, 0x80);      // FIFO_CTL: Stream
+    write_reg(0x2D, 0x08);      // POWER_CTL: Measure
+  #else
+    write_reg(0x21, 0x0C);      // CTRL2: Block data update, address increment
+    write_reg(0x25, 0x30);      // CTRL6: ±16g, bandwidth ODR/2
+    write_reg(0x2E, 0x00);      // FIFO_CTRL: Bypass, to empty the FIFO
+    write_reg(0x2E, 0xC0);      // FIFO_CTRL: Continuous
+    write_reg(0x20, 0x74);      // CTRL1: 800 Hz, high performance
+  #endif
+
+  return true;
+}
+
+void Accelerometer::end() {
+  #if ENABLED(ACCEL_ADXL345)
+    write_reg(0x2D, 0x00);      // POWER_CTL: Standby
+  #else
+    write_reg(0x20, 0x00);      // CTRL1: Power down
+  #endif
+}
+
+uint8_t Accelerometer::read(accel_sample_t * const samples, const uint8_t max, bool &overrun) {
+  static_assert(sizeof(accel_sample_t) == 6, "accel_sample_t must be 6 bytes.");
+
+  const uint8_t status = read_reg(ACCEL_FIFO_REG);
+  uint8_t n = status & 0x3F;
+  #if ENABLED(ACCEL_ADXL345)
+    overrun = n >= ACCEL_FIFO_DEPTH;  // Full, so samples may have been dropped
+  #else
+    overrun = TEST(status, 6);        // FIFO_OVR
+  #endif
+  NOMORE(n, max);
+
+  // Samples are little-endian X, Y, Z. The LIS2DW sends the whole FIFO in one
+  // burst, wrapping back to OUT_X_L. The ADXL345 pops one sample per transfer.
+  #if ENABLED(ACCEL_ADXL345)
+    for (uint8_t i = 0; i < n; ++i) {
+      read_burst(ACCEL_DATA_REG, &samples[i], sizeof(accel_sample_t));
+      DELAY_US(5);              // CS high between FIFO reads
+    }
+  #else
+    if (n) read_burst(ACCEL_DATA_REG, samples, n * sizeof(accel_sample_t));
+  #endif
+
+  return n;
+}
+
+#endif // RESONANCE_TUNING
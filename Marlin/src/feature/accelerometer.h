@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * accelerometer.h - SPI accelerometer for resonance measurement
+ *
+ * Drives an ADXL345 or LIS2DW at ACCEL_RATE samples per second with its
+ * 32-sample FIFO in stream mode, so the main loop only needs to drain the
+ * FIFO every few tens of ms. FIFO contents are read with SPI DMA.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include HAL_PATH(.., MarlinSPI.h)
+
+#ifndef ACCEL_SCK_PIN
+  #define ACCEL_SCK_PIN  SD_SCK_PIN
+#endif
+#ifndef ACCEL_MISO_PIN
+  #define ACCEL_MISO_PIN SD_MISO_PIN
+#endif
+#ifndef ACCEL_MOSI_PIN
+  #define ACCEL_MOSI_PIN SD_MOSI_PIN
+#endif
+
+#define ACCEL_RATE        800   // (Hz) Output data rate
+#define ACCEL_FIFO_DEPTH   32   // Samples held by the sensor
+#if ENABLED(ACCEL_ADXL345)
+  #define ACCEL_MM_S2_PER_LSB 38.25f  // 3.9 mg at full resolution
+#else
+  #define ACCEL_MM_S2_PER_LSB 4.786f  // 0.488 mg at ±16g, left-justified
+#endif
+
+typedef struct { int16_t x, y, z; } accel_sample_t;
+
+class Accelerometer {
+  public:
+    static bool begin();        // Set up the sensor. False if it doesn't answer.
+    static void end();          // Put the sensor in standby
+
+    // Read up to 'max' samples from the FIFO. Overrun is set if samples were lost.
+    static uint8_t read(accel_sample_t * const samples, const uint8_t max, bool &overrun);
+
+  private:
+    static MarlinSPI spi;
+    static uint8_t read_reg(const uint8_t reg);
+    static void write_reg(const uint8_t reg, const uint8_t val);
+    static void read_burst(const uint8_t reg, void * const dst, const uint16_t len);
+};
+
+extern Accelerometer accelerometer;
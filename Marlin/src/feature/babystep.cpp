@@ -46,6 +46,29 @@ int16_t Babystep::accum;
   int16_t Babystep::ep_babysteps;
 #endif
 
+#if ENABLED(BABYSTEP_PLANNER)
+
+  float Babystep::z_offset, Babystep::z_offset_target;
+
+  /**
+   * Called by Planner::buffer_line for each new move. The Z offset moves toward
+   * its target by BABYSTEP_PLANNER_SLOPE for each mm of XY travel, so the change
+   * is folded into the move as a gentle slope planned like any other Z motion.
+   * A move with no XY travel takes the whole change.
+   */
+  void Babystep::ramp_z_offset(const xyze_pos_t &cart) {
+    static xy_pos_t ramp_from{0};
+    const float change = z_offset_target - z_offset;
+    if (change) {
+      const float xy_mm = (ramp_from - cart).magnitude(),
+                  most = xy_mm ? xy_mm * (BABYSTEP_PLANNER_SLOPE) : ABS(change);
+      z_offset = ABS(change) > most ? z_offset + (change > 0 ? most : -most) : z_offset_target;
+    }
+    ramp_from = cart;
+  }
+
+#endif
+
 void Babystep::step_axis(const AxisEnum axis) {
   const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
   if (curTodo) {
@@ -78,6 +101,17 @@ void Babystep::add_steps(const AxisEnum axis, const int16_t distance) {
   if (!can_babystep(axis)) return;
 
   accum += distance; // Count up babysteps for the UI
+
+  #if ENABLED(BABYSTEP_PLANNER)
+    if (axis == Z_AXIS) {
+      z_offset_target += TERN_(BABYSTEP_INVERT_Z, -) distance * planner.mm_per_step[Z_AXIS];
+      TERN_(BABYSTEP_DISPLAY_TOTAL, axis_total[BS_TOTAL_IND(axis)] += distance);
+      // With no moves coming, move Z to the new offset now
+      if (!planner.has_blocks_queued()) planner.buffer_line(current_position, homing_feedrate(Z_AXIS));
+      return;
+    }
+  #endif
+
   steps[BS_AXIS_IND(axis)] += distance;
   TERN_(BABYSTEP_DISPLAY_TOTAL, axis_total[BS_TOTAL_IND(axis)] += distance);
   TERN_(BABYSTEP_ALWAYS_AVAILABLE, gcode.reset_stepper_timeout());
@@ -59,6 +59,13 @@ public:
     }
   #endif
 
+  #if ENABLED(BABYSTEP_PLANNER)
+    static float z_offset,                                  // (mm) Z offset applied to the planned moves
+                 z_offset_target;                           // (mm) Z offset the babysteps add up to
+    static void ramp_z_offset(const xyze_pos_t &cart);      // Move the offset toward the target for a new move
+    static void reset_z_offset() { z_offset = z_offset_target = 0; }
+  #endif
+
   static bool can_babystep(const AxisEnum axis);
   static void add_steps(const AxisEnum axis, const int16_t distance);
   static void add_mm(const AxisEnum axis, const float mm);
@@ -61,6 +61,9 @@ Backlash backlash;
  *
  * With a non-zero BACKLASH_SMOOTHING_MM value the backlash correction is
  * spread over multiple segments, smoothing out artifacts even more.
+ *
+ * With BACKLASH_STEPPER the correction for a segment is handed to the
+ * stepper instead, which plays it spread over the segment's run time.
  */
 
 void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm, block_t * const block) {
@@ -133,26 +136,32 @@ void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm,
 
       // This correction reduces the residual error and adds block steps
       if (error_correction) {
-        changed = true;
-        block->steps[axis] += ABS(error_correction);
-        millimeters_delta += dist[axis] * error_correction * sq(planner.mm_per_step[axis]);
-        #if ENABLED(CORE_BACKLASH)
-          switch (axis) {
-            case CORE_AXIS_1:
-              //block->steps[CORE_AXIS_2] += influence_distance_mm[axis] * planner.settings.axis_steps_per_mm[CORE_AXIS_2];
-              //SERIAL_ECHOLNPGM("CORE_AXIS_1 dir change. distance=", distance_mm[axis], " r.err=", residual_error[axis],
-              //  " da=", da, " db=", db, " block->steps[axis]=", block->steps[axis], " err_corr=", error_correction);
-              break;
-            case CORE_AXIS_2:
-              //block->steps[CORE_AXIS_1] += influence_distance_mm[axis] * planner.settings.axis_steps_per_mm[CORE_AXIS_1];;
-              //SERIAL_ECHOLNPGM("CORE_AXIS_2 dir change. distance=", distance_mm[axis], " r.err=", residual_error[axis],
-              //  " da=", da, " db=", db, " block->steps[axis]=", block->steps[axis], " err_corr=", error_correction);
-              break;
-            case NORMAL_AXIS: break;
-          }
-          residual_error[axis] = 0; // No residual_error needed for next CORE block, I think...
-        #else
+        #if ENABLED(BACKLASH_STEPPER)
+          // The stepper plays the correction alongside the block, which keeps its steps and length
+          block->backlash_steps[axis] = error_correction;
           residual_error[axis] -= error_correction;
+        #else
+          changed = true;
+          block->steps[axis] += ABS(error_correction);
+          millimeters_delta += dist[axis] * error_correction * sq(planner.mm_per_step[axis]);
+          #if ENABLED(CORE_BACKLASH)
+            switch (axis) {
+              case CORE_AXIS_1:
+                //block->steps[CORE_AXIS_2] += influence_distance_mm[axis] * planner.settings.axis_steps_per_mm[CORE_AXIS_2];
+                //SERIAL_ECHOLNPGM("CORE_AXIS_1 dir change. distance=", distance_mm[axis], " r.err=", residual_error[axis],
+                //  " da=", da, " db=", db, " block->steps[axis]=", block->steps[axis], " err_corr=", error_correction);
+                break;
+              case CORE_AXIS_2:
+                //block->steps[CORE_AXIS_1] += influence_distance_mm[axis] * planner.settings.axis_steps_per_mm[CORE_AXIS_1];;
+                //SERIAL_ECHOLNPGM("CORE_AXIS_2 dir change. distance=", distance_mm[axis], " r.err=", residual_error[axis],
+                //  " da=", da, " db=", db, " block->steps[axis]=", block->steps[axis], " err_corr=", error_correction);
+                break;
+              case NORMAL_AXIS: break;
+            }
+            residual_error[axis] = 0; // No residual_error needed for next CORE block, I think...
+          #else
+            residual_error[axis] -= error_correction;
+          #endif
         #endif
       }
     }
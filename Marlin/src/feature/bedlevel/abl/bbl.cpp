@@ -44,6 +44,13 @@ bed_mesh_t LevelingBilinear::z_values;
 xy_pos_t LevelingBilinear::cached_rel;
 xy_int8_t LevelingBilinear::cached_g;
 
+#if ENABLED(ABL_BILINEAR_CELL_CACHE)
+  LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X)]
+                                                             [TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y)];
+  const LevelingBilinear::cell_coeff_t *LevelingBilinear::cached_cell = &cell_coeff[0][0];
+  xy_pos_t LevelingBilinear::cached_cell_min, LevelingBilinear::cached_cell_max, LevelingBilinear::cached_cell_origin;
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -79,7 +86,7 @@ void LevelingBilinear::extrapolate_one_point(const uint8_t x, const uint8_t y, c
 
   // Take the average instead of the median
   z_values[x][y] = (a + b + c) / 3.0;
-  TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+  TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
 
   // Median is robust (ignores outliers).
   // z_values[x][y] = (a < b) ? ((b < c) ? b : (c < a) ? a : c)
@@ -102,7 +109,7 @@ void LevelingBilinear::reset() {
   grid_spacing.reset();
   GRID_LOOP(x, y) {
     z_values[x][y] = NAN;
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
+    TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, 0));
   }
 }
 
@@ -161,7 +168,18 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
       SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
-      print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+        // One row at a time, since the whole grid is never stored
+        for (uint8_t y = 0; y < ABL_GRID_POINTS_VIRT_Y; ++y) {
+          for (uint8_t x = 0; x < ABL_GRID_POINTS_VIRT_X; ++x) {
+            const float z = virt_point(x, y);
+            SERIAL_ECHO(F(" "), z >= 0 ? F("+") : F(""), p_float_t(z, 5));
+          }
+          SERIAL_EOL();
+        }
+      #else
+        print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #endif
     }
   #endif
 }
@@ -170,7 +188,12 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+    LevelingBilinear::virt_box_t LevelingBilinear::virt_boxes[ABL_LAZY_CACHE_BOXES];
+    uint8_t LevelingBilinear::virt_box_count; // = 0
+  #else
+    float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #endif
   xy_pos_t LevelingBilinear::grid_spacing_virt;
   xy_float_t LevelingBilinear::grid_factor_virt;
 
@@ -240,9 +263,46 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
     return virt_cmr(row, 1, tx);
   }
 
+  #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+
+    // The subdivided grid point, as subdivide_mesh() would have stored it
+    float LevelingBilinear::virt_point(const uint8_t x, const uint8_t y) {
+      return virt_2cmr(x / (BILINEAR_SUBDIVISIONS) + 1, y / (BILINEAR_SUBDIVISIONS) + 1,
+                       float(x % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS),
+                       float(y % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS));
+    }
+
+    // Corners of the box at g with far corner n, as LF, LB, RF, RB. Computed on first use.
+    const float* LevelingBilinear::virt_box(const xy_int8_t &g, const xy_int8_t &n) {
+      uint8_t i = 0;
+      while (i < virt_box_count && virt_boxes[i].g != g) ++i;
+
+      virt_box_t box;
+      if (i < virt_box_count)
+        box = virt_boxes[i];
+      else {
+        box.g = g;
+        box.z[0] = virt_point(g.x, g.y);
+        box.z[1] = virt_point(g.x, n.y);
+        box.z[2] = virt_point(n.x, g.y);
+        box.z[3] = virt_point(n.x, n.y);
+        if (i < ABL_LAZY_CACHE_BOXES) virt_box_count++; else i--;  // Drop the least recent
+      }
+
+      // Move it to the front
+      for (; i; --i) virt_boxes[i] = virt_boxes[i - 1];
+      virt_boxes[0] = box;
+      return virt_boxes[0].z;
+    }
+
+  #endif
+
   void LevelingBilinear::subdivide_mesh() {
     grid_spacing_virt = grid_spacing / (BILINEAR_SUBDIVISIONS);
     grid_factor_virt = grid_spacing_virt.reciprocal();
+    #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+      virt_box_count = 0;   // Forget the boxes of the old mesh
+    #else
     for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y)
       for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x)
         for (uint8_t ty = 0; ty < BILINEAR_SUBDIVISIONS; ++ty)
@@ -252,6 +312,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
             z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
               virt_2cmr(x + 1, y + 1, (float)tx / (BILINEAR_SUBDIVISIONS), (float)ty / (BILINEAR_SUBDIVISIONS));
           }
+    #endif
   }
 
 #endif // ABL_BILINEAR_SUBDIVISION
@@ -261,6 +322,7 @@ void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
   cached_rel.x = cached_rel.y = -999.999;
   cached_g.x = cached_g.y = -99;
+  TERN_(ABL_BILINEAR_CELL_CACHE, cache_cell_coefficients());
 }
 
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
@@ -277,6 +339,67 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+  #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+#else
+  #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+#endif
+
+#if ENABLED(ABL_BILINEAR_CELL_CACHE)
+
+  /**
+   * Expand the bilinear interpolation of every grid box into a polynomial.
+   * Boxes on the far edge (without EXTRAPOLATE_BEYOND_GRID) are flat in that axis.
+   */
+  void LevelingBilinear::cache_cell_coefficients() {
+    for (uint8_t x = 0; x <= ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX); ++x) {
+      const uint8_t nx = _MIN(x + 1, ABL_BG_POINTS_X - 1);
+      for (uint8_t y = 0; y <= ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX); ++y) {
+        const uint8_t ny = _MIN(y + 1, ABL_BG_POINTS_Y - 1);
+        const float z1 = ABL_BG_GRID(x, y),    // left-front
+                    z2 = ABL_BG_GRID(x, ny),   // left-back
+                    z3 = ABL_BG_GRID(nx, y),   // right-front
+                    z4 = ABL_BG_GRID(nx, ny);  // right-back
+        cell_coeff[x][y] = { z1, z3 - z1, z2 - z1, z4 - z3 - z2 + z1 };
+      }
+    }
+    // No box is cached, so the next call looks one up
+    cached_cell_min.set(1, 1);
+    cached_cell_max.set(0, 0);
+  }
+
+  // Get the Z adjustment for non-linear bed leveling
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+    // XY relative to the probed area
+    const xy_pos_t rel = raw - grid_start.asFloat();
+
+    // Look up the grid box only when leaving the last one
+    if (!WITHIN(rel.x, cached_cell_min.x, cached_cell_max.x) || !WITHIN(rel.y, cached_cell_min.y, cached_cell_max.y)) {
+      const xy_uint8_t g = {
+        uint8_t(constrain(FLOOR(rel.x * ABL_BG_FACTOR(x)), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX))),
+        uint8_t(constrain(FLOOR(rel.y * ABL_BG_FACTOR(y)), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX)))
+      };
+      cached_cell = &cell_coeff[g.x][g.y];
+      cached_cell_origin.set(g.x * ABL_BG_SPACING(x), g.y * ABL_BG_SPACING(y));
+      // The outer boxes extend to infinity
+      cached_cell_min.set(g.x ? cached_cell_origin.x : -(__FLT_MAX__), g.y ? cached_cell_origin.y : -(__FLT_MAX__));
+      cached_cell_max.set(g.x < ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX) ? cached_cell_origin.x + ABL_BG_SPACING(x) : __FLT_MAX__,
+                          g.y < ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX) ? cached_cell_origin.y + ABL_BG_SPACING(y) : __FLT_MAX__);
+    }
+
+    xy_float_t ratio = { (rel.x - cached_cell_origin.x) * ABL_BG_FACTOR(x), (rel.y - cached_cell_origin.y) * ABL_BG_FACTOR(y) };
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      NOLESS(ratio.x, 0);
+      NOLESS(ratio.y, 0);
+    #endif
+
+    const cell_coeff_t &c = *cached_cell;
+    return c.a + ratio.x * (c.b + c.d * ratio.y) + c.c * ratio.y;
+  }
+
+#else
+
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
@@ -290,12 +413,6 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   // XY relative to the probed area
   xy_pos_t rel = raw - grid_start.asFloat();
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
-
   if (cached_rel.x != rel.x) {
     cached_rel.x = rel.x;
     ratio.x = rel.x * ABL_BG_FACTOR(x);
@@ -331,10 +448,15 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     if (cached_g != thisg) {
       cached_g = thisg;
       // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+        const float * const z = virt_box(thisg, nextg);
+        z1 = z[0]; d2 = z[1] - z1; z3 = z[2]; d4 = z[3] - z3;
+      #else
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      #endif
     }
 
     // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
@@ -361,6 +483,8 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   return offset;
 }
 
+#endif // !ABL_BILINEAR_CELL_CACHE
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
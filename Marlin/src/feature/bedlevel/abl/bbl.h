@@ -39,7 +39,16 @@ private:
     #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) + 1)
     #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1)
 
-    static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+      // The corners of recently used subdivided boxes, the most recent first
+      typedef struct { xy_int8_t g; float z[4]; } virt_box_t;
+      static virt_box_t virt_boxes[ABL_LAZY_CACHE_BOXES];
+      static uint8_t virt_box_count;
+      static float virt_point(const uint8_t x, const uint8_t y);
+      static const float* virt_box(const xy_int8_t &g, const xy_int8_t &n);
+    #else
+      static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #endif
     static xy_pos_t grid_spacing_virt;
     static xy_float_t grid_factor_virt;
 
@@ -49,6 +58,16 @@ private:
     static void subdivide_mesh();
   #endif
 
+  #if ENABLED(ABL_BILINEAR_CELL_CACHE)
+    // z = a + b * rx + c * ry + d * rx * ry within a grid box, for ratios rx, ry in the box
+    typedef struct { float a, b, c, d; } cell_coeff_t;
+    static cell_coeff_t cell_coeff[TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X)]
+                                  [TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y)];
+    static const cell_coeff_t *cached_cell;
+    static xy_pos_t cached_cell_min, cached_cell_max, cached_cell_origin;
+    static void cache_cell_coefficients();
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
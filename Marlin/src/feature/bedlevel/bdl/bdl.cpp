@@ -109,14 +109,21 @@ float BDS_Leveling::read() {
   return check(data) ? NAN : interpret(data);
 }
 
+#if ENABLED(BD_SENSOR_FILTER)
+  // Median of three readings, to drop a single bad one
+  static float median3(const float a, const float b, const float c) {
+    return _MAX(_MIN(a, b), _MIN(_MAX(a, b), c));
+  }
+#endif
+
 void BDS_Leveling::process() {
   if (config_state == BDS_IDLE && printingIsActive()) return;
   static millis_t next_check_ms = 0; // starting at T=0
   static float zpos = 0.0f;
   const millis_t ms = millis();
   if (ELAPSED(ms, next_check_ms)) { // timed out (or first run)
-    // Check at 1KHz, 5Hz, or 20Hz
-    next_check_ms = ms + (config_state == BDS_HOMING_Z ? 1 : (config_state < BDS_IDLE ? 200 : 50));
+    // Check at 1KHz, 5Hz, or 20Hz (or BD_SENSOR_ADJUST_MS)
+    next_check_ms = ms + (config_state == BDS_HOMING_Z ? 1 : (config_state < BDS_IDLE ? 200 : TERN(BD_SENSOR_FILTER, BD_SENSOR_ADJUST_MS, 50)));
 
     uint16_t tmp = 0;
     const float cur_z = planner.get_axis_position_mm(Z_AXIS) - pos_zero_offset;
@@ -126,16 +133,34 @@ void BDS_Leveling::process() {
       const float z_sensor = interpret(tmp);
       #if ENABLED(BABYSTEPPING)
         if (config_state > 0) {
+          #if ENABLED(BD_SENSOR_FILTER)
+            static float z_hist[3];
+            static uint8_t z_count;
+          #endif
           if (cur_z < config_state * 0.1f
             && old_cur_z == cur_z
             && old_buf_z == current_position.z
             && z_sensor < (MAX_BD_HEIGHT) - 0.1f
           ) {
-            babystep.set_mm(Z_AXIS, cur_z - z_sensor);
+            #if ENABLED(BD_SENSOR_FILTER)
+              // Correct part of the median error. Shift the older readings by the
+              // correction so they still match where the nozzle is going.
+              z_hist[2] = z_hist[1]; z_hist[1] = z_hist[0]; z_hist[0] = z_sensor;
+              if (z_count < 3) z_count++;
+              if (z_count == 3) {
+                const float adjust = (BD_SENSOR_ADJUST_GAIN) * (cur_z - median3(z_hist[0], z_hist[1], z_hist[2]));
+                babystep.set_mm(Z_AXIS, adjust);
+                for (float &z : z_hist) z += adjust;
+              }
+            #else
+              babystep.set_mm(Z_AXIS, cur_z - z_sensor);
+            #endif
             DEBUG_ECHOLNPGM("BD:", z_sensor, ", Z:", cur_z, "|", current_position.z);
           }
-          else
+          else {
             babystep.set_mm(Z_AXIS, 0);
+            TERN_(BD_SENSOR_FILTER, z_count = 0); // Z moved, so start over
+          }
         }
       #endif
 
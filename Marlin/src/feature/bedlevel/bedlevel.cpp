@@ -39,6 +39,10 @@
   #include "../../lcd/marlinui.h"
 #endif
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../module/settings.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../core/debug_out.h"
 
@@ -47,6 +51,7 @@
 #endif
 
 bool leveling_is_valid() {
+  TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh());
   return TERN1(HAS_MESH, bedlevel.mesh_is_valid());
 }
 
@@ -120,6 +125,38 @@ void reset_bed_level() {
   TERN_(ABL_PLANAR, planner.bed_level_matrix.set_to_identity());
 }
 
+#if ENABLED(OPTIMIZED_MESH_STORAGE)
+
+  constexpr float mesh_store_scaling = 1000;
+  constexpr int16_t Z_STEPS_NAN = INT16_MAX;
+
+  void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
+    // Store from the mean so a mesh far from Z0 keeps its full range
+    float sum = 0;
+    uint16_t count = 0;
+    GRID_LOOP(x, y) if (!isnan(in_values[x][y])) { sum += in_values[x][y]; count++; }
+    const float base = count ? sum / count : 0;
+    stored_values.base = base;
+
+    auto z_to_store = [&](const float z) {
+      if (isnan(z)) return Z_STEPS_NAN;
+      const int32_t z_scaled = LROUND((z - base) * mesh_store_scaling);
+      if (z_scaled == Z_STEPS_NAN || !WITHIN(z_scaled, INT16_MIN, INT16_MAX))
+        return Z_STEPS_NAN; // If Z is out of range, return our custom 'NaN'
+      return int16_t(z_scaled);
+    };
+    GRID_LOOP(x, y) stored_values.z[x][y] = z_to_store(in_values[x][y]);
+  }
+
+  void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
+    auto store_to_z = [&](const int16_t z_scaled) {
+      return z_scaled == Z_STEPS_NAN ? NAN : stored_values.base + z_scaled / mesh_store_scaling;
+    };
+    GRID_LOOP(x, y) out_values[x][y] = store_to_z(stored_values.z[x][y]);
+  }
+
+#endif // OPTIMIZED_MESH_STORAGE
+
 #if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
 
   /**
@@ -61,6 +61,17 @@ class TemporaryBedLevelingState {
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #if ENABLED(OPTIMIZED_MESH_STORAGE)
+    // A mesh stored as 1µm steps from a base height, the mean of its points
+    typedef struct {
+      float base;
+      int16_t z[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    } mesh_store_t;
+
+    void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
+    void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
   #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -0,0 +1,135 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+
+#include "probe_order.h"
+#include "hilbert_curve.h"
+
+ProbeOrder probe_order;
+
+ProbeOrderType ProbeOrder::type = ProbeOrderType(PROBE_ORDER_DEFAULT);
+float ProbeOrder::travel;
+xy_uint8_t ProbeOrder::size;
+xy_pos_t ProbeOrder::origin, ProbeOrder::spacing, ProbeOrder::last_pos;
+uint16_t ProbeOrder::index;
+MeshFlags ProbeOrder::visited;
+ProbeOrder::filter_ptr ProbeOrder::filter;
+void *ProbeOrder::filter_data;
+
+void ProbeOrder::start(const xy_uint8_t &sz, const xy_pos_t &org, const xy_pos_t &spc,
+                       const xy_pos_t &pos, filter_ptr func/*=nullptr*/, void *data/*=nullptr*/
+) {
+  size = sz;
+  origin = org;
+  spacing = spc;
+  last_pos = pos;
+  filter = func;
+  filter_data = data;
+  index = 0;
+  travel = 0;
+  visited.reset();
+}
+
+// A point not yet given out and not left out by the filter
+bool ProbeOrder::usable(const xy_int8_t &pt) {
+  return !visited.marked(pt) && (!filter || filter(pt, filter_data));
+}
+
+/**
+ * Rows along the inner axis (Y with PROBE_Y_FIRST), alternating direction
+ * so the walk always ends at the right / back, as G29 has always done.
+ */
+bool ProbeOrder::next_serpentine(xy_int8_t &pt) {
+  #if ENABLED(PROBE_Y_FIRST)
+    const uint8_t outer_size = size.x, inner_size = size.y;
+  #else
+    const uint8_t outer_size = size.y, inner_size = size.x;
+  #endif
+  for (; index < uint16_t(outer_size) * inner_size; ++index) {
+    const uint8_t outer = index / inner_size;
+    uint8_t inner = index % inner_size;
+    if (!((outer_size ^ outer) & 1)) inner = inner_size - 1 - inner;
+    pt.set(TERN(PROBE_Y_FIRST, outer, inner), TERN(PROBE_Y_FIRST, inner, outer));
+    if (usable(pt)) { ++index; return true; }
+  }
+  return false;
+}
+
+/**
+ * The first usable point along the Hilbert curve. The grid is small, so the
+ * curve is walked again from the start for each point instead of keeping state.
+ */
+bool ProbeOrder::hilbert_test(uint8_t x, uint8_t y, void *data) {
+  xy_int8_t &pt = *(xy_int8_t*)data;
+  pt.set(x, y);
+  return x < size.x && y < size.y && usable(pt);
+}
+
+bool ProbeOrder::next_hilbert(xy_int8_t &pt) {
+  return hilbert_curve::search(hilbert_test, &pt);
+}
+
+// The usable point closest to the last one
+bool ProbeOrder::next_nearest(xy_int8_t &pt) {
+  float best = __FLT_MAX__;
+  for (uint8_t x = 0; x < size.x; ++x)
+    for (uint8_t y = 0; y < size.y; ++y) {
+      const xy_int8_t p = { int8_t(x), int8_t(y) };
+      const xy_pos_t d = origin + spacing * p.asFloat() - last_pos;
+      const float d2 = sq(d.x) + sq(d.y);
+      if (d2 < best && usable(p)) { best = d2; pt = p; }
+    }
+  return best < __FLT_MAX__;
+}
+
+bool ProbeOrder::next(xy_int8_t &pt) {
+  bool found;
+  switch (type) {
+    default:
+    case PROBE_ORDER_SERPENTINE: found = next_serpentine(pt); break;
+    case PROBE_ORDER_HILBERT:    found = next_hilbert(pt);    break;
+    case PROBE_ORDER_NEAREST:    found = next_nearest(pt);    break;
+  }
+  if (found) {
+    visited.mark(pt);
+    const xy_pos_t pos = origin + spacing * pt.asFloat();
+    travel += (pos - last_pos).magnitude();
+    last_pos = pos;
+  }
+  return found;
+}
+
+void ProbeOrder::report() {
+  SERIAL_ECHOPGM("Probe order: ");
+  switch (type) {
+    default:
+    case PROBE_ORDER_SERPENTINE: SERIAL_ECHOPGM("Serpentine"); break;
+    case PROBE_ORDER_HILBERT:    SERIAL_ECHOPGM("Hilbert");    break;
+    case PROBE_ORDER_NEAREST:    SERIAL_ECHOPGM("Nearest");    break;
+  }
+  SERIAL_ECHOLNPGM(" Travel: ", p_float_t(travel, 1), "mm");
+}
+
+#endif // SELECTABLE_PROBE_ORDER
@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_order.h - Selectable order for probing the points of a leveling grid
+ *
+ * Bilinear / Linear ABL and UBL G29 P1 ask for the next grid point to probe
+ * in the order selected with M215: Serpentine, Hilbert curve or Nearest
+ * neighbor. The XY travel between points is summed so the orders can be
+ * compared on a given bed.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+enum ProbeOrderType : uint8_t {
+  PROBE_ORDER_SERPENTINE,
+  PROBE_ORDER_HILBERT,
+  PROBE_ORDER_NEAREST,
+  PROBE_ORDER_COUNT
+};
+
+class ProbeOrder {
+  public:
+    // Return false to leave a grid point out (unreachable, already probed...)
+    typedef bool (*filter_ptr)(const xy_int8_t &pt, void *data);
+
+    static ProbeOrderType type;
+    static float travel;              // XY travel (mm) from the start position through the points given so far
+
+    // Begin a new grid walk from the current probe position 'pos'
+    static void start(const xy_uint8_t &size, const xy_pos_t &origin, const xy_pos_t &spacing,
+                      const xy_pos_t &pos, filter_ptr filter=nullptr, void *data=nullptr);
+
+    // Get the next grid point to probe. Return false when there are no more.
+    static bool next(xy_int8_t &pt);
+
+    static void report();
+
+  private:
+    static xy_uint8_t size;
+    static xy_pos_t origin, spacing, last_pos;
+    static uint16_t index;
+    static MeshFlags visited;
+    static filter_ptr filter;
+    static void *filter_data;
+
+    static bool usable(const xy_int8_t &pt);
+    static bool next_serpentine(xy_int8_t &pt);
+    static bool hilbert_test(uint8_t x, uint8_t y, void *data);
+    static bool next_hilbert(xy_int8_t &pt);
+    static bool next_nearest(xy_int8_t &pt);
+};
+
+extern ProbeOrder probe_order;
@@ -0,0 +1,198 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_STATISTICS)
+
+#include "probe_stats.h"
+
+#if HAS_MEDIA
+  #include "../../sd/cardreader.h"
+  #define PROBE_STATS_FILE "PROBESTA.BIN"
+#endif
+
+#define PROBE_STATS_MAGIC     0x5053  // 'PS'
+#define PROBE_STATS_MIN_SIGMA 0.005f  // (mm) Smallest sigma used to test for outliers
+
+ProbeStats probe_stats;
+
+ProbeStats::stats_t ProbeStats::data;
+bool ProbeStats::loaded, ProbeStats::running;
+float ProbeStats::drift_sum, ProbeStats::drift_min, ProbeStats::drift_max;
+grid_count_t ProbeStats::drifted, ProbeStats::outliers;
+
+void ProbeStats::reset() {
+  data.magic = PROBE_STATS_MAGIC;
+  data.grid_x = GRID_MAX_POINTS_X;
+  data.grid_y = GRID_MAX_POINTS_Y;
+  data.runs = PROBE_STATS_RUNS;
+  data.head = data.count = 0;
+  data.origin.reset();
+  data.spacing.reset();
+  running = false;
+  drift_sum = drift_min = drift_max = 0;
+  drifted = outliers = 0;
+}
+
+/**
+ * Mean and sigma of grid point 'i' over the complete runs,
+ * leaving out the 'skip' newest runs. Return false if never probed.
+ */
+bool ProbeStats::point_stats(const grid_count_t i, const uint8_t skip, float &mean, float &sigma, uint8_t &n) {
+  int32_t sum = 0;
+  int64_t sum_sq = 0;
+  n = 0;
+  for (uint8_t r = skip; r < data.count; ++r) {
+    const int16_t z = data.z[(data.head + PROBE_STATS_RUNS - 1 - r) % PROBE_STATS_RUNS][i];
+    if (z == NO_Z) continue;
+    sum += z;
+    sum_sq += int32_t(z) * z;
+    n++;
+  }
+  if (!n) return false;
+  const float m = float(sum) / n;
+  mean = m * 0.001f;
+  sigma = SQRT(_MAX(0.0f, float(sum_sq) / n - sq(m))) * 0.001f;
+  return true;
+}
+
+void ProbeStats::begin_run(const xy_pos_t &origin, const xy_pos_t &spacing) {
+  #if HAS_MEDIA
+    // Pick up the saved runs once there is a card
+    if (!loaded && card.isMounted()) {
+      loaded = true;
+      if (!data.count) load();
+    }
+  #endif
+
+  if (data.magic != PROBE_STATS_MAGIC) reset();
+
+  // Heights from another grid can't be compared
+  if (data.count && (ABS(origin.x - data.origin.x) > 0.01f || ABS(origin.y - data.origin.y) > 0.01f
+                  || ABS(spacing.x - data.spacing.x) > 0.01f || ABS(spacing.y - data.spacing.y) > 0.01f)
+  ) {
+    SERIAL_ECHOLNPGM("Probe stats: New grid. Starting over.");
+    reset();
+  }
+  data.origin = origin;
+  data.spacing = spacing;
+
+  // The oldest run gives up its slot to the new run
+  NOMORE(data.count, PROBE_STATS_RUNS - 1);
+  for (grid_count_t i = 0; i < GRID_MAX_POINTS; ++i) data.z[data.head][i] = NO_Z;
+
+  drift_sum = drift_min = drift_max = 0;
+  drifted = outliers = 0;
+  running = true;
+}
+
+void ProbeStats::add(const uint8_t x, const uint8_t y, const float z) {
+  if (!running || isnan(z) || x >= GRID_MAX_POINTS_X || y >= GRID_MAX_POINTS_Y) return;
+
+  const grid_count_t i = index(x, y);
+
+  // Drift from the earlier runs, and whether it's an outlier
+  float mean, sigma;
+  uint8_t n;
+  if (point_stats(i, 0, mean, sigma, n)) {
+    const float d = z - mean;
+    if (!drifted || d < drift_min) drift_min = d;
+    if (!drifted || d > drift_max) drift_max = d;
+    drift_sum += d;
+    drifted++;
+    if (n >= 3 && ABS(d) > (PROBE_STATS_OUTLIER_SIGMA) * _MAX(sigma, PROBE_STATS_MIN_SIGMA)) outliers++;
+  }
+
+  data.z[data.head][i] = int16_t(LROUND(constrain(z * 1000.0f, -32767.0f, 32767.0f)));
+}
+
+void ProbeStats::end_run() {
+  if (!running) return;
+  running = false;
+
+  data.head = (data.head + 1) % PROBE_STATS_RUNS;
+  data.count++;
+
+  TERN_(HAS_MEDIA, save());
+
+  SERIAL_ECHOPGM("Probe stats: Run ", data.count);
+  if (drifted) {
+    const float warp = drift_max - drift_min;
+    SERIAL_ECHOPGM(" Drift:", p_float_t(drift_sum / drifted, 3), " Warp:", p_float_t(warp, 3), " Outliers:", outliers);
+    if (warp > PROBE_STATS_REPROBE_MM) SERIAL_ECHOPGM(" Bed shape changed.");
+  }
+  SERIAL_EOL();
+}
+
+/**
+ * Report the mean and sigma of each grid point over the saved runs,
+ * and the drift of the newest run from the runs before it.
+ */
+void ProbeStats::report() {
+  if (!data.count) { SERIAL_ECHOLNPGM("Probe stats: No runs."); return; }
+
+  SERIAL_ECHOLNPGM("Probe stats: ", data.count, " runs");
+  float sigma_max = 0;
+  for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y) {
+    for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x) {
+      const grid_count_t i = index(x, y);
+      float mean, sigma;
+      uint8_t n;
+      if (!point_stats(i, 0, mean, sigma, n)) continue;
+      NOLESS(sigma_max, sigma);
+      SERIAL_ECHOPGM("X", x, " Y", y, " N", n, " Mean:", p_float_t(mean, 3), " Sigma:", p_float_t(sigma, 3));
+      const int16_t newest = data.z[(data.head + PROBE_STATS_RUNS - 1) % PROBE_STATS_RUNS][i];
+      if (newest != NO_Z && point_stats(i, 1, mean, sigma, n))
+        SERIAL_ECHOPGM(" Drift:", p_float_t(newest * 0.001f - mean, 3));
+      SERIAL_EOL();
+    }
+  }
+  SERIAL_ECHOPGM("Max Sigma:", p_float_t(sigma_max, 3));
+  if (drifted) SERIAL_ECHOPGM(" Warp:", p_float_t(drift_max - drift_min, 3), " Outliers:", outliers);
+  SERIAL_EOL();
+}
+
+#if HAS_MEDIA
+
+  void ProbeStats::load() {
+    MediaFile root = card.getroot(), file;
+    if (!file.open(&root, PROBE_STATS_FILE, O_READ)) return;
+    const bool good = file.read(&data, sizeof(data)) == int16_t(sizeof(data))
+      && data.magic == PROBE_STATS_MAGIC && data.runs == PROBE_STATS_RUNS
+      && data.grid_x == GRID_MAX_POINTS_X && data.grid_y == GRID_MAX_POINTS_Y
+      && data.head < PROBE_STATS_RUNS && data.count <= PROBE_STATS_RUNS;
+    file.close();
+    if (!good) reset();
+  }
+
+  void ProbeStats::save() {
+    if (!card.isMounted()) return;
+    MediaFile root = card.getroot(), file;
+    if (!file.open(&root, PROBE_STATS_FILE, O_CREAT | O_WRITE | O_TRUNC)) return;
+    if (file.write(&data, sizeof(data)) != int16_t(sizeof(data))) SERIAL_ECHOLNPGM("Probe stats: Write failed.");
+    file.close();
+  }
+
+#endif // HAS_MEDIA
+
+#endif // PROBE_STATISTICS
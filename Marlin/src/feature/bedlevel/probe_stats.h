@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_stats.h - Repeatability and drift of the leveling grid heights
+ *
+ * Bilinear ABL G29 and UBL G29 P1 hand each probed height to ProbeStats.
+ * The heights of the last PROBE_STATS_RUNS complete runs are kept per grid
+ * point (in microns) so the mean and sigma of each point are known. As the
+ * points of a new run arrive their drift from that mean is summed, and
+ * outliers are counted, so the run can be judged as soon as it ends.
+ * With SD support the runs are saved to the card after each run.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+class ProbeStats {
+  public:
+    // Start, add to, and finish a G29 run on the given grid
+    static void begin_run(const xy_pos_t &origin, const xy_pos_t &spacing);
+    static void add(const uint8_t x, const uint8_t y, const float z);
+    static void end_run();
+
+    static void reset();
+    static void report();
+
+    #if HAS_MEDIA
+      static void load();
+      static void save();
+    #endif
+
+  private:
+    static constexpr int16_t NO_Z = INT16_MIN;  // Point not probed in a run
+
+    typedef struct {
+      uint16_t magic;
+      uint8_t grid_x, grid_y, runs;
+      uint8_t head, count;                      // Slot of the run being probed, and the number of complete runs
+      xy_pos_t origin, spacing;                 // Grid of the saved runs
+      int16_t z[PROBE_STATS_RUNS][GRID_MAX_POINTS]; // Heights (microns) of each run
+    } stats_t;
+
+    static stats_t data;
+    static bool loaded, running;
+
+    // Drift summary of the last run
+    static float drift_sum, drift_min, drift_max;
+    static grid_count_t drifted, outliers;
+
+    static grid_count_t index(const uint8_t x, const uint8_t y) { return grid_count_t(y) * (GRID_MAX_POINTS_X) + x; }
+    static bool point_stats(const grid_count_t i, const uint8_t skip, float &mean, float &sigma, uint8_t &n);
+};
+
+extern ProbeStats probe_stats;
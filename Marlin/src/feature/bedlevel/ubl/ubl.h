@@ -41,10 +41,6 @@ struct mesh_index_pair;
 #define MESH_X_DIST (float((MESH_MAX_X) - (MESH_MIN_X)) / (GRID_MAX_CELLS_X))
 #define MESH_Y_DIST (float((MESH_MAX_Y) - (MESH_MIN_Y)) / (GRID_MAX_CELLS_Y))
 
-#if ENABLED(OPTIMIZED_MESH_STORAGE)
-  typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-#endif
-
 typedef struct {
   bool      C_seen;
   int8_t    KLS_storage_slot;
@@ -112,10 +108,6 @@ public:
   static int8_t storage_slot;
 
   static bed_mesh_t z_values;
-  #if ENABLED(OPTIMIZED_MESH_STORAGE)
-    static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
-    static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
-  #endif
   static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                      _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
 
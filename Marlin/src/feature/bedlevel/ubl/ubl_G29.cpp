@@ -48,6 +48,14 @@
   #include "../hilbert_curve.h"
 #endif
 
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+  #include "../probe_order.h"
+#endif
+
+#if ENABLED(PROBE_STATISTICS)
+  #include "../probe_stats.h"
+#endif
+
 #if ENABLED(FT_MOTION)
   #include "../../../module/ft_motion.h"
 #endif
@@ -382,7 +390,7 @@ void unified_bed_leveling::G29() {
         // find_closest_mesh_point (which only returns REAL points).
         if (closest.pos.x < 0) { invalidate_all = true; break; }
         z_values[closest.pos.x][closest.pos.y] = NAN;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(closest.pos, 0.0f));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(closest.pos, 0.0f));
       }
     }
     if (invalidate_all) {
@@ -411,7 +419,7 @@ void unified_bed_leveling::G29() {
           const float p1 = 0.5f * (GRID_MAX_POINTS_X) - x,
                       p2 = 0.5f * (GRID_MAX_POINTS_Y) - y;
           z_values[x][y] += 2.0f * HYPOT(p1, p2);
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+          TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
         }
         break;
 
@@ -421,8 +429,8 @@ void unified_bed_leveling::G29() {
           z_values[x][x] += 9.999f;
           z_values[x][x2] += 9.999f; // We want the altered line several mesh points thick
           #if ENABLED(EXTENSIBLE_UI)
-            ExtUI::onMeshUpdate(x, x, z_values[x][x]);
-            ExtUI::onMeshUpdate(x, x2, z_values[x][x2]);
+            ExtUI::queueMeshUpdate(x, x, z_values[x][x]);
+            ExtUI::queueMeshUpdate(x, x2, z_values[x][x2]);
           #endif
         }
         break;
@@ -432,7 +440,7 @@ void unified_bed_leveling::G29() {
         for (uint8_t x = (GRID_MAX_POINTS_X) / 3; x < 2 * (GRID_MAX_POINTS_X) / 3; x++)     // Create a rectangular raised area in
           for (uint8_t y = (GRID_MAX_POINTS_Y) / 3; y < 2 * (GRID_MAX_POINTS_Y) / 3; y++) { // the center of the bed
             z_values[x][y] += parser.seen_test('C') ? param.C_constant : 9.99f;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+            TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
           }
         break;
     }
@@ -568,7 +576,7 @@ void unified_bed_leveling::G29() {
               }
               else {
                 z_values[cpos.x][cpos.y] = param.C_constant;
-                TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(cpos, param.C_constant));
+                TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(cpos, param.C_constant));
               }
             }
           }
@@ -744,7 +752,7 @@ void unified_bed_leveling::adjust_mesh_to_mean(const bool cflag, const float off
     GRID_LOOP(x, y)
       if (!isnan(z_values[x][y])) {
         z_values[x][y] -= mean + offset;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
       }
 }
 
@@ -755,11 +763,20 @@ void unified_bed_leveling::shift_mesh_height(const float zoffs) {
   GRID_LOOP(x, y)
     if (!isnan(z_values[x][y])) {
       z_values[x][y] += zoffs;
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
     }
 }
 
 #if HAS_BED_PROBE
+
+  #if ENABLED(SELECTABLE_PROBE_ORDER)
+    // Only the invalid mesh points that can be reached by the probe
+    static bool probe_order_filter(const xy_int8_t &pt, void*) {
+      const xy_pos_t mpos = { bedlevel.get_mesh_x(pt.x), bedlevel.get_mesh_y(pt.y) };
+      return isnan(bedlevel.z_values[pt.x][pt.y]) && probe.can_reach(mpos);
+    }
+  #endif
+
   /**
    * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
    *   Probe all invalidated locations of the mesh that can be reached by the probe.
@@ -775,7 +792,15 @@ void unified_bed_leveling::shift_mesh_height(const float zoffs) {
     grid_count_t count = GRID_MAX_POINTS;
 
     mesh_index_pair best;
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
+    TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(best.pos, ExtUI::G29_START));
+
+    #if ENABLED(SELECTABLE_PROBE_ORDER)
+      probe_order.start(xy_uint8_t({ GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y }), xy_pos_t({ MESH_MIN_X, MESH_MIN_Y }),
+                        xy_pos_t({ MESH_X_DIST, MESH_Y_DIST }), xy_pos_t(current_position) + probe.offset_xy, probe_order_filter);
+    #endif
+
+    TERN_(PROBE_STATISTICS, probe_stats.begin_run(xy_pos_t({ MESH_MIN_X, MESH_MIN_Y }), xy_pos_t({ MESH_X_DIST, MESH_Y_DIST })));
+
     do {
       if (do_ubl_mesh_map) display_map(param.T_map_type);
 
@@ -800,26 +825,41 @@ void unified_bed_leveling::shift_mesh_height(const float zoffs) {
         #define HUGE_VALF __FLT_MAX__
       #endif
 
-      best = do_furthest // Points with valid data or HUGE_VALF are skipped
-        ? find_furthest_invalid_mesh_point()
-        : find_closest_mesh_point_of_type(INVALID, nearby, true);
+      #if ENABLED(SELECTABLE_PROBE_ORDER)
+        if (!do_furthest) {
+          // The next point in the order set with M215
+          xy_int8_t pt;
+          best.invalidate();
+          if (probe_order.next(pt)) best.pos = pt;
+        }
+        else
+          best = find_furthest_invalid_mesh_point();
+      #else
+        best = do_furthest // Points with valid data or HUGE_VALF are skipped
+          ? find_furthest_invalid_mesh_point()
+          : find_closest_mesh_point_of_type(INVALID, nearby, true);
+      #endif
 
       if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(best.pos, ExtUI::G29_POINT_START));
         const float measured_z = probe.probe_at_point(best.meshpos(), stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity);
         z_values[best.pos.x][best.pos.y] = isnan(measured_z) ? HUGE_VALF : measured_z;  // Mark invalid point already probed with HUGE_VALF to omit it in the next loop
+        TERN_(PROBE_STATISTICS, probe_stats.add(best.pos.x, best.pos.y, measured_z));
         #if ENABLED(EXTENSIBLE_UI)
-          ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
-          ExtUI::onMeshUpdate(best.pos, measured_z);
+          ExtUI::queueMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
+          ExtUI::queueMeshUpdate(best.pos, measured_z);
         #endif
       }
       SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
 
     } while (best.pos.x >= 0 && --count);
 
+    TERN_(SELECTABLE_PROBE_ORDER, if (!do_furthest) probe_order.report());
+    TERN_(PROBE_STATISTICS, probe_stats.end_run());
+
     GRID_LOOP(x, y) if (z_values[x][y] == HUGE_VALF) z_values[x][y] = NAN; // Restore NAN for HUGE_VALF marks
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_FINISH));
+    TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(best.pos, ExtUI::G29_FINISH));
 
     // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
     TERN_(HAS_MARLINUI_MENU, ui.release());
@@ -1003,7 +1043,7 @@ void set_message_with_feedback(FSTR_P const fstr) {
       z_values[lpos.x][lpos.y] = current_position.z - thick;
 
       // Tell the external UI to update
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, z_values[lpos.x][lpos.y]));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location, z_values[lpos.x][lpos.y]));
 
       if (param.V_verbosity > 2)
         SERIAL_ECHOLNPGM("Mesh Point Measured at: ", p_float_t(z_values[lpos.x][lpos.y], 6));
@@ -1111,7 +1151,7 @@ void set_message_with_feedback(FSTR_P const fstr) {
 
       // TODO: Re-enable leveling here so Z is correctly based on the updated mesh.
 
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, new_z));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location, new_z));
 
       serial_delay(20);                                   // No switch noise
       ui.refresh();
@@ -1441,7 +1481,7 @@ bool unified_bed_leveling::smart_fill_one(const uint8_t x, const uint8_t y, cons
       const float v2 = z_values[dx + xdir][dy + ydir];
       if (!isnan(v2)) {
         z_values[x][y] = v1 < v2 ? v1 : v1 + v1 - v2;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
         return true;
       }
     }
@@ -1640,7 +1680,7 @@ void unified_bed_leveling::smart_fill_mesh() {
       }
 
       z_values[i][j] = mz - lsf_results.D;
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, z_values[i][j]));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(i, j, z_values[i][j]));
     }
 
     if (DEBUGGING(LEVELING)) {
@@ -1701,6 +1741,21 @@ void unified_bed_leveling::smart_fill_mesh() {
 
     GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
 
+    #ifdef UBL_SMART_FILL_WINDOW
+      // w = 1 + weight_scaled / distance. The 1 is the same for every fit, so sum
+      // it once over all the points and add the distance part near each point.
+      constexpr uint8_t W = UBL_SMART_FILL_WINDOW;
+      struct linear_fit_data lsf_base;
+      incremental_LSF_reset(&lsf_base);
+      GRID_LOOP(jx, jy) if (TEST(bitmap[jx], jy)) incremental_LSF(&lsf_base, get_mesh_x(jx), get_mesh_y(jy), z_values[jx][jy]);
+
+      // The distance part for each offset within the window
+      float dist_weight[W + 1][W + 1];
+      for (uint8_t dx = 0; dx <= W; ++dx)
+        for (uint8_t dy = 0; dy <= W; ++dy)
+          dist_weight[dx][dy] = (dx || dy) ? weight_scaled / HYPOT(dx * (MESH_X_DIST), dy * (MESH_Y_DIST)) : 0;
+    #endif
+
     xy_pos_t ppos;
     for (uint8_t ix = 0; ix < GRID_MAX_POINTS_X; ++ix) {
       ppos.x = get_mesh_x(ix);
@@ -1708,26 +1763,36 @@ void unified_bed_leveling::smart_fill_mesh() {
         ppos.y = get_mesh_y(iy);
         if (isnan(z_values[ix][iy])) {
           // undefined mesh point at (ppos.x,ppos.y), compute weighted LSF from original valid mesh points.
-          incremental_LSF_reset(&lsf_results);
-          xy_pos_t rpos;
-          for (uint8_t jx = 0; jx < GRID_MAX_POINTS_X; ++jx) {
-            rpos.x = get_mesh_x(jx);
-            for (uint8_t jy = 0; jy < GRID_MAX_POINTS_Y; ++jy) {
-              if (TEST(bitmap[jx], jy)) {
-                rpos.y = get_mesh_y(jy);
-                const float rz = z_values[jx][jy],
-                             w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
-                incremental_WLSF(&lsf_results, rpos, rz, w);
+          #ifdef UBL_SMART_FILL_WINDOW
+            lsf_results = lsf_base;
+            const uint8_t x2 = _MIN(ix + W, GRID_MAX_POINTS_X - 1), y2 = _MIN(iy + W, GRID_MAX_POINTS_Y - 1);
+            for (uint8_t jx = ix > W ? ix - W : 0; jx <= x2; ++jx)
+              for (uint8_t jy = iy > W ? iy - W : 0; jy <= y2; ++jy)
+                if (TEST(bitmap[jx], jy))
+                  incremental_WLSF(&lsf_results, get_mesh_x(jx), get_mesh_y(jy), z_values[jx][jy],
+                                   dist_weight[ABS(jx - ix)][ABS(jy - iy)]);
+          #else
+            incremental_LSF_reset(&lsf_results);
+            xy_pos_t rpos;
+            for (uint8_t jx = 0; jx < GRID_MAX_POINTS_X; ++jx) {
+              rpos.x = get_mesh_x(jx);
+              for (uint8_t jy = 0; jy < GRID_MAX_POINTS_Y; ++jy) {
+                if (TEST(bitmap[jx], jy)) {
+                  rpos.y = get_mesh_y(jy);
+                  const float rz = z_values[jx][jy],
+                               w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
+                  incremental_WLSF(&lsf_results, rpos, rz, w);
+                }
               }
             }
-          }
+          #endif
           if (finish_incremental_LSF(&lsf_results)) {
             SERIAL_ECHOLNPGM(" Insufficient data");
             return;
           }
           const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
           z_values[ix][iy] = ez;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
+          TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(ix, iy, z_values[ix][iy]));
           idle(); // housekeeping
         }
       }
@@ -1864,7 +1929,7 @@ void unified_bed_leveling::smart_fill_mesh() {
 
     GRID_LOOP(x, y) {
       z_values[x][y] -= tmp_z_values[x][y];
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, z_values[x][y]));
     }
   }
 
@@ -134,12 +134,18 @@
     xy_uint8_t icell = istart;
 
     const float ratio = dist.y / dist.x,        // Allow divide by zero
+                inverse_ratio = dist.x / dist.y,  // Multiply instead of divide for each mesh line crossed
                 c = start.y - ratio * start.x;
 
     const bool inf_ratio_flag = isinf(ratio);
 
+    // The fade factor is the same for all segments
+    const float fade_scaling_factor = planner.fade_scaling_factor_for_z(end.z);
+
     xyze_pos_t dest; // Stores XYZE for segmented moves
 
+    TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+
     /**
      * Handle vertical lines that stay within one column.
      * These need not be perfectly vertical.
@@ -155,10 +161,9 @@
          * For others the next X is the same so this can continue.
          * Calculate X at the next Y mesh line.
          */
-        dest.x = inf_ratio_flag ? start.x : (next_mesh_line_y - c) / ratio;
+        dest.x = inf_ratio_flag ? start.x : (next_mesh_line_y - c) * inverse_ratio;
 
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x, icell.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
+        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x, icell.y) * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -210,8 +215,7 @@
         dest.x = get_mesh_x(icell.x);
         dest.y = ratio * dest.x + c;    // Calculate Y at the next X mesh line
 
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x, icell.y)
-                     * planner.fade_scaling_factor_for_z(end.z);
+        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x, icell.y) * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
@@ -256,26 +260,27 @@
 
     icell += ineg;
 
-    while (cnt) {
-
-      const float next_mesh_line_x = get_mesh_x(icell.x + iadd.x),
-                  next_mesh_line_y = get_mesh_y(icell.y + iadd.y);
+    // The intercepts with the next X and Y mesh lines. Only the one crossed is updated,
+    // stepping across the cells with one multiply-add per mesh line.
+    float next_mesh_line_x = get_mesh_x(icell.x + iadd.x),
+          next_mesh_line_y = get_mesh_y(icell.y + iadd.y),
+          y_at_x_line = ratio * next_mesh_line_x + c,             // Y at the next X mesh line
+          x_at_y_line = (next_mesh_line_y - c) * inverse_ratio;   // X at the next Y mesh line
+                                                                  // (No need to worry about ratio == 0.
+                                                                  //  In that case, it was already detected
+                                                                  //  as a vertical line move above.)
 
-      dest.y = ratio * next_mesh_line_x + c;    // Calculate Y at the next X mesh line
-      dest.x = (next_mesh_line_y - c) / ratio;  // Calculate X at the next Y mesh line
-                                                // (No need to worry about ratio == 0.
-                                                //  In that case, it was already detected
-                                                //  as a vertical line move above.)
+    while (cnt) {
 
-      if (neg.x == (dest.x > next_mesh_line_x)) { // Check if we hit the Y line first
+      if (neg.x == (x_at_y_line > next_mesh_line_x)) { // Check if we hit the Y line first
         // Yes!  Crossing a Y Mesh Line next
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x - ineg.x, icell.y + iadd.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
+        float z0 = z_correction_for_x_on_horizontal_mesh_line(x_at_y_line, icell.x - ineg.x, icell.y + iadd.y) * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
         if (isnan(z0)) z0 = 0.0;
 
+        dest.x = x_at_y_line;
         dest.y = next_mesh_line_y;
 
         if (!inf_normalized_flag) {
@@ -293,17 +298,19 @@
 
         icell.y += iadd.y;
         cnt.y--;
+        next_mesh_line_y = get_mesh_y(icell.y + iadd.y);
+        x_at_y_line = (next_mesh_line_y - c) * inverse_ratio;
       }
       else {
         // Yes!  Crossing a X Mesh Line next
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x + iadd.x, icell.y - ineg.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
+        float z0 = z_correction_for_y_on_vertical_mesh_line(y_at_x_line, icell.x + iadd.x, icell.y - ineg.y) * fade_scaling_factor;
 
         // Undefined parts of the Mesh in z_values[][] are NAN.
         // Replace NAN corrections with 0.0 to prevent NAN propagation.
         if (isnan(z0)) z0 = 0.0;
 
         dest.x = next_mesh_line_x;
+        dest.y = y_at_x_line;
 
         if (!inf_normalized_flag) {
           on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
@@ -320,6 +327,8 @@
 
         icell.x += iadd.x;
         cnt.x--;
+        next_mesh_line_x = get_mesh_x(icell.x + iadd.x);
+        y_at_x_line = ratio * next_mesh_line_x + c;
       }
 
       if (cnt.x < 0 || cnt.y < 0) break; // Too far! Exit the loop and go to FINAL_MOVE
@@ -386,6 +395,8 @@
 
     xyze_pos_t raw = current_position;
 
+    TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
       while (--segments) {
@@ -0,0 +1,217 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/binary_gcode.cpp - Read binary G-code (.bgcode) job files
+ *
+ * While printing, the G-code blocks are decompressed (heatshrink 12/4) and
+ * unpacked (MeatPack) a little at a time into the CardReader decode buffer,
+ * with the CRC of each block checked at its end. Metadata and thumbnail
+ * blocks are skipped. Heatshrink 11/4 and deflate aren't supported.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_BINARY_GCODE)
+
+#include "binary_gcode.h"
+#include "../sd/cardreader.h"
+#include "../libs/crc32.h"
+
+BinaryGcode bgcode;
+
+bool BinaryGcode::has_crc, BinaryGcode::in_gcode;
+BinaryGcode::block_t BinaryGcode::block;
+uint32_t BinaryGcode::left, BinaryGcode::crc;
+uint8_t BinaryGcode::dbuf[32];
+uint8_t BinaryGcode::dlen, BinaryGcode::dindex;
+MeatPack BinaryGcode::meatpack;
+char BinaryGcode::mp_out[2];
+uint8_t BinaryGcode::mp_count, BinaryGcode::mp_index;
+
+static uint16_t le16(const uint8_t * const p) { return p[0] | uint16_t(p[1]) << 8; }
+static uint32_t le32(const uint8_t * const p) { return le16(p) | uint32_t(le16(p + 2)) << 16; }
+
+static bool parse_file_header(const uint8_t * const h, bool &has_crc) {
+  if (h[0] != 'G' || h[1] != 'C' || h[2] != 'D' || h[3] != 'E' || le32(h + 4) != 1) return false;
+  has_crc = le16(h + 8) == 1;   // CRC-32
+  return true;
+}
+
+// Read a block header and its parameters with read(buf, n)
+template<typename F>
+static bool parse_block(F read, BinaryGcode::block_t &b) {
+  uint8_t h[8];
+  if (!read(h, 8)) return false;
+  b.type = le16(h);
+  b.compression = le16(h + 2);
+  b.size = b.stored = le32(h + 4);
+  if (b.compression != BinaryGcode::COMP_NONE) {
+    if (!read(h, 4)) return false;
+    b.stored = le32(h);
+  }
+  const uint8_t np = b.type == BinaryGcode::BLOCK_THUMBNAIL ? 3 : 1;
+  if (!read(h, np * 2)) return false;
+  for (uint8_t i = 0; i < COUNT(b.param); ++i) b.param[i] = i < np ? le16(h + i * 2) : 0;
+  return true;
+}
+
+bool BinaryGcode::read_file_header(MediaFile &file, bool &has_crc) {
+  uint8_t h[FILE_HEADER_SIZE];
+  return file.read(h, sizeof(h)) == sizeof(h) && parse_file_header(h, has_crc);
+}
+
+bool BinaryGcode::read_block(MediaFile &file, const uint32_t pos, const bool has_crc, block_t &b) {
+  if (pos >= file.fileSize() || !file.seekSet(pos)) return false;
+  if (!parse_block([&](void * const buf, const uint8_t n) { return file.read(buf, n) == n; }, b)) return false;
+  b.data = file.curPosition();
+  b.next = b.data + b.stored + (has_crc ? 4 : 0);
+  return b.next <= file.fileSize();
+}
+
+// Read bytes of the open file, adding them to the CRC of the block
+bool BinaryGcode::read_raw(void * const dst, const uint8_t n, const bool with_crc/*=true*/) {
+  uint8_t * const p = (uint8_t *)dst;
+  for (uint8_t i = 0; i < n; ++i) {
+    if (CardReader::sdpos >= CardReader::filesize) return false;
+    const int16_t c = CardReader::raw_get();
+    if (c < 0) return false;
+    p[i] = c;
+  }
+  if (with_crc) crc = crc32(crc, p, n);
+  return true;
+}
+
+bool BinaryGcode::start() {
+  CardReader::raw_seek(0);
+  in_gcode = false;
+  dlen = dindex = mp_count = 0;
+  uint8_t h[FILE_HEADER_SIZE];
+  if (read_raw(h, sizeof(h), false) && parse_file_header(h, has_crc)) return true;
+  CardReader::raw_seek(0);
+  return false;
+}
+
+// Stop reading the file and abort the print
+void BinaryGcode::fail() {
+  in_gcode = false;
+  CardReader::raw_seek(CardReader::filesize);
+  card.abortFilePrintSoon();
+}
+
+// Go to the next G-code block, skipping the others. False at the end of the file.
+bool BinaryGcode::next_gcode_block() {
+  for (;;) {
+    crc = 0;
+    if (!parse_block([](void * const buf, const uint8_t n) { return read_raw(buf, n); }, block)) return false;
+    block.data = CardReader::sdpos;
+    block.next = block.data + block.stored + (has_crc ? 4 : 0);
+    if (block.next > CardReader::filesize) {
+      SERIAL_ERROR_MSG("Binary G-code block at ", block.data, " is cut short.");
+      fail();
+      return false;
+    }
+    if (block.type != BLOCK_GCODE) { CardReader::raw_seek(block.next); continue; }
+
+    if (block.compression != COMP_NONE && block.compression != COMP_HEATSHRINK_12_4) {
+      SERIAL_ERROR_MSG("Binary G-code compression ", block.compression, " is not supported.");
+      fail();
+      return false;
+    }
+    if (block.param[0] > ENC_MEATPACK_COMMENTS) {
+      SERIAL_ERROR_MSG("Binary G-code encoding ", block.param[0], " is not supported.");
+      fail();
+      return false;
+    }
+
+    left = block.stored;
+    if (block.compression != COMP_NONE) heatshrink_decoder_reset(&CardReader::hsd);
+    meatpack.reset_state();                                   // Each block is packed on its own
+    meatpack.handle_command(MPCommand_DisableNoSpaces, false);
+    in_gcode = true;
+    return true;
+  }
+}
+
+// Check the CRC after the data of the block
+bool BinaryGcode::end_block() {
+  in_gcode = false;
+  if (!has_crc) return true;
+  uint8_t c[4];
+  if (read_raw(c, sizeof(c), false) && le32(c) == crc) return true;
+  SERIAL_ERROR_MSG("Binary G-code CRC error in the block at ", block.data, ".");
+  fail();
+  return false;
+}
+
+// Decompress the next part of the block's data. False when the data is used up.
+bool BinaryGcode::refill() {
+  dlen = dindex = 0;
+  if (block.compression == COMP_NONE) {
+    const uint8_t n = _MIN(left, uint32_t(sizeof(dbuf)));
+    if (!n || !read_raw(dbuf, n)) return false;
+    left -= n;
+    dlen = n;
+    return true;
+  }
+  for (;;) {
+    size_t count;
+    if (heatshrink_decoder_poll(&CardReader::hsd, dbuf, sizeof(dbuf), &count) < 0) return false;
+    if (count) { dlen = count; return true; }
+
+    // The decoder input is empty, so a whole input buffer can be sunk
+    if (!left) return false;
+    uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+    const uint8_t n = _MIN(left, uint32_t(sizeof(in)));
+    if (!read_raw(in, n)) return false;
+    left -= n;
+    heatshrink_decoder_sink(&CardReader::hsd, in, n, &count);
+  }
+}
+
+uint16_t BinaryGcode::fill(uint8_t * const buf, const uint16_t len) {
+  uint16_t n = 0;
+  while (n < len) {
+    if (mp_count) {
+      buf[n++] = mp_out[mp_index++];
+      mp_count--;
+      continue;
+    }
+    if (dindex >= dlen) {
+      if (in_gcode && refill()) continue;
+      if (in_gcode && !end_block()) break;
+      if (!next_gcode_block()) break;
+      continue;
+    }
+    const uint8_t c = dbuf[dindex++];
+    if (block.param[0] == ENC_NONE)
+      buf[n++] = c;
+    else {
+      meatpack.handle_rx_char(c, serial_index_t());           // No serial index, so commands aren't reported
+      mp_count = meatpack.get_result_char(mp_out);
+      mp_index = 0;
+    }
+  }
+  return n;
+}
+
+#endif // SD_BINARY_GCODE
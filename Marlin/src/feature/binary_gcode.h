@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/binary_gcode.h - Read binary G-code (.bgcode) job files
+ *
+ * A binary G-code file is a header followed by blocks of metadata, thumbnails
+ * and G-code, each with its own CRC-32:
+ *
+ *   File header   "GCDE", version (u32), checksum type (u16)
+ *   Block header  type (u16), compression (u16), size (u32), [compressed size (u32)]
+ *   Parameters    encoding (u16), or for a thumbnail format, width, height (u16 each)
+ *   Data          size or compressed size bytes
+ *   Checksum      CRC-32 of the header, parameters and data (if the file has checksums)
+ *
+ * All values are little-endian.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "meatpack.h"
+
+class SdFile;
+
+class BinaryGcode {
+  public:
+    enum BlockType : uint16_t {
+      BLOCK_FILE_METADATA, BLOCK_GCODE, BLOCK_SLICER_METADATA,
+      BLOCK_PRINTER_METADATA, BLOCK_PRINT_METADATA, BLOCK_THUMBNAIL
+    };
+    enum Compression : uint16_t { COMP_NONE, COMP_DEFLATE, COMP_HEATSHRINK_11_4, COMP_HEATSHRINK_12_4 };
+    enum Encoding : uint16_t { ENC_NONE, ENC_MEATPACK, ENC_MEATPACK_COMMENTS }; // G-code. Metadata is always INI.
+    enum ThumbFormat : uint16_t { THUMB_PNG, THUMB_JPG, THUMB_QOI };
+
+    static constexpr uint8_t FILE_HEADER_SIZE = 10;
+
+    typedef struct {
+      uint16_t type, compression;
+      uint32_t size,          // Data bytes after decompression
+               stored;        // Data bytes in the file
+      uint16_t param[3];      // The encoding, or the thumbnail format, width and height
+      uint32_t data,          // File position of the data
+               next;          // File position of the next block
+    } block_t;
+
+    // Read the file header of a file at its start. False if it isn't binary G-code.
+    static bool read_file_header(SdFile &file, bool &has_crc);
+
+    // Read the block header at a file position, leaving the file at the data. False at the end.
+    static bool read_block(SdFile &file, const uint32_t pos, const bool has_crc, block_t &b);
+
+    // The G-code of the file CardReader has open, decoded block by block as it's read.
+    // Start at the beginning of the file. False if it isn't binary G-code.
+    static bool start();
+    // Decode up to len bytes of G-code into buf. 0 at the end of the file or on an error.
+    static uint16_t fill(uint8_t * const buf, const uint16_t len);
+
+  private:
+    static bool has_crc, in_gcode;
+    static block_t block;         // The G-code block being read
+    static uint32_t left,         // Data bytes not yet read from the block
+                    crc;          // CRC of the block so far
+    static uint8_t dbuf[32];      // Decompressed data
+    static uint8_t dlen, dindex;
+    static MeatPack meatpack;
+    static char mp_out[2];        // MeatPack output not yet returned
+    static uint8_t mp_count, mp_index;
+
+    static bool read_raw(void * const dst, const uint8_t n, const bool with_crc=true);
+    static bool next_gcode_block();
+    static bool end_block();
+    static bool refill();
+    static void fail();
+};
+
+extern BinaryGcode bgcode;
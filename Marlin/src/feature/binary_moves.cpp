@@ -0,0 +1,159 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Binary Move Commands
+ * G0/G1 moves in a fixed-point binary frame, queued without the G-code parser.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_MOVE_COMMANDS)
+
+#include "binary_moves.h"
+#include "../gcode/gcode.h"
+#include "../module/motion.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "cancel_object.h"
+#endif
+
+#if ENABLED(FWRETRACT_BLEND)
+  #include "fwretract.h"
+#endif
+
+#if ENABLED(PASSWORD_FEATURE)
+  #include "password/password.h"
+#endif
+
+#if ENABLED(PRINTCOUNTER)
+  #include "../module/printcounter.h"
+#endif
+
+#if ENABLED(VARIABLE_G0_FEEDRATE)
+  extern feedRate_t fast_move_feedrate;
+#endif
+
+bool BinaryMoves::valid(const uint8_t * const frame) {
+  if (frame[1] > OP_G1) return false;
+  const uint8_t size = frame_size(frame[2]);
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i < size - 1; ++i) sum ^= frame[i];
+  return sum == frame[size - 1];
+}
+
+void BinaryMoves::execute(const char * const cmd) {
+  #if ENABLED(PASSWORD_FEATURE)
+    if (password.is_locked) { SERIAL_ECHO_MSG(STR_PRINTER_LOCKED); return; }
+  #endif
+
+  if (!MOTION_CONDITIONS) return;
+
+  TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_RUNNING));
+
+  const uint8_t * const frame = (const uint8_t*)cmd, fields = frame[2];
+  const uint8_t *p = frame + HEADER_SIZE;
+
+  #ifdef G0_FEEDRATE
+    const bool fast_move = frame[1] == OP_G0;
+    feedRate_t old_feedrate = feedrate_mm_s;
+    #if ENABLED(VARIABLE_G0_FEEDRATE)
+      if (fast_move) feedrate_mm_s = fast_move_feedrate;  // Get G0 feedrate from last usage
+    #endif
+  #endif
+
+  // Get the destination, as in GcodeSuite::get_destination_from_command
+  const bool skip_move = TERN0(CANCEL_OBJECTS, cancelable.state.skipping);
+  destination = current_position;
+  for (uint8_t f = 0; f < FIELD_COUNT; ++f) {
+    if (!TEST(fields, f)) continue;
+    const float v = get_value(p) * UNIT;
+    p += 4;
+    switch (f) {
+      case FIELD_X: case FIELD_Y: case FIELD_Z:
+        if (f >= NUM_AXES) break;
+        #if ENABLED(CANCEL_OBJECTS)
+          if (skip_move) {
+            cancelable.skip_position[f] = GcodeSuite::axis_is_relative(AxisEnum(f)) ? cancelable.skip_position[f] + v : LOGICAL_TO_NATIVE(v, f);
+            break;
+          }
+        #endif
+        destination[f] = GcodeSuite::axis_is_relative(AxisEnum(f)) ? current_position[f] + v : LOGICAL_TO_NATIVE(v, f);
+        break;
+      #if HAS_EXTRUDERS
+        case FIELD_E: destination.e = GcodeSuite::axis_is_relative(E_AXIS) ? current_position.e + v : v; break;
+      #endif
+      case FIELD_F: if (v > 0) feedrate_mm_s = MMM_TO_MMS(v); break;
+    }
+  }
+
+  #if ALL(PRINTCOUNTER, HAS_EXTRUDERS)
+    if (!DEBUGGING(DRYRUN) && !skip_move)
+      print_job_timer.incFilamentUsed(destination.e - current_position.e);
+  #endif
+
+  #ifdef G0_FEEDRATE
+    if (fast_move) {
+      #if ENABLED(VARIABLE_G0_FEEDRATE)
+        fast_move_feedrate = feedrate_mm_s;       // Save feedrate for the next G0
+      #else
+        old_feedrate = feedrate_mm_s;             // Back up the (new) motion mode feedrate
+        feedrate_mm_s = MMM_TO_MMS(G0_FEEDRATE);  // Get the fixed G0 feedrate
+      #endif
+    }
+  #endif
+
+  TERN_(FWRETRACT_BLEND, fwretract.start_retract_with_move(!skip_move));
+
+  if (skip_move) {
+    // A canceled object's move only follows E, without a planner block
+    current_position.e = destination.e;
+    sync_plan_position_e();
+  }
+  else {
+    #if ANY(IS_SCARA, POLAR)
+      frame[1] == OP_G0 ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+    #else
+      prepare_line_to_destination();
+    #endif
+  }
+
+  #ifdef G0_FEEDRATE
+    if (fast_move) feedrate_mm_s = old_feedrate;  // Restore the motion mode feedrate
+  #endif
+
+  TERN_(FULL_REPORT_TO_HOST_FEATURE, report_current_grblstate_moving());
+}
+
+void BinaryMoves::to_gcode(const char * const cmd, MString<MAX_CMD_SIZE> &gcode) {
+  const uint8_t * const frame = (const uint8_t*)cmd, fields = frame[2];
+  const uint8_t *p = frame + HEADER_SIZE;
+  gcode.set('G', frame[1]);
+  for (uint8_t f = 0; f < FIELD_COUNT; ++f) {
+    if (!TEST(fields, f)) continue;
+    gcode.append(' ', "XYZEF"[f], p_float_t(get_value(p) * UNIT, 4));
+    p += 4;
+  }
+}
+
+#endif // BINARY_MOVE_COMMANDS
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_moves.h - Binary G0/G1 move commands
+ *
+ * A compact binary frame for linear moves that skips the G-code parser.
+ * Hosts that see the BINARY_MOVES capability in M115 may send these frames in
+ * place of G0/G1 lines. A frame is only recognized at the start of a line:
+ *
+ *   Byte 0     : 0xFE sync
+ *   Byte 1     : Opcode (0 = G0, 1 = G1)
+ *   Byte 2     : Fields present, bits 0-4 = X Y Z E F
+ *   Bytes 3-4  : Line number, low 16 bits
+ *   Then       : One int32 for each field present, in 1/10000 mm (F in 1/10000 mm/min)
+ *   Last byte  : XOR of all the preceding bytes
+ *
+ * All values are little-endian. Frames are queued in order with G-code lines and
+ * answered with "ok". A bad checksum or line number requests a resend, as for a
+ * G-code line. Values are always in mm. G90/G91, M82/M83 and workspace offsets
+ * apply as they do for G0/G1.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../core/mstring.h"
+
+class BinaryMoves {
+  public:
+    static constexpr uint8_t SYNC = 0xFE,
+                             HEADER_SIZE = 5;   // Sync, opcode, fields, line number
+    static constexpr float UNIT = 0.0001f;      // Value of one count in a field
+
+    enum Opcode : uint8_t { OP_G0, OP_G1 };
+    enum Field : uint8_t { FIELD_X, FIELD_Y, FIELD_Z, FIELD_E, FIELD_F, FIELD_COUNT };
+
+    // Size of a whole frame with the given fields byte
+    static uint8_t frame_size(const uint8_t fields) {
+      uint8_t n = HEADER_SIZE + 1;
+      for (uint8_t f = 0; f < FIELD_COUNT; ++f) if (TEST(fields, f)) n += 4;
+      return n;
+    }
+
+    // Called on a complete frame. Check the opcode and the checksum.
+    static bool valid(const uint8_t * const frame);
+
+    static uint16_t line_number(const uint8_t * const frame) { return frame[3] | (frame[4] << 8); }
+
+    // Is this queued command a binary move?
+    static bool is_move(const char * const cmd) { return uint8_t(cmd[0]) == SYNC; }
+
+    // Run a queued binary move
+    static void execute(const char * const cmd);
+
+    // Write a queued binary move as a G-code line
+    static void to_gcode(const char * const cmd, MString<MAX_CMD_SIZE> &gcode);
+
+  private:
+    static int32_t get_value(const uint8_t * const p) {
+      return int32_t(uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24));
+    }
+};
@@ -33,4 +33,8 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+#if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+  BinaryStream::Slot BinaryStream::slot[BINARY_STREAM_WINDOW];
+#endif
+
 #endif
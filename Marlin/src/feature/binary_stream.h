@@ -250,10 +250,29 @@ public:
     }
   } packet{};
 
+  #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+    // A packet of the window, held until all the packets before it have arrived
+    struct Slot {
+      Packet::Header header;
+      bool ready;
+      char data[MAX_CMD_SIZE];
+    };
+    static Slot slot[BINARY_STREAM_WINDOW]; // Shared by all ports, only one can transfer at a time
+
+    Slot& slot_for(const uint8_t ahead) { return slot[(head_slot + ahead) % (BINARY_STREAM_WINDOW)]; }
+
+    void clear_slots() {
+      for (Slot &s : slot) s.ready = false;
+      head_slot = 0;
+      gap_reported = false;
+    }
+  #endif
+
   void reset() {
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    TERN_(BINARY_STREAM_SELECTIVE_REPEAT, clear_slots());
   }
 
   // fletchers 16 checksum
@@ -297,7 +316,10 @@ public:
           packet.reset();
           stream_state = StreamState::PACKET_WAIT;
         case StreamState::PACKET_WAIT:
-          if (!stream_read(data)) { idle(); return; }  // no active packet so don't wait
+          if (!stream_read(data)) {
+            if (TERN0(BINARY_STREAM_SELECTIVE_REPEAT, dispatch_next())) break; // handle held packets while the line is quiet
+            idle(); return;                                                    // no active packet so don't wait
+          }
           packet.header.data[1] = data;
           if (packet.header.token == packet.header.header_token) {
             packet.bytes_received = 2;
@@ -322,21 +344,37 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
-                  SERIAL_ECHOLN(F("ss"), sync, C(','), buffer_size, C(','), version_major, C('.'), version_minor, C('.'), version_patch);
+                  SERIAL_ECHOLN(F("ss"), sync, C(','), buffer_size, C(','), version_major, C('.'), version_minor, C('.'), version_patch
+                    OPTARG(BINARY_STREAM_WINDOW, C(','), BINARY_STREAM_WINDOW)
+                    OPTARG(BINARY_STREAM_SELECTIVE_REPEAT, F(",1"))
+                  );
+                  TERN_(BINARY_STREAM_SELECTIVE_REPEAT, clear_slots());
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
-              if (packet.header.sync == sync) {
+              #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+                const bool in_window = uint8_t(packet.header.sync - sync) < BINARY_STREAM_WINDOW,
+                           handled = !in_window && uint8_t(sync - packet.header.sync) <= BINARY_STREAM_WINDOW;
+              #else
+                const bool in_window = packet.header.sync == sync,
+                           handled = packet.header.sync == sync - 1;
+              #endif
+              if (in_window) {
                 buffer_next_index = 0;
                 packet.bytes_received = 0;
-                if (packet.header.size) {
-                  stream_state = StreamState::PACKET_DATA;
-                  packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
-                }
-                else
-                  stream_state = StreamState::PACKET_PROCESS;
+                #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+                  Slot &s = slot_for(packet.header.sync - sync);
+                  if (s.ready) {                                   // a copy is already held, drop this one
+                    stream_state = StreamState::PACKET_RESET;
+                    break;
+                  }
+                  packet.buffer = s.data;
+                #else
+                  packet.buffer = static_cast<char *>(&buffer[0]); // one packet at a time, always allocate whole buffer to packet
+                #endif
+                stream_state = packet.header.size ? StreamState::PACKET_DATA : StreamState::PACKET_PROCESS;
               }
-              else if (packet.header.sync == sync - 1) {           // ok response must have been lost
+              else if (handled) {                                  // ok response must have been lost
                 SERIAL_ECHOLNPGM("ok", packet.header.sync);  // transmit valid packet received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
               }
@@ -389,12 +427,26 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
-          sync++;
-          packet_retries = 0;
-          bytes_received += packet.header.size;
-
-          SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
-          dispatch();
+          #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+          {
+            // Hold the packet until those before it are handled, and ask only for a missing one
+            const uint8_t ahead = packet.header.sync - sync;
+            Slot &s = slot_for(ahead);
+            s.header = packet.header;
+            s.ready = true;
+            if (ahead && !slot[head_slot].ready && !gap_reported) {
+              gap_reported = true;
+              SERIAL_ECHOLNPGM("rs", sync);
+            }
+          }
+          #else
+            sync++;
+            packet_retries = 0;
+            bytes_received += packet.header.size;
+
+            SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
+            dispatch();
+          #endif
           stream_state = StreamState::PACKET_RESET;
           break;
         case StreamState::PACKET_RESEND:
@@ -403,6 +455,7 @@ public:
             stream_state = StreamState::PACKET_RESET;
             SERIAL_ECHO_MSG("Resend request ", packet_retries);
             SERIAL_ECHOLNPGM("rs", sync);
+            TERN_(BINARY_STREAM_SELECTIVE_REPEAT, gap_reported = true);
           }
           else
             stream_state = StreamState::PACKET_ERROR;
@@ -441,6 +494,31 @@ public:
     }
   }
 
+  #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+    // Hand the next packet of the stream to its protocol once it has arrived.
+    // The serial port keeps receiving the packets after it while the media is written.
+    bool dispatch_next() {
+      Slot &s = slot[head_slot];
+      if (!s.ready) return false;
+      s.ready = false;
+      head_slot = (head_slot + 1) % (BINARY_STREAM_WINDOW);
+      gap_reported = false;
+
+      const uint8_t token_start = packet.header.data[0]; // may be the first byte of the next packet
+      packet.header = s.header;
+      packet.buffer = s.data;
+      sync++;
+      packet_retries = 0;
+      bytes_received += packet.header.size;
+
+      SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
+      dispatch();
+      packet.reset();
+      packet.header.data[0] = token_start;
+      return true;
+    }
+  #endif
+
   void idle() {
     // Some Protocols may need periodic updates without new data
     SDFileTransferProtocol::idle();
@@ -450,6 +528,10 @@ public:
   uint8_t  packet_retries, sync;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
+  #if ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+    uint8_t head_slot;  // slot of the packet with the stream sync
+    bool gap_reported;  // 'rs' was sent for the missing packet
+  #endif
   StreamState stream_state = StreamState::PACKET_RESET;
 };
 
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Boot Profiler
+ * Record the start time of each step of setup() for M225.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BOOT_PROFILER)
+
+#include "boot_profile.h"
+
+BootProfile boot_profile;
+
+BootProfile::step_t BootProfile::steps[BOOT_PROFILER_STEPS];
+uint8_t BootProfile::count, BootProfile::dropped; // = 0
+
+void BootProfile::step(PGM_P const name) {
+  // When full, each step replaces the last one so the end of setup() is kept
+  if (count < BOOT_PROFILER_STEPS) count++; else if (dropped < 255) dropped++;
+  steps[count - 1] = { name, uint32_t(micros()) };
+}
+
+void BootProfile::report() {
+  if (!count) return;
+  SERIAL_ECHOLNPGM("Boot profile (us). setup() started ", steps[0].start_us, "us after reset.");
+  for (uint8_t i = 0; i + 1 < count; ++i) {
+    SERIAL_ECHOPGM(" ", steps[i + 1].start_us - steps[i].start_us, " ");
+    SERIAL_ECHOLNPGM_P(steps[i].name);
+  }
+  SERIAL_ECHOLNPGM(" Total:", steps[count - 1].start_us - steps[0].start_us, "us");
+  if (dropped) SERIAL_ECHOLNPGM(" Steps counted in the last one shown:", dropped);
+}
+
+#endif // BOOT_PROFILER
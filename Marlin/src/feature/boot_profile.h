@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * boot_profile.h - Time spent in each step of setup()
+ *
+ * Each SETUP_LOG / SETUP_RUN step records its start time, so a step lasts
+ * until the next one starts. Reported by M225 at any time after boot.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef BOOT_PROFILER_STEPS
+  #define BOOT_PROFILER_STEPS 48
+#endif
+
+class BootProfile {
+  public:
+    static void step(PGM_P const name);
+    static void report();
+
+  private:
+    typedef struct { PGM_P name; uint32_t start_us; } step_t;
+
+    static step_t steps[BOOT_PROFILER_STEPS];
+    static uint8_t count, dropped;
+};
+
+extern BootProfile boot_profile;
@@ -27,19 +27,42 @@
 #include "cancel_object.h"
 #include "../gcode/gcode.h"
 #include "../lcd/marlinui.h"
+#include "../module/motion.h"
 
 CancelObject cancelable;
 
 cancel_state_t CancelObject::state;
+xyze_pos_t CancelObject::skip_position;
+bool CancelObject::skip_started; // = false
+
+// Start skipping from the current position, or stop
+void CancelObject::set_skipping(const bool skip) {
+  if (skip && !skip_started) {
+    skip_position = current_position;
+    skip_started = true;
+  }
+  state.skipping = skip;
+}
+
+/**
+ * After the skipped moves of a canceled object, travel once to where they
+ * would have ended, including any Z change, then carry on with the next object.
+ */
+void CancelObject::finish_skip() {
+  skip_started = false;
+  destination = current_position;
+  LOOP_NUM_AXES(i) destination[i] = skip_position[i];
+  if (destination != current_position) prepare_line_to_destination();
+}
 
 void CancelObject::set_active_object(const int8_t obj) {
   state.active_object = obj;
   if (WITHIN(obj, 0, 31)) {
     if (obj >= state.object_count) state.object_count = obj + 1;
-    state.skipping = TEST(state.canceled, obj);
+    set_skipping(TEST(state.canceled, obj));
   }
   else
-    state.skipping = false;
+    set_skipping(false);
 
   #if ALL(HAS_STATUS_MESSAGE, CANCEL_OBJECTS_REPORTING)
     if (state.active_object >= 0)
@@ -52,14 +75,14 @@ void CancelObject::set_active_object(const int8_t obj) {
 void CancelObject::cancel_object(const int8_t obj) {
   if (WITHIN(obj, 0, 31)) {
     SBI(state.canceled, obj);
-    if (obj == state.active_object) state.skipping = true;
+    if (obj == state.active_object) set_skipping(true);
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
   if (WITHIN(obj, 0, 31)) {
     CBI(state.canceled, obj);
-    if (obj == state.active_object) state.skipping = false;
+    if (obj == state.active_object) set_skipping(false);
   }
 }
 
@@ -76,4 +99,69 @@ void CancelObject::report() {
   SERIAL_EOL();
 }
 
+#if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+
+  int8_t CancelObject::sd_object = -1;
+  char CancelObject::sd_word[5][16];
+
+  // The value of a parameter word starting at a space, or nullptr
+  static const char* find_word(const char *cmd, const char letter) {
+    for (++cmd; *cmd; ++cmd)
+      if (cmd[0] == letter && cmd[-1] == ' ' && (NUMERIC(cmd[1]) || cmd[1] == '-' || cmd[1] == '.')) return cmd + 1;
+    return nullptr;
+  }
+
+  // Copy the value of a parameter word, if present
+  static void copy_word(const char *cmd, const char letter, char * const out, const uint8_t size) {
+    const char *v = find_word(cmd, letter);
+    if (!v) return;
+    uint8_t i = 0;
+    for (; i < size - 1 && (NUMERIC(*v) || *v == '.' || *v == '-'); ++v) out[i++] = *v;
+    out[i] = '\0';
+  }
+
+  /**
+   * Check a line read from media before it goes into the queue and return true to drop it.
+   * The G0 / G1 moves of a canceled object are dropped instead of being parsed and run one
+   * by one. Their last X Y Z E F values are kept for sd_pending_move.
+   */
+  bool CancelObject::sd_skip_line(const char *cmd) {
+    while (*cmd == ' ') cmd++;
+
+    if (cmd[0] == 'M' && cmd[1] == '4' && cmd[2] == '8' && cmd[3] == '6' && !NUMERIC(cmd[4])) {
+      if (find_word(cmd, 'T')) sd_object = -1;
+      const char * const s = find_word(cmd, 'S');
+      if (s) sd_object = atoi(s);
+      return false;
+    }
+
+    if (!WITHIN(sd_object, 0, 31) || !is_canceled(sd_object)) return false;
+    if (cmd[0] != 'G' || (cmd[1] != '0' && cmd[1] != '1') || NUMERIC(cmd[2])) return false;
+
+    for (uint8_t w = 0; w < COUNT(sd_word); ++w)
+      copy_word(cmd, "XYZEF"[w], sd_word[w], sizeof(sd_word[w]));
+    return true;
+  }
+
+  /**
+   * Write a move with the last values of the dropped moves and forget them.
+   * It runs while the object is still skipped, so it only sets the end of the
+   * skip, the E position and the feedrate. Return false if there's none.
+   */
+  bool CancelObject::sd_pending_move(char * const buff) {
+    bool any = false;
+    strcpy_P(buff, PSTR("G1"));
+    for (uint8_t w = 0; w < COUNT(sd_word); ++w) {
+      if (!sd_word[w][0]) continue;
+      const char word[] = { ' ', "XYZEF"[w], '\0' };
+      strcat(buff, word);
+      strcat(buff, sd_word[w]);
+      sd_word[w][0] = '\0';
+      any = true;
+    }
+    return any;
+  }
+
+#endif // CANCEL_OBJECTS_SD_SKIP
+
 #endif // CANCEL_OBJECTS
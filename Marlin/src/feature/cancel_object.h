@@ -21,7 +21,8 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfigPre.h"
+#include "../core/types.h"
 
 typedef struct CancelState {
   bool skipping = false;
@@ -39,7 +40,27 @@ public:
   static bool is_canceled(const int8_t obj) { return TEST(state.canceled, obj); }
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(state.active_object); }
-  static void reset() { state.canceled = 0x0000; state.object_count = 0; clear_active_object(); }
+  static void reset() {
+    state.canceled = 0x0000; state.object_count = 0; clear_active_object();
+    skip_started = false;
+    TERN_(CANCEL_OBJECTS_SD_SKIP, sd_object = -1; ZERO(sd_word));
+  }
+
+  // Skipped moves only go here. The end of the skip travels to it in one move.
+  static xyze_pos_t skip_position;
+  static bool skip_started;
+  static void finish_skip();
+
+  #if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+    // Media is read ahead of the queue, so the reader keeps track of the object it's in
+    static int8_t sd_object;          // The object of the last M486 S read from media
+    static char sd_word[5][16];       // The last X Y Z E F values of the dropped moves
+    static bool sd_skip_line(const char *cmd);
+    static bool sd_pending_move(char * const buff);
+  #endif
+
+private:
+  static void set_skipping(const bool skip);
 };
 
 extern CancelObject cancelable;
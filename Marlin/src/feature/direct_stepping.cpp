@@ -72,6 +72,14 @@ namespace DirectStepping {
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_page_size;
 
+  #if ENABLED(DIRECT_STEPPING_RLE)
+    template<typename Cfg>
+    uint8_t SerialPageManager<Cfg>::run_count;
+  #endif
+
+  // Page data follows the size as PackBits runs when DIRECT_STEPPING_RLE is enabled
+  constexpr State DATA_STATE = TERN(DIRECT_STEPPING_RLE, State::RUN, State::COLLECT);
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::init() {
     for (int i = 0 ; i < Cfg::PAGE_COUNT ; i++)
@@ -85,6 +93,24 @@ namespace DirectStepping {
     SERIAL_ECHOLNPGM("pages_ready");
   }
 
+  template<typename Cfg>
+  FORCE_INLINE void SerialPageManager<Cfg>::store_byte(const uint8_t c) {
+    pages[write_page_idx][write_byte_idx++] = c;
+    checksum ^= c;
+  }
+
+  // Check if the page being written has all its bytes
+  template<typename Cfg>
+  FORCE_INLINE bool SerialPageManager<Cfg>::page_complete() {
+    if (Cfg::PAGE_SIZE == 256) {
+      // special case for 8-bit, check if rolled back to 0
+      if (Cfg::DIRECTIONAL || !write_page_size) return !write_byte_idx; // full 256 bytes
+      return write_byte_idx >= write_page_size;
+    }
+    if (Cfg::DIRECTIONAL) return write_byte_idx == Cfg::PAGE_SIZE;
+    return write_byte_idx >= write_page_size;
+  }
+
   template<typename Cfg>
   FORCE_INLINE bool SerialPageManager<Cfg>::maybe_store_rxd_char(uint8_t c) {
     switch (state) {
@@ -126,35 +152,34 @@ namespace DirectStepping {
 
         set_page_state(write_page_idx, PageState::WRITING);
 
-        state = Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
+        state = Cfg::DIRECTIONAL ? DATA_STATE : State::SIZE;
 
         return true;
       case State::SIZE:
         // Zero means full page size
         write_page_size = c;
-        state = State::COLLECT;
+        state = DATA_STATE;
         return true;
-      case State::COLLECT:
-        pages[write_page_idx][write_byte_idx++] = c;
-        checksum ^= c;
-
-        // check if still collecting
-        if (Cfg::PAGE_SIZE == 256) {
-          // special case for 8-bit, check if rolled back to 0
-          if (Cfg::DIRECTIONAL || !write_page_size) { // full 256 bytes
-            if (write_byte_idx) return true;
-          }
-          else if (write_byte_idx < write_page_size)
-            return true;
-        }
-        else if (Cfg::DIRECTIONAL) {
-          if (write_byte_idx != Cfg::PAGE_SIZE)
-            return true;
-        }
-        else if (write_byte_idx < write_page_size)
+      #if ENABLED(DIRECT_STEPPING_RLE)
+        case State::RUN:
+          // PackBits header: n < 128 for n + 1 literal bytes, n > 128 for the next byte 257 - n times
+          if (c == 128) return true;
+          run_count = c < 128 ? c + 1 : 257 - c;
+          state = c < 128 ? State::COLLECT : State::REPEAT;
           return true;
-
-        state = State::CHECKSUM;
+        case State::REPEAT:
+          for (;;) {
+            store_byte(c);
+            if (page_complete()) { state = State::CHECKSUM; return true; }
+            if (!--run_count) { state = State::RUN; return true; }
+          }
+      #endif
+      case State::COLLECT:
+        store_byte(c);
+        if (page_complete())
+          state = State::CHECKSUM;
+        else if (TERN0(DIRECT_STEPPING_RLE, !--run_count))
+          state = State::RUN;
         return true;
       case State::CHECKSUM: {
         const PageState page_state = (checksum == c) ? PageState::OK : PageState::FAIL;
@@ -26,7 +26,7 @@
 namespace DirectStepping {
 
   enum State : char {
-    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL, RUN, REPEAT
   };
 
   enum PageState : uint8_t {
@@ -76,8 +76,13 @@ namespace DirectStepping {
     static write_byte_idx_t write_byte_idx;
     static page_idx_t write_page_idx;
     static write_byte_idx_t write_page_size;
+    #if ENABLED(DIRECT_STEPPING_RLE)
+      static uint8_t run_count; // Bytes left in the current literal or repeat run
+    #endif
 
     static void set_page_state(const page_idx_t page_idx, const PageState page_state);
+    static void store_byte(const uint8_t c);
+    static bool page_complete();
   };
 
   template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
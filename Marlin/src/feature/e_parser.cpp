@@ -60,11 +60,37 @@ extern bool wait_for_user, wait_for_heatup;
   void quickresume_stepper();
 #endif
 
+#if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+  void realtime_feedrate_override(const int8_t step);
+  void realtime_flow_override(const int8_t step);
+#endif
+
 void EmergencyParser::update(EmergencyParser::State &state, const uint8_t c) {
   auto uppercase = [](char c) {
     return TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')) ? c + 'A' - 'a' : c;
   };
 
+  #if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+    if (state == EP_RESET && is_realtime_command(c)) {
+      if (enabled) switch (c) {
+        case '?':  report_current_position_moving(); break;
+        case '!':  quickpause_stepper(); break;
+        case '~':  quickresume_stepper(); break;
+        case 0x90: realtime_feedrate_override(0); break;
+        case 0x91: realtime_feedrate_override(10); break;
+        case 0x92: realtime_feedrate_override(-10); break;
+        case 0x93: realtime_feedrate_override(1); break;
+        case 0x94: realtime_feedrate_override(-1); break;
+        case 0x99: realtime_flow_override(0); break;
+        case 0x9A: realtime_flow_override(10); break;
+        case 0x9B: realtime_flow_override(-10); break;
+        case 0x9C: realtime_flow_override(1); break;
+        case 0x9D: realtime_flow_override(-1); break;
+      }
+      return;
+    }
+  #endif
+
   switch (state) {
     case EP_RESET:
       switch (uppercase(c)) {
@@ -79,6 +79,13 @@ public:
 
   static void update(State &state, const uint8_t c);
 
+  #if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+    // Grbl-style single-byte commands, which are only taken between lines
+    static constexpr bool is_realtime_command(const uint8_t c) {
+      return c == '?' || c == '!' || c == '~' || WITHIN(c, 0x90, 0x94) || WITHIN(c, 0x99, 0x9D);
+    }
+  #endif
+
 private:
   static bool enabled;
 };
@@ -27,6 +27,13 @@
 #include "ethernet.h"
 #include "../core/serial.h"
 
+#if ENABLED(ETHERNET_STREAM)
+  #include "../gcode/queue.h"
+  #if HAS_MEDIA
+    #include "../sd/cardreader.h"
+  #endif
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_ETHERNET)
 #include "../core/debug_out.h"
 
@@ -44,6 +51,11 @@ MarlinEthernet ethernet;
 
 EthernetServer server(23);    // telnet server
 
+#if ENABLED(ETHERNET_STREAM)
+  EthernetClient MarlinEthernet::streamClient;
+  EthernetServer stream_server(ETHERNET_STREAM_PORT);
+#endif
+
 enum linkStates { UNLINKED, LINKING, LINKED, CONNECTING, CONNECTED, NO_HARDWARE } linkState;
 
 #ifdef __IMXRT1062__
@@ -117,6 +129,7 @@ void MarlinEthernet::check() {
 
       SERIAL_ECHOLNPGM("Ethernet cable connected");
       server.begin();
+      TERN_(ETHERNET_STREAM, stream_server.begin());
       linkState = LINKING;
       break;
 
@@ -170,8 +183,157 @@ void MarlinEthernet::check() {
 
     default: break;
   }
+
+  #if ENABLED(ETHERNET_STREAM)
+    if (WITHIN(linkState, LINKED, CONNECTED)) stream_check();
+  #endif
 }
 
+#if ENABLED(ETHERNET_STREAM)
+
+  /**
+   * G-code stream on ETHERNET_STREAM_PORT
+   *
+   * Lines go straight into the command queue, without line numbers, checksums or an
+   * "ok" for each one, since TCP already delivers them whole and in order. Reading
+   * stops while the queue is full so the TCP window holds the host back. Every
+   * ETHERNET_STREAM_ACK_LINES lines, and whenever the input runs dry, the host gets
+   * "ok <lines>" with the number of lines queued since it connected.
+   *
+   * "@UPLOAD <bytes> <file>" writes the next <bytes> bytes straight to the file on
+   * the media, answered by "ok upload <bytes>" or "error upload".
+   * Responses to the streamed commands go to the serial ports as usual.
+   */
+  static uint8_t stream_buf[256];                 // Bytes read from the socket
+  static uint16_t stream_pos, stream_len;
+  static char stream_line[MAX_CMD_SIZE];          // The line being assembled
+  static uint8_t stream_count;
+  static bool stream_comment;
+  static uint32_t stream_lines, stream_acked;
+  #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+    static uint32_t upload_left;                  // Bytes still to write to the file
+    static uint32_t upload_size;
+  #endif
+
+  static void stream_ack() {
+    MarlinEthernet::streamClient.print("ok ");
+    MarlinEthernet::streamClient.println(stream_lines);
+    stream_acked = stream_lines;
+  }
+
+  #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+
+    static void upload_end(const bool ok) {
+      card.closefile();
+      if (ok) {
+        MarlinEthernet::streamClient.print("ok upload ");
+        MarlinEthernet::streamClient.println(upload_size);
+      }
+      else
+        MarlinEthernet::streamClient.println("error upload");
+      upload_left = 0;
+    }
+
+    // "@UPLOAD <bytes> <file>"
+    static void upload_start(char *args) {
+      const uint32_t size = strtoul(args, &args, 10);
+      while (*args == ' ') args++;
+      if (!size || !*args || card.isFileOpen()) {   // Never interrupt a print
+        MarlinEthernet::streamClient.println("error upload");
+        return;
+      }
+      if (!card.isMounted()) card.mount();
+      card.openFileWrite(args);
+      if (!card.isFileOpen()) {
+        MarlinEthernet::streamClient.println("error upload");
+        return;
+      }
+      card.flag.saving = false;                   // Serial lines still run as commands
+      upload_size = upload_left = size;
+    }
+
+  #endif
+
+  // Queue a completed line, or start an upload
+  static void stream_line_done() {
+    stream_line[stream_count] = '\0';
+    char *cmd = stream_line;
+    while (*cmd == ' ') cmd++;
+    if (*cmd == '@') {
+      #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+        if (strncmp_P(cmd + 1, PSTR("UPLOAD "), 7) == 0) upload_start(cmd + 8); else
+      #endif
+      MarlinEthernet::streamClient.println("error");
+    }
+    else if (*cmd && queue.ring_buffer.enqueue(cmd, true))
+      stream_lines++;
+    stream_count = 0;
+    stream_comment = false;
+  }
+
+  void MarlinEthernet::stream_check() {
+    if (!streamClient) {
+      streamClient = stream_server.accept();
+      if (!streamClient) return;
+      stream_pos = stream_len = stream_count = 0;
+      stream_comment = false;
+      stream_lines = stream_acked = 0;
+      streamClient.println("Marlin stream " SHORT_BUILD_VERSION);
+      SERIAL_ECHOLNPGM("Stream client connected");
+      return;
+    }
+
+    if (!streamClient.connected() && !streamClient.available() && stream_pos >= stream_len) {
+      #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+        if (upload_left) upload_end(false);
+      #endif
+      SERIAL_ECHOLNPGM("Stream client disconnected");
+      streamClient.stop();
+      return;
+    }
+
+    for (;;) {
+      if (stream_pos >= stream_len) {
+        // Read no more than the rest of an upload so the lines after it are kept
+        uint16_t n = sizeof(stream_buf);
+        #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+          if (upload_left) NOMORE(n, upload_left);
+        #endif
+        const int got = streamClient.available() ? streamClient.read(stream_buf, n) : 0;
+        if (got <= 0) break;
+        stream_pos = 0;
+        stream_len = got;
+      }
+
+      #if HAS_MEDIA && DISABLED(SDCARD_READONLY)
+        if (upload_left) {
+          const uint16_t n = _MIN(uint32_t(stream_len - stream_pos), upload_left);
+          if (card.write(&stream_buf[stream_pos], n) != int16_t(n)) { upload_end(false); break; }
+          stream_pos += n;
+          upload_left -= n;
+          if (!upload_left) upload_end(true);
+          continue;
+        }
+      #endif
+
+      if (queue.ring_buffer.full()) return;       // The rest waits here and in the TCP window
+
+      const char c = stream_buf[stream_pos++];
+      if (ISEOL(c))
+        stream_line_done();
+      else if (c == ';')
+        stream_comment = true;
+      else if (!stream_comment && stream_count < MAX_CMD_SIZE - 1)
+        stream_line[stream_count++] = c;
+
+      if (stream_lines - stream_acked >= ETHERNET_STREAM_ACK_LINES) stream_ack();
+    }
+
+    if (stream_lines != stream_acked) stream_ack();
+  }
+
+#endif // ETHERNET_STREAM
+
 void say_ethernet() { SERIAL_ECHOPGM("  Ethernet "); }
 
 void MarlinEthernet::ETH0_report(const bool forReplay/*=true*/) {
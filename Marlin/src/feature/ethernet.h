@@ -37,6 +37,11 @@ class MarlinEthernet {
     static void init();
     static void check();
 
+    #if ENABLED(ETHERNET_STREAM)
+      static EthernetClient streamClient;
+      static void stream_check();
+    #endif
+
     static void ETH0_report(const bool forReplay=true);
     static void MAC_report(const bool forReplay=true);
     static void ip_report(const uint16_t cmd, FSTR_P const post, const IPAddress &ipo, const bool forReplay=true);
@@ -34,14 +34,45 @@
 #if HAS_AUTO_FAN && EXTRUDER_AUTO_FAN_SPEED != 255 && DISABLED(FOURWIRES_FANS)
   bool FanCheck::measuring = false;
 #endif
-Flags<TACHO_COUNT> FanCheck::tacho_state;
-uint16_t FanCheck::edge_counter[TACHO_COUNT];
+#if ENABLED(FAN_TACHO_INTERRUPTS)
+  volatile uint16_t FanCheck::edge_counter[TACHO_COUNT];
+  volatile uint32_t FanCheck::last_edge_us[TACHO_COUNT], FanCheck::period_us[TACHO_COUNT];
+  uint16_t FanCheck::rpm[TACHO_COUNT];
+#else
+  Flags<TACHO_COUNT> FanCheck::tacho_state;
+  uint16_t FanCheck::edge_counter[TACHO_COUNT];
+#endif
 uint8_t FanCheck::rps[TACHO_COUNT];
 FanCheck::TachoError FanCheck::error = FanCheck::TachoError::NONE;
 bool FanCheck::enabled;
 
+#if HAS_FAN_TACHO_CONTROL
+  uint16_t FanCheck::target_rpm = FAN_TACHO_TARGET_RPM;
+  uint8_t FanCheck::autofan_pwm[TACHO_COUNT] = ARRAY_N_1(TACHO_COUNT, EXTRUDER_AUTO_FAN_SPEED);
+#endif
+
+#if ENABLED(FAN_TACHO_INTERRUPTS)
+  #ifndef digitalPinToInterrupt
+    #define digitalPinToInterrupt(P) (P)
+  #endif
+  #define _TACHO_ISR(N) void tacho_isr_##N() { fan_check.tacho_edge(N); }
+  TERN_(HAS_E0_FAN_TACHO, _TACHO_ISR(0))
+  TERN_(HAS_E1_FAN_TACHO, _TACHO_ISR(1))
+  TERN_(HAS_E2_FAN_TACHO, _TACHO_ISR(2))
+  TERN_(HAS_E3_FAN_TACHO, _TACHO_ISR(3))
+  TERN_(HAS_E4_FAN_TACHO, _TACHO_ISR(4))
+  TERN_(HAS_E5_FAN_TACHO, _TACHO_ISR(5))
+  TERN_(HAS_E6_FAN_TACHO, _TACHO_ISR(6))
+  TERN_(HAS_E7_FAN_TACHO, _TACHO_ISR(7))
+#endif
+
 void FanCheck::init() {
-  #define _TACHINIT(N) TERN(E##N##_FAN_TACHO_PULLUP, SET_INPUT_PULLUP, TERN(E##N##_FAN_TACHO_PULLDOWN, SET_INPUT_PULLDOWN, SET_INPUT))(E##N##_FAN_TACHO_PIN)
+  #define __TACHINIT(N) TERN(E##N##_FAN_TACHO_PULLUP, SET_INPUT_PULLUP, TERN(E##N##_FAN_TACHO_PULLDOWN, SET_INPUT_PULLDOWN, SET_INPUT))(E##N##_FAN_TACHO_PIN)
+  #if ENABLED(FAN_TACHO_INTERRUPTS)
+    #define _TACHINIT(N) do{ __TACHINIT(N); attachInterrupt(digitalPinToInterrupt(E##N##_FAN_TACHO_PIN), tacho_isr_##N, FALLING); }while(0)
+  #else
+    #define _TACHINIT(N) __TACHINIT(N)
+  #endif
   #if HAS_E0_FAN_TACHO
     _TACHINIT(0);
   #endif
@@ -68,6 +99,20 @@ void FanCheck::init() {
   #endif
 }
 
+#if ENABLED(FAN_TACHO_INTERRUPTS)
+
+// Count the falling edges and time the last pulse, while measuring
+void FanCheck::tacho_edge(const uint8_t f) {
+  const uint32_t now = micros();
+  if (measuring) {
+    if (edge_counter[f]) period_us[f] = now - last_edge_us[f];
+    ++edge_counter[f];
+  }
+  last_edge_us[f] = now;
+}
+
+#else
+
 void FanCheck::update_tachometers() {
   bool status;
 
@@ -108,6 +153,8 @@ void FanCheck::update_tachometers() {
   }
 }
 
+#endif // !FAN_TACHO_INTERRUPTS
+
 void FanCheck::compute_speed(uint16_t elapsedTime) {
   static uint8_t errors_count[TACHO_COUNT];
   static uint8_t fan_reported_errors_msk = 0;
@@ -124,8 +171,26 @@ void FanCheck::compute_speed(uint16_t elapsedTime) {
       TERN_(HAS_E6_FAN_TACHO, case 6:)
       TERN_(HAS_E7_FAN_TACHO, case 7:)
         // Compute fan speed
-        rps[f] = edge_counter[f] * float(250) / elapsedTime;
-        edge_counter[f] = 0;
+        #if ENABLED(FAN_TACHO_INTERRUPTS)
+          // Two pulses per revolution, from the time of the last pulse. Fewer than two edges is a stopped fan.
+          UNUSED(elapsedTime);
+          hal.isr_off();
+          rpm[f] = edge_counter[f] > 1 ? 30000000UL / period_us[f] : 0;
+          edge_counter[f] = 0;
+          hal.isr_on();
+          rps[f] = rpm[f] / 60;
+        #else
+          rps[f] = edge_counter[f] * float(250) / elapsedTime;
+          edge_counter[f] = 0;
+        #endif
+
+        #if HAS_FAN_TACHO_CONTROL
+          // Step the PWM toward the target speed, by 1 for each FAN_TACHO_RPM_PER_PWM of error
+          if (target_rpm && thermalManager.autofan_speed[f]) {
+            const int16_t step = constrain((int32_t(target_rpm) - rpm[f]) / (FAN_TACHO_RPM_PER_PWM), -32, 32);
+            autofan_pwm[f] = constrain(autofan_pwm[f] + step, 1, 255);
+          }
+        #endif
 
         // Check fan speed
         constexpr int8_t max_extruder_fan_errors = TERN(HAS_PWMFANCHECK, 10000, 5000) / Temperature::fan_update_interval_ms;
@@ -189,7 +254,7 @@ void FanCheck::print_fan_states() {
         TERN_(HAS_E7_FAN_TACHO, case 7:)
           SERIAL_ECHOPGM("E", f);
           if (s == 0)
-            SERIAL_ECHOPGM(":", 60 * rps[f], " RPM ");
+            SERIAL_ECHOPGM(":", TERN(FAN_TACHO_INTERRUPTS, rpm[f], 60 * rps[f]), " RPM ");
           else
             SERIAL_ECHOPGM("@:", TERN(HAS_AUTO_FAN, thermalManager.autofan_speed[f], 255), " ");
           break;
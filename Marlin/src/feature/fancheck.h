@@ -51,8 +51,14 @@ class FanCheck {
     #else
       static constexpr bool measuring = true;
     #endif
-    static Flags<TACHO_COUNT> tacho_state;
-    static uint16_t edge_counter[TACHO_COUNT];
+    #if ENABLED(FAN_TACHO_INTERRUPTS)
+      static volatile uint16_t edge_counter[TACHO_COUNT];
+      static volatile uint32_t last_edge_us[TACHO_COUNT], period_us[TACHO_COUNT];
+      static uint16_t rpm[TACHO_COUNT];
+    #else
+      static Flags<TACHO_COUNT> tacho_state;
+      static uint16_t edge_counter[TACHO_COUNT];
+    #endif
     static uint8_t rps[TACHO_COUNT];
     static TachoError error;
 
@@ -63,7 +69,11 @@ class FanCheck {
     static bool enabled;
 
     static void init();
-    static void update_tachometers();
+    #if ENABLED(FAN_TACHO_INTERRUPTS)
+      static void tacho_edge(const uint8_t f);
+    #else
+      static void update_tachometers();
+    #endif
     static void compute_speed(uint16_t elapsedTime);
     static void print_fan_states();
     #if HAS_PWMFANCHECK
@@ -71,6 +81,14 @@ class FanCheck {
       static bool is_measuring() { return measuring; }
     #endif
 
+    #if HAS_FAN_TACHO_CONTROL
+      static uint16_t target_rpm;                 // Auto fan speed to hold, or 0 for EXTRUDER_AUTO_FAN_SPEED
+      static uint8_t autofan_pwm[TACHO_COUNT];    // Auto fan PWM found by the speed control
+      static uint8_t autofan_speed(const uint8_t f) {
+        return target_rpm && f < TACHO_COUNT ? autofan_pwm[f] : EXTRUDER_AUTO_FAN_SPEED;
+      }
+    #endif
+
     static void check_deferred_error() {
       if (error == TachoError::DETECTED) {
         error = TachoError::REPORTED;
@@ -0,0 +1,108 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Flight Recorder
+ * Trace ring of recent firmware events for post-mortem analysis.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FLIGHT_RECORDER)
+
+#include "flight_recorder.h"
+#include "../libs/hex_print.h"
+
+#if HAS_MEDIA
+  #include "../sd/cardreader.h"
+#endif
+
+static_assert(sizeof(flight_event_t) == 8, "flight_event_t must be 8 bytes.");
+
+FlightRecorder flight_recorder;
+
+flight_event_t FlightRecorder::ring[FLIGHT_RECORDER_SIZE];
+uint16_t FlightRecorder::head, FlightRecorder::count; // = 0
+bool FlightRecorder::paused; // = false
+
+void FlightRecorder::record(const FlightEvent type, const uint8_t a/*=0*/, const uint16_t b/*=0*/) {
+  if (paused) return;
+  const uint32_t us = micros();
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  ring[head] = { us, type, a, b };
+  head = (head + 1) % (FLIGHT_RECORDER_SIZE);
+  if (count < FLIGHT_RECORDER_SIZE) ++count;
+  if (was_on) hal.isr_on();
+}
+
+void FlightRecorder::reset() {
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  head = count = 0;
+  if (was_on) hal.isr_on();
+}
+
+// Visit the events from oldest to newest. Call with the ring paused.
+void FlightRecorder::for_each(void (*fn)(const flight_event_t&)) {
+  uint16_t i = (head + (FLIGHT_RECORDER_SIZE) - count) % (FLIGHT_RECORDER_SIZE);
+  for (uint16_t n = count; n--; i = (i + 1) % (FLIGHT_RECORDER_SIZE)) {
+    fn(ring[i]);
+    if (!(n & 0x3F)) hal.watchdog_refresh();
+  }
+}
+
+void FlightRecorder::dump() {
+  paused = true;
+  SERIAL_ECHOLNPGM("Flight recorder: ", count, " events");
+  for_each([](const flight_event_t &e) {
+    SERIAL_ECHOPGM("FR:");
+    print_hex_word(e.us >> 16); print_hex_word(e.us & 0xFFFF);
+    print_hex_byte(e.type); print_hex_byte(e.a); print_hex_word(e.b);
+    SERIAL_EOL();
+  });
+  paused = false;
+}
+
+bool FlightRecorder::save(const char * const path) {
+  #if HAS_MEDIA
+    if (card.isFileOpen()) return false;  // Don't close a job in progress
+    if (!card.isMounted()) card.mount();
+    card.openFileWrite(path);
+    if (!card.isFileOpen()) return false;
+
+    // Header: "MFR", format version, event count, event size
+    paused = true;
+    uint8_t header[8] = { 'M', 'F', 'R', 1, uint8_t(count), uint8_t(count >> 8), sizeof(flight_event_t), 0 };
+    card.write(header, sizeof(header));
+    for_each([](const flight_event_t &e) { card.write((void*)&e, sizeof(e)); });
+    paused = false;
+
+    card.closefile();
+    return true;
+  #else
+    UNUSED(path);
+    return false;
+  #endif
+}
+
+#endif // FLIGHT_RECORDER
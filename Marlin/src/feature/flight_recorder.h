@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * flight_recorder.h - Trace ring of recent firmware events
+ *
+ * Keeps the last FLIGHT_RECORDER_SIZE events, each stamped with micros(),
+ * so a stutter or blob can be traced back to what the firmware was doing.
+ * Events may be recorded from the main loop or an ISR. M230 dumps the ring
+ * to serial or to a file on the media, decoded on the host by
+ * buildroot/share/scripts/flightRecorder.py.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum FlightEvent : uint8_t {
+  FR_NONE,
+  FR_BLOCK_PLANNED,   // A = blocks buffered
+  FR_BLOCK_STARTED,   // A = blocks buffered
+  FR_COMMAND,         // A = commands queued, when one is taken from the queue
+  FR_SD_READ,         // A = blocks read, B = µs taken
+  FR_EEPROM_WRITE,    // B = ms taken to save settings
+  FR_DGUS_HANDLER,    // A = ms taken (255 max), B = VP address
+  FR_TEMP_ISR_LATE,   // B = µs since the previous Temperature ISR (65535 max)
+  FR_EVENTS
+};
+
+// Packed for the dump. Keep in sync with flightRecorder.py.
+typedef struct {
+  uint32_t us;        // micros() when recorded
+  FlightEvent type;
+  uint8_t a;
+  uint16_t b;
+} flight_event_t;
+
+class FlightRecorder {
+  public:
+    static void record(const FlightEvent type, const uint8_t a=0, const uint16_t b=0);
+    static void reset();
+    static void dump();             // Hex records to serial
+    static bool save(const char * const path);  // Binary records to a file on the media
+
+  private:
+    static flight_event_t ring[FLIGHT_RECORDER_SIZE];
+    static uint16_t head, count;
+    static bool paused;             // Set while dumping to keep the ring still
+    static void for_each(void (*fn)(const flight_event_t&));
+};
+
+extern FlightRecorder flight_recorder;
+
+// Record an event with the µs (or ms) taken by the rest of the enclosing block
+class FlightScope {
+  public:
+    FlightScope(const FlightEvent type, const uint8_t a=0, const bool in_ms=false)
+      : type(type), a(a), in_ms(in_ms), start(in_ms ? millis() : micros()) {}
+    ~FlightScope() {
+      const uint32_t t = uint32_t(in_ms ? millis() : micros()) - start;
+      FlightRecorder::record(type, a, uint16_t(_MIN(t, 65535UL)));
+    }
+  private:
+    const FlightEvent type;
+    const uint8_t a;
+    const bool in_ms;
+    const uint32_t start;
+};
+
+#define FLIGHT_SCOPE(T, V...) FlightScope _flight_scope(FR_##T, ##V)
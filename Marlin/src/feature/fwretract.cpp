@@ -60,6 +60,16 @@ Flags<EXTRUDERS> FWRetract::retracted;                // Which extruders are cur
 float FWRetract::current_retract[EXTRUDERS],          // Retract value used by planner
       FWRetract::current_hop;
 
+#if ENABLED(FWRETRACT_BLEND)
+  float FWRetract::pending_retract;                   // A G10 retract waiting for the next move
+#endif
+
+#if ENABLED(FWRETRACT_WIPE)
+  xy_float_t FWRetract::wipe_dir;                     // Direction of the last extruded move
+  xy_pos_t FWRetract::wipe_end;                       // Where it ended
+  float FWRetract::wipe_room;                         // (mm) Its length, the most that can be wiped
+#endif
+
 void FWRetract::reset() {
   TERN_(FWRETRACT_AUTORETRACT, autoretract_enabled = false);
   settings.retract_length = RETRACT_LENGTH;
@@ -71,6 +81,8 @@ void FWRetract::reset() {
   settings.swap_retract_recover_extra = RETRACT_RECOVER_LENGTH_SWAP;
   settings.swap_retract_recover_feedrate_mm_s = RETRACT_RECOVER_FEEDRATE_SWAP;
   current_hop = 0.0;
+  TERN_(FWRETRACT_BLEND, pending_retract = 0);
+  TERN_(FWRETRACT_WIPE, wipe_room = 0);
 
   retracted.reset();
   EXTRUDER_LOOP() {
@@ -124,6 +136,18 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
   const float base_retract = TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS))
                 * (swapping ? settings.swap_retract_length : settings.retract_length);
 
+  #if ENABLED(FWRETRACT_BLEND)
+    // Hold the retract for the next move, so it can start along with a travel
+    if (retracting && !swapping) {
+      pending_retract = base_retract;
+      retracted.set(active_extruder, true);
+      return;
+    }
+  #endif
+
+  // A held merged move goes before the retract offsets change
+  TERN_(SEGMENT_MERGE, flush_segment_merge());
+
   // The current position will be the destination for E and Z moves
   destination = current_position;
 
@@ -148,25 +172,42 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
     }
   }
   else {
-    // If a hop was done and Z hasn't changed, undo the Z hop
-    if (current_hop) {
-      current_hop = 0;
-      // Lower Z, set_current_to_destination. Maximum Z feedrate
-      prepare_internal_move_to_destination(fr_max_z);
-    }
-
     const float extra_recover = swapping ? settings.swap_retract_recover_extra : settings.retract_recover_extra;
-    if (extra_recover) {
-      current_position.e -= extra_recover;          // Adjust the current E position by the extra amount to recover
-      sync_plan_position_e();                             // Sync the planner position so the extra amount is recovered
-    }
+    const feedRate_t fr_recover = MUL_TERN(RETRACT_SYNC_MIXING, swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s, MIXING_STEPPERS);
 
-    current_retract[active_extruder] = 0;
+    #if ENABLED(FWRETRACT_BLEND)
 
-    // Recover E, set_current_to_destination
-    prepare_internal_move_to_destination(
-      MUL_TERN(RETRACT_SYNC_MIXING, swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s, MIXING_STEPPERS)
-    );
+      if (extra_recover) {
+        current_position.e -= extra_recover;        // Adjust the current E position by the extra amount to recover
+        sync_plan_position_e();                     // Sync the planner position so the extra amount is recovered
+      }
+
+      // Undo the Z hop and recover E in one move, as long as the slower of the two
+      const float hop = current_hop,
+                  recover_time = (current_retract[active_extruder] + extra_recover) / fr_recover;
+      current_hop = current_retract[active_extruder] = 0;
+      prepare_internal_move_to_destination(hop ? hop / _MAX(hop / fr_max_z, recover_time) : fr_recover);
+
+    #else
+
+      // If a hop was done and Z hasn't changed, undo the Z hop
+      if (current_hop) {
+        current_hop = 0;
+        // Lower Z, set_current_to_destination. Maximum Z feedrate
+        prepare_internal_move_to_destination(fr_max_z);
+      }
+
+      if (extra_recover) {
+        current_position.e -= extra_recover;        // Adjust the current E position by the extra amount to recover
+        sync_plan_position_e();                     // Sync the planner position so the extra amount is recovered
+      }
+
+      current_retract[active_extruder] = 0;
+
+      // Recover E, set_current_to_destination
+      prepare_internal_move_to_destination(fr_recover);
+
+    #endif
   }
 
   TERN_(RETRACT_SYNC_MIXING, mixer.T(old_mixing_tool));   // Restore original mixing tool
@@ -194,6 +235,133 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
   //*/
 }
 
+#if ENABLED(FWRETRACT_BLEND)
+
+  #if ENABLED(FWRETRACT_WIPE)
+
+    /**
+     * Do a held retract while wiping back along the last extruded move,
+     * if the nozzle is still where that move ended.
+     * Return 'true' if the retract was done.
+     */
+    bool FWRetract::wipe_retract() {
+      if (!wipe_room || current_position.x != wipe_end.x || current_position.y != wipe_end.y) return false;
+
+      const float wipe_mm = _MIN(wipe_room, float(FWRETRACT_WIPE_LENGTH));
+      wipe_room = 0;
+
+      const xyze_pos_t saved_destination = destination;
+      destination = current_position;
+      destination.x -= wipe_dir.x * wipe_mm;
+      destination.y -= wipe_dir.y * wipe_mm;
+
+      // The wipe takes as long as the retract at the retract feedrate
+      const feedRate_t fr_wipe = wipe_mm * settings.retract_feedrate_mm_s / pending_retract;
+      current_retract[active_extruder] = pending_retract;
+      pending_retract = 0;
+      prepare_internal_move_to_destination(fr_wipe);
+
+      destination = saved_destination;
+      return true;
+    }
+
+  #endif
+
+  /**
+   * Do a held retract as its own moves, before a command that isn't a travel.
+   * The destination of the move being prepared (if any) is kept.
+   */
+  void FWRetract::flush_retract() {
+    if (!pending_retract) return;
+
+    TERN_(SEGMENT_MERGE, flush_segment_merge());
+
+    const bool hop = !current_hop && settings.retract_zraise > 0.01f;
+
+    const xyze_pos_t saved_destination = destination;
+    destination = current_position;
+
+    if (!TERN0(FWRETRACT_WIPE, wipe_retract())) {
+      current_retract[active_extruder] = pending_retract;
+      pending_retract = 0;
+      prepare_internal_move_to_destination(settings.retract_feedrate_mm_s);
+    }
+    if (hop) {
+      current_hop = settings.retract_zraise;
+      prepare_internal_move_to_destination(planner.settings.max_feedrate_mm_s[Z_AXIS]);
+    }
+
+    destination = saved_destination;
+  }
+
+  /**
+   * Before a G0/G1 move to 'destination', start a held retract.
+   *
+   * A travel (no E change) carries the retract and the Z hop over its start,
+   * as far as it goes while the filament retracts at the retract feedrate,
+   * so the nozzle doesn't stop. The caller moves on to the destination.
+   * Any other move gets the retract on its own first.
+   *
+   * With FWRETRACT_WIPE the retract is done by a wipe instead, when the
+   * nozzle is still at the end of the last extruded move. The travel then
+   * only carries the Z hop.
+   */
+  void FWRetract::start_retract_with_move(const bool can_blend) {
+    if (!pending_retract) {
+      #if ENABLED(FWRETRACT_WIPE)
+        // Remember the last extruded move for the wipe
+        if (can_blend && destination.e > current_position.e) {
+          const xy_float_t move = { destination.x - current_position.x, destination.y - current_position.y };
+          const float move_mm = move.magnitude();
+          if (move_mm > 0.01f) {
+            wipe_dir = move / move_mm;
+            wipe_room = move_mm;
+            wipe_end = destination;
+          }
+        }
+      #endif
+      return;
+    }
+
+    xyz_float_t travel;
+    LOOP_NUM_AXES(a) travel[a] = destination[a] - current_position[a];
+    float travel_mm = travel.magnitude();
+    if (!can_blend || destination.e != current_position.e || travel_mm < 0.1f) return flush_retract();
+
+    TERN_(SEGMENT_MERGE, flush_segment_merge());
+
+    const bool hop = !current_hop && settings.retract_zraise > 0.01f;
+
+    // The time at the start of the travel for the retract (or the hop after a wipe)
+    float ramp_s;
+    if (TERN0(FWRETRACT_WIPE, wipe_retract())) {
+      ramp_s = hop ? settings.retract_zraise / planner.settings.max_feedrate_mm_s[Z_AXIS] : 0;
+      // The travel starts from the end of the wipe
+      LOOP_NUM_AXES(a) travel[a] = destination[a] - current_position[a];
+      travel_mm = travel.magnitude();
+    }
+    else {
+      ramp_s = pending_retract / settings.retract_feedrate_mm_s;
+      // The planner applies the retract and the hop to the moves from here on
+      current_retract[active_extruder] = pending_retract;
+      pending_retract = 0;
+    }
+    if (hop) current_hop = settings.retract_zraise;
+
+    // Split the travel after the ramp, unless it is all that short
+    const float ramp_mm = MMS_SCALED(feedrate_mm_s) * ramp_s;
+    if (ramp_mm && ramp_mm < travel_mm) {
+      const xyze_pos_t end = destination;
+      const float ratio = ramp_mm / travel_mm;
+      LOOP_NUM_AXES(a) destination[a] = current_position[a] + travel[a] * ratio;
+      prepare_line_to_destination();
+      TERN_(SEGMENT_MERGE, flush_segment_merge());  // Keep the rest of the travel apart
+      destination = end;
+    }
+  }
+
+#endif // FWRETRACT_BLEND
+
 /**
  * M207: Set firmware retraction values
  *
@@ -46,6 +46,13 @@ private:
     static Flags<EXTRUDERS> retracted_swap;        // Which extruders are swap-retracted
   #endif
 
+  #if ENABLED(FWRETRACT_WIPE)
+    static xy_float_t wipe_dir;                    // Direction of the last extruded move
+    static xy_pos_t wipe_end;                      // Where it ended
+    static float wipe_room;                        // (mm) Its length, the most that can be wiped
+    static bool wipe_retract();
+  #endif
+
 public:
   static fwretract_settings_t settings;
 
@@ -59,6 +66,12 @@ public:
   static float current_retract[EXTRUDERS],         // Retract value used by planner
                current_hop;                        // Hop value used by planner
 
+  #if ENABLED(FWRETRACT_BLEND)
+    static float pending_retract;                  // A G10 retract waiting for the next move
+    static void flush_retract();
+    static void start_retract_with_move(const bool can_blend);
+  #endif
+
   FWRetract() { reset(); }
 
   static void reset();
@@ -0,0 +1,259 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/gcode_metadata.cpp - Slicer metadata of media files, cached in an index on the media
+ *
+ * The estimated time, filament and layer height are read from the comments
+ * slicers write in the header (Cura) or near the end (PrusaSlicer, OrcaSlicer)
+ * of a file, along with the location of its thumbnail. Each directory keeps a
+ * "GCODEMD.IDX" of the results, keyed by the 8.3 name, size and write time of
+ * each file, so a file is only scanned again when it changes. A binary G-code
+ * file (SD_BINARY_GCODE) has the same values in its metadata blocks.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_METADATA_INDEX)
+
+#include "gcode_metadata.h"
+#include "../sd/cardreader.h"
+
+#if ENABLED(GCODE_THUMBNAILS)
+  #include "gcode_thumbnail.h"
+#endif
+#if ENABLED(SD_BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
+GcodeMetadata gcodemeta;
+
+#define METADATA_INDEX_NAME "GCODEMD.IDX"
+
+typedef struct {
+  uint8_t name[11];       // 8.3 name as in the directory entry
+  uint8_t version;
+  uint32_t size;
+  uint16_t date, time;    // Last write
+  gcode_metadata_t meta;
+} metadata_record_t;
+
+#define METADATA_RECORD_VERSION 1
+
+// Read a line, without the EOL. False at the end of the file.
+static bool read_line(MediaFile &file, char * const line, const uint8_t size) {
+  uint8_t n = 0;
+  for (;;) {
+    const int16_t c = file.read();
+    if (c < 0) { line[n] = '\0'; return n > 0; }
+    if (c == '\n') break;
+    if (c != '\r' && n < size - 1) line[n++] = c;
+  }
+  line[n] = '\0';
+  return true;
+}
+
+// The value after a key at the start of a line, or nullptr
+static const char* after_key(const char * const line, PGM_P const key) {
+  const size_t len = strlen_P(key);
+  return strncmp_P(line, key, len) ? nullptr : line + len;
+}
+
+// "1d 2h 3m 4s" to seconds
+static uint32_t parse_duration(const char *p) {
+  uint32_t total = 0;
+  while (*p) {
+    char *e;
+    const uint32_t v = strtoul(p, &e, 10);
+    if (e == p) { ++p; continue; }
+    switch (*e) {
+      case 'd': total += v * 86400UL; break;
+      case 'h': total += v * 3600UL; break;
+      case 'm': total += v * 60UL; break;
+      case 's': total += v; break;
+      default: break;
+    }
+    p = *e ? e + 1 : e;
+  }
+  return total;
+}
+
+// Take the values found on a comment line, keeping the first of each
+static void parse_line(const char * const line, gcode_metadata_t &meta) {
+  const char *v;
+  if (!meta.print_time) {
+    if ((v = after_key(line, PSTR(";TIME:"))) || (v = after_key(line, PSTR(";PRINT.TIME:"))))
+      meta.print_time = strtoul(v, nullptr, 10);
+    else if ((v = after_key(line, PSTR("; estimated printing time (normal mode) = "))))
+      meta.print_time = parse_duration(v);
+  }
+  if (!meta.filament) {
+    if ((v = after_key(line, PSTR(";Filament used: "))))
+      meta.filament = atof(v) * 1000.0f;    // in meters
+    else if ((v = after_key(line, PSTR("; filament used [mm] = "))))
+      meta.filament = atof(v);
+  }
+  if (!meta.layer_height) {
+    if ((v = after_key(line, PSTR(";Layer height: "))) || (v = after_key(line, PSTR("; layer_height = "))))
+      meta.layer_height = atof(v);
+  }
+}
+
+#if ENABLED(SD_BINARY_GCODE)
+
+  /**
+   * Read the metadata blocks of a binary G-code file, which all come before the
+   * first G-code block. Each "key=value" line is given to parse_line() as the
+   * "; key = value" comment a slicer writes into plain G-code.
+   */
+  static void scan_binary(MediaFile &file, const bool has_crc, gcode_metadata_t &meta) {
+    BinaryGcode::block_t b;
+    for (uint32_t pos = BinaryGcode::FILE_HEADER_SIZE; BinaryGcode::read_block(file, pos, has_crc, b); pos = b.next) {
+      if (b.type == BinaryGcode::BLOCK_GCODE) break;
+      if (b.type != BinaryGcode::BLOCK_PRINTER_METADATA && b.type != BinaryGcode::BLOCK_PRINT_METADATA) continue;
+      if (b.compression != BinaryGcode::COMP_NONE) continue;
+
+      char line[80] = "; ";
+      uint8_t n = 2;
+      bool in_key = true;
+      for (uint32_t i = 0; i < b.stored; ++i) {
+        const int16_t c = file.read();
+        if (c < 0) break;
+        if (c == '\n') {
+          line[n] = '\0';
+          parse_line(line, meta);
+          n = 2;
+          in_key = true;
+        }
+        else if (c == '=' && in_key && n < sizeof(line) - 4) {
+          line[n++] = ' '; line[n++] = '='; line[n++] = ' ';
+          in_key = false;
+        }
+        else if (n < sizeof(line) - 1)
+          line[n++] = c;
+      }
+      if (n > 2) { line[n] = '\0'; parse_line(line, meta); }  // No EOL after the last line
+      hal.watchdog_refresh();
+    }
+  }
+
+#endif // SD_BINARY_GCODE
+
+/**
+ * Scan the comment block at the start of the file, skipping over thumbnails,
+ * then the last GCODE_METADATA_TAIL bytes for the values slicers put at the end.
+ */
+void GcodeMetadata::scan(MediaFile &file, gcode_metadata_t &meta) {
+  memset(&meta, 0, sizeof(meta));
+
+  #if ENABLED(SD_BINARY_GCODE)
+    bool has_crc;
+    if (BinaryGcode::read_file_header(file, has_crc)) return scan_binary(file, has_crc, meta);
+    file.seekSet(0);
+  #endif
+
+  char line[80];
+  uint16_t lines = 0;
+
+  while (read_line(file, line, sizeof(line))) {
+    if (line[0] != ';' && line[0] != '\0') break;   // The header is over
+    parse_line(line, meta);
+    #if ENABLED(GCODE_THUMBNAILS)
+      GcodeThumbnail::info_t t;
+      if (GcodeThumbnail::parse_begin(line, t)) {
+        t.start = file.curPosition();
+        if (t.width > meta.thumb_width) {
+          meta.thumb_start = t.start;
+          meta.thumb_size = t.size;
+          meta.thumb_width = t.width;
+          meta.thumb_height = t.height;
+          meta.thumb_format = t.format;
+        }
+        file.seekSet(t.start + t.size);
+      }
+    #endif
+    if (!(++lines & 0x3F)) hal.watchdog_refresh();
+  }
+
+  #if GCODE_METADATA_TAIL
+    const uint32_t size = file.fileSize();
+    if (size > file.curPosition() && !(meta.print_time && meta.filament && meta.layer_height)) {
+      file.seekSet(_MAX(file.curPosition(), size > (GCODE_METADATA_TAIL) ? size - (GCODE_METADATA_TAIL) : 0UL));
+      read_line(file, line, sizeof(line));    // Partial line
+      while (read_line(file, line, sizeof(line))) {
+        if (line[0] == ';') parse_line(line, meta);
+        if (!(++lines & 0x3F)) hal.watchdog_refresh();
+      }
+    }
+  #endif
+}
+
+bool GcodeMetadata::get(MediaFile * const dir, const char * const fname, gcode_metadata_t &meta, const dir_t * const dirent/*=nullptr*/) {
+  MediaFile file;
+  dir_t d;
+  const dir_t *entry = dirent;
+  if (!entry) {
+    if (!file.open(dir, fname, O_READ) || !file.dirEntry(&d)) return false;
+    entry = &d;
+  }
+
+  // Look for the file in the index, noting an out of date record to reuse
+  MediaFile index;
+  if (!index.open(dir, METADATA_INDEX_NAME, O_CREAT | O_RDWR)) return false;
+
+  metadata_record_t rec;
+  int32_t reuse = -1;
+  for (uint32_t pos = 0; index.read(&rec, sizeof(rec)) == sizeof(rec); pos += sizeof(rec)) {
+    if (memcmp(rec.name, entry->name, sizeof(rec.name))) continue;
+    if (rec.version == METADATA_RECORD_VERSION && rec.size == entry->fileSize
+      && rec.date == entry->lastWriteDate && rec.time == entry->lastWriteTime
+    ) {
+      meta = rec.meta;
+      return true;
+    }
+    reuse = pos;
+    break;
+  }
+
+  // Scan the file and store the result
+  if (!file.isOpen() && !file.open(dir, fname, O_READ)) return false;
+  scan(file, meta);
+
+  memcpy(rec.name, entry->name, sizeof(rec.name));
+  rec.version = METADATA_RECORD_VERSION;
+  rec.size = entry->fileSize;
+  rec.date = entry->lastWriteDate;
+  rec.time = entry->lastWriteTime;
+  rec.meta = meta;
+  if (index.seekSet(reuse < 0 ? index.fileSize() : uint32_t(reuse)))
+    index.write(&rec, sizeof(rec));
+
+  return true;
+}
+
+void GcodeMetadata::print(const gcode_metadata_t &meta) {
+  if (meta.print_time) SERIAL_ECHOPGM(" T", meta.print_time);
+  if (meta.filament) SERIAL_ECHOPGM(" F", p_float_t(meta.filament, 1));
+  if (meta.layer_height) SERIAL_ECHOPGM(" H", p_float_t(meta.layer_height, 2));
+}
+
+#endif // GCODE_METADATA_INDEX
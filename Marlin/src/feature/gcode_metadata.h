@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/gcode_metadata.h - Slicer metadata of media files, cached in an index on the media
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SdFile;
+struct directoryEntry;
+
+typedef struct {
+  uint32_t print_time;    // (s) Slicer estimate. 0 if unknown.
+  float filament;         // (mm) 0 if unknown
+  float layer_height;     // (mm) 0 if unknown
+  uint32_t thumb_start;   // File position of the largest thumbnail's data
+  uint16_t thumb_size;    // Base64 characters of that thumbnail. 0 if there is none.
+  uint16_t thumb_width, thumb_height;
+  uint8_t thumb_format;   // GcodeThumbnail::Format
+} gcode_metadata_t;
+
+class GcodeMetadata {
+  public:
+    // The metadata of a file in a directory, from the index or else by scanning the file.
+    // Pass the directory entry when it's at hand, as while listing, to save reading it.
+    static bool get(SdFile * const dir, const char * const fname, gcode_metadata_t &meta, const directoryEntry * const entry=nullptr);
+
+    // " T<seconds> F<mm> H<mm>" for the known values, as listed by 'M20 I'
+    static void print(const gcode_metadata_t &meta);
+
+  private:
+    static void scan(SdFile &file, gcode_metadata_t &meta);
+};
+
+extern GcodeMetadata gcodemeta;
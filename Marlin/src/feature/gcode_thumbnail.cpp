@@ -0,0 +1,238 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/gcode_thumbnail.cpp - Stream slicer thumbnails from the header of a media file
+ *
+ * Slicers embed thumbnails as base64 comment lines at the start of the file:
+ *
+ *   ; thumbnail begin 220x124 5884          (PNG)
+ *   ; thumbnail_JPG begin 220x124 4136      (also _QOI)
+ *   ; iVBORw0KGgoAAAANSUhEUgAAANwAAAB8CAYAAA...
+ *   ; thumbnail end
+ *
+ * The header is scanned a line at a time and the image is decoded as it is
+ * read, so neither is held in RAM. The location of the thumbnail in recently
+ * seen files is cached so a file list can scroll without scanning again.
+ * In a binary G-code file (SD_BINARY_GCODE) the images are thumbnail blocks,
+ * found by their headers and read as they are.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_THUMBNAILS)
+
+#include "gcode_thumbnail.h"
+#include "../sd/cardreader.h"
+
+#if ENABLED(SD_BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
+GcodeThumbnail thumbnail;
+
+static MediaFile file;
+
+bool GcodeThumbnail::reading;
+GcodeThumbnail::info_t GcodeThumbnail::info;
+uint16_t GcodeThumbnail::left;
+uint32_t GcodeThumbnail::bits;
+uint8_t GcodeThumbnail::nbits;
+
+typedef struct {
+  char name[FILENAME_LENGTH];
+  uint32_t dir;             // First cluster of the directory
+  GcodeThumbnail::Format want;
+  uint16_t max_width;
+  GcodeThumbnail::info_t info;
+} thumb_cache_t;
+
+static thumb_cache_t cache[GCODE_THUMBNAIL_CACHE];
+static uint8_t cache_next;
+
+void GcodeThumbnail::invalidate() {
+  for (auto &c : cache) c.name[0] = '\0';
+}
+
+// Read a line of the open file, without the EOL. False at the end of the file.
+static bool read_line(char * const line, const uint8_t size) {
+  uint8_t n = 0;
+  for (;;) {
+    const int16_t c = file.read();
+    if (c < 0) { line[n] = '\0'; return n > 0; }
+    if (c == '\n') break;
+    if (c != '\r' && n < size - 1) line[n++] = c;
+  }
+  line[n] = '\0';
+  return true;
+}
+
+bool GcodeThumbnail::parse_begin(const char *p, info_t &t) {
+  if (strncmp_P(p, PSTR("; thumbnail"), 11)) return false;
+  p += 11;
+  t.format = FMT_PNG;
+  if (*p == '_') {
+    if (!strncmp_P(p, PSTR("_JPG"), 4)) t.format = FMT_JPG;
+    else if (!strncmp_P(p, PSTR("_QOI"), 4)) t.format = FMT_QOI;
+    else if (strncmp_P(p, PSTR("_PNG"), 4)) return false;
+    p += 4;
+  }
+  if (strncmp_P(p, PSTR(" begin "), 7)) return false;
+  p += 7;
+  char *e;
+  t.width = strtoul(p, &e, 10);
+  if (*e != 'x') return false;
+  t.height = strtoul(e + 1, &e, 10);
+  t.size = strtoul(e, nullptr, 10);
+  t.raw = false;
+  return t.width && t.height && t.size;
+}
+
+// Is this thumbnail wanted, and bigger than the one found so far?
+static bool better(const GcodeThumbnail::info_t &t, const GcodeThumbnail::info_t &found, const GcodeThumbnail::Format want, const uint16_t max_width) {
+  return (want == GcodeThumbnail::FMT_ANY || t.format == want) && t.width <= max_width && t.width > (found.size ? found.width : 0);
+}
+
+#if ENABLED(SD_BINARY_GCODE)
+
+  // The thumbnail blocks of a binary G-code file come before the G-code
+  static void scan_binary(GcodeThumbnail::info_t &found, const bool has_crc, const GcodeThumbnail::Format want, const uint16_t max_width) {
+    BinaryGcode::block_t b;
+    for (uint32_t pos = BinaryGcode::FILE_HEADER_SIZE; BinaryGcode::read_block(file, pos, has_crc, b); pos = b.next) {
+      if (b.type == BinaryGcode::BLOCK_GCODE) break;
+      if (b.type != BinaryGcode::BLOCK_THUMBNAIL || b.compression != BinaryGcode::COMP_NONE || b.stored > 0xFFFF) continue;
+      GcodeThumbnail::info_t t;
+      t.start = b.data;
+      t.size = b.stored;
+      t.format = GcodeThumbnail::Format(GcodeThumbnail::FMT_PNG + b.param[0]);
+      t.width = b.param[1];
+      t.height = b.param[2];
+      t.raw = true;
+      if (b.param[0] <= BinaryGcode::THUMB_QOI && t.size && better(t, found, want, max_width)) found = t;
+    }
+  }
+
+#endif
+
+/**
+ * Scan the comment block at the start of the file for the largest thumbnail
+ * of the wanted format no wider than max_width. The scan stops at the first
+ * line of G-code, so it only costs the header.
+ */
+static void scan(GcodeThumbnail::info_t &found, const GcodeThumbnail::Format want, const uint16_t max_width) {
+  found.size = 0;
+
+  #if ENABLED(SD_BINARY_GCODE)
+    bool has_crc;
+    if (BinaryGcode::read_file_header(file, has_crc)) return scan_binary(found, has_crc, want, max_width);
+    file.seekSet(0);
+  #endif
+
+  char line[64];
+  while (read_line(line, sizeof(line))) {
+    if (line[0] != ';' && line[0] != '\0') break;   // The header is over
+    GcodeThumbnail::info_t t;
+    if (!GcodeThumbnail::parse_begin(line, t)) continue;
+    t.start = file.curPosition();
+    if (better(t, found, want, max_width)) found = t;
+    file.seekSet(t.start + t.size);   // Skip the data. Comment prefixes and EOLs make it longer, never shorter.
+  }
+}
+
+bool GcodeThumbnail::find(MediaFile * const dir, const char * const fname, info_t &out, const Format want/*=FMT_ANY*/, const uint16_t max_width/*=0xFFFF*/) {
+  const uint32_t dircl = dir->firstCluster();
+  for (const auto &c : cache)
+    if (c.name[0] && c.dir == dircl && c.want == want && c.max_width == max_width && !strcmp(c.name, fname)) {
+      out = c.info;
+      return out.size;
+    }
+
+  if (reading) close();
+  if (!file.open(dir, fname, O_READ)) return false;
+  scan(out, want, max_width);
+  file.close();
+
+  // Files without a thumbnail are cached too, so they aren't scanned again
+  thumb_cache_t &c = cache[cache_next];
+  cache_next = (cache_next + 1) % (GCODE_THUMBNAIL_CACHE);
+  strncpy(c.name, fname, sizeof(c.name) - 1);
+  c.name[sizeof(c.name) - 1] = '\0';
+  c.dir = dircl;
+  c.want = want;
+  c.max_width = max_width;
+  c.info = out;
+
+  return out.size;
+}
+
+bool GcodeThumbnail::open(MediaFile * const dir, const char * const fname, const Format want/*=FMT_ANY*/, const uint16_t max_width/*=0xFFFF*/) {
+  close();
+  if (!find(dir, fname, info, want, max_width)) return false;
+  if (!file.open(dir, fname, O_READ) || !file.seekSet(info.start)) { file.close(); return false; }
+  left = info.size;
+  bits = nbits = 0;
+  reading = true;
+  return true;
+}
+
+void GcodeThumbnail::close() {
+  if (reading) file.close();
+  reading = false;
+}
+
+uint16_t GcodeThumbnail::read(uint8_t * const buf, const uint16_t len) {
+  if (info.raw) {
+    const int16_t n = left ? file.read(buf, _MIN(len, left)) : 0;
+    if (n <= 0) { left = 0; return 0; }
+    left -= n;
+    return n;
+  }
+
+  uint16_t n = 0;
+  while (n < len) {
+    if (nbits >= 8) {
+      nbits -= 8;
+      buf[n++] = uint8_t(bits >> nbits);
+      continue;
+    }
+    if (!left) break;
+
+    const int16_t c = file.read();
+    if (c < 0) { left = 0; continue; }
+
+    uint8_t v;
+    if (WITHIN(c, 'A', 'Z'))      v = c - 'A';
+    else if (WITHIN(c, 'a', 'z')) v = c - 'a' + 26;
+    else if (WITHIN(c, '0', '9')) v = c - '0' + 52;
+    else if (c == '+')            v = 62;
+    else if (c == '/')            v = 63;
+    else if (c == '=')            { left = 0; continue; } // Padding ends the data
+    else continue;                                      // Comment prefixes and EOLs
+
+    bits = (bits << 6) | v;
+    nbits += 6;
+    left--;
+  }
+  return n;
+}
+
+#endif // GCODE_THUMBNAILS
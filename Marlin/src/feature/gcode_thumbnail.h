@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/gcode_thumbnail.h - Stream slicer thumbnails from the header of a media file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SdFile;
+
+class GcodeThumbnail {
+  public:
+    enum Format : uint8_t { FMT_ANY, FMT_PNG, FMT_JPG, FMT_QOI };
+
+    typedef struct {
+      uint32_t start;         // File position of the first line of base64 data
+      uint16_t size;          // Base64 characters, as given by the slicer. 0 if there is no thumbnail.
+      uint16_t width, height;
+      Format format;
+      bool raw;               // Image bytes (from a binary G-code block) instead of base64
+    } info_t;
+
+    // Locate the largest thumbnail of a format that fits, using the cache when possible
+    static bool find(SdFile * const dir, const char * const fname, info_t &info, const Format want=FMT_ANY, const uint16_t max_width=0xFFFF);
+
+    // Open a thumbnail, then read() it a chunk at a time between other work
+    static bool open(SdFile * const dir, const char * const fname, const Format want=FMT_ANY, const uint16_t max_width=0xFFFF);
+    static uint16_t read(uint8_t * const buf, const uint16_t len); // Decoded bytes, 0 at the end
+    static void close();
+    static bool isOpen() { return reading; }
+    static const info_t& current() { return info; }
+
+    static void invalidate(); // Forget the cached lookups, e.g., when the media changes
+
+    // "; thumbnail[_FMT] begin WxH SIZE" to its values, except for the start. False for any other line.
+    static bool parse_begin(const char *p, info_t &t);
+
+  private:
+    static bool reading;
+    static info_t info;
+    static uint16_t left;     // Base64 characters still to decode
+    static uint32_t bits;     // Decoded bits not yet returned
+    static uint8_t nbits;
+};
+
+extern GcodeThumbnail thumbnail;
@@ -37,11 +37,27 @@
 #include "../module/planner.h"
 #include "../lcd/marlinui.h"
 
+#if ENABLED(HOTEND_IDLE_REHEAT)
+  #include "../gcode/queue.h"
+  #include "../module/printcounter.h"
+  #if ENABLED(BINARY_MOVE_COMMANDS)
+    #include "binary_moves.h"
+  #endif
+#endif
+
 HotendIdleProtection hotend_idle;
 
 millis_t HotendIdleProtection::next_protect_ms = 0;
 hotend_idle_settings_t HotendIdleProtection::cfg; // Initialized by settings.load
 
+#if ENABLED(HOTEND_IDLE_REHEAT)
+  celsius_t HotendIdleProtection::saved_target[HOTENDS];
+  #if HAS_HEATED_BED
+    celsius_t HotendIdleProtection::saved_bed_target;
+  #endif
+  bool HotendIdleProtection::reheat_pending;
+#endif
+
 void HotendIdleProtection::check_hotends(const millis_t &ms) {
   const bool busy = (TERN0(HAS_RESUME_CONTINUE, wait_for_user) || planner.has_blocks_queued());
   bool do_prot = false;
@@ -70,6 +86,8 @@ void HotendIdleProtection::check_e_motion(const millis_t &ms) {
 void HotendIdleProtection::check() {
   const millis_t ms = millis();                   // Shared millis
 
+  TERN_(HOTEND_IDLE_REHEAT, if (reheat_pending) check_reheat());
+
   check_hotends(ms);                              // Any hotends need protection?
   check_e_motion(ms);                             // Motion will protect them
 
@@ -84,13 +102,83 @@ void HotendIdleProtection::timed_out() {
   SERIAL_ECHOLNPGM("Hotend Idle Timeout");
   LCD_MESSAGE(MSG_HOTEND_IDLE_TIMEOUT);
   HOTEND_LOOP() {
-    if (cfg.nozzle_target < thermalManager.degTargetHotend(e))
+    TERN_(HOTEND_IDLE_REHEAT, saved_target[e] = 0);
+    if (cfg.nozzle_target < thermalManager.degTargetHotend(e)) {
+      TERN_(HOTEND_IDLE_REHEAT, saved_target[e] = thermalManager.degTargetHotend(e));
       thermalManager.setTargetHotend(cfg.nozzle_target, e);
+    }
   }
   #if HAS_HEATED_BED
-    if (cfg.bed_target < thermalManager.degTargetBed())
+    TERN_(HOTEND_IDLE_REHEAT, saved_bed_target = 0);
+    if (cfg.bed_target < thermalManager.degTargetBed()) {
+      TERN_(HOTEND_IDLE_REHEAT, saved_bed_target = thermalManager.degTargetBed());
       thermalManager.setTargetBed(cfg.bed_target);
+    }
   #endif
+  TERN_(HOTEND_IDLE_REHEAT, reheat_pending = true);
 }
 
+#if ENABLED(HOTEND_IDLE_REHEAT)
+
+  /**
+   * Look for work that will need the heaters: a print job started, an
+   * extruding move in the planner, or a command in the queue that extrudes,
+   * homes or probes. Homing and probing run while the heaters come back up.
+   */
+  bool HotendIdleProtection::work_queued() {
+    if (print_job_timer.isRunning()) return true;
+
+    for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = block_inc_mod(b, 1)) {
+      block_t &block = planner.block_buffer[b];
+      if (block.is_move() && block.steps.e && block.direction_bits.e) return true;
+    }
+
+    const GCodeQueue::RingBuffer &rb = queue.ring_buffer;
+    for (uint8_t i = 0, r = rb.index_r; i < rb.length; ++i, r = (r + 1) % (BUFSIZE)) {
+      const char *cmd = rb.commands[r].buffer;
+      #if ENABLED(BINARY_MOVE_COMMANDS)
+        if (BinaryMoves::is_move(cmd)) return true;
+      #endif
+      if (*cmd == 'N') {                          // Skip a line number
+        while (*cmd && *cmd != ' ') cmd++;
+        while (*cmd == ' ') cmd++;
+      }
+      if (*cmd != 'G') continue;
+      switch (atoi(cmd + 1)) {
+        case 0 ... 3: if (strchr(cmd, 'E')) return true; break;
+        case 28: case 29: return true;
+        default: break;
+      }
+    }
+    return false;
+  }
+
+  // Restore the targets lowered by the timeout, unless they've been changed since
+  void HotendIdleProtection::check_reheat() {
+    bool any = false;
+    HOTEND_LOOP() if (saved_target[e] && thermalManager.degTargetHotend(e) == cfg.nozzle_target) any = true;
+    #if HAS_HEATED_BED
+      if (saved_bed_target && thermalManager.degTargetBed() == cfg.bed_target) any = true;
+    #endif
+    if (!any) { reheat_pending = false; return; }
+
+    if (!work_queued()) return;
+
+    reheat_pending = false;
+    SERIAL_ECHOLNPGM("Hotend Idle Reheat");
+    LCD_MESSAGE(MSG_HOTEND_IDLE_REHEAT);
+    HOTEND_LOOP() {
+      if (saved_target[e] && thermalManager.degTargetHotend(e) == cfg.nozzle_target)
+        thermalManager.setTargetHotend(saved_target[e], e);
+      saved_target[e] = 0;
+    }
+    #if HAS_HEATED_BED
+      if (saved_bed_target && thermalManager.degTargetBed() == cfg.bed_target)
+        thermalManager.setTargetBed(saved_bed_target);
+      saved_bed_target = 0;
+    #endif
+  }
+
+#endif // HOTEND_IDLE_REHEAT
+
 #endif // HOTEND_IDLE_TIMEOUT
@@ -47,6 +47,15 @@ private:
   static void check_hotends(const millis_t &ms);
   static void check_e_motion(const millis_t &ms);
   static void timed_out();
+  #if ENABLED(HOTEND_IDLE_REHEAT)
+    static celsius_t saved_target[HOTENDS];   // Targets lowered by the timeout, to restore on upcoming work
+    #if HAS_HEATED_BED
+      static celsius_t saved_bed_target;
+    #endif
+    static bool reheat_pending;
+    static bool work_queued();
+    static void check_reheat();
+  #endif
 };
 
 extern HotendIdleProtection hotend_idle;
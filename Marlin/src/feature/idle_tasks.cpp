@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Idle Task Scheduler
+ * Run the low priority idle() tasks at their own rate and time every task.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "idle_tasks.h"
+
+IdleTasks idle_tasks;
+
+IdleTasks::task_stats_t IdleTasks::stats[IDLE_TASK_COUNT];
+
+void IdleTasks::reset() {
+  for (task_stats_t &s : stats) { s.runs = s.late = s.total_us = 0; s.max_us = 0; }
+}
+
+/**
+ * Select the periodic task furthest past its deadline and set its next deadline
+ * now, so a nested idle() call (e.g., from a UI screen) won't select it again.
+ */
+IdleTaskID IdleTasks::select() {
+  const millis_t ms = millis();
+  IdleTaskID sel = IDLE_TASK_COUNT;
+  millis_t most_late = 0;
+  for (uint8_t i = 0; i < IDLE_TASK_COUNT; ++i) {
+    const IdleTaskID t = IdleTaskID(i);
+    if (!period_ms(t) || PENDING(ms, stats[i].next_ms)) continue;
+    const millis_t late = ms - stats[i].next_ms;
+    if (sel == IDLE_TASK_COUNT || late > most_late) { sel = t; most_late = late; }
+  }
+  if (sel != IDLE_TASK_COUNT) {
+    task_stats_t &s = stats[sel];
+    if (s.runs && most_late > period_ms(sel)) ++s.late;
+    s.next_ms = ms + period_ms(sel);
+  }
+  return sel;
+}
+
+/**
+ * Report each task that has run since the last reset:
+ *   N        : Number of runs
+ *   Avg, Max : Run time in µs
+ *   Late     : Runs started more than a period past their deadline
+ */
+void IdleTasks::report() {
+  static PGM_P const task_name[IDLE_TASK_COUNT] PROGMEM = {
+    PSTR("Inactivity"), PSTR("Thermal"), PSTR("HAL"),
+    PSTR("Runout"), PSTR("Media"), PSTR("Timer"), PSTR("UI"), PSTR("Report"), PSTR("Network")
+  };
+
+  SERIAL_ECHOLNPGM("Idle tasks (us)");
+  for (uint8_t i = 0; i < IDLE_TASK_COUNT; ++i) {
+    const task_stats_t &s = stats[i];
+    if (!s.runs) continue;
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&task_name[i]));
+    const uint16_t p = period_ms(IdleTaskID(i));
+    if (p) SERIAL_ECHOPGM(" (", p, "ms)");
+    SERIAL_ECHOPGM(" N:", s.runs, " Avg:", s.total_us / s.runs, " Max:", s.max_us);
+    if (p) SERIAL_ECHOPGM(" Late:", s.late);
+    SERIAL_EOL();
+  }
+}
+
+#endif // IDLE_TASK_SCHEDULER
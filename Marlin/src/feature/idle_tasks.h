@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_tasks.h - Scheduler for the work done in idle()
+ *
+ * Tasks with no period run on every idle() call. Periodic tasks become due
+ * when their period has elapsed and only the most overdue one runs in each
+ * idle() call, so their total run time never adds up in a single call.
+ *
+ * Every task counts its runs, total and max run time. Periodic tasks also
+ * count the runs that started more than a period past their deadline.
+ * Reported by M223.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum IdleTaskID : uint8_t {
+  // Every call
+  IDLE_TASK_INACTIVITY,
+  IDLE_TASK_THERMAL,
+  IDLE_TASK_HAL,
+  // Periodic
+  IDLE_TASK_RUNOUT,
+  IDLE_TASK_MEDIA,
+  IDLE_TASK_TIMER,
+  IDLE_TASK_UI,
+  IDLE_TASK_REPORT,
+  IDLE_TASK_NETWORK,
+  IDLE_TASK_COUNT
+};
+
+class IdleTasks {
+  public:
+    typedef struct {
+      uint32_t runs, late, total_us;
+      uint16_t max_us;
+      millis_t next_ms;           // Deadline of a periodic task
+    } task_stats_t;
+
+    static void reset();
+    static void report();
+
+    // Pick the periodic task to run in this idle() call, if any
+    static IdleTaskID select();
+
+    // Should a task run in the idle() call that selected 'sel'?
+    static bool due(const IdleTaskID t, const IdleTaskID sel) { return !period_ms(t) || t == sel; }
+
+    // Add the run time since 'start_us' to a task
+    static void done(const IdleTaskID t, const uint32_t start_us) {
+      const uint32_t us = micros() - start_us;
+      task_stats_t &s = stats[t];
+      ++s.runs;
+      s.total_us += us;
+      NOLESS(s.max_us, uint16_t(_MIN(us, 0xFFFFUL)));
+    }
+
+  private:
+    static task_stats_t stats[IDLE_TASK_COUNT];
+
+    static constexpr uint16_t period_ms(const IdleTaskID t) {
+      // Tasks left out of the build have no period so they're never selected
+      return t == IDLE_TASK_RUNOUT  ? TERN0(HAS_FILAMENT_SENSOR, IDLE_TASK_RUNOUT_MS)
+           : t == IDLE_TASK_MEDIA   ? TERN0(HAS_MEDIA, IDLE_TASK_MEDIA_MS)
+           : t == IDLE_TASK_TIMER   ? TERN0(PRINTCOUNTER, IDLE_TASK_REPORT_MS)
+           : t == IDLE_TASK_UI      ? IDLE_TASK_UI_MS
+           : t == IDLE_TASK_REPORT  ? TERN0(HAS_AUTO_REPORTING, IDLE_TASK_REPORT_MS)
+           : t == IDLE_TASK_NETWORK ? TERN0(HAS_ETHERNET, IDLE_TASK_REPORT_MS)
+           : 0;
+    }
+};
+
+extern IdleTasks idle_tasks;
+
+// Run and time an idle() task if it's due
+#define IDLE_TASK(T, SEL, V...) do{ if (IdleTasks::due(IDLE_TASK_##T, SEL)) { const uint32_t _idle_start = micros(); V; IdleTasks::done(IDLE_TASK_##T, _idle_start); } }while(0)
@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Stepper ISR Profiler
+ * Measure the time taken by each phase of the Stepper ISR.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+
+#include "isr_profiler.h"
+
+ISRProfiler isr_profiler;
+
+ISRProfiler::phase_stats_t ISRProfiler::stats[ISR_PHASE_COUNT];
+
+void ISRProfiler::reset() {
+  for (uint8_t p = 0; p < ISR_PHASE_COUNT; ++p) {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    stats[p] = { 0, 0, 0, 0, { 0 } };
+    if (was_on) hal.isr_on();
+  }
+}
+
+/**
+ * Report each phase that has run since the last reset:
+ *   N    : Number of samples
+ *   Min, Avg, Max : Time per call
+ *   Histogram counts with the upper bound of each bucket
+ *
+ * The 'Total' line also gives the highest ISR rate the average time allows.
+ */
+void ISRProfiler::report() {
+  static PGM_P const phase_name[ISR_PHASE_COUNT] PROGMEM = {
+    PSTR("Total"), PSTR("Pulse"), PSTR("Block"), PSTR("Shaping"), PSTR("Advance"), PSTR("Babystep")
+  };
+
+  #if ISR_PROFILER_DWT
+    SERIAL_ECHOLNPGM("Stepper ISR profile (cycles @ ", uint32_t((F_CPU) / 1000000UL), "MHz" TERN_(ISR_CODE_IN_RAM, ", code in RAM") ")");
+    constexpr uint32_t units_per_sec = F_CPU;
+  #else
+    SERIAL_ECHOLNPGM("Stepper ISR profile (us)");
+    constexpr uint32_t units_per_sec = 1000000UL;
+  #endif
+
+  for (uint8_t p = 0; p < ISR_PHASE_COUNT; ++p) {
+    // Take a copy since the Stepper ISR keeps adding samples
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    const phase_stats_t s = stats[p];
+    if (was_on) hal.isr_on();
+
+    if (!s.count) continue;
+
+    const uint32_t avg = uint32_t(s.total / s.count);
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&phase_name[p]));
+    SERIAL_ECHOPGM(" N:", s.count, " Min:", s.min, " Avg:", avg, " Max:", s.max);
+    if (p == ISR_PHASE_TOTAL && avg) SERIAL_ECHOPGM(" (", units_per_sec / avg, " ISR/s)");
+    SERIAL_EOL();
+
+    SERIAL_ECHOPGM(" ");
+    for (uint8_t b = 0; b < ISR_PROFILER_BUCKETS; ++b) {
+      if (b < ISR_PROFILER_BUCKETS - 1)
+        SERIAL_ECHOPGM(" <", uint32_t(2) << (b + ISR_PROFILER_BASE_SHIFT), ":", s.hist[b]);
+      else
+        SERIAL_ECHOPGM(" >=", uint32_t(1) << (b + ISR_PROFILER_BASE_SHIFT), ":", s.hist[b]);
+    }
+    SERIAL_EOL();
+  }
+}
+
+#endif // STEPPER_ISR_PROFILER
@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Run time of each Stepper ISR phase
+ *
+ * Times the whole Stepper ISR and each of its phases (pulse, block, input
+ * shaping, linear advance and babystepping) and collects the count, min,
+ * average and max time along with a log2 histogram. Reported by M214.
+ *
+ * Counts are in CPU cycles from the DWT cycle counter on STM32 and GD32 MFL
+ * (Cortex-M3 and up) and in µs from micros() on other platforms.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if defined(__arm__) && (defined(ARDUINO_ARCH_STM32) || defined(__STM32F1__) || defined(ARDUINO_ARCH_MFL)) && !defined(__ARM_ARCH_6M__)
+  #define ISR_PROFILER_DWT 1
+  #define ISR_PROFILER_BASE_SHIFT 6     // First bucket: < 128 cycles
+#else
+  #define ISR_PROFILER_BASE_SHIFT 0     // First bucket: < 2 µs
+#endif
+
+#define ISR_PROFILER_BUCKETS 8
+
+enum ISRPhase : uint8_t {
+  ISR_PHASE_TOTAL,
+  ISR_PHASE_PULSE,
+  ISR_PHASE_BLOCK,
+  ISR_PHASE_SHAPING,
+  ISR_PHASE_ADVANCE,
+  ISR_PHASE_BABYSTEP,
+  ISR_PHASE_COUNT
+};
+
+class ISRProfiler {
+  public:
+    typedef struct {
+      uint32_t count, min, max;
+      uint64_t total;
+      uint32_t hist[ISR_PROFILER_BUCKETS];  // Bucket n holds times below 2^(n + 1 + ISR_PROFILER_BASE_SHIFT)
+    } phase_stats_t;
+
+    static void reset();
+    static void report();
+
+    // Current time stamp, in cycles or µs
+    static uint32_t stamp() {
+      #if ISR_PROFILER_DWT
+        return *(volatile uint32_t *)0xE0001004;    // DWT_CYCCNT, enabled by calibrate_delay_loop()
+      #else
+        return micros();
+      #endif
+    }
+
+    // Add the time since 'start' to a phase. Called from the Stepper ISR.
+    static void sample(const ISRPhase p, const uint32_t start) {
+      const uint32_t t = stamp() - start;
+      phase_stats_t &s = stats[p];
+      if (!s.count++ || t < s.min) s.min = t;
+      s.total += t;
+      NOLESS(s.max, t);
+      uint8_t b = 0;
+      for (uint32_t v = t >> (ISR_PROFILER_BASE_SHIFT + 1); v && b < ISR_PROFILER_BUCKETS - 1; v >>= 1) ++b;
+      ++s.hist[b];
+    }
+
+    // Total time of a phase since the last reset, read outside the ISR
+    static uint64_t total_time(const ISRPhase p) {
+      const bool was_on = hal.isr_state();
+      hal.isr_off();
+      const uint64_t t = stats[p].total;
+      if (was_on) hal.isr_on();
+      return t;
+    }
+
+  private:
+    static phase_stats_t stats[ISR_PHASE_COUNT];
+};
+
+extern ISRProfiler isr_profiler;
+
+// Time a Stepper ISR phase
+#define ISR_PROFILE(P, V...) do{ const uint32_t _isr_start = ISRProfiler::stamp(); V; ISRProfiler::sample(ISR_PHASE_##P, _isr_start); }while(0)
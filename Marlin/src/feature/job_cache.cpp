@@ -0,0 +1,115 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/job_cache.cpp - Copy of the media job in SPI flash
+ *
+ * A second handle on the job file is copied to flash in the idle loop, one
+ * erase or page program per call, without waiting for the flash to finish.
+ * The read-ahead takes blocks from flash once they're copied and from the
+ * media otherwise, so a complete copy no longer needs the media.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_CACHE)
+
+#include "job_cache.h"
+#include "../sd/cardreader.h"
+#include "../libs/W25Qxx.h"
+
+JobCache jobcache;
+
+static MediaFile file;
+
+bool JobCache::active, JobCache::erased;
+uint32_t JobCache::size, JobCache::copied;
+uint16_t JobCache::buf_len, JobCache::buf_index;
+uint8_t JobCache::buf[512];
+
+// Start copying a job that was just opened. Too large a job isn't cached.
+void JobCache::start(MediaFile * const dir, const char * const fname, const uint32_t fsize) {
+  stop();
+  if (!fsize || fsize > SD_JOB_CACHE_SIZE || !file.open(dir, fname, O_READ)) return;
+
+  static bool initialized;
+  if (!initialized) { W25QXX.init(SPI_QUARTER_SPEED); initialized = true; }
+
+  size = fsize;
+  copied = 0;
+  buf_len = buf_index = 0;
+  erased = false;
+  active = true;
+}
+
+void JobCache::stop() {
+  if (!active) return;
+  file.close();
+  active = false;
+}
+
+// Called from idle. Start the next erase or page program once the flash is free.
+void JobCache::task() {
+  if (!active || copied >= size || W25QXX.SPI_FLASH_IsBusy()) return;
+
+  const uint32_t addr = SD_JOB_CACHE_ADDR + copied;
+
+  // Erase each sector before its first page
+  if (!erased) {
+    W25QXX.SPI_FLASH_SectorErase(addr, false);
+    erased = true;
+    return;
+  }
+
+  // Whole blocks go straight from the media into the buffer
+  if (buf_index >= buf_len) {
+    const int16_t n = file.read(buf, _MIN(size - copied, uint32_t(sizeof(buf))));
+    if (n <= 0) { stop(); return; }   // The rest is read from the media
+    buf_len = n;
+    buf_index = 0;
+  }
+
+  const uint16_t n = _MIN(buf_len - buf_index, SPI_FLASH_PageSize);
+  W25QXX.SPI_FLASH_PageWrite(&buf[buf_index], addr, n, false);
+  buf_index += n;
+  copied += n;
+  if (!(copied & (SPI_FLASH_SectorSize - 1))) erased = false;
+
+  if (copied >= size) {
+    file.close();
+    SERIAL_ECHO_MSG("Job cached");
+  }
+}
+
+int16_t JobCache::read(const uint32_t pos, uint8_t * const dst, const uint16_t len) {
+  if (!active) return -1;
+  if (pos >= copied) return copied >= size ? 0 : -1;
+
+  // Don't wait for a copy in progress while the media can be read instead
+  if (copied < size && W25QXX.SPI_FLASH_IsBusy()) return -1;
+
+  const uint16_t n = _MIN(uint32_t(len), copied - pos);
+  W25QXX.SPI_FLASH_BufferRead(dst, SD_JOB_CACHE_ADDR + pos, n);
+  return n;
+}
+
+#endif // SD_JOB_CACHE
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/job_cache.h - Copy of the media job in SPI flash
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SdFile;
+
+class JobCache {
+  public:
+    static void start(SdFile * const dir, const char * const fname, const uint32_t fsize);
+    static void stop();
+    static void task();
+
+    // Read from the copy at a file position. -1 if that part isn't copied yet.
+    static int16_t read(const uint32_t pos, uint8_t * const dst, const uint16_t len);
+
+    static bool complete() { return active && copied >= size; }
+
+  private:
+    static bool active, erased;
+    static uint32_t size, copied;
+    static uint16_t buf_len, buf_index;
+    static uint8_t buf[512];
+};
+
+extern JobCache jobcache;
@@ -0,0 +1,200 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/job_queue.cpp - A queue of media jobs printed one after another
+ *
+ * The jobs are listed in "QUEUE.TXT" in the root of the media, one per line:
+ *
+ *   <file> [<copies>] [<G-code>]   ; comment
+ *
+ * e.g., "PARTS/BRACKET.GCO 3 M140 S70" prints three brackets, setting the bed
+ * to 70° before each one. Blank lines and lines starting with ';' are skipped.
+ *
+ * When a job finishes SD_JOB_QUEUE_CLEAR_GCODE runs (e.g., to push the part
+ * off the bed) and the next job starts. The position in the queue is kept in
+ * "QUEUE.POS" so it survives a power loss. After a power-loss resume the queue
+ * carries on once the recovered job is done. Without a resume 'M229 S1' starts
+ * the interrupted job over.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_QUEUE)
+
+#include "job_queue.h"
+#include "../sd/cardreader.h"
+#include "../gcode/gcode.h"
+
+JobQueue jobqueue;
+
+#define JOB_QUEUE_MAGIC 0x424F4A51UL  // "QJOB"
+#define JOB_QUEUE_FILE  "QUEUE.TXT"
+#define JOB_STATE_FILE  "QUEUE.POS"
+
+static char line[MAXPATHNAMELENGTH + MAX_CMD_SIZE];
+
+bool JobQueue::load(job_queue_state_t &st) {
+  st = { JOB_QUEUE_MAGIC, 0, 0, false, { 0 } };
+  if (!card.isMounted()) return false;
+  MediaFile root = card.getroot(), file;
+  if (!file.open(&root, JOB_STATE_FILE, O_READ)) return true;   // No state yet is the start of the queue
+  job_queue_state_t saved;
+  if (file.read(&saved, sizeof(saved)) == sizeof(saved) && saved.magic == JOB_QUEUE_MAGIC) st = saved;
+  file.close();
+  return true;
+}
+
+void JobQueue::save(const job_queue_state_t &st) {
+  MediaFile root = card.getroot(), file;
+  if (!file.open(&root, JOB_STATE_FILE, O_CREAT | O_WRITE | O_TRUNC)) {
+    SERIAL_ECHOLNPGM("Can't write " JOB_STATE_FILE);
+    return;
+  }
+  file.write(&st, sizeof(st));
+  file.close();
+}
+
+/**
+ * Find a job (from 0) in the queue file and split its line into the
+ * file name, the count of copies and the G-code to run before it.
+ */
+bool JobQueue::read_job(const uint16_t index, char * const fname, uint16_t &copies, char * const cmd) {
+  MediaFile root = card.getroot(), file;
+  if (!file.open(&root, JOB_QUEUE_FILE, O_READ)) return false;
+
+  uint16_t job = 0;
+  bool found = false;
+  while (!found) {
+    // Read one line, ending at a comment
+    uint16_t len = 0;
+    bool comment = false;
+    int16_t c;
+    while ((c = file.read()) >= 0 && c != '\n') {
+      if (c == ';') comment = true;
+      if (!comment && c != '\r' && len < sizeof(line) - 1) line[len++] = c;
+    }
+    line[len] = '\0';
+
+    char *p = line;
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p && job++ == index) {
+      // The file name
+      char *f = fname;
+      while (*p && *p != ' ' && *p != '\t' && f < fname + MAXPATHNAMELENGTH - 1) *f++ = *p++;
+      *f = '\0';
+      // Copies, if given, and the rest is G-code
+      const long n = strtol(p, &p, 10);
+      copies = n > 0 ? n : 1;
+      while (*p == ' ' || *p == '\t') p++;
+      strncpy(cmd, p, MAX_CMD_SIZE - 1);
+      cmd[MAX_CMD_SIZE - 1] = '\0';
+      found = true;
+    }
+    if (c < 0) break;
+  }
+
+  file.close();
+  return found;
+}
+
+/**
+ * Start the job at the queue position, moving past the jobs that are done.
+ * Return false at the end of the queue.
+ */
+bool JobQueue::start_job(job_queue_state_t &st) {
+  static char fname[MAXPATHNAMELENGTH], cmd[MAX_CMD_SIZE];
+  uint16_t copies;
+  for (;;) {
+    if (!read_job(st.job, fname, copies, cmd)) {
+      st.running = false;
+      save(st);
+      SERIAL_ECHOLNPGM("Job queue done");
+      return false;
+    }
+    if (st.copy < copies) break;
+    st.job++;
+    st.copy = 0;
+  }
+
+  save(st);
+  SERIAL_ECHOLNPGM("Job ", st.job + 1, " copy ", st.copy + 1, "/", copies, ": ", fname);
+
+  if (*cmd) gcode.process_subcommands_now(cmd);
+  card.cdroot();
+  card.openAndPrintFile(fname);
+  return true;
+}
+
+/**
+ * M229 S1: Start the queue from its position. An interrupted job starts over.
+ */
+void JobQueue::start() {
+  if (card.isFileOpen() || card.flag.pending_print_start) return;
+  job_queue_state_t st;
+  if (!load(st)) return;
+  st.running = true;
+  (void)start_job(st);
+}
+
+/**
+ * M229 S0 or an aborted job: Start no more jobs. The current job
+ * isn't counted as done.
+ */
+void JobQueue::stop() {
+  job_queue_state_t st;
+  if (!load(st) || !st.running) return;
+  st.running = false;
+  save(st);
+}
+
+// M229 R: Go back to the first job
+void JobQueue::rewind() {
+  job_queue_state_t st;
+  if (!load(st)) return;
+  st.job = st.copy = 0;
+  save(st);
+}
+
+/**
+ * From M1001 at the end of a print. Count the job as done,
+ * clear the bed and start the next job if the queue is running.
+ * Return true if a job was started.
+ */
+bool JobQueue::job_finished() {
+  job_queue_state_t st;
+  if (!load(st) || !st.running) return false;
+  st.copy++;
+  save(st);
+  #ifdef SD_JOB_QUEUE_CLEAR_GCODE
+    gcode.process_subcommands_now(F(SD_JOB_QUEUE_CLEAR_GCODE));
+  #endif
+  return start_job(st);
+}
+
+void JobQueue::report() {
+  job_queue_state_t st;
+  if (!load(st)) { SERIAL_ECHOLNPGM("No media"); return; }
+  SERIAL_ECHOLNPGM("Job queue ", st.running ? F("running") : F("stopped"), " at job ", st.job + 1, " copy ", st.copy + 1);
+}
+
+#endif // SD_JOB_QUEUE
@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/job_queue.h - A queue of media jobs printed one after another
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  uint32_t magic;
+  uint16_t job,         // Index of the current job in the queue file
+           copy;        // Copies of the current job already printed
+  uint8_t running;      // The queue starts the next job when one finishes
+  uint8_t reserved[3];
+} job_queue_state_t;
+
+class JobQueue {
+  public:
+    static void start();
+    static void stop();
+    static void rewind();
+    static bool job_finished();
+    static void report();
+
+  private:
+    static bool load(job_queue_state_t &st);
+    static void save(const job_queue_state_t &st);
+    static bool read_job(const uint16_t index, char * const fname, uint16_t &copies, char * const cmd);
+    static bool start_job(job_queue_state_t &st);
+};
+
+extern JobQueue jobqueue;
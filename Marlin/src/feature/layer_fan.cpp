@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Layer Time Fan
+ * Raise the part cooling fan on layers that print too fast to cool.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LAYER_TIME_FAN)
+
+#include "layer_fan.h"
+#include "../module/planner.h"
+
+LayerFan layer_fan;
+
+bool LayerFan::enabled = true, LayerFan::timing;
+uint8_t LayerFan::fast_time = LAYER_FAN_FAST_TIME,
+        LayerFan::slow_time = LAYER_FAN_SLOW_TIME,
+        LayerFan::max_speed = LAYER_FAN_MAX_SPEED,
+        LayerFan::boost;
+float LayerFan::last_layer_time, LayerFan::last_e, LayerFan::layer_z, LayerFan::layer_time;
+
+void LayerFan::new_layer(const float z) {
+  // A drop in Z is a new print or object. Its first layer has nothing to go by.
+  const bool rise = z > layer_z;
+  layer_z = z;
+
+  if (!(rise && timing)) {
+    timing = rise;
+    layer_time = 0;
+    boost = 0;
+    return;
+  }
+
+  last_layer_time = layer_time;
+  layer_time = 0;
+
+  // Full speed at or under the fast time, no boost from the slow time, linear in between
+  if (last_layer_time >= slow_time)
+    boost = 0;
+  else if (last_layer_time <= fast_time || slow_time <= fast_time)
+    boost = max_speed;
+  else
+    boost = max_speed * (slow_time - last_layer_time) / (slow_time - fast_time);
+
+  if (!enabled || !boost) return;
+
+  // Raise the moves at the end of the last layer still waiting in the buffer, newest first.
+  // The fan speed of a block is only read by the main thread, when the block reaches the tail.
+  millis_t lead_ms = 0;
+  for (uint8_t b = planner.block_buffer_head; b != planner.block_buffer_tail && lead_ms < (LAYER_FAN_LEAD_MS);) {
+    b = block_dec_mod(b, 1);
+    block_t * const block = &planner.block_buffer[b];
+    apply(block->fan_speed[LAYER_FAN_INDEX]);
+    lead_ms += block->millimeters * 1000.0f / block->nominal_speed;
+  }
+}
+
+void LayerFan::report() {
+  SERIAL_ECHOLNPGM("Layer fan ", ON_OFF(enabled), " last layer ", p_float_t(last_layer_time, 1), "s boost ", boost);
+}
+
+#endif // LAYER_TIME_FAN
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * layer_fan.h - Part cooling fan boost for short layers
+ *
+ * Spots each new layer from the moves given to the planner and times it
+ * from the planned block times. At every layer change the fan floor for
+ * the new layer is set from the time of the one just finished, and is also
+ * applied to the last moves of that layer still in the buffer, so the fan
+ * is already up to speed when the short layer starts. Set with M228.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class LayerFan {
+  public:
+    static bool enabled;
+    static uint8_t fast_time, slow_time,  // (s) Layer times for the maximum speed and for no boost
+                   max_speed;             // Speed on the fastest layers
+    static float last_layer_time;         // (s) Planned time of the last complete layer
+    static uint8_t boost;                 // Floor applied to the fan speed on this layer
+
+    static void report();
+
+    // Called from Planner::buffer_line() with each unleveled move target
+    static void next_move(const xyze_pos_t &cart) {
+      const bool extruding = cart.e > last_e;
+      last_e = cart.e;
+      if (extruding && (cart.z > layer_z + (LAYER_FAN_MIN_HEIGHT) || cart.z < layer_z - (LAYER_FAN_MIN_HEIGHT)))
+        new_layer(cart.z);
+    }
+
+    // Called from Planner::_populate_block() with the block time and its fan speeds to raise
+    static void block_planned(const float secs, uint8_t (&fan_speed)[FAN_COUNT]) {
+      layer_time += secs;
+      apply(fan_speed[LAYER_FAN_INDEX]);
+    }
+
+  private:
+    static float last_e, layer_z, layer_time;
+    static bool timing;                   // The current layer started with a rise, so its time is valid
+
+    static void new_layer(const float z);
+    static void apply(uint8_t &spd) { if (enabled && spd) NOLESS(spd, boost); }
+};
+
+extern LayerFan layer_fan;
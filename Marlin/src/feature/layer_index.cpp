@@ -0,0 +1,185 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/layer_index.cpp - Sidecar index of the layer changes in a media file
+ *
+ * The first time a file is printed the position of each layer change is
+ * appended to "<name>.LYR" beside it. Once a print reaches the end the index
+ * is marked complete and later prints of the same file only read it.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LAYER_INDEX)
+
+#include "layer_index.h"
+#include "../sd/cardreader.h"
+
+LayerIndex layerindex;
+
+#define LAYER_INDEX_MAGIC 0x5259414CUL  // "LAYR"
+#define LAYER_Z_NONE      -1000.0f
+
+static MediaFile file;
+
+bool LayerIndex::active, LayerIndex::building, LayerIndex::complete, LayerIndex::pending;
+uint16_t LayerIndex::current, LayerIndex::count, LayerIndex::flushed;
+float LayerIndex::layer_z, LayerIndex::pending_z;
+uint32_t LayerIndex::pending_sdpos;
+uint8_t LayerIndex::buffered;
+layer_index_record_t LayerIndex::buffer[SD_LAYER_INDEX_BUFFER];
+
+/**
+ * Open or create the index for a file that is starting to print.
+ * A complete index for a file of the same size is kept. Anything else is rebuilt.
+ */
+void LayerIndex::start(MediaFile * const dir, const char * const fname) {
+  end(false);
+
+  // The DOS name with a "LYR" extension
+  char name[FILENAME_LENGTH];
+  uint8_t i = 0;
+  for (; fname[i] && fname[i] != '.' && i < FILENAME_LENGTH - 5; ++i) name[i] = fname[i];
+  strcpy_P(&name[i], PSTR(".LYR"));
+
+  if (!file.open(dir, name, O_CREAT | O_RDWR)) return;
+
+  active = true;
+  pending = false;
+  current = buffered = 0;
+  layer_z = LAYER_Z_NONE;
+
+  layer_index_header_t header;
+  if (file.read(&header, sizeof(header)) == sizeof(header)
+    && header.magic == LAYER_INDEX_MAGIC && header.file_size == card.getFileSize() && header.complete
+  ) {
+    count = flushed = (file.fileSize() - sizeof(header)) / sizeof(layer_index_record_t);
+    complete = true;
+    building = false;
+    return;
+  }
+
+  header = { LAYER_INDEX_MAGIC, card.getFileSize(), 0, { 0 } };
+  if (!file.truncate(0) || file.write(&header, sizeof(header)) != sizeof(header) || !file.sync()) {
+    file.close();
+    active = false;
+    return;
+  }
+  count = flushed = 0;
+  complete = false;
+  building = true;
+}
+
+/**
+ * Close the index at the end of a print. A print that read the whole
+ * file from the start completes the index for the next time.
+ */
+void LayerIndex::end(const bool finished) {
+  if (!active) return;
+  if (building) {
+    flush();
+    if (finished) {
+      const uint8_t done = 1;
+      file.seekSet(offsetof(layer_index_header_t, complete));
+      file.write(&done, 1);
+    }
+  }
+  file.close();
+  active = building = complete = pending = false;
+}
+
+void LayerIndex::flush() {
+  if (!buffered) return;
+  file.seekEnd();
+  file.write(buffer, buffered * sizeof(layer_index_record_t));
+  file.sync();
+  flushed += buffered;
+  buffered = 0;
+}
+
+bool LayerIndex::read_record(const uint16_t index, layer_index_record_t &rec) {
+  if (index >= flushed) return false;
+  file.seekSet(sizeof(layer_index_header_t) + uint32_t(index) * sizeof(layer_index_record_t));
+  return file.read(&rec, sizeof(rec)) == sizeof(rec);
+}
+
+/**
+ * The print position was set (M26, resume, repeat...). No more layers are
+ * recorded, since a jump would leave a gap, but the layer number is looked up.
+ */
+void LayerIndex::moved(const uint32_t sdpos) {
+  if (!active) return;
+  if (building) { flush(); building = false; }
+  pending = false;
+
+  // Find the number of layers that start before the new position
+  uint16_t lo = 0, hi = flushed;
+  layer_index_record_t rec;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (!read_record(mid, rec)) break;
+    if (rec.sdpos < sdpos) lo = mid + 1; else hi = mid;
+  }
+  current = lo;
+  layer_z = (lo && read_record(lo - 1, rec)) ? rec.z : LAYER_Z_NONE;
+}
+
+/**
+ * A move up from the current layer may start a new layer. It is only a layer
+ * change if something is printed before Z comes back down (e.g., Z hop).
+ */
+void LayerIndex::z_move(const float z, const uint32_t sdpos) {
+  if (!active) return;
+  if (z > layer_z + 0.05f) {
+    if (!pending) { pending = true; pending_sdpos = sdpos; }
+    pending_z = z;
+  }
+  else
+    pending = false;
+}
+
+void LayerIndex::extrude() {
+  if (!pending) return;
+  pending = false;
+  layer_z = pending_z;
+  current++;
+  if (building) {
+    buffer[buffered++] = { pending_sdpos, pending_z };
+    count = current;
+    if (buffered >= SD_LAYER_INDEX_BUFFER) flush();
+  }
+}
+
+/**
+ * Continue printing from the start of a layer (from 1)
+ */
+bool LayerIndex::seek(const uint16_t layer) {
+  if (!active || !layer) return false;
+  if (building) flush();
+  layer_index_record_t rec;
+  if (!read_record(layer - 1, rec)) return false;
+  card.setIndex(rec.sdpos);
+  return true;
+}
+
+#endif // SD_LAYER_INDEX
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/layer_index.h - Sidecar index of the layer changes in a media file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SdFile;
+
+typedef struct {
+  uint32_t sdpos;       // Position of the command that started the layer
+  float z;
+} layer_index_record_t;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t file_size;   // Size of the G-code file, to notice a changed file
+  uint8_t complete;     // All layers are indexed
+  uint8_t reserved[3];
+} layer_index_header_t;
+
+class LayerIndex {
+  public:
+    static void start(SdFile * const dir, const char * const fname);
+    static void end(const bool finished);
+    static void moved(const uint32_t sdpos);
+
+    // From G0/G1 while printing from media
+    static void z_move(const float z, const uint32_t sdpos);
+    static void extrude();
+
+    static bool seek(const uint16_t layer);
+
+    static uint16_t layer() { return current; }                 // Current layer, from 1. 0 before the first.
+    static uint16_t layers() { return complete ? count : 0; }   // 0 if the total isn't known
+
+  private:
+    static bool active, building, complete, pending;
+    static uint16_t current, count, flushed;
+    static float layer_z, pending_z;
+    static uint32_t pending_sdpos;
+    static uint8_t buffered;
+    static layer_index_record_t buffer[SD_LAYER_INDEX_BUFFER];
+
+    static void flush();
+    static bool read_record(const uint16_t index, layer_index_record_t &rec);
+};
+
+extern LayerIndex layerindex;
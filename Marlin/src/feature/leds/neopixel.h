@@ -38,6 +38,10 @@
 #include <Adafruit_NeoPixel.h>
 #include <stdint.h>
 
+#if ENABLED(NEOPIXEL_DMA)
+  #include "../../HAL/STM32/neopixel_dma.h"
+#endif
+
 // ------------------------
 // Defines
 // ------------------------
@@ -97,6 +101,7 @@ public:
   static void begin() {
     adaneo1.begin();
     TERN_(CONJOINED_NEOPIXEL, adaneo2.begin());
+    TERN_(NEOPIXEL_DMA, neopixel_dma_init(NEOPIXEL_PIN));
   }
 
   static void set_pixel_color(const uint16_t n, const uint32_t c) {
@@ -115,6 +120,10 @@ public:
   }
 
   static void show() {
+    #if ENABLED(NEOPIXEL_DMA)
+      // Sent by DMA with interrupts enabled, if NEOPIXEL_PIN is an SPI MOSI pin
+      if (neopixel_dma_show(adaneo1.getPixels(), adaneo1.numBytes())) return;
+    #endif
     // Some platforms cannot maintain PWM output when NeoPixel disables interrupts for long durations.
     TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
     adaneo1.show();
@@ -0,0 +1,151 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Loop Latency Monitor
+ * Measure the gaps between idle() calls and command queue advances.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LOOP_LATENCY_MONITOR)
+
+#include "loop_latency.h"
+
+LoopLatency loop_latency;
+
+LoopLatency::channel_t LoopLatency::channels[LATENCY_CHANNELS];
+LoopLatency::frame_t LoopLatency::stack[LOOP_LATENCY_DEPTH];
+uint8_t LoopLatency::depth; // = 0
+millis_t LoopLatency::next_decay_ms; // = 0
+
+// Upper bound of each histogram bucket but the last
+static constexpr uint16_t bucket_ms[LOOP_LATENCY_BUCKETS - 1] PROGMEM = { 1, 2, 5, 10, 20, 50, 100, 200, 500 };
+
+void LoopLatency::reset() {
+  for (channel_t &ch : channels) {
+    ch.count = ch.max_us = 0;
+    ch.max_culprit = { LATENCY_LOOP, 0, 0 };
+    ZERO(ch.culprit_max_us);
+    ZERO(ch.hist);
+    ch.started = false;
+  }
+}
+
+void LoopLatency::enter(const LatencyCulprit tag, const char letter, const uint16_t codenum) {
+  if (depth < LOOP_LATENCY_DEPTH) stack[depth] = { { tag, letter, codenum }, uint32_t(micros()), 0 };
+  ++depth;
+}
+
+void LoopLatency::exit() {
+  if (!depth || --depth >= LOOP_LATENCY_DEPTH) return;
+
+  // Time in this scope, less the time in the scopes nested inside it
+  const frame_t &f = stack[depth];
+  const uint32_t dur = micros() - f.start_us, self = dur - f.child_us;
+  if (depth) stack[depth - 1].child_us += dur;
+
+  for (channel_t &ch : channels)
+    if (self > ch.gap_self_us) { ch.gap_self_us = self; ch.gap_culprit = f.culprit; }
+}
+
+void LoopLatency::tick(const LatencyChannel c) {
+  channel_t &ch = channels[c];
+  const uint32_t now = micros();
+
+  if (ch.started) {
+    const uint32_t gap = now - ch.last_us;
+
+    // Blame the scope that ran longest within the gap, else the one still running
+    culprit_t culprit = { LATENCY_LOOP, 0, 0 };
+    if (ch.gap_self_us >= gap / 2)
+      culprit = ch.gap_culprit;
+    else if (depth)
+      culprit = stack[_MIN(depth, LOOP_LATENCY_DEPTH) - 1].culprit;
+
+    ++ch.count;
+    if (gap > ch.max_us) { ch.max_us = gap; ch.max_culprit = culprit; }
+    NOLESS(ch.culprit_max_us[culprit.tag], gap);
+
+    uint8_t b = 0;
+    while (b < LOOP_LATENCY_BUCKETS - 1 && gap >= 1000UL * pgm_read_word(&bucket_ms[b])) ++b;
+    if (ch.hist[b] < UINT16_MAX) ++ch.hist[b];
+  }
+
+  ch.started = true;
+  ch.last_us = now;
+  ch.gap_self_us = 0;
+
+  // Age the histograms by half every minute
+  const millis_t ms = millis();
+  if (ELAPSED(ms, next_decay_ms)) {
+    next_decay_ms = ms + 60000UL;
+    for (channel_t &h : channels) for (uint16_t &n : h.hist) n >>= 1;
+  }
+}
+
+static void print_culprit(const LoopLatency::culprit_t &c) {
+  static PGM_P const culprit_name[LATENCY_CULPRITS] PROGMEM = {
+    PSTR("Loop"), PSTR("G-code"), PSTR("EEPROM"), PSTR("Media"), PSTR("UI")
+  };
+  if (c.tag == LATENCY_GCODE && c.letter)
+    SERIAL_ECHO(c.letter, c.codenum);
+  else
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&culprit_name[c.tag]));
+}
+
+/**
+ * Report each channel:
+ *   N        : Number of gaps measured
+ *   Max      : Worst gap in µs and its culprit
+ *   Per tag  : Worst gap blamed on each culprit
+ *   Hist     : Recent gap counts with the upper bound of each bucket in ms
+ */
+void LoopLatency::report() {
+  for (uint8_t c = 0; c < LATENCY_CHANNELS; ++c) {
+    const channel_t &ch = channels[c];
+    SERIAL_ECHOPGM_P(c == LATENCY_IDLE ? PSTR("idle()") : PSTR("Queue advance"));
+    SERIAL_ECHOPGM(" N:", ch.count, " Max:", ch.max_us, "us (");
+    print_culprit(ch.max_culprit);
+    SERIAL_ECHOLNPGM(")");
+
+    SERIAL_ECHOPGM(" Worst");
+    for (uint8_t t = 0; t < LATENCY_CULPRITS; ++t) {
+      if (!ch.culprit_max_us[t]) continue;
+      SERIAL_CHAR(' ');
+      print_culprit({ LatencyCulprit(t), 0, 0 });
+      SERIAL_ECHOPGM(":", ch.culprit_max_us[t]);
+    }
+    SERIAL_EOL();
+
+    SERIAL_ECHOPGM(" Hist");
+    for (uint8_t b = 0; b < LOOP_LATENCY_BUCKETS; ++b) {
+      if (b < LOOP_LATENCY_BUCKETS - 1)
+        SERIAL_ECHOPGM(" <", pgm_read_word(&bucket_ms[b]), "ms:", ch.hist[b]);
+      else
+        SERIAL_ECHOPGM(" more:", ch.hist[b]);
+    }
+    SERIAL_EOL();
+  }
+}
+
+#endif // LOOP_LATENCY_MONITOR
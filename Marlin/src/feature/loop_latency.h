@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * loop_latency.h - Gaps between idle() calls and between command queue advances
+ *
+ * Measures the time between calls of idle() and of GCodeQueue::advance(),
+ * keeps the worst gap of each and a histogram of all gaps, and blames each
+ * gap on the code that ran for most of it. Reported by M224.
+ *
+ * Suspects are marked with LOOP_LATENCY_SCOPE, which times the code up to
+ * the end of the enclosing block. A gap is blamed on the scope that ran
+ * longest within it, less any scopes nested inside it, if that was at least
+ * half the gap. Otherwise it's blamed on the innermost scope still running,
+ * or on the main loop itself.
+ *
+ * Histogram counts are halved every minute so they follow recent behavior.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define LOOP_LATENCY_BUCKETS 10
+#define LOOP_LATENCY_DEPTH    4
+
+enum LatencyCulprit : uint8_t {
+  LATENCY_LOOP,     // Main loop, no scope running
+  LATENCY_GCODE,    // A G-code command
+  LATENCY_EEPROM,   // Settings save / load
+  LATENCY_MEDIA,    // SD card mount
+  LATENCY_UI,       // UI update, including the display's own handlers
+  LATENCY_CULPRITS
+};
+
+enum LatencyChannel : uint8_t { LATENCY_IDLE, LATENCY_ADVANCE, LATENCY_CHANNELS };
+
+class LoopLatency {
+  public:
+    typedef struct {
+      LatencyCulprit tag;
+      char letter;        // G-code command letter and number, for LATENCY_GCODE
+      uint16_t codenum;
+    } culprit_t;
+
+    typedef struct {
+      uint32_t count, max_us;
+      culprit_t max_culprit;                  // Blamed for the worst gap
+      uint32_t culprit_max_us[LATENCY_CULPRITS];
+      uint16_t hist[LOOP_LATENCY_BUCKETS];
+      // The gap in progress
+      bool started;
+      uint32_t last_us, gap_self_us;
+      culprit_t gap_culprit;
+    } channel_t;
+
+    static void reset();
+    static void report();
+
+    // Called from idle() and GCodeQueue::advance()
+    static void tick(const LatencyChannel c);
+
+    static void enter(const LatencyCulprit tag, const char letter, const uint16_t codenum);
+    static void exit();
+
+  private:
+    typedef struct { culprit_t culprit; uint32_t start_us, child_us; } frame_t;
+
+    static channel_t channels[LATENCY_CHANNELS];
+    static frame_t stack[LOOP_LATENCY_DEPTH];
+    static uint8_t depth;
+    static millis_t next_decay_ms;
+};
+
+extern LoopLatency loop_latency;
+
+class LatencyScope {
+  public:
+    LatencyScope(const LatencyCulprit tag, const char letter=0, const uint16_t codenum=0) { LoopLatency::enter(tag, letter, codenum); }
+    ~LatencyScope() { LoopLatency::exit(); }
+};
+
+// Time the rest of the enclosing block as a possible culprit
+#define LOOP_LATENCY_SCOPE(T, V...) LatencyScope _latency_scope(LATENCY_##T, ##V)
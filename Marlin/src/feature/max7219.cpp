@@ -740,7 +740,7 @@ void Max7219::idle_tasks() {
   #endif
 
   #ifdef MAX7219_DEBUG_PLANNER_QUEUE
-    const int16_t current_depth = BLOCK_MOD(head - tail + (BLOCK_BUFFER_SIZE)) & 0xF;
+    const int16_t current_depth = block_dec_mod(head, tail) & 0xF;
     if (current_depth != last_depth) {
       quantity16(MAX7219_DEBUG_PLANNER_QUEUE, last_depth, current_depth, &row_change_mask);
       last_depth = current_depth;
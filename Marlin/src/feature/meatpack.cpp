@@ -39,7 +39,7 @@
 
 #include "../inc/MarlinConfig.h"
 
-#if HAS_MEATPACK
+#if ANY(HAS_MEATPACK, SD_BINARY_GCODE)
 
 #include "meatpack.h"
 
@@ -149,7 +149,7 @@ void MeatPack::handle_output_char(const uint8_t c) {
  * Process a MeatPack command byte to update the state.
  * Report the new state to serial.
  */
-void MeatPack::handle_command(const MeatPack_Command c) {
+void MeatPack::handle_command(const MeatPack_Command c, const bool report/*=true*/) {
   switch (c) {
     case MPCommand_QueryConfig:     break;
     case MPCommand_EnablePacking:   SBI(state, MPConfig_Bit_Active);   DEBUG_ECHOLNPGM("[MPDBG] ENA REC");   break;
@@ -163,7 +163,7 @@ void MeatPack::handle_command(const MeatPack_Command c) {
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
-  report_state();
+  if (report) report_state();
 }
 
 void MeatPack::report_state() {
@@ -193,7 +193,7 @@ void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind)
 
   if (cmd_is_next) {                      // Were two command bytes received?
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
-    handle_command((MeatPack_Command)c);  // Then the byte is a MeatPack command
+    handle_command((MeatPack_Command)c, serial_ind.valid()); // Then the byte is a MeatPack command. Report to a serial port.
     cmd_is_next = false;
     return;
   }
@@ -217,4 +217,4 @@ uint8_t MeatPack::get_result_char(char * const __restrict out) {
   return res;
 }
 
-#endif // HAS_MEATPACK
+#endif // HAS_MEATPACK || SD_BINARY_GCODE
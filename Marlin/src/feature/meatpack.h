@@ -114,7 +114,7 @@ public:
   void reset_state();
   void report_state();
   uint8_t unpack_chars(const uint8_t pk, uint8_t* __restrict const chars_out);
-  void handle_command(const MeatPack_Command c);
+  void handle_command(const MeatPack_Command c, const bool report=true);
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
 
@@ -134,6 +134,8 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   uint8_t readIndex;
 
   NO_INLINE void write(uint8_t c)     { out.write(c); }
+  void write(const uint8_t *buffer, size_t size) { WRITE_BUFFER(&out, buffer, size); }
+  using BaseClassT::write;
   void flush()                        { out.flush();  }
   void begin(long br)                 { out.begin(br); readIndex = 0; }
   void end()                          { out.end(); }
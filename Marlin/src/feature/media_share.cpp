@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/media_share.cpp - Share the media with a USB host while printing
+ *
+ * Marlin's block accesses hold off the USB interrupt that runs the host's
+ * requests, so the two never overlap on the bus. The host may read anything,
+ * but it can't write to the blocks of the job being printed or to a block
+ * with changes still in Marlin's cache. A write to a clean cached block drops
+ * it from the cache so Marlin reads the host's data.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MSC_SHARED_PRINTING)
+
+#include "media_share.h"
+#include "../sd/cardreader.h"
+
+MediaShare mediashare;
+
+bool MediaShare::protect_all;
+uint8_t MediaShare::runs;
+uint32_t MediaShare::run_start[MEDIA_SHARE_RUNS], MediaShare::run_end[MEDIA_SHARE_RUNS];
+
+// Find the runs of contiguous clusters of a job that is starting
+void MediaShare::job_start(SdFile &file) {
+  job_end();
+
+  SdVolume * const vol = file.volume();
+  uint32_t c = file.firstCluster();
+  if (c < 2) return;                      // Empty file
+
+  for (uint32_t n = vol->clusterCount(); n--;) {
+    const uint32_t first = c;
+    uint32_t next;
+    for (;;) {
+      if (!vol->fatGet(c, &next)) { protect_all = true; return; }
+      if (next != c + 1) break;
+      c = next;
+    }
+    if (runs >= MEDIA_SHARE_RUNS) { protect_all = true; return; }
+    run_start[runs] = vol->clusterStartBlock(first);
+    run_end[runs] = vol->clusterStartBlock(c + 1);
+    runs++;
+    if (vol->isEOC(next)) return;
+    if (next < 2) break;                  // A broken chain
+    c = next;
+  }
+  protect_all = true;
+}
+
+bool MediaShare::host_may_write(const uint32_t block, const uint16_t count) {
+  if (protect_all) return false;
+  for (uint8_t i = 0; i < runs; ++i)
+    if (block < run_end[i] && block + count > run_start[i]) return false;
+  return card.volume.hostWrite(block, count);
+}
+
+#endif // MSC_SHARED_PRINTING
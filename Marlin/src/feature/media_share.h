@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/media_share.h - Share the media with a USB host while printing
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SdFile;
+
+// From the HAL. Hold off the USB host's block requests while Marlin uses the media.
+void media_lock();
+void media_unlock();
+
+class MediaLock {
+  public:
+    MediaLock() { media_lock(); }
+    ~MediaLock() { media_unlock(); }
+};
+
+#define MEDIA_LOCK() MediaLock media_lock_
+
+#ifndef MEDIA_SHARE_RUNS
+  #define MEDIA_SHARE_RUNS 8    // Runs of contiguous clusters to protect. A more fragmented job makes the host read-only.
+#endif
+
+class MediaShare {
+  public:
+    static void job_start(SdFile &file);
+    static void job_end() { runs = 0; protect_all = false; }
+
+    // From the USB host, before it writes blocks
+    static bool host_may_write(const uint32_t block, const uint16_t count);
+
+  private:
+    static bool protect_all;
+    static uint8_t runs;
+    static uint32_t run_start[MEDIA_SHARE_RUNS], run_end[MEDIA_SHARE_RUNS]; // Blocks of the job, each end exclusive
+};
+
+extern MediaShare mediashare;
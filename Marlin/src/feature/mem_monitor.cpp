@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Memory Monitor
+ * Paint free RAM at boot and report the stack high-water mark with M101.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MEMORY_MONITOR)
+
+#include "mem_monitor.h"
+#include "../module/planner.h"
+#include "../gcode/queue.h"
+
+#if HAS_ZV_SHAPING
+  #include "../module/stepper.h"
+#endif
+#if HAS_MEDIA
+  #include "../sd/cardreader.h"
+#endif
+
+#define MEMORY_FILL   char(0xE5)  // As used by M100
+#define STACK_GUARD   64          // Bytes left unpainted below the stack pointer
+#define RAM_START     0x20000000  // SRAM on Cortex-M
+
+extern "C" char __bss_end__;
+
+MemoryMonitor mem_monitor;
+
+char *MemoryMonitor::paint_start, *MemoryMonitor::stack_top;
+
+/**
+ * Fill from the end of the heap to just below the stack. An interrupt
+ * taken meanwhile writes its frame below the stack pointer, but it has
+ * returned before painting resumes, so the frame is free to overwrite.
+ */
+void MemoryMonitor::paint() {
+  volatile char here;
+  paint_start = _sbrk(0);
+  // The initial stack pointer is the first word of the vector table
+  stack_top = (char*)*(uintptr_t*)*(volatile uintptr_t*)0xE000ED08; // SCB->VTOR
+  for (char *p = paint_start; p < (char*)&here - (STACK_GUARD); ++p) *p = MEMORY_FILL;
+}
+
+// The bytes of each subsystem's static buffers
+static uint32_t planner_bytes() { return block_buffer_size * sizeof(block_t); }
+static uint32_t queue_bytes() { return sizeof(GCodeQueue::ring_buffer) + TERN0(BUFFER_ARENA, queue.ring_buffer.pool_size); }
+
+static uint32_t shaping_bytes() {
+  #if ENABLED(SHAPING_RUN_QUEUE)
+    return COUNT_ENABLED(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z, INPUT_SHAPING_E) * shaping_runs * sizeof(shaping_run_t);
+  #elif HAS_ZV_SHAPING
+    return shaping_echoes * (sizeof(shaping_time_t) + sizeof(shaping_echo_axis_t));
+  #else
+    return 0;
+  #endif
+}
+
+static uint32_t serial_bytes() {
+  constexpr uint8_t ports = NUM_SERIAL + ENABLED(HAS_DGUS_LCD);
+  #if defined(SERIAL_RX_BUFFER_SIZE) && defined(SERIAL_TX_BUFFER_SIZE)  // STM32 core
+    return ports * ((SERIAL_RX_BUFFER_SIZE) + (SERIAL_TX_BUFFER_SIZE));
+  #elif defined(USART_RX_BUF_SIZE) && defined(USART_TX_BUF_SIZE)        // Maple core
+    return ports * ((USART_RX_BUF_SIZE) + (USART_TX_BUF_SIZE));
+  #else
+    return ports * ((RX_BUFFER_SIZE) + (TX_BUFFER_SIZE));
+  #endif
+}
+
+uint32_t MemoryMonitor::media_bytes() {
+  #if HAS_MEDIA
+    return sizeof(CardReader::volume) + TERN0(SD_READ_AHEAD, sizeof(CardReader::ra_buf));
+  #else
+    return 0;
+  #endif
+}
+
+void MemoryMonitor::report() {
+  char * const heap_end = _sbrk(0);
+
+  // Up from the end of the heap to the first byte the stack reached
+  char *low = _MAX(heap_end, paint_start);
+  while (low < stack_top && *low == MEMORY_FILL) ++low;
+
+  SERIAL_ECHOLNPGM("RAM Static:", uint32_t(&__bss_end__ - (char*)RAM_START),
+                   " Heap:", uint32_t(heap_end - &__bss_end__),
+                   " Free:", hal.freeMemory(),
+                   " Never used:", uint32_t(low - _MAX(heap_end, paint_start)),
+                   " Stack high-water:", uint32_t(stack_top - low));
+  SERIAL_ECHOLNPGM("Buffers Planner:", planner_bytes(),
+                   " Queue:", queue_bytes(),
+                   " Shaping:", shaping_bytes(),
+                   " Serial:", serial_bytes(),
+                   " Media:", media_bytes());
+}
+
+#endif // MEMORY_MONITOR
@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * mem_monitor.h - Stack high-water mark and RAM use by subsystem
+ *
+ * The free RAM between the heap and the stack is filled with a pattern at
+ * boot. The lowest address found overwritten below the stack is as deep as
+ * the stack has grown. Reported by M101, along with free RAM and the static
+ * buffers of the planner, command queue, input shaping, serial ports and media.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class MemoryMonitor {
+  public:
+    static void paint();
+    static void report();
+
+  private:
+    static char *paint_start, *stack_top;
+    static uint32_t media_bytes();
+};
+
+extern MemoryMonitor mem_monitor;
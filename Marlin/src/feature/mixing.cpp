@@ -37,6 +37,13 @@ mixer_comp_t  Mixer::color[NR_MIXING_VIRTUAL_TOOLS][MIXING_STEPPERS];
 int_fast8_t   Mixer::runner = 0;
 mixer_comp_t  Mixer::s_color[MIXING_STEPPERS];
 mixer_accu_t  Mixer::accu[MIXING_STEPPERS] = { 0 };
+#if ENABLED(GRADIENT_MIX_PER_STEP)
+  uint32_t      Mixer::grad_steps = 0;
+  int32_t       Mixer::grad_e_steps,
+                Mixer::grad_q[MIXING_STEPPERS],
+                Mixer::grad_r[MIXING_STEPPERS],
+                Mixer::grad_err[MIXING_STEPPERS];
+#endif
 
 #if ANY(HAS_DUAL_MIXING, GRADIENT_MIX)
   mixer_perc_t Mixer::mix[MIXING_STEPPERS];
@@ -118,6 +118,29 @@ class Mixer {
     MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
   }
 
+  #if ENABLED(GRADIENT_MIX_PER_STEP)
+    /**
+     * Start the block at b_color and reach b_color_end by its last E step.
+     * The change per E step is split into a whole part and a Bresenham
+     * remainder so each step costs only additions.
+     */
+    static void stepper_setup(mixer_comp_t (&b_color)[MIXING_STEPPERS], mixer_comp_t (&b_color_end)[MIXING_STEPPERS], const uint32_t e_steps) {
+      stepper_setup(b_color);
+      grad_steps = 0;
+      if (!e_steps) return;
+      grad_e_steps = e_steps;
+      bool blend = false;
+      MIXER_STEPPER_LOOP(i) {
+        const int32_t dc = int32_t(b_color_end[i]) - int32_t(b_color[i]);
+        int32_t q = dc / int32_t(e_steps), r = dc % int32_t(e_steps);
+        if (r < 0) { r += e_steps; q--; }
+        grad_q[i] = q; grad_r[i] = r; grad_err[i] = 0;
+        if (dc) blend = true;
+      }
+      if (blend) grad_steps = e_steps;
+    }
+  #endif
+
   #if ANY(HAS_DUAL_MIXING, GRADIENT_MIX)
 
     static mixer_perc_t mix[MIXING_STEPPERS];  // Scratch array for the Mix in proportion to 100
@@ -224,6 +247,16 @@ class Mixer {
   // Used in Stepper
   FORCE_INLINE static uint8_t get_stepper() { return runner; }
   FORCE_INLINE static uint8_t get_next_stepper() {
+    #if ENABLED(GRADIENT_MIX_PER_STEP)
+      if (grad_steps) {
+        --grad_steps;
+        MIXER_STEPPER_LOOP(i) {
+          s_color[i] += grad_q[i];
+          grad_err[i] += grad_r[i];
+          if (grad_err[i] >= grad_e_steps) { grad_err[i] -= grad_e_steps; s_color[i]++; }
+        }
+      }
+    #endif
     for (;;) {
       if (--runner < 0) runner = MIXING_STEPPERS - 1;
       accu[runner] += s_color[runner];
@@ -244,6 +277,13 @@ class Mixer {
   static int_fast8_t  runner;
   static mixer_comp_t s_color[MIXING_STEPPERS];
   static mixer_accu_t accu[MIXING_STEPPERS];
+  #if ENABLED(GRADIENT_MIX_PER_STEP)
+    static uint32_t grad_steps;             // E steps left to blend in this block
+    static int32_t grad_e_steps,            // E steps in the block
+                   grad_q[MIXING_STEPPERS], // Whole color change per E step
+                   grad_r[MIXING_STEPPERS], // Remainder, spread by Bresenham
+                   grad_err[MIXING_STEPPERS];
+  #endif
 };
 
 extern Mixer mixer;
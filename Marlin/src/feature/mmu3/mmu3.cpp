@@ -256,7 +256,7 @@ namespace MMU3 {
       while (block_index != planner.block_buffer_head) {
         block = &planner.block_buffer[block_index];
         if (block->steps[E_AXIS] != 0) e_active++;
-        block_index = (block_index + 1) & (BLOCK_BUFFER_SIZE - 1);
+        block_index = block_inc_mod(block_index, 1);
       }
     }
     return (e_active > 0);
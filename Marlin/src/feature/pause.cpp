@@ -558,57 +558,78 @@ void show_continue_prompt(const bool is_reload) {
   SERIAL_ECHO(is_reload ? F(_PMSG(STR_FILAMENT_CHANGE_INSERT) "\n") : F(_PMSG(STR_FILAMENT_CHANGE_WAIT) "\n"));
 }
 
-void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep_count/*=0*/ DXC_ARGS) {
-  DEBUG_SECTION(wfc, "wait_for_confirmation", true);
-  DEBUG_ECHOLNPGM("... is_reload:", is_reload, " maxbeep:", max_beep_count DXC_SAY);
+/**
+ * The wait for confirmation runs as a state machine, one step per call, so
+ * it can be driven by wait_for_confirmation() or from the main loop.
+ */
+enum ConfirmState : uint8_t {
+  CONFIRM_IDLE,       // Not waiting
+  CONFIRM_USER,       // Waiting for a click or M108 to continue
+  CONFIRM_REHEAT,     // The nozzle timed out. Waiting for a click or M108 to reheat.
+  CONFIRM_REHEATING   // Waiting for the nozzle to reach its target
+};
+
+static ConfirmState confirm_state = CONFIRM_IDLE;
+static bool confirm_is_reload;
+static int8_t confirm_max_beep_count;
+
+inline void start_nozzle_timeout() {
+  const millis_t nozzle_timeout = SEC_TO_MS(PAUSE_PARK_NOZZLE_TIMEOUT);
+  HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
+}
 
-  bool nozzle_timed_out = false;
+static void confirmation_start(const bool is_reload, const int8_t max_beep_count) {
+  confirm_is_reload = is_reload;
+  confirm_max_beep_count = max_beep_count;
 
   show_continue_prompt(is_reload);
 
   first_impatient_beep(max_beep_count);
 
   // Start the heater idle timers
-  const millis_t nozzle_timeout = SEC_TO_MS(PAUSE_PARK_NOZZLE_TIMEOUT);
-
-  HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
-
-  #if ENABLED(DUAL_X_CARRIAGE)
-    const int8_t saved_ext        = active_extruder;
-    const bool saved_ext_dup_mode = extruder_duplication_enabled;
-    set_duplication_enabled(false, DXC_ext);
-  #endif
+  start_nozzle_timeout();
 
   // Wait for filament insert by user and press button
-  KEEPALIVE_STATE(PAUSED_FOR_USER);
   TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt(GET_TEXT_F(MSG_NOZZLE_PARKED)));
   TERN_(EXTENSIBLE_UI, ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_NOZZLE_PARKED)));
   wait_for_user = true;    // LCD click or M108 will clear this
-  while (wait_for_user) {
-    impatient_beep(max_beep_count);
+  confirm_state = CONFIRM_USER;
+}
+
+/**
+ * Run one step of the wait for confirmation
+ * - Heaters can time out and must reheat before continuing
+ * Return 'true' once the user has confirmed
+ */
+static bool confirmation_step() {
+  switch (confirm_state) {
+    case CONFIRM_IDLE: return true;
+
+    case CONFIRM_USER: {
+      if (!wait_for_user) { confirm_state = CONFIRM_IDLE; return true; }
+
+      impatient_beep(confirm_max_beep_count);
 
-    // If the nozzle has timed out...
-    if (!nozzle_timed_out)
+      // If the nozzle has timed out...
+      bool nozzle_timed_out = false;
       HOTEND_LOOP() nozzle_timed_out |= thermalManager.heater_idle[e].timed_out;
+      if (!nozzle_timed_out) break;
 
-    // Wait for the user to press the button to re-heat the nozzle, then
-    // re-heat the nozzle, re-show the continue prompt, restart idle timers, start over
-    if (nozzle_timed_out) {
       // If the nozzle timed out but there was no active hotend target when
       // pausing (common when a print starts by heating the bed first),
       // skip the re-heat UI and simply re-show the continue prompt. This
       // prevents presenting the "Nozzle heating" INFOBOX unnecessarily.
-      const celsius_t current_target = thermalManager.degTargetHotend(active_extruder);
-      if (current_target <= 0) {
+      if (thermalManager.degTargetHotend(active_extruder) <= 0) {
         SERIAL_ECHOLNPGM("wait_for_confirmation: nozzle timed out but degTargetHotend==0 - skipping reheat");
         // Re-show the prompt to continue and restart idle timers
-        show_continue_prompt(is_reload);
-        HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
-        nozzle_timed_out = false;
-        first_impatient_beep(max_beep_count);
-        continue;
+        show_continue_prompt(confirm_is_reload);
+        start_nozzle_timeout();
+        first_impatient_beep(confirm_max_beep_count);
+        break;
       }
 
+      // Wait for the user to press the button to re-heat the nozzle, then
+      // re-heat the nozzle, re-show the continue prompt, restart idle timers, start over
       ui.pause_show_message(PAUSE_MESSAGE_HEAT);
       #if ENABLED(SOVOL_SV06_RTS)
         rts.updateTempE0();
@@ -624,7 +645,13 @@ void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep
         ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_HEATER_TIMEOUT));
       #endif
 
-      TERN_(HAS_RESUME_CONTINUE, wait_for_user_response(0, true)); // Wait for LCD click or M108
+      wait_for_user = true;   // Wait for LCD click or M108
+      confirm_state = CONFIRM_REHEAT;
+    } break;
+
+    case CONFIRM_REHEAT:
+      if (wait_for_user) break;
+      while (ui.button_pressed()) safe_delay(50);
 
       TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_do(PROMPT_INFO, GET_TEXT_F(MSG_REHEATING)));
 
@@ -633,16 +660,22 @@ void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep
       // Re-enable the heaters if they timed out
       HOTEND_LOOP() thermalManager.reset_hotend_idle_timer(e);
 
-      // Wait for the heaters to reach the target temperatures
-      ensure_safe_temperature(false);
+      // Wait for the heaters to reach the target temperatures, as ensure_safe_temperature(false) does
+      ui.pause_show_message(PAUSE_MESSAGE_HEATING, PAUSE_MODE_SAME);
+      wait_for_heatup = TERN1(PREVENT_COLD_EXTRUSION, !thermalManager.allow_cold_extrude); // Allow interruption by M108
+      confirm_state = CONFIRM_REHEATING;
+      break;
+
+    case CONFIRM_REHEATING:
+      if (wait_for_heatup && ABS(thermalManager.wholeDegHotend(active_extruder) - thermalManager.degTargetHotend(active_extruder)) > (TEMP_WINDOW))
+        break;
+      wait_for_heatup = false;
 
       // Show the prompt to continue
-      show_continue_prompt(is_reload);
+      show_continue_prompt(confirm_is_reload);
 
       // Start the heater idle timers
-      const millis_t nozzle_timeout = SEC_TO_MS(PAUSE_PARK_NOZZLE_TIMEOUT);
-
-      HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
+      start_nozzle_timeout();
 
       TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt(GET_TEXT_F(MSG_REHEATDONE)));
       #if ENABLED(EXTENSIBLE_UI)
@@ -653,14 +686,104 @@ void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep
 
       IF_DISABLED(PAUSE_REHEAT_FAST_RESUME, wait_for_user = true);
 
-      nozzle_timed_out = false;
-      first_impatient_beep(max_beep_count);
-    }
-    idle_no_sleep();
+      first_impatient_beep(confirm_max_beep_count);
+      confirm_state = CONFIRM_USER;
+      break;
   }
+  return false;
+}
+
+void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep_count/*=0*/ DXC_ARGS) {
+  DEBUG_SECTION(wfc, "wait_for_confirmation", true);
+  DEBUG_ECHOLNPGM("... is_reload:", is_reload, " maxbeep:", max_beep_count DXC_SAY);
+
+  #if ENABLED(DUAL_X_CARRIAGE)
+    const int8_t saved_ext        = active_extruder;
+    const bool saved_ext_dup_mode = extruder_duplication_enabled;
+    set_duplication_enabled(false, DXC_ext);
+  #endif
+
+  KEEPALIVE_STATE(PAUSED_FOR_USER);
+  confirmation_start(is_reload, max_beep_count);
+  while (!confirmation_step()) idle_no_sleep();
+
   TERN_(DUAL_X_CARRIAGE, set_duplication_enabled(saved_ext_dup_mode, saved_ext));
 }
 
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+
+  // The resume_print arguments for the end of the wait
+  static struct {
+    bool pending;
+    int8_t max_beep_count;
+    float slow_load_length, fast_load_length, purge_length;
+    celsius_t targetTemp;
+  } resume_after;
+
+  void pause_wait_start(const bool is_reload, const int8_t max_beep_count,
+    const float slow_load_length, const float fast_load_length, const float purge_length, const celsius_t targetTemp
+  ) {
+    DEBUG_ECHOLNPGM("pause_wait_start is_reload:", is_reload, " maxbeep:", max_beep_count);
+    resume_after.max_beep_count = max_beep_count;
+    resume_after.slow_load_length = slow_load_length;
+    resume_after.fast_load_length = fast_load_length;
+    resume_after.purge_length = purge_length;
+    resume_after.targetTemp = targetTemp;
+    resume_after.pending = true;
+    confirmation_start(is_reload, max_beep_count);
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::PAUSED_FOR_USER);
+  }
+
+  bool pause_wait_active() { return resume_after.pending; }
+
+  void pause_wait_update() {
+    if (!resume_after.pending) return;
+
+    // Keep the steppers powered and the M85 timer from expiring, as idle_no_sleep() does
+    gcode.reset_stepper_timeout();
+
+    if (!confirmation_step()) return;
+
+    resume_after.pending = false;
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::NOT_BUSY);
+    resume_print(resume_after.slow_load_length, resume_after.fast_load_length, resume_after.purge_length,
+                 resume_after.max_beep_count, resume_after.targetTemp);
+  }
+
+  // A canceled print ends the wait without resuming
+  void pause_wait_abort() {
+    if (!resume_after.pending) return;
+    resume_after.pending = false;
+    confirm_state = CONFIRM_IDLE;
+    wait_for_user = wait_for_heatup = false;
+    did_pause_print = 0;
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::NOT_BUSY);
+    TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_end());
+    #if ALL(ADVANCED_PAUSE_FANS_PAUSE, HAS_FAN)
+      thermalManager.set_fans_paused(false);
+    #endif
+    ui.reset_status();
+  }
+
+  /**
+   * Commands from the queue that have to wait for the print to resume:
+   * all G-codes, since they could move the nozzle or change its position,
+   * and the commands that pause, resume or load filament.
+   */
+  bool pause_wait_holds(const char *cmd) {
+    while (*cmd == ' ') ++cmd;
+    if (*cmd == 'N') { do ++cmd; while (NUMERIC(*cmd)); while (*cmd == ' ') ++cmd; }
+    const char letter = *cmd;
+    if (letter == 'G' || letter == 'g') return true;
+    if (letter != 'M' && letter != 'm') return false;
+    switch (atoi(cmd + 1)) {
+      case 24: case 25: case 125: case 600: case 701: case 702: case 1125: return true;
+      default: return false;
+    }
+  }
+
+#endif // ADVANCED_PAUSE_NONBLOCKING
+
 /**
  * Resume or Start print procedure
  *
@@ -672,6 +795,7 @@ void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep
  * - Display "wait for print to resume"
  * - Retract to prevent oozing
  * - Move the nozzle back to resume_position
+ *   - ADVANCED_PAUSE_HEAT_DURING_RETURN: Reach the target temperature during the move
  * - Unretract
  * - Re-prime the nozzle...
  *   -  FWRETRACT: Recover/prime from the prior G10.
@@ -743,9 +867,14 @@ void resume_print(
     load_filament(slow_load_length, fast_load_length, purge_length, max_beep_count, show_lcd, nozzle_timed_out, PAUSE_MODE_SAME DXC_PASS);
   }
 
+  // Finish heating while the nozzle travels back, if it is already hot enough to retract
+  const bool heat_during_return = TERN0(ADVANCED_PAUSE_HEAT_DURING_RETURN,
+    targetTemp > 0 && !axes_should_home() && thermalManager.hotEnoughToExtrude(active_extruder)
+  );
+
   if (targetTemp > 0) {
     thermalManager.setTargetHotend(targetTemp, active_extruder);
-    thermalManager.wait_for_hotend(active_extruder, false);
+    if (!heat_during_return) thermalManager.wait_for_hotend(active_extruder, false);
   }
 
   ui.pause_show_message(PAUSE_MESSAGE_RESUME);
@@ -753,7 +882,7 @@ void resume_print(
   // Check Temperature before moving hotend - but only if we're actually going to retract
   // AND if the nozzle was originally being heated (targetTemp > 0 indicates this)
   // This prevents unwanted heating when pausing during bed-only heating scenarios
-  if (PAUSE_PARK_RETRACT_LENGTH > 0 && targetTemp > 0) {
+  if (PAUSE_PARK_RETRACT_LENGTH > 0 && targetTemp > 0 && !heat_during_return) {
     ensure_safe_temperature(DISABLED(BELTPRINTER));
   }
 
@@ -772,6 +901,9 @@ void resume_print(
     prepare_internal_move_to_destination(NOZZLE_PARK_Z_FEEDRATE);
   }
 
+  // The moves back run while the hotend reaches the target
+  if (heat_during_return) thermalManager.wait_for_hotend(active_extruder, false);
+
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     const bool leveling_was_enabled = planner.leveling_active; // save leveling state
     set_bed_leveling_enabled(false);  // turn off leveling
@@ -104,6 +104,22 @@ void wait_for_confirmation(
   DXC_PARAMS                                                  // Dual-X-Carriage extruder index
 );
 
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+  // Wait for confirmation from the main loop, then call resume_print with these arguments
+  void pause_wait_start(
+    const bool      is_reload,                                // Reload Filament? (otherwise Resume Print)
+    const int8_t    max_beep_count,                           // Beep alert for attention
+    const float     slow_load_length,                         // (mm) Slow Load Length for finishing move
+    const float     fast_load_length,                         // (mm) Fast Load Length for initial move
+    const float     purge_length,                             // (mm) Purge length
+    const celsius_t targetTemp                                // (°C) A target temperature for the hotend
+  );
+  bool pause_wait_active();                                   // Waiting for the user to resume?
+  void pause_wait_update();                                   // Run the wait, called by loop()
+  void pause_wait_abort();                                    // End the wait without resuming
+  bool pause_wait_holds(const char *cmd);                     // Hold this queued command until resumed?
+#endif
+
 void resume_print(
   const float     slow_load_length=0,                         // (mm) Slow Load Length for finishing move
   const float     fast_load_length=0,                         // (mm) Fast Load Length for initial move
@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Planner Monitor
+ * Measure how close the planner is to starving the stepper.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_MONITOR)
+
+#include "planner_monitor.h"
+#include "../module/planner.h"
+
+PlannerMonitor planner_monitor;
+
+PlannerMonitor::counts_t PlannerMonitor::last_second, PlannerMonitor::peak;
+volatile PlannerMonitor::counts_t PlannerMonitor::current;
+uint32_t PlannerMonitor::total_planned, PlannerMonitor::total_consumed, PlannerMonitor::total_recalc_us;
+uint16_t PlannerMonitor::underruns;
+uint8_t PlannerMonitor::min_buffered = BLOCK_BUFFER_SIZE;
+volatile bool PlannerMonitor::starved = true;
+millis_t PlannerMonitor::next_second_ms;
+
+AutoReporter<PlannerMonitor::AutoReportPlanner> PlannerMonitor::auto_reporter;
+void PlannerMonitor::AutoReportPlanner::report() { PlannerMonitor::report(); }
+
+void PlannerMonitor::reset() {
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  current.planned = current.consumed = 0;
+  current.recalc_us = 0;
+  min_buffered = block_buffer_size;
+  starved = true;
+  if (was_on) hal.isr_on();
+
+  last_second = peak = { 0, 0, 0 };
+  total_planned = total_consumed = total_recalc_us = 0;
+  underruns = 0;
+  next_second_ms = millis() + 1000UL;
+}
+
+void PlannerMonitor::tick() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_second_ms)) return;
+  next_second_ms = ms + 1000UL;
+
+  // Take the counts for this second, also written by the Stepper ISR
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  last_second.planned = current.planned;
+  last_second.consumed = current.consumed;
+  last_second.recalc_us = current.recalc_us;
+  current.planned = current.consumed = 0;
+  current.recalc_us = 0;
+  if (was_on) hal.isr_on();
+
+  total_planned += last_second.planned;
+  total_consumed += last_second.consumed;
+  total_recalc_us += last_second.recalc_us;
+  NOLESS(peak.planned, last_second.planned);
+  NOLESS(peak.consumed, last_second.consumed);
+  NOLESS(peak.recalc_us, last_second.recalc_us);
+}
+
+/**
+ * Report the last second and peak values:
+ *   P  : Blocks planned per second (peak)
+ *   C  : Blocks consumed by the stepper per second (peak)
+ *   B  : Blocks in the buffer now, lowest when the stepper took a block, buffer size
+ *   U  : Stepper underruns during a print job
+ *   R  : Time spent in Planner::recalculate() per second, in µs (peak), and average per block
+ */
+void PlannerMonitor::report() {
+  SERIAL_ECHOLNPGM(
+    "Planner P:", last_second.planned, " (", peak.planned, ")"
+    " C:", last_second.consumed, " (", peak.consumed, ")"
+    " B:", planner.movesplanned(), "/", min_buffered, "/", block_buffer_size,
+    " U:", underruns,
+    " R:", last_second.recalc_us, "us (", peak.recalc_us, ") ",
+    total_planned ? total_recalc_us / total_planned : 0UL, "us/blk"
+  );
+}
+
+#endif // PLANNER_MONITOR
@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_monitor.h - Planner throughput and stepper starvation counters
+ *
+ * Counts blocks added by the planner and blocks taken by the Stepper ISR
+ * over each second, the lowest number of blocks left in the buffer when
+ * the ISR took one, stepper underruns during a print job, and the time
+ * spent in Planner::recalculate(). Reported by M213.
+ */
+
+#include "../MarlinCore.h"
+#include "../libs/autoreport.h"
+
+class PlannerMonitor {
+  public:
+    typedef struct {
+      uint16_t planned,       // Blocks added to the planner
+               consumed;      // Blocks taken by the Stepper ISR
+      uint32_t recalc_us;     // Time spent in Planner::recalculate()
+    } counts_t;
+
+    static counts_t last_second,  // Totals for the last complete second
+                    peak;         // Highest per-second values since reset
+    static uint32_t total_planned, total_consumed, total_recalc_us;
+    static uint16_t underruns;    // Times the stepper found no block ready during a print job
+    static uint8_t min_buffered;  // Lowest movesplanned() seen when the Stepper ISR took a block
+
+    static void reset();
+    static void report();
+    static void tick();           // Called from idle() to roll over the per-second counts
+
+    // Called from Planner::_buffer_steps() for each queued block
+    static void block_planned() { ++current.planned; }
+
+    // Called from Planner::recalculate() with its run time
+    static void recalc_done(const uint32_t us) { current.recalc_us += us; }
+
+    // Called from the Stepper ISR when it takes the next block
+    static void block_consumed(const uint8_t buffered) {
+      ++current.consumed;
+      NOMORE(min_buffered, buffered);
+      starved = false;
+    }
+
+    // Called from the Stepper ISR when no block is ready for it.
+    // Only the first miss after a block was taken counts as an underrun.
+    static void block_missed() {
+      if (!starved) { starved = true; if (printJobOngoing()) ++underruns; }
+    }
+
+    struct AutoReportPlanner { static void report(); };
+    static AutoReporter<AutoReportPlanner> auto_reporter;
+
+  private:
+    static volatile counts_t current;
+    static volatile bool starved;
+    static millis_t next_second_ms;
+};
+
+extern PlannerMonitor planner_monitor;
@@ -45,6 +45,59 @@ uint8_t PowerMonitor::flags; // = 0
 millis_t PowerMonitor::display_item_ms;
 uint8_t PowerMonitor::display_item;
 
+#if ENABLED(POWER_BUDGET)
+
+  uint8_t PowerMonitor::bed_scale = 128, PowerMonitor::hotend_scale = 128;
+  #ifdef POWER_BUDGET_MIN_VOLTS
+    bool PowerMonitor::volts_low; // = false
+  #endif
+
+  /**
+   * Adjust the heater duty allowed by the budget ten times a second.
+   * The bed is held back first, as the biggest load with the slowest
+   * response, then the hotends down to POWER_BUDGET_MIN_HOTEND. Duty
+   * comes back in the opposite order, at half the rate, once the readings
+   * are comfortably inside the limits.
+   */
+  void PowerMonitor::budget_task(const millis_t &ms) {
+    static millis_t next_ms = 0;
+    if (PENDING(ms, next_ms)) return;
+    next_ms = ms + 100UL;
+
+    bool over = false, under = true;
+
+    #if ENABLED(POWER_MONITOR_CURRENT)
+      const float watts = getPower();
+      over = watts > (POWER_BUDGET_WATTS);
+      under = watts < (POWER_BUDGET_WATTS) * 0.9f;
+    #endif
+
+    #ifdef POWER_BUDGET_MIN_VOLTS
+      const float v = getVolts();
+      if (v < (POWER_BUDGET_MIN_VOLTS))
+        volts_low = true;
+      else if (v > (POWER_BUDGET_MIN_VOLTS) + 0.5f)
+        volts_low = false;
+      if (volts_low) { over = true; under = false; }
+    #endif
+
+    constexpr uint8_t hotend_min = (POWER_BUDGET_MIN_HOTEND) * 128 / 100;
+    if (over) {
+      if (bed_scale)
+        bed_scale = bed_scale > 8 ? bed_scale - 8 : 0;
+      else if (hotend_scale > hotend_min)
+        hotend_scale = _MAX(hotend_scale - 8, hotend_min);
+    }
+    else if (under) {
+      if (hotend_scale < 128)
+        hotend_scale = _MIN(hotend_scale + 4, 128);
+      else if (bed_scale < 128)
+        bed_scale = _MIN(bed_scale + 4, 128);
+    }
+  }
+
+#endif // POWER_BUDGET
+
 PowerMonitor power_monitor; // Single instance - this calls the constructor
 
 #if HAS_MARLINUI_U8GLIB
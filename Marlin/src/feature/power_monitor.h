@@ -125,6 +125,16 @@ public:
     #endif
   }
 
+  #if ENABLED(POWER_BUDGET)
+    static uint8_t bed_scale, hotend_scale; // Heater duty allowed by the budget (128 = 100%)
+    #ifdef POWER_BUDGET_MIN_VOLTS
+      static bool volts_low;                // The supply voltage is under POWER_BUDGET_MIN_VOLTS
+    #endif
+    static void budget_task(const millis_t &ms);
+    static uint8_t bed_duty(const uint8_t duty) { return (uint16_t(duty) * bed_scale) >> 7; }
+    static uint8_t hotend_duty(const uint8_t duty) { return (uint16_t(duty) * hotend_scale) >> 7; }
+  #endif
+
   static void capture_values() {
     #if ENABLED(POWER_MONITOR_CURRENT)
      amps.capture();
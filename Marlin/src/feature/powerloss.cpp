@@ -53,6 +53,17 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+  static_assert(sizeof(job_recovery_record_t) <= 64, "job_recovery_record_t is too large for a journal slot.");
+  uint16_t PrintJobRecovery::journal_index = POWER_LOSS_JOURNAL_RECORDS,
+           PrintJobRecovery::journal_crc;
+#endif
+
+#if HAS_PLR_STORE
+  bool PrintJobRecovery::outage_save; // = false
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -99,7 +110,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { info = {}; }
+void PrintJobRecovery::init() {
+  info = {};
+  TERN_(POWER_LOSS_JOURNAL, journal_index = POWER_LOSS_JOURNAL_RECORDS);
+}
 
 /**
  * Enable or disable then call changed()
@@ -147,6 +161,7 @@ bool PrintJobRecovery::check() {
 void PrintJobRecovery::purge() {
   init();
   card.removeJobRecoveryFile();
+  TERN_(HAS_PLR_STORE, plr_store.clear());
 }
 
 /**
@@ -156,7 +171,25 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Apply the records appended since the full save, up to the first invalid one
+      if (info.valid())
+        for (uint16_t i = 0; i < POWER_LOSS_JOURNAL_RECORDS && read_record(i); ++i) { /* nada */ }
+      journal_index = POWER_LOSS_JOURNAL_RECORDS; // Start over with a full save
+    #endif
     close();
+
+    #if HAS_PLR_STORE
+      // A record saved on outage is the latest. Mirror it to the SD file and free the store.
+      if (info.valid()) {
+        job_recovery_record_t rec;
+        plr_store.read(rec);
+        if (apply_record(rec, rec.index)) {
+          write();
+          plr_store.clear();
+        }
+      }
+    #endif
   }
   debug(F("Load"));
 }
@@ -167,6 +200,12 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // A new job id, so records left in a reused file by a previous job aren't applied
+    info.journal_id = uint16_t(millis());
+    journal_index = POWER_LOSS_JOURNAL_RECORDS;
+  #endif
+  TERN_(HAS_PLR_STORE, plr_store.prepare());
 }
 
 /**
@@ -254,6 +293,10 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     // Elapsed print job time
     info.print_job_elapsed = print_job_timer.duration();
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      info.job_filament = print_job_timer.getJobStats().filamentUsed;
+      info.job_layers = print_job_timer.getJobStats().layers;
+    #endif
 
     // Relative axis modes
     info.axis_relative = gcode.axis_relative;
@@ -262,6 +305,30 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // A record will do if the SD file has a full save of the rest of the state
+      const bool can_append = journal_index < POWER_LOSS_JOURNAL_RECORDS && state_crc() == journal_crc;
+
+      #if HAS_PLR_STORE
+        // On outage put the record in the fast store
+        if (outage_save && can_append) {
+          job_recovery_record_t rec;
+          fill_record(rec, journal_index);
+          plr_store.write(rec);
+          return;
+        }
+      #endif
+
+      // Append a record, unless the journal is full or the rest of the state has changed
+      if (!force && can_append) {
+        debug(F("Record"));
+        open(false);
+        write_record(journal_index++);
+        if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+        return;
+      }
+    #endif
+
     write();
   }
 }
@@ -326,7 +393,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     // Save the current position, distance that Z was (or should be) raised,
     // and a flag whether the raise was already done here.
-    if (card.isStillPrinting()) save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+    if (card.isStillPrinting()) {
+      TERN_(HAS_PLR_STORE, outage_save = true);
+      save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+      TERN_(HAS_PLR_STORE, outage_save = false);
+    }
 
     // Tell the LCD about the outage, even though it is about to die
     TERN_(EXTENSIBLE_UI, ExtUI::onPowerLoss());
@@ -359,13 +430,134 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    ++info.journal_id;            // The previous records no longer apply
+    journal_index = 0;
+    journal_crc = state_crc();
+  #endif
+
   open(false);
   file.seekSet(0);
   const int16_t ret = file.write(&info, sizeof(info));
   if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  TERN_(POWER_LOSS_JOURNAL, write_record(0, true)); // End the journal here
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * CRC of the state that isn't kept in a record. A full save is needed when it changes.
+   */
+  uint16_t PrintJobRecovery::state_crc() {
+    job_recovery_info_t state;
+    memcpy((void*)&state, (const void*)&info, sizeof(state));
+    state.valid_head = state.valid_foot = 0;
+    state.journal_id = 0;
+    state.sdpos = 0;
+    state.current_position.reset();
+    state.print_job_elapsed = 0;
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      state.job_filament = 0;
+      state.job_layers = 0;
+    #endif
+    state.feedrate = 0;
+    #if HAS_HOTEND
+      HOTEND_LOOP() state.target_temperature[e] = 0;
+    #endif
+    TERN_(HAS_HEATED_BED, state.target_temperature_bed = 0);
+    TERN_(HAS_FAN, state.fan_speed[0] = 0);
+    state.zraise = 0;
+    state.flag.raised = false;
+    uint16_t crc = 0;
+    crc16(&crc, &state, sizeof(state));
+    return crc;
+  }
+
+  // Start from 0xFFFF so a zeroed memory doesn't hold a valid record
+  static uint16_t record_crc(const job_recovery_record_t &rec) {
+    uint16_t crc = 0xFFFF;
+    crc16(&crc, &rec, offsetof(job_recovery_record_t, crc));
+    return crc;
+  }
+
+  /**
+   * Fill a record from the info
+   */
+  void PrintJobRecovery::fill_record(job_recovery_record_t &rec, const uint16_t index) {
+    memset(&rec, 0, sizeof(rec));
+    rec.journal_id = info.journal_id;
+    rec.index = index;
+    rec.sdpos = info.sdpos;
+    rec.current_position = info.current_position;
+    rec.print_job_elapsed = info.print_job_elapsed;
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      rec.job_filament = info.job_filament;
+      rec.job_layers = info.job_layers;
+    #endif
+    rec.feedrate = info.feedrate;
+    #if HAS_HOTEND
+      COPY(rec.target_temperature, info.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, rec.target_temperature_bed = info.target_temperature_bed);
+    TERN_(HAS_FAN, rec.fan_speed = info.fan_speed[0]);
+    rec.zraise = info.zraise;
+    rec.raised = info.flag.raised;
+    rec.crc = record_crc(rec);
+  }
+
+  /**
+   * Apply a record to the info.
+   * Return false if it doesn't belong to the loaded full save.
+   */
+  bool PrintJobRecovery::apply_record(const job_recovery_record_t &rec, const uint16_t index) {
+    if (rec.crc != record_crc(rec) || rec.journal_id != info.journal_id || rec.index != index) return false;
+    info.sdpos = rec.sdpos;
+    info.current_position = rec.current_position;
+    info.print_job_elapsed = rec.print_job_elapsed;
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      info.job_filament = rec.job_filament;
+      info.job_layers = rec.job_layers;
+    #endif
+    info.feedrate = rec.feedrate;
+    #if HAS_HOTEND
+      COPY(info.target_temperature, rec.target_temperature);
+    #endif
+    TERN_(HAS_HEATED_BED, info.target_temperature_bed = rec.target_temperature_bed);
+    TERN_(HAS_FAN, info.fan_speed[0] = rec.fan_speed);
+    info.zraise = rec.zraise;
+    info.flag.raised = rec.raised;
+    return true;
+  }
+
+  /**
+   * Write a record to its slot in the open recovery file. The file was preallocated
+   * so this only rewrites one sector. A cleared record ends the journal for load().
+   */
+  void PrintJobRecovery::write_record(const uint16_t index, const bool clear/*=false*/) {
+    job_recovery_record_t rec;
+    if (clear) {
+      memset(&rec, 0, sizeof(rec));
+      rec.journal_id = ~info.journal_id;
+    }
+    else
+      fill_record(rec, index);
+    file.seekSet(journal_start + uint32_t(index) * record_slot);
+    if (file.write(&rec, sizeof(rec)) == -1) DEBUG_ECHOLNPGM("Power-loss record write failed.");
+  }
+
+  /**
+   * Read a record from the open recovery file and apply it to the info
+   */
+  bool PrintJobRecovery::read_record(const uint16_t index) {
+    job_recovery_record_t rec;
+    if (!file.seekSet(journal_start + uint32_t(index) * record_slot)) return false;
+    if (file.read(&rec, sizeof(rec)) != int16_t(sizeof(rec))) return false;
+    return apply_record(rec, index);
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -597,6 +789,7 @@ void PrintJobRecovery::resume() {
   // Resume the SD file from the last position
   PROCESS_SUBCOMMANDS_NOW(MString<MAX_CMD_SIZE>(F("M23 "), info.sd_filename));
   PROCESS_SUBCOMMANDS_NOW(TS(F("M24S"), resume_sdpos, 'T', info.print_job_elapsed));
+  TERN_(PRINTCOUNTER_JOB_STATS, print_job_timer.resumeJob(info.job_filament, info.job_layers));
 
   #if ENABLED(SOVOL_SV06_RTS)
     if (rts.print_state) rts.refreshTime();
@@ -129,6 +129,16 @@ typedef struct {
   // Job elapsed time
   millis_t print_job_elapsed;
 
+  #if ENABLED(PRINTCOUNTER_JOB_STATS)
+    // Job statistics not yet saved to EEPROM
+    float job_filament;
+    uint16_t job_layers;
+  #endif
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    uint16_t journal_id;          // Identifies the records that follow this full save
+  #endif
+
   // Relative axis modes
   relative_t axis_relative;
 
@@ -151,6 +161,58 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // A record appended to the recovery file between full saves
+  typedef struct {
+    uint16_t journal_id;          // info.journal_id of the full save
+    uint16_t index;               // Position in the journal
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    millis_t print_job_elapsed;
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      float job_filament;
+      uint16_t job_layers;
+    #endif
+    uint16_t feedrate;
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed;          // Fan 0
+    #endif
+    float zraise;
+    bool raised;
+    uint16_t crc;                 // CRC16 of all the above
+  } job_recovery_record_t;
+
+#endif
+
+#if HAS_PLR_STORE
+
+  /**
+   * Fast storage for the record saved on outage, so the outage handler doesn't
+   * have to write to the SD card. The record is mirrored to the SD file on the
+   * next boot. Each backend implements this class in its own file:
+   *  - POWER_LOSS_STORE_SPI_FLASH   : feature/powerloss_spi_flash.cpp
+   *  - POWER_LOSS_STORE_BACKUP_SRAM : HAL/STM32/powerloss_bkp.cpp
+   */
+  class PowerLossStore {
+    public:
+      static void init();
+      static void prepare();                                // Get ready for write(). May be slow (e.g., an erase).
+      static void write(const job_recovery_record_t &rec);  // Called on outage, so it must be fast
+      static void read(job_recovery_record_t &rec);
+      static void clear();
+  };
+
+  extern PowerLossStore plr_store;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -166,6 +228,13 @@ class PrintJobRecovery {
       static bool ui_flag_resume;     //!< Flag the UI to show a dialog to Resume (M1000) or Cancel (M1000C)
     #endif
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // The full save fills the first sectors, followed by the record slots. A slot never crosses a sector.
+      static constexpr uint16_t journal_start = (sizeof(job_recovery_info_t) + 511) & ~511U,
+                                record_slot = sizeof(job_recovery_record_t) <= 32 ? 32 : 64;
+      static constexpr uint32_t file_size = journal_start + uint32_t(POWER_LOSS_JOURNAL_RECORDS) * record_slot;
+    #endif
+
     static void init();
     static void prepare();
 
@@ -182,6 +251,7 @@ class PrintJobRecovery {
           SET_INPUT(POWER_LOSS_PIN);
         #endif
       #endif
+      TERN_(HAS_PLR_STORE, plr_store.init());
     }
 
     // Track each command's file offsets
@@ -236,6 +306,20 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint16_t journal_index,  //!< Next record slot. POWER_LOSS_JOURNAL_RECORDS to do a full save.
+                      journal_crc;    //!< state_crc() at the last full save
+      static uint16_t state_crc();
+      static void fill_record(job_recovery_record_t &rec, const uint16_t index);
+      static bool apply_record(const job_recovery_record_t &rec, const uint16_t index);
+      static void write_record(const uint16_t index, const bool clear=false);
+      static bool read_record(const uint16_t index);
+    #endif
+
+    #if HAS_PLR_STORE
+      static bool outage_save;        //!< Save to the fast store instead of the SD card
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float zraise);
     #endif
@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/powerloss_spi_flash.cpp - Power-loss outage record in W25Qxx SPI flash
+ *
+ * The sector is erased when a job starts, so the outage handler only has to
+ * program one page, which takes well under a millisecond.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(POWER_LOSS_STORE_SPI_FLASH)
+
+#include "powerloss.h"
+#include "../libs/W25Qxx.h"
+
+PowerLossStore plr_store;
+
+static_assert(sizeof(job_recovery_record_t) <= SPI_FLASH_PageSize, "job_recovery_record_t must fit in one SPI flash page.");
+static_assert(!(POWER_LOSS_STORE_ADDR & (SPI_FLASH_SectorSize - 1)), "POWER_LOSS_STORE_ADDR must be the start of a 4K sector.");
+
+static bool erased; // The record page is known to be erased
+
+void PowerLossStore::init() { W25QXX.init(SPI_QUARTER_SPEED); }
+
+void PowerLossStore::prepare() {
+  if (!erased) clear();
+}
+
+void PowerLossStore::write(const job_recovery_record_t &rec) {
+  W25QXX.SPI_FLASH_PageWrite((uint8_t*)&rec, POWER_LOSS_STORE_ADDR, sizeof(rec));
+  erased = false;
+}
+
+void PowerLossStore::read(job_recovery_record_t &rec) {
+  W25QXX.SPI_FLASH_BufferRead((uint8_t*)&rec, POWER_LOSS_STORE_ADDR, sizeof(rec));
+}
+
+void PowerLossStore::clear() {
+  // Skip the erase if the page is still blank
+  job_recovery_record_t rec;
+  read(rec);
+  const uint8_t *p = (uint8_t*)&rec;
+  erased = true;
+  for (uint16_t i = 0; i < sizeof(rec); ++i) if (p[i] != 0xFF) { erased = false; break; }
+  if (!erased) {
+    W25QXX.SPI_FLASH_SectorErase(POWER_LOSS_STORE_ADDR);
+    erased = true;
+  }
+}
+
+#endif // POWER_LOSS_STORE_SPI_FLASH
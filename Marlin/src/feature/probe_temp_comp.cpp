@@ -65,21 +65,28 @@ uint8_t ProbeTempComp::calib_idx; // = 0
 float ProbeTempComp::init_measurement; // = 0.0
 bool ProbeTempComp::enabled = true;
 
+#if ENABLED(PTC_POLYNOMIAL)
+  float ProbeTempComp::model[TSI_COUNT][3];
+#endif
+
 void ProbeTempComp::reset() {
   TERN_(PTC_PROBE, for (uint8_t i = 0; i < PTC_PROBE_COUNT; ++i) z_offsets_probe[i] = z_offsets_probe_default[i]);
   TERN_(PTC_BED, for (uint8_t i = 0; i < PTC_BED_COUNT; ++i) z_offsets_bed[i] = z_offsets_bed_default[i]);
   TERN_(PTC_HOTEND, for (uint8_t i = 0; i < PTC_HOTEND_COUNT; ++i) z_offsets_hotend[i] = z_offsets_hotend_default[i]);
+  TERN_(PTC_POLYNOMIAL, fit_all());
 }
 
 void ProbeTempComp::clear_offsets(const TempSensorID tsi) {
   for (uint8_t i = 0; i < cali_info[tsi].measurements; ++i)
     sensor_z_offsets[tsi][i] = 0;
   calib_idx = 0;
+  TERN_(PTC_POLYNOMIAL, fit_model(tsi));
 }
 
 bool ProbeTempComp::set_offset(const TempSensorID tsi, const uint8_t idx, const int16_t offset) {
   if (idx >= cali_info[tsi].measurements) return false;
   sensor_z_offsets[tsi][idx] = offset;
+  TERN_(PTC_POLYNOMIAL, fit_model(tsi));
   return true;
 }
 
@@ -93,6 +100,9 @@ void ProbeTempComp::print_offsets() {
       );
       temp += cali_info[s].temp_resolution;
     }
+    #if ENABLED(PTC_POLYNOMIAL)
+      SERIAL_ECHOLNPGM("Model: ", p_float_t(model[s][0], 2), " + ", p_float_t(model[s][1], 3), "*dT + ", p_float_t(model[s][2], 5), "*dT^2 um");
+    #endif
   }
   #if ENABLED(DEBUG_PTC)
     float meas[4] = { 0, 0, 0, 0 };
@@ -114,6 +124,39 @@ void ProbeTempComp::push_back_new_measurement(const TempSensorID tsi, const floa
   sensor_z_offsets[tsi][calib_idx++] = static_cast<int16_t>((meas_z - init_measurement) * 1000.0f);
 }
 
+#if ENABLED(PTC_POLYNOMIAL)
+
+  void ProbeTempComp::fit_model(const TempSensorID tsi) {
+    const uint8_t measurements = cali_info[tsi].measurements;
+    const float res_temp = cali_info[tsi].temp_resolution;
+    const int16_t * const data = sensor_z_offsets[tsi];
+    float * const c = model[tsi];
+
+    // Sums of t^k and t^k*z over the points, starting with the base point (0, 0)
+    float n = 1, s1 = 0, s2 = 0, s3 = 0, s4 = 0, z0 = 0, z1 = 0, z2 = 0;
+    for (uint8_t i = 0; i < measurements; ++i) {
+      const float t = (i + 1) * res_temp, t2 = sq(t), z = data[i];
+      n++; s1 += t; s2 += t2; s3 += t2 * t; s4 += sq(t2);
+      z0 += z; z1 += t * z; z2 += t2 * z;
+    }
+
+    // Solve the normal equations by Cramer's rule, or fall back to a line
+    const float det = n * (s2 * s4 - s3 * s3) - s1 * (s1 * s4 - s2 * s3) + s2 * (s1 * s3 - s2 * s2);
+    if (measurements >= 2 && fabs(det) > 1e-3f) {
+      c[0] = (z0 * (s2 * s4 - s3 * s3) - s1 * (z1 * s4 - z2 * s3) + s2 * (z1 * s3 - z2 * s2)) / det;
+      c[1] = (n * (z1 * s4 - z2 * s3) - z0 * (s1 * s4 - s2 * s3) + s2 * (s1 * z2 - s2 * z1)) / det;
+      c[2] = (n * (s2 * z2 - s3 * z1) - s1 * (s1 * z2 - s2 * z1) + z0 * (s1 * s3 - s2 * s2)) / det;
+    }
+    else {
+      const float d = n * s2 - sq(s1);
+      c[2] = 0;
+      c[1] = fabs(d) > 1e-3f ? (n * z1 - s1 * z0) / d : 0;
+      c[0] = (z0 - c[1] * s1) / n;
+    }
+  }
+
+#endif // PTC_POLYNOMIAL
+
 bool ProbeTempComp::finish_calibration(const TempSensorID tsi) {
   if (!calib_idx) {
     SERIAL_ECHOLNPGM("!No measurements.");
@@ -163,6 +206,7 @@ bool ProbeTempComp::finish_calibration(const TempSensorID tsi) {
     }
   }
 
+  TERN_(PTC_POLYNOMIAL, fit_model(tsi));
   return true;
 }
 
@@ -174,6 +218,24 @@ void ProbeTempComp::apply_compensation(float &meas_z) {
 }
 
 void ProbeTempComp::compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z) {
+  #if ENABLED(PTC_POLYNOMIAL)
+  {
+    // Evaluate the curve inside the table, and go on along its tangent outside
+    const float * const c = model[tsi],
+                tmax = cali_info[tsi].measurements * cali_info[tsi].temp_resolution,
+                t = temp - cali_info[tsi].start_temp;
+    float offset;
+    if (t < 0)
+      offset = TERN(PTC_LINEAR_EXTRAPOLATION, c[0] + c[1] * t, 0.0f);
+    else if (t > tmax)
+      offset = (c[2] * tmax + c[1]) * tmax + c[0] + (2 * c[2] * tmax + c[1]) * (t - tmax);
+    else
+      offset = (c[2] * t + c[1]) * t + c[0];
+    meas_z -= offset / 1000.0f;
+    return;
+  }
+  #endif
+
   const uint8_t measurements = cali_info[tsi].measurements;
   const celsius_t start_temp = cali_info[tsi].start_temp,
                   res_temp = cali_info[tsi].temp_resolution,
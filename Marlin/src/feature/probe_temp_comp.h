@@ -89,6 +89,11 @@ class ProbeTempComp {
     static bool finish_calibration(const TempSensorID tsi);
     static void set_enabled(const bool ena) { enabled = ena; }
 
+    #if ENABLED(PTC_POLYNOMIAL)
+      // Fit the curves to the current tables. Call after the tables change.
+      static void fit_all() { for (uint8_t s = 0; s < TSI_COUNT; ++s) fit_model(TempSensorID(s)); }
+    #endif
+
     // Apply all temperature compensation adjustments
     static void apply_compensation(float &meas_z);
 
@@ -111,6 +116,15 @@ class ProbeTempComp {
     static bool linear_regression(const TempSensorID tsi, float &k, float &d);
 
     static void compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z);
+
+    #if ENABLED(PTC_POLYNOMIAL)
+      /**
+       * z(t) = c[0] + c[1] * t + c[2] * t², in µm, with t in °C above the start
+       * temperature. Fitted by least squares to the base point and the table.
+       */
+      static float model[TSI_COUNT][3];
+      static void fit_model(const TempSensorID tsi);
+    #endif
 };
 
 extern ProbeTempComp ptc;
@@ -37,12 +37,26 @@
 repeat_marker_t Repeat::marker[MAX_REPEAT_NESTING];
 uint8_t Repeat::index;
 
+#if HAS_REPEAT_CACHE
+  uint8_t Repeat::cache[GCODE_REPEAT_CACHE];
+  uint16_t Repeat::cache_used, Repeat::cache_read;
+  uint8_t Repeat::cache_marker;
+  uint32_t Repeat::cache_end;
+  Repeat::CacheState Repeat::cache_state; // = CACHE_NONE
+#endif
+
 void Repeat::add_marker(const uint32_t sdpos, const uint16_t count) {
   if (index >= MAX_REPEAT_NESTING)
     SERIAL_ECHO_MSG("!Too many markers.");
   else {
     marker[index].sdpos = sdpos;
     marker[index].counter = count ? count - 1 : -1;
+    #if HAS_REPEAT_CACHE
+      // Record the body of the innermost loop
+      cache_state = CACHE_RECORDING;
+      cache_marker = index;
+      cache_used = 0;
+    #endif
     index++;
     DEBUG_ECHOLNPGM("Add Marker ", index, " at ", sdpos, " (", count, ")");
   }
@@ -58,6 +72,14 @@ void Repeat::loop() {
       index--;                          //  Carry on. Previous marker on the next 'M808'.
     }
     else {
+      #if HAS_REPEAT_CACHE
+        // Replay the body from RAM if it was recorded up to this 'M808'
+        if (cache_marker == ind && cache_end == card.getIndex() && (cache_state == CACHE_COMPLETE || cache_state == CACHE_REPLAYING)) {
+          cache_state = CACHE_REPLAYING;
+          cache_read = 0;
+        }
+        else
+      #endif
       card.setIndex(marker[ind].sdpos); // Loop back to the marker.
       if (marker[ind].counter > 0)      // Ignore a negative (or zero) counter.
         --marker[ind].counter;          // Decrement the counter. If zero this 'M808' will be skipped next time.
@@ -66,6 +88,43 @@ void Repeat::loop() {
   }
 }
 
+#if HAS_REPEAT_CACHE
+
+  /**
+   * Add a line read from the media to the loop body being recorded.
+   * sdpos is the position after the line, for Power-Loss Recovery.
+   * The closing 'M808' completes the body. A body too big for the
+   * cache is dropped and the loop reads from the media as usual.
+   */
+  void Repeat::cache_line(const char * const cmd, const uint32_t sdpos) {
+    if (cache_state != CACHE_RECORDING) return;
+    const uint16_t len = strlen(cmd) + 1;
+    if (cache_used + sizeof(sdpos) + len > sizeof(cache)) { cache_state = CACHE_NONE; return; }
+    memcpy(&cache[cache_used], &sdpos, sizeof(sdpos));
+    memcpy(&cache[cache_used + sizeof(sdpos)], cmd, len);
+    cache_used += sizeof(sdpos) + len;
+    if (is_command_M808(cmd) && index == cache_marker + 1) {
+      cache_state = CACHE_COMPLETE;
+      cache_end = sdpos;
+    }
+  }
+
+  /**
+   * Copy the next line of the body being replayed and return its sdpos.
+   * The replay ends after the closing 'M808', unless it loops again.
+   */
+  uint32_t Repeat::next_cached_line(char * const cmd) {
+    uint32_t sdpos;
+    memcpy(&sdpos, &cache[cache_read], sizeof(sdpos));
+    const char * const src = (char*)&cache[cache_read + sizeof(sdpos)];
+    strcpy(cmd, src);
+    cache_read += sizeof(sdpos) + strlen(src) + 1;
+    if (cache_read >= cache_used) cache_state = CACHE_COMPLETE;
+    return sdpos;
+  }
+
+#endif // HAS_REPEAT_CACHE
+
 void Repeat::cancel() { for (uint8_t i = 0; i < index; ++i) marker[i].counter = 0; }
 
 void Repeat::early_parse_M808(char * const cmd) {
@@ -37,13 +37,23 @@ class Repeat {
 private:
   static repeat_marker_t marker[MAX_REPEAT_NESTING];
   static uint8_t index;
+
+  #if HAS_REPEAT_CACHE
+    enum CacheState : uint8_t { CACHE_NONE, CACHE_RECORDING, CACHE_COMPLETE, CACHE_REPLAYING };
+    static uint8_t cache[GCODE_REPEAT_CACHE];   // Each line: the sdpos after it, then the command and a nul
+    static uint16_t cache_used, cache_read;
+    static uint8_t cache_marker;                // Marker index of the cached loop body
+    static uint32_t cache_end;                  // sdpos after the closing 'M808'
+    static CacheState cache_state;
+  #endif
+
 public:
-  static void reset() { index = 0; }
+  static void reset() { index = 0; TERN_(HAS_REPEAT_CACHE, cache_state = CACHE_NONE); }
   static bool is_active() {
     for (uint8_t i = 0; i < index; ++i) if (marker[i].counter) return true;
     return false;
   }
-  static bool is_command_M808(char * const cmd) { return cmd[0] == 'M' && cmd[1] == '8' && cmd[2] == '0' && cmd[3] == '8' && !NUMERIC(cmd[4]); }
+  static bool is_command_M808(const char * const cmd) { return cmd[0] == 'M' && cmd[1] == '8' && cmd[2] == '0' && cmd[3] == '8' && !NUMERIC(cmd[4]); }
   static void early_parse_M808(char * const cmd);
   static void add_marker(const uint32_t sdpos, const uint16_t count);
   static void loop();
@@ -51,6 +61,12 @@ public:
   static uint8_t count() { return index; }
   static int16_t get_marker_counter(const uint8_t i) { return marker[i].counter; }
   static uint32_t get_marker_sdpos(const uint8_t i) { return marker[i].sdpos; }
+
+  #if HAS_REPEAT_CACHE
+    static void cache_line(const char * const cmd, const uint32_t sdpos);
+    static bool replaying() { return cache_state == CACHE_REPLAYING; }
+    static uint32_t next_cached_line(char * const cmd);
+  #endif
 };
 
 extern Repeat repeat;
@@ -0,0 +1,247 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * resonance.cpp - Measure axis resonances for input shaping
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(RESONANCE_TUNING)
+
+#include "resonance.h"
+#include "accelerometer.h"
+
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+
+ResonanceTuner resonance_tuner;
+
+int16_t ResonanceTuner::re[RESONANCE_FFT_SIZE], ResonanceTuner::im[RESONANCE_FFT_SIZE];
+float ResonanceTuner::psd[RESONANCE_BINS];
+uint16_t ResonanceTuner::fill;
+uint8_t ResonanceTuner::sensor_axis;
+resonance_t *ResonanceTuner::res;
+
+static_assert(IS_POWER_OF_2(RESONANCE_FFT_SIZE), "RESONANCE_FFT_SIZE must be a power of 2.");
+
+// Quarter wave of sin(2πk/N) in Q15, filled on first use
+static int16_t sine_q15[RESONANCE_FFT_SIZE / 4 + 1];
+
+// cos(2πk/N) in Q15, for any k
+static int32_t cos_q15(uint16_t k) {
+  constexpr uint16_t Q = RESONANCE_FFT_SIZE / 4;
+  k &= RESONANCE_FFT_SIZE - 1;
+  switch (k / Q) {
+    case 0:  return  sine_q15[Q - k];
+    case 1:  return -sine_q15[k - Q];
+    case 2:  return -sine_q15[3 * Q - k];
+    default: return  sine_q15[k - 3 * Q];
+  }
+}
+static int32_t sin_q15(const uint16_t k) { return cos_q15(k - RESONANCE_FFT_SIZE / 4); }
+
+/**
+ * In-place radix-2 FFT of re[] + i·im[]. Each stage halves the values to
+ * stay within 16 bits, so the result is the transform divided by N.
+ */
+void ResonanceTuner::fft() {
+  constexpr uint16_t N = RESONANCE_FFT_SIZE;
+
+  // Bit-reversed order
+  for (uint16_t i = 1, j = 0; i < N; ++i) {
+    uint16_t bit = N >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      const int16_t tr = re[i], ti = im[i];
+      re[i] = re[j]; im[i] = im[j];
+      re[j] = tr; im[j] = ti;
+    }
+  }
+
+  for (uint16_t len = 2; len <= N; len <<= 1) {
+    const uint16_t half = len >> 1, step = N / len;
+    for (uint16_t k = 0; k < half; ++k) {
+      const int32_t wr = cos_q15(k * step), wi = -sin_q15(k * step);
+      for (uint16_t a = k; a < N; a += len) {
+        const uint16_t b = a + half;
+        const int32_t tr = (wr * re[b] - wi * im[b]) >> 15,
+                      ti = (wr * im[b] + wi * re[b]) >> 15;
+        re[b] = (re[a] - tr) >> 1; im[b] = (im[a] - ti) >> 1;
+        re[a] = (re[a] + tr) >> 1; im[a] = (im[a] + ti) >> 1;
+      }
+    }
+  }
+}
+
+// Window the full sample buffer, transform it and add its power spectrum
+void ResonanceTuner::add_window() {
+  constexpr uint16_t N = RESONANCE_FFT_SIZE;
+
+  // Remove the offset (gravity and sensor bias)
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < N; ++i) sum += re[i];
+  const int32_t mean = sum / N;
+
+  // Hann window, scaled so the largest value uses about 14 bits
+  int32_t peak = 1;
+  for (uint16_t i = 0; i < N; ++i) NOLESS(peak, ABS(re[i] - mean));
+  int8_t shift = 0;
+  while ((peak << 1) < 0x2000 && shift < 12) { peak <<= 1; ++shift; }
+  while (peak >= 0x4000) { peak >>= 1; --shift; }
+
+  for (uint16_t i = 0; i < N; ++i) {
+    int32_t v = re[i] - mean;
+    v = shift >= 0 ? v << shift : v >> -shift;
+    const int32_t w = (0x8000 - cos_q15(i)) >> 1;                  // 0.5 - 0.5·cos, Q15
+    re[i] = int16_t((v * w) >> 15);
+    im[i] = 0;
+  }
+
+  fft();
+
+  // Undo the input scaling so every window adds on the same scale
+  for (uint16_t i = 0; i < RESONANCE_BINS; ++i) {
+    const float p = sq(float(re[i])) + sq(float(im[i]));
+    psd[i] += ldexpf(p, -2 * shift);
+  }
+
+  ++res->windows;
+}
+
+// Drain the sensor FIFO into the sample buffer
+void ResonanceTuner::poll() {
+  accel_sample_t samples[ACCEL_FIFO_DEPTH];
+  bool overrun;
+  const uint8_t n = accelerometer.read(samples, ACCEL_FIFO_DEPTH, overrun);
+  if (overrun) { fill = 0; ++res->overruns; }  // Samples are missing, so start the window over
+
+  for (uint8_t i = 0; i < n; ++i) {
+    const accel_sample_t &s = samples[i];
+    re[fill] = sensor_axis == 0 ? s.x : sensor_axis == 1 ? s.y : s.z;
+    if (++fill == RESONANCE_FFT_SIZE) { add_window(); fill = 0; }
+  }
+}
+
+bool ResonanceTuner::measure(const AxisEnum axis, const sweep_t &sweep, resonance_t &result) {
+  if (!accelerometer.begin()) return false;
+
+  if (!sine_q15[RESONANCE_FFT_SIZE / 4])
+    for (uint16_t k = 0; k <= RESONANCE_FFT_SIZE / 4; ++k)
+      sine_q15[k] = int16_t(_MIN(32767.0f, roundf(32768.0f * sinf(float(M_PI) * 2 * k / RESONANCE_FFT_SIZE))));
+
+  result = {};
+  res = &result;
+  sensor_axis = ACCEL_AXIS_X;
+  #if HAS_Y_AXIS
+    if (axis == Y_AXIS) sensor_axis = ACCEL_AXIS_Y;
+  #endif
+  fill = 0;
+  ZERO(psd);
+
+  const float old_accel = planner.settings.travel_acceleration;
+  const float start = current_position[axis],
+              min_stroke = float((MIN_STEPS_PER_SEGMENT) + 1) / planner.settings.axis_steps_per_mm[axis],
+              max_accel = planner.settings.max_acceleration_mm_per_s2[axis];
+
+  // Flush the FIFO so the spectrum only holds the sweep
+  bool overrun;
+  accel_sample_t discard[ACCEL_FIFO_DEPTH];
+  accelerometer.read(discard, ACCEL_FIFO_DEPTH, overrun);
+
+  /**
+   * Each cycle moves out and back with a triangular speed profile, so one cycle at
+   * acceleration a and frequency f covers a stroke of a / (16·f²) each way. The
+   * acceleration rises with the frequency to keep the excitation even. Strokes too
+   * short to step are kept at the minimum length with more acceleration, until
+   * that exceeds the axis limit.
+   */
+  float f = sweep.freq_min, t = 0;
+  while (f <= sweep.freq_max && IsRunning()) {
+    float accel = sweep.accel_per_hz * f, stroke = accel / (16 * sq(f));
+    if (stroke < min_stroke) {
+      stroke = min_stroke;
+      accel = 16 * sq(f) * stroke;
+      if (accel > max_accel) break;
+    }
+    planner.settings.travel_acceleration = accel;
+
+    for (uint8_t i = 0; i < 2; ++i) {
+      while (planner.is_full()) { idle(); poll(); }
+      current_position[axis] = start + (i ? 0 : stroke);
+      line_to_current_position(accel / (4 * f));    // Peak speed of the stroke
+    }
+
+    result.max_freq = f;
+    t += 1 / f;
+    f = sweep.freq_min + sweep.hz_per_s * t;
+  }
+
+  while (planner.busy()) { idle(); poll(); }
+  planner.settings.travel_acceleration = old_accel;
+  accelerometer.end();
+
+  return analyze(sweep);
+}
+
+/**
+ * Take the highest bin in the sweep range, placing the peak between bins with a
+ * parabola. The half-power points either side give the bandwidth, 2·ζ·f.
+ */
+bool ResonanceTuner::analyze(const sweep_t &sweep) {
+  if (!res->windows) return false;
+
+  constexpr float bin_hz = float(ACCEL_RATE) / (RESONANCE_FFT_SIZE);
+  const uint16_t lo = _MAX(1, int(CEIL(sweep.freq_min / bin_hz))),
+                 hi = _MIN(RESONANCE_BINS - 2, int(res->max_freq / bin_hz));
+  if (lo >= hi) return false;
+
+  uint16_t p = lo;
+  for (uint16_t i = lo + 1; i <= hi; ++i) if (psd[i] > psd[p]) p = i;
+  if (psd[p] <= 0) return false;
+
+  const float a = psd[p - 1], b = psd[p], c = psd[p + 1], denom = a - 2 * b + c;
+  res->freq = (p + (denom < 0 ? 0.5f * (a - c) / denom : 0)) * bin_hz;
+
+  const float half = b / 2;
+  uint16_t l = p, r = p;
+  while (l > 1 && psd[l - 1] > half) --l;
+  while (r < RESONANCE_BINS - 2 && psd[r + 1] > half) ++r;
+  const float f1 = (l - 1 + (half - psd[l - 1]) / (psd[l] - psd[l - 1])) * bin_hz,
+              f2 = (r + (psd[r] - half) / (psd[r] - psd[r + 1])) * bin_hz;
+  res->zeta = constrain((f2 - f1) / (2 * res->freq), 0.01f, 0.5f);
+
+  return true;
+}
+
+void ResonanceTuner::report_spectrum() {
+  float peak = 0;
+  for (uint16_t i = 1; i < RESONANCE_BINS; ++i) NOLESS(peak, psd[i]);
+  if (peak <= 0) return;
+  constexpr float bin_hz = float(ACCEL_RATE) / (RESONANCE_FFT_SIZE);
+  for (uint16_t i = 1; i < RESONANCE_BINS; ++i)
+    SERIAL_ECHOLNPGM("  ", p_float_t(i * bin_hz, 2), " Hz: ", int(psd[i] * 1000 / peak));
+}
+
+#endif // RESONANCE_TUNING
@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * resonance.h - Measure axis resonances for input shaping
+ *
+ * Shakes an axis back and forth through a rising frequency sweep while an
+ * accelerometer on the toolhead is sampled. The samples along the axis go
+ * through a fixed-point FFT in windows of RESONANCE_FFT_SIZE, and the power
+ * spectra of all windows are averaged. The highest peak in the sweep range
+ * gives the resonant frequency, and its half-power bandwidth the damping.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define RESONANCE_FFT_SIZE 256                          // Samples per window. 3.125 Hz bins at 800 Hz.
+#define RESONANCE_BINS     (RESONANCE_FFT_SIZE / 2)
+
+typedef struct {
+  float freq,                   // (Hz) Peak of the spectrum
+        zeta;                   // Damping ratio from the peak width
+  float max_freq;               // (Hz) Where the sweep ended
+  uint16_t windows, overruns;   // Spectra averaged and windows lost to FIFO overrun
+} resonance_t;
+
+class ResonanceTuner {
+  public:
+    typedef struct {
+      float freq_min, freq_max, accel_per_hz, hz_per_s;
+    } sweep_t;
+
+    // Run a sweep on the axis. False if the sensor is missing or no peak was found.
+    static bool measure(const AxisEnum axis, const sweep_t &sweep, resonance_t &result);
+
+    // Print the last spectrum, each bin relative to the peak
+    static void report_spectrum();
+
+  private:
+    static int16_t re[RESONANCE_FFT_SIZE], im[RESONANCE_FFT_SIZE];  // Samples, then the FFT
+    static float psd[RESONANCE_BINS];                              // Sum of the window power spectra
+    static uint16_t fill;
+    static uint8_t sensor_axis;
+    static resonance_t *res;
+
+    static void poll();
+    static void add_window();
+    static void fft();
+    static bool analyze(const sweep_t &sweep);
+};
+
+extern ResonanceTuner resonance_tuner;
@@ -125,6 +125,11 @@ class TFilamentMonitor : public FilamentMonitorBase {
       static float& motion_distance() { return response.motion_distance_mm; }
       static void set_motion_distance(const float mm) { response.motion_distance_mm = mm; }
     #endif
+    #if ENABLED(FILAMENT_MOTION_TRACKING)
+      static void filament_jammed(const uint8_t extruder) {
+        response.filament_jammed(extruder);
+      }
+    #endif
 
     #if HAS_FILAMENT_RUNOUT_DISTANCE
       static float& runout_distance() { return response.runout_distance_mm; }
@@ -199,6 +204,11 @@ class FilamentSensorBase {
         runout.filament_motion_present(extruder); // ...which calls response.filament_motion_present(extruder)
       }
     #endif
+    #if ENABLED(FILAMENT_MOTION_TRACKING)
+      static void filament_jammed(const uint8_t extruder) {
+        runout.filament_jammed(extruder); // ...which calls response.filament_jammed(extruder)
+      }
+    #endif
 
   public:
     static void setup() {
@@ -258,7 +268,7 @@ class FilamentSensorBase {
     private:
       static uint8_t motion_detected;
 
-      static void poll_motion_sensor() {
+      static uint8_t poll_motion_sensor() {
         static uint8_t old_state;
         const uint8_t new_state = TERN(FILAMENT_SWITCH_AND_MOTION, poll_motion_pins, poll_runout_pins)(),
                       change    = old_state ^ new_state;
@@ -274,8 +284,62 @@ class FilamentSensorBase {
         #endif
 
         motion_detected |= change;
+        return change;
       }
 
+      #if ENABLED(FILAMENT_MOTION_TRACKING)
+        /**
+         * Compare the sensor edges with the E steps the stepper has taken,
+         * Linear Advance included. Each step adds to the filament owed and each
+         * edge pays off FILAMENT_MOTION_MM_PER_EDGE, so slipping feeds up a
+         * debt as surely as a jam. The debt allowed grows with the E speed to
+         * cover the sensor latency and the filament compression at speed.
+         */
+        static void track_motion(const uint8_t change) {
+          static int32_t last_steps;
+          static uint8_t last_sets;
+          static millis_t last_ms, window_ms;
+          static float owed_mm, window_mm, speed;
+
+          const uint8_t e = active_extruder;
+          if (e >= TERN(FILAMENT_SWITCH_AND_MOTION, NUM_MOTION_SENSORS, NUM_RUNOUT_SENSORS)) return;
+
+          const millis_t ms = millis();
+          const int32_t steps = stepper.position(E_AXIS);
+          const uint8_t sets = stepper.position_sets;
+
+          // Start over after a gap in monitoring or a new E position (G92, tool change)
+          if (ELAPSED(ms, last_ms + 500UL) || sets != last_sets) {
+            owed_mm = window_mm = speed = 0;
+            window_ms = ms + 100UL;
+          }
+          else {
+            const float mm = ABS(steps - last_steps) * planner.mm_per_step[E_AXIS_N(e)];
+            owed_mm += mm;
+            window_mm += mm;
+            if (TEST(change, e)) owed_mm = _MAX(owed_mm - (FILAMENT_MOTION_MM_PER_EDGE), -(FILAMENT_MOTION_MM_PER_EDGE));
+
+            // E speed over the last 100ms
+            if (ELAPSED(ms, window_ms)) {
+              speed = window_mm * 10;
+              window_mm = 0;
+              window_ms = ms + 100UL;
+            }
+
+            if (owed_mm > (FILAMENT_MOTION_SLIP_MM) + speed * (FILAMENT_MOTION_SLIP_TIME)) {
+              #if ENABLED(FILAMENT_RUNOUT_SENSOR_DEBUG)
+                SERIAL_ECHOLNPGM("Motion sensor ", e, " missed ", owed_mm, "mm at ", speed, "mm/s");
+              #endif
+              owed_mm = 0;
+              filament_jammed(e);
+            }
+          }
+          last_steps = steps;
+          last_sets = sets;
+          last_ms = ms;
+        }
+      #endif
+
     public:
       // Called from ISR context to indicate a block was completed
       static void block_completed(const block_t * const b) {
@@ -288,7 +352,10 @@ class FilamentSensorBase {
         motion_detected = 0;
       }
 
-      static void run() { poll_motion_sensor(); }
+      static void run() {
+        const uint8_t change = poll_motion_sensor();
+        TERN(FILAMENT_MOTION_TRACKING, track_motion(change), UNUSED(change));
+      }
   };
 
 #endif // HAS_FILAMENT_MOTION
@@ -468,6 +535,13 @@ class FilamentSensorBase {
         }
       #endif
 
+      #if ENABLED(FILAMENT_MOTION_TRACKING)
+        // A jam or slip seen by tracking the motion sensor. Don't wait for the distance to run out.
+        static void filament_jammed(const uint8_t extruder) {
+          TERN(FILAMENT_SWITCH_AND_MOTION, mm_countdown.motion, mm_countdown.runout)[extruder] = -1;
+        }
+      #endif
+
       // Called from ISR context to indicate a block was completed
       static void block_completed(const block_t * const b) {
         // No calculation unless paused or printing
@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Binary Telemetry
+ * Compact status frames for hosts, sent up to BINARY_TELEMETRY_MAX_RATE times per second.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "telemetry.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../module/printcounter.h"
+#include "../gcode/queue.h"
+
+#if HAS_MEDIA
+  #include "../sd/cardreader.h"
+#endif
+
+Telemetry telemetry;
+
+AutoReporter<Telemetry::AutoReportTelemetry> Telemetry::auto_reporter;
+
+// Frame assembled in RAM so it can be checksummed and sent in one go
+static uint8_t frame[4 + 6 + 5 * (HOTENDS + 1) + 4 * (LOGICAL_AXES) + 11 + 2], frame_len;
+
+static void put(const uint32_t v, const uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; ++i) frame[frame_len++] = uint8_t(v >> (8 * i));
+}
+
+static void put_heater(const celsius_float_t temp, const celsius_t target, const int16_t power) {
+  put(uint16_t(int16_t(LROUND(temp * 10))), 2);
+  put(uint16_t(target), 2);
+  put(uint8_t(constrain(power, 0, 255)), 1);
+}
+
+void Telemetry::report() {
+  frame_len = 0;
+  put(0xFE, 1);
+  put('T', 1);
+  put(0, 1);                                    // Length, filled in below
+  put(TELEMETRY_VERSION, 1);
+  put(millis(), 4);
+  put(HOTENDS, 1);
+  put(LOGICAL_AXES, 1);
+
+  #if HAS_HOTEND
+    HOTEND_LOOP() put_heater(thermalManager.degHotend(e), thermalManager.degTargetHotend(e), thermalManager.getHeaterPower((heater_id_t)e));
+  #endif
+  #if HAS_HEATED_BED
+    put_heater(thermalManager.degBed(), thermalManager.degTargetBed(), thermalManager.getHeaterPower(H_BED));
+  #else
+    put_heater(0, 0, 0);
+  #endif
+
+  const abce_pos_t pos = planner.get_axis_positions_mm();
+  LOOP_LOGICAL_AXES(a) put(uint32_t(int32_t(LROUND(pos[a] * 1000))), 4);
+
+  put(uint16_t(_MIN(LROUND(MMS_TO_MMM(feedrate_mm_s)), 65535L)), 2);
+  put(uint16_t(feedrate_percentage), 2);
+  put(planner.movesplanned(), 1);
+  put(queue.ring_buffer.length, 1);
+  put(TERN0(HAS_MEDIA, card.getIndex()), 4);
+  put(  (TERN0(HAS_MEDIA, card.isPrinting()) ? _BV(0) : 0)
+      | (TERN0(HAS_MEDIA, card.isPaused())   ? _BV(1) : 0)
+      | (print_job_timer.isRunning()         ? _BV(2) : 0), 1);
+
+  frame[2] = frame_len - 3;
+
+  uint8_t sum1 = 0, sum2 = 0;
+  for (uint8_t i = 2; i < frame_len; ++i) {
+    sum1 = (uint16_t(sum1) + frame[i]) % 255;
+    sum2 = (uint16_t(sum2) + sum1) % 255;
+  }
+  put(sum1, 1);
+  put(sum2, 1);
+
+  WRITE_BUFFER(&SERIAL_IMPL, frame, frame_len);
+}
+
+#endif // BINARY_TELEMETRY
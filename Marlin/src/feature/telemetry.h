@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * telemetry.h - Binary telemetry frames for host monitoring
+ *
+ * Sent M156 S<rate> times per second between the text lines, so a host
+ * can follow a print without parsing M105 / M114 text. All values are
+ * little-endian:
+ *
+ *   0xFE 'T'          Start of frame. 0xFE never appears in text output.
+ *   uint8_t  length   Bytes from 'version' up to the checksum
+ *   uint8_t  version  TELEMETRY_VERSION
+ *   uint32_t ms       millis() when the frame was made
+ *   uint8_t  hotends  Number of hotend entries
+ *   uint8_t  axes     Number of position entries, E last
+ *   Hotends, then bed: int16_t temp (0.1°C), int16_t target (°C), uint8_t power (0-255)
+ *   int32_t  pos[]    Stepper position of each axis (µm)
+ *   uint16_t feedrate Commanded feedrate (mm/min)
+ *   uint16_t percent  Feedrate percentage
+ *   uint8_t  planned  Moves in the planner
+ *   uint8_t  queued   Commands in the queue
+ *   uint32_t sdpos    Position in the file being printed
+ *   uint8_t  flags    Bit 0: SD printing, bit 1: SD paused, bit 2: print job timer running
+ *   uint8_t  sum1, sum2  Fletcher-16 of 'length' up to 'flags'
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+#define TELEMETRY_VERSION 1
+
+class Telemetry {
+  public:
+    static void report();
+
+    struct AutoReportTelemetry { static void report() { Telemetry::report(); } };
+    static AutoReporter<AutoReportTelemetry> auto_reporter;
+};
+
+extern Telemetry telemetry;
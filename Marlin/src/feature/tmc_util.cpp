@@ -42,6 +42,17 @@
   #include "../lcd/sovol_rts/sovol_rts.h"
 #endif
 
+#if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+  #include "../module/endstops.h"
+#endif
+
+#if ANY(TMC_STALL_DETECT, TMC_CRUISE_CURRENT)
+  #include "../module/stepper.h"
+#endif
+#if ENABLED(TMC_STALL_DETECT)
+  #include "../gcode/queue.h"
+#endif
+
 #if ENABLED(TMC_DEBUG)
   #include "../libs/hex_print.h"
   #if ENABLED(MONITOR_DRIVER_STATUS)
@@ -396,96 +407,279 @@
     return should_step_down;
   }
 
-  void monitor_tmc_drivers() {
-    const millis_t ms = millis();
-
-    // Poll TMC drivers at the configured interval
-    static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
-
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
-    #endif
-
-    if (need_update_error_counters || need_debug_reporting) {
+  // Driver groups polled by monitor_tmc_drivers: X, Y, Z, I..W, E0..E7
+  #define TMC_MONITOR_GROUPS (9 + 8)
 
+  // Poll the drivers of one group. Return false if the group has no drivers.
+  static bool monitor_tmc_group(const uint8_t group, const bool need_update_error_counters, const bool need_debug_reporting) {
+    switch (group) {
       #if X_IS_TRINAMIC || X2_IS_TRINAMIC
-        if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
-          || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
-          TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
-        }
+        case 0:
+          if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
+            || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
+            TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
+          }
+          return true;
       #endif
 
       #if Y_IS_TRINAMIC || Y2_IS_TRINAMIC
-        if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
-          || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
-          TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
-        }
+        case 1:
+          if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
+            || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
+            TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
+          }
+          return true;
       #endif
 
       #if ANY(Z_IS_TRINAMIC, Z2_IS_TRINAMIC, Z3_IS_TRINAMIC, Z4_IS_TRINAMIC)
-        if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
-          || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
-          TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
-          TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
-          TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
-        }
+        case 2:
+          if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
+            || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
+            || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
+            || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
+            TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
+            TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
+            TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
+          }
+          return true;
       #endif
 
+      #define _MONITOR_AXIS(N, A) case N: if (monitor_tmc_driver(stepper##A, need_update_error_counters, need_debug_reporting)) step_current_down(stepper##A); return true;
       #if I_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperI, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperI);
+        _MONITOR_AXIS(3, I)
       #endif
       #if J_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperJ, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperJ);
+        _MONITOR_AXIS(4, J)
       #endif
       #if K_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperK, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperK);
+        _MONITOR_AXIS(5, K)
       #endif
       #if U_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperU, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperU);
+        _MONITOR_AXIS(6, U)
       #endif
       #if V_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperV, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperV);
+        _MONITOR_AXIS(7, V)
       #endif
       #if W_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperW, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperW);
+        _MONITOR_AXIS(8, W)
       #endif
 
-      TERN_(E0_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting));
-      TERN_(E1_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting));
-      TERN_(E2_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting));
-      TERN_(E3_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting));
-      TERN_(E4_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting));
-      TERN_(E5_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting));
-      TERN_(E6_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting));
-      TERN_(E7_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting));
+      #define _MONITOR_E(N) case 9 + N: (void)monitor_tmc_driver(stepperE##N, need_update_error_counters, need_debug_reporting); return true;
+      #if E0_IS_TRINAMIC
+        _MONITOR_E(0)
+      #endif
+      #if E1_IS_TRINAMIC
+        _MONITOR_E(1)
+      #endif
+      #if E2_IS_TRINAMIC
+        _MONITOR_E(2)
+      #endif
+      #if E3_IS_TRINAMIC
+        _MONITOR_E(3)
+      #endif
+      #if E4_IS_TRINAMIC
+        _MONITOR_E(4)
+      #endif
+      #if E5_IS_TRINAMIC
+        _MONITOR_E(5)
+      #endif
+      #if E6_IS_TRINAMIC
+        _MONITOR_E(6)
+      #endif
+      #if E7_IS_TRINAMIC
+        _MONITOR_E(7)
+      #endif
 
-      if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+      default: break;
     }
+    return false;
+  }
+
+  void monitor_tmc_drivers() {
+    const millis_t ms = millis();
+
+    // Poll TMC drivers at the configured interval
+    static millis_t next_poll = 0;
+    const bool need_update_error_counters = ELAPSED(ms, next_poll);
+    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+
+    // Also poll at intervals for debugging
+    #if ENABLED(TMC_DEBUG)
+      static millis_t next_debug_reporting = 0;
+      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
+      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
+    #else
+      constexpr bool need_debug_reporting = false;
+    #endif
+
+    #if ENABLED(MONITOR_DRIVER_STATUS_SPREAD)
+
+      // Poll one group per call so each loop waits for no more than one axis of register reads
+      static uint8_t group = TMC_MONITOR_GROUPS;
+      static bool update_pending, debug_pending;
+      if (need_update_error_counters || need_debug_reporting) {
+        if (group >= TMC_MONITOR_GROUPS) { group = 0; update_pending = debug_pending = false; }
+        update_pending |= need_update_error_counters;
+        debug_pending |= need_debug_reporting;
+      }
+      if (group >= TMC_MONITOR_GROUPS) return;
+
+      while (group < TMC_MONITOR_GROUPS && !monitor_tmc_group(group++, update_pending, debug_pending)) { /* skip groups without drivers */ }
+
+      if (group >= TMC_MONITOR_GROUPS && TERN0(TMC_DEBUG, debug_pending)) SERIAL_EOL();
+
+    #else
+
+      if (need_update_error_counters || need_debug_reporting) {
+        for (uint8_t g = 0; g < TMC_MONITOR_GROUPS; ++g) (void)monitor_tmc_group(g, need_update_error_counters, need_debug_reporting);
+        if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+      }
+
+    #endif
   }
 
 #endif // MONITOR_DRIVER_STATUS
 
+#if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+
+  template<typename TMC>
+  static void set_spread_ahead(TMC &st, const bool spread) {
+    if (st.spread_ahead == spread) return;
+    st.spread_ahead = spread;
+    st.refresh_stepping_mode();
+  }
+
+  // Switch a driver to spreadCycle when the axis step rate goes over its hybrid threshold,
+  // and back to stealthChop when it drops below the threshold less the hysteresis
+  template<typename TMC>
+  static void spread_ahead_by_rate(TMC &st, const AxisEnum axis, const float peak_rate) {
+    if (!st.stored.hybrid_thrs) return;
+    const float thrs_rate = st.stored.hybrid_thrs * planner.settings.axis_steps_per_mm[axis];
+    if (peak_rate > thrs_rate)
+      set_spread_ahead(st, true);
+    else if (peak_rate < thrs_rate * (1.0f - (HYBRID_LOOKAHEAD_HYSTERESIS) * 0.01f))
+      set_spread_ahead(st, false);
+  }
+
+  /**
+   * Set the X, Y, Z stepping modes from the fastest queued move of each axis so a driver
+   * is already in spreadCycle when a fast move starts, and goes back to stealthChop once
+   * only slow moves are left. Called from idle() since it writes the drivers.
+   */
+  void tmc_hybrid_lookahead() {
+    static millis_t next_ms = 0;
+    const millis_t ms = millis();
+    if (PENDING(ms, next_ms)) return;
+    next_ms = ms + 10;
+
+    // Leave the stepping modes alone when homing or probing
+    if (endstops.enabled && !endstops.enabled_globally) return;
+
+    // Peak step rate of each axis over the queued moves
+    xyz_float_t peak_rate{0};
+    const uint8_t head = planner.block_buffer_head;
+    for (uint8_t b = planner.block_buffer_tail; b != head; b = block_inc_mod(b, 1)) {
+      block_t * const block = &planner.block_buffer[b];
+      if (!block->is_move() || !block->step_event_count) continue;
+      const float rate_per_step = float(block->nominal_rate) / block->step_event_count;
+      XYZ_CODE(
+        NOLESS(peak_rate.x, block->steps.a * rate_per_step),
+        NOLESS(peak_rate.y, block->steps.b * rate_per_step),
+        NOLESS(peak_rate.z, block->steps.c * rate_per_step)
+      );
+    }
+
+    TERN_(X_HAS_STEALTHCHOP,  spread_ahead_by_rate(stepperX,  X_AXIS, peak_rate.x));
+    TERN_(X2_HAS_STEALTHCHOP, spread_ahead_by_rate(stepperX2, X_AXIS, peak_rate.x));
+    TERN_(Y_HAS_STEALTHCHOP,  spread_ahead_by_rate(stepperY,  Y_AXIS, peak_rate.y));
+    TERN_(Y2_HAS_STEALTHCHOP, spread_ahead_by_rate(stepperY2, Y_AXIS, peak_rate.y));
+    TERN_(Z_HAS_STEALTHCHOP,  spread_ahead_by_rate(stepperZ,  Z_AXIS, peak_rate.z));
+    TERN_(Z2_HAS_STEALTHCHOP, spread_ahead_by_rate(stepperZ2, Z_AXIS, peak_rate.z));
+    TERN_(Z3_HAS_STEALTHCHOP, spread_ahead_by_rate(stepperZ3, Z_AXIS, peak_rate.z));
+    TERN_(Z4_HAS_STEALTHCHOP, spread_ahead_by_rate(stepperZ4, Z_AXIS, peak_rate.z));
+  }
+
+#endif // HYBRID_THRESHOLD_LOOKAHEAD
+
+#if ENABLED(TMC_STALL_DETECT)
+
+  /**
+   * Read the X or Y StallGuard load while printing, one driver per call. A run of
+   * STALL_DETECT_SAMPLES low readings on a moving axis is reported once, until the
+   * load recovers or the print stops.
+   */
+  void tmc_stall_detect() {
+    static millis_t next_ms = 0;
+    const millis_t ms = millis();
+    if (PENDING(ms, next_ms)) return;
+    next_ms = ms + STALL_DETECT_INTERVAL_MS;
+
+    static uint8_t low_count[2];
+    static bool stalled[2], read_y;
+
+    if (!printingIsActive()) {
+      low_count[0] = low_count[1] = 0;
+      stalled[0] = stalled[1] = false;
+      return;
+    }
+
+    const uint8_t i = read_y;
+    const AxisEnum axis = read_y ? Y_AXIS : X_AXIS;
+    read_y = !read_y;
+
+    // SG_RESULT is meaningless at standstill
+    if (!stepper.axis_is_moving(axis)) { low_count[i] = 0; return; }
+
+    constexpr uint16_t sg_min[] = STALL_DETECT_SG_MIN;
+    const uint16_t sg = i ? stepperY.SG_RESULT() : stepperX.SG_RESULT();
+    if (sg >= sg_min[i]) { low_count[i] = 0; stalled[i] = false; return; }
+    if (stalled[i] || ++low_count[i] < (STALL_DETECT_SAMPLES)) return;
+
+    stalled[i] = true;
+    SERIAL_ECHO_MSG("Stall ", C(AXIS_CHAR(axis)), " SG:", sg, " block:", planner.block_buffer_tail,
+      " X:", planner.get_axis_position_mm(X_AXIS), " Y:", planner.get_axis_position_mm(Y_AXIS));
+
+    #ifdef STALL_DETECT_SCRIPT
+      queue.inject(F(STALL_DETECT_SCRIPT));
+    #endif
+  }
+
+#endif // TMC_STALL_DETECT
+
+#if ENABLED(TMC_CRUISE_CURRENT)
+
+  // Set the driver current for cruising or for acceleration, keeping the M906 current
+  template<typename TMC>
+  static void set_cruise_current(TMC &st, const bool cruise) {
+    const uint16_t mA = st.getMilliamps();
+    st.rms_current(cruise ? uint16_t(uint32_t(mA) * (TMC_CRUISE_CURRENT_PERCENT) / 100) : mA);
+    st.val_mA = mA;
+  }
+
+  /**
+   * Lower the X and Y current while the stepper is cruising with more than
+   * TMC_CRUISE_MARGIN_MS to go, and restore it for any other phase.
+   * Called on every idle() so a cruise ending is seen as soon as possible.
+   */
+  void tmc_cruise_current() {
+    static bool reduced = false;
+    const bool cruise = stepper.cruise_ms_left() > (TMC_CRUISE_MARGIN_MS);
+    if (cruise == reduced) return;
+    reduced = cruise;
+    TERN_(X_IS_TRINAMIC,  set_cruise_current(stepperX,  cruise));
+    TERN_(X2_IS_TRINAMIC, set_cruise_current(stepperX2, cruise));
+    TERN_(Y_IS_TRINAMIC,  set_cruise_current(stepperY,  cruise));
+    TERN_(Y2_IS_TRINAMIC, set_cruise_current(stepperY2, cruise));
+  }
+
+#endif // TMC_CRUISE_CURRENT
+
 #if ENABLED(TMC_DEBUG)
 
   /**
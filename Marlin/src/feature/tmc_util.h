@@ -80,6 +80,14 @@ class TMCStorage {
       OPTCODE(HYBRID_THRESHOLD, uint16_t hybrid_thrs = 0)
       OPTCODE(USE_SENSORLESS,   int16_t  homing_thrs = 0)
     } stored;
+
+    #if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+      bool spread_ahead = false;  // spreadCycle for a fast move in the planner
+    #endif
+
+    #if HAS_STEALTHCHOP
+      bool use_stealthChop() { return stored.stealthChop_enabled && !TERN0(HYBRID_THRESHOLD_LOOKAHEAD, spread_ahead); }
+    #endif
 };
 
 template<class TMC, char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
@@ -111,7 +119,7 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return this->en_pwm_mode(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_pwm_mode(this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { this->en_pwm_mode(this->use_stealthChop()); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -128,7 +136,9 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
       }
       void set_pwm_thrs(const uint32_t thrs) {
         TMC::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
-        TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
+        #if ANY(HAS_MARLINUI_MENU, HYBRID_THRESHOLD_LOOKAHEAD)
+          this->stored.hybrid_thrs = thrs;
+        #endif
       }
     #endif
 
@@ -184,7 +194,7 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_spreadCycle(!this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { this->en_spreadCycle(!this->use_stealthChop()); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -201,7 +211,9 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
       }
       void set_pwm_thrs(const uint32_t thrs) {
         TMC2208Stepper::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
-        TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
+        #if ANY(HAS_MARLINUI_MENU, HYBRID_THRESHOLD_LOOKAHEAD)
+          this->stored.hybrid_thrs = thrs;
+        #endif
       }
     #endif
 
@@ -236,7 +248,7 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_spreadCycle(!this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { this->en_spreadCycle(!this->use_stealthChop()); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -253,7 +265,9 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
       }
       void set_pwm_thrs(const uint32_t thrs) {
         TMC2209Stepper::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
-        TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
+        #if ANY(HAS_MARLINUI_MENU, HYBRID_THRESHOLD_LOOKAHEAD)
+          this->stored.hybrid_thrs = thrs;
+        #endif
       }
     #endif
 
@@ -305,7 +319,7 @@ class TMCMarlin<TMC2240Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC224
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return this->en_pwm_mode(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
-      void refresh_stepping_mode()          { this->en_pwm_mode(this->stored.stealthChop_enabled); }
+      void refresh_stepping_mode()          { this->en_pwm_mode(this->use_stealthChop()); }
       void set_stealthChop(const bool stch) { this->stored.stealthChop_enabled = stch; refresh_stepping_mode(); }
       bool toggle_stepping_mode()           { set_stealthChop(!this->stored.stealthChop_enabled); return get_stealthChop(); }
     #endif
@@ -322,7 +336,9 @@ class TMCMarlin<TMC2240Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC224
       }
       void set_pwm_thrs(const uint32_t thrs) {
         TMC2240Stepper::TPWMTHRS(_tmc_thrs(this->microsteps(), thrs, planner.settings.axis_steps_per_mm[AXIS_ID]));
-        TERN_(HAS_MARLINUI_MENU, this->stored.hybrid_thrs = thrs);
+        #if ANY(HAS_MARLINUI_MENU, HYBRID_THRESHOLD_LOOKAHEAD)
+          this->stored.hybrid_thrs = thrs;
+        #endif
       }
     #endif
 
@@ -389,6 +405,18 @@ class TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC266
 };
 
 void monitor_tmc_drivers();
+
+#if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+  void tmc_hybrid_lookahead();
+#endif
+
+#if ENABLED(TMC_STALL_DETECT)
+  void tmc_stall_detect();
+#endif
+
+#if ENABLED(TMC_CRUISE_CURRENT)
+  void tmc_cruise_current();
+#endif
 void test_tmc_connection(LOGICAL_AXIS_DECL_LC(const bool, true));
 
 #if ENABLED(TMC_DEBUG)
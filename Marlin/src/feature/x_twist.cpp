@@ -26,6 +26,13 @@
 #include "x_twist.h"
 #include "../module/probe.h"
 
+#if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+  #include "bedlevel/bedlevel.h"
+  #if ENABLED(EXTENSIBLE_UI)
+    #include "../lcd/extui/ui_api.h"
+  #endif
+#endif
+
 XATC xatc;
 
 bool XATC::enabled;
@@ -55,13 +62,40 @@ void XATC::print_points() {
 
 float lerp(const float t, const float a, const float b) { return a + t * (b - a); }
 
-float XATC::compensation(const xy_pos_t &raw) {
-  if (!enabled) return 0;
+float XATC::interpolate(const float x, const float start, const float spacing, const xatc_array_t &z_offset) {
   if (NEAR_ZERO(spacing)) return 0;
-  float t = (raw.x - start) / spacing;
+  float t = (x - start) / spacing;
   const int i = constrain(FLOOR(t), 0, XATC_MAX_POINTS - 2);
   t -= i;
   return lerp(t, z_offset[i], z_offset[i + 1]);
 }
 
+float XATC::compensation(const xy_pos_t &raw) {
+  if (!enabled) return 0;
+  return interpolate(raw.x, start, spacing, z_offset);
+}
+
+#if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+
+  /**
+   * Shift each mesh column by the change in twist at its X, so the current
+   * mesh matches the new table without probing again. Mesh points are the
+   * probe positions, as given to compensation() by probe_at_point.
+   */
+  void XATC::fold_into_mesh(const state_t &before) {
+    if (!enabled || !leveling_is_valid()) return;
+    for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x) {
+      const float mx = bedlevel.get_mesh_x(x),
+                  dz = interpolate(mx, start, spacing, z_offset) - interpolate(mx, before.start, before.spacing, before.z_offset);
+      if (isnan(dz) || NEAR_ZERO(dz)) continue;
+      for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y) {
+        bedlevel.z_values[x][y] += dz;
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, bedlevel.z_values[x][y]));
+      }
+    }
+    TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  }
+
+#endif
+
 #endif // X_AXIS_TWIST_COMPENSATION
@@ -27,6 +27,7 @@ typedef float xatc_array_t[XATC_MAX_POINTS];
 
 class XATC {
   static bool enabled;
+  static float interpolate(const float x, const float start, const float spacing, const xatc_array_t &z_offset);
 public:
   static float spacing, start;
   static xatc_array_t z_offset;
@@ -35,6 +36,14 @@ public:
   static void set_enabled(const bool ena) { enabled = ena; }
   static float compensation(const xy_pos_t &raw);
   static void print_points();
+
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    // The mesh is probed with the twist applied, so a changed table is folded
+    // into the mesh instead of being added again on every move.
+    typedef struct { float spacing, start; xatc_array_t z_offset; } state_t;
+    static void save_state(state_t &s) { s.spacing = spacing; s.start = start; COPY(s.z_offset, z_offset); }
+    static void fold_into_mesh(const state_t &before);
+  #endif
 };
 
 extern XATC xatc;
@@ -717,13 +717,13 @@ void GcodeSuite::G26() {
   #endif // !ARC_SUPPORT
 
   mesh_index_pair location;
-  TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_START));
+  TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location.pos, ExtUI::G26_START));
   do {
     // Find the nearest confluence
     location = g26.find_closest_circle_to_print(g26.continue_with_closest ? xy_pos_t(current_position) : g26.xy_pos);
 
     if (location.valid()) {
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_POINT_START));
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location.pos, ExtUI::G26_POINT_START));
       const xy_pos_t circle = { bedlevel.get_mesh_x(location.pos.a), bedlevel.get_mesh_y(location.pos.b) };
 
       // If this mesh location is outside the printable radius, skip it.
@@ -839,8 +839,8 @@ void GcodeSuite::G26() {
       g26.connect_neighbor_with_line(location.pos,  1,  0);
       g26.connect_neighbor_with_line(location.pos,  0, -1);
       g26.connect_neighbor_with_line(location.pos,  0,  1);
-      planner.synchronize();
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_POINT_FINISH));
+      // A full planner keeps the pattern only a few moves ahead, so don't stop after each circle
+      TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location.pos, ExtUI::G26_POINT_FINISH));
       if (TERN0(HAS_MARLINUI_MENU, user_canceled())) goto LEAVE;
     }
 
@@ -850,7 +850,7 @@ void GcodeSuite::G26() {
 
   LEAVE:
   LCD_MESSAGE_MIN(MSG_G26_LEAVING);
-  TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, ExtUI::G26_FINISH));
+  TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(location, ExtUI::G26_FINISH));
 
   g26.retract_filament(destination);
   destination.z = Z_CLEARANCE_BETWEEN_PROBES;
@@ -33,6 +33,14 @@
   #include "../../feature/bltouch.h"
 #endif
 
+#if ENABLED(ASSISTED_TRAMMING_LIVE)
+  #include "../../MarlinCore.h"
+  #include "../../lcd/marlinui.h"
+  #if ENABLED(HOST_PROMPT_SUPPORT)
+    #include "../../feature/host_actions.h"
+  #endif
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../core/debug_out.h"
 
@@ -42,6 +50,38 @@
 
 #include "../../feature/tramming.h"
 
+/**
+ * Report how far to turn the screw at a point to match the first point.
+ * In live mode also show the turn and deviation on the LCD.
+ */
+static void report_adjustment(const uint8_t i, const float diff, const uint8_t screw_thread, const bool live=false) {
+  const float threads_factor[] = { 0.5, 0.7, 0.8 };
+  const float adjust = ABS(diff) < 0.001f ? 0 : diff / threads_factor[(screw_thread - 30) / 10];
+
+  const int full_turns = trunc(adjust);
+  const float decimal_part = adjust - float(full_turns);
+  const int minutes = trunc(decimal_part * 60.0f);
+  const char * const dir = (screw_thread & 1) == (adjust > 0) ? "CCW" : "CW";
+
+  SERIAL_ECHOPGM("Turn ");
+  SERIAL_ECHOPGM_P((char *)pgm_read_ptr(&tramming_point_name[i]));
+  SERIAL_ECHOPGM(" ", dir, " by ", ABS(full_turns), " turns");
+  if (minutes) SERIAL_ECHOPGM(" and ", ABS(minutes), " minutes");
+  if (ENABLED(REPORT_TRAMMING_MM) || live) SERIAL_ECHOPGM(" (", -diff, "mm)");
+  SERIAL_EOL();
+
+  #if ENABLED(ASSISTED_TRAMMING_LIVE)
+    if (live) {
+      MString<32> msg(FPSTR(pgm_read_ptr(&tramming_point_name[i])), ' ', dir, ' ', ABS(full_turns), ':');
+      if (ABS(minutes) < 10) msg.append('0');
+      msg.append(ABS(minutes), ' ', p_float_t(-diff, 2));
+      ui.set_status(&msg);
+    }
+  #else
+    UNUSED(live);
+  #endif
+}
+
 /**
  * G35: Read bed corners to help adjust bed screws
  *
@@ -53,6 +93,12 @@
  *               41 - Counter-Clockwise M4
  *               50 - Clockwise M5
  *               51 - Counter-Clockwise M5
+ *
+ * With ASSISTED_TRAMMING_LIVE:
+ *   L          Live mode. After the first pass, reprobe each point that is off
+ *              while its screw is turned, reporting as it goes, until it's
+ *              within tolerance. Send M108 or answer the host prompt to move on.
+ *   T<mm>      Tolerance for live mode (Default TRAMMING_LIVE_TOLERANCE)
  */
 void GcodeSuite::G35() {
 
@@ -117,27 +163,36 @@ void GcodeSuite::G35() {
   }
 
   if (!err_break) {
-    const float threads_factor[] = { 0.5, 0.7, 0.8 };
-
     // Calculate adjusts
-    for (uint8_t i = 1; i < G35_PROBE_COUNT; ++i) {
-      const float diff = z_measured[0] - z_measured[i],
-                  adjust = ABS(diff) < 0.001f ? 0 : diff / threads_factor[(screw_thread - 30) / 10];
-
-      const int full_turns = trunc(adjust);
-      const float decimal_part = adjust - float(full_turns);
-      const int minutes = trunc(decimal_part * 60.0f);
-
-      SERIAL_ECHOPGM("Turn ");
-      SERIAL_ECHOPGM_P((char *)pgm_read_ptr(&tramming_point_name[i]));
-      SERIAL_ECHOPGM(" ", (screw_thread & 1) == (adjust > 0) ? "CCW" : "CW", " by ", ABS(full_turns), " turns");
-      if (minutes) SERIAL_ECHOPGM(" and ", ABS(minutes), " minutes");
-      if (ENABLED(REPORT_TRAMMING_MM)) SERIAL_ECHOPGM(" (", -diff, "mm)");
-      SERIAL_EOL();
-    }
+    for (uint8_t i = 1; i < G35_PROBE_COUNT; ++i)
+      report_adjustment(i, z_measured[0] - z_measured[i], screw_thread);
   }
-  else
-    SERIAL_ECHOLNPGM("G35 aborted.");
+
+  #if ENABLED(ASSISTED_TRAMMING_LIVE)
+    // Reprobe one point at a time while it's adjusted. The first point is the reference.
+    if (!err_break && parser.seen_test('L')) {
+      const float tolerance = parser.floatval('T', TRAMMING_LIVE_TOLERANCE);
+      for (uint8_t i = 1; i < G35_PROBE_COUNT && !err_break; ++i) {
+        if (ABS(z_measured[0] - z_measured[i]) <= tolerance) continue;
+
+        wait_for_user = true;
+        TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt((char *)pgm_read_ptr(&tramming_point_name[i])));
+        const millis_t timeout = millis() + SEC_TO_MS(TRAMMING_LIVE_TIMEOUT);
+        while (wait_for_user && PENDING(millis(), timeout)) {
+          const float z_probed_height = probe.probe_at_point(tramming_points[i], PROBE_PT_RAISE);
+          if (isnan(z_probed_height)) { err_break = true; break; }
+          z_measured[i] = z_probed_height;
+          const float diff = z_measured[0] - z_probed_height;
+          report_adjustment(i, diff, screw_thread, true);
+          if (ABS(diff) <= tolerance) break;
+        }
+        wait_for_user = false;
+        TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_end());
+      }
+    }
+  #endif
+
+  if (err_break) SERIAL_ECHOLNPGM("G35 aborted.");
 
   // Restore the active tool after homing
   probe.use_probing_tool(false);
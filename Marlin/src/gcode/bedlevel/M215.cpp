@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+
+#include "../gcode.h"
+#include "../../feature/bedlevel/probe_order.h"
+
+/**
+ * M215: Set / Report the order for probing the leveling grid
+ *
+ *  S<order> - 0 = Serpentine, 1 = Hilbert curve, 2 = Nearest neighbor
+ *
+ * With no parameters report the order and the travel of the last G29.
+ */
+void GcodeSuite::M215() {
+  if (parser.seenval('S')) {
+    const uint8_t s = parser.value_byte();
+    if (s < PROBE_ORDER_COUNT)
+      probe_order.type = ProbeOrderType(s);
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("S out of range (0-", PROBE_ORDER_COUNT - 1, ")"));
+  }
+  else
+    probe_order.report();
+}
+
+#endif // SELECTABLE_PROBE_ORDER
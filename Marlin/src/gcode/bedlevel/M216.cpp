@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_STATISTICS)
+
+#include "../gcode.h"
+#include "../../feature/bedlevel/probe_stats.h"
+
+/**
+ * M216: Report the probe statistics of the leveling grid
+ *
+ *  R - Reset the statistics, also on the SD card
+ *
+ * With no parameters report the mean, sigma and drift of each grid point.
+ */
+void GcodeSuite::M216() {
+  if (parser.seen_test('R')) {
+    probe_stats.reset();
+    TERN_(HAS_MEDIA, probe_stats.save());
+  }
+  else
+    probe_stats.report();
+}
+
+#endif // PROBE_STATISTICS
@@ -62,6 +62,8 @@
  *   S2        Create a simple random mesh and enable
  */
 void GcodeSuite::M420() {
+  TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh());
+
   const bool seen_S = parser.seen('S'),
              to_enable = seen_S ? parser.value_bool() : planner.leveling_active;
 
@@ -78,7 +80,7 @@ void GcodeSuite::M420() {
       #endif
       GRID_LOOP(x, y) {
         bedlevel.z_values[x][y] = 0.001 * random(-200, 200);
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, bedlevel.z_values[x][y]));
       }
       TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
@@ -181,7 +183,7 @@ void GcodeSuite::M420() {
             // Subtract the mean from all values
             GRID_LOOP(x, y) {
               bedlevel.z_values[x][y] -= zmean;
-              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+              TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, bedlevel.z_values[x][y]));
             }
             TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
           }
@@ -34,6 +34,10 @@
 #include "../../../module/planner.h"
 #include "../../../module/probe.h"
 #include "../../../module/temperature.h"
+
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
 #include "../../queue.h"
 
 #if ENABLED(AUTO_BED_LEVELING_LINEAR)
@@ -63,6 +67,14 @@
   #include "../../../module/ft_motion.h"
 #endif
 
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+  #include "../../../feature/bedlevel/probe_order.h"
+#endif
+
+#if ENABLED(PROBE_STATISTICS)
+  #include "../../../feature/bedlevel/probe_stats.h"
+#endif
+
 #if ABL_USES_GRID
   #if ENABLED(PROBE_Y_FIRST)
     #define PR_OUTER_VAR  abl.meshCount.x
@@ -141,6 +153,11 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(G29_ADAPTIVE_PROBING)
+      bool adaptive;                    // Probe only the grid points that cover the given area
+      xy_int8_t probe_min, probe_max;   // Range of grid points to probe
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[GRID_MAX_POINTS * 3],  // "A" matrix of the linear system of equations
@@ -155,6 +172,26 @@ public:
   constexpr grid_count_t G29_State::abl_points;
 #endif
 
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+
+  // Leave out the grid points that G29 can't or shouldn't probe
+  static bool g29_probe_filter(const xy_int8_t &pt, void *data) {
+    const G29_State &abl = *(const G29_State*)data;
+    UNUSED(abl);
+    #if IS_KINEMATIC
+      // Avoid probing outside the round or hexagonal area
+      if (!probe.can_reach(abl.probe_position_lf + abl.gridSpacing * pt.asFloat())) return false;
+    #endif
+    #if ENABLED(G29_ADAPTIVE_PROBING)
+      // Only probe the points around the area
+      if (abl.adaptive && !(WITHIN(pt.x, abl.probe_min.x, abl.probe_max.x)
+                         && WITHIN(pt.y, abl.probe_min.y, abl.probe_max.y))) return false;
+    #endif
+    return true;
+  }
+
+#endif
+
 /**
  * G29: Bed Leveling
  *
@@ -200,6 +237,11 @@ public:
  *
  *   With AUTO_BED_LEVELING_BILINEAR:
  *     Z<float>  Supply additional Z offset to all probe points.
+ *
+ *   With G29_ADAPTIVE_PROBING:
+ *     K<bool>  Keep the full-bed grid and only probe the points needed to cover
+ *              the H or L,R,F,B area (e.g., the print's bounding box). Points
+ *              outside keep their stored values or are extrapolated.
  *     W<bool>  Write a mesh point. (If G29 is idle.)
  *       I<index>  Index for mesh point
  *       J<index>  Index for mesh point
@@ -233,6 +275,9 @@ G29_TYPE GcodeSuite::G29() {
   // Keep powered steppers from timing out
   reset_stepper_timeout();
 
+  // The stored mesh may be queried or edited
+  TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh());
+
   // Q = Query leveling and G29 state
   const bool seenQ = ANY(DEBUG_LEVELING_FEATURE, PROBE_MANUALLY) && parser.seen_test('Q');
 
@@ -334,7 +379,7 @@ G29_TYPE GcodeSuite::G29() {
           set_bed_leveling_enabled(false);
           bedlevel.z_values[i][j] = rz;
           bedlevel.refresh_bed_level();
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, rz));
+          TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(i, j, rz));
           if (abl.reenable) {
             set_bed_leveling_enabled(true);
             report_current_position();
@@ -407,6 +452,8 @@ G29_TYPE GcodeSuite::G29() {
       const float x_min = probe.min_x(), x_max = probe.max_x(),
                   y_min = probe.min_y(), y_max = probe.max_y();
 
+      TERN_(G29_ADAPTIVE_PROBING, abl.adaptive = parser.boolval('K'));
+
       if (parser.seen('H')) {
         const int16_t size = (int16_t)parser.value_linear_units();
         abl.probe_position_lf.set(_MAX((X_CENTER) - size / 2, x_min), _MAX((Y_CENTER) - size / 2, y_min));
@@ -426,10 +473,36 @@ G29_TYPE GcodeSuite::G29() {
         G29_RETURN(false, false);
       }
 
+      #if ENABLED(G29_ADAPTIVE_PROBING)
+        // Probe the grid points around the area on the full-bed grid
+        xy_pos_t area_lf, area_rb;
+        if (abl.adaptive) {
+          area_lf = abl.probe_position_lf;
+          area_rb = abl.probe_position_rb;
+          abl.probe_position_lf.set(x_min, y_min);
+          abl.probe_position_rb.set(x_max, y_max);
+        }
+      #endif
+
       // Probe at the points of a lattice grid
       abl.gridSpacing.set((abl.probe_position_rb.x - abl.probe_position_lf.x) / (abl.grid_points.x - 1),
                           (abl.probe_position_rb.y - abl.probe_position_lf.y) / (abl.grid_points.y - 1));
 
+      #if ENABLED(G29_ADAPTIVE_PROBING)
+        if (abl.adaptive) {
+          abl.probe_min.set(FLOOR((area_lf.x - abl.probe_position_lf.x) / abl.gridSpacing.x),
+                            FLOOR((area_lf.y - abl.probe_position_lf.y) / abl.gridSpacing.y));
+          abl.probe_max.set(CEIL((area_rb.x - abl.probe_position_lf.x) / abl.gridSpacing.x),
+                            CEIL((area_rb.y - abl.probe_position_lf.y) / abl.gridSpacing.y));
+          LIMIT(abl.probe_min.x, 0, abl.grid_points.x - 1);
+          LIMIT(abl.probe_min.y, 0, abl.grid_points.y - 1);
+          LIMIT(abl.probe_max.x, 0, abl.grid_points.x - 1);
+          LIMIT(abl.probe_max.y, 0, abl.grid_points.y - 1);
+          if (abl.verbose_level > 0)
+            SERIAL_ECHOLNPGM("Probing grid points X", abl.probe_min.x, "-", abl.probe_max.x, " Y", abl.probe_min.y, "-", abl.probe_max.y);
+        }
+      #endif
+
     #endif // ABL_USES_GRID
 
     if (abl.verbose_level > 0) {
@@ -517,7 +590,12 @@ G29_TYPE GcodeSuite::G29() {
         abl.reenable = false;   // Can't re-enable (on error) until the new grid is written
       }
       // Pre-populate local Z values from the stored mesh
-      TERN_(IS_KINEMATIC, COPY(abl.z_values, bedlevel.z_values));
+      #if IS_KINEMATIC
+        COPY(abl.z_values, bedlevel.z_values);
+      #elif ENABLED(G29_ADAPTIVE_PROBING)
+        // Keep the stored (or unprobed) values outside the area
+        if (abl.adaptive) COPY(abl.z_values, bedlevel.z_values);
+      #endif
     #endif
 
   } // !g29_in_progress
@@ -586,7 +664,7 @@ G29_TYPE GcodeSuite::G29() {
 
         const float newz = abl.measured_z + abl.Z_offset;
         abl.z_values[abl.meshCount.x][abl.meshCount.y] = newz;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, newz));
+        TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(abl.meshCount, newz));
 
         if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM_P(PSTR("Save X"), abl.meshCount.x, SP_Y_STR, abl.meshCount.y, SP_Z_STR, abl.measured_z + abl.Z_offset);
 
@@ -673,6 +751,33 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_USES_GRID
 
+      #if ENABLED(PROBE_PIPELINED_TRAVEL)
+        // Points still to be probed, to know which one is the last
+        grid_count_t points_left = abl.abl_points;
+        #if ENABLED(G29_ADAPTIVE_PROBING)
+          if (abl.adaptive)
+            points_left = grid_count_t(abl.probe_max.x - abl.probe_min.x + 1) * (abl.probe_max.y - abl.probe_min.y + 1);
+        #endif
+      #endif
+
+      #if ENABLED(PROBE_STATISTICS)
+        if (!abl.dryrun) probe_stats.begin_run(abl.probe_position_lf, abl.gridSpacing);
+      #endif
+
+      #if ENABLED(SELECTABLE_PROBE_ORDER)
+
+      // Visit the grid points in the order set with M215
+      probe_order.start(abl.grid_points, abl.probe_position_lf, abl.gridSpacing,
+                        xy_pos_t(current_position) + probe.offset_xy, g29_probe_filter, &abl);
+
+      // An index to print current state
+      grid_count_t pt_index = 0;
+
+      while (!isnan(abl.measured_z) && probe_order.next(abl.meshCount)) {
+        ++pt_index;
+
+      #else
+
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
       // Outer loop is X with PROBE_Y_FIRST enabled
@@ -701,6 +806,8 @@ G29_TYPE GcodeSuite::G29() {
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
 
+      #endif // !SELECTABLE_PROBE_ORDER
+
           abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
 
           TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
@@ -708,6 +815,12 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
+          #if ENABLED(G29_ADAPTIVE_PROBING)
+            // Only probe the points around the area
+            if (abl.adaptive && !(WITHIN(abl.meshCount.x, abl.probe_min.x, abl.probe_max.x)
+                               && WITHIN(abl.meshCount.y, abl.probe_min.y, abl.probe_max.y))) continue;
+          #endif
+
           if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
@@ -769,7 +882,14 @@ G29_TYPE GcodeSuite::G29() {
 
           #else // !BD_SENSOR_PROBE_NO_STOP
 
-            abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+            #if ENABLED(PROBE_PIPELINED_TRAVEL)
+              // Leave the raise to the travel to the next point
+              const ProbePtRaise pt_raise = (raise_after == PROBE_PT_RAISE && --points_left) ? PROBE_PT_LIFT : raise_after;
+            #else
+              const ProbePtRaise pt_raise = raise_after;
+            #endif
+
+            abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, pt_raise, abl.verbose_level);
 
           #endif
 
@@ -792,7 +912,8 @@ G29_TYPE GcodeSuite::G29() {
 
             const float z = abl.measured_z + abl.Z_offset;
             abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+            TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(abl.meshCount, z));
+            TERN_(PROBE_STATISTICS, if (!abl.dryrun) probe_stats.add(abl.meshCount.x, abl.meshCount.y, abl.measured_z));
 
             #if ENABLED(SOVOL_SV06_RTS)
               if (pt_index <= GRID_MAX_POINTS) rts.sendData(pt_index, AUTO_BED_LEVEL_ICON_VP);
@@ -805,8 +926,15 @@ G29_TYPE GcodeSuite::G29() {
           abl.reenable = false; // Don't re-enable after modifying the mesh
           idle_no_sleep();
 
+      #if ENABLED(SELECTABLE_PROBE_ORDER)
+        } // grid points
+      #else
         } // inner
       } // outer
+      #endif
+
+      TERN_(SELECTABLE_PROBE_ORDER, if (!isnan(abl.measured_z)) probe_order.report());
+      TERN_(PROBE_STATISTICS, if (!abl.dryrun && !isnan(abl.measured_z)) probe_stats.end_run());
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
@@ -873,7 +1001,11 @@ G29_TYPE GcodeSuite::G29() {
       else {
         bedlevel.set_grid(abl.gridSpacing, abl.probe_position_lf);
         COPY(bedlevel.z_values, abl.z_values);
-        TERN_(IS_KINEMATIC, bedlevel.extrapolate_unprobed_bed_level());
+        #if IS_KINEMATIC
+          bedlevel.extrapolate_unprobed_bed_level();
+        #elif ENABLED(G29_ADAPTIVE_PROBING)
+          if (abl.adaptive) bedlevel.extrapolate_unprobed_bed_level();
+        #endif
         bedlevel.refresh_bed_level();
 
         bedlevel.print_leveling_grid();
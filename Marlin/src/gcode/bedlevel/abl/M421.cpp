@@ -31,6 +31,10 @@
 #include "../../gcode.h"
 #include "../../../feature/bedlevel/bedlevel.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
 #endif
@@ -47,6 +51,7 @@
  *  - If both I and J are omitted, set all
  */
 void GcodeSuite::M421() {
+  TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh());
   int8_t ix = parser.intval('I', -1), iy = parser.intval('J', -1);
   const bool hasZ = parser.seenval('Z'),
              hasQ = !hasZ && parser.seenval('Q');
@@ -59,7 +64,7 @@ void GcodeSuite::M421() {
       for (uint8_t x = sx; x <= ex; ++x) {
         for (uint8_t y = sy; y <= ey; ++y) {
           bedlevel.z_values[x][y] = zval + (hasQ ? bedlevel.z_values[x][y] : 0);
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+          TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(x, y, bedlevel.z_values[x][y]));
         }
       }
       bedlevel.refresh_bed_level();
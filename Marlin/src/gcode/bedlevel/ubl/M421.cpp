@@ -66,7 +66,7 @@ void GcodeSuite::M421() {
   else {
     float &zval = bedlevel.z_values[ij.x][ij.y];                          // Altering this Mesh Point
     zval = hasN ? NAN : parser.value_linear_units() + (hasQ ? zval : 0);  // N=NAN, Z=NEWVAL, or Q=ADDVAL
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ij.x, ij.y, zval));          // Ping ExtUI in case it's showing the mesh
+    TERN_(EXTENSIBLE_UI, ExtUI::queueMeshUpdate(ij.x, ij.y, zval));          // Ping ExtUI in case it's showing the mesh
   }
 }
 
@@ -404,18 +404,26 @@ void GcodeSuite::G28() {
 
       #endif // HAS_Z_AXIS
 
+      #if ENABLED(HOME_XY_TOGETHER)
+        // Home X and Y at the same time if both are homing
+        const bool home_xy_together = doX && doY;
+        if (home_xy_together) homeaxes_xy();
+      #else
+        constexpr bool home_xy_together = false;
+      #endif
+
       // Diagonal move first if both are homing
-      TERN_(QUICK_HOME, if (doX && doY) quick_home_xy());
+      TERN_(QUICK_HOME, if (doX && doY && !home_xy_together) quick_home_xy());
 
       #if HAS_Y_AXIS
         // Home Y (before X)
-        if (ENABLED(HOME_Y_BEFORE_X) && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
+        if (ENABLED(HOME_Y_BEFORE_X) && !home_xy_together && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
           homeaxis(Y_AXIS);
       #endif
 
       // Home X
       #if HAS_X_AXIS
-        if (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X))) {
+        if (!home_xy_together && (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X)))) {
 
           #if ENABLED(DUAL_X_CARRIAGE)
 
@@ -448,7 +456,7 @@ void GcodeSuite::G28() {
 
       #if HAS_Y_AXIS
         // Home Y (after X)
-        if (DISABLED(HOME_Y_BEFORE_X) && doY) homeaxis(Y_AXIS);
+        if (DISABLED(HOME_Y_BEFORE_X) && doY && !home_xy_together) homeaxis(Y_AXIS);
       #endif
 
       #if ALL(FOAMCUTTER_XYUV, HAS_J_AXIS)
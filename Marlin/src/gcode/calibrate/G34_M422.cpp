@@ -182,6 +182,11 @@ void GcodeSuite::G34() {
         bool adjustment_reverse = false;
       #endif
 
+      #if ENABLED(Z_STEPPER_ALIGN_FIT)
+        // The misalignment of each stepper before its last correction, and the correction made
+        float fit_error[NUM_Z_STEPPERS] = { 0 }, fit_move[NUM_Z_STEPPERS] = { 0 };
+      #endif
+
       #if HAS_STATUS_MESSAGE
         PGM_P const msg_iteration = GET_TEXT(MSG_ITERATION);
         const uint8_t iter_str_len = strlen_P(msg_iteration);
@@ -227,9 +232,16 @@ void GcodeSuite::G34() {
                             " Probe Tgt: ", p_float_t(minz, 3));
           }
 
+          #if ENABLED(PROBE_PIPELINED_TRAVEL)
+            // Leave the raise to the travel to the next point
+            const ProbePtRaise pt_raise = (raise_after == PROBE_PT_RAISE && i < NUM_Z_STEPPERS - 1) ? PROBE_PT_LIFT : raise_after;
+          #else
+            const ProbePtRaise pt_raise = raise_after;
+          #endif
+
           const float z_probed_height = probe.probe_at_point(
             DIFF_TERN(HAS_HOME_OFFSET, ppos, xy_pos_t(home_offset)),   // xy
-            raise_after,                                               // raise_after
+            pt_raise,                                                  // raise_after
             (DEBUGGING(LEVELING) || DEBUGGING(INFO)) ? 3 : 0,          // verbose_level
             true, false,                                               // probe_relative, sanity_check
             minz,                                                      // z_min_point
@@ -354,19 +366,43 @@ void GcodeSuite::G34() {
           last_z_align_level_indicator = z_align_level_indicator;
         #endif
 
+        // Stop early if all measured points achieve accuracy target, with no corrections left to make
+        bool success_break = true;
+        for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper)
+          if (ABS(z_measured[zstepper] - z_measured_min) > z_auto_align_accuracy) success_break = false;
+
+        if (success_break) {
+          SERIAL_ECHOLNPGM("Target accuracy achieved.");
+          LCD_MESSAGE(MSG_ACCURACY_ACHIEVED);
+          break;
+        }
+
         // The following correction actions are to be enabled for select Z-steppers only
         stepper.set_separate_multi_axis(true);
 
-        bool success_break = true;
         // Correct the individual stepper offsets
         for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper) {
           // Calculate current stepper move
           float z_align_move = z_measured[zstepper] - z_measured_min;
           const float z_align_abs = ABS(z_align_move);
 
-          #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
+          #if ENABLED(Z_STEPPER_ALIGN_FIT)
+            // Fit the response of this stepper to its last correction: a move of fit_move
+            // took out (fit_error - z_align_abs) of the misalignment. Size this one to match.
+            // Moves too small to measure against the target accuracy keep the default.
+            amplification = z_auto_align_amplification;
+            if (fit_move[zstepper] > 2 * z_auto_align_accuracy) {
+              const float gain = (fit_error[zstepper] - z_align_abs) / fit_move[zstepper];
+              if (gain > 0.5f) amplification = _MAX(1.0f / gain, 0.5f);
+            }
+            fit_error[zstepper] = z_align_abs;
+            fit_move[zstepper] = z_align_abs * amplification;
+          #elif !HAS_Z_STEPPER_ALIGN_STEPPER_XY
             // Optimize one iteration's correction based on the first measurements
             if (z_align_abs) amplification = (iteration == 1) ? _MIN(last_z_align_move[zstepper] / z_align_abs, 2.0f) : z_auto_align_amplification;
+          #endif
+
+          #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
 
             // Check for less accuracy compared to last move
             if (decreasing_accuracy(last_z_align_move[zstepper], z_align_abs)) {
@@ -380,9 +416,6 @@ void GcodeSuite::G34() {
             if (z_align_abs > 0) last_z_align_move[zstepper] = z_align_abs;
           #endif
 
-          // Stop early if all measured points achieve accuracy target
-          if (z_align_abs > z_auto_align_accuracy) success_break = false;
-
           if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Z", zstepper + 1, " corrected by ", z_align_move);
 
           // Lock all steppers except one
@@ -407,12 +440,6 @@ void GcodeSuite::G34() {
 
         if (err_break) break;
 
-        if (success_break) {
-          SERIAL_ECHOLNPGM("Target accuracy achieved.");
-          LCD_MESSAGE(MSG_ACCURACY_ACHIEVED);
-          break;
-        }
-
         iteration++;
       } // while (iteration < z_auto_align_iterations)
 
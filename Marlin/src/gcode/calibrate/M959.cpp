@@ -0,0 +1,274 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LIMITS_CALIBRATION)
+
+#include "../gcode.h"
+#include "../../module/endstops.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+
+#if ENABLED(RESONANCE_TUNING)
+  #include "../../feature/accelerometer.h"
+  #define RINGING_SAMPLES ((ACCEL_RATE) / 4)  // 250ms after the stop
+#endif
+
+enum StageResult : uint8_t { STAGE_OK, STAGE_FAILED, STAGE_ERROR };
+
+static void set_limits(const AxisEnum axis, const float accel, const float feedrate, const float travel_accel) {
+  planner.settings.max_acceleration_mm_per_s2[axis] = accel;
+  planner.settings.max_feedrate_mm_s[axis] = feedrate;
+  planner.settings.travel_acceleration = travel_accel;
+  planner.refresh_acceleration_rates();
+}
+
+/**
+ * Move slowly onto the homing endstop and get the position where it triggers.
+ * The current position is then taken from the steppers, so a shift of the
+ * trigger position is the distance lost to skipped steps.
+ */
+static bool find_endstop(const AxisEnum axis, float &trigger) {
+  const float dir = home_dir(axis), home = base_home_pos(axis),
+              approach = _MAX(home_bump_mm(axis), 2.0f) * 2;
+
+  current_position[axis] = home - dir * approach;
+  line_to_current_position(homing_feedrate(axis));
+  planner.synchronize();
+
+  endstops.enable(true);
+  current_position[axis] = home + dir * approach;
+  line_to_current_position(get_homing_bump_feedrate(axis));
+  planner.synchronize();
+  const bool hit = endstops.trigger_state();
+  trigger = planner.triggered_position_mm(axis);
+  endstops.hit_on_purpose();
+  endstops.not_homing();
+
+  set_current_from_steppers_for_axis(axis);
+  sync_plan_position();
+  return hit;
+}
+
+#if ENABLED(RESONANCE_TUNING)
+
+  /**
+   * Read the accelerometer for RINGING_SAMPLES after a stop. Return the peak
+   * acceleration along the axis in the first half, taken from the settled
+   * level of the second half, or a negative value if the sensor stops sending.
+   */
+  static float ringing(const AxisEnum axis) {
+    uint8_t sensor_axis = ACCEL_AXIS_X;
+    #if HAS_Y_AXIS
+      if (axis == Y_AXIS) sensor_axis = ACCEL_AXIS_Y;
+    #endif
+
+    static int16_t trace[RINGING_SAMPLES];
+    accel_sample_t samples[ACCEL_FIFO_DEPTH];
+    bool overrun;
+    accelerometer.read(samples, ACCEL_FIFO_DEPTH, overrun); // Drop samples from before the stop
+
+    uint16_t n = 0;
+    const millis_t end_ms = millis() + 2 * 1000UL * (RINGING_SAMPLES) / (ACCEL_RATE);
+    while (n < RINGING_SAMPLES && PENDING(millis(), end_ms)) {
+      const uint8_t got = accelerometer.read(samples, ACCEL_FIFO_DEPTH, overrun);
+      for (uint8_t i = 0; i < got && n < RINGING_SAMPLES; ++i) {
+        const accel_sample_t &s = samples[i];
+        trace[n++] = sensor_axis == 0 ? s.x : sensor_axis == 1 ? s.y : s.z;
+      }
+      idle();
+    }
+    if (n < RINGING_SAMPLES) return -1;
+
+    int32_t sum = 0;
+    for (uint16_t i = RINGING_SAMPLES / 2; i < RINGING_SAMPLES; ++i) sum += trace[i];
+    const int16_t settled = sum / (RINGING_SAMPLES - RINGING_SAMPLES / 2);
+
+    uint16_t peak = 0;
+    for (uint16_t i = 0; i < RINGING_SAMPLES / 2; ++i) NOLESS(peak, uint16_t(ABS(trace[i] - settled)));
+    return peak * ACCEL_MM_S2_PER_LSB;
+  }
+
+#endif
+
+/**
+ * Run LIMITS_CAL_CYCLES strokes out and back at the given limits, then check
+ * for ringing and skipped steps. Steps lost are put back into the position.
+ */
+static StageResult run_stage(const AxisEnum axis, const float accel, const float feedrate, const float stroke, const float ref_trigger) {
+  const float old_accel = planner.settings.max_acceleration_mm_per_s2[axis],
+              old_feedrate = planner.settings.max_feedrate_mm_s[axis],
+              old_travel_accel = planner.settings.travel_acceleration,
+              start = (base_min_pos(axis) + base_max_pos(axis) - stroke) / 2;
+
+  SERIAL_ECHOPGM(" ", C(AXIS_CHAR(axis)), " ", int(accel), "mm/s² ", int(feedrate), "mm/s:");
+
+  current_position[axis] = start;
+  line_to_current_position(homing_feedrate(axis));
+  planner.synchronize();
+
+  set_limits(axis, accel, feedrate, accel);
+  for (uint8_t i = 0; i < 2 * (LIMITS_CAL_CYCLES); ++i) {
+    current_position[axis] = start + (TEST(i, 0) ? 0 : stroke);
+    line_to_current_position(feedrate);
+  }
+  planner.synchronize();
+
+  bool failed = false;
+  #if ENABLED(RESONANCE_TUNING)
+    const float ring = ringing(axis);
+    if (ring < 0) {
+      set_limits(axis, old_accel, old_feedrate, old_travel_accel);
+      SERIAL_EOL();
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("No accelerometer data"));
+      return STAGE_ERROR;
+    }
+    SERIAL_ECHOPGM(" ringing ", int(ring), "mm/s²");
+    if (ring > accel * (LIMITS_CAL_RINGING)) failed = true;
+  #endif
+
+  set_limits(axis, old_accel, old_feedrate, old_travel_accel);
+
+  float trigger;
+  if (!find_endstop(axis, trigger)) {
+    SERIAL_EOL();
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Endstop ", C(AXIS_CHAR(axis)), " not found. Home again."));
+    return STAGE_ERROR;
+  }
+  const float shift = trigger - ref_trigger;
+  SERIAL_ECHOLNPGM(" shift ", p_float_t(shift, 3), "mm");
+  if (ABS(shift) > LIMITS_CAL_TOLERANCE) {
+    current_position[axis] -= shift;
+    sync_plan_position();
+    failed = true;
+  }
+
+  return failed ? STAGE_FAILED : STAGE_OK;
+}
+
+static void calibrate_axis(const AxisEnum axis, const float accel_start, const float feed_start, const float stroke, const bool apply) {
+  const char axis_char = AXIS_CHAR(axis);
+
+  float ref_trigger;
+  if (!find_endstop(axis, ref_trigger)) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Endstop ", C(axis_char), " not found"));
+    return;
+  }
+
+  // Acceleration first. Every stroke speeds up and slows down over its whole length.
+  float good_accel = 0;
+  for (float accel = accel_start; accel <= LIMITS_CAL_ACCEL_MAX; accel *= LIMITS_CAL_RAMP) {
+    const StageResult r = run_stage(axis, accel, _MIN(SQRT(accel * stroke), feed_start), stroke, ref_trigger);
+    if (r == STAGE_ERROR) return;
+    if (r == STAGE_FAILED) break;
+    good_accel = accel;
+  }
+  if (!good_accel) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Failed at the start acceleration on ", C(axis_char)));
+    return;
+  }
+
+  // Then the feedrate, at the acceleration found
+  float good_feed = 0;
+  for (float feedrate = feed_start; feedrate <= LIMITS_CAL_FEED_MAX; feedrate *= LIMITS_CAL_RAMP) {
+    if (sq(feedrate) > good_accel * stroke) {
+      SERIAL_ECHOLNPGM("Stroke too short for ", int(feedrate), "mm/s");
+      break;
+    }
+    const StageResult r = run_stage(axis, good_accel, feedrate, stroke, ref_trigger);
+    if (r == STAGE_ERROR) return;
+    if (r == STAGE_FAILED) break;
+    good_feed = feedrate;
+  }
+
+  constexpr float keep = 1.0f - (LIMITS_CAL_MARGIN) / 100.0f;
+  const float max_accel = good_accel * keep,
+              max_feed = good_feed ? good_feed * keep : planner.settings.max_feedrate_mm_s[axis];
+
+  SERIAL_ECHOLNPGM("Limits ", C(axis_char), ": ", int(good_accel), "mm/s², ", good_feed ? int(good_feed) : 0, "mm/s. Less ", LIMITS_CAL_MARGIN, "% margin:");
+  if (!good_feed) SERIAL_ECHOLNPGM("Feedrate not found. Keeping M203 ", C(axis_char));
+
+  if (apply) {
+    planner.set_max_acceleration(axis, max_accel);
+    planner.set_max_feedrate(axis, max_feed);
+  }
+  SERIAL_ECHOPGM("  M201 ", C(axis_char)); SERIAL_ECHOLN(int(max_accel));
+  SERIAL_ECHOPGM("  M203 ", C(axis_char)); SERIAL_ECHOLN(int(max_feed));
+}
+
+/**
+ * M959: Find the highest safe acceleration and feedrate of an axis
+ *  X            Calibrate the X axis. With no axes given, calibrate X and Y.
+ *  Y            Calibrate the Y axis.
+ *  A<accel>     First acceleration stage, in mm/s² (Default LIMITS_CAL_ACCEL_START)
+ *  F<mm/s>      First feedrate stage (Default LIMITS_CAL_FEED_START)
+ *  L<mm>        Stroke length (Default LIMITS_CAL_STROKE)
+ *  R            Report the limits without setting M201 / M203
+ *
+ * Skipped steps at the last stage may make the axis lose its position, which
+ * is corrected from the endstop. Save the results with M500.
+ */
+void GcodeSuite::M959() {
+  if (homing_needed_error()) return;
+
+  const float accel_start = parser.floatval('A', LIMITS_CAL_ACCEL_START),
+              feed_start = parser.floatval('F', LIMITS_CAL_FEED_START),
+              stroke = parser.floatval('L', LIMITS_CAL_STROKE);
+  if (accel_start <= 0 || feed_start <= 0) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Acceleration (A) and feedrate (F) must be positive"));
+    return;
+  }
+
+  const bool seen_X = parser.seen_test('X'),
+             seen_Y = TERN0(HAS_Y_AXIS, parser.seen_test('Y')),
+             for_all = !seen_X && !seen_Y,
+             apply = !parser.seen_test('R');
+
+  // Leave room for the endstop approach at either end
+  auto stroke_fits = [&](const AxisEnum axis) {
+    return WITHIN(stroke, 1, base_max_pos(axis) - base_min_pos(axis) - 4 * _MAX(home_bump_mm(axis), 2.0f));
+  };
+  if (((seen_X || for_all) && !stroke_fits(X_AXIS)) || TERN0(HAS_Y_AXIS, ((seen_Y || for_all) && !stroke_fits(Y_AXIS)))) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Stroke (L) too long for the axis"));
+    return;
+  }
+
+  planner.synchronize();
+  KEEPALIVE_STATE(IN_HANDLER);
+
+  #if ENABLED(RESONANCE_TUNING)
+    if (!accelerometer.begin()) {
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("No accelerometer"));
+      return;
+    }
+  #endif
+
+  if (seen_X || for_all) calibrate_axis(X_AXIS, accel_start, feed_start, stroke, apply);
+  #if HAS_Y_AXIS
+    if (seen_Y || for_all) calibrate_axis(Y_AXIS, accel_start, feed_start, stroke, apply);
+  #endif
+
+  TERN_(RESONANCE_TUNING, accelerometer.end());
+}
+
+#endif // LIMITS_CALIBRATION
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(BUFFER_ARENA)
+
+#include "../gcode.h"
+#include "../queue.h"
+#include "../../module/planner.h"
+
+void GcodeSuite::M227_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading_etc(forReplay, F("Planner Blocks"));
+  SERIAL_ECHOLNPGM("  M227 B", planner.arena_blocks);
+  if (!forReplay)
+    SERIAL_ECHO_MSG("In use: ", block_buffer_size, " blocks, ", queue.ring_buffer.pool_size, " bytes of command pool");
+}
+
+/**
+ * M227: Set the number of planner blocks from the next boot
+ *
+ *  B<blocks> - Planner blocks, up to BLOCK_BUFFER_SIZE. The RAM of the
+ *              others goes to the command pool. Save with M500.
+ */
+void GcodeSuite::M227() {
+  if (!parser.seenval('B')) return M227_report(false);
+  const uint8_t b = parser.value_byte();
+  if (WITHIN(b, BUFFER_ARENA_MIN_BLOCKS, BLOCK_BUFFER_SIZE))
+    planner.arena_blocks = b;
+  else
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("B out of range (", BUFFER_ARENA_MIN_BLOCKS, " to ", BLOCK_BUFFER_SIZE, ")"));
+}
+
+#endif // BUFFER_ARENA
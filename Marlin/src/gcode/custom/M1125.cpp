@@ -85,6 +85,10 @@ bool M1125_CheckAndHandleHeaterTimeout();
 // restore them on resume so no commands are lost.
 static GCodeQueue::CommandLine m1125_saved_commands[BUFSIZE];
 static uint8_t m1125_saved_cmd_count = 0;
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  // The saved command strings, packed end-to-end like the queue's own pool
+  static char m1125_saved_pool[COMMAND_POOL_SIZE];
+#endif
 
 static inline char m1125_upper(const char c) {
   return (c >= 'a' && c <= 'z') ? (c - 'a' + 'A') : c;
@@ -249,6 +253,7 @@ void GcodeSuite::M1125() {
         const uint8_t len = queue.ring_buffer.length;
         m1125_saved_cmd_count = 0;
         uint8_t filtered_cmds = 0;
+        TERN_(PACKED_COMMAND_QUEUE, uint16_t saved_pool_w = 0);
         for (uint8_t i = 0; i < len; ++i) {
           uint8_t pos = start + i;
           if (pos >= BUFSIZE) pos -= BUFSIZE;
@@ -260,8 +265,17 @@ void GcodeSuite::M1125() {
             SERIAL_ECHOLN(src.buffer);
             continue;
           }
-          if (m1125_saved_cmd_count < BUFSIZE)
-            m1125_saved_commands[m1125_saved_cmd_count++] = src;
+          if (m1125_saved_cmd_count < BUFSIZE) {
+            GCodeQueue::CommandLine &dst = m1125_saved_commands[m1125_saved_cmd_count++];
+            dst = src;
+            #if ENABLED(PACKED_COMMAND_QUEUE)
+              // Copy the string out of the queue's pool, which is about to be reused
+              const uint8_t size = GCodeQueue::RingBuffer::stored_size(src.buffer);
+              dst.buffer = &m1125_saved_pool[saved_pool_w];
+              memcpy(dst.buffer, src.buffer, size);
+              saved_pool_w += size;
+            #endif
+          }
         }
 
         queue.ring_buffer.clear();
@@ -716,9 +730,17 @@ static bool m1125_poll_resume() {
           PORT_REDIRECT(SerialMask::All);
           for (uint8_t i = 0; i < m1125_saved_cmd_count; ++i) {
             // Copy saved command back into the ring buffer at the write pos
-            const uint8_t wp = queue.ring_buffer.index_w;
-            queue.ring_buffer.commands[wp] = m1125_saved_commands[i];
-            queue.ring_buffer.advance_w();
+            #if ENABLED(PACKED_COMMAND_QUEUE)
+              // The pool has no room past a full queue
+              if (queue.ring_buffer.full()) break;
+              const GCodeQueue::CommandLine &src = m1125_saved_commands[i];
+              memcpy(queue.ring_buffer.write_buffer(), src.buffer, GCodeQueue::RingBuffer::stored_size(src.buffer));
+              queue.ring_buffer.commit_command(src.skip_ok OPTARG(HAS_MULTI_SERIAL, src.port));
+            #else
+              const uint8_t wp = queue.ring_buffer.index_w;
+              queue.ring_buffer.commands[wp] = m1125_saved_commands[i];
+              queue.ring_buffer.advance_w();
+            #endif
 
             SERIAL_ECHOPGM("[DEBUG] M1125: restoring saved SD cmd[");
             SERIAL_ECHO(i);
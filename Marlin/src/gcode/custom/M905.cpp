@@ -8,8 +8,9 @@
  * Flow:
  *  - Require homed axes (safe operation).
  *  - Move to the requested start height above the bed.
- *  - Descend in small steps until the probe triggers (LOW/active).
- *  - On trigger, step back up to previous height and verify the probe clears.
+ *  - Bisect between the start height and Z_PROBE_LOW_POINT to find where the
+ *    probe triggers (LOW/active), to within 0.1mm.
+ *  - Move back up to the lowest clear height and verify the probe clears.
  *  - If the probe clears, accept measured_z + PROBE_EN_OFF_MARGIN as the
  *    calibrated `probe_en_off_height` and persist via settings.save().
  */
@@ -90,34 +91,38 @@ void GcodeSuite::M905() {
     }
   #endif
 
-  // Descend in steps until probe triggers
-  const float step = 0.5f; // mm per decrement
-  float prev_z = start_z;
-  bool found = false;
-  float detected_z = start_z;
+  // Bisect the gap between a height where the probe is clear (hi) and one
+  // where it's active (lo) instead of stepping down one settle wait at a time.
+  constexpr float resolution = 0.1f; // mm
+  float hi = start_z, lo = Z_PROBE_LOW_POINT;
+  bool found = false, seen_active = false;
 
-  for (float z = start_z; z >= Z_PROBE_LOW_POINT; z -= step) {
-    do_blocking_move_to_xy_z(xy_pos_t{ cur_x, cur_y }, z, homing_feedrate(Z_AXIS));
-    safe_delay(settle_ms);
-    if ((endstops.probe_switch_activated())) {
-      // Probe went active at this z
-      detected_z = z;
-      // Step back up to previous z to verify it clears
-      do_blocking_move_to_xy_z(xy_pos_t{ cur_x, cur_y }, prev_z, homing_feedrate(Z_AXIS));
+  safe_delay(settle_ms);
+  if (endstops.probe_switch_activated())
+    SERIAL_ECHOLNPGM("M905: probe still active at ", start_z);
+  else {
+    while (hi - lo > resolution) {
+      const float mid = (hi + lo) * 0.5f;
+      do_blocking_move_to_xy_z(xy_pos_t{ cur_x, cur_y }, mid, homing_feedrate(Z_AXIS));
+      safe_delay(settle_ms);
+      if (endstops.probe_switch_activated()) { lo = mid; seen_active = true; }
+      else hi = mid;
+    }
+
+    if (seen_active) {
+      // Go back up to the lowest clear height to verify the probe clears
+      do_blocking_move_to_xy_z(xy_pos_t{ cur_x, cur_y }, hi, homing_feedrate(Z_AXIS));
       safe_delay(settle_ms);
-      if (!(endstops.probe_switch_activated())) {
+      if (!endstops.probe_switch_activated())
         found = true;
-      }
-      else {
-        // Still triggered at previous height -> unreliable, abort
-        SERIAL_ECHOLNPGM("M905: probe still active at ", prev_z);
-        break;
-      }
-      break;
+      else
+        SERIAL_ECHOLNPGM("M905: probe still active at ", hi);
     }
-    prev_z = z;
   }
 
+  // Probe went active at this z
+  const float detected_z = lo;
+
   if (!found) {
     SERIAL_ECHO_START(); SERIAL_ECHOLN("M905: Failed to detect a clean probe transition - aborting");
     // Restore original Z
@@ -134,7 +139,7 @@ void GcodeSuite::M905() {
     MarlinSettings::set_probe_en_off_margin(margin);
     MarlinSettings::set_m905_step_settle_ms(settle_ms);
   }
-  const bool ok = settings.save();
+  const bool ok = settings.save(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_PROBE_OFFSET));
 
   if (ok) {
     SERIAL_ECHOLNPGM("M905: Calibrated probe_en_off_height = ", calibrated, " mm (saved to EEPROM)");
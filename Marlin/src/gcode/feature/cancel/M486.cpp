@@ -52,6 +52,9 @@ void GcodeSuite::M486() {
   if (parser.seenval('P')) cancelable.cancel_object(parser.value_int());
 
   if (parser.seenval('U')) cancelable.uncancel_object(parser.value_int());
+
+  // Leaving a canceled object, catch up with its skipped moves
+  if (!cancelable.state.skipping && cancelable.skip_started) cancelable.finish_skip();
 }
 
 #endif // CANCEL_OBJECTS
@@ -41,6 +41,9 @@ void say_shaper_type(const AxisEnum a, bool &sep, const char axis_name) {
     case ftMotionShaper_2HEI:  SERIAL_ECHOPGM("2 Hump EI"); break;
     case ftMotionShaper_3HEI:  SERIAL_ECHOPGM("3 Hump EI"); break;
     case ftMotionShaper_MZV:   SERIAL_ECHOPGM("MZV");       break;
+    #if ENABLED(FTM_CUSTOM_SHAPER)
+      case ftMotionShaper_CUSTOM: SERIAL_ECHOPGM("Custom"); break;
+    #endif
   }
   sep = true;
 }
@@ -119,6 +122,10 @@ void say_shaping() {
       SERIAL_ECHOLNPGM(". Gain: ", ftMotion.cfg.linearAdvK);
     }
   #endif
+
+  #if ENABLED(FTM_BUDGET_REPORT)
+    if (ftMotion.cfg.active) ftMotion.report_budget();
+  #endif
 }
 
 void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
@@ -184,6 +191,7 @@ void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
  *       6: 2HEI  : 2-Hump Extra-Intensive
  *       7: 3HEI  : 3-Hump Extra-Intensive
  *       8: MZV   : Mass-based Zero Vibration
+ *       9: CUSTOM: Impulse table set with M495 (Requires FTM_CUSTOM_SHAPER)
  *
  *    P<bool> Enable (1) or Disable (0) Linear Advance pressure control
  *
@@ -251,6 +259,9 @@ void GcodeSuite::M493() {
           case ftMotionShaper_2HEI:
           case ftMotionShaper_3HEI:
           case ftMotionShaper_MZV:
+          #if ENABLED(FTM_CUSTOM_SHAPER)
+            case ftMotionShaper_CUSTOM:
+          #endif
             ftMotion.cfg.shaper[axis] = newsh;
             flag.update = flag.report = true;
             break;
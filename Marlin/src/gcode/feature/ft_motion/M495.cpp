@@ -0,0 +1,140 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FTM_CUSTOM_SHAPER)
+
+#include "../../gcode.h"
+#include "../../../module/ft_motion.h"
+
+// Impulses may span up to 2 periods of the base frequency, which fits in FTM_ZMAX
+#define FTM_CUSTOM_MAX_PERIODS 2.0f
+
+void GcodeSuite::M495_report(const bool forReplay/*=true*/) {
+  TERN_(MARLIN_SMALL_BUILD, return);
+
+  report_heading_etc(forReplay, F("FT Motion Custom Shaper"));
+  bool first = true;
+  auto report_table = [&](const ft_custom_shaper_t &c, const char axis_name) {
+    if (!first) report_echo_start(forReplay);
+    first = false;
+    SERIAL_ECHOLNPGM("  M495 ", C(axis_name), " N", c.count);
+    for (uint8_t i = 0; i < c.count; ++i) {
+      report_echo_start(forReplay);
+      SERIAL_ECHOLNPGM("  M495 ", C(axis_name), " I", i, " A", p_float_t(c.amp[i], 4), " T", p_float_t(c.time[i], 4));
+    }
+  };
+  #define _REPORT_TABLE(A) report_table(ftMotion.cfg.custom.A, CHARIFY(A));
+  SHAPED_MAP(_REPORT_TABLE);
+  #undef _REPORT_TABLE
+}
+
+// Apply N, I, A, and T to a copy of the table, and keep it only if valid
+static bool set_custom_shaper(ft_custom_shaper_t &table, const char axis_name) {
+  ft_custom_shaper_t c = table;
+
+  if (parser.seenval('N')) {
+    const int n = parser.value_int();
+    if (!WITHIN(n, 0, FTM_CUSTOM_IMPULSES)) {
+      SERIAL_ECHOLNPGM("?Invalid ", C(axis_name), " impulse count [N] value. (0-", FTM_CUSTOM_IMPULSES, ")");
+      return false;
+    }
+    // Added impulses start with no amplitude at the time of the last impulse
+    for (uint8_t i = c.count; i < n; ++i) {
+      c.amp[i] = 0.0f;
+      c.time[i] = i ? c.time[i - 1] : 0.0f;
+    }
+    c.count = n;
+  }
+
+  const bool seen_A = parser.seenval('A'), seen_T = parser.seenval('T');
+  if (seen_A || seen_T) {
+    const int i = parser.intval('I', -1);
+    if (!WITHIN(i, 0, int(c.count) - 1)) {
+      SERIAL_ECHOLNPGM("?Invalid ", C(axis_name), " impulse index [I] value.");
+      return false;
+    }
+    if (seen_A) c.amp[i] = parser.floatval('A');
+    if (seen_T) {
+      const float t = parser.floatval('T');
+      if (i && t < c.time[i - 1]) {
+        SERIAL_ECHOLNPGM("?", C(axis_name), " impulse times [T] must ascend.");
+        return false;
+      }
+      // Later impulses move up with this one so tables can be entered in order
+      c.time[i] = t;
+      for (uint8_t j = i + 1; j < c.count; ++j) NOLESS(c.time[j], t);
+    }
+  }
+
+  if (c.count && c.time[c.count - 1] - c.time[0] > FTM_CUSTOM_MAX_PERIODS) {
+    SERIAL_ECHOLNPGM("?", C(axis_name), " impulses must span no more than ", FTM_CUSTOM_MAX_PERIODS, " periods.");
+    return false;
+  }
+
+  table = c;
+  return true;
+}
+
+/**
+ * M495: Set / Report the impulse table for the FT Motion Custom shaper (M493 X9)
+ *
+ * Upload a shaper measured for this printer (e.g., with an accelerometer).
+ * Amplitudes are normalized to a sum of 1 and times are scaled by the axis
+ * base frequency (M493 A/B/C/W), so dynamic frequency modes still apply.
+ *
+ *    X/Y/Z/E   Axis to modify. At least one is required.
+ *    N<count>  Number of impulses (0-FTM_CUSTOM_IMPULSES). 0 disables shaping.
+ *    I<index>  Index of the impulse to set with A and/or T (0 to count-1)
+ *    A<amp>    Relative amplitude of the impulse
+ *    T<time>   Time of the impulse in periods of the base frequency (0 to 2).
+ *              Times ascend. Later impulses are moved up to at least this time.
+ *
+ * With no parameters report the impulse tables.
+ *
+ * Example: ZVD at the base frequency, with no damping
+ *    M495 X N3
+ *    M495 X I0 A1 T0
+ *    M495 X I1 A2 T0.5
+ *    M495 X I2 A1 T1
+ *    M493 X9
+ */
+void GcodeSuite::M495() {
+  if (!parser.seen_any()) return M495_report();
+
+  bool seen_axis = false, update = false;
+  #define _SET_TABLE(A) \
+    if (parser.seen_test(CHARIFY(A))) { \
+      seen_axis = true; \
+      if (set_custom_shaper(ftMotion.cfg.custom.A, CHARIFY(A))) update = true; \
+    }
+  SHAPED_MAP(_SET_TABLE);
+  #undef _SET_TABLE
+
+  if (!seen_axis)
+    SERIAL_ECHOLNPGM("?An axis is required.");
+
+  if (update) ftMotion.update_shaping_params();
+}
+
+#endif // FTM_CUSTOM_SHAPER
@@ -35,6 +35,7 @@ void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
     SERIAL_ECHOLNPGM("  M593 X"
       " F", stepper.get_shaping_frequency(X_AXIS),
       " D", stepper.get_shaping_damping_ratio(X_AXIS)
+      OPTARG(HAS_MULTI_IMPULSE_SHAPING, " T", int(stepper.get_shaping_type(X_AXIS)))
     );
   #endif
   #if ENABLED(INPUT_SHAPING_Y)
@@ -42,6 +43,7 @@ void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
     SERIAL_ECHOLNPGM("  M593 Y"
       " F", stepper.get_shaping_frequency(Y_AXIS),
       " D", stepper.get_shaping_damping_ratio(Y_AXIS)
+      OPTARG(HAS_MULTI_IMPULSE_SHAPING, " T", int(stepper.get_shaping_type(Y_AXIS)))
     );
   #endif
   #if ENABLED(INPUT_SHAPING_Z)
@@ -51,6 +53,17 @@ void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
     SERIAL_ECHOLNPGM("  M593 Z"
       " F", stepper.get_shaping_frequency(Z_AXIS),
       " D", stepper.get_shaping_damping_ratio(Z_AXIS)
+      OPTARG(HAS_MULTI_IMPULSE_SHAPING, " T", int(stepper.get_shaping_type(Z_AXIS)))
+    );
+  #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    #if ANY(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z)
+      report_echo_start(forReplay);
+    #endif
+    SERIAL_ECHOLNPGM("  M593 E"
+      " F", stepper.get_shaping_frequency(E_AXIS),
+      " D", stepper.get_shaping_damping_ratio(E_AXIS)
+      OPTARG(HAS_MULTI_IMPULSE_SHAPING, " T", int(stepper.get_shaping_type(E_AXIS)))
     );
   #endif
 }
@@ -59,9 +72,12 @@ void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
  * M593: Get or Set Input Shaping Parameters
  *  D<factor>    Set the zeta/damping factor. If axes (X, Y, etc.) are not specified, set for all axes.
  *  F<frequency> Set the frequency. If axes (X, Y, etc.) are not specified, set for all axes.
- *  T[map]       Input Shaping type, 0:ZV, 1:EI, 2:2H EI (not implemented yet)
+ *  T<type>      Set the shaper type (Requires SHAPING_MAX_IMPULSES > 2)
+ *                 0:ZV, 1:ZVD, 2:MZV, 3:EI, 4:ZVDD, 5:2HEI (4 and 5 require SHAPING_MAX_IMPULSES 4)
  *  X            Set the given parameters only for the X axis.
  *  Y            Set the given parameters only for the Y axis.
+ *  Z            Set the given parameters only for the Z axis.
+ *  E            Set the given parameters only for the extruder. (Requires INPUT_SHAPING_E)
  */
 void GcodeSuite::M593() {
   if (!parser.seen_any()) return M593_report();
@@ -69,9 +85,26 @@ void GcodeSuite::M593() {
   const bool seen_X = TERN0(INPUT_SHAPING_X, parser.seen_test('X')),
              seen_Y = TERN0(INPUT_SHAPING_Y, parser.seen_test('Y')),
              seen_Z = TERN0(INPUT_SHAPING_Z, parser.seen_test('Z')),
-             for_X = seen_X || TERN0(INPUT_SHAPING_X, (!seen_X && !seen_Y && !seen_Z)),
-             for_Y = seen_Y || TERN0(INPUT_SHAPING_Y, (!seen_X && !seen_Y && !seen_Z)),
-             for_Z = seen_Z || TERN0(INPUT_SHAPING_Z, (!seen_X && !seen_Y && !seen_Z));
+             seen_E = TERN0(INPUT_SHAPING_E, parser.seen_test('E')),
+             for_all = !seen_X && !seen_Y && !seen_Z && !seen_E,
+             for_X = seen_X || TERN0(INPUT_SHAPING_X, for_all),
+             for_Y = seen_Y || TERN0(INPUT_SHAPING_Y, for_all),
+             for_Z = seen_Z || TERN0(INPUT_SHAPING_Z, for_all),
+             for_E = seen_E || TERN0(INPUT_SHAPING_E, for_all);
+
+  #if HAS_MULTI_IMPULSE_SHAPING
+    if (parser.seen('T')) {
+      const uint8_t type = parser.value_byte();
+      if (type < SHAPING_TYPE_COUNT) {
+        if (for_X) stepper.set_shaping_type(X_AXIS, shaping_type_t(type));
+        if (for_Y) stepper.set_shaping_type(Y_AXIS, shaping_type_t(type));
+        if (for_Z) stepper.set_shaping_type(Z_AXIS, shaping_type_t(type));
+        if (for_E) stepper.set_shaping_type(E_AXIS, shaping_type_t(type));
+      }
+      else
+        SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Type (T) must be less than ", SHAPING_TYPE_COUNT));
+    }
+  #endif
 
   if (parser.seen('D')) {
     const float zeta = parser.value_float();
@@ -79,6 +112,7 @@ void GcodeSuite::M593() {
       if (for_X) stepper.set_shaping_damping_ratio(X_AXIS, zeta);
       if (for_Y) stepper.set_shaping_damping_ratio(Y_AXIS, zeta);
       if (for_Z) stepper.set_shaping_damping_ratio(Z_AXIS, zeta);
+      if (for_E) stepper.set_shaping_damping_ratio(E_AXIS, zeta);
     }
     else
       SERIAL_ECHO_MSG("?Zeta (D) value out of range (0-1)");
@@ -86,11 +120,12 @@ void GcodeSuite::M593() {
 
   if (parser.seen('F')) {
     const float freq = parser.value_float();
-    constexpr float min_freq = float(uint32_t(STEPPER_TIMER_RATE) / 2) / shaping_time_t(-2);
+    constexpr float min_freq = float(uint32_t(STEPPER_TIMER_RATE) / 2) * (SHAPING_MAX_ECHOES) / shaping_time_t(-2);
     if (freq == 0.0f || freq > min_freq) {
       if (for_X) stepper.set_shaping_frequency(X_AXIS, freq);
       if (for_Y) stepper.set_shaping_frequency(Y_AXIS, freq);
       if (for_Z) stepper.set_shaping_frequency(Z_AXIS, freq);
+      if (for_E) stepper.set_shaping_frequency(E_AXIS, freq);
     }
     else
       SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Frequency (F) must be greater than ", min_freq, " or 0 to disable"));
@@ -0,0 +1,123 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(RESONANCE_TUNING)
+
+#include "../../gcode.h"
+#include "../../../feature/accelerometer.h"
+#include "../../../feature/resonance.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+#include "../../../module/stepper.h"
+
+static void tune_axis(const AxisEnum axis, const ResonanceTuner::sweep_t &sweep, const bool apply, const bool verbose) {
+  const char axis_char = AXIS_CHAR(axis);
+
+  // Shaping would cancel the vibration being measured
+  const float old_freq = stepper.get_shaping_frequency(axis);
+  stepper.set_shaping_frequency(axis, 0);
+
+  resonance_t res;
+  const bool ok = resonance_tuner.measure(axis, sweep, res);
+  stepper.set_shaping_frequency(axis, old_freq);
+
+  if (!ok) {
+    if (!res.windows)
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("No accelerometer data for ", C(axis_char)));
+    else
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("No resonance found on ", C(axis_char)));
+    return;
+  }
+
+  if (verbose) resonance_tuner.report_spectrum();
+
+  SERIAL_ECHOLNPGM("Resonance ", C(axis_char), ": ", p_float_t(res.freq, 2), " Hz, damping ", p_float_t(res.zeta, 3),
+                   " (", res.windows, " windows, ", res.overruns, " overruns, sweep to ", p_float_t(res.max_freq, 1), " Hz)");
+  if (res.max_freq < sweep.freq_max)
+    SERIAL_ECHOLNPGM("Sweep stopped at the ", C(axis_char), " acceleration limit");
+
+  constexpr float min_freq = float(uint32_t(STEPPER_TIMER_RATE) / 2) * (SHAPING_MAX_ECHOES) / shaping_time_t(-2);
+  if (res.freq <= min_freq) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Frequency must be greater than ", min_freq));
+    return;
+  }
+
+  if (apply) {
+    stepper.set_shaping_frequency(axis, res.freq);
+    stepper.set_shaping_damping_ratio(axis, res.zeta);
+  }
+  SERIAL_ECHOLNPGM("  M593 ", C(axis_char), " F", p_float_t(res.freq, 2), " D", p_float_t(res.zeta, 3));
+}
+
+/**
+ * M958: Measure axis resonances with the accelerometer and set input shaping
+ *  X            Measure the X axis. With no axes given, measure each shaped axis.
+ *  Y            Measure the Y axis.
+ *  F<Hz>        Sweep start frequency. (Default RESONANCE_FREQ_MIN)
+ *  H<Hz>        Sweep end frequency. (Default RESONANCE_FREQ_MAX)
+ *  A<accel>     Acceleration per Hz, in mm/s² (Default RESONANCE_ACCEL_PER_HZ)
+ *  S<rate>      Sweep rate, in Hz per second (Default RESONANCE_SWEEP_RATE)
+ *  R            Report the result without setting M593
+ *  V            Print the spectrum
+ *
+ * Mount the sensor on the toolhead and move the head clear of the frame first.
+ * Save the result with M500.
+ */
+void GcodeSuite::M958() {
+  if (homing_needed_error()) return;
+
+  const ResonanceTuner::sweep_t sweep = {
+    parser.floatval('F', RESONANCE_FREQ_MIN),
+    parser.floatval('H', RESONANCE_FREQ_MAX),
+    parser.floatval('A', RESONANCE_ACCEL_PER_HZ),
+    parser.floatval('S', RESONANCE_SWEEP_RATE)
+  };
+  if (!(sweep.freq_min > 0 && sweep.freq_min < sweep.freq_max && sweep.freq_max < (ACCEL_RATE) / 2)) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Sweep (F, H) must be within 0-", (ACCEL_RATE) / 2, " Hz"));
+    return;
+  }
+  if (sweep.accel_per_hz <= 0 || sweep.hz_per_s <= 0) {
+    SERIAL_ECHOLNPGM(GCODE_ERR_MSG("Acceleration (A) and rate (S) must be positive"));
+    return;
+  }
+
+  const bool seen_X = TERN0(INPUT_SHAPING_X, parser.seen_test('X')),
+             seen_Y = TERN0(INPUT_SHAPING_Y, parser.seen_test('Y')),
+             for_all = !seen_X && !seen_Y,
+             apply = !parser.seen_test('R'),
+             verbose = parser.seen_test('V');
+
+  planner.synchronize();
+  KEEPALIVE_STATE(IN_HANDLER);
+
+  #if ENABLED(INPUT_SHAPING_X)
+    if (seen_X || for_all) tune_axis(X_AXIS, sweep, apply, verbose);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    if (seen_Y || for_all) tune_axis(Y_AXIS, sweep, apply, verbose);
+  #endif
+  UNUSED(for_all); UNUSED(apply); UNUSED(verbose);
+}
+
+#endif // RESONANCE_TUNING
@@ -97,8 +97,12 @@ void GcodeSuite::M125() {
 
   if (pause_print(retract, park_point, show_lcd, 0)) {
     if (ENABLED(HAS_DISPLAY) || ALL(EMERGENCY_PARSER, HOST_PROMPT_SUPPORT) || !sd_printing || show_lcd) {
-      wait_for_confirmation(false, 0);
-      resume_print(0, 0, -retract, 0);
+      #if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+        pause_wait_start(false, 0, 0, 0, -retract, 0);
+      #else
+        wait_for_confirmation(false, 0);
+        resume_print(0, 0, -retract, 0);
+      #endif
     }
   }
 }
@@ -165,17 +165,27 @@ void GcodeSuite::M600() {
 
   if (pause_print(retract, park_point, true, unload_length DXC_PASS)) {
     if (standardM600) {
-      wait_for_confirmation(true, beep_count DXC_PASS);
-      resume_print(
-        FILAMENT_CHANGE_SLOW_LOAD_LENGTH,
-        ABS(parser.axisunitsval('L', E_AXIS, fc_settings[active_extruder].load_length)),
-        ADVANCED_PAUSE_PURGE_LENGTH,
-        beep_count,
-        parser.celsiusval('R'),
-        true,
-        false
-        DXC_PASS
-      );
+      #if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+        // The main loop waits for the user and resumes
+        pause_wait_start(true, beep_count,
+          FILAMENT_CHANGE_SLOW_LOAD_LENGTH,
+          ABS(parser.axisunitsval('L', E_AXIS, fc_settings[active_extruder].load_length)),
+          ADVANCED_PAUSE_PURGE_LENGTH,
+          parser.celsiusval('R')
+        );
+      #else
+        wait_for_confirmation(true, beep_count DXC_PASS);
+        resume_print(
+          FILAMENT_CHANGE_SLOW_LOAD_LENGTH,
+          ABS(parser.axisunitsval('L', E_AXIS, fc_settings[active_extruder].load_length)),
+          ADVANCED_PAUSE_PURGE_LENGTH,
+          beep_count,
+          parser.celsiusval('R'),
+          true,
+          false
+          DXC_PASS
+        );
+      #endif
     }
     else {
       #if ENABLED(MMU_MENUS)
@@ -90,7 +90,7 @@ void GcodeSuite::M1000() {
       #else
         recovery.cancel();
       #endif
-      TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStopped());
+      TERN_(EXTENSIBLE_UI, ExtUI::queuePrintTimerStopped());
     }
     else
       recovery.resume();
@@ -73,6 +73,18 @@ GcodeSuite gcode;
   #include "../lcd/extui/ui_api.h" // for ExtUI::onLevelingDone
 #endif
 
+#if ENABLED(BINARY_MOVE_COMMANDS)
+  #include "../feature/binary_moves.h"
+#endif
+
+#if ENABLED(LOOP_LATENCY_MONITOR)
+  #include "../feature/loop_latency.h"
+#endif
+
+#if ENABLED(FWRETRACT_BLEND)
+  #include "../feature/fwretract.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -176,8 +188,10 @@ void GcodeSuite::get_destination_from_command() {
   LOOP_NUM_AXES(i) {
     if ( (seen[i] = parser.seenval(AXIS_CHAR(i))) ) {
       const float v = parser.value_axis_units((AxisEnum)i);
-      if (skip_move)
+      if (skip_move) {
         destination[i] = current_position[i];
+        TERN_(CANCEL_OBJECTS, cancelable.skip_position[i] = axis_is_relative(AxisEnum(i)) ? cancelable.skip_position[i] + v : LOGICAL_TO_NATIVE(v, i));
+      }
       else
         destination[i] = axis_is_relative(AxisEnum(i)) ? current_position[i] + v : LOGICAL_TO_NATIVE(v, i);
     }
@@ -201,6 +215,18 @@ void GcodeSuite::get_destination_from_command() {
       recovery.save();
   #endif
 
+  #if ENABLED(SD_LAYER_INDEX)
+    // Track layer changes in the file being printed
+    if (card.isStillPrinting()) {
+      if (seen.z) layerindex.z_move(destination.z, recovery.command_sdpos());
+      if (seen.e && (seen.x || seen.y) && destination.e > current_position.e) layerindex.extrude();
+    }
+  #endif
+
+  #if ENABLED(PRINTCOUNTER_JOB_STATS)
+    if (seen.z) print_job_timer.zMove(destination.z);   // For the job's layer count
+  #endif
+
   if (parser.floatval('F') > 0) {
     const float fr_mm_min = parser.value_linear_units();
     feedrate_mm_s = MMM_TO_MMS(fr_mm_min);
@@ -321,6 +347,8 @@ void GcodeSuite::dwell(const millis_t time) {
  * Process the parsed command and dispatch it to its handler
  */
 void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
+  TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(GCODE, parser.command_letter, parser.codenum));
+
   TERN_(HAS_FANCHECK, fan_check.check_deferred_error());
 
   KEEPALIVE_STATE(IN_HANDLER);
@@ -344,15 +372,24 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
     }
   #endif
 
+  const bool is_move = parser.command_letter == 'G' && parser.codenum <= 1;
+
+  // A move held for merging goes before anything but another G0/G1
+  TERN_(SEGMENT_MERGE, if (!is_move) flush_segment_merge());
+
+  // A held retract goes before anything but another G0/G1
+  TERN_(FWRETRACT_BLEND, if (!is_move) fwretract.flush_retract());
+
+  // Most of a print is G0/G1 so take them ahead of the full switch
+  if (is_move)                                                    // G0: Fast Move, G1: Linear Move
+    G0_G1(TERN_(HAS_FAST_MOVES, parser.codenum == 0));
+
   // Handle a known command or reply "unknown command"
 
-  switch (parser.command_letter) {
+  else switch (parser.command_letter) {
 
     case 'G': switch (parser.codenum) {
 
-      case 0: case 1:                                             // G0: Fast Move, G1: Linear Move
-        G0_G1(TERN_(HAS_FAST_MOVES, parser.codenum == 0)); break;
-
       #if ENABLED(ARC_SUPPORT)
         case 2: case 3: G2_G3(parser.codenum == 2); break;        // G2: CW ARC, G3: CCW ARC
       #endif
@@ -541,6 +578,10 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
           case 34: M34(); break;                                  // M34: Set SD card sorting options
         #endif
 
+        #if ENABLED(SD_READ_BENCHMARK)
+          case 35: M35(); break;                                  // M35: Measure the read speed of a file
+        #endif
+
         case 928: M928(); break;                                  // M928: Start SD write
       #endif // HAS_MEDIA
 
@@ -574,6 +615,10 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         case 100: M100(); break;                                  // M100: Free Memory Report
       #endif
 
+      #if ENABLED(MEMORY_MONITOR)
+        case 101: M101(); break;                                  // M101: RAM use and stack high-water mark
+      #endif
+
       #if ENABLED(BD_SENSOR)
         case 102: M102(); break;                                  // M102: Configure Bed Distance Sensor
       #endif
@@ -648,6 +693,10 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      #if ENABLED(BINARY_TELEMETRY)
+        case 156: M156(); break;                                  // M156: Set binary telemetry rate
+      #endif
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -760,6 +809,26 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         case 211: M211(); break;                                  // M211: Enable, Disable, and/or Report software endstops
       #endif
 
+      #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+        case 212: M212(); break;                                  // M212: Report planner look-ahead statistics
+      #endif
+
+      #if ENABLED(PLANNER_MONITOR)
+        case 213: M213(); break;                                  // M213: Report planner throughput and underruns
+      #endif
+
+      #if ENABLED(STEPPER_ISR_PROFILER)
+        case 214: M214(); break;                                  // M214: Report Stepper ISR phase timing
+      #endif
+
+      #if ENABLED(SELECTABLE_PROBE_ORDER)
+        case 215: M215(); break;                                  // M215: Set / Report the leveling grid probing order
+      #endif
+
+      #if ENABLED(PROBE_STATISTICS)
+        case 216: M216(); break;                                  // M216: Report probe statistics
+      #endif
+
       #if HAS_MULTI_EXTRUDER
         case 217: M217(); break;                                  // M217: Set filament swap parameters
       #endif
@@ -768,16 +837,52 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         case 218: M218(); break;                                  // M218: Set a tool offset
       #endif
 
+      #if ENABLED(OK_COALESCE)
+        case 219: M219(); break;                                  // M219: Set / Report coalesced "ok" responses
+      #endif
+
       case 220: M220(); break;                                    // M220: Set Feedrate Percentage: S<percent> ("FR" on your LCD)
 
       #if HAS_EXTRUDERS
         case 221: M221(); break;                                  // M221: Set Flow Percentage
       #endif
 
+      #if ENABLED(MARLIN_TEST_BUILD)
+        case 222: M222(); break;                                  // M222: Benchmark core kernels
+      #endif
+
+      #if ENABLED(IDLE_TASK_SCHEDULER)
+        case 223: M223(); break;                                  // M223: Report idle task run times
+      #endif
+
+      #if ENABLED(LOOP_LATENCY_MONITOR)
+        case 224: M224(); break;                                  // M224: Report main loop latency
+      #endif
+
+      #if ENABLED(BOOT_PROFILER)
+        case 225: M225(); break;                                  // M225: Report boot step times
+      #endif
+
       #if ENABLED(DIRECT_PIN_CONTROL)
         case 226: M226(); break;                                  // M226: Wait until a pin reaches a state
       #endif
 
+      #if ENABLED(BUFFER_ARENA)
+        case 227: M227(); break;                                  // M227: Set the planner blocks for the next boot
+      #endif
+
+      #if ENABLED(LAYER_TIME_FAN)
+        case 228: M228(); break;                                  // M228: Set the fan boost for short layers
+      #endif
+
+      #if ENABLED(SD_JOB_QUEUE)
+        case 229: M229(); break;                                  // M229: Media job queue
+      #endif
+
+      #if ENABLED(FLIGHT_RECORDER)
+        case 230: M230(); break;                                  // M230: Dump the flight recorder
+      #endif
+
       #if HAS_SERVOS
         case 280: M280(); break;                                  // M280: Set servo position absolute
         #if ENABLED(EDITABLE_SERVO_ANGLES)
@@ -930,6 +1035,9 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         #if ENABLED(FTM_SMOOTHING)
           case 494: M494(); break;                                // M494: Fixed-Time Motion extras
         #endif
+        #if ENABLED(FTM_CUSTOM_SHAPER)
+          case 495: M495(); break;                                // M495: Fixed-Time Motion Custom shaper
+        #endif
       #endif
 
       case 500: M500(); break;                                    // M500: Store settings in EEPROM
@@ -1123,6 +1231,14 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         case 951: M951(); break;                                  // M951: Set Magnetic Parking Extruder parameters
       #endif
 
+      #if ENABLED(RESONANCE_TUNING)
+        case 958: M958(); break;                                  // M958: Measure resonances and set input shaping
+      #endif
+
+      #if ENABLED(LIMITS_CALIBRATION)
+        case 959: M959(); break;                                  // M959: Calibrate max acceleration and feedrate
+      #endif
+
       #if ENABLED(Z_STEPPER_AUTO_ALIGN)
         case 422: M422(); break;                                  // M422: Set Z Stepper automatic alignment position using probe
       #endif
@@ -1216,6 +1332,22 @@ void GcodeSuite::process_next_command() {
 
   TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = queue.ring_buffer.index_r);
 
+  #if ENABLED(BINARY_MOVE_COMMANDS)
+    // Binary moves don't need the parser
+    if (BinaryMoves::is_move(command.buffer)) {
+      if (DEBUGGING(ECHO)) {
+        MString<MAX_CMD_SIZE> gcode_line;
+        BinaryMoves::to_gcode(command.buffer, gcode_line);
+        SERIAL_ECHO_START();
+        SERIAL_ECHOLN(&gcode_line);
+      }
+      KEEPALIVE_STATE(IN_HANDLER);
+      BinaryMoves::execute(command.buffer);
+      queue.ok_to_send();
+      return;
+    }
+  #endif
+
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
     SERIAL_ECHOLN(command.buffer);
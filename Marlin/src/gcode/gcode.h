@@ -96,7 +96,7 @@
  * M23  - Select SD file: "M23 /path/file.gco". (Requires SDSUPPORT)
  * M24  - Start/Resume SD print. (Requires SDSUPPORT)
  * M25  - Pause SD print. (Requires SDSUPPORT)
- * M26  - Set SD position in bytes: 'M26 S12345'. (Requires SDSUPPORT)
+ * M26  - Set SD position in bytes: 'M26 S12345'. Or a layer start: 'M26 L12'. (Requires SDSUPPORT. L requires SD_LAYER_INDEX)
  * M27  - Report SD print status. (Requires SDSUPPORT)
  *        OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *        OR, with 'C' get the current filename.
@@ -109,6 +109,7 @@
  *        The '#' is necessary when calling from within sd files, as it stops buffer prereading
  * M33  - Get the longname version of a path. (Requires LONG_FILENAME_HOST_SUPPORT)
  * M34  - Set SD Card sorting options. (Requires SDCARD_SORT_ALPHA)
+ * M35  - Measure the read speed of a file: "M35 /path/file.gco" (Requires SD_READ_BENCHMARK)
  *
  * M42  - Change pin status via G-code: M42 P<pin> S<value>. LED pin assumed if P is omitted. (Requires DIRECT_PIN_CONTROL)
  * M43  - Display pin status, watch pins for changes, watch endstops & toggle LED, Z servo probe test, toggle pins (Requires PINS_DEBUGGING)
@@ -133,6 +134,7 @@
  * M92  - Set planner.settings.axis_steps_per_mm for one or more axes. (Requires EDITABLE_STEPS_PER_UNIT)
  *
  * M100 - Watch Free Memory (for debugging) (Requires M100_FREE_MEMORY_WATCHER)
+ * M101 - Report RAM use and the stack high-water mark. R to repaint. (Requires MEMORY_MONITOR)
  *
  * M102 - Configure Bed Distance Sensor. (Requires BD_SENSOR)
  *
@@ -161,6 +163,7 @@
  *
  * M122 - Debug stepper (Requires *_DRIVER_TYPE TMC(2130|2160|5130|5160|2208|2209|2240|2660))
  * M123 - Report fan tachometers. (Requires En_FAN_TACHO_PIN) Optionally set auto-report interval. (Requires AUTO_REPORT_FANS)
+ *        Optionally set the auto fan target RPM. (Requires FAN_TACHO_TARGET_RPM)
  * M125 - Save current position and move to filament change position. (Requires PARK_HEAD_ON_PAUSE)
  *
  * M126 - Solenoid Air Valve Open. (Requires BARICUDA)
@@ -176,6 +179,7 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Send binary telemetry frames S<rate> times per second. (Requires BINARY_TELEMETRY)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -199,12 +203,26 @@
           Every normal extrude-only move will be classified as retract depending on the direction.
  * M210 - Set / Report the homing feedrate (Requires EDITABLE_HOMING_FEEDRATE)
  * M211 - Enable, Disable, and/or Report software endstops: S<0|1> (Requires MIN_SOFTWARE_ENDSTOPS or MAX_SOFTWARE_ENDSTOPS)
+ * M212 - Report planner look-ahead statistics. R to reset. (Requires PLANNER_LOOKAHEAD_STATS)
+ * M213 - Report planner throughput and underruns. S<seconds> auto-report interval. R to reset. (Requires PLANNER_MONITOR)
+ * M214 - Report Stepper ISR phase timing. R to reset. (Requires STEPPER_ISR_PROFILER)
+ * M215 - Set / Report the leveling grid probing order: S<order>. (Requires SELECTABLE_PROBE_ORDER)
+ * M216 - Report probe statistics of the leveling grid. R to reset. (Requires PROBE_STATISTICS)
  * M217 - Set filament swap parameters: 'M217 S<length> P<feedrate> R<feedrate>'. (Requires SINGLENOZZLE)
  * M218 - Set / Report a tool offset: 'M218 T<index> X<offset> Y<offset>'. (Requires 2 or more extruders)
+ * M219 - Set / Report coalesced "ok" responses for numbered lines: S<0|1>. (Requires OK_COALESCE)
  * M220 - Set Feedrate Percentage: 'M220 S<percent>' (i.e., "FR" on the LCD)
  *        Use 'M220 B' to back up the Feedrate Percentage and 'M220 R' to restore it. (Requires an MMU_MODEL version 2 or 2S)
  * M221 - Set Flow Percentage: 'M221 S<percent>' (Requires an extruder)
+ * M222 - Report CPU cycles per call of core kernels: C<count>. (Requires MARLIN_TEST_BUILD)
+ * M223 - Report idle task run times. R to reset. (Requires IDLE_TASK_SCHEDULER)
+ * M224 - Report main loop latency. R to reset. (Requires LOOP_LATENCY_MONITOR)
+ * M225 - Report the time taken by each step of setup(). (Requires BOOT_PROFILER)
  * M226 - Wait until a pin is in a given state: 'M226 P<pin> S<state>' (Requires DIRECT_PIN_CONTROL)
+ * M227 - Set the planner blocks used from the next boot: 'M227 B<blocks>' (Requires BUFFER_ARENA)
+ * M228 - Set the part cooling fan boost for short layers: 'M228 S<bool> L<fast s> H<slow s> P<speed>' (Requires LAYER_TIME_FAN)
+ * M229 - Start, stop or rewind the media job queue: 'M229 S<bool> R' (Requires SD_JOB_QUEUE)
+ * M230 - Dump the flight recorder to serial, or to media with 'M230 S'. R to reset. (Requires FLIGHT_RECORDER)
  * M240 - Trigger a camera to take a photograph. (Requires PHOTO_GCODE)
  * M250 - Set LCD contrast: 'M250 C<contrast>' (0-63). (Requires LCD support)
  * M255 - Set LCD sleep time: 'M255 S<minutes>' (0-99). (Requires an LCD with brightness or sleep/wake)
@@ -251,6 +269,7 @@
  * M485 - Send RS485 packets (Requires RS485_SERIAL_PORT)
  * M486 - Identify and cancel objects. (Requires CANCEL_OBJECTS)
  * M493 - Set / Report input FT Motion/Shaping parameters. (Requires FT_MOTION)
+ * M495 - Set / Report the FT Motion Custom shaper impulse table. (Requires FTM_CUSTOM_SHAPER)
  * M500 - Store parameters in EEPROM. (Requires EEPROM_SETTINGS)
  * M501 - Restore parameters from EEPROM. (Requires EEPROM_SETTINGS)
  * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
@@ -323,6 +342,8 @@
  * M920 - Set Homing Current. (Requires distinct *_CURRENT_HOME settings)
  * M936 - OTA update firmware. (Requires OTA_FIRMWARE_UPDATE)
  * M951 - Set Magnetic Parking Extruder parameters. (Requires MAGNETIC_PARKING_EXTRUDER)
+ * M958 - Measure resonances with an accelerometer and set input shaping. (Requires RESONANCE_TUNING)
+ * M959 - Find the highest safe acceleration and feedrate of X / Y. (Requires LIMITS_CALIBRATION)
  * M3426 - Read MCP3426 ADC over I2C. (Requires HAS_MCP3426_ADC)
  * M7219 - Control Max7219 Matrix LEDs. (Requires MAX7219_GCODE)
  *
@@ -705,6 +726,9 @@ private:
     #if ALL(SDCARD_SORT_ALPHA, SDSORT_GCODE)
       static void M34();
     #endif
+    #if ENABLED(SD_READ_BENCHMARK)
+      static void M35();
+    #endif
   #endif
 
   #if ENABLED(DIRECT_PIN_CONTROL)
@@ -757,6 +781,10 @@ private:
     static void M100();
   #endif
 
+  #if ENABLED(MEMORY_MONITOR)
+    static void M101();
+  #endif
+
   #if ENABLED(BD_SENSOR)
     static void M102();
   #endif
@@ -866,6 +894,10 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(BINARY_TELEMETRY)
+    static void M156();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -921,6 +953,26 @@ private:
     static void M211_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+    static void M212();
+  #endif
+
+  #if ENABLED(PLANNER_MONITOR)
+    static void M213();
+  #endif
+
+  #if ENABLED(STEPPER_ISR_PROFILER)
+    static void M214();
+  #endif
+
+  #if ENABLED(SELECTABLE_PROBE_ORDER)
+    static void M215();
+  #endif
+
+  #if ENABLED(PROBE_STATISTICS)
+    static void M216();
+  #endif
+
   #if HAS_MULTI_EXTRUDER
     static void M217();
     static void M217_report(const bool forReplay=true);
@@ -931,16 +983,53 @@ private:
     static void M218_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(OK_COALESCE)
+    static void M219();
+  #endif
+
   static void M220();
 
   #if HAS_EXTRUDERS
     static void M221();
   #endif
 
+  #if ENABLED(MARLIN_TEST_BUILD)
+    static void M222();
+  #endif
+
+  #if ENABLED(IDLE_TASK_SCHEDULER)
+    static void M223();
+  #endif
+
+  #if ENABLED(LOOP_LATENCY_MONITOR)
+    static void M224();
+  #endif
+
+  #if ENABLED(BOOT_PROFILER)
+    static void M225();
+  #endif
+
   #if ENABLED(DIRECT_PIN_CONTROL)
     static void M226();
   #endif
 
+  #if ENABLED(BUFFER_ARENA)
+    static void M227();
+    static void M227_report(const bool forReplay=true);
+  #endif
+
+  #if ENABLED(LAYER_TIME_FAN)
+    static void M228();
+  #endif
+
+  #if ENABLED(SD_JOB_QUEUE)
+    static void M229();
+  #endif
+
+  #if ENABLED(FLIGHT_RECORDER)
+    static void M230();
+  #endif
+
   #if ENABLED(PHOTO_GCODE)
     static void M240();
   #endif
@@ -1108,6 +1197,10 @@ private:
     static void M493_report(const bool forReplay=true);
     static void M494();
     static void M494_report(const bool forReplay=true);
+    #if ENABLED(FTM_CUSTOM_SHAPER)
+      static void M495();
+      static void M495_report(const bool forReplay=true);
+    #endif
   #endif
 
   static void M500();
@@ -1170,6 +1263,14 @@ private:
     static void M593_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(RESONANCE_TUNING)
+    static void M958();
+  #endif
+
+  #if ENABLED(LIMITS_CALIBRATION)
+    static void M959();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -35,6 +35,10 @@
   #include "../../feature/caselight.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING)
+  #include "../../feature/direct_stepping.h" // for the SP_* format numbers
+#endif
+
 #if !defined(MACHINE_UUID) && ENABLED(HAS_STM32_UID)
   #include "../../libs/hex_print.h"
 #endif
@@ -147,6 +151,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
+    // BINARY_TELEMETRY (M156)
+    cap_line(F("BINARY_TELEMETRY"), ENABLED(BINARY_TELEMETRY));
+
     // PROGRESS (M530 S L, M531 <file>, M532 X L)
     cap_line(F("PROGRESS"), false);
 
@@ -244,9 +251,32 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(F("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // BINARY_MOVES (0xFE move frames)
+    cap_line(F("BINARY_MOVES"), ENABLED(BINARY_MOVE_COMMANDS));
+
+    // CRC16_CHECKSUM ('^' line checksum)
+    cap_line(F("CRC16_CHECKSUM"), ENABLED(SERIAL_CRC16_CHECKSUM));
+
+    // SELECTIVE_RESEND (only the line in "Resend:" needs to be sent again)
+    cap_line(F("SELECTIVE_RESEND"), ENABLED(SERIAL_SELECTIVE_RESEND));
+
     // CONFIG_EXPORT
     cap_line(F("CONFIG_EXPORT"), ENABLED(CONFIGURATION_EMBEDDING));
 
+    // OK_COALESCE (M219) and the number of lines a host may send ahead of their "ok"
+    cap_line(F("OK_COALESCE"), ENABLED(OK_COALESCE));
+    #if ENABLED(OK_COALESCE)
+      SERIAL_ECHOLNPGM("Cap:OK_WINDOW:", BUFSIZE);
+    #endif
+
+    // DIRECT_STEPPING (G6) with the page pool and format a host must send
+    cap_line(F("DIRECT_STEPPING"), ENABLED(DIRECT_STEPPING));
+    #if ENABLED(DIRECT_STEPPING)
+      SERIAL_ECHOLNPGM("Cap:STEPPER_PAGES:", STEPPER_PAGES);
+      SERIAL_ECHOLNPGM("Cap:STEPPER_PAGE_FORMAT:", STEPPER_PAGE_FORMAT);
+      cap_line(F("DIRECT_STEPPING_RLE"), ENABLED(DIRECT_STEPPING_RLE));
+    #endif
+
     // Machine Geometry
     #if ENABLED(M115_GEOMETRY_REPORT)
       constexpr xyz_pos_t bmin{0},
@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "../gcode.h"
+#include "../../feature/telemetry.h"
+
+/**
+ * M156: Send binary telemetry frames
+ *
+ *  S<rate> - Frames per second, up to BINARY_TELEMETRY_MAX_RATE. S0 to stop.
+ *
+ * See feature/telemetry.h for the frame layout.
+ */
+void GcodeSuite::M156() {
+
+  if (parser.seenval('S')) {
+    const uint8_t rate = _MIN(parser.value_byte(), BINARY_TELEMETRY_MAX_RATE);
+    telemetry.auto_reporter.set_interval_ms(rate ? 1000 / rate : 0);
+  }
+
+}
+
+#endif // BINARY_TELEMETRY
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+
+#include "../gcode.h"
+#include "../../feature/isr_profiler.h"
+
+/**
+ * M214: Report Stepper ISR phase timing
+ *
+ *  R - Reset all phase statistics
+ *
+ * With no parameters report the time taken by each Stepper ISR phase.
+ */
+void GcodeSuite::M214() {
+  if (parser.seen_test('R'))
+    isr_profiler.reset();
+  else
+    isr_profiler.report();
+}
+
+#endif // STEPPER_ISR_PROFILER
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(OK_COALESCE)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M219: Set / Report coalesced "ok" responses for the port sending the command
+ *
+ * Parameters:
+ *   S<bool>  Acknowledge several numbered lines with one "ok N<line> P<planner> B<buffer> C<count>"
+ *
+ * Without parameters:
+ *   Report the current setting
+ */
+void GcodeSuite::M219() {
+  const serial_index_t port = queue.ring_buffer.command_port();
+  bool &coalesce_ok = queue.serial_state[port.index].coalesce_ok;
+  if (parser.seen('S'))
+    coalesce_ok = parser.value_bool();
+  else
+    SERIAL_ECHOLNPGM("Coalesced ok:", coalesce_ok, " Window:", BUFSIZE);
+}
+
+#endif // OK_COALESCE
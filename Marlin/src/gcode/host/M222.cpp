@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+#include "../../tests/marlin_tests.h"
+
+/**
+ * M222: Benchmark core kernels
+ *
+ *  C<count> - Calls of each kernel (default 1000)
+ *
+ * Wait for moves to finish, then report the average CPU cycles per call
+ * of the parser, thermistor, leveling, planner and formatting kernels.
+ */
+void GcodeSuite::M222() {
+  const uint16_t count = parser.ushortval('C', 1000);
+  if (!count) return;
+  planner.synchronize();
+  benchmarkKernels(count);
+}
+
+#endif // MARLIN_TEST_BUILD
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "../gcode.h"
+#include "../../feature/idle_tasks.h"
+
+/**
+ * M223: Report idle task run times
+ *
+ *  R - Reset all task statistics
+ *
+ * With no parameters report the runs and run time of each idle() task.
+ */
+void GcodeSuite::M223() {
+  if (parser.seen_test('R'))
+    idle_tasks.reset();
+  else
+    idle_tasks.report();
+}
+
+#endif // IDLE_TASK_SCHEDULER
@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(LOOP_LATENCY_MONITOR)
+
+#include "../gcode.h"
+#include "../../feature/loop_latency.h"
+
+/**
+ * M224: Report main loop latency
+ *
+ *  R - Reset all gap statistics
+ *
+ * With no parameters report the worst gaps between idle() calls and between
+ * command queue advances, their culprits and a histogram of recent gaps.
+ */
+void GcodeSuite::M224() {
+  if (parser.seen_test('R'))
+    loop_latency.reset();
+  else
+    loop_latency.report();
+}
+
+#endif // LOOP_LATENCY_MONITOR
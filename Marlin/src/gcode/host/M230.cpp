@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(FLIGHT_RECORDER)
+
+#include "../gcode.h"
+#include "../../feature/flight_recorder.h"
+
+/**
+ * M230: Dump the flight recorder
+ *
+ *  S - Save the events to FLIGHT.BIN on the media instead
+ *  R - Clear all events
+ *
+ * With no parameters print the events, oldest first, as hex records.
+ */
+void GcodeSuite::M230() {
+  if (parser.seen_test('R'))
+    flight_recorder.reset();
+  else if (parser.seen_test('S')) {
+    if (flight_recorder.save("FLIGHT.BIN"))
+      SERIAL_ECHOLNPGM("Flight recorder saved to FLIGHT.BIN");
+    else
+      SERIAL_ERROR_MSG("Flight recorder not saved");
+  }
+  else
+    flight_recorder.dump();
+}
+
+#endif // FLIGHT_RECORDER
@@ -25,12 +25,16 @@
 
 #include "../../MarlinCore.h"
 
-#if ALL(FWRETRACT, FWRETRACT_AUTORETRACT)
+#if ALL(FWRETRACT, FWRETRACT_AUTORETRACT) || ENABLED(FWRETRACT_BLEND)
   #include "../../feature/fwretract.h"
 #endif
 
 #include "../../sd/cardreader.h"
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../../feature/cancel_object.h"
+#endif
+
 #if ENABLED(NANODLP_Z_SYNC)
   #include "../../module/planner.h"
 #endif
@@ -76,31 +80,47 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
     }
   #endif
 
-  #if ALL(FWRETRACT, FWRETRACT_AUTORETRACT)
-
-    if (MIN_AUTORETRACT <= MAX_AUTORETRACT) {
-      // When M209 Autoretract is enabled, convert E-only moves to firmware retract/recover moves
-      if (fwretract.autoretract_enabled && parser.seen_test('E')
-        && !parser.seen(STR_AXES_MAIN)
-      ) {
-        const float echange = destination.e - current_position.e;
-        // Is this a retract or recover move?
-        if (WITHIN(ABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && fwretract.retracted[active_extruder] == (echange > 0.0)) {
-          current_position.e = destination.e;    // Hide a G1-based retract/recover from calculations
-          sync_plan_position_e();                // AND from the planner
-          fwretract.retract(echange < 0.0);      // Firmware-based retract/recover (double-retract ignored)
-          return;
+  #if ENABLED(CANCEL_OBJECTS)
+    const bool skip_move = cancelable.state.skipping;
+  #else
+    constexpr bool skip_move = false;
+  #endif
+
+  // A held G10 retract starts along with a travel
+  TERN_(FWRETRACT_BLEND, fwretract.start_retract_with_move(!skip_move));
+
+  if (skip_move) {
+    // A canceled object's move only follows E. M486 travels to where the skipped moves end.
+    current_position.e = destination.e;
+    sync_plan_position_e();
+  }
+  else {
+    #if ALL(FWRETRACT, FWRETRACT_AUTORETRACT)
+
+      if (MIN_AUTORETRACT <= MAX_AUTORETRACT) {
+        // When M209 Autoretract is enabled, convert E-only moves to firmware retract/recover moves
+        if (fwretract.autoretract_enabled && parser.seen_test('E')
+          && !parser.seen(STR_AXES_MAIN)
+        ) {
+          const float echange = destination.e - current_position.e;
+          // Is this a retract or recover move?
+          if (WITHIN(ABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && fwretract.retracted[active_extruder] == (echange > 0.0)) {
+            current_position.e = destination.e;    // Hide a G1-based retract/recover from calculations
+            sync_plan_position_e();                // AND from the planner
+            fwretract.retract(echange < 0.0);      // Firmware-based retract/recover (double-retract ignored)
+            return;
+          }
         }
       }
-    }
 
-  #endif // FWRETRACT
+    #endif // FWRETRACT
 
-  #if ANY(IS_SCARA, POLAR)
-    fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
-  #else
-    prepare_line_to_destination();
-  #endif
+    #if ANY(IS_SCARA, POLAR)
+      fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+    #else
+      prepare_line_to_destination();
+    #endif
+  }
 
   #ifdef G0_FEEDRATE
     // Restore the motion mode feedrate
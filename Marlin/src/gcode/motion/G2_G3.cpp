@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../../feature/cancel_object.h"
+#endif
+
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
   #define N_ARC_CORRECTION 1
@@ -36,11 +40,6 @@
 #ifndef MIN_CIRCLE_SEGMENTS
   #define MIN_CIRCLE_SEGMENTS 72  // 5° per segment
 #endif
-#if !defined(MAX_ARC_SEGMENT_MM) && defined(MIN_ARC_SEGMENT_MM)
-  #define MAX_ARC_SEGMENT_MM MIN_ARC_SEGMENT_MM
-#elif !defined(MIN_ARC_SEGMENT_MM) && defined(MAX_ARC_SEGMENT_MM)
-  #define MIN_ARC_SEGMENT_MM MAX_ARC_SEGMENT_MM
-#endif
 
 #define ARC_LIJKUVW_CODE(L,I,J,K,U,V,W)    CODE_N(SUB2(NUM_AXES),L,I,J,K,U,V,W)
 #define ARC_LIJKUVWE_CODE(L,I,J,K,U,V,W,E) ARC_LIJKUVW_CODE(L,I,J,K,U,V,W); CODE_ITEM_E(E)
@@ -216,7 +215,9 @@ void plan_arc(
 
   // Get the ideal segment length for the move based on settings
   const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+    #if ENABLED(ARC_ADAPTIVE_SEGMENTS)  // Length based on the chord tolerance
+      curve_segment_mm(radius, scaled_fr_mm_s)
+    #elif ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
       constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
     #else
       MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
@@ -315,6 +316,14 @@ void plan_arc(
                 limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
                 limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
 
+    #if ENABLED(HINTS_JUNCTION_SPEED)
+      // Every junction inside the arc has the same angle, so the planner can use one speed for all
+      const float arc_accel = TERN1(HAS_EXTRUDERS, NEAR_ZERO(travel_E)) ? planner.settings.travel_acceleration : planner.settings.acceleration,
+                  arc_junction_speed_sqr = _MIN(limiting_speed_sqr, arc_accel * radius);
+    #endif
+
+    TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+
     for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
 
       thermalManager.task();
@@ -375,6 +384,7 @@ void plan_arc(
         break;
 
       hints.curve_radius = radius;
+      TERN_(HINTS_JUNCTION_SPEED, hints.junction_speed_sqr = arc_junction_speed_sqr);
     }
   }
 
@@ -436,6 +446,16 @@ void GcodeSuite::G2_G3(const bool clockwise) {
 
   TERN_(SF_ARC_FIX, relative_mode = relative_mode_backup);
 
+  #if ENABLED(CANCEL_OBJECTS)
+    if (cancelable.state.skipping) {
+      // A canceled object's arc only follows E. M486 travels to where the skipped moves end.
+      current_position.e = destination.e;
+      sync_plan_position_e();
+      TERN_(FULL_REPORT_TO_HOST_FEATURE, set_and_report_grblstate(M_IDLE));
+      return;
+    }
+  #endif
+
   ab_float_t arc_offset = { 0, 0 };
   if (parser.seenval('R')) {
     const float r = parser.value_linear_units();
@@ -270,6 +270,11 @@ void GCodeParser::parse(char *p) {
 
   IF_DISABLED(FASTER_GCODE_PARSER, command_args = p); // Scan for parameters in seen()
 
+  // Plain moves take the short path
+  #if ENABLED(FAST_MOVE_PARSER)
+    if (command_letter == 'G' && codenum <= 1 && TERN1(USE_GCODE_SUBCODES, !subcode) && parse_move(p)) return;
+  #endif
+
   // Only use string_arg for these M codes
   if (letter == 'M') switch (codenum) {
     TERN_(EXPECTED_PRINTER_CHECK, case 16:)
@@ -370,6 +375,61 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(FAST_FLOAT_PARSER)
+
+  /**
+   * Parse a plain decimal number, [-+]?[0-9]*(.[0-9]*)?, with integer math.
+   * Parsing stops at the first other character, so 'E' and 'X' are never taken
+   * as an exponent or hex prefix. Up to 7 significant digits the result is the
+   * same as strtof. Beyond that it may be off by 1 ulp.
+   * Return false for more than 9 digits or 5 decimal places, to use strtof.
+   */
+  bool GCodeParser::decimal_value(const char *p, float &f) {
+    static constexpr float pow10[] = { 1, 10, 100, 1000, 10000, 100000 };
+    const bool neg = (*p == '-');
+    if (neg || *p == '+') ++p;
+    uint32_t m = 0;
+    uint8_t digits = 0, places = 0;
+    for (; NUMERIC(*p); ++p, ++digits) m = m * 10 + (*p - '0');
+    if (*p == '.')
+      for (++p; NUMERIC(*p); ++p, ++digits, ++places) m = m * 10 + (*p - '0');
+    if (digits > 9 || places > 5) return false;
+    f = float(m);
+    if (places) f /= pow10[places];
+    if (neg) f = -f;
+    return true;
+  }
+
+#endif
+
+#if ENABLED(FAST_MOVE_PARSER)
+
+  /**
+   * Set the parameters of a G0/G1 line with only axis and F parameters,
+   * each with a numeric value, as the full loop in parse() would.
+   * Return false for anything else, to use the full loop.
+   */
+  bool GCodeParser::parse_move(char *p) {
+    static constexpr uint32_t move_params = LOGICAL_AXIS_GANG(
+      _BV32(LETTER_BIT('E')) |, _BV32(LETTER_BIT('X')) |, _BV32(LETTER_BIT('Y')) |, _BV32(LETTER_BIT('Z')) |,
+      _BV32(LETTER_BIT(AXIS4_NAME)) |, _BV32(LETTER_BIT(AXIS5_NAME)) |, _BV32(LETTER_BIT(AXIS6_NAME)) |,
+      _BV32(LETTER_BIT(AXIS7_NAME)) |, _BV32(LETTER_BIT(AXIS8_NAME)) |, _BV32(LETTER_BIT(AXIS9_NAME)) |
+    ) _BV32(LETTER_BIT('F'));
+
+    while (const char param = *p++) {
+      if (!WITHIN(param, 'A', 'Z') || !TEST32(move_params, LETTER_BIT(param))) break;
+      while (*p == ' ') p++;
+      if (!valid_float(p)) break;
+      set(param, p);
+      while (DECIMAL_SIGNED(*p)) p++;
+      while (*p == ' ') p++;
+    }
+    if (p[-1]) { codebits = 0; return false; }  // Stopped early
+    return true;
+  }
+
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -253,9 +253,26 @@ public:
   // The value as a string
   static char* value_string() { return value_ptr; }
 
+  #if ENABLED(FAST_FLOAT_PARSER)
+    static bool decimal_value(const char *p, float &f);
+  #endif
+
+  #if ENABLED(FAST_MOVE_PARSER)
+    static bool parse_move(char *p);
+  #endif
+
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    #if ENABLED(FAST_FLOAT_PARSER)
+      float f;
+      if (decimal_value(value_ptr, f)) return f;
+    #endif
+    return value_float_strtof();
+  }
+
+  // The value as parsed by strtof. Requires a non-null value_ptr.
+  static float value_float_strtof() {
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
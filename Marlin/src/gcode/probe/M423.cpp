@@ -34,6 +34,7 @@
 
 /**
  * M423: Set a Z offset for X-Twist (added to the mesh on future G29).
+ *       With a bilinear or UBL mesh the current mesh is updated to match.
  *  M423 [R] [A<startx>] [I<interval>] [X<index> Z<offset>]
  *
  *    R         - Reset the twist compensation data
@@ -48,6 +49,11 @@ void GcodeSuite::M423() {
   bool do_report = true;
   float new_spacing = 0;
 
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    XATC::state_t before;
+    xatc.save_state(before);
+  #endif
+
   if (parser.seen_test('R')) {
     do_report = false;
     xatc.reset();
@@ -82,6 +88,9 @@ void GcodeSuite::M423() {
   }
 
   if (do_report) M423_report();
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    else xatc.fold_into_mesh(before);
+  #endif
 
 }
 
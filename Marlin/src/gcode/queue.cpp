@@ -43,6 +43,10 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(BINARY_MOVE_COMMANDS)
+  #include "../feature/binary_moves.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -51,6 +55,34 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+  #include "../feature/cancel_object.h"
+#endif
+
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+  #include "../feature/pause.h"
+#endif
+
+#if ENABLED(LOOP_LATENCY_MONITOR)
+  #include "../feature/loop_latency.h"
+#endif
+
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
+#if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+  #include "../feature/e_parser.h"
+#endif
+
+#if ENABLED(SERIAL_CRC16_CHECKSUM)
+  #include "../libs/crc16.h"
+#endif
+
+#if HAS_TOOLCHANGE_PREHEAT
+  #include "../module/tool_change.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -61,6 +93,10 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
   static millis_t last_command_time = 0;
 #endif
 
+#if ENABLED(OK_COALESCE)
+  GCodeQueue::CoalescedOk GCodeQueue::coalesced_ok;
+#endif
+
 /**
  * Track buffer underruns
  */
@@ -97,11 +133,42 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
  * Commit the accumulated G-code command to the ring buffer,
  * also setting its origin info.
  */
+#if ENABLED(PACKED_COMMAND_QUEUE)
+
+  /**
+   * Pool offset for the next command, with room for a line of MAX_CMD_SIZE.
+   * Return pool_size if there's no room.
+   */
+  uint16_t GCodeQueue::RingBuffer::write_offset() const {
+    if (!length) return 0;                        // Empty. Start over at the beginning.
+    const uint16_t r = commands[index_r].buffer - pool;
+    if (pool_w > r) {                             // Commands are in r...pool_w
+      if (pool_size - pool_w >= MAX_CMD_SIZE) return pool_w;
+      return r >= MAX_CMD_SIZE ? 0 : pool_size;   // Wrap around if there's room before r
+    }
+    return r - pool_w >= MAX_CMD_SIZE ? pool_w : pool_size;
+  }
+
+  uint8_t GCodeQueue::RingBuffer::stored_size(const char * const cmd) {
+    #if ENABLED(BINARY_MOVE_COMMANDS)
+      if (BinaryMoves::is_move(cmd)) return BinaryMoves::frame_size(cmd[2]);
+    #endif
+    return strlen(cmd) + 1;
+  }
+
+#endif
+
 void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    char * const cmd = write_buffer();
+    commands[index_w].buffer = cmd;
+    pool_w = (cmd - pool) + stored_size(cmd);
+  #endif
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  TERN_(SERIAL_PORT_FAIRNESS, if (serial_ind.within(0, NUM_SERIAL - 1)) ++port_length[serial_ind.index]);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_w();
 }
@@ -114,8 +181,8 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  if (*cmd == ';' || full()) return false;
+  strcpy(write_buffer(), cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
 }
@@ -255,6 +322,21 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(OK_COALESCE)
+    // Hold back the "ok" of a numbered line, or send the held one before this
+    CoalescedOk &co = coalesced_ok;
+    if (co.count && TERN0(HAS_MULTI_SERIAL, co.port.index != serial_ind.index)) flush_ok();
+    if (serial_state[TERN0(HAS_MULTI_SERIAL, serial_ind.index)].coalesce_ok && command.buffer[0] == 'N') {
+      if (!co.count++) {
+        co.since = millis();
+        TERN_(HAS_MULTI_SERIAL, co.port = serial_ind);
+      }
+      co.last_N = strtol(&command.buffer[1], nullptr, 10);
+      flush_ok(length <= 1); // Don't hold it if the host must send more to keep the queue going
+      return;
+    }
+    flush_ok();
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
@@ -268,11 +350,27 @@ void GCodeQueue::RingBuffer::ok_to_send() {
   SERIAL_EOL();
 }
 
+#if ENABLED(OK_COALESCE)
+
+  void GCodeQueue::flush_ok(const bool force/*=true*/) {
+    CoalescedOk &co = coalesced_ok;
+    if (!co.count) return;
+    if (!force && co.count < OK_COALESCE_LINES && PENDING(millis(), co.since + OK_COALESCE_MS)) return;
+    #if HAS_MULTI_SERIAL
+      PORT_REDIRECT(SERIAL_PORTMASK(co.port));
+    #endif
+    SERIAL_ECHOLNPGM_P(PSTR(STR_OK " N"), co.last_N, SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - ring_buffer.length, PSTR(" C"), co.count);
+    co.count = 0;
+  }
+
+#endif
+
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
  */
 void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
+  TERN_(OK_COALESCE, flush_ok());
   #if HAS_MULTI_SERIAL
     if (!serial_ind.valid()) return;              // Optimization here, skip if the command came from SD or Flash Drive
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
@@ -327,7 +425,11 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
   SERIAL_ECHOLN(ferr, serial_state[serial_ind.index].last_N);
-  while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
+  #if ENABLED(SERIAL_SELECTIVE_RESEND)
+    serial_state[serial_ind.index].resend_pending = true; // Keep the lines after it, to be held
+  #else
+    while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
+  #endif
   flush_and_request_resend(serial_ind);
   serial_state[serial_ind.index].count = 0;
 }
@@ -342,8 +444,9 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_BINARY 8
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -395,11 +498,39 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   }
 }
 
+#if ENABLED(SERIAL_SELECTIVE_RESEND)
+
+  /**
+   * Queue the held lines that follow the last line number while there's room,
+   * then request the next missing line if there are more held lines after it.
+   */
+  void GCodeQueue::release_held_lines(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+
+    // Drop lines that came in again the usual way
+    for (uint8_t s = 0; s < SERIAL_RESEND_WINDOW; ++s)
+      if (TEST(serial.held, s) && serial.hold_N[s] <= serial.last_N) CBI(serial.held, s);
+
+    while (serial.held && !ring_buffer.full()) {
+      const long n = serial.last_N + 1;
+      const uint8_t s = uint32_t(n) % (SERIAL_RESEND_WINDOW);
+      if (!TEST(serial.held, s) || serial.hold_N[s] != n) {
+        gcode_line_error(F(STR_ERR_LINE_NO), serial_ind);
+        break;
+      }
+      ring_buffer.enqueue(serial.hold[s], false OPTARG(HAS_MULTI_SERIAL, serial_ind));
+      CBI(serial.held, s);
+      serial.last_N = n;
+    }
+  }
+
+#endif
+
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -410,11 +541,121 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(SERIAL_LINE_CHECK)
+
+  /**
+   * Add a character just stored at buff[ind] to the line number and checksums.
+   * The first character of a line starts them over.
+   */
+  inline void line_check_char(GCodeQueue::SerialState::LineCheck &lc, const char c, const int ind) {
+    if (ind == 0) {
+      lc.valid = true;
+      lc.M110 = false;
+      lc.lead = lc.n_state = 0;
+      lc.N = 0;
+      lc.tail = 0;
+      lc.sum = lc.star_sum = 0;
+      lc.star = -1;
+      #if ENABLED(SERIAL_CRC16_CHECKSUM)
+        lc.crc = lc.caret_crc = 0;
+        lc.caret = -1;
+      #endif
+    }
+
+    if (lc.n_state == 0) {
+      if (c == ' ') { lc.lead++; return; }                    // Leading spaces are skipped
+      lc.n_state = (c == 'N') ? 1 : 4;
+    }
+    else if (lc.n_state < 3) {
+      if (NUMERIC(c)) { lc.N = lc.N * 10 + (c - '0'); lc.n_state = 2; }
+      else lc.n_state = (lc.n_state == 2) ? 3 : 4;            // A sign or a space is left to strtol
+    }
+
+    lc.tail = (lc.tail << 8) | uint8_t(c);
+    if (lc.tail == (uint32_t('M') << 24 | uint32_t('1') << 16 | uint32_t('1') << 8 | uint32_t('0'))) lc.M110 = true;
+
+    if (c == '*') { lc.star = ind; lc.star_sum = lc.sum; }
+    lc.sum ^= c;
+
+    #if ENABLED(SERIAL_CRC16_CHECKSUM)
+      if (c == '^') { lc.caret = ind; lc.caret_crc = lc.crc; }
+      crc16(&lc.crc, &c, 1);
+    #endif
+  }
+
+#endif
+
+#if ENABLED(BINARY_MOVE_COMMANDS)
+
+  /**
+   * Check a complete binary move frame in the line buffer and add it to the queue.
+   * The frame's line number is the low 16 bits of the expected G-code line number.
+   * Return false if a resend was requested.
+   */
+  bool GCodeQueue::enqueue_binary_move(const serial_index_t p) {
+    SerialState &serial = serial_state[p.index];
+    const uint8_t * const frame = (uint8_t*)serial.line_buffer;
+
+    if (!BinaryMoves::valid(frame)) {
+      gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+      return false;
+    }
+
+    const uint16_t frame_N = BinaryMoves::line_number(frame);
+    if (frame_N != uint16_t(serial.last_N + 1)) {
+      // A request-for-resend frame was already in transit so we got two - oops!
+      if (frame_N == uint16_t(serial.last_N) || frame_N == uint16_t(serial.last_N - 1)) return true;
+      gcode_line_error(F(STR_ERR_LINE_NO), p);
+      return false;
+    }
+    serial.last_N++;
+    TERN_(SERIAL_SELECTIVE_RESEND, serial.resend_pending = false);
+
+    if (IsStopped()) {
+      PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+      SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+      LCD_MESSAGE(MSG_STOPPED);
+    }
+
+    // Add the frame to the queue as-is. It is executed by BinaryMoves::execute.
+    memcpy(ring_buffer.write_buffer(), frame, BinaryMoves::frame_size(frame[2]));
+    ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+    return true;
+  }
+
+#endif // BINARY_MOVE_COMMANDS
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
  * left on the serial port.
  */
+#if ENABLED(SERIAL_PORT_FAIRNESS)
+
+  /**
+   * The host sending numbered lines (usually the one printing) gets priority and may
+   * fill the whole queue. Other ports may only have SERIAL_PORT_QUEUE_QUOTA commands
+   * queued at a time, and the rest of their input waits in their receive buffers.
+   * Priority passes to another host once the first has been quiet for a while.
+   */
+  static serial_index_t priority_port;
+  static millis_t priority_ms;
+
+  static void claim_priority(const uint8_t p) {
+    const millis_t ms = millis();
+    if (priority_port.index == p || !priority_port.valid() || ELAPSED(ms, priority_ms, SERIAL_PRIORITY_TIMEOUT)) {
+      priority_port = p;
+      priority_ms = ms;
+    }
+  }
+
+  inline bool over_quota(const uint8_t p) {
+    return priority_port.valid() && priority_port.index != p
+        && GCodeQueue::ring_buffer.port_length[p] >= (SERIAL_PORT_QUEUE_QUOTA);
+  }
+
+#endif
+
 void GCodeQueue::get_serial_commands() {
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
@@ -443,10 +684,30 @@ void GCodeQueue::get_serial_commands() {
     // Unless a serial port has data, this will exit on next iteration
     hadData = false;
 
-    for (uint8_t p = 0; p < NUM_SERIAL; ++p) {
+    // Take turns at being first to get a free slot
+    #if ENABLED(SERIAL_PORT_FAIRNESS)
+      static uint8_t first_port = 0;
+      const uint8_t first = first_port;
+      if (++first_port >= NUM_SERIAL) first_port = 0;
+    #endif
+
+    for (uint8_t i = 0; i < NUM_SERIAL; ++i) {
+      const uint8_t p = TERN(SERIAL_PORT_FAIRNESS, (first + i) % (NUM_SERIAL), i);
+
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      // A port with its share of the queue waits for the priority host
+      TERN_(SERIAL_PORT_FAIRNESS, if (over_quota(p)) continue);
+
+      #if ENABLED(SERIAL_SELECTIVE_RESEND)
+        // Queue the held lines once the missing one is in
+        if (serial_state[p].held && !serial_state[p].resend_pending) {
+          release_held_lines(p);
+          if (ring_buffer.full()) return;
+        }
+      #endif
+
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
@@ -467,6 +728,27 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      #if ENABLED(BINARY_MOVE_COMMANDS)
+        // Collect a binary move frame, which can only start a line
+        if (serial.input_state == PS_BINARY || (!serial.count && uint8_t(serial_char) == BinaryMoves::SYNC)) {
+          serial.input_state = PS_BINARY;
+          serial.line_buffer[serial.count++] = serial_char;
+          if (serial.count < BinaryMoves::HEADER_SIZE || serial.count < BinaryMoves::frame_size(serial.line_buffer[2])) continue;
+          serial.input_state = PS_NORMAL;
+          serial.count = 0;
+          #if NO_TIMEOUTS > 0
+            last_command_time = ms;
+          #endif
+          if (!enqueue_binary_move(p)) break;
+          continue;
+        }
+      #endif
+
+      #if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+        // Realtime commands between lines were handled by the emergency parser
+        if (!serial.count && EmergencyParser::is_realtime_command(serial_char)) continue;
+      #endif
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
@@ -480,29 +762,76 @@ void GCodeQueue::get_serial_commands() {
 
         if (npos) {
 
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
+          #if ENABLED(SERIAL_LINE_CHECK)
+            // Use the values gathered as the line came in, unless M110 may give another line number
+            const SerialState::LineCheck &lc = serial.check;
+            const bool fast = lc.valid && !lc.M110 && WITHIN(lc.n_state, 2, 3);
+          #else
+            constexpr bool fast = false;
+          #endif
+
+          const bool M110 = !fast && !!strstr_P(command, PSTR("M110"));
 
           if (M110) {
             char* n2pos = strchr(command + 4, 'N');
             if (n2pos) npos = n2pos;
           }
 
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
+          #if ENABLED(SERIAL_LINE_CHECK)
+            const long gcode_N = fast ? lc.N : strtol(npos + 1, nullptr, 10);
+          #else
+            const long gcode_N = strtol(npos + 1, nullptr, 10);
+          #endif
+
+          #if ENABLED(SERIAL_SELECTIVE_RESEND)
+            // A line soon after a missing one is held, if its checksum is good
+            const bool hold = !M110 && WITHIN(gcode_N, serial.last_N + 2, serial.last_N + 1 + (SERIAL_RESEND_WINDOW));
+            // Bad lines are dropped while waiting for the missing line, unless they may be that line
+            #define LINE_ERROR_DROP() (serial.resend_pending && gcode_N != serial.last_N + 1)
+          #else
+            constexpr bool hold = false;
+            #define LINE_ERROR_DROP() false
+          #endif
 
           // The line number must be in the correct sequence.
-          if (gcode_N != serial.last_N + 1 && !M110) {
+          if (gcode_N != serial.last_N + 1 && !M110 && !hold) {
             // A request-for-resend line was already in transit so we got two - oops!
-            if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+            // With SERIAL_SELECTIVE_RESEND a host going back to the missing line also resends held lines.
+            if (WITHIN(gcode_N, serial.last_N - 1 - TERN0(SERIAL_SELECTIVE_RESEND, SERIAL_RESEND_WINDOW), serial.last_N)) continue;
             // A corrupted line or too high, indicating a lost line
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
           }
 
-          char *apos = strrchr(command, '*');
+          #if ENABLED(SERIAL_LINE_CHECK)
+            char *apos = fast ? (lc.star >= 0 ? serial.line_buffer + lc.star : nullptr) : strrchr(command, '*');
+          #else
+            char *apos = strrchr(command, '*');
+          #endif
+
+          #if ENABLED(SERIAL_CRC16_CHECKSUM)
+            // A '^' after the last '*' gives the CRC16 of the line before it
+            char *cpos = fast ? (lc.caret >= 0 ? serial.line_buffer + lc.caret : nullptr) : strrchr(command, '^');
+            if (cpos > apos) {
+              uint16_t crc = 0;
+              if (fast) crc = lc.caret_crc; else crc16(&crc, command, uint16_t(cpos - command));
+              if (strtol(cpos + 1, nullptr, 10) != crc) {
+                if (LINE_ERROR_DROP()) continue;
+                gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+                break;
+              }
+              *cpos = '*';  // The parser drops the rest of the line
+            }
+            else
+          #endif
           if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
+            uint8_t checksum = 0;
+            #if ENABLED(SERIAL_LINE_CHECK)
+              if (fast) checksum = lc.star_sum; else
+            #endif
+            for (uint8_t count = uint8_t(apos - command); count;) checksum ^= command[--count];
             if (strtol(apos + 1, nullptr, 10) != checksum) {
+              if (LINE_ERROR_DROP()) continue;
               gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
               break;
             }
@@ -512,7 +841,24 @@ void GCodeQueue::get_serial_commands() {
             break;
           }
 
+          #undef LINE_ERROR_DROP
+
+          #if ENABLED(SERIAL_SELECTIVE_RESEND)
+            if (hold) {
+              // Keep the line for when the missing one comes in, and ask for that
+              const uint8_t s = uint32_t(gcode_N) % (SERIAL_RESEND_WINDOW);
+              strcpy(serial.hold[s], serial.line_buffer);
+              serial.hold_N[s] = gcode_N;
+              SBI(serial.held, s);
+              if (!serial.resend_pending) gcode_line_error(F(STR_ERR_LINE_NO), p);
+              continue;
+            }
+            if (M110) serial.held = 0;          // Held lines belong to the old numbering
+            serial.resend_pending = false;
+          #endif
+
           serial.last_N = gcode_N;
+          TERN_(SERIAL_PORT_FAIRNESS, claim_priority(p));
         }
         #if HAS_MEDIA
           // Pronterface "M29" and "M29 " has no line number
@@ -564,8 +910,16 @@ void GCodeQueue::get_serial_commands() {
         // Add the command to the queue
         ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
       }
-      else
+      else {
+        #if ENABLED(SERIAL_LINE_CHECK)
+          const int ind = serial.count;
+        #endif
         process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        #if ENABLED(SERIAL_LINE_CHECK)
+          if (serial.count > ind) line_check_char(serial.check, serial_char, ind);
+          else if (serial.count < ind) serial.check.valid = false;  // Backspace
+        #endif
+      }
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -581,32 +935,71 @@ void GCodeQueue::get_serial_commands() {
    */
   inline void GCodeQueue::get_sdcard_commands() {
     static uint8_t sd_input_state = PS_NORMAL;
+    #if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+      static uint32_t sd_line_start;  // Where the line being read begins
+    #endif
 
     // Get commands if there are more in the file
     if (!card.isStillFetching()) return;
 
+    #if HAS_REPEAT_CACHE
+      // Replay a cached loop body before reading more of the file
+      while (repeat.replaying() && !ring_buffer.full()) {
+        char * const buffer = ring_buffer.write_buffer();
+        const uint32_t sdpos = repeat.next_cached_line(buffer);
+        repeat.early_parse_M808(buffer);
+        #if DISABLED(PARK_HEAD_ON_PAUSE)
+          if (buffer[0] == 'M' && buffer[1] == '2' && buffer[2] == '5' && !NUMERIC(buffer[3]))
+            card.pauseSDPrint();
+        #endif
+        ring_buffer.commit_command(true);
+        TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = sdpos);
+        UNUSED(sdpos);
+        if (!repeat.replaying() && card.eof()) card.fileHasFinished();  // The loop ended the file
+        if (!card.isStillFetching()) return;
+      }
+    #endif
+
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+      if (n < 0 && !card_eof) {
+        if (!card.isStillFetching()) break;           // A decoding error aborted the print
+        SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue;
+      }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+      char * const buffer = ring_buffer.write_buffer();
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        bool commit = !process_line_done(sd_input_state, buffer, sd_count);
+
+        #if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+          if (commit) {
+            if (cancelable.sd_skip_line(buffer))
+              commit = false;                     // A move of a canceled object
+            else if (cancelable.sd_pending_move(buffer))
+              card.setIndex(sd_line_start);       // Queue the dropped moves' E and F, then read this line again
+          }
+          sd_line_start = card.getIndex();
+        #endif
+
+        if (commit) {
+
+          // Lines after 'M808 L' are kept to replay the loop from RAM
+          TERN_(HAS_REPEAT_CACHE, repeat.cache_line(buffer, card.getIndex()));
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(buffer));
 
           #if DISABLED(PARK_HEAD_ON_PAUSE)
             // When M25 is non-blocking it can still suspend SD commands
             // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
+            if (buffer[0] == 'M' && buffer[1] == '2' && buffer[2] == '5' && !NUMERIC(buffer[3]))
               card.pauseSDPrint();
           #endif
 
@@ -617,10 +1010,14 @@ void GCodeQueue::get_serial_commands() {
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
 
+        #if HAS_REPEAT_CACHE
+          if (repeat.replaying()) break;                // Loop back in RAM, which may be past the end of the file
+        #endif
+
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+        process_stream_char(sd_char, sd_input_state, buffer, sd_count);
     }
   }
 
@@ -653,6 +1050,8 @@ void GCodeQueue::exhaust() {
  */
 void GCodeQueue::advance() {
 
+  TERN_(LOOP_LATENCY_MONITOR, loop_latency.tick(LATENCY_ADVANCE));
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
@@ -676,10 +1075,27 @@ void GCodeQueue::advance() {
     }
   #endif
 
+  // Heat the next tool ahead of its tool-change
+  TERN_(HAS_TOOLCHANGE_PREHEAT, toolchange_preheat_lookahead());
+
+  #if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+    // Hold moves in the queue while the main loop waits for the user to resume
+    if (pause_wait_active() && TERN1(HAS_MEDIA, !card.flag.saving)) {
+      const char * const cmd = ring_buffer.peek_next_command_string();
+      if (TERN0(BINARY_MOVE_COMMANDS, BinaryMoves::is_move(cmd)) || pause_wait_holds(cmd)) return;
+    }
+  #endif
+
+  TERN_(FLIGHT_RECORDER, flight_recorder.record(FR_COMMAND, ring_buffer.length));
+
   #if HAS_MEDIA
 
     if (card.flag.saving) {
-      char * const cmd = ring_buffer.peek_next_command_string();
+      char * cmd = ring_buffer.peek_next_command_string();
+      #if ENABLED(BINARY_MOVE_COMMANDS)
+        MString<MAX_CMD_SIZE> gcode_line;
+        if (BinaryMoves::is_move(cmd)) { BinaryMoves::to_gcode(cmd, gcode_line); cmd = &gcode_line; }
+      #endif
       if (is_M29(cmd)) {
         // M29 closes the file
         card.closefile();
@@ -43,6 +43,35 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(OK_COALESCE)
+      bool coalesce_ok;             //!< Acknowledge several numbered lines with one "ok" (M219)
+    #endif
+    #if ENABLED(SERIAL_LINE_CHECK)
+      /**
+       * The line number and checksums of the current line, gathered as each
+       * character is stored so the completed line isn't scanned again.
+       */
+      struct LineCheck {
+        bool valid;                 //!< Cleared when a backspace makes the sums unreliable
+        bool M110;                  //!< The line contains "M110"
+        uint8_t lead;               //!< Leading spaces, not part of the sums
+        uint8_t n_state;            //!< 0: Expect 'N', 1: After 'N', 2: In the number, 3: After it, 4: No number
+        long N;                     //!< The line number
+        uint32_t tail;              //!< The last four characters, to find "M110"
+        uint8_t sum, star_sum;      //!< XOR of all characters and of those before the last '*'
+        int star;                   //!< Index of the last '*', or -1
+        #if ENABLED(SERIAL_CRC16_CHECKSUM)
+          uint16_t crc, caret_crc;  //!< CRC16 of all characters and of those before the last '^'
+          int caret;                //!< Index of the last '^', or -1
+        #endif
+      } check;
+    #endif
+    #if ENABLED(SERIAL_SELECTIVE_RESEND)
+      bool resend_pending;                      //!< A resend of line last_N + 1 was requested
+      uint8_t held;                             //!< Bits of the hold slots in use
+      long hold_N[SERIAL_RESEND_WINDOW];        //!< Line numbers of the held lines
+      char hold[SERIAL_RESEND_WINDOW][MAX_CMD_SIZE]; //!< Good lines received after a missing one
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -50,6 +79,8 @@ public:
   /**
    * G-Code Command Queue
    * A simple (circular) ring buffer of BUFSIZE command strings.
+   * With PACKED_COMMAND_QUEUE the strings share a pool of COMMAND_POOL_SIZE bytes.
+   * With BUFFER_ARENA the pool also gets the planner blocks not used.
    *
    * Commands are copied into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
@@ -57,7 +88,11 @@ public:
    * command and hands off execution to individual handler functions.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(PACKED_COMMAND_QUEUE)
+      char *buffer;                 //!< The command, stored in the ring buffer's pool
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
@@ -73,13 +108,50 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(SERIAL_PORT_FAIRNESS)
+      uint8_t port_length[NUM_SERIAL]; //!< Number of commands in the queue from each serial port
+    #endif
+
+    #if ENABLED(PACKED_COMMAND_QUEUE)
+      /**
+       * With PACKED_COMMAND_QUEUE the command strings are stored end-to-end in
+       * a shared pool, each one using only its length + 1 bytes. A command never
+       * wraps around the end of the pool so it can be handed to the parser as-is.
+       */
+      uint16_t pool_w;                //!< Pool offset just past the newest command
+      #if ENABLED(BUFFER_ARENA)
+        char *pool;                   //!< The command strings, in the planner's unused blocks
+        uint16_t pool_size;           //!< Set by Planner::apply_arena() at boot
+      #else
+        char pool[COMMAND_POOL_SIZE]; //!< The command strings
+        static constexpr uint16_t pool_size = COMMAND_POOL_SIZE;
+      #endif
+
+      uint16_t write_offset() const;
+
+      // Pool space used by a command string or binary move frame
+      static uint8_t stored_size(const char * const cmd);
+
+      // Where to write the next command. Only valid if the buffer isn't full.
+      inline char* write_buffer() { return &pool[write_offset()]; }
+    #else
+      inline char* write_buffer() { return commands[index_w].buffer; }
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() { length = index_r = index_w = 0; TERN_(SERIAL_PORT_FAIRNESS, ZERO(port_length)); }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
     inline void advance_w() { advance_pos(index_w, 1); }
-    inline void advance_r() { if (length) advance_pos(index_r, -1); }
+    inline void advance_r() {
+      if (!length) return;
+      #if ENABLED(SERIAL_PORT_FAIRNESS)
+        const serial_index_t p = commands[index_r].port;
+        if (p.within(0, NUM_SERIAL - 1)) --port_length[p.index];
+      #endif
+      advance_pos(index_r, -1);
+    }
 
     void commit_command(const bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
@@ -91,7 +163,9 @@ public:
 
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    inline bool full(uint8_t cmdCount=1) const {
+      return length > (BUFSIZE - cmdCount) || TERN0(PACKED_COMMAND_QUEUE, write_offset() >= pool_size);
+    }
 
     inline bool occupied() const { return length != 0; }
 
@@ -202,6 +276,30 @@ public:
    */
   static void ok_to_send() { ring_buffer.ok_to_send(); }
 
+  #if ENABLED(OK_COALESCE)
+    /**
+     * Send the "ok" held back for the lines acknowledged so far:
+     *   N<int>  Line number of the last command acknowledged
+     *   P<int>  Planner space remaining
+     *   B<int>  Block queue space remaining
+     *   C<int>  Number of commands acknowledged
+     * Unless forced, wait for OK_COALESCE_LINES lines or OK_COALESCE_MS.
+     */
+    static void flush_ok(const bool force=true);
+
+  private:
+    static struct CoalescedOk {
+      uint8_t count;
+      long last_N;
+      millis_t since;
+      #if HAS_MULTI_SERIAL
+        serial_index_t port;
+      #endif
+    } coalesced_ok;
+
+  public:
+  #endif
+
   /**
    * Clear the serial line and request a resend of
    * the next expected line number.
@@ -280,6 +378,14 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  #if ENABLED(BINARY_MOVE_COMMANDS)
+    static bool enqueue_binary_move(const serial_index_t serial_ind);
+  #endif
+
+  #if ENABLED(SERIAL_SELECTIVE_RESEND)
+    static void release_held_lines(const serial_index_t serial_ind);
+  #endif
+
   friend class GcodeSuite;
 };
 
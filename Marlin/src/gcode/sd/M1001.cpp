@@ -63,6 +63,10 @@
   #include "../../lcd/sovol_rts/sovol_rts.h"
 #endif
 
+#if ENABLED(SD_JOB_QUEUE)
+  #include "../../feature/job_queue.h"
+#endif
+
 /**
  * M1001: Execute actions for SD print completion
  */
@@ -122,6 +126,9 @@ void GcodeSuite::M1001() {
     rts.sendData(0, PRINT_SURPLUS_TIME_MIN_VP); delay(1);
     rts.gotoPage(ID_Finish_L, ID_Finish_D);
   #endif
+
+  // Clear the bed and start the next queued job, if any
+  TERN_(SD_JOB_QUEUE, jobqueue.job_finished());
 }
 
 #endif // HAS_MEDIA
@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_JOB_QUEUE)
+
+#include "../gcode.h"
+#include "../../feature/job_queue.h"
+
+/**
+ * M229: Media job queue
+ *
+ *  S1 - Start the jobs in QUEUE.TXT from the current position
+ *  S0 - Stop the queue when the current job is done
+ *  R  - Go back to the first job
+ *
+ * With no parameters report the queue state.
+ */
+void GcodeSuite::M229() {
+  if (!parser.seen("SR")) return jobqueue.report();
+  if (parser.seen('R')) jobqueue.rewind();
+  if (parser.seen('S')) {
+    if (parser.value_bool()) jobqueue.start(); else jobqueue.stop();
+  }
+}
+
+#endif // SD_JOB_QUEUE
@@ -34,9 +34,22 @@
  *
  * Parameters:
  *   S<pos>  Next file read position to set
+ *
+ *   With SD_LAYER_INDEX:
+ *     L<layer>  Continue from the start of a layer, if it has been indexed
  */
 void GcodeSuite::M26() {
-  if (card.isMounted() && parser.seenval('S'))
+  if (!card.isMounted()) return;
+
+  #if ENABLED(SD_LAYER_INDEX)
+    if (parser.seenval('L')) {
+      if (!layerindex.seek(parser.value_ushort()))
+        SERIAL_ECHOLNPGM("?Layer not indexed");
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
     card.setIndex(parser.value_long());
 }
 
@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_READ_BENCHMARK)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+
+/**
+ * M35: Measure the read speed of a media file
+ *
+ * Parameters:
+ *   <filename>  The file to read
+ *
+ * Read the whole file in 512-byte blocks and report the size, time and speed.
+ */
+void GcodeSuite::M35() {
+  if (!card.isMounted() || card.isStillPrinting()) return;
+
+  MediaFile file;
+  if (!file.open(&card.getWorkDir(), parser.string_arg, O_READ)) {
+    SERIAL_ECHOLN(F(STR_SD_OPEN_FILE_FAIL), parser.string_arg, C('.'));
+    return;
+  }
+
+  __attribute__((aligned(sizeof(size_t)))) uint8_t buf[512];
+  uint32_t total = 0;
+  const millis_t start_ms = millis();
+  for (int16_t n; (n = file.read(buf, sizeof(buf))) > 0;) {
+    total += n;
+    hal.watchdog_refresh();
+  }
+  const millis_t ms = _MAX(millis() - start_ms, 1UL);
+  file.close();
+
+  SERIAL_ECHOLNPGM("Read ", total, " bytes in ", ms, " ms (", total / ms, " kB/s)");
+}
+
+#endif // SD_READ_BENCHMARK
@@ -23,6 +23,10 @@
 #include "../gcode.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(OK_COALESCE)
+  #include "../queue.h"
+#endif
+
 /**
  * M105: Read hot end and bed temperature
  */
@@ -31,6 +35,7 @@ void GcodeSuite::M105() {
   const int8_t target_extruder = get_target_extruder_from_command();
   if (target_extruder < 0) return;
 
+  TERN_(OK_COALESCE, queue.flush_ok()); // Acknowledge earlier lines first
   SERIAL_ECHOPGM(STR_OK);
 
   #if HAS_TEMP_SENSOR
@@ -31,9 +31,14 @@
  * M123: Report fan states -or- set interval for auto-report
  *
  *   S<seconds> : Set auto-report interval
+ *   T<rpm>     : Set the auto fan target speed, or 0 for EXTRUDER_AUTO_FAN_SPEED (Requires FAN_TACHO_TARGET_RPM)
  */
 void GcodeSuite::M123() {
 
+  #if HAS_FAN_TACHO_CONTROL
+    if (parser.seenval('T')) fan_check.target_rpm = parser.value_ushort();
+  #endif
+
   #if ENABLED(AUTO_REPORT_FANS)
     if (parser.seenval('S')) {
       fan_check.auto_reporter.set_interval(parser.value_byte());
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LAYER_TIME_FAN)
+
+#include "../gcode.h"
+#include "../../feature/layer_fan.h"
+
+/**
+ * M228: Layer time fan boost
+ *
+ *  S<bool>    - Turn the boost on or off
+ *  L<seconds> - Layer time for the maximum speed
+ *  H<seconds> - Layer time for no boost
+ *  P<speed>   - Speed on the fastest layers (0-255)
+ *
+ * With no parameters report the state and the last layer time.
+ */
+void GcodeSuite::M228() {
+  if (!parser.seen("SLHP")) return layer_fan.report();
+  if (parser.seen('S')) layer_fan.enabled = parser.value_bool();
+  if (parser.seenval('L')) layer_fan.fast_time = parser.value_byte();
+  if (parser.seenval('H')) layer_fan.slow_time = parser.value_byte();
+  if (parser.seenval('P')) layer_fan.max_speed = parser.value_byte();
+}
+
+#endif // LAYER_TIME_FAN
@@ -564,6 +564,9 @@
   #if DGUS_UI_IS(ORIGIN, FYSETC, HIPRECY, MKS)
     #define HAS_DGUS_LCD_CLASSIC 1
   #endif
+  #if HAS_DGUS_LCD_CLASSIC || DGUS_UI_IS(RELOADED, E3S1PRO, CR6_COMM)
+    #define HAS_DGUS_TRANSPORT 1 // VP writes go through lcd/extui/dgus_common
+  #endif
 #endif
 
 // Extensible UI serial touch screens. (See src/lcd/extui)
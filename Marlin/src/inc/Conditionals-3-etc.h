@@ -515,6 +515,9 @@
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_3POINT)
   #define NEEDS_THREE_PROBE_POINTS 1
 #endif
+#if ANY(UBL_HILBERT_CURVE, SELECTABLE_PROBE_ORDER)
+  #define HAS_HILBERT_CURVE 1
+#endif
 #if ANY(HAS_ABL_NOT_UBL, AUTO_BED_LEVELING_UBL)
   #define HAS_ABL_OR_UBL 1
   #if DISABLED(PROBE_MANUALLY)
@@ -230,10 +230,13 @@
 #if !HAS_EXTRUDERS
   #define NO_VOLUMETRICS
   #undef ADVANCED_PAUSE_FEATURE
+  #undef ADVANCED_PAUSE_NONBLOCKING
   #undef DISABLE_IDLE_E
   #undef EXTRUDER_RUNOUT_PREVENT
   #undef FILAMENT_LOAD_UNLOAD_GCODES
   #undef FWRETRACT
+  #undef FWRETRACT_BLEND
+  #undef INPUT_SHAPING_E
   #undef LCD_SHOW_E_TOTAL
   #undef LIN_ADVANCE
   #undef SMOOTH_LIN_ADVANCE
@@ -354,6 +357,20 @@
 #if ENABLED(LIN_ADVANCE) && DISABLED(SMOOTH_LIN_ADVANCE)
   #define HAS_ROUGH_LIN_ADVANCE 1
 #endif
+#if ENABLED(SMOOTH_LIN_ADVANCE) && !defined(SMOOTH_LIN_ADV_LOOKAHEAD)
+  #define SMOOTH_LIN_ADV_LOOKAHEAD 16
+#endif
+
+#if ENABLED(ARC_SUPPORT)
+  #if !defined(MAX_ARC_SEGMENT_MM) && defined(MIN_ARC_SEGMENT_MM)
+    #define MAX_ARC_SEGMENT_MM MIN_ARC_SEGMENT_MM
+  #elif !defined(MIN_ARC_SEGMENT_MM) && defined(MAX_ARC_SEGMENT_MM)
+    #define MIN_ARC_SEGMENT_MM MAX_ARC_SEGMENT_MM
+  #endif
+#endif
+#if ANY(ARC_ADAPTIVE_SEGMENTS, BEZIER_ADAPTIVE_SEGMENTS)
+  #define HAS_ADAPTIVE_CURVE_SEGMENTS 1
+#endif
 
 // Some displays can toggle Adaptive Step Smoothing.
 // The state is saved to EEPROM.
@@ -994,6 +1011,14 @@
   #define HAS_MEDIA_SUBCALLS 1
 #endif
 
+#if HAS_MEDIA && ALL(DGUS_LCD_UI_CR6_COMM, DGUS_PERF_PAGE)
+  #define HAS_SD_READ_STATS 1   // Longest SD block read, for the diagnostics page
+#endif
+
+#if HAS_MEDIA && ANY(SD_HEATSHRINK, SD_BINARY_GCODE)
+  #define HAS_MEDIA_DECODER 1   // Some files are decoded as they're read
+#endif
+
 #if ANY(SHOW_ELAPSED_TIME, SHOW_REMAINING_TIME, SHOW_INTERACTION_TIME)
   #define HAS_TIME_DISPLAY 1
 #endif
@@ -1013,9 +1038,16 @@
   #endif
 #endif
 
-#if ANY(FWRETRACT, HAS_LEVELING, SKEW_CORRECTION)
+#if ANY(FWRETRACT, HAS_LEVELING, SKEW_CORRECTION, BABYSTEP_PLANNER)
   #define HAS_POSITION_MODIFIERS 1
 #endif
+#if ANY(FWRETRACT, BABYSTEP_PLANNER)
+  #define HAS_PLANNER_OFFSETS 1
+#endif
+
+#if ALL(GCODE_REPEAT_MARKERS, HAS_MEDIA) && defined(GCODE_REPEAT_CACHE)
+  #define HAS_REPEAT_CACHE 1
+#endif
 
 #if ANY(X_DUAL_ENDSTOPS, Y_DUAL_ENDSTOPS, Z_MULTI_ENDSTOPS)
   #define HAS_EXTRA_ENDSTOPS 1
@@ -1092,6 +1124,7 @@
   #ifdef Z_STEPPER_ALIGN_STEPPER_XY
     #define HAS_Z_STEPPER_ALIGN_STEPPER_XY 1
     #undef Z_STEPPER_ALIGN_AMP
+    #undef Z_STEPPER_ALIGN_FIT
   #endif
   #ifndef Z_STEPPER_ALIGN_AMP
     #define Z_STEPPER_ALIGN_AMP 1.0
@@ -1493,7 +1526,7 @@
   #if MB(MKS_MONSTER8_V1, BTT_SKR_MINI_E3_V1_0, BTT_SKR_MINI_E3_V1_2, BTT_SKR_MINI_E3_V2_0, BTT_SKR_MINI_E3_V3_0, BTT_SKR_MINI_E3_V3_0_1, BTT_SKR_E3_TURBO, BTT_OCTOPUS_V1_1, BTT_SKR_V3_0, BTT_SKR_V3_0_EZ, AQUILA_V101)
 
     #define LCD_SERIAL_PORT 1
-  #elif MB(CREALITY_V24S1_301, CREALITY_V24S1_301F4, CREALITY_F401RE, CREALITY_V422_GD32_MFL, CREALITY_V423, CREALITY_V427_GD32_MFL, CREALITY_CR4NTXXC10, CREALITY_CR4NS, MKS_ROBIN, PANOWIN_CUTLASS, KODAMA_BARDO)
+  #elif MB(CREALITY_V24S1_301, CREALITY_V24S1_301F4, CREALITY_F401RE, CREALITY_V422_GD32_MFL, CREALITY_V423, CREALITY_V427_GD32_MFL, CREALITY_V453_GD32_MFL, CREALITY_CR4NTXXC10, CREALITY_CR4NS, MKS_ROBIN, PANOWIN_CUTLASS, KODAMA_BARDO)
     #define LCD_SERIAL_PORT 2
   #else
     #define LCD_SERIAL_PORT 3
@@ -1517,8 +1550,18 @@
 #endif
 
 // Input shaping
-#if ANY(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z)
+#if ANY(INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z, INPUT_SHAPING_E)
   #define HAS_ZV_SHAPING 1
+  #ifndef SHAPING_MAX_IMPULSES
+    #define SHAPING_MAX_IMPULSES 2
+  #endif
+  #define SHAPING_MAX_ECHOES (SHAPING_MAX_IMPULSES - 1)
+  #if SHAPING_MAX_IMPULSES > 2
+    #define HAS_MULTI_IMPULSE_SHAPING 1
+  #endif
+  #if SHAPING_MAX_IMPULSES > 3
+    #define HAS_4_IMPULSE_SHAPING 1
+  #endif
 #endif
 
 // FT Motion unified window and batch size
@@ -1547,6 +1590,9 @@
   #define MULTISTEPPING_LIMIT 128
   #define MULTISTEPPING_LIMIT_WARNING 1
 #endif
+#if ANY(OLD_ADAPTIVE_MULTISTEPPING, SMOOTH_MULTISTEPPING)
+  #define HAS_RATE_MULTISTEPPING 1  // Steps per ISR follow the step rate instead of the ISR load
+#endif
 
 // One redundant cooling fan by default
 #if defined(REDUNDANT_PART_COOLING_FAN) && !defined(NUM_REDUNDANT_FANS)
@@ -1561,6 +1607,9 @@
   #if ANY(DWIN_CREALITY_LCD, DWIN_LCD_PROUI)
     #define HAS_PLR_UI_FLAG 1   // recovery.ui_flag_resume
   #endif
+  #if ANY(POWER_LOSS_STORE_SPI_FLASH, POWER_LOSS_STORE_BACKUP_SRAM)
+    #define HAS_PLR_STORE 1     // PowerLossStore plr_store
+  #endif
 #endif
 
 // Toolchange Event G-code
@@ -1570,6 +1619,11 @@
   #undef TC_GCODE_USE_GLOBAL_Z
 #endif
 
+// Heat the next tool ahead of a tool-change
+#if HAS_MULTI_EXTRUDER && HAS_MULTI_HOTEND && defined(TOOLCHANGE_PREHEAT_LINES)
+  #define HAS_TOOLCHANGE_PREHEAT 1
+#endif
+
 // Clean up for TOOLCHANGE_MIGRATION_FEATURE
 #if DISABLED(TOOLCHANGE_MIGRATION_FEATURE)
   #undef MIGRATION_ZRAISE
@@ -772,6 +772,9 @@
     #define USE_ADAFRUIT_MAX31865 1
   #elif HAS_MAX31865
     #define LIB_INTERNAL_MAX31865 1
+    #if DISABLED(MAX31865_USE_AUTO_MODE)
+      #define HAS_MAX31865_ONE_SHOT 1 // Conversions advanced by MAX31865::update()
+    #endif
   #endif
 
 #endif // HAS_MAX_TC
@@ -2819,12 +2822,15 @@
   #if HAS_AUTO_FAN && EXTRUDER_AUTO_FAN_SPEED != 255 && DISABLED(FOURWIRES_FANS)
     #define HAS_PWMFANCHECK 1
   #endif
+  #if ENABLED(FAN_TACHO_INTERRUPTS) && defined(FAN_TACHO_TARGET_RPM)
+    #define HAS_FAN_TACHO_CONTROL 1
+  #endif
 #endif
 
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, PLANNER_MONITOR, BINARY_TELEMETRY)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -3674,4 +3680,9 @@
                                                       //   2HEI     : FTM_RATIO * 3 / 2
                                                       //   3HEI     : FTM_RATIO * 2
   #define FTM_SMOOTHING_ORDER 5                       // 3 to 5 is closest to gaussian
+  #if ENABLED(FTM_CUSTOM_SHAPER) && FTM_CUSTOM_IMPULSES > 5
+    #define FTM_SHAPER_IMPULSES FTM_CUSTOM_IMPULSES   // Size of the per-axis shaping kernel
+  #else
+    #define FTM_SHAPER_IMPULSES 5
+  #endif
 #endif
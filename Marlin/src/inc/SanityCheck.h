@@ -213,6 +213,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
       static_assert(_test_etc_sample_res != 12.3f, "PTC_HOTEND_RES must be a whole number.");
     #endif
   #endif
+#elif ENABLED(PTC_POLYNOMIAL)
+  #error "PTC_POLYNOMIAL requires PTC_PROBE, PTC_BED, or PTC_HOTEND."
 #endif // HAS_PTC
 
 /**
@@ -251,6 +253,18 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SERIAL_DMA is only available for some STM32 MCUs and requires HAL/STM32."
   #elif !defined(HAL_UART_MODULE_ENABLED) || defined(HAL_UART_MODULE_ONLY)
     #error "SERIAL_DMA requires STM32 platform HAL UART (without HAL_UART_MODULE_ONLY)."
+  #elif defined(SERIAL_DMA_TX_PORTS) && !defined(STM32F1xx)
+    #error "SERIAL_DMA_TX_PORTS is only available for STM32F1."
+  #endif
+#elif defined(SERIAL_DMA_TX_PORTS)
+  #error "SERIAL_DMA_TX_PORTS requires SERIAL_DMA."
+#endif
+
+#if ENABLED(USB_CDC_BULK_RX)
+  #if DISABLED(HAL_STM32) || !defined(USBCON)
+    #error "USB_CDC_BULK_RX requires HAL/STM32 with a native USB serial port."
+  #elif !WITHIN(USB_CDC_RX_BUFFER_SIZE, 128, 32768) || (USB_CDC_RX_BUFFER_SIZE & (USB_CDC_RX_BUFFER_SIZE - 1))
+    #error "USB_CDC_RX_BUFFER_SIZE must be a power of 2 from 128 to 32768."
   #endif
 #endif
 
@@ -381,6 +395,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "SET_PROGRESS_MANUALLY requires at least one of SET_PROGRESS_PERCENT, SET_REMAINING_TIME, SET_INTERACTION_TIME to be enabled."
 #endif
 
+#if ENABLED(PLANNER_TIME_ESTIMATE) && !HAS_MEDIA
+  #error "PLANNER_TIME_ESTIMATE requires SDSUPPORT."
+#endif
+
 #if HAS_LCDPRINT && HAS_EXTRA_PROGRESS && LCD_HEIGHT < 4
   #error "Displays with fewer than 4 rows can't show progress values (e.g., SHOW_PROGRESS_PERCENT, SHOW_ELAPSED_TIME, SHOW_REMAINING_TIME, SHOW_INTERACTION_TIME)."
 #endif
@@ -511,6 +529,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "BABYSTEPPING requires BABYSTEP_MULTIPLICATOR_Z."
   #elif ENABLED(BABYSTEP_XY) && !defined(BABYSTEP_MULTIPLICATOR_XY)
     #error "BABYSTEP_XY requires BABYSTEP_MULTIPLICATOR_XY."
+  #elif ENABLED(BABYSTEP_PLANNER) && !defined(BABYSTEP_PLANNER_SLOPE)
+    #error "BABYSTEP_PLANNER requires BABYSTEP_PLANNER_SLOPE."
+  #elif ENABLED(BABYSTEP_PLANNER) && ANY(IS_KINEMATIC, EP_BABYSTEPPING, BD_SENSOR, FT_MOTION)
+    #error "BABYSTEP_PLANNER is not compatible with kinematic machines, EP_BABYSTEPPING, BD_SENSOR, or FT_MOTION."
   #elif ENABLED(BABYSTEP_MILLIMETER_UNITS)
     static_assert(BABYSTEP_MULTIPLICATOR_Z <= 0.1f, "BABYSTEP_MULTIPLICATOR_Z with BABYSTEP_MILLIMETER_UNITS must be less or equal to 0.1mm.");
     #if ENABLED(BABYSTEP_XY)
@@ -570,6 +592,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+#if ENABLED(FILAMENT_MOTION_TRACKING)
+  #if DISABLED(FILAMENT_MOTION_SENSOR)
+    #error "FILAMENT_MOTION_TRACKING requires FILAMENT_MOTION_SENSOR."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "FILAMENT_MOTION_TRACKING is not compatible with MIXING_EXTRUDER."
+  #endif
+  static_assert(FILAMENT_MOTION_MM_PER_EDGE > 0, "FILAMENT_MOTION_MM_PER_EDGE must be greater than zero.");
+  static_assert(FILAMENT_MOTION_SLIP_MM >= FILAMENT_MOTION_MM_PER_EDGE, "FILAMENT_MOTION_SLIP_MM must be at least FILAMENT_MOTION_MM_PER_EDGE.");
+  static_assert(FILAMENT_MOTION_SLIP_TIME >= 0, "FILAMENT_MOTION_SLIP_TIME must be zero or more.");
+#endif
+
 /**
  * Advanced Pause
  */
@@ -586,6 +619,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "PARK_HEAD_ON_PAUSE requires HAS_MEDIA, EMERGENCY_PARSER, or an LCD controller."
   #elif ENABLED(HOME_BEFORE_FILAMENT_CHANGE) && DISABLED(PAUSE_PARK_NO_STEPPER_TIMEOUT)
     #error "HOME_BEFORE_FILAMENT_CHANGE requires PAUSE_PARK_NO_STEPPER_TIMEOUT."
+  #elif ENABLED(ADVANCED_PAUSE_NONBLOCKING) && ANY(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER, MMU_MENUS)
+    #error "ADVANCED_PAUSE_NONBLOCKING is not compatible with multiple extruders, MIXING_EXTRUDER, or MMU_MENUS."
   #elif ENABLED(PREVENT_LENGTHY_EXTRUDE) && FILAMENT_CHANGE_UNLOAD_LENGTH > EXTRUDE_MAXLENGTH
     #error "FILAMENT_CHANGE_UNLOAD_LENGTH must be less than or equal to EXTRUDE_MAXLENGTH."
   #elif ENABLED(PREVENT_LENGTHY_EXTRUDE) && FILAMENT_CHANGE_SLOW_LOAD_LENGTH > EXTRUDE_MAXLENGTH
@@ -862,6 +897,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. (Extrusion is controlled externally by the Step Daemon.)"
   #endif
 
+  #if ENABLED(LA_JUNCTION_LIMIT) && ENABLED(CLASSIC_JERK)
+    #error "LA_JUNCTION_LIMIT requires Junction Deviation. CLASSIC_JERK already limits the E speed step at junctions."
+  #endif
+
   /**
    * Smooth Linear Advance
    */
@@ -870,6 +909,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
       #error "SMOOTH_LIN_ADVANCE requires a 32-bit CPU."
     #elif ENABLED(INPUT_SHAPING_E_SYNC) && NONE(INPUT_SHAPING_X, INPUT_SHAPING_Y)
       #error "INPUT_SHAPING_E_SYNC requires INPUT_SHAPING_X or INPUT_SHAPING_Y."
+    #elif !WITHIN(SMOOTH_LIN_ADV_LOOKAHEAD, 1, BLOCK_BUFFER_SIZE)
+      #error "SMOOTH_LIN_ADV_LOOKAHEAD must be between 1 and BLOCK_BUFFER_SIZE."
     #endif
   #endif
 
@@ -1030,6 +1071,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #undef MPC_AUTOTUNE_MENU
   #undef MPC_PTC
 #endif
+#if ENABLED(PID_AUTOTUNE_FIT)
+  #if !HAS_PID_HEATING
+    #error "PID_AUTOTUNE_FIT requires PIDTEMP, PIDTEMPBED, or PIDTEMPCHAMBER."
+  #elif !defined(PID_AUTOTUNE_FIT_TOLERANCE)
+    #error "PID_AUTOTUNE_FIT requires PID_AUTOTUNE_FIT_TOLERANCE."
+  #endif
+  static_assert(PID_AUTOTUNE_FIT_TOLERANCE > 0 && PID_AUTOTUNE_FIT_TOLERANCE < 1, "PID_AUTOTUNE_FIT_TOLERANCE must be a fraction between 0 and 1.");
+#endif
 #if !WITHIN(PID_MAX, 0, 255)
   #error "PID_MAX must be an integer from 0 to 255."
 #endif
@@ -1047,6 +1096,59 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(MPC_FEEDFORWARD)
+  #if DISABLED(MPCTEMP)
+    #error "MPC_FEEDFORWARD requires MPCTEMP."
+  #elif !WITHIN(MPC_FEEDFORWARD_MS, 50, 5000)
+    #error "MPC_FEEDFORWARD_MS must be from 50 to 5000."
+  #endif
+  static_assert(WITHIN(MPC_FEEDFORWARD_GAIN, 0.0f, 2.0f), "MPC_FEEDFORWARD_GAIN must be from 0.0 to 2.0.");
+#endif
+
+#if ENABLED(HEATER_PWM_INTERLEAVE)
+  #if !HAS_HEATED_BED
+    #error "HEATER_PWM_INTERLEAVE requires a heated bed."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_PWM_INTERLEAVE is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(HEATER_PWM_EXCLUSIVE) && !HAS_HOTEND
+    #error "HEATER_PWM_EXCLUSIVE requires a hotend."
+  #endif
+#endif
+
+#if ENABLED(HEATER_HW_PWM)
+  #ifndef HAL_STM32
+    #error "HEATER_HW_PWM requires an STM32 board."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_HW_PWM is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(HEATER_PWM_INTERLEAVE)
+    #error "HEATER_HW_PWM is not compatible with HEATER_PWM_INTERLEAVE."
+  #elif ENABLED(HEATERS_PARALLEL)
+    #error "HEATER_HW_PWM is not compatible with HEATERS_PARALLEL."
+  #elif !WITHIN(HEATER_HW_PWM_FREQUENCY, 1, 65535)
+    #error "HEATER_HW_PWM_FREQUENCY must be from 1 to 65535."
+  #endif
+#endif
+
+#ifdef BED_PREHEAT_COAST_TIME
+  #if DISABLED(PIDTEMPBED)
+    #error "BED_PREHEAT_COAST_TIME requires PIDTEMPBED."
+  #elif ENABLED(PID_OPENLOOP)
+    #error "BED_PREHEAT_COAST_TIME is not compatible with PID_OPENLOOP."
+  #elif !WITHIN(BED_PREHEAT_COAST_TIME, 1, 600)
+    #error "BED_PREHEAT_COAST_TIME must be from 1 to 600 seconds."
+  #endif
+#endif
+
+#if ENABLED(MPC_FLOW_LIMIT)
+  #if DISABLED(MPCTEMP)
+    #error "MPC_FLOW_LIMIT requires MPCTEMP."
+  #elif !WITHIN(MPC_FLOW_LIMIT_DUTY, 50, 100)
+    #error "MPC_FLOW_LIMIT_DUTY must be from 50 to 100."
+  #endif
+  static_assert(WITHIN(MPC_FLOW_LIMIT_MARGIN, 0.1f, 1.0f), "MPC_FLOW_LIMIT_MARGIN must be from 0.1 to 1.0.");
+  static_assert(MPC_FLOW_LIMIT_MIN > 0, "MPC_FLOW_LIMIT_MIN must be greater than 0.");
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1215,6 +1317,10 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "Please enable only one of DELTA, MORGAN_SCARA, MP_SCARA, AXEL_TPARA, COREXY, COREXZ, COREYZ, COREYX, COREZX, COREZY, MARKFORGED_XY, MARKFORGED_YX, ARTICULATED_ROBOT_ARM, FOAMCUTTER_XYUV, or POLAR."
 #endif
 
+#if ENABLED(KINEMATICS_TRIG_TABLE) && !(IS_SCARA || ENABLED(POLAR))
+  #error "KINEMATICS_TRIG_TABLE requires SCARA, TPARA, or POLAR kinematics."
+#endif
+
 /**
  * Delta requirements
  */
@@ -1234,6 +1340,16 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #if ENABLED(DELTA_IK_INTERPOLATION)
+    #if ENABLED(BABYSTEP_PLANNER)
+      #error "DELTA_IK_INTERPOLATION is not compatible with BABYSTEP_PLANNER."
+    #elif !WITHIN(DELTA_IK_KNOT_SEGMENTS, 2, 64)
+      #error "DELTA_IK_KNOT_SEGMENTS must be from 2 to 64."
+    #endif
+    static_assert(DELTA_IK_MAX_ERROR > 0, "DELTA_IK_MAX_ERROR must be greater than 0.");
+  #endif
+#elif ENABLED(DELTA_IK_INTERPOLATION)
+  #error "DELTA_IK_INTERPOLATION requires DELTA."
 #endif
 
 /**
@@ -1612,6 +1728,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #endif
   #endif
 
+  #if ENABLED(PROBE_ADAPTIVE_APPROACH)
+    #if TOTAL_PROBING != 2
+      #error "PROBE_ADAPTIVE_APPROACH requires MULTIPLE_PROBING 2 without EXTRA_PROBING."
+    #endif
+    static_assert(PROBE_APPROACH_MIN > 0 && PROBE_APPROACH_MIN <= Z_CLEARANCE_MULTI_PROBE, "PROBE_APPROACH_MIN must be greater than 0 and no more than Z_CLEARANCE_MULTI_PROBE.");
+    static_assert(PROBE_APPROACH_FACTOR >= 1, "PROBE_APPROACH_FACTOR must be 1 or more.");
+  #endif
+
   static_assert(Z_PROBE_LOW_POINT <= 0, "Z_PROBE_LOW_POINT must be less than or equal to 0.");
 
   #if ENABLED(PROBE_ACTIVATION_SWITCH)
@@ -1622,6 +1746,41 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #endif
   #endif
 
+  #if ENABLED(PROBE_PIPELINED_TRAVEL)
+    #if !HAS_ABL_NOT_UBL
+      #error "PROBE_PIPELINED_TRAVEL requires AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR."
+    #elif IS_KINEMATIC
+      #error "PROBE_PIPELINED_TRAVEL is not compatible with kinematic machines."
+    #elif ENABLED(BD_SENSOR_PROBE_NO_STOP)
+      #error "PROBE_PIPELINED_TRAVEL is not compatible with BD_SENSOR_PROBE_NO_STOP."
+    #endif
+    static_assert(PROBE_PIPELINE_LIFT > 0, "PROBE_PIPELINE_LIFT must be greater than 0.");
+  #endif
+
+  #if ENABLED(PROBE_FILTERED_SAMPLING)
+    #if !HAS_REAL_BED_PROBE
+      #error "PROBE_FILTERED_SAMPLING requires a real bed probe."
+    #elif ENABLED(BD_SENSOR)
+      #error "PROBE_FILTERED_SAMPLING is not compatible with BD_SENSOR."
+    #elif !WITHIN(PROBE_SAMPLE_BURST, 1, 15)
+      #error "PROBE_SAMPLE_BURST must be between 1 and 15."
+    #elif !WITHIN(PROBE_SAMPLE_WINDOW, 1, 8)
+      #error "PROBE_SAMPLE_WINDOW must be between 1 and 8."
+    #elif !WITHIN(PROBE_SAMPLE_VOTES, 1, PROBE_SAMPLE_WINDOW) || 2 * (PROBE_SAMPLE_VOTES) <= PROBE_SAMPLE_WINDOW
+      #error "PROBE_SAMPLE_VOTES must be over half of PROBE_SAMPLE_WINDOW and no more than PROBE_SAMPLE_WINDOW."
+    #endif
+  #endif
+
+  #if ENABLED(PROBE_DEPLOY_IN_TRAVEL)
+    #if NONE(BLTOUCH, HAS_Z_SERVO_PROBE)
+      #error "PROBE_DEPLOY_IN_TRAVEL requires BLTOUCH or a Z servo probe."
+    #elif IS_KINEMATIC
+      #error "PROBE_DEPLOY_IN_TRAVEL is not compatible with kinematic machines."
+    #elif ANY(PAUSE_BEFORE_DEPLOY_STOW, PROBE_TRIGGERED_WHEN_STOWED_TEST)
+      #error "PROBE_DEPLOY_IN_TRAVEL is not compatible with PAUSE_BEFORE_DEPLOY_STOW or PROBE_TRIGGERED_WHEN_STOWED_TEST."
+    #endif
+  #endif
+
 #else
 
   /**
@@ -1652,6 +1811,44 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "LCD_BED_TRAMMING is required for the selected display."
 #endif
 
+#if ENABLED(G29_ADAPTIVE_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "G29_ADAPTIVE_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "G29_ADAPTIVE_PROBING is not compatible with PROBE_MANUALLY."
+  #endif
+#endif
+
+#if ENABLED(ABL_BILINEAR_LAZY_SUBDIVISION)
+  #if DISABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "ABL_BILINEAR_LAZY_SUBDIVISION requires ABL_BILINEAR_SUBDIVISION."
+  #elif ENABLED(ABL_BILINEAR_CELL_CACHE)
+    #error "ABL_BILINEAR_LAZY_SUBDIVISION is not compatible with ABL_BILINEAR_CELL_CACHE."
+  #elif !WITHIN(ABL_LAZY_CACHE_BOXES, 1, 255)
+    #error "ABL_LAZY_CACHE_BOXES must be from 1 to 255."
+  #endif
+#endif
+
+#if ENABLED(SELECTABLE_PROBE_ORDER)
+  #if NONE(ABL_USES_GRID, AUTO_BED_LEVELING_UBL) || !HAS_BED_PROBE
+    #error "SELECTABLE_PROBE_ORDER requires a probe with AUTO_BED_LEVELING_(BI)LINEAR or AUTO_BED_LEVELING_UBL."
+  #elif ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    #error "SELECTABLE_PROBE_ORDER is not compatible with BD_SENSOR_PROBE_NO_STOP."
+  #elif !WITHIN(PROBE_ORDER_DEFAULT, 0, 2)
+    #error "PROBE_ORDER_DEFAULT must be 0 (Serpentine), 1 (Hilbert) or 2 (Nearest)."
+  #endif
+#endif
+
+#if ENABLED(PROBE_STATISTICS)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL) || !HAS_BED_PROBE
+    #error "PROBE_STATISTICS requires a probe with AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif !WITHIN(PROBE_STATS_RUNS, 2, 16)
+    #error "PROBE_STATS_RUNS must be from 2 to 16."
+  #endif
+  static_assert(PROBE_STATS_OUTLIER_SIGMA > 0, "PROBE_STATS_OUTLIER_SIGMA must be greater than 0.");
+  static_assert(PROBE_STATS_REPROBE_MM > 0, "PROBE_STATS_REPROBE_MM must be greater than 0.");
+#endif
+
 /**
  * Allow only one bed leveling option to be defined
  */
@@ -1678,6 +1875,10 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "GRID_MAX_POINTS_[XY] must be between 3 and 255."
   #elif ALL(UBL_HILBERT_CURVE, DELTA)
     #error "UBL_HILBERT_CURVE can only be used with a square / rectangular printable area."
+  #elif defined(UBL_SMART_FILL_WINDOW) && DISABLED(UBL_G29_P31)
+    #error "UBL_SMART_FILL_WINDOW requires UBL_G29_P31."
+  #elif defined(UBL_SMART_FILL_WINDOW) && !WITHIN(UBL_SMART_FILL_WINDOW, 1, 15)
+    #error "UBL_SMART_FILL_WINDOW must be from 1 to 15."
   #endif
 #elif ENABLED(MESH_BED_LEVELING)
   #if ENABLED(DELTA)
@@ -1776,6 +1977,34 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   );
 #endif
 
+#if ENABLED(SINGLE_PASS_HOMING)
+  #if DISABLED(ENDSTOP_EDGE_CAPTURE)
+    #error "SINGLE_PASS_HOMING requires ENDSTOP_EDGE_CAPTURE."
+  #elif IS_KINEMATIC
+    #error "SINGLE_PASS_HOMING is not compatible with DELTA or SCARA."
+  #elif HAS_EXTRA_ENDSTOPS
+    #error "SINGLE_PASS_HOMING is not compatible with dual or multiple endstops."
+  #elif defined(TMC_HOME_PHASE)
+    #error "SINGLE_PASS_HOMING is not compatible with TMC_HOME_PHASE."
+  #endif
+#endif
+
+#if ENABLED(HOME_XY_TOGETHER)
+  #if IS_KINEMATIC
+    #error "HOME_XY_TOGETHER is not compatible with DELTA or SCARA."
+  #elif ENABLED(DUAL_X_CARRIAGE)
+    #error "HOME_XY_TOGETHER is not compatible with DUAL_X_CARRIAGE."
+  #elif ANY(X_DUAL_ENDSTOPS, Y_DUAL_ENDSTOPS)
+    #error "HOME_XY_TOGETHER is not compatible with X_DUAL_ENDSTOPS or Y_DUAL_ENDSTOPS."
+  #elif ANY(X_SENSORLESS, Y_SENSORLESS)
+    #error "HOME_XY_TOGETHER is not compatible with sensorless X or Y homing."
+  #elif ENABLED(SINGLE_PASS_HOMING)
+    #error "HOME_XY_TOGETHER is not compatible with SINGLE_PASS_HOMING."
+  #elif defined(TMC_HOME_PHASE)
+    #error "HOME_XY_TOGETHER is not compatible with TMC_HOME_PHASE."
+  #endif
+#endif
+
 #ifdef HOMING_BACKOFF_POST_MM
   constexpr float hbp[] = HOMING_BACKOFF_POST_MM;
   static_assert(COUNT(hbp) == NUM_AXES, "HOMING_BACKOFF_POST_MM must have " _NUM_AXES_STR "elements (and no others).");
@@ -2125,6 +2354,10 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "Thermistor 66 requires PREHEAT_TIME_BED_MS ≥ 15000, but 30000 or higher is recommended."
 #endif
 
+#if ENABLED(THERMISTOR_FAST_LOOKUP) && !WITHIN(THERMISTOR_LOOKUP_BITS, 4, 12)
+  #error "THERMISTOR_LOOKUP_BITS must be from 4 to 12."
+#endif
+
 /**
  * Required MAX31865 settings
  */
@@ -2645,6 +2878,62 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "ENDSTOP_NOISE_THRESHOLD must be an integer from 2 to 7."
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_CAPTURE) && !ENDSTOP_NOISE_THRESHOLD
+  #error "ENDSTOP_EDGE_CAPTURE requires ENDSTOP_NOISE_THRESHOLD."
+#endif
+
+/**
+ * Adaptive arc segments
+ */
+#if ENABLED(ARC_ADAPTIVE_SEGMENTS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_ADAPTIVE_SEGMENTS requires ARC_SUPPORT."
+  #elif !defined(ARC_CHORD_TOLERANCE) && !HAS_JUNCTION_DEVIATION
+    #error "ARC_ADAPTIVE_SEGMENTS requires ARC_CHORD_TOLERANCE with CLASSIC_JERK."
+  #endif
+  #ifdef ARC_CHORD_TOLERANCE
+    static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+  #endif
+#endif
+
+/**
+ * Adaptive Bézier segments
+ */
+#if ENABLED(BEZIER_ADAPTIVE_SEGMENTS)
+  #if DISABLED(BEZIER_CURVE_SUPPORT)
+    #error "BEZIER_ADAPTIVE_SEGMENTS requires BEZIER_CURVE_SUPPORT."
+  #elif DISABLED(ARC_SUPPORT)
+    #error "BEZIER_ADAPTIVE_SEGMENTS requires ARC_SUPPORT for its segment settings."
+  #elif !defined(ARC_CHORD_TOLERANCE) && !HAS_JUNCTION_DEVIATION
+    #error "BEZIER_ADAPTIVE_SEGMENTS requires ARC_CHORD_TOLERANCE with CLASSIC_JERK."
+  #endif
+#endif
+
+/**
+ * Collinear segment merging
+ */
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  static_assert(WITHIN(IDLE_TASK_UI_MS, 1, 1000), "IDLE_TASK_UI_MS must be between 1 and 1000.");
+  static_assert(WITHIN(IDLE_TASK_RUNOUT_MS, 1, 1000), "IDLE_TASK_RUNOUT_MS must be between 1 and 1000.");
+  static_assert(WITHIN(IDLE_TASK_MEDIA_MS, 1, 1000), "IDLE_TASK_MEDIA_MS must be between 1 and 1000.");
+  static_assert(WITHIN(IDLE_TASK_REPORT_MS, 1, 1000), "IDLE_TASK_REPORT_MS must be between 1 and 1000.");
+#endif
+
+#if ENABLED(FLIGHT_RECORDER)
+  static_assert(WITHIN(FLIGHT_RECORDER_SIZE, 16, 4096), "FLIGHT_RECORDER_SIZE must be between 16 and 4096.");
+#endif
+
+#if ENABLED(SEGMENT_MERGE)
+  #if NUM_AXES != 3
+    #error "SEGMENT_MERGE only supports machines with XYZ axes."
+  #elif HAS_CUTTER
+    #error "SEGMENT_MERGE is not compatible with a laser or spindle."
+  #endif
+  static_assert(SEGMENT_MERGE_MAX_LENGTH > 0, "SEGMENT_MERGE_MAX_LENGTH must be greater than 0.");
+  static_assert(SEGMENT_MERGE_DEVIATION > 0, "SEGMENT_MERGE_DEVIATION must be greater than 0.");
+  static_assert(SEGMENT_MERGE_E_DEVIATION >= 0, "SEGMENT_MERGE_E_DEVIATION must be 0 or greater.");
+#endif
+
 /**
  * Emergency Command Parser
  */
@@ -2652,6 +2941,13 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "EMERGENCY_PARSER does not work on boards with AT90USB processors (USBCON)."
 #endif
 
+/**
+ * Realtime commands
+ */
+#if ENABLED(REALTIME_OVERRIDE_COMMANDS) && DISABLED(EMERGENCY_PARSER)
+  #error "EMERGENCY_PARSER is required to activate REALTIME_OVERRIDE_COMMANDS."
+#endif
+
 /**
  * Software Reset options
  */
@@ -2662,11 +2958,20 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "An encoder button is required or SOFT_RESET_ON_KILL will reset the printer without notice!"
 #endif
 
+// Step interval table for 32-bit
+#if ENABLED(STEP_INTERVAL_TABLE) && defined(__AVR__)
+  #error "STEP_INTERVAL_TABLE is for 32-bit MCUs. AVR always uses speed_lookuptable.h."
+#endif
+
 // Reset reason for AVR
 #if ENABLED(OPTIBOOT_RESET_REASON) && !defined(__AVR__)
   #error "OPTIBOOT_RESET_REASON only applies to AVR."
 #endif
 
+#if ENABLED(COMPACT_PLANNER_BLOCKS) && (defined(__AVR__) || defined(__ARM_ARCH_6M__))
+  #error "COMPACT_PLANNER_BLOCKS requires a 32-bit MCU with a hardware divide."
+#endif
+
 /**
  * I2C bus
  */
@@ -2696,6 +3001,23 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+/**
+ * Limits Calibration requirements
+ */
+#if ENABLED(LIMITS_CALIBRATION)
+  #if !IS_FULL_CARTESIAN
+    #error "LIMITS_CALIBRATION requires a Cartesian machine."
+  #elif ENABLED(SENSORLESS_HOMING)
+    #error "LIMITS_CALIBRATION requires physical X / Y endstops, not SENSORLESS_HOMING."
+  #endif
+  static_assert(0 < (LIMITS_CAL_ACCEL_START) && (LIMITS_CAL_ACCEL_START) <= (LIMITS_CAL_ACCEL_MAX), "LIMITS_CAL_ACCEL_START must be > 0 and <= LIMITS_CAL_ACCEL_MAX.");
+  static_assert(0 < (LIMITS_CAL_FEED_START) && (LIMITS_CAL_FEED_START) <= (LIMITS_CAL_FEED_MAX), "LIMITS_CAL_FEED_START must be > 0 and <= LIMITS_CAL_FEED_MAX.");
+  static_assert((LIMITS_CAL_RAMP) > 1, "LIMITS_CAL_RAMP must be > 1.");
+  static_assert(WITHIN(LIMITS_CAL_CYCLES, 1, 100), "LIMITS_CAL_CYCLES must be 1-100.");
+  static_assert(WITHIN(LIMITS_CAL_MARGIN, 0, 90), "LIMITS_CAL_MARGIN must be 0-90.");
+  static_assert((LIMITS_CAL_TOLERANCE) > 0, "LIMITS_CAL_TOLERANCE must be > 0.");
+#endif
+
 /**
  * RGB_LED Requirements
  */
@@ -2723,7 +3045,13 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "NEOPIXEL2_SEPARATE requires NEOPIXEL2_TYPE, NEOPIXEL2_PIN and NEOPIXEL2_PIXELS."
   #elif ENABLED(NEO2_COLOR_PRESETS) && DISABLED(NEOPIXEL2_SEPARATE)
     #error "NEO2_COLOR_PRESETS requires NEOPIXEL2_SEPARATE to be enabled."
+  #elif ENABLED(NEOPIXEL_DMA) && !defined(HAL_STM32)
+    #error "NEOPIXEL_DMA requires an STM32 (HAL/STM32) board."
+  #elif ENABLED(NEOPIXEL_DMA) && PIN_EXISTS(NEOPIXEL2)
+    #error "NEOPIXEL_DMA only drives one strip. Disable NEOPIXEL2_PIN."
   #endif
+#elif ENABLED(NEOPIXEL_DMA)
+  #error "NEOPIXEL_DMA requires NEOPIXEL_LED."
 #endif
 
 #if DISABLED(NO_COMPILE_TIME_PWM)
@@ -2762,8 +3090,61 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #elif ALL(E7_FAN_TACHO_PULLUP, E7_FAN_TACHO_PULLDOWN)
     #error "Enable only one of E7_FAN_TACHO_PULLUP or E7_FAN_TACHO_PULLDOWN."
   #endif
+  #ifdef FAN_TACHO_TARGET_RPM
+    #if !HAS_AUTO_FAN
+      #error "FAN_TACHO_TARGET_RPM requires one or more En_AUTO_FAN_PINs."
+    #elif DISABLED(FOURWIRES_FANS)
+      #error "FAN_TACHO_TARGET_RPM requires FOURWIRES_FANS, since a 3-wire fan's tachometer can't be read while PWM driven."
+    #elif !WITHIN(FAN_TACHO_TARGET_RPM, 0, 20000)
+      #error "FAN_TACHO_TARGET_RPM must be between 0 and 20000."
+    #elif FAN_TACHO_RPM_PER_PWM < 1
+      #error "FAN_TACHO_RPM_PER_PWM must be 1 or more."
+    #endif
+  #endif
 #elif ENABLED(AUTO_REPORT_FANS)
   #error "AUTO_REPORT_FANS requires one or more fans with a tachometer pin."
+#elif ENABLED(FAN_TACHO_INTERRUPTS)
+  #error "FAN_TACHO_INTERRUPTS requires one or more fans with a tachometer pin."
+#endif
+
+#if ENABLED(POWER_BUDGET)
+  #if !HAS_POWER_MONITOR
+    #error "POWER_BUDGET requires POWER_MONITOR_CURRENT and/or POWER_MONITOR_VOLTAGE."
+  #elif defined(POWER_BUDGET_MIN_VOLTS) && DISABLED(POWER_MONITOR_VOLTAGE)
+    #error "POWER_BUDGET_MIN_VOLTS requires POWER_MONITOR_VOLTAGE."
+  #elif !defined(POWER_BUDGET_MIN_VOLTS) && DISABLED(POWER_MONITOR_CURRENT)
+    #error "POWER_BUDGET requires POWER_MONITOR_CURRENT, or POWER_BUDGET_MIN_VOLTS with POWER_MONITOR_VOLTAGE."
+  #elif ENABLED(PELTIER_BED)
+    #error "POWER_BUDGET is not compatible with PELTIER_BED."
+  #elif !WITHIN(POWER_BUDGET_SAG_ACCEL, 10, 100)
+    #error "POWER_BUDGET_SAG_ACCEL must be between 10 and 100."
+  #elif !WITHIN(POWER_BUDGET_MIN_HOTEND, 0, 100)
+    #error "POWER_BUDGET_MIN_HOTEND must be between 0 and 100."
+  #endif
+#endif
+
+#ifdef THERMAL_CHECK_INTERVAL
+  #if NONE(THERMAL_PROTECTION_HOTENDS, THERMAL_PROTECTION_BED)
+    #error "THERMAL_CHECK_INTERVAL requires THERMAL_PROTECTION_HOTENDS or THERMAL_PROTECTION_BED."
+  #elif !WITHIN(THERMAL_CHECK_INTERVAL, 1, 1000)
+    #error "THERMAL_CHECK_INTERVAL must be between 1 and 1000 ms."
+  #endif
+#endif
+
+#if ENABLED(LAYER_TIME_FAN)
+  #if !HAS_FAN
+    #error "LAYER_TIME_FAN requires a part cooling fan."
+  #elif !WITHIN(LAYER_FAN_INDEX, 0, FAN_COUNT - 1)
+    #error "LAYER_FAN_INDEX must be the index of a part cooling fan."
+  #elif ENABLED(LASER_SYNCHRONOUS_M106_M107)
+    #error "LAYER_TIME_FAN is not compatible with LASER_SYNCHRONOUS_M106_M107."
+  #elif !WITHIN(LAYER_FAN_FAST_TIME, 0, 255) || !WITHIN(LAYER_FAN_SLOW_TIME, 0, 255)
+    #error "LAYER_FAN_FAST_TIME and LAYER_FAN_SLOW_TIME must be between 0 and 255."
+  #elif LAYER_FAN_FAST_TIME >= LAYER_FAN_SLOW_TIME
+    #error "LAYER_FAN_FAST_TIME must be less than LAYER_FAN_SLOW_TIME."
+  #elif !WITHIN(LAYER_FAN_MAX_SPEED, 1, 255)
+    #error "LAYER_FAN_MAX_SPEED must be between 1 and 255."
+  #endif
 #endif
 
 /**
@@ -2782,6 +3163,181 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(EEPROM_BACKGROUND_WRITE)
+  #if DISABLED(IIC_BL24CXX_EEPROM)
+    #error "EEPROM_BACKGROUND_WRITE requires IIC_BL24CXX_EEPROM."
+  #elif !defined(HAL_STM32)
+    #error "EEPROM_BACKGROUND_WRITE is currently only supported on STM32 (HAL_STM32)."
+  #endif
+#endif
+
+#if ENABLED(ISR_CODE_IN_RAM) && !defined(ARDUINO_ARCH_STM32)
+  #error "ISR_CODE_IN_RAM requires an STM32 (HAL/STM32) environment."
+#endif
+
+#if ENABLED(BD_SENSOR_FILTER)
+  #if DISABLED(BABYSTEPPING)
+    #error "BD_SENSOR_FILTER requires BABYSTEPPING."
+  #elif !WITHIN(BD_SENSOR_ADJUST_MS, 5, 200)
+    #error "BD_SENSOR_ADJUST_MS must be from 5 to 200."
+  #endif
+  static_assert(BD_SENSOR_ADJUST_GAIN > 0 && BD_SENSOR_ADJUST_GAIN <= 1, "BD_SENSOR_ADJUST_GAIN must be greater than 0 and at most 1.");
+#endif
+
+#if ENABLED(ASSISTED_TRAMMING_LIVE)
+  #if DISABLED(ASSISTED_TRAMMING)
+    #error "ASSISTED_TRAMMING_LIVE requires ASSISTED_TRAMMING."
+  #elif !HAS_RESUME_CONTINUE
+    #error "ASSISTED_TRAMMING_LIVE requires EMERGENCY_PARSER or an LCD controller."
+  #endif
+  static_assert(TRAMMING_LIVE_TOLERANCE > 0, "TRAMMING_LIVE_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(TFT_LVGL_DMA_FLUSH)
+  #if ENABLED(USE_SPI_DMA_TC)
+    #error "TFT_LVGL_DMA_FLUSH and USE_SPI_DMA_TC are both DMA flush methods. Enable only one."
+  #elif ENABLED(TFT_SHARED_IO)
+    #error "TFT_LVGL_DMA_FLUSH is not compatible with TFT_SHARED_IO."
+  #elif !ANY(HAL_STM32, __STM32F1__)
+    #error "TFT_LVGL_DMA_FLUSH is only supported on STM32 (HAL_STM32 or STM32F1)."
+  #endif
+#endif
+
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "EEPROM_LAZY_LOAD requires EEPROM_SETTINGS."
+  #elif DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "EEPROM_LAZY_LOAD requires AUTO_BED_LEVELING_BILINEAR."
+  #elif HAS_MARLINUI_MENU
+    #error "EEPROM_LAZY_LOAD is not compatible with the MarlinUI menus."
+  #endif
+#endif
+
+#if ENABLED(SD_DIR_INDEX) && !WITHIN(SD_DIR_INDEX_LIMIT, 16, 4096)
+  #error "SD_DIR_INDEX_LIMIT must be from 16 to 4096."
+#endif
+
+#if ENABLED(SD_MULTIBLOCK_READ) && !(NEED_SD2CARD_SPI || (NEED_SD2CARD_SDIO && defined(HAL_STM32)))
+  #error "SD_MULTIBLOCK_READ only applies to SPI SD cards and STM32 SDIO."
+#endif
+
+#if ENABLED(SD_MULTIBLOCK_WRITE)
+  #if !NEED_SD2CARD_SPI
+    #error "SD_MULTIBLOCK_WRITE only applies to SPI SD cards."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_MULTIBLOCK_WRITE is not compatible with SDCARD_READONLY."
+  #endif
+#endif
+
+#if ENABLED(MSC_SHARED_PRINTING)
+  #if !HAS_SD_HOST_DRIVE
+    #error "MSC_SHARED_PRINTING requires an SD card shared over USB (USBD_USE_CDC_MSC)."
+  #elif !defined(HAL_STM32)
+    #error "MSC_SHARED_PRINTING is only for HAL/STM32."
+  #endif
+#endif
+
+#if ENABLED(SD_SPI_DMA)
+  #if !NEED_SD2CARD_SPI
+    #error "SD_SPI_DMA only applies to SPI SD cards."
+  #elif !defined(HAL_STM32)
+    #error "SD_SPI_DMA is only for HAL/STM32. (STM32F1 with HAL/STM32F1 already uses DMA.)"
+  #endif
+#endif
+
+#if ENABLED(SD_ASYNC_MOUNT)
+  #if !HAS_MEDIA
+    #error "SD_ASYNC_MOUNT requires SDSUPPORT."
+  #elif ENABLED(SD_IGNORE_AT_STARTUP)
+    #error "SD_ASYNC_MOUNT is not compatible with SD_IGNORE_AT_STARTUP."
+  #endif
+#endif
+
+#if ENABLED(SD_READ_BENCHMARK) && !HAS_MEDIA
+  #error "SD_READ_BENCHMARK requires SDSUPPORT."
+#endif
+
+#if ENABLED(SD_LAYER_INDEX)
+  #if DISABLED(POWER_LOSS_RECOVERY)
+    #error "SD_LAYER_INDEX requires POWER_LOSS_RECOVERY."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_LAYER_INDEX is not compatible with SDCARD_READONLY."
+  #elif !WITHIN(SD_LAYER_INDEX_BUFFER, 1, 64)
+    #error "SD_LAYER_INDEX_BUFFER must be from 1 to 64."
+  #endif
+#endif
+
+#ifdef GCODE_REPEAT_CACHE
+  #if DISABLED(GCODE_REPEAT_MARKERS)
+    #error "GCODE_REPEAT_CACHE requires GCODE_REPEAT_MARKERS."
+  #elif ENABLED(CANCEL_OBJECTS_SD_SKIP)
+    #error "GCODE_REPEAT_CACHE is not compatible with CANCEL_OBJECTS_SD_SKIP."
+  #elif !WITHIN(GCODE_REPEAT_CACHE, 256, 65535)
+    #error "GCODE_REPEAT_CACHE must be from 256 to 65535."
+  #endif
+#endif
+
+#if ENABLED(SD_JOB_QUEUE)
+  #if !HAS_MEDIA
+    #error "SD_JOB_QUEUE requires SDSUPPORT."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_JOB_QUEUE is not compatible with SDCARD_READONLY."
+  #endif
+#endif
+
+#if ENABLED(GCODE_THUMBNAILS)
+  #if !HAS_MEDIA
+    #error "GCODE_THUMBNAILS requires SDSUPPORT or another media source."
+  #elif !WITHIN(GCODE_THUMBNAIL_CACHE, 1, 32)
+    #error "GCODE_THUMBNAIL_CACHE must be from 1 to 32."
+  #endif
+#endif
+#if ENABLED(GCODE_METADATA_INDEX)
+  #if !HAS_MEDIA
+    #error "GCODE_METADATA_INDEX requires SDSUPPORT or another media source."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "GCODE_METADATA_INDEX is not compatible with SDCARD_READONLY."
+  #endif
+#endif
+#if defined(DGUS_THUMBNAIL_VP) && DISABLED(GCODE_THUMBNAILS)
+  #error "DGUS_THUMBNAIL_VP requires GCODE_THUMBNAILS."
+#endif
+#if ENABLED(DGUS_PERF_PAGE) && !DGUS_UI_IS(CR6_COMM)
+  #error "DGUS_PERF_PAGE requires DGUS_LCD_UI_CR6_COMM."
+#endif
+
+#if ENABLED(SD_READ_AHEAD)
+  #if !HAS_MEDIA
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif !WITHIN(SD_READ_AHEAD_BUFFERS, 2, 8)
+    #error "SD_READ_AHEAD_BUFFERS must be from 2 to 8."
+  #endif
+#endif
+
+#if ENABLED(SD_JOB_CACHE)
+  #if DISABLED(SPI_FLASH)
+    #error "SD_JOB_CACHE requires SPI_FLASH."
+  #elif DISABLED(SD_READ_AHEAD)
+    #error "SD_JOB_CACHE requires SD_READ_AHEAD."
+  #elif (SD_JOB_CACHE_ADDR & 0xFFF) || (SD_JOB_CACHE_SIZE & 0xFFF) || !SD_JOB_CACHE_SIZE
+    #error "SD_JOB_CACHE_ADDR and SD_JOB_CACHE_SIZE must be multiples of 4K (0x1000)."
+  #elif ENABLED(POWER_LOSS_STORE_SPI_FLASH) && POWER_LOSS_STORE_ADDR >= SD_JOB_CACHE_ADDR && POWER_LOSS_STORE_ADDR < SD_JOB_CACHE_ADDR + SD_JOB_CACHE_SIZE
+    #error "POWER_LOSS_STORE_ADDR must be outside of the SD_JOB_CACHE area."
+  #endif
+#endif
+
+#if ENABLED(SD_COMPACT_MOVES) && ENABLED(SDCARD_READONLY)
+  #error "SD_COMPACT_MOVES is not compatible with SDCARD_READONLY."
+#endif
+
+#if ANY(SD_HEATSHRINK, SD_BINARY_GCODE)
+  #if !HAS_MEDIA
+    #error "SD_HEATSHRINK and SD_BINARY_GCODE require SDSUPPORT."
+  #elif !WITHIN(SD_DECODE_BUFFER, 16, 512)
+    #error "SD_DECODE_BUFFER must be from 16 to 512."
+  #endif
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -3636,6 +4192,35 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif // HYBRID_THRESHOLD
 
+#if ENABLED(TMC_CRUISE_CURRENT)
+  #if !(AXIS_IS_TMC_CONFIG(X) || AXIS_IS_TMC_CONFIG(Y))
+    #error "TMC_CRUISE_CURRENT requires TMC drivers with UART or SPI on X or Y."
+  #elif !WITHIN(TMC_CRUISE_CURRENT_PERCENT, 10, 99)
+    #error "TMC_CRUISE_CURRENT_PERCENT must be between 10 and 99."
+  #elif TMC_CRUISE_MARGIN_MS < 5
+    #error "TMC_CRUISE_MARGIN_MS must be at least 5."
+  #endif
+#endif
+
+#if ENABLED(TMC_STALL_DETECT)
+  #if !(AXIS_DRIVER_TYPE_X(TMC2209) && AXIS_DRIVER_TYPE_Y(TMC2209))
+    #error "TMC_STALL_DETECT requires TMC2209 drivers on X and Y."
+  #elif IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+    #error "TMC_STALL_DETECT requires separate X and Y motors."
+  #endif
+  constexpr uint16_t sdmin[] = STALL_DETECT_SG_MIN;
+  static_assert(COUNT(sdmin) == 2, "STALL_DETECT_SG_MIN must have 2 elements (X and Y).");
+  static_assert(WITHIN(STALL_DETECT_SAMPLES, 1, 255), "STALL_DETECT_SAMPLES must be between 1 and 255.");
+#endif
+
+#if ENABLED(HYBRID_THRESHOLD_LOOKAHEAD)
+  #if DISABLED(HYBRID_THRESHOLD)
+    #error "HYBRID_THRESHOLD_LOOKAHEAD requires HYBRID_THRESHOLD."
+  #elif !WITHIN(HYBRID_LOOKAHEAD_HYSTERESIS, 0, 90)
+    #error "HYBRID_LOOKAHEAD_HYSTERESIS must be between 0 and 90."
+  #endif
+#endif
+
 // Other TMC feature requirements
 #if ENABLED(SENSORLESS_HOMING) && !HAS_STALLGUARD
   #error "SENSORLESS_HOMING requires TMC2130, TMC2160, TMC2209, TMC2240, TMC2660, or TMC5160 stepper drivers."
@@ -3896,6 +4481,20 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif ALL(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_RECORDS, 1, 1024)
+    #error "POWER_LOSS_JOURNAL_RECORDS must be between 1 and 1024."
+  #elif HAS_PLR_STORE && DISABLED(POWER_LOSS_JOURNAL)
+    #error "POWER_LOSS_STORE_SPI_FLASH and POWER_LOSS_STORE_BACKUP_SRAM require POWER_LOSS_JOURNAL."
+  #elif ALL(POWER_LOSS_STORE_SPI_FLASH, POWER_LOSS_STORE_BACKUP_SRAM)
+    #error "Enable only one of POWER_LOSS_STORE_SPI_FLASH or POWER_LOSS_STORE_BACKUP_SRAM."
+  #elif ENABLED(POWER_LOSS_STORE_SPI_FLASH) && DISABLED(SPI_FLASH)
+    #error "POWER_LOSS_STORE_SPI_FLASH requires SPI_FLASH."
+  #elif ENABLED(POWER_LOSS_STORE_SPI_FLASH) && !defined(POWER_LOSS_STORE_ADDR)
+    #error "POWER_LOSS_STORE_SPI_FLASH requires POWER_LOSS_STORE_ADDR."
+  #elif ENABLED(POWER_LOSS_STORE_BACKUP_SRAM) && (DISABLED(HAL_STM32) || NONE(STM32F1xx, STM32F4xx, STM32F7xx))
+    #error "POWER_LOSS_STORE_BACKUP_SRAM is only supported on STM32F1, STM32F4 and STM32F7."
+  #elif ALL(POWER_LOSS_STORE_BACKUP_SRAM, SRAM_EEPROM_EMULATION) && NONE(STM32F1xx)
+    #error "POWER_LOSS_STORE_BACKUP_SRAM and SRAM_EEPROM_EMULATION can't both use the backup SRAM."
   #endif
 #endif
 
@@ -3966,10 +4565,21 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
                   "BACKLASH_COMPENSATION can only apply to " STRINGIFY(NORMAL_AXIS) " with your CORE system.");
     #endif
   #endif
+  #if ENABLED(BACKLASH_STEPPER)
+    #if IS_KINEMATIC || IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+      #error "BACKLASH_STEPPER requires Cartesian kinematics."
+    #elif NUM_AXES > 3
+      #error "BACKLASH_STEPPER only supports the X, Y, and Z axes."
+    #elif ENABLED(FT_MOTION)
+      #error "BACKLASH_STEPPER is not compatible with FT_MOTION."
+    #endif
+  #endif
 #endif
 
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
   #error "GRADIENT_MIX requires 2 or more MIXING_VIRTUAL_TOOLS."
+#elif ENABLED(GRADIENT_MIX_PER_STEP) && DISABLED(GRADIENT_MIX)
+  #error "GRADIENT_MIX_PER_STEP requires GRADIENT_MIX."
 #endif
 
 /**
@@ -4058,6 +4668,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
       #if DISABLED(SPINDLE_LASER_USE_PWM)
         #error "LASER_POWER_TRAP requires SPINDLE_LASER_USE_PWM to function."
       #endif
+    #elif ENABLED(LASER_POWER_TRAP_RATE)
+      #error "LASER_POWER_TRAP_RATE requires LASER_POWER_TRAP."
     #endif
   #else
     #if SPINDLE_LASER_POWERUP_DELAY < 1
@@ -4254,6 +4866,105 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
+#if ENABLED(OK_COALESCE) && !WITHIN(OK_COALESCE_LINES, 2, BUFSIZE)
+  #error "OK_COALESCE_LINES must be from 2 to BUFSIZE."
+#endif
+
+#if ENABLED(SERIAL_CRC16_CHECKSUM) && DISABLED(SERIAL_LINE_CHECK)
+  #error "SERIAL_CRC16_CHECKSUM requires SERIAL_LINE_CHECK."
+#endif
+
+#if ENABLED(SERIAL_SELECTIVE_RESEND) && !WITHIN(SERIAL_RESEND_WINDOW, 1, 8)
+  #error "SERIAL_RESEND_WINDOW must be from 1 to 8."
+#endif
+
+#if ENABLED(ETHERNET_STREAM) && ETHERNET_STREAM_ACK_LINES < 1
+  #error "ETHERNET_STREAM_ACK_LINES must be 1 or more."
+#endif
+
+#if ENABLED(TOOLCHANGE_PLANNED_MOVES)
+  #if IS_KINEMATIC
+    #error "TOOLCHANGE_PLANNED_MOVES requires a Cartesian machine."
+  #elif ANY(DUAL_X_CARRIAGE, PARKING_EXTRUDER, MAGNETIC_PARKING_EXTRUDER, SWITCHING_TOOLHEAD, MAGNETIC_SWITCHING_TOOLHEAD, ELECTROMAGNETIC_SWITCHING_TOOLHEAD, SWITCHING_NOZZLE, SWITCHING_EXTRUDER, MECHANICAL_SWITCHING_EXTRUDER, MECHANICAL_SWITCHING_NOZZLE, EXT_SOLENOID, HAS_PRUSA_MMU2, HAS_PRUSA_MMU3)
+    #error "TOOLCHANGE_PLANNED_MOVES can't be used with a tool-change mechanism that needs its moves to finish."
+  #endif
+#endif
+#ifdef TOOLCHANGE_PREHEAT_LINES
+  #if !HAS_TOOLCHANGE_PREHEAT
+    #error "TOOLCHANGE_PREHEAT_LINES requires more than one extruder and hotend."
+  #elif TOOLCHANGE_PREHEAT_LINES < 1
+    #error "TOOLCHANGE_PREHEAT_LINES must be 1 or greater."
+  #endif
+#endif
+
+#if ENABLED(SERIAL_LINE_BUFFER) && !WITHIN(SERIAL_LINE_BUFFER_SIZE, 16, 255)
+  #error "SERIAL_LINE_BUFFER_SIZE must be from 16 to 255."
+#endif
+
+#if ENABLED(FAST_MOVE_PARSER) && DISABLED(FASTER_GCODE_PARSER)
+  #error "FAST_MOVE_PARSER requires FASTER_GCODE_PARSER."
+#endif
+
+#if ENABLED(PLANNER_SEGMENT_BATCH) && !WITHIN(PLANNER_SEGMENT_BATCH, 2, (BLOCK_BUFFER_SIZE) / 2)
+  #error "PLANNER_SEGMENT_BATCH must be between 2 and half of BLOCK_BUFFER_SIZE."
+#endif
+
+#if ENABLED(SERIAL_PORT_FAIRNESS)
+  #if !HAS_MULTI_SERIAL
+    #error "SERIAL_PORT_FAIRNESS requires SERIAL_PORT_2."
+  #elif !WITHIN(SERIAL_PORT_QUEUE_QUOTA, 1, BUFSIZE - 1)
+    #error "SERIAL_PORT_QUEUE_QUOTA must be from 1 to BUFSIZE - 1."
+  #endif
+#endif
+
+#if ENABLED(MEMORY_MONITOR)
+  #if !defined(HAL_STM32) && !defined(__STM32F1__)
+    #error "MEMORY_MONITOR is only for STM32 (HAL/STM32 or HAL/STM32F1)."
+  #elif ENABLED(M100_FREE_MEMORY_WATCHER)
+    #error "MEMORY_MONITOR and M100_FREE_MEMORY_WATCHER both fill the free RAM. Enable only one."
+  #endif
+#endif
+
+#if ENABLED(BINARY_TELEMETRY) && !WITHIN(BINARY_TELEMETRY_MAX_RATE, 1, 50)
+  #error "BINARY_TELEMETRY_MAX_RATE must be from 1 to 50."
+#endif
+
+#ifdef BINARY_STREAM_WINDOW
+  #if !WITHIN(BINARY_STREAM_WINDOW, 2, 16)
+    #error "BINARY_STREAM_WINDOW must be from 2 to 16."
+  #elif ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+    #if defined(RX_BUFFER_SIZE) && RX_BUFFER_SIZE < (MAX_CMD_SIZE) + 10
+      #error "RX_BUFFER_SIZE must hold a packet of MAX_CMD_SIZE + 10 bytes."
+    #endif
+  #elif defined(RX_BUFFER_SIZE) && RX_BUFFER_SIZE < (BINARY_STREAM_WINDOW) * ((MAX_CMD_SIZE) + 10)
+    #error "RX_BUFFER_SIZE must hold BINARY_STREAM_WINDOW packets of MAX_CMD_SIZE + 10 bytes."
+  #endif
+#elif ENABLED(BINARY_STREAM_SELECTIVE_REPEAT)
+  #error "BINARY_STREAM_SELECTIVE_REPEAT requires BINARY_STREAM_WINDOW."
+#endif
+#if ALL(HAS_MEATPACK, BINARY_MOVE_COMMANDS)
+  #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_MOVE_COMMANDS, not both."
+#endif
+
+/**
+ * Sanity Check for the Packed Command Queue
+ */
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #ifndef COMMAND_POOL_SIZE
+    #error "PACKED_COMMAND_QUEUE requires COMMAND_POOL_SIZE."
+  #elif COMMAND_POOL_SIZE < 2 * (MAX_CMD_SIZE)
+    #error "COMMAND_POOL_SIZE must be at least 2 * MAX_CMD_SIZE."
+  #elif COMMAND_POOL_SIZE > 65535
+    #error "COMMAND_POOL_SIZE must be 65535 or less."
+  #elif MAX_CMD_SIZE > 255
+    #error "PACKED_COMMAND_QUEUE requires a MAX_CMD_SIZE of 255 or less."
+  #endif
+#endif
+
+#if ENABLED(BUFFER_ARENA) && DISABLED(PACKED_COMMAND_QUEUE)
+  #error "BUFFER_ARENA requires PACKED_COMMAND_QUEUE."
+#endif
+
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
  */
@@ -4401,6 +5112,32 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+#if ENABLED(EXTUI_EVENT_QUEUE)
+  #if HAS_DWIN_E3V2
+    #error "EXTUI_EVENT_QUEUE is not supported with DWIN_LCD_PROUI."
+  #elif !WITHIN(EXTUI_EVENT_QUEUE_SIZE, 2, 255)
+    #error "EXTUI_EVENT_QUEUE_SIZE must be between 2 and 255."
+  #endif
+#endif
+
+#if DGUS_UI_IS(CR6_COMM) && !WITHIN(DGUS_RX_QUEUE_SIZE, (DGUS_RX_BUFFER_SIZE) + 2, 4096)
+  #error "DGUS_RX_QUEUE_SIZE must be between DGUS_RX_BUFFER_SIZE + 2 and 4096."
+#endif
+#if ENABLED(DGUS_VP_BATCHING)
+  #if !HAS_DGUS_TRANSPORT
+    #error "DGUS_VP_BATCHING requires DGUS_LCD_UI ORIGIN, FYSETC, HIPRECY, MKS, RELOADED, E3S1PRO, or CR6_COMM."
+  #elif !WITHIN(DGUS_VP_BATCH_SIZE, 2, 250)
+    #error "DGUS_VP_BATCH_SIZE must be between 2 and 250."
+  #endif
+#endif
+#if ENABLED(DGUS_VP_CACHE)
+  #if !HAS_DGUS_TRANSPORT
+    #error "DGUS_VP_CACHE requires DGUS_LCD_UI ORIGIN, FYSETC, HIPRECY, MKS, RELOADED, E3S1PRO, or CR6_COMM."
+  #elif DGUS_VP_CACHE_SIZE < 1
+    #error "DGUS_VP_CACHE_SIZE must be at least 1."
+  #endif
+#endif
+
 /**
  * Require certain features for DGUS_LCD_UI IA_CREALITY.
  */
@@ -4475,6 +5212,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "Direct Stepping is not supported on 32-bit boards."
   #elif !IS_FULL_CARTESIAN
     #error "Direct Stepping is incompatible with enabled kinematics."
+  #elif !WITHIN(STEPPER_PAGES, 4, 256) || STEPPER_PAGES % 4
+    #error "STEPPER_PAGES must be a multiple of 4 from 4 to 256."
   #endif
 #endif
 
@@ -4528,6 +5267,41 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     TERN_(INPUT_SHAPING_X, static_assert((SHAPING_FREQ_X) > 0, "SHAPING_FREQ_X must be > 0 or SHAPING_MIN_FREQ must be set."));
     TERN_(INPUT_SHAPING_Y, static_assert((SHAPING_FREQ_Y) > 0, "SHAPING_FREQ_Y must be > 0 or SHAPING_MIN_FREQ must be set."));
     TERN_(INPUT_SHAPING_Z, static_assert((SHAPING_FREQ_Z) > 0, "SHAPING_FREQ_Z must be > 0 or SHAPING_MIN_FREQ must be set."));
+    TERN_(INPUT_SHAPING_E, static_assert((SHAPING_FREQ_E) > 0, "SHAPING_FREQ_E must be > 0 or SHAPING_MIN_FREQ must be set."));
+  #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    #if E_STEPPERS > 1 || ENABLED(MIXING_EXTRUDER)
+      #error "INPUT_SHAPING_E requires a single extruder stepper."
+    #elif ENABLED(INPUT_SHAPING_E_SYNC)
+      #error "INPUT_SHAPING_E and INPUT_SHAPING_E_SYNC can't be used together. Disable one of them."
+    #endif
+  #endif
+  #if ENABLED(SHAPING_RUN_QUEUE)
+    #if SHAPING_QUEUE_RUNS < 2 * MULTISTEPPING_LIMIT || SHAPING_QUEUE_RUNS > 65535
+      #error "SHAPING_QUEUE_RUNS must be between 2 * MULTISTEPPING_LIMIT and 65535."
+    #elif SHAPING_RUN_TOLERANCE < 0
+      #error "SHAPING_RUN_TOLERANCE must be >= 0."
+    #endif
+  #endif
+  #if ENABLED(RESONANCE_TUNING)
+    #if NONE(HAL_STM32, __STM32F1__)
+      #error "RESONANCE_TUNING requires an STM32 board."
+    #elif NONE(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+      #error "RESONANCE_TUNING requires INPUT_SHAPING_X and/or INPUT_SHAPING_Y."
+    #elif ENABLED(ACCEL_ADXL345) == ENABLED(ACCEL_LIS2DW)
+      #error "RESONANCE_TUNING requires one of ACCEL_ADXL345 or ACCEL_LIS2DW."
+    #elif !PIN_EXISTS(ACCEL_CS)
+      #error "RESONANCE_TUNING requires ACCEL_CS_PIN."
+    #elif !WITHIN(ACCEL_AXIS_X, 0, 2) || !WITHIN(ACCEL_AXIS_Y, 0, 2)
+      #error "ACCEL_AXIS_X and ACCEL_AXIS_Y must be 0, 1 or 2."
+    #endif
+    static_assert(0 < (RESONANCE_FREQ_MIN) && (RESONANCE_FREQ_MIN) < (RESONANCE_FREQ_MAX) && (RESONANCE_FREQ_MAX) < 400, "RESONANCE_FREQ_MIN and RESONANCE_FREQ_MAX must be rising, within 0-400 Hz.");
+    static_assert((RESONANCE_ACCEL_PER_HZ) > 0 && (RESONANCE_SWEEP_RATE) > 0, "RESONANCE_ACCEL_PER_HZ and RESONANCE_SWEEP_RATE must be > 0.");
+  #endif
+  #if !WITHIN(SHAPING_MAX_IMPULSES, 2, 4)
+    #error "SHAPING_MAX_IMPULSES must be 2, 3 or 4."
+  #elif SHAPING_MAX_IMPULSES > 2 && defined(__AVR__)
+    #error "SHAPING_MAX_IMPULSES > 2 is not supported on AVR."
   #endif
   #ifdef __AVR__
     #if ENABLED(INPUT_SHAPING_X)
@@ -4551,6 +5325,13 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
         static_assert((SHAPING_FREQ_Z) == 0 || (SHAPING_FREQ_Z) * 2 * 0x10000 >= (STEPPER_TIMER_RATE), "SHAPING_FREQ_Z is below the minimum (16) for AVR 16MHz.");
       #endif
     #endif
+    #if ENABLED(INPUT_SHAPING_E)
+      #if F_CPU > 16000000
+        static_assert((SHAPING_FREQ_E) == 0 || (SHAPING_FREQ_E) * 2 * 0x10000 >= (STEPPER_TIMER_RATE), "SHAPING_FREQ_E is below the minimum (20) for AVR 20MHz.");
+      #else
+        static_assert((SHAPING_FREQ_E) == 0 || (SHAPING_FREQ_E) * 2 * 0x10000 >= (STEPPER_TIMER_RATE), "SHAPING_FREQ_E is below the minimum (16) for AVR 16MHz.");
+      #endif
+    #endif
   #endif
 #endif
 
@@ -4578,10 +5359,55 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     static_assert(FTM_SMOOTHING_TIME_Z <= FTM_MAX_SMOOTHING_TIME, "FTM_SMOOTHING_TIME_Z must be <= FTM_MAX_SMOOTHING_TIME.");
     static_assert(FTM_SMOOTHING_TIME_E <= FTM_MAX_SMOOTHING_TIME, "FTM_SMOOTHING_TIME_E must be <= FTM_MAX_SMOOTHING_TIME.");
   #endif
+  #if ENABLED(FTM_CUSTOM_SHAPER) && !WITHIN(FTM_CUSTOM_IMPULSES, 2, 16)
+    #error "FTM_CUSTOM_IMPULSES must be between 2 and 16."
+  #endif
+#endif
+
+#if ENABLED(PRINTCOUNTER_JOB_STATS) && PRINTCOUNTER_SAVE_INTERVAL > 0
+  #error "PRINTCOUNTER_JOB_STATS requires PRINTCOUNTER_SAVE_INTERVAL 0."
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_SD_SKIP) && !HAS_MEDIA
+  #error "CANCEL_OBJECTS_SD_SKIP requires SD or USB media."
+#endif
+
+// Junction Deviation cache
+#if ENABLED(JD_JUNCTION_CACHE) && !WITHIN(JD_JUNCTION_CACHE_SIZE, 1, 16)
+  #error "JD_JUNCTION_CACHE_SIZE must be from 1 to 16."
+#endif
+
+#if ENABLED(FWRETRACT_BLEND) && ENABLED(RETRACT_SYNC_MIXING)
+  #error "FWRETRACT_BLEND is not compatible with RETRACT_SYNC_MIXING."
 #endif
 
 // Multi-Stepping Limit
 static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING_LIMIT), "MULTISTEPPING_LIMIT must be 1, 2, 4, 8, 16, 32, 64, or 128.");
+#if ENABLED(SMOOTH_MULTISTEPPING)
+  #if ENABLED(OLD_ADAPTIVE_MULTISTEPPING)
+    #error "SMOOTH_MULTISTEPPING is incompatible with OLD_ADAPTIVE_MULTISTEPPING."
+  #elif MULTISTEPPING_LIMIT == 1
+    #error "SMOOTH_MULTISTEPPING requires MULTISTEPPING_LIMIT greater than 1."
+  #elif !WITHIN(MULTISTEPPING_HYSTERESIS, 1, 50)
+    #error "MULTISTEPPING_HYSTERESIS must be from 1 to 50."
+  #endif
+#endif
+
+// Step Port Batching
+#if ENABLED(STEP_PORT_BATCHING)
+  #ifndef HAL_STM32
+    #error "STEP_PORT_BATCHING requires an STM32 board."
+  #elif HAS_X2_STEPPER || HAS_Y2_STEPPER || NUM_Z_STEPPERS > 1
+    #error "STEP_PORT_BATCHING is not compatible with multiple X, Y, or Z steppers."
+  #elif ENABLED(MIXING_EXTRUDER) || E_STEPPERS > 1
+    #error "STEP_PORT_BATCHING is not compatible with MIXING_EXTRUDER or multiple E steppers."
+  #endif
+#endif
+
+// Dual-Core Motion
+#if ENABLED(DUAL_CORE_MOTION) && !defined(__PLAT_RP2040__) && !defined(ARDUINO_ARCH_ESP32)
+  #error "DUAL_CORE_MOTION requires an RP2040 or ESP32 board."
+#endif
 
 // One Click Print
 #if ENABLED(ONE_CLICK_PRINT)
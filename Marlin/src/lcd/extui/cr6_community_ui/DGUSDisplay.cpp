@@ -43,6 +43,9 @@
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../../../feature/powerloss.h"
 #endif
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../../../feature/flight_recorder.h"
+#endif
 
 #include "DGUSDisplay.h"
 #include "DGUSVPVariable.h"
@@ -66,6 +69,7 @@ constexpr uint8_t DGUS_CMD_READVAR = 0x83;
 
 void DGUSDisplay::InitDisplay() {
   dgusserial.begin(LCD_BAUDRATE);
+  DGUSTransport::invalidate();
 
   /*delay(500); // Attempt to fix possible handshake error
 
@@ -94,25 +98,23 @@ void DGUSDisplay::ResetDisplay() {
 }
 
 void DGUSDisplay::ReadVariable(uint16_t adr) {
-  WriteHeader(adr, DGUS_CMD_READVAR, sizeof(uint8_t));
-
-  // Specify to read one byte
-  dgusserial.write(static_cast<uint8_t>(1));
+  DGUSTransport::read(adr, 1);
 }
 
 void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr, char fillChar) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  char buff[valueslen];
+  for (uint8_t i = 0; i < valueslen; ++i) {
     char x;
     if (!strend) x = *myvalues++;
     if ((isstr && !x) || strend) {
       strend = true;
       x = fillChar;
     }
-    dgusserial.write(x);
+    buff[i] = x;
   }
+  DGUSTransport::write(adr, buff, valueslen);
 }
 
 void DGUSDisplay::WriteVariable(uint16_t adr, uint16_t value) {
@@ -165,16 +167,17 @@ void DGUSDisplay::WriteVariable(uint16_t adr, float value) {
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr, char fillChar) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  char buff[valueslen];
+  for (uint8_t i = 0; i < valueslen; ++i) {
     char x;
     if (!strend) x = pgm_read_byte(myvalues++);
     if ((isstr && !x) || strend) {
       strend = true;
       x = fillChar;
     }
-    dgusserial.write(x);
+    buff[i] = x;
   }
+  DGUSTransport::write(adr, buff, valueslen);
 }
 
 void DGUSDisplay::SetVariableDisplayColor(uint16_t sp, uint16_t color) {
@@ -218,83 +221,92 @@ void DGUSDisplay::ProcessRx() {
         rx_datagram_state = WITHIN(rx_datagram_len, 3, DGUS_RX_BUFFER_SIZE) ? DGUS_WAIT_TELEGRAM : DGUS_IDLE;
         break;
 
-      case DGUS_WAIT_TELEGRAM: // wait for complete datagram to arrive.
+      case DGUS_WAIT_TELEGRAM: { // wait for complete datagram to arrive.
         if (dgusserial.available() < rx_datagram_len) return;
 
         Initialized = true; // We've talked to it, so we defined it as initialized.
-        uint8_t command = dgusserial.read();
-
-       // DEBUGLCDCOMM_ECHOPAIR("# ", command);
 
-        uint8_t readlen = rx_datagram_len - 1;  // command is part of len.
-        unsigned char tmp[rx_datagram_len - 1];
-        unsigned char *ptmp = tmp;
-        while (readlen--) {
+        // Command and payload
+        unsigned char tmp[rx_datagram_len];
+        for (uint8_t i = 0; i < rx_datagram_len; ++i) {
           receivedbyte = dgusserial.read();
           //DEBUGLCDCOMM_ECHOPAIR(" ", receivedbyte);
-          *ptmp++ = receivedbyte;
+          tmp[i] = receivedbyte;
         }
-        //DEBUGLCDCOMM_ECHOPGM(" # ");
+        rx_datagram_state = DGUS_IDLE;
+
         // mostly we'll get this: 5A A5 03 82 4F 4B -- ACK on 0x82, so discard it.
-        if (command == DGUS_CMD_WRITEVAR && 'O' == tmp[0] && 'K' == tmp[1]) {
+        if (tmp[0] == DGUS_CMD_WRITEVAR && 'O' == tmp[1] && 'K' == tmp[2]) {
           //DEBUG_ECHOLNPGM(">");
-          rx_datagram_state = DGUS_IDLE;
           break;
         }
 
-        /* AutoUpload, (and answer to) Command 0x83 :
-        |      tmp[0  1  2  3  4 ... ]
-        | Example 5A A5 06 83 20 01 01 78 01 ……
-        |          / /  |  |   \ /   |  \     \
-        |        Header |  |    |    |   \_____\_ DATA (Words!)
-        |     DatagramLen  /  VPAdr  |
-        |           Command          DataLen (in Words) */
-        if (command == DGUS_CMD_READVAR) {
-          const uint16_t vp = tmp[0] << 8 | tmp[1];
-
-          //const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
-          //DEBUG_ECHOPAIR(" vp=", vp, " dlen=", dlen);
-          DGUS_VP_Variable ramcopy;
-          DEBUG_ECHOLNPAIR("VP received: ", vp , " - val ", tmp[3]);
-          if (populate_VPVar(vp, &ramcopy)) {
-            if (ramcopy.set_by_display_handler)
-              ramcopy.set_by_display_handler(ramcopy, &tmp[3]);
-            else
-              DEBUG_ECHOLNPGM(" VPVar found, no handler.");
-          }
-          else
-            DEBUG_ECHOLNPAIR(" VPVar not found:", vp);
-
-          rx_datagram_state = DGUS_IDLE;
+        // Queue the datagram until the UI is free to handle it
+        if (rx_queue.space() <= rx_datagram_len) {
+          DEBUG_ECHOLNPGM("RX queue full");
           break;
         }
-
-      // discard anything else
-      rx_datagram_state = DGUS_IDLE;
+        rx_queue.enqueue(rx_datagram_len);
+        for (uint8_t i = 0; i < rx_datagram_len; ++i) rx_queue.enqueue(tmp[i]);
+      } break;
     }
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return SERIAL_GET_TX_BUFFER_FREE(); }
-
-void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
-  dgusserial.write(DGUS_HEADER1);
-  dgusserial.write(DGUS_HEADER2);
-  dgusserial.write(payloadlen + 3);
-  dgusserial.write(cmd);
-  dgusserial.write(adr >> 8);
-  dgusserial.write(adr & 0xFF);
+void DGUSDisplay::DispatchRx() {
+  uint8_t len;
+  while (rx_queue.dequeue(len)) {
+    // Copy the datagram out, since a handler may queue more
+    unsigned char tmp[len];
+    for (uint8_t i = 0; i < len; ++i) rx_queue.dequeue(tmp[i]);
+
+    const uint8_t command = tmp[0];
+    // DEBUGLCDCOMM_ECHOPAIR("# ", command);
+
+    /* AutoUpload, (and answer to) Command 0x83 :
+    |      tmp[0  1  2  3  4  5 ... ]
+    | Example 5A A5 06 83 20 01 01 78 01 ……
+    |          / /  |  |   \ /   |  \     \
+    |        Header |  |    |    |   \_____\_ DATA (Words!)
+    |     DatagramLen  /  VPAdr  |
+    |           Command          DataLen (in Words) */
+    if (command == DGUS_CMD_READVAR) {
+      const uint16_t vp = tmp[1] << 8 | tmp[2];
+
+      //const uint8_t dlen = tmp[3] << 1;  // Convert to Bytes. (Display works with words)
+      //DEBUG_ECHOPAIR(" vp=", vp, " dlen=", dlen);
+      DGUS_VP_Variable ramcopy;
+      DEBUG_ECHOLNPAIR("VP received: ", vp , " - val ", tmp[4]);
+      DGUSTransport::forget(vp); // The display now holds a value we didn't send
+      if (populate_VPVar(vp, &ramcopy)) {
+        if (ramcopy.set_by_display_handler) {
+          TERN_(FLIGHT_RECORDER, const millis_t handler_ms = millis());
+          ramcopy.set_by_display_handler(ramcopy, &tmp[4]);
+          TERN_(FLIGHT_RECORDER, flight_recorder.record(FR_DGUS_HANDLER, uint8_t(_MIN(millis() - handler_ms, 255UL)), vp));
+        }
+        else
+          DEBUG_ECHOLNPGM(" VPVar found, no handler.");
+      }
+      else
+        DEBUG_ECHOLNPAIR(" VPVar not found:", vp);
+    }
+    // discard anything else
+  }
 }
 
-void DGUSDisplay::WritePGM(const char str[], uint8_t len) {
-  while (len--) dgusserial.write(pgm_read_byte(str++));
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  // Leave room for the pending write
+  return DGUSTransport::freeTxBuffer(SERIAL_GET_TX_BUFFER_FREE());
 }
 
 void DGUSDisplay::loop() {
-  // protect against recursion… ProcessRx() may indirectly call idle() when injecting gcode commands.
+  // Keep reading the display, even while a handler is busy, so touches aren't lost
+  ProcessRx();
+
+  // protect against recursion… DispatchRx() may indirectly call idle() when injecting gcode commands.
   if (!no_reentrance) {
     no_reentrance = true;
-    ProcessRx();
+    DispatchRx();
     no_reentrance = false;
   }
 }
@@ -335,6 +347,7 @@ void DGUSDisplay::SetTouchScreenConfiguration(bool enable_standby, bool enable_s
 
 rx_datagram_state_t DGUSDisplay::rx_datagram_state = DGUS_IDLE;
 uint8_t DGUSDisplay::rx_datagram_len = 0;
+SPSCQueue<uint8_t, DGUS_RX_QUEUE_SIZE> DGUSDisplay::rx_queue;
 bool DGUSDisplay::Initialized = false;
 bool DGUSDisplay::no_reentrance = false;
 DGUSLCD_Screens DGUSDisplay::displayRequest = DGUSLCD_SCREEN_BOOT;
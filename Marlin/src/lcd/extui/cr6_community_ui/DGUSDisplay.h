@@ -35,6 +35,8 @@
 #endif
 
 #include "DGUSVPVariable.h"
+#include "../dgus_common/DGUSTransport.h"
+#include "../../../libs/spscqueue.h"
 
 enum DGUSLCD_Screens : uint8_t;
 
@@ -77,6 +79,18 @@ public:
 
   static void ReadVariable(uint16_t adr);
 
+  // Between these calls writes to adjacent VPs are merged into one write (DGUS_VP_BATCHING)
+  static void BeginBatch() { DGUSTransport::beginBatch(); }
+  static void EndBatch() { DGUSTransport::endBatch(); }
+
+  // Forget the values sent, so the next updates are all sent (DGUS_VP_CACHE)
+  static void InvalidateVPCache() { DGUSTransport::invalidate(); }
+
+  #if ANY(DGUS_VP_CACHE, DGUS_VP_BATCHING)
+    // Serial bytes not sent thanks to the cache and batching
+    static uint32_t GetBytesSaved() { return DGUSTransport::bytesSaved(); }
+  #endif
+
   // Utility functions for bridging ui_api and dgus
   template<typename T, float(*Getter)(const T), T selector, typename WireType=uint16_t>
   static void SetVariable(DGUS_VP_Variable &var) {
@@ -108,13 +122,13 @@ public:
   static inline bool isInitialized() { return Initialized; }
 
 private:
-  static void WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
-  static void WritePGM(const char str[], uint8_t len);
-  static void ProcessRx();
+  static void ProcessRx();   // Frame the received datagrams into rx_queue
+  static void DispatchRx();  // Hand queued datagrams to the VP handlers
 
   static inline uint16_t swap16(const uint16_t value) { return (value & 0xffU) << 8U | (value >> 8U); }
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
+  static SPSCQueue<uint8_t, DGUS_RX_QUEUE_SIZE> rx_queue;  // Datagrams as [len][command][payload...]
   static bool Initialized, no_reentrance;
 
   static DGUSLCD_Screens displayRequest;
@@ -42,6 +42,25 @@ extern const struct VPMapping VPMap[];
 
 // List of VPs handled by Marlin / The Display.
 extern const struct DGUS_VP_Variable ListOfVP[];
+// Indexes of ListOfVP in ascending VP order, since the list itself is grouped by screen.
+extern const uint8_t * const ListOfVP_Order;
+extern const uint8_t ListOfVP_OrderCount;
+
+// How often an auto-updated VP is sent, declared per VP with the screen lists.
+enum class DGUS_VP_Refresh : uint8_t {
+  ALWAYS, // Every update (DGUS_UPDATE_INTERVAL_MS), the default
+  SLOW,   // Every DGUS_SLOW_UPDATE_PASSES updates
+  MOTION  // Only while the planner is busy, and once after
+};
+#define DGUS_SLOW_UPDATE_PASSES 4
+
+struct VPRefresh {
+  uint16_t VP;
+  DGUS_VP_Refresh refresh;
+};
+
+// The refresh class of each ListOfVP entry, by index
+extern const uint8_t * const ListOfVP_Refresh;
 
 #define DWIN_DEFAULT_FILLER_CHAR ' '
 #define DWIN_SCROLLER_FILLER_CHAR 0x0
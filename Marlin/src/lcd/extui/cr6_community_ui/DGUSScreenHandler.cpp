@@ -33,6 +33,9 @@
 // Include handlers from creality_touch so we can persist handler state
 #include "creality_touch/EstepsHandler.h"
 #include "creality_touch/PIDHandler.h"
+#if ENABLED(DGUS_PERF_PAGE)
+  #include "creality_touch/PerfPageHandler.h"
+#endif
 
 #include "../ui_api.h"
 #include "../../../MarlinCore.h"
@@ -47,6 +50,13 @@
 #include "../../../module/printcounter.h"
 #include "../../../feature/caselight.h"
 
+#if ENABLED(GCODE_THUMBNAILS)
+  #include "../../../feature/gcode_thumbnail.h"
+#endif
+#if ENABLED(GCODE_METADATA_INDEX)
+  #include "../../../feature/gcode_metadata.h"
+#endif
+
 // Forward declarations of M1125 helpers (defined in M1125.cpp)
 bool M1125_CheckAndHandleHeaterTimeout();
 uint32_t M1125_TimeoutRemainingSeconds();
@@ -82,6 +92,10 @@ void DGUSScreenHandler::SetSuppressPopupPauseResponse(bool suppress) {
   static ExtUI::FileList filelist;
 #endif
 
+#ifdef DGUS_THUMBNAIL_VP
+  uint16_t DGUSScreenHandler::thumbnail_vp, DGUSScreenHandler::thumbnail_bytes;
+#endif
+
 // Storage initialization
 constexpr uint8_t dwin_settings_version = 7; // Increased: new PID and ESteps fields added
 creality_dwin_settings_t DGUSScreenHandler::Settings = {.settings_size = sizeof(creality_dwin_settings_t)};
@@ -89,8 +103,13 @@ DGUSLCD_Screens DGUSScreenHandler::current_screen;
 DGUSLCD_Screens DGUSScreenHandler::past_screens[NUM_PAST_SCREENS] = {DGUSLCD_SCREEN_MAIN};
 uint8_t DGUSScreenHandler::update_ptr;
 uint16_t DGUSScreenHandler::skipVP;
+bool DGUSScreenHandler::FullUpdate;
+uint8_t DGUSScreenHandler::update_pass;
 bool DGUSScreenHandler::ScreenComplete;
 bool DGUSScreenHandler::SaveSettingsRequested;
+#if ENABLED(EEPROM_SECTION_SAVE)
+  uint8_t DGUSScreenHandler::SaveSectionsRequested;
+#endif
 
 #if DGUS_SYNCH_OPS_ENABLED
 bool DGUSScreenHandler::HasSynchronousOperation;
@@ -145,6 +164,19 @@ static_assert(GRID_MAX_POINTS_X == GRID_MAX_POINTS_Y, "Assuming bed leveling poi
 
 constexpr uint16_t SkipMeshPoint = GRID_MAX_POINTS_X > MESH_LEVEL_EDGE_MAX_POINTS ? ((GRID_MAX_POINTS_X - 1) / (GRID_MAX_POINTS_X - MESH_LEVEL_EDGE_MAX_POINTS)) : 1;
 
+#if HAS_MESH
+  // The mesh screen cells, by screen Y then X. A cell is only sent when its value changes.
+  static_assert(MESH_LEVEL_MAX_POINTS <= 16, "The mesh cell bits need a wider type.");
+  typedef struct {
+    float z;              // The latest value
+    float shown_z;        // The value and color last sent
+    uint16_t shown_color;
+  } mesh_cell_t;
+  static mesh_cell_t mesh_cells[MESH_LEVEL_MAX_POINTS];
+  static uint16_t mesh_cells_dirty,   // Cells to send
+                  mesh_cells_shown;   // Cells sent since boot
+#endif
+
 void DGUSScreenHandler::sendinfoscreen(const char* line1, const char* line2, const char* line3, const char* line4, bool l1inflash, bool l2inflash, bool l3inflash, bool l4inflash) {
   DGUS_VP_Variable ramcopy;
   if (populate_VPVar(VP_MSGSTR1, &ramcopy)) {
@@ -174,6 +206,13 @@ void DGUSScreenHandler::RequestSaveSettings() {
   SaveSettingsRequested = true;
 }
 
+#if ENABLED(EEPROM_SECTION_SAVE)
+  // Save only the given section, unless a full save is also pending
+  void DGUSScreenHandler::RequestSaveSettings(const MarlinSettings::SettingsSection section) {
+    SBI(SaveSectionsRequested, section);
+  }
+#endif
+
 void DGUSScreenHandler::DefaultSettings() {
   Settings.settings_size = sizeof(creality_dwin_settings_t);
   Settings.settings_version = dwin_settings_version;
@@ -753,10 +792,55 @@ void DGUSScreenHandler::DGUSLCD_SendHeaterStatusToDisplay(DGUS_VP_Variable &var)
     // Send print filename
     dgusdisplay.WriteVariable(VP_SD_Print_Filename, filelist.filename(), VP_SD_FileName_LEN, true);
 
+    #ifdef DGUS_THUMBNAIL_VP
+      // Hide the last thumbnail, then stream this one from loop()
+      dgusdisplay.WriteVariable(DGUS_THUMBNAIL_VP, uint16_t(0));
+      thumbnail_vp = DGUS_THUMBNAIL_VP + 1;
+      thumbnail_bytes = 0;
+      thumbnail.open(&card.getWorkDir(), filelist.shortFilename(), GcodeThumbnail::FMT_JPG, DGUS_THUMBNAIL_MAX_WIDTH);
+    #endif
+
+    // The slicer estimates, from the metadata index
+    char details[VP_MSGSTR4_LEN + 1] = "";
+    #if ENABLED(GCODE_METADATA_INDEX)
+      gcode_metadata_t meta;
+      if (gcodemeta.get(&card.getWorkDir(), filelist.shortFilename(), meta) && meta.print_time) {
+        char fil[10];
+        dtostrf(meta.filament / 1000.0f, 1, 2, fil);
+        snprintf_P(details, sizeof(details), PSTR("%luh%02lum %sm"), (unsigned long)(meta.print_time / 3600UL), (unsigned long)((meta.print_time / 60UL) % 60UL), fil);
+      }
+    #endif
+
     // Setup Confirmation screen
     file_to_print = touched_nr;
-    HandleUserConfirmationPopUp(VP_SD_FileSelectConfirm, PSTR("Print file"), filelist.filename(), PSTR("from SD Card?"), nullptr, true, false, true, true);
-  }
+    HandleUserConfirmationPopUp(VP_SD_FileSelectConfirm, PSTR("Print file"), filelist.filename(), PSTR("from SD Card?"), details[0] ? details : nullptr, true, false, true, false);
+  }
+
+  #ifdef DGUS_THUMBNAIL_VP
+    // Send the next few bytes of the thumbnail, when they fit in the Tx buffer
+    void DGUSScreenHandler::SendThumbnailChunk() {
+      if (!thumbnail.isOpen()) return;
+
+      constexpr uint8_t chunk = 32;
+      if (dgusdisplay.GetFreeTxBuffer() < chunk + 6) return;
+
+      uint8_t buf[chunk + 1];
+      const uint16_t n = thumbnail.read(buf, chunk);
+      if (n) {
+        // VPs are words, so an odd tail gets a pad byte
+        const uint8_t len = (n + 1) & ~1;
+        if (len > n) buf[n] = 0;
+        dgusdisplay.WriteVariable(thumbnail_vp, buf, len);
+        thumbnail_vp += len / 2;
+        thumbnail_bytes += n;
+      }
+
+      if (n < chunk) {
+        thumbnail.close();
+        dgusdisplay.WriteVariable(DGUS_THUMBNAIL_VP, thumbnail_bytes);
+      }
+    }
+  #endif
 
   void DGUSScreenHandler::SetPrintingFromHost() {
     const char* printFromHostString = PSTR("Printing from host");
@@ -1217,13 +1301,12 @@ void DGUSScreenHandler::SetViewMeshLevelState() {
 #if HAS_MESH
 void DGUSScreenHandler::InitMeshValues() {
   if (ExtUI::getMeshValid()) {
+    // The cells are sent from loop(), as the Tx buffer allows
     for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++) {
       for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
           float z = ExtUI::getMeshPoint({ x, y });
           UpdateMeshValue(x, y, z);
       }
-
-      safe_delay(100);
     }
 
     dgusdisplay.WriteVariable(VP_MESH_LEVEL_STATUS, static_cast<uint16_t>(DGUS_GRID_VISUALIZATION_START_ID + GRID_MAX_POINTS));
@@ -1237,8 +1320,6 @@ void DGUSScreenHandler::ResetMeshValues() {
     for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
         UpdateMeshValue(x, y, 0);
     }
-
-    safe_delay(100);
   }
 
   dgusdisplay.WriteVariable(VP_MESH_LEVEL_STATUS, static_cast<uint16_t>(DGUS_GRID_VISUALIZATION_START_ID));
@@ -1319,56 +1400,76 @@ void DGUSScreenHandler::UpdateMeshValue(const int8_t x, const int8_t y, const fl
   SERIAL_ECHOPAIR(" Y", y);
   SERIAL_ECHO(" Z");
   SERIAL_ECHO_F(z, 4);
+  SERIAL_ECHOLN("");
 
   // Determine the screen X and Y value
-  if (x % SkipMeshPoint != 0 || y % SkipMeshPoint != 0) {
-    // Skip this point
-    SERIAL_ECHOLN("");
-    return;
-  }
+  if (x % SkipMeshPoint != 0 || y % SkipMeshPoint != 0) return; // Skip this point
+
+  const uint8_t scrX = x / SkipMeshPoint, scrY = y / SkipMeshPoint;
+  if (scrX >= MESH_LEVEL_EDGE_MAX_POINTS || scrY >= MESH_LEVEL_EDGE_MAX_POINTS) return;
 
-  const uint8_t scrX = x / SkipMeshPoint;
-  const uint8_t scrY = y / SkipMeshPoint;
+  // Only a changed cell is sent
+  const uint8_t i = scrY * MESH_LEVEL_EDGE_MAX_POINTS + scrX;
+  mesh_cell_t &c = mesh_cells[i];
+  if (c.z == z && TEST(mesh_cells_shown | mesh_cells_dirty, i)) return;
+  c.z = z;
+  SBI(mesh_cells_dirty, i);
+}
 
-  // Each Y is a full edge of X values
-  const uint16_t vpAddr = VP_MESH_LEVEL_X0_Y0 + (scrY * MESH_LEVEL_VP_SIZE) + (scrX * MESH_LEVEL_VP_EDGE_SIZE);
+void DGUSScreenHandler::SendMeshCells() {
+  for (uint8_t i = 0; mesh_cells_dirty && i < MESH_LEVEL_MAX_POINTS; ++i) {
+    if (!TEST(mesh_cells_dirty, i)) continue;
 
-  // ... DWIN is inconsistently truncating floats. Examples: 0.1811 becomes 0.181, 0.1810 becomes 0.180. But 0.1800 is not 0.179
-  //     so we need to calculate a good number here that will not overflow
-  float displayZ = z;
-  
-  {
-    constexpr float correctionFactor = 0.0001;
+    // Room for the value and the color writes
+    if (dgusdisplay.GetFreeTxBuffer() < (6 + sizeof(float)) + (6 + sizeof(uint16_t))) return;
+    CBI(mesh_cells_dirty, i);
 
-    if (round(z * cpow(10,3)) == round((z + correctionFactor) * cpow(10,3))) {
-      // If we don't accidently overshoot to the next number, trick the display by upping the number 0.0001 💩
-      displayZ += correctionFactor;
+    mesh_cell_t &c = mesh_cells[i];
+    const float z = c.z;
+    const uint8_t scrX = i % MESH_LEVEL_EDGE_MAX_POINTS, scrY = i / MESH_LEVEL_EDGE_MAX_POINTS;
 
-      SERIAL_ECHO(" displayZ: ");
-      SERIAL_ECHO_F(z, 4);
+    // ... DWIN is inconsistently truncating floats. Examples: 0.1811 becomes 0.181, 0.1810 becomes 0.180. But 0.1800 is not 0.179
+    //     so we need to calculate a good number here that will not overflow
+    float displayZ = z;
+    {
+      constexpr float correctionFactor = 0.0001;
+
+      if (round(z * cpow(10,3)) == round((z + correctionFactor) * cpow(10,3))) {
+        // If we don't accidently overshoot to the next number, trick the display by upping the number 0.0001 💩
+        displayZ += correctionFactor;
+      }
     }
-  }
 
-  SERIAL_ECHOLN("");
+    uint16_t color = MESH_COLOR_NOT_MEASURED;
 
-  dgusdisplay.WriteVariable(vpAddr, displayZ);
+    // ... Only calculate if set
+    if (abs(z) > MESH_UNSET_EPSILON) {
+      // Determine color scale
+      float clampedZ = max(min(z, 0.5f),-0.5f) * -1;
+      float h = (clampedZ + 0.5f) * 240;
 
-  // Set color
-  const uint16_t spAddr = SP_MESH_LEVEL_X0_Y0 + (scrY * MESH_LEVEL_SP_SIZE) + (scrX * MESH_LEVEL_SP_EDGE_SIZE);
+      // Convert to RGB
+      color = CreateRgb(h, 1, 0.75);
+    }
 
-  uint16_t color = MESH_COLOR_NOT_MEASURED;
+    const bool shown = TEST(mesh_cells_shown, i);
 
-  // ... Only calculate if set
-  if (abs(z) > MESH_UNSET_EPSILON) {
-    // Determine color scale
-    float clampedZ = max(min(z, 0.5f),-0.5f) * -1;
-    float h = (clampedZ + 0.5f) * 240;
+    // Each Y is a full edge of X values
+    if (!shown || displayZ != c.shown_z) {
+      const uint16_t vpAddr = VP_MESH_LEVEL_X0_Y0 + (scrY * MESH_LEVEL_VP_SIZE) + (scrX * MESH_LEVEL_VP_EDGE_SIZE);
+      dgusdisplay.WriteVariable(vpAddr, displayZ);
+      c.shown_z = displayZ;
+    }
 
-    // Convert to RGB
-    color = CreateRgb(h, 1, 0.75);
-  }
+    // Set color
+    if (!shown || color != c.shown_color) {
+      const uint16_t spAddr = SP_MESH_LEVEL_X0_Y0 + (scrY * MESH_LEVEL_SP_SIZE) + (scrX * MESH_LEVEL_SP_EDGE_SIZE);
+      dgusdisplay.SetVariableDisplayColor(spAddr, color);
+      c.shown_color = color;
+    }
 
-  dgusdisplay.SetVariableDisplayColor(spAddr, color);
+    SBI(mesh_cells_shown, i);
+  }
 }
 
 void DGUSScreenHandler::HandleMeshPoint(DGUS_VP_Variable &var, void *val_ptr) {
@@ -1402,7 +1503,7 @@ void DGUSScreenHandler::HandleMeshPoint(DGUS_VP_Variable &var, void *val_ptr) {
   UpdateMeshValue(x, y, z);
   ExtUI::setMeshPoint({ x, y }, z);
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_MESH));
 }
 #endif
 #if HAS_COLOR_LEDS
@@ -1417,7 +1518,7 @@ void DGUSScreenHandler::HandleLED(DGUS_VP_Variable &var, void *val_ptr) {
   leds.set_color(leds.color);
 
   SERIAL_ECHOLNPAIR("HandleLED ", newValue);
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
 
   skipVP = var.VP; // don't overwrite value the next update time as the display might autoincrement in parallel
 }
@@ -1447,13 +1548,15 @@ const uint16_t* DGUSLCD_FindScreenVPMapList(uint8_t screen) {
 }
 
 const DGUS_VP_Variable* DGUSLCD_FindVPVar(const uint16_t vp) {
-  const DGUS_VP_Variable *ret = ListOfVP;
-  do {
+  // Binary search of the VP-sorted indexes
+  uint8_t lo = 0, hi = ListOfVP_OrderCount;
+  while (lo < hi) {
+    const uint8_t mid = (lo + hi) >> 1;
+    const DGUS_VP_Variable *ret = &ListOfVP[pgm_read_byte(&ListOfVP_Order[mid])];
     const uint16_t vpcheck = pgm_read_word(&(ret->VP));
-    if (vpcheck == 0) break;
     if (vpcheck == vp) return ret;
-    ++ret;
-  } while (1);
+    if (vpcheck < vp) lo = mid + 1; else hi = mid;
+  }
 
   DEBUG_ECHOLNPAIR("FindVPVar NOT FOUND ", vp);
   return nullptr;
@@ -1907,7 +2010,7 @@ void DGUSScreenHandler::HandleLiveAdjustZ(DGUS_VP_Variable &var, void *val_ptr,
 
   ExtUI::smartAdjustAxis_steps(steps, ExtUI::axis_t::Z, true);
 #if ENABLED(HAS_BED_PROBE) //  Without a probe the Z offset is applied using baby offsets, which aren't saved anyway.
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_PROBE_OFFSET));
 #endif
   ScreenHandler.ForceCompleteUpdate();
   ScreenHandler.skipVP = var.VP; // don't overwrite value the next update time as the display might autoincrement in parallel
@@ -1950,7 +2053,7 @@ void DGUSScreenHandler::HandleLEDToggle() {
   caselight.on = newState;
   caselight.update(newState);
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 }
 
@@ -1958,7 +2061,7 @@ void DGUSScreenHandler::HandleToggleTouchScreenMute(DGUS_VP_Variable &var, void
   Settings.display_sound = !Settings.display_sound;
   ScreenHandler.SetTouchScreenConfiguration();
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 
   ScreenHandler.skipVP = var.VP; // don't overwrite value the next update time as the display might autoincrement in parallel
@@ -1993,7 +2096,7 @@ void DGUSScreenHandler::HandleTouchScreenBrightnessSetting(DGUS_VP_Variable &var
   Settings.screen_brightness = newvalue;
   ScreenHandler.SetTouchScreenConfiguration();
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 }
 
@@ -2004,7 +2107,7 @@ void DGUSScreenHandler::HandleTouchScreenStandbyBrightnessSetting(DGUS_VP_Variab
   Settings.standby_screen_brightness = newvalue;
   ScreenHandler.SetTouchScreenConfiguration();
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 }
 
@@ -2015,7 +2118,7 @@ void DGUSScreenHandler::HandleTouchScreenStandbyTimeSetting(DGUS_VP_Variable &va
   Settings.standby_time_seconds = newvalue;
   ScreenHandler.SetTouchScreenConfiguration();
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 }
 
@@ -2025,7 +2128,7 @@ void DGUSScreenHandler::HandleToggleTouchScreenStandbySetting(DGUS_VP_Variable &
   Settings.display_standby = !Settings.display_standby;
   ScreenHandler.SetTouchScreenConfiguration();
 
-  RequestSaveSettings();
+  RequestSaveSettings(TERN_(EEPROM_SECTION_SAVE, MarlinSettings::SECTION_EXTUI));
   ForceCompleteUpdate();
 }
 
@@ -2097,9 +2200,19 @@ void DGUSScreenHandler::UpdateScreenVPData() {
     return;  // nothing to do, likely a bug or boring screen.
   }
 
+  // Position VPs are sent while moving, and in the pass after the move ends
+  static bool motion_pass, was_busy;
+  if (update_ptr == 0) {
+    const bool busy = planner.busy();
+    motion_pass = busy || was_busy;
+    was_busy = busy;
+  }
+
   // Round-robin updating of all VPs.
   VPList += update_ptr;
 
+  TERN_(DGUS_VP_BATCHING, dgusdisplay.BeginBatch());
+
   bool sent_one = false;
   do {
     uint16_t VP = pgm_read_word(VPList);
@@ -2107,14 +2220,28 @@ void DGUSScreenHandler::UpdateScreenVPData() {
     if (!VP) {
       update_ptr = 0;
       DEBUG_ECHOLNPGM(" UpdateScreenVPData done");
+      TERN_(DGUS_VP_BATCHING, dgusdisplay.EndBatch());
+      #if ANY(DGUS_VP_CACHE, DGUS_VP_BATCHING)
+        DEBUG_ECHOLNPAIR(" bytes saved: ", dgusdisplay.GetBytesSaved());
+      #endif
       ScreenComplete = true;
+      FullUpdate = false;
+      ++update_pass;
       return;  // Screen completed.
     }
 
     if (VP == skipVP) { skipVP = 0; continue; }
 
+    const DGUS_VP_Variable *pvp = DGUSLCD_FindVPVar(VP);
+    if (pvp && !FullUpdate) {
+      const DGUS_VP_Refresh refresh = DGUS_VP_Refresh(pgm_read_byte(&ListOfVP_Refresh[pvp - ListOfVP]));
+      if (refresh == DGUS_VP_Refresh::SLOW && update_pass % (DGUS_SLOW_UPDATE_PASSES)) continue;
+      if (refresh == DGUS_VP_Refresh::MOTION && !motion_pass) continue;
+    }
+
     DGUS_VP_Variable rcpy;
-    if (populate_VPVar(VP, &rcpy)) {
+    if (pvp) {
+      memcpy_P(&rcpy, pvp, sizeof(DGUS_VP_Variable));
       uint8_t expected_tx = 6 + rcpy.size;  // expected overhead is 6 bytes + payload.
       // Send the VP to the display, but try to avoid overrunning the Tx Buffer.
       // But send at least one VP, to avoid getting stalled.
@@ -2128,6 +2255,7 @@ void DGUSScreenHandler::UpdateScreenVPData() {
         DEBUG_ECHOLNPAIR(" tx almost full: ", x);
         UNUSED(x);
         //DEBUG_ECHOPAIR(" update_ptr ", update_ptr);
+        TERN_(DGUS_VP_BATCHING, dgusdisplay.EndBatch());
         ScreenComplete = false;
         return;  // please call again!
       }
@@ -2159,11 +2287,25 @@ bool DGUSScreenHandler::loop() {
     // Only save settings so many times in a second - otherwise the EEPROM chip gets overloaded and the watchdog reboots the CPU
     settings.save();
     SaveSettingsRequested = false;
+    TERN_(EEPROM_SECTION_SAVE, SaveSectionsRequested = 0);
   }
+  #if ENABLED(EEPROM_SECTION_SAVE)
+    else if (ELAPSED(ms, next_event_ms) && SaveSectionsRequested) {
+      for (uint8_t s = 0; s < MarlinSettings::SECTION_COUNT; ++s)
+        if (TEST(SaveSectionsRequested, s)) settings.save(MarlinSettings::SettingsSection(s));
+      SaveSectionsRequested = 0;
+    }
+  #endif
+
+  TERN_(DGUS_PERF_PAGE, PerfPageHandler::Tick());
 
   if (!IsScreenComplete() || ELAPSED(ms, next_event_ms)) {
     next_event_ms = ms + DGUS_UPDATE_INTERVAL_MS;
 
+    #if ENABLED(DGUS_PERF_PAGE)
+      if (current_screen == DGUSLCD_SCREEN_PERF && IsScreenComplete()) PerfPageHandler::Sample();
+    #endif
+
     UpdateScreenVPData();
   }
 
@@ -2213,6 +2355,14 @@ bool DGUSScreenHandler::loop() {
     }
   }
 
+  EstepsHandler::Update();
+
+  TERN_(HAS_MESH, SendMeshCells());
+
+  #ifdef DGUS_THUMBNAIL_VP
+    SendThumbnailChunk();
+  #endif
+
   // Check for any delayed status message and post it when due (owned buffer)
   const millis_t ms2 = millis();
   if (delayed_status_until && ELAPSED(ms2, delayed_status_until)) {
@@ -24,6 +24,7 @@
 #include "DGUSDisplay.h"
 #include "DGUSVPVariable.h"
 #include "../../../module/motion.h"
+#include "../../../module/settings.h"
 #include "../../../inc/MarlinConfig.h"
 // CR6 compat shims
 #include "cr6_compat.h"
@@ -85,6 +86,9 @@ public:
   static void OnPowerlossResume();
 
   static void RequestSaveSettings();
+  #if ENABLED(EEPROM_SECTION_SAVE)
+    static void RequestSaveSettings(const MarlinSettings::SettingsSection section);
+  #endif
 
   /// Send all 4 strings that are displayed on the infoscreen, confirmation screen and kill screen
   /// The bools specifing whether the strings are in RAM or FLASH.
@@ -181,6 +185,9 @@ public:
 
     static void UpdateMeshValue(const int8_t x, const int8_t y, const float z);
 
+    // Send the changed mesh cells that fit in the Tx buffer
+    static void SendMeshCells();
+
     static void HandleMeshPoint(DGUS_VP_Variable &var, void *val_ptr);
   #endif
 
@@ -458,7 +465,7 @@ static void Buzzer(const uint16_t frequency, const uint16_t duration);
   }
 
   /// Force an update of all VP on the current screen.
-  static inline void ForceCompleteUpdate() { update_ptr = 0; ScreenComplete = false; }
+  static inline void ForceCompleteUpdate() { update_ptr = 0; ScreenComplete = false; FullUpdate = true; TERN_(DGUS_VP_CACHE, dgusdisplay.InvalidateVPCache()); }
   /// Has all VPs sent to the screen
   static inline bool IsScreenComplete() { return ScreenComplete; }
 
@@ -491,6 +498,8 @@ private:
   static uint8_t update_ptr;    ///< Last sent entry in the VPList for the actual screen.
   static uint16_t skipVP;       ///< When updating the screen data, skip this one, because the user is interacting with it.
   static bool ScreenComplete;   ///< All VPs sent to screen?
+  static bool FullUpdate;       ///< Send every VP in this pass, whatever its refresh class
+  static uint8_t update_pass;   ///< Count of completed passes, for the SLOW refresh class
 
   static uint16_t ConfirmVP;    ///< context for confirm screen (VP that will be emulated-sent on "OK").
   // When true the popup's Continue/other buttons will NOT be mapped into
@@ -502,6 +511,9 @@ private:
   static uint8_t MeshLevelIndex;
   static uint8_t MeshLevelIconIndex;
   static bool SaveSettingsRequested;
+  #if ENABLED(EEPROM_SECTION_SAVE)
+    static uint8_t SaveSectionsRequested; // Bits of MarlinSettings::SettingsSection
+  #endif
   static bool HasScreenVersionMismatch;
 #if DGUS_SYNCH_OPS_ENABLED
   static bool HasSynchronousOperation;
@@ -518,6 +530,10 @@ private:
     static int16_t top_file;    ///< file on top of file chooser
     static int16_t file_to_print; ///< touched file to be confirmed
   #endif
+  #ifdef DGUS_THUMBNAIL_VP
+    static uint16_t thumbnail_vp, thumbnail_bytes; ///< Next VP and bytes sent of the streamed thumbnail
+    static void SendThumbnailChunk();
+  #endif
 
 private:
   FORCE_INLINE static DGUSLCD_Screens GetPreviousScreen() {
@@ -34,6 +34,9 @@
 #include "FilamentLoadUnloadHandler.h"
 #include "PIDHandler.h"
 #include "MeshValidationHandler.h"
+#if ENABLED(DGUS_PERF_PAGE)
+  #include "PerfPageHandler.h"
+#endif
 
 #include "../../../../module/temperature.h"
 #include "../../../../module/motion.h"
@@ -87,6 +90,20 @@ const char MarlinVersion[] PROGMEM = SHORT_BUILD_VERSION;
 #define VPList_CommonWithStatus VPList_HeatHotend VPList_HeatBed VP_Z_OFFSET, VP_Feedrate_Percentage, VP_BACK_BUTTON_STATE
 #define VPList_CommonWithHeatOnly VPList_HeatHotend VPList_HeatBed VP_BACK_BUTTON_STATE
 
+// ----- How often the auto-updated variables change. VPs not listed here are sent on every update.
+constexpr VPRefresh VPRefreshClasses[] = {
+  { VP_PrintProgress_Percentage, DGUS_VP_Refresh::SLOW },
+  { VP_PrintTimeProgressBar, DGUS_VP_Refresh::SLOW },
+  { VP_PrintTime, DGUS_VP_Refresh::SLOW },
+  { VP_PrintTimeWithRemainingVisible, DGUS_VP_Refresh::SLOW },
+  { VP_PrintTimeRemaining, DGUS_VP_Refresh::SLOW },
+
+  { VP_X_POSITION, DGUS_VP_Refresh::MOTION },
+  { VP_Y_POSITION, DGUS_VP_Refresh::MOTION },
+  { VP_Z_POSITION, DGUS_VP_Refresh::MOTION },
+  { VP_Z_POSITION_PRECISION, DGUS_VP_Refresh::MOTION },
+};
+
 // ----- Which variables to auto-update on which screens
 const uint16_t VPList_None[] PROGMEM = {
   VPList_Common,
@@ -418,6 +435,24 @@ const uint16_t VPList_RGB[] PROGMEM = {
   0x0000
 };
 
+#if ENABLED(DGUS_PERF_PAGE)
+  const uint16_t VPList_Perf[] PROGMEM = {
+    VPList_CommonWithHeatOnly,
+
+    VP_PERF_PLANNER_FILL,
+    VP_PERF_QUEUE_DEPTH,
+    VP_PERF_LOOP_MAX,
+    #if ENABLED(STEPPER_ISR_PROFILER)
+      VP_PERF_STEPPER_LOAD,
+    #endif
+    #if HAS_SD_READ_STATS
+      VP_PERF_SD_READ_MAX,
+    #endif
+
+    0x0000
+  };
+#endif
+
 
 // -- Mapping from screen to variable list
 const struct VPMapping VPMap[] PROGMEM = {
@@ -483,6 +518,9 @@ const struct VPMapping VPMap[] PROGMEM = {
 
   { DGUSLCD_SCREEN_CALIBRATE, VPList_Calibrate },
   { DGUSLCD_SCREEN_RGB, VPList_RGB},
+  #if ENABLED(DGUS_PERF_PAGE)
+    { DGUSLCD_SCREEN_PERF, VPList_Perf },
+  #endif
 
   { 0 , nullptr } // List is terminated with an nullptr as table entry.
 };
@@ -495,7 +533,7 @@ const struct VPMapping VPMap[] PROGMEM = {
 #define VPHELPER_STR(VPADR, VPADRVAR, STRLEN, RXFPTR, TXFPTR ) { .VP=VPADR, .memadr=VPADRVAR, .size=STRLEN, \
   .set_by_display_handler = RXFPTR, .send_to_display_handler = TXFPTR }
 
-const struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
+constexpr struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
   // Back button state
   VPHELPER(VP_BACK_BUTTON_STATE, nullptr, nullptr, ScreenHandler.SendBusyState),
 
@@ -764,6 +802,21 @@ const struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
     #endif
   #endif
 
+  #if ENABLED(DGUS_PERF_PAGE)
+    // Diagnostics
+    VPHELPER(VP_PERF_NAV_BUTTON, nullptr, (ScreenHandler.DGUSLCD_NavigateToPage<DGUSLCD_SCREEN_PERF, PerfPageHandler>), nullptr),
+
+    VPHELPER(VP_PERF_PLANNER_FILL, &PerfPageHandler::planner_fill, nullptr, ScreenHandler.DGUSLCD_SendWordValueToDisplay),
+    VPHELPER(VP_PERF_QUEUE_DEPTH, &PerfPageHandler::queue_depth, nullptr, ScreenHandler.DGUSLCD_SendWordValueToDisplay),
+    VPHELPER(VP_PERF_LOOP_MAX, &PerfPageHandler::loop_max_ms, nullptr, ScreenHandler.DGUSLCD_SendWordValueToDisplay),
+    #if ENABLED(STEPPER_ISR_PROFILER)
+      VPHELPER(VP_PERF_STEPPER_LOAD, &PerfPageHandler::stepper_load, nullptr, ScreenHandler.DGUSLCD_SendWordValueToDisplay),
+    #endif
+    #if HAS_SD_READ_STATS
+      VPHELPER(VP_PERF_SD_READ_MAX, &PerfPageHandler::sd_read_max_us, nullptr, ScreenHandler.DGUSLCD_SendWordValueToDisplay),
+    #endif
+  #endif
+
   // Filament load/unload
   VPHELPER(VP_FILCHANGE_NAV_BUTTON, nullptr, (ScreenHandler.DGUSLCD_NavigateToPage<DGUSLCD_SCREEN_FEED, FilamentLoadUnloadHandler>), nullptr),
 
@@ -816,4 +869,46 @@ const struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
   VPHELPER(0, 0, 0, 0)  // must be last entry.
 };
 
+// Sort the table indexes by VP at compile time, so DGUSLCD_FindVPVar can do a binary search
+constexpr uint8_t ListOfVP_Count = COUNT(ListOfVP) - 1; // Without the terminator
+static_assert(COUNT(ListOfVP) - 1 < 256, "ListOfVP needs a wider index type.");
+
+struct VPOrder { uint8_t index[ListOfVP_Count]; };
+
+constexpr VPOrder sort_vp_order() {
+  VPOrder o {};
+  for (uint8_t i = 0; i < ListOfVP_Count; ++i) o.index[i] = i;
+  for (uint8_t i = 1; i < ListOfVP_Count; ++i)
+    for (uint8_t j = i; j > 0 && ListOfVP[o.index[j - 1]].VP > ListOfVP[o.index[j]].VP; --j) {
+      const uint8_t t = o.index[j]; o.index[j] = o.index[j - 1]; o.index[j - 1] = t;
+    }
+  return o;
+}
+
+constexpr VPOrder ListOfVP_Sorted PROGMEM = sort_vp_order();
+
+constexpr bool vp_order_unique() {
+  for (uint8_t i = 1; i < ListOfVP_Count; ++i)
+    if (ListOfVP[ListOfVP_Sorted.index[i - 1]].VP == ListOfVP[ListOfVP_Sorted.index[i]].VP) return false;
+  return true;
+}
+static_assert(vp_order_unique(), "ListOfVP has a VP listed twice.");
+
+const uint8_t * const ListOfVP_Order = ListOfVP_Sorted.index;
+const uint8_t ListOfVP_OrderCount = ListOfVP_Count;
+
+// Look up the refresh class of each entry at compile time
+struct VPRefreshIndex { uint8_t refresh[ListOfVP_Count]; };
+
+constexpr VPRefreshIndex build_vp_refresh() {
+  VPRefreshIndex r {};
+  for (uint8_t i = 0; i < ListOfVP_Count; ++i)
+    for (const VPRefresh &c : VPRefreshClasses)
+      if (c.VP == ListOfVP[i].VP) r.refresh[i] = uint8_t(c.refresh);
+  return r;
+}
+
+constexpr VPRefreshIndex ListOfVP_RefreshIndex PROGMEM = build_vp_refresh();
+const uint8_t * const ListOfVP_Refresh = ListOfVP_RefreshIndex.refresh;
+
 #endif // DGUS_LCD_UI_ORIGIN
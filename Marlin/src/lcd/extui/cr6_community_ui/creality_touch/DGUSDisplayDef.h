@@ -98,7 +98,9 @@ enum DGUSLCD_Screens : uint8_t {
   DGUSLCD_SCREEN_MESH_VALIDATION = 78,
 
   DGUSLCD_SCREEN_CALIBRATE = 80,
-  DGUSLCD_SCREEN_RGB = 81
+  DGUSLCD_SCREEN_RGB = 81,
+
+  DGUSLCD_SCREEN_PERF = 84             // (this is a new page) Diagnostics, with DGUS_PERF_PAGE
 };
 
 // Version checks
@@ -527,6 +529,15 @@ constexpr uint16_t VP_RGB_NAV_BUTTON_ICON = 0x239E;
 constexpr uint16_t ICON_RGB_SETTINGS_AVAILABLE = 28;
 constexpr uint16_t ICON_RGB_SETTINGS_UNAVAILABLE = 29;
 
+// Diagnostics page
+constexpr uint16_t VP_PERF_NAV_BUTTON = 0x23B0;
+
+constexpr uint16_t VP_PERF_PLANNER_FILL = 0x23B2;   // 2-byte, % of the planner buffer
+constexpr uint16_t VP_PERF_QUEUE_DEPTH = 0x23B4;    // 2-byte, commands
+constexpr uint16_t VP_PERF_LOOP_MAX = 0x23B6;       // 2-byte, ms
+constexpr uint16_t VP_PERF_STEPPER_LOAD = 0x23B8;   // 2-byte, %
+constexpr uint16_t VP_PERF_SD_READ_MAX = 0x23BA;    // 2-byte, µs
+
 // Filament load/unload
 constexpr uint16_t VP_FILCHANGE_NAV_BUTTON = 0x23a6;
 
@@ -15,7 +15,7 @@
 #include "../../../../module/temperature.h"
 #include "../../../../module/settings.h"
 #include "../../../../module/planner.h"
-#include "../../../../gcode/gcode.h"
+#include "../../../../module/motion.h"
 
 // Storage init
 float EstepsHandler::set_esteps = 0;
@@ -25,6 +25,11 @@ float EstepsHandler::mark_filament_mm = 0;
 float EstepsHandler::filament_to_extrude = 0;
 // Default calibration temperature: start unset (0). Init() will prefer stored UI setting when available.
 celsius_t EstepsHandler::calibration_temperature = 0;
+EstepsHandler::CalibrationState EstepsHandler::state = EstepsHandler::CalibrationState::IDLE;
+float EstepsHandler::run_esteps = 0;
+#if ENABLED(LIN_ADVANCE)
+    float EstepsHandler::saved_k = 0;
+#endif
 
 void EstepsHandler::Init() {
     // Use steps
@@ -80,63 +85,69 @@ void EstepsHandler::HandleStartButton(DGUS_VP_Variable &var, void *val_ptr) {
         return;
     }
 
-    // Synchronous operation - disable back button
-    DGUSSynchronousOperation syncOperation;
-    syncOperation.start();
+    if (state != CalibrationState::IDLE) return;
+
+    // Synchronous operation - disable back button until FinishCalibration
+    ScreenHandler.BeginPurgeOperation();
 
-    // Prepare
-    bool zAxisWasRelative = GcodeSuite::axis_is_relative(Z_AXIS);
-    bool eAxisWasRelative = GcodeSuite::axis_is_relative(E_AXIS);
+    // No pressure advance while measuring the raw extrusion
 #if ENABLED(LIN_ADVANCE)
-    float kFactor = planner.extruder_advance_K[0];
+    saved_k = planner.extruder_advance_K[0];
     planner.extruder_advance_K[0] = 0;
 #endif
-    GcodeSuite::set_e_relative();
-    GcodeSuite::set_relative_mode(true);
-    
 
-    ExtUI::injectCommands_P("G0 Z5 F150");
-    queue.advance();
+    // Lift away from the bed while heating. The moves are planned directly, so the G-code modes are untouched.
+    run_esteps = ExtUI::getAxisSteps_per_mm(ExtUI::E0);
+    current_position.z += 5;
+    line_to_current_position(MMM_TO_MMS(150));
 
-    // Heat up if necessary
-    if (abs(ExtUI::getActualTemp_celsius(ExtUI::E0) - calibration_temperature) > 2) {
-        thermalManager.setTargetHotend(calibration_temperature, ExtUI::H0);
+    thermalManager.setTargetHotend(calibration_temperature, ExtUI::H0);
+    SetStatusMessage(PSTR("Heating up..."));
+    state = CalibrationState::HEATING;
+}
 
-        SetStatusMessage(PSTR("Heating up..."));
-        thermalManager.wait_for_hotend(ExtUI::H0, false);
+// Advance the calibration without blocking, so the display keeps updating
+void EstepsHandler::Update() {
+    switch (state) {
+        case CalibrationState::IDLE: break;
+
+        case CalibrationState::HEATING:
+            if (abs(ExtUI::getActualTemp_celsius(ExtUI::E0) - calibration_temperature) > 2) break;
+
+            SERIAL_ECHOLNPAIR("filament_to_extrude: ", filament_to_extrude);
+            SetStatusMessage(PSTR("Extruding..."));
+            current_position.e += filament_to_extrude;
+            line_to_current_position(MMM_TO_MMS(50));
+            state = CalibrationState::EXTRUDING;
+            break;
+
+        case CalibrationState::EXTRUDING:
+            if (planner.busy()) break;
+
+            // Restore position
+            current_position.z -= 5;
+            line_to_current_position(MMM_TO_MMS(150));
+            state = CalibrationState::RETURNING;
+            break;
+
+        case CalibrationState::RETURNING:
+            if (planner.busy()) break;
+            FinishCalibration();
+            break;
     }
+}
 
-    planner.synchronize();
-   
-    // Set-up command
-    SetStatusMessage(PSTR("Extruding..."));
-
-    SERIAL_ECHOLNPAIR("filament_to_extrude: ", filament_to_extrude);
-    char cmd[64];
-    char lengthStr[16];
-    dtostrf(filament_to_extrude, 1, 1, lengthStr);  // Convert float to string with 1 decimal place
-    snprintf(cmd, sizeof(cmd), "G1 E%s F50", lengthStr);
-    SERIAL_ECHOLNPAIR("Command: ", cmd);
-
-    ExtUI::injectCommands(cmd);
-    queue.advance();
-    planner.synchronize();
-
-    // Restore position
-    ExtUI::injectCommands_P("G0 Z-5 F150");
-    queue.advance();
-    planner.synchronize();
+void EstepsHandler::FinishCalibration() {
+    state = CalibrationState::IDLE;
 
     // Restore defaults
-    if (!zAxisWasRelative) GcodeSuite::set_relative_mode(false);
-    if (!eAxisWasRelative) GcodeSuite::set_e_absolute();
 #if ENABLED(LIN_ADVANCE)
-    planner.extruder_advance_K[0] = kFactor;
+    planner.extruder_advance_K[0] = saved_k;
 #endif
     // Done
     ScreenHandler.GotoScreen(DGUSLCD_SCREEN_ESTEPS_CALIBRATION_RESULTS, false);
     ScreenHandler.Buzzer(0, 250);
-    syncOperation.done();
+    ScreenHandler.EndPurgeOperation();
     // Show transient instruction to the user and auto-clear
     DGUSScreenHandler::PostDelayedStatusMessage_P(PSTR("Measure remaining filament"), 0);
 }
@@ -188,7 +199,7 @@ void EstepsHandler::HandleRemainingFilament(DGUS_VP_Variable &var, void *val_ptr
         return;
     }
 
-    float current_steps = ExtUI::getAxisSteps_per_mm(ExtUI::E0);
+    float current_steps = run_esteps ?: ExtUI::getAxisSteps_per_mm(ExtUI::E0);
     SERIAL_ECHOLNPAIR("Current steps: ", current_steps);
     SERIAL_ECHOLNPAIR("Actual extrusion: ", actualExtrusion);
 
@@ -197,6 +208,9 @@ void EstepsHandler::HandleRemainingFilament(DGUS_VP_Variable &var, void *val_ptr
 
     calculated_esteps = new_steps;
 
+    // Apply right away so a second run measures the new value. Back restores set_esteps.
+    ExtUI::setAxisSteps_per_mm(calculated_esteps, ExtUI::E0);
+
     // Status update
     DGUSScreenHandler::PostDelayedStatusMessage_P(PSTR("Calculated new e-steps"), 0);
 }
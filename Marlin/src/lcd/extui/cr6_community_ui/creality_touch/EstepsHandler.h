@@ -5,6 +5,7 @@
 class EstepsHandler {
     public:
         static void Init();
+        static void Update();
 
         static void HandleStartButton(DGUS_VP_Variable &var, void *val_ptr);
         static void HandleApplyButton(DGUS_VP_Variable &var, void *val_ptr);
@@ -23,6 +24,15 @@ class EstepsHandler {
         static celsius_t calibration_temperature;
 
     private:
+        // Calibration steps run by Update() from the screen handler loop
+        enum class CalibrationState : uint8_t { IDLE, HEATING, EXTRUDING, RETURNING };
+        static CalibrationState state;
+        static float run_esteps;    // The steps/mm the measured extrusion was made with
+        #if ENABLED(LIN_ADVANCE)
+            static float saved_k;
+        #endif
+
+        static void FinishCalibration();
         static void SaveSettingsAndReturn(bool fullConfirm);
         static void SetStatusMessage(PGM_P statusMessage);
 };
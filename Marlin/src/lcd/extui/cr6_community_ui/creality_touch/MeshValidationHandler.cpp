@@ -69,6 +69,11 @@ void MeshValidationHandler::Start() {
     is_running = true;
     started_from_screen = true;
 
+#if HAS_HEATED_BED
+    // Heat the bed while homing. G26 waits for it.
+    ExtUI::setTargetTemp_celsius(bed_temperature, ExtUI::heater_t::BED);
+#endif
+
     // Home if necessary - do this synchronously
     if (!all_axes_trusted()) {
         queue.inject_P("G28 U0");
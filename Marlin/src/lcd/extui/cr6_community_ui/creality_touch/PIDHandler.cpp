@@ -100,7 +100,12 @@ void PIDHandler::HandleStartButton(DGUS_VP_Variable &var, void *val_ptr) {
     ExtUI::setTargetFan_percent(prev_fan_percentage, ExtUI::fan_t::FAN0);
 
     ScreenHandler.Buzzer(0, 250);
-    settings.save();
+    #if ENABLED(EEPROM_SECTION_SAVE)
+      settings.save(MarlinSettings::SECTION_PID);
+      settings.save(MarlinSettings::SECTION_EXTUI); // PID screen settings
+    #else
+      settings.save();
+    #endif
     syncOperation.done();
 
     if (result_message) DGUSScreenHandler::PostDelayedStatusMessage_P(result_message, 0);
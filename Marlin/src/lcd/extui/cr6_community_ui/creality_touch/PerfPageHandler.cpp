@@ -0,0 +1,78 @@
+#include "../../../../inc/MarlinConfigPre.h"
+
+#if ALL(DGUS_LCD_UI_CR6_COMM, DGUS_PERF_PAGE)
+
+#include "../DGUSDisplayDef.h"
+#include "../DGUSDisplay.h"
+#include "../DGUSScreenHandler.h"
+
+#include "PerfPageHandler.h"
+
+#include "../../../../module/planner.h"
+#include "../../../../gcode/queue.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+  #include "../../../../feature/isr_profiler.h"
+#endif
+
+#if HAS_SD_READ_STATS
+  #include "../../../../sd/SdVolume.h"
+#endif
+
+// Storage init
+uint16_t PerfPageHandler::planner_fill = 0;
+uint16_t PerfPageHandler::queue_depth = 0;
+uint16_t PerfPageHandler::loop_max_ms = 0;
+uint16_t PerfPageHandler::stepper_load = 0;
+uint16_t PerfPageHandler::sd_read_max_us = 0;
+
+uint32_t PerfPageHandler::last_tick_us = 0;
+uint32_t PerfPageHandler::loop_max_us = 0;
+#if ENABLED(STEPPER_ISR_PROFILER)
+    uint32_t PerfPageHandler::last_sample_us = 0;
+    uint64_t PerfPageHandler::last_isr_total = 0;
+#endif
+
+void PerfPageHandler::Init() {
+    // Start the maximums and the ISR load over from the page opening
+    loop_max_us = 0;
+    TERN_(HAS_SD_READ_STATS, SdReadTimer::max_us = 0);
+    #if ENABLED(STEPPER_ISR_PROFILER)
+        last_sample_us = micros();
+        last_isr_total = ISRProfiler::total_time(ISR_PHASE_TOTAL);
+    #endif
+    Sample();
+}
+
+void PerfPageHandler::Tick() {
+    const uint32_t now = micros();
+    if (last_tick_us) NOLESS(loop_max_us, now - last_tick_us);
+    last_tick_us = now;
+}
+
+void PerfPageHandler::Sample() {
+    planner_fill = uint16_t(planner.movesplanned()) * 100 / block_buffer_size;
+    queue_depth = queue.ring_buffer.length;
+
+    loop_max_ms = uint16_t(_MIN(loop_max_us / 1000, 65535UL));
+    loop_max_us = 0;
+
+    #if HAS_SD_READ_STATS
+        sd_read_max_us = uint16_t(_MIN(SdReadTimer::max_us, 65535UL));
+        SdReadTimer::max_us = 0;
+    #endif
+
+    #if ENABLED(STEPPER_ISR_PROFILER)
+        // ISR time over elapsed time. The profiler counts CPU cycles with the DWT, µs otherwise.
+        const uint32_t now = micros(), elapsed_us = now - last_sample_us;
+        const uint64_t total = ISRProfiler::total_time(ISR_PHASE_TOTAL);
+        if (elapsed_us && total >= last_isr_total) {   // Not reset by M214 in between
+            const uint64_t isr_us = (total - last_isr_total) / TERN(ISR_PROFILER_DWT, (F_CPU) / 1000000UL, 1);
+            stepper_load = uint16_t(_MIN(isr_us * 100 / elapsed_us, uint64_t(100)));
+        }
+        last_sample_us = now;
+        last_isr_total = total;
+    #endif
+}
+
+#endif // DGUS_LCD_UI_CR6_COMM && DGUS_PERF_PAGE
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// Live diagnostics page. The figures are sampled before each screen update,
+// the maximums covering the time since the previous update.
+class PerfPageHandler {
+    public:
+        static void Init();
+        static void Tick();     // Called on every UI loop to time the main loop
+        static void Sample();   // Called before the screen update while the page is showing
+
+    public:
+        static uint16_t planner_fill;   // % of the planner buffer in use
+        static uint16_t queue_depth;    // Commands waiting in the queue
+        static uint16_t loop_max_ms;    // Longest main loop
+        static uint16_t stepper_load;   // % of the time spent in the Stepper ISR
+        static uint16_t sd_read_max_us; // Longest SD block read
+
+    private:
+        static uint32_t last_tick_us, loop_max_us;
+        #if ENABLED(STEPPER_ISR_PROFILER)
+            static uint32_t last_sample_us;
+            static uint64_t last_isr_total;
+        #endif
+};
@@ -43,6 +43,7 @@
 #include "DGUSDisplay.h"
 #include "DGUSVPVariable.h"
 #include "DGUSDisplayDef.h"
+#include "../dgus_common/DGUSTransport.h"
 
 DGUSDisplay dgus;
 
@@ -68,6 +69,7 @@ void DGUSDisplay::initDisplay() {
     #define LCD_BAUDRATE 115200
   #endif
   LCD_SERIAL.begin(LCD_BAUDRATE);
+  DGUSTransport::invalidate();
 
   if (TERN1(POWER_LOSS_RECOVERY, !recovery.valid())) {  // If no Power-Loss Recovery is needed...
     TERN_(DGUS_LCD_UI_MKS, delay(LOGO_TIME_DELAY));     // Show the logo for a little while
@@ -79,31 +81,33 @@ void DGUSDisplay::initDisplay() {
 void DGUSDisplay::writeVariable_P(uint16_t adr, const void *values, uint8_t valueslen, bool isstr/*=false*/) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  writeHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  char buff[valueslen];
+  for (uint8_t i = 0; i < valueslen; ++i) {
     char x;
     if (!strend) x = pgm_read_byte(myvalues++);
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    LCD_SERIAL.write(x);
+    buff[i] = x;
   }
+  DGUSTransport::write(adr, buff, valueslen);
 }
 
 void DGUSDisplay::writeVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr/*=false*/) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  writeHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  char buff[valueslen];
+  for (uint8_t i = 0; i < valueslen; ++i) {
     char x;
     if (!strend) x = *myvalues++;
     if ((isstr && !x) || strend) {
       strend = true;
       x = ' ';
     }
-    LCD_SERIAL.write(x);
+    buff[i] = x;
   }
+  DGUSTransport::write(adr, buff, valueslen);
 }
 
 void DGUSDisplay::writeVariable(uint16_t adr, uint16_t value) {
@@ -204,6 +208,7 @@ void DGUSDisplay::processRx() {
         |           Command          DataLen (in Words) */
         if (command == DGUS_CMD_READVAR) {
           const uint16_t vp = tmp[0] << 8 | tmp[1];
+          DGUSTransport::forget(vp); // The display now holds a value we didn't send
           DGUS_VP_Variable ramcopy;
           if (populate_VPVar(vp, &ramcopy)) {
             if (ramcopy.set_by_display_handler)
@@ -220,20 +225,7 @@ void DGUSDisplay::processRx() {
   }
 }
 
-size_t DGUSDisplay::getFreeTxBuffer() { return LCD_SERIAL_TX_BUFFER_FREE(); }
-
-void DGUSDisplay::writeHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
-  LCD_SERIAL.write(DGUS_HEADER1);
-  LCD_SERIAL.write(DGUS_HEADER2);
-  LCD_SERIAL.write(payloadlen + 3);
-  LCD_SERIAL.write(cmd);
-  LCD_SERIAL.write(adr >> 8);
-  LCD_SERIAL.write(adr & 0xFF);
-}
-
-void DGUSDisplay::writePGM(const char str[], uint8_t len) {
-  while (len--) LCD_SERIAL.write(pgm_read_byte(str++));
-}
+size_t DGUSDisplay::getFreeTxBuffer() { return DGUSTransport::freeTxBuffer(LCD_SERIAL_TX_BUFFER_FREE()); }
 
 void DGUSDisplay::loop() {
   // Protect against recursion. processRx() may indirectly call idle() when injecting G-code commands.
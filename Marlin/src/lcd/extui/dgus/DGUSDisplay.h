@@ -117,8 +117,6 @@ public:
   static bool isInitialized() { return initialized; }
 
 private:
-  static void writeHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
-  static void writePGM(const char str[], uint8_t len);
   static void processRx();
 
   static rx_datagram_state_t rx_datagram_state;
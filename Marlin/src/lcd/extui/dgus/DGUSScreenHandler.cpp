@@ -25,6 +25,7 @@
 #if HAS_DGUS_LCD_CLASSIC
 
 #include "DGUSScreenHandler.h"
+#include "../dgus_common/DGUSTransport.h"
 
 #include "../../../MarlinCore.h"
 #include "../../../gcode/queue.h"
@@ -646,13 +647,15 @@ void DGUSScreenHandler::updateScreenVPData() {
   // Round-robin updating of all VPs.
   VPList += update_ptr;
 
+  DGUSTransport::beginBatch(); // Merge the writes to adjacent VPs
+
   bool sent_one = false;
   do {
     uint16_t VP = pgm_read_word(VPList);
     if (!VP) {
       update_ptr = 0;
       screenComplete = true;
-      return; // Screen completed.
+      break; // Screen completed.
     }
 
     if (VP == skipVP) { skipVP = 0; continue; }
@@ -668,11 +671,13 @@ void DGUSScreenHandler::updateScreenVPData() {
       }
       else {
         screenComplete = false;
-        return; // please call again!
+        break; // please call again!
       }
     }
 
   } while (++update_ptr, ++VPList, true);
+
+  DGUSTransport::endBatch();
 }
 
 void DGUSScreenHandler::gotoScreen(const DGUS_ScreenID screenID, const bool popup/*=false*/) {
@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_DGUS_TRANSPORT
+
+#include "DGUSTransport.h"
+
+#if ENABLED(DGUS_VP_CACHE)
+  #include "../../../libs/crc16.h"
+#endif
+
+// Preamble. Always 0x5A 0xA5 on the supported displays.
+constexpr uint8_t DGUS_HEADER1 = 0x5A, DGUS_HEADER2 = 0xA5;
+
+constexpr uint16_t DGUS_FIRST_USER_VP = 0x1000; // Below this are the system registers
+
+#if ENABLED(DGUS_VP_CACHE)
+  DGUSTransport::vp_cache_t DGUSTransport::vp_cache[DGUS_VP_CACHE_SIZE];
+#endif
+#if ENABLED(DGUS_VP_BATCHING)
+  bool DGUSTransport::batching;
+  uint16_t DGUSTransport::batch_adr;
+  uint8_t DGUSTransport::batch_len, DGUSTransport::batch_buf[DGUS_VP_BATCH_SIZE];
+#endif
+#if ANY(DGUS_VP_CACHE, DGUS_VP_BATCHING)
+  uint32_t DGUSTransport::bytes_saved;
+#endif
+
+void DGUSTransport::writeHeader(const uint16_t adr, const uint8_t cmd, const uint8_t len) {
+  LCD_SERIAL.write(DGUS_HEADER1);
+  LCD_SERIAL.write(DGUS_HEADER2);
+  LCD_SERIAL.write(len + 3);
+  LCD_SERIAL.write(cmd);
+  LCD_SERIAL.write(adr >> 8);
+  LCD_SERIAL.write(adr & 0xFF);
+}
+
+void DGUSTransport::send(const uint16_t adr, const uint8_t *data, uint8_t len) {
+  writeHeader(adr, CMD_WRITEVAR, len);
+  while (len--) LCD_SERIAL.write(*data++);
+}
+
+void DGUSTransport::read(const uint16_t adr, const uint8_t words) {
+  flush();  // Keep the order of the writes and the read
+  writeHeader(adr, CMD_READVAR, sizeof(uint8_t));
+  LCD_SERIAL.write(words);
+}
+
+void DGUSTransport::write(const uint16_t adr, const void * const data_ptr, const uint8_t len) {
+  const uint8_t * const data = static_cast<const uint8_t*>(data_ptr);
+
+  #if ENABLED(DGUS_VP_CACHE)
+    // Skip a VP still holding the value last sent. System registers are commands, so always send them.
+    if (adr >= DGUS_FIRST_USER_VP) {
+      uint16_t crc = 0;
+      crc16(&crc, data, len);
+      vp_cache_t &c = vp_cache[adr % (DGUS_VP_CACHE_SIZE)];
+      if (c.vp == adr && c.crc == crc) { bytes_saved += len + 6; return; }
+      c.vp = adr;
+      c.crc = crc;
+    }
+  #endif
+
+  #if ENABLED(DGUS_VP_BATCHING)
+    if (batching && len <= DGUS_VP_BATCH_SIZE) {
+      // Add to the pending write, if it comes just after it and fits
+      if (batch_len && !TEST(batch_len, 0) && adr == batch_adr + batch_len / 2 && batch_len + len <= DGUS_VP_BATCH_SIZE)
+        bytes_saved += 6;
+      else {
+        flush();
+        batch_adr = adr;
+      }
+      memcpy(&batch_buf[batch_len], data, len);
+      batch_len += len;
+      return;
+    }
+    flush();
+  #endif
+
+  send(adr, data, len);
+}
+
+#if ENABLED(DGUS_VP_BATCHING)
+
+  void DGUSTransport::flush() {
+    if (!batch_len) return;
+    send(batch_adr, batch_buf, batch_len);
+    batch_len = 0;
+  }
+
+#endif
+
+#if ENABLED(DGUS_VP_CACHE)
+
+  void DGUSTransport::forget(const uint16_t vp) {
+    vp_cache_t &c = vp_cache[vp % (DGUS_VP_CACHE_SIZE)];
+    if (c.vp == vp) c.vp = 0;
+  }
+
+  void DGUSTransport::invalidate() {
+    for (vp_cache_t &c : vp_cache) c.vp = 0;
+  }
+
+#endif
+
+#endif // HAS_DGUS_TRANSPORT
@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lcd/extui/dgus_common/DGUSTransport.h - VP writes shared by the DGUS UIs
+ *
+ * Every DGUS variant sends its VP values through here, so they all get:
+ *  - DGUS_VP_BATCHING: Writes to adjacent VPs between beginBatch() and endBatch()
+ *    go out as one datagram, saving the 6 byte header of each.
+ *  - DGUS_VP_CACHE: Writes of a VP still holding the value last sent are skipped.
+ *    Values the display changes itself are forgotten when reported back.
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+class DGUSTransport {
+public:
+  static constexpr uint8_t CMD_WRITEVAR = 0x82, CMD_READVAR = 0x83;
+
+  // Send a VP value, unless the cache knows it's unchanged
+  static void write(const uint16_t adr, const void * const data, const uint8_t len);
+  // Request the value of 'words' VPs from adr
+  static void read(const uint16_t adr, const uint8_t words);
+  // A datagram header. Any payload must follow at once.
+  static void writeHeader(const uint16_t adr, const uint8_t cmd, const uint8_t len);
+
+  #if ENABLED(DGUS_VP_BATCHING)
+    // Between these calls writes to adjacent VPs are merged into one write
+    static void beginBatch() { batching = true; }
+    static void endBatch() { flush(); batching = false; }
+    static void flush();
+    // Serial bytes held back by the pending write
+    static uint8_t pending() { return batch_len ? batch_len + 6 : 0; }
+  #else
+    static void beginBatch() {}
+    static void endBatch() {}
+    static void flush() {}
+    static uint8_t pending() { return 0; }
+  #endif
+
+  #if ENABLED(DGUS_VP_CACHE)
+    // Forget the value sent to a VP, or to all of them, so the next write is sent
+    static void forget(const uint16_t vp);
+    static void invalidate();
+  #else
+    static void forget(const uint16_t) {}
+    static void invalidate() {}
+  #endif
+
+  // The free TX buffer reported by the serial port, less the pending write
+  static size_t freeTxBuffer(const size_t serial_free) {
+    return serial_free > pending() ? serial_free - pending() : 0;
+  }
+
+  #if ANY(DGUS_VP_CACHE, DGUS_VP_BATCHING)
+    // Serial bytes not sent thanks to the cache and batching
+    static uint32_t bytesSaved() { return bytes_saved; }
+  #endif
+
+private:
+  static void send(const uint16_t adr, const uint8_t *data, uint8_t len);
+
+  #if ENABLED(DGUS_VP_CACHE)
+    typedef struct { uint16_t vp, crc; } vp_cache_t;  // CRC of the value last sent to a VP
+    static vp_cache_t vp_cache[DGUS_VP_CACHE_SIZE];
+  #endif
+
+  #if ENABLED(DGUS_VP_BATCHING)
+    static bool batching;
+    static uint16_t batch_adr;
+    static uint8_t batch_len, batch_buf[DGUS_VP_BATCH_SIZE];
+  #endif
+
+  #if ANY(DGUS_VP_CACHE, DGUS_VP_BATCHING)
+    static uint32_t bytes_saved;
+  #endif
+};
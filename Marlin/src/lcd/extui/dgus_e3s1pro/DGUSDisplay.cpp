@@ -27,6 +27,7 @@
 #if ENABLED(DGUS_LCD_UI_E3S1PRO)
 
 #include "DGUSDisplay.h"
+#include "../dgus_common/DGUSTransport.h"
 
 #include "config/DGUS_Addr.h"
 #include "config/DGUS_Constants.h"
@@ -55,31 +56,24 @@ void DGUSDisplay::loop() {
 
 void DGUSDisplay::init() {
   LCD_SERIAL.begin(LCD_BAUDRATE);
+  DGUSTransport::invalidate();
 
   readVersions();
 }
 
 void DGUSDisplay::read(uint16_t addr, uint8_t size) {
-  writeHeader(addr, DGUS_READVAR, size);
-
-  LCD_SERIAL.write(size);
+  DGUSTransport::read(addr, size);
 }
 
 void DGUSDisplay::write(uint16_t addr, const void* data_ptr, uint8_t size) {
   if (!data_ptr) return;
 
-  writeHeader(addr, DGUS_WRITEVAR, size);
-
-  const char* data = static_cast<const char*>(data_ptr);
-
-  while (size--) LCD_SERIAL.write(*data++);
+  DGUSTransport::write(addr, data_ptr, size);
 }
 
 void DGUSDisplay::writeString(uint16_t addr, const void* data_ptr, uint8_t size, bool left, bool right, bool use_space) {
   if (!data_ptr) return;
 
-  writeHeader(addr, DGUS_WRITEVAR, size);
-
   const char* data = static_cast<const char*>(data_ptr);
   size_t len = strlen(data);
   uint8_t left_spaces = 0;
@@ -105,16 +99,18 @@ void DGUSDisplay::writeString(uint16_t addr, const void* data_ptr, uint8_t size,
     len = size;
   }
 
-  while (left_spaces--)  LCD_SERIAL.write(' ');
-  while (len--)          LCD_SERIAL.write(*data++);
-  while (right_spaces--) LCD_SERIAL.write(use_space ? ' ' : '\0');
+  // Pad the string in a buffer so the transport sees the whole value
+  char buffer[size], *b = buffer;
+  while (left_spaces--)  *b++ = ' ';
+  while (len--)          *b++ = *data++;
+  while (right_spaces--) *b++ = use_space ? ' ' : '\0';
+
+  DGUSTransport::write(addr, buffer, size);
 }
 
 void DGUSDisplay::writeStringPGM(uint16_t addr, const void* data_ptr, uint8_t size, bool left, bool right, bool use_space) {
   if (!data_ptr) return;
 
-  writeHeader(addr, DGUS_WRITEVAR, size);
-
   const char* data = static_cast<const char*>(data_ptr);
   size_t len = strlen_P(data);
   uint8_t left_spaces = 0, right_spaces = 0;
@@ -138,9 +134,12 @@ void DGUSDisplay::writeStringPGM(uint16_t addr, const void* data_ptr, uint8_t si
     len = size;
   }
 
-  while (left_spaces--) LCD_SERIAL.write(' ');
-  while (len--) LCD_SERIAL.write(pgm_read_byte(data++));
-  while (right_spaces--) LCD_SERIAL.write(use_space ? ' ' : '\0');
+  char buffer[size], *b = buffer;
+  while (left_spaces--) *b++ = ' ';
+  while (len--) *b++ = pgm_read_byte(data++);
+  while (right_spaces--) *b++ = use_space ? ' ' : '\0';
+
+  DGUSTransport::write(addr, buffer, size);
 }
 
 void DGUSDisplay::readVersions() {
@@ -260,6 +259,7 @@ void DGUSDisplay::processRx() {
          */
         if (command == DGUS_READVAR) {
           const uint16_t addr = Endianness::fromBE_P<uint16_t>(tmp);
+          DGUSTransport::forget(addr); // The display now holds a value we didn't send
           const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
           if (addr == DGUS_VERSION && dlen == 2) {
             gui_version = tmp[3];
@@ -336,7 +336,7 @@ void DGUSDisplay::processRx() {
 }
 
 size_t DGUSDisplay::getFreeTxBuffer() {
-  return (
+  return DGUSTransport::freeTxBuffer(
     #ifdef LCD_SERIAL_TX_BUFFER_FREE
       LCD_SERIAL_TX_BUFFER_FREE()
     #else
@@ -346,23 +346,10 @@ size_t DGUSDisplay::getFreeTxBuffer() {
 }
 
 void DGUSDisplay::flushTx() {
+  DGUSTransport::flush();
   TERN(ARDUINO_ARCH_STM32, LCD_SERIAL.flush(), LCD_SERIAL.flushTX());
 }
 
-void DGUSDisplay::writeHeader(uint16_t addr, uint8_t command, uint8_t len) {
-  LCD_SERIAL.write(DGUS_HEADER1);
-  LCD_SERIAL.write(DGUS_HEADER2);
-  LCD_SERIAL.write(len + 3);
-  LCD_SERIAL.write(command);
-
-  union {
-    uint16_t u16;
-    uint8_t u8[2];
-  } data = { Endianness::toBE(addr) };
-
-  for (uint8_t i = 0; i < sizeof(data.u8); ++i) LCD_SERIAL.write(data.u8[i]);
-}
-
 bool DGUS_PopulateVP(const DGUS_Addr addr, DGUS_VP * const buffer) {
   const DGUS_VP *ret = vp_list;
 
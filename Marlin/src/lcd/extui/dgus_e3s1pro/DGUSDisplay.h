@@ -145,7 +145,6 @@ private:
     DGUS_VERSION = 0x000F // OS/GUI version
   };
 
-  static void writeHeader(uint16_t addr, uint8_t command, uint8_t len);
   static void processRx();
 
   static uint8_t volume;
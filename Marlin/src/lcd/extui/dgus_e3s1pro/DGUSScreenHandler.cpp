@@ -25,6 +25,7 @@
 #if ENABLED(DGUS_LCD_UI_E3S1PRO)
 
 #include "DGUSDisplay.h"
+#include "../dgus_common/DGUSTransport.h"
 #include "DGUSScreenHandler.h"
 #include "DGUSSDCardHandler.h"
 
@@ -495,11 +496,11 @@ bool DGUSScreenHandler::sendScreenVPData(DGUS_ScreenID screen, bool complete_upd
 
   const DGUS_Addr *list = findScreenAddrList(screen);
 
-  while (true) {
-    if (!list) return true; // Nothing left to send
+  DGUSTransport::beginBatch(); // Merge the writes to adjacent VPs
 
+  while (list) {
     const uint16_t addr = pgm_read_word(list++);
-    if (!addr) return true; // Nothing left to send
+    if (!addr) break; // Nothing left to send
 
     DGUS_VP vp;
     if (!DGUS_PopulateVP((DGUS_Addr)addr, &vp)) continue; // Invalid VP
@@ -513,7 +514,7 @@ bool DGUSScreenHandler::sendScreenVPData(DGUS_ScreenID screen, bool complete_upd
     const millis_t try_until = ExtUI::safe_millis() + 1000;
 
     while (expected_tx > dgus.getFreeTxBuffer()) {
-      if (ELAPSED(ExtUI::safe_millis(), try_until)) return false; // Stop trying after 1 second
+      if (ELAPSED(ExtUI::safe_millis(), try_until)) { DGUSTransport::endBatch(); return false; } // Stop trying after 1 second
 
       dgus.flushTx(); // Flush the TX buffer
       delay(50);
@@ -521,6 +522,9 @@ bool DGUSScreenHandler::sendScreenVPData(DGUS_ScreenID screen, bool complete_upd
 
     vp.tx_handler(vp);
   }
+
+  DGUSTransport::endBatch();
+  return true;
 }
 
 bool DGUSScreenHandler::refreshVP(DGUS_Addr vpAddr) {
@@ -27,6 +27,7 @@
 #include "DGUSScreenHandler.h"
 
 #include "DGUSDisplay.h"
+#include "../dgus_common/DGUSTransport.h"
 #include "definition/DGUS_ScreenAddrList.h"
 #include "definition/DGUS_ScreenSetup.h"
 
@@ -470,11 +471,11 @@ bool DGUSScreenHandler::sendScreenVPData(const DGUS_ScreenID screenID, bool comp
 
   const DGUS_Addr *list = findScreenAddrList(screenID);
 
-  while (true) {
-    if (!list) return true; // Nothing left to send
+  DGUSTransport::beginBatch(); // Merge the writes to adjacent VPs
 
+  while (list) {
     const uint16_t addr = pgm_read_word(list++);
-    if (!addr) return true; // Nothing left to send
+    if (!addr) break; // Nothing left to send
 
     DGUS_VP vp;
     if (!populateVP((DGUS_Addr)addr, &vp)) continue; // Invalid VP
@@ -485,7 +486,7 @@ bool DGUSScreenHandler::sendScreenVPData(const DGUS_ScreenID screenID, bool comp
     const millis_t try_until = ExtUI::safe_millis() + 1000;
 
     while (expected_tx > dgus.getFreeTxBuffer()) {
-      if (ELAPSED(ExtUI::safe_millis(), try_until)) return false; // Stop trying after 1 second
+      if (ELAPSED(ExtUI::safe_millis(), try_until)) { DGUSTransport::endBatch(); return false; } // Stop trying after 1 second
 
       dgus.flushTx(); // Flush the TX buffer
       delay(50);
@@ -493,6 +494,9 @@ bool DGUSScreenHandler::sendScreenVPData(const DGUS_ScreenID screenID, bool comp
 
     vp.tx_handler(vp);
   }
+
+  DGUSTransport::endBatch();
+  return true;
 }
 
 #endif // DGUS_LCD_UI_RELOADED
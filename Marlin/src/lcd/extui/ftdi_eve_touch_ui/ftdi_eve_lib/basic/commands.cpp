@@ -231,6 +231,8 @@ void CLCD::mem_write_fill(uint32_t reg_address, uint8_t data, uint16_t len) {
 
 #if FTDI_API_LEVEL == 800
 uint32_t CLCD::CommandFifo::command_write_ptr = 0xFFFFFFFFul;
+#else
+uint16_t CLCD::CommandFifo::command_space = 0;
 #endif
 
 void CLCD::CommandFifo::cmd(uint32_t cmd32) {
@@ -1011,6 +1013,7 @@ void CLCD::CommandFifo::reset() {
   mem_write_32(REG::CMD_READ,  0x00000000);
   mem_write_32(REG::CPURESET,  0x00000000);
   safe_delay(300);
+  command_space = 0;
 };
 
 // Writes len bytes into the FIFO, if len is not
@@ -1020,34 +1023,40 @@ void CLCD::CommandFifo::reset() {
 template <class T> bool CLCD::CommandFifo::write(T data, uint16_t len) {
   const uint8_t padding = MULTIPLE_OF_4(len) - len;
 
-  if (has_fault()) {
-    #if ENABLED(TOUCH_UI_DEBUG)
-      SERIAL_ECHOLNPGM("Faulted... ignoring write.");
-    #endif
-    return false;
+  // The free space only grows as the co-processor works, so a count
+  // from an earlier read is still safe. Only read the space and fault
+  // registers when it runs out, instead of twice for every command.
+  if (command_space < len + padding) {
+    if (has_fault()) {
+      #if ENABLED(TOUCH_UI_DEBUG)
+        SERIAL_ECHOLNPGM("Faulted... ignoring write.");
+      #endif
+      return false;
+    }
+    command_space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
   }
   // The FT810 provides a special register that can be used
   // for writing data without us having to do our own FIFO
   // management.
-  uint16_t Command_Space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
-  if (Command_Space < (len + padding)) {
+  if (command_space < (len + padding)) {
     #if ENABLED(TOUCH_UI_DEBUG)
-      SERIAL_ECHO_MSG("Waiting for ", len + padding, " bytes in command queue, now free: ", Command_Space);
+      SERIAL_ECHO_MSG("Waiting for ", len + padding, " bytes in command queue, now free: ", command_space);
     #endif
     do {
-      Command_Space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
+      command_space = mem_read_32(REG::CMDB_SPACE) & 0x0FFF;
       if (has_fault()) {
         #if ENABLED(TOUCH_UI_DEBUG)
           SERIAL_ECHOLNPGM("... fault");
         #endif
         return false;
       }
-    } while (Command_Space < len + padding);
+    } while (command_space < len + padding);
     #if ENABLED(TOUCH_UI_DEBUG)
       SERIAL_ECHOLNPGM("... done");
     #endif
   }
   mem_write_bulk(REG::CMDB_WRITE, data, len, padding);
+  command_space -= len + padding;
   return true;
 }
 
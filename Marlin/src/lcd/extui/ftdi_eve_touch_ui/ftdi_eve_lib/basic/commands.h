@@ -175,6 +175,7 @@ class CLCD::CommandFifo {
   protected:
     #if FTDI_API_LEVEL >= 810
       uint32_t getRegCmdBSpace();
+      static uint16_t command_space; // Known free bytes in the command FIFO
     #else
       static uint32_t command_write_ptr;
       template <class T> bool _write_unaligned(T data, uint16_t len);
@@ -497,9 +497,43 @@ void StatusScreen::onEntry() {
   onRefresh();
 }
 
+/**
+ * Hash the values shown by the foreground widgets, at about the precision
+ * they are shown. The background is appended from the DL cache, so there's
+ * nothing to send to the display while this stays the same.
+ */
+uint32_t StatusScreen::foreground_hash() {
+  uint32_t hash = 2166136261UL;
+  auto add = [&](const int32_t v) { hash = (hash ^ uint32_t(v)) * 16777619UL; };
+
+  for (const axis_t axis : { X, Y, Z })
+    add(isAxisPositionKnown(axis) ? int32_t(getAxisPosition_mm(axis) * 10) : INT32_MIN);
+
+  for (const heater_t heater : { BED, H0 OPTARG(HAS_MULTI_EXTRUDER, H1) }) {
+    add(int32_t(getActualTemp_celsius(heater) * 10));
+    add(isHeaterIdle(heater) ? -1 : int32_t(getTargetTemp_celsius(heater)));
+  }
+  add(int32_t(getActualFan_percent(FAN0)));
+
+  const bool in_job = isOngoingPrintJob() || isPrintingPaused();
+  add(in_job | isPrintingPaused() << 1 | isMediaMounted() << 2 | isPrintingFromMedia() << 3);
+  if (in_job) {
+    add(getProgress_seconds_elapsed());
+    TERN_(SHOW_REMAINING_TIME, add(getProgress_seconds_remaining()));
+    add(TERN(HAS_PRINT_PROGRESS_PERMYRIAD, getProgress_permyriad(), getProgress_percent()));
+  }
+  return hash;
+}
+
 void StatusScreen::onIdle() {
   if (refresh_timer.elapsed(STATUS_UPDATE_INTERVAL)) {
-    onRefresh();
+    // Skip the display list and SPI traffic when nothing shown has changed
+    static uint32_t shown_hash;
+    const uint32_t hash = foreground_hash();
+    if (hash != shown_hash) {
+      shown_hash = hash;
+      onRefresh();
+    }
     refresh_timer.start();
   }
   BaseScreen::onIdle();
@@ -86,6 +86,10 @@ uint16_t DeviceCode = 0x9488;
 extern uint8_t sel_id;
 
 uint8_t bmp_public_buf[16 * 1024];
+#if ENABLED(TFT_LVGL_DMA_FLUSH)
+  // LVGL draws the next area here while DMA sends the last one from bmp_public_buf
+  static lv_color_t disp_buf_2[LV_HOR_RES_MAX * 17];
+#endif
 uint8_t public_buf[513];
 
 extern bool flash_preview_begin, default_preview_flg, gcode_preview_over;
@@ -156,11 +160,12 @@ void tft_lvgl_init() {
 
   lv_init();
 
-  lv_disp_buf_init(&disp_buf, bmp_public_buf, nullptr, LV_HOR_RES_MAX * 17); // Initialize the display buffer
+  lv_disp_buf_init(&disp_buf, bmp_public_buf, TERN(TFT_LVGL_DMA_FLUSH, disp_buf_2, nullptr), LV_HOR_RES_MAX * 17); // Initialize the display buffer
 
   lv_disp_drv_t disp_drv;     // Descriptor of a display driver
   lv_disp_drv_init(&disp_drv);    // Basic initialization
   disp_drv.flush_cb = my_disp_flush; // Set your driver function
+  TERN_(TFT_LVGL_DMA_FLUSH, disp_drv.monitor_cb = my_disp_flush_end); // Called after each refresh
   disp_drv.buffer = &disp_buf;    // Assign the buffer to the display
   lv_disp_drv_register(&disp_drv);  // Finally register the driver
 
@@ -263,9 +268,16 @@ void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * co
 
   disp_drv_p = disp;
 
+  // Wait for the previous area, sent from the other buffer
+  TERN_(TFT_LVGL_DMA_FLUSH, while (SPI_TFT.tftio.isBusy()) { /* nada */ });
+
   SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
 
-  #if ENABLED(USE_SPI_DMA_TC)
+  #if ENABLED(TFT_LVGL_DMA_FLUSH)
+    // Only this area is sent. LVGL draws the next one into the other buffer meanwhile.
+    SPI_TFT.tftio.writeSequenceDMA((uint16_t*)color_p, width * height);
+    lv_disp_flush_ready(disp_drv_p);
+  #elif ENABLED(USE_SPI_DMA_TC)
     lcd_dma_trans_lock = true;
     SPI_TFT.tftio.writeSequenceIT((uint16_t*)color_p, width * height);
     TFT_SPI::DMAtx.XferCpltCallback = dmc_tc_handler;
@@ -279,6 +291,13 @@ void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * co
   bool get_lcd_dma_lock() { return lcd_dma_trans_lock; }
 #endif
 
+#if ENABLED(TFT_LVGL_DMA_FLUSH)
+  // Finish sending the last area before anything else uses the TFT or the draw buffer
+  void my_disp_flush_end(lv_disp_drv_t*, uint32_t, uint32_t) {
+    while (SPI_TFT.tftio.isBusy()) { /* nada */ }
+  }
+#endif
+
 void lv_fill_rect(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, lv_color_t bk_color) {
   uint16_t width, height;
   width = x2 - x1 + 1;
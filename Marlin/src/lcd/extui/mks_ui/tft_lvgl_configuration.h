@@ -37,6 +37,7 @@ extern uint8_t public_buf[513];
 
 void tft_lvgl_init();
 void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
+void my_disp_flush_end(lv_disp_drv_t * disp, uint32_t time, uint32_t px);
 bool my_touchpad_read(lv_indev_drv_t * indev_driver, lv_indev_data_t * data);
 bool my_mousewheel_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
 
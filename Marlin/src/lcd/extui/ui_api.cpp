@@ -881,9 +881,10 @@ namespace ExtUI {
 
     #if HAS_MESH
 
-      bed_mesh_t& getMeshArray() { return bedlevel.z_values; }
-      float getMeshPoint(const xy_uint8_t &pos) { return bedlevel.z_values[pos.x][pos.y]; }
+      bed_mesh_t& getMeshArray() { TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh()); return bedlevel.z_values; }
+      float getMeshPoint(const xy_uint8_t &pos) { TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh()); return bedlevel.z_values[pos.x][pos.y]; }
       void setMeshPoint(const xy_uint8_t &pos, const float zoff) {
+        TERN_(EEPROM_LAZY_LOAD, settings.lazy_load_mesh());
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
@@ -1122,6 +1123,109 @@ namespace ExtUI {
     #endif
   }
 
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+
+    enum EventType : uint8_t {
+      EV_PRINT_TIMER_STARTED, EV_PRINT_TIMER_PAUSED, EV_PRINT_TIMER_STOPPED
+      OPTARG(HAS_MESH, EV_MESH_VALUE, EV_MESH_STATE)
+    };
+
+    typedef struct {
+      EventType type;
+      int8_t x, y;                    // Mesh point
+      union { float z; uint8_t state; };
+    } event_t;
+
+    static event_t events[EXTUI_EVENT_QUEUE_SIZE];
+    static uint8_t event_head, event_count;
+
+    static MString<MAX_MESSAGE_SIZE> queued_status;
+    static bool status_queued;
+    #if HAS_MESH
+      static bool mesh_lost;          // Mesh values were dropped. Send the whole mesh.
+    #endif
+
+    static void dispatch(const event_t &e) {
+      switch (e.type) {
+        case EV_PRINT_TIMER_STARTED: onPrintTimerStarted(); break;
+        case EV_PRINT_TIMER_PAUSED:  onPrintTimerPaused(); break;
+        case EV_PRINT_TIMER_STOPPED: onPrintTimerStopped(); break;
+        #if HAS_MESH
+          case EV_MESH_VALUE: onMeshUpdate(e.x, e.y, e.z); break;
+          case EV_MESH_STATE: onMeshUpdate(e.x, e.y, probe_state_t(e.state)); break;
+        #endif
+      }
+    }
+
+    static event_t pop() {
+      const event_t e = events[event_head];
+      event_head = (event_head + 1) % (EXTUI_EVENT_QUEUE_SIZE);
+      event_count--;
+      return e;
+    }
+
+    // Add an event. If the queue is full send the oldest now to make room.
+    static void push(const event_t &e) {
+      if (event_count == EXTUI_EVENT_QUEUE_SIZE) dispatch(pop());
+      events[(event_head + event_count++) % (EXTUI_EVENT_QUEUE_SIZE)] = e;
+    }
+
+    void queuePrintTimerStarted() { push({ EV_PRINT_TIMER_STARTED }); }
+    void queuePrintTimerPaused()  { push({ EV_PRINT_TIMER_PAUSED }); }
+    void queuePrintTimerStopped() { push({ EV_PRINT_TIMER_STOPPED }); }
+
+    void queueStatusChanged(const char * const msg) {
+      queued_status = msg;
+      status_queued = true;
+    }
+
+    #if HAS_MESH
+
+      void queueMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval) {
+        // Replace a value not sent yet
+        for (uint8_t i = 0; i < event_count; ++i) {
+          event_t &e = events[(event_head + i) % (EXTUI_EVENT_QUEUE_SIZE)];
+          if (e.type == EV_MESH_VALUE && e.x == xpos && e.y == ypos) { e.z = zval; return; }
+        }
+        // Probing shouldn't wait for the UI, so drop the value and send the whole mesh later
+        if (event_count == EXTUI_EVENT_QUEUE_SIZE) { mesh_lost = true; return; }
+        event_t e = { EV_MESH_VALUE, xpos, ypos };
+        e.z = zval;
+        push(e);
+      }
+
+      void queueMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state) {
+        event_t e = { EV_MESH_STATE, xpos, ypos };
+        e.state = state;
+        push(e);
+      }
+
+    #endif
+
+    void dispatchEvents() {
+      static bool busy; // A handler may call idle()
+      if (busy) return;
+      busy = true;
+
+      while (event_count) dispatch(pop());
+
+      #if HAS_MESH
+        if (mesh_lost) {
+          mesh_lost = false;
+          GRID_LOOP(x, y) onMeshUpdate(x, y, bedlevel.z_values[x][y]);
+        }
+      #endif
+
+      if (status_queued) {
+        status_queued = false;
+        onStatusChanged(queued_status);
+      }
+
+      busy = false;
+    }
+
+  #endif // EXTUI_EVENT_QUEUE
+
   void onSurviveInKilled() {
     thermalManager.disable_all_heaters();
     flags.printer_killed = 0;
@@ -1188,7 +1292,10 @@ namespace ExtUI {
   void MarlinUI::clear_lcd() {}
   void MarlinUI::clear_for_drawing() {}
 
-  void MarlinUI::update() { ExtUI::onIdle(); }
+  void MarlinUI::update() {
+    TERN_(EXTUI_EVENT_QUEUE, ExtUI::dispatchEvents());
+    ExtUI::onIdle();
+  }
 
   void MarlinUI::kill_screen(FSTR_P const error, FSTR_P const component) {
     using namespace ExtUI;
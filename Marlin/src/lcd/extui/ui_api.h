@@ -262,6 +262,17 @@ namespace ExtUI {
       } probe_state_t;
       void onMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state);
       inline void onMeshUpdate(const xy_int8_t &pos, probe_state_t state) { onMeshUpdate(pos.x, pos.y, state); }
+
+      // Mesh events posted by Marlin. See EXTUI_EVENT_QUEUE.
+      #if ENABLED(EXTUI_EVENT_QUEUE)
+        void queueMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval);
+        void queueMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state);
+      #else
+        inline void queueMeshUpdate(const int8_t xpos, const int8_t ypos, const float zval) { onMeshUpdate(xpos, ypos, zval); }
+        inline void queueMeshUpdate(const int8_t xpos, const int8_t ypos, probe_state_t state) { onMeshUpdate(xpos, ypos, state); }
+      #endif
+      inline void queueMeshUpdate(const xy_int8_t &pos, const float zval) { queueMeshUpdate(pos.x, pos.y, zval); }
+      inline void queueMeshUpdate(const xy_int8_t &pos, probe_state_t state) { queueMeshUpdate(pos.x, pos.y, state); }
     #endif
   #endif
 
@@ -544,6 +555,24 @@ namespace ExtUI {
   inline void onStatusChanged(FSTR_P const fstr) { onStatusChanged_P(FTOP(fstr)); }
   void onStatusChanged(const char * const msg);
 
+  /**
+   * Events posted by Marlin from motion, probing and G-code.
+   * With EXTUI_EVENT_QUEUE they are queued and sent to the UI by MarlinUI::update(),
+   * keeping only the latest status message and the latest value of each mesh point.
+   */
+  #if ENABLED(EXTUI_EVENT_QUEUE)
+    void queuePrintTimerStarted();
+    void queuePrintTimerPaused();
+    void queuePrintTimerStopped();
+    void queueStatusChanged(const char * const msg);
+    void dispatchEvents();
+  #else
+    inline void queuePrintTimerStarted() { onPrintTimerStarted(); }
+    inline void queuePrintTimerPaused() { onPrintTimerPaused(); }
+    inline void queuePrintTimerStopped() { onPrintTimerStopped(); }
+    inline void queueStatusChanged(const char * const msg) { onStatusChanged(msg); }
+  #endif
+
   void onHomingStart();
   void onHomingDone();
 
@@ -90,6 +90,7 @@ namespace LanguageNarrow_en {
   LSTR MSG_MEDIA_REMOVED                  = MEDIA_TYPE_EN _UxGT(" Removed");
   LSTR MSG_MEDIA_REMOVED_SD               = _UxGT("SD Card Removed");
   LSTR MSG_MEDIA_REMOVED_USB              = _UxGT("USB Drive Removed");
+  LSTR MSG_MEDIA_LOADING                  = MEDIA_TYPE_EN _UxGT(" Loading...");
   LSTR MSG_MEDIA_INIT_FAIL                = MEDIA_TYPE_EN _UxGT(" Init Fail");
   LSTR MSG_MEDIA_INIT_FAIL_SD             = _UxGT("SD Card Init Fail");
   LSTR MSG_MEDIA_INIT_FAIL_USB            = _UxGT("USB Drive Init Fail");
@@ -756,6 +757,7 @@ namespace LanguageNarrow_en {
   LSTR MSG_MESH_DONE                      = _UxGT("Mesh probing done");
 
   LSTR MSG_HOTEND_IDLE_TIMEOUT            = _UxGT("Hotend Idle Timeout");
+  LSTR MSG_HOTEND_IDLE_REHEAT             = _UxGT("Reheating...");
   LSTR MSG_BED_IDLE_TIMEOUT               = _UxGT("Bed Idle Timeout");
   LSTR MSG_HOTEND_IDLE_DISABLE            = _UxGT("Disable Timeout");
   LSTR MSG_HOTEND_IDLE_NOZZLE_TARGET      = _UxGT("Nozzle Idle Temp");
@@ -938,6 +940,7 @@ namespace LanguageNarrow_en {
   LSTR MSG_FTM_2HEI                       = _UxGT("2HEI");
   LSTR MSG_FTM_3HEI                       = _UxGT("3HEI");
   LSTR MSG_FTM_MZV                        = _UxGT("MZV");
+  LSTR MSG_FTM_CUSTOM                     = _UxGT("Custom");
   //LSTR MSG_FTM_ULENDO_FBS               = _UxGT("Ulendo FBS");
   //LSTR MSG_FTM_DISCTF                   = _UxGT("DISCTF");
   LSTR MSG_FTM_AXIS_SYNC                  = _UxGT("Axis Sync");
@@ -1711,7 +1711,7 @@ uint8_t expand_u8str_P(char * const outstr, PGM_P const ptpl, const int8_t ind,
 
     TERN_(STATUS_MESSAGE_SCROLLING, reset_status_scroll());
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onStatusChanged(status_message));
+    TERN_(EXTENSIBLE_UI, ExtUI::queueStatusChanged(status_message));
     TERN_(DWIN_CREALITY_LCD, dwinStatusChanged(status_message));
     TERN_(DWIN_CREALITY_LCD_JYERSUI, jyersDWIN.updateStatus(status_message));
   }
@@ -43,6 +43,10 @@
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(PLANNER_TIME_ESTIMATE)
+  #include "../module/planner.h"
+#endif
+
 #if ENABLED(ADVANCED_PAUSE_FEATURE)
   #include "../feature/pause.h"
 #endif
@@ -328,6 +332,9 @@ public:
     #endif
     #if ANY(SHOW_REMAINING_TIME, SET_PROGRESS_MANUALLY)
       static uint32_t _calculated_remaining_time() {
+        #if ENABLED(PLANNER_TIME_ESTIMATE)
+          if (const uint32_t r = planner.remaining_print_time()) return r;
+        #endif
         const duration_t elapsed = print_job_timer.duration();
         const progress_t progress = _get_progress();
         return progress ? elapsed.value * (100 * (PROGRESS_SCALE) - progress) / progress : 0;
@@ -610,6 +610,7 @@ void menu_backlash();
       TERN_(INPUT_SHAPING_X, SHAPING_MENU_FOR_AXIS(X))
       TERN_(INPUT_SHAPING_Y, SHAPING_MENU_FOR_AXIS(Y))
       TERN_(INPUT_SHAPING_Z, SHAPING_MENU_FOR_AXIS(Z))
+      TERN_(INPUT_SHAPING_E, SHAPING_MENU_FOR_AXIS(E))
 
       END_MENU();
     }
@@ -324,6 +324,9 @@ void menu_move() {
       case ftMotionShaper_2HEI:  return GET_TEXT_F(MSG_FTM_2HEI);
       case ftMotionShaper_3HEI:  return GET_TEXT_F(MSG_FTM_3HEI);
       case ftMotionShaper_MZV:   return GET_TEXT_F(MSG_FTM_MZV);
+      #if ENABLED(FTM_CUSTOM_SHAPER)
+        case ftMotionShaper_CUSTOM: return GET_TEXT_F(MSG_FTM_CUSTOM);
+      #endif
     }
   }
 
@@ -367,6 +370,7 @@ void menu_move() {
       if (shaper != ftMotionShaper_2HEI)  ACTION_ITEM(MSG_FTM_2HEI, []{ ftm_menu_set_shaper(ftMotion.cfg.shaper.A, ftMotionShaper_2HEI  ); }); \
       if (shaper != ftMotionShaper_3HEI)  ACTION_ITEM(MSG_FTM_3HEI, []{ ftm_menu_set_shaper(ftMotion.cfg.shaper.A, ftMotionShaper_3HEI  ); }); \
       if (shaper != ftMotionShaper_MZV)   ACTION_ITEM(MSG_FTM_MZV,  []{ ftm_menu_set_shaper(ftMotion.cfg.shaper.A, ftMotionShaper_MZV   ); }); \
+      TERN_(FTM_CUSTOM_SHAPER, if (shaper != ftMotionShaper_CUSTOM) ACTION_ITEM(MSG_FTM_CUSTOM, []{ ftm_menu_set_shaper(ftMotion.cfg.shaper.A, ftMotionShaper_CUSTOM); })); \
       END_MENU(); \
     }
 
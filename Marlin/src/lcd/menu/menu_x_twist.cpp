@@ -45,12 +45,19 @@ void _goto_manual_move_z(const float);
 
 float measured_z, z_offset;
 
+#if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+  static XATC::state_t xatc_before; // Fold the new values into the mesh when done
+#endif
+
 //
 // Step 9: X Axis Twist Compensation Wizard is finished.
 //
 void xatc_wizard_done() {
   if (!ui.wait_for_move) {
     xatc.print_points();
+    #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+      xatc.fold_into_mesh(xatc_before);
+    #endif
     set_bed_leveling_enabled(menu_leveling_was_active);
     SET_SOFT_ENDSTOP_LOOSE(false);
     ui.goto_screen(menu_advanced_settings);
@@ -181,6 +188,9 @@ void xatc_wizard_homing_done() {
   }
 
   if (ui.use_click()) {
+    #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+      xatc.save_state(xatc_before);
+    #endif
     xatc.reset();
 
     SET_SOFT_ENDSTOP_LOOSE(true); // Disable soft endstops for free Z movement
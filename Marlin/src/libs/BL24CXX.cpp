@@ -289,6 +289,9 @@ void BL24CXX::writeOneByte(uint16_t WriteAddr, uint8_t DataToWrite) {
   IIC::wait_ack();
   IIC::stop();                                    // Generate a stop condition
   delay(10);
+  #if ENABLED(EEPROM_BACKGROUND_WRITE)
+    if (loaded) image[WriteAddr] = DataToWrite;   // Keep the image current
+  #endif
 }
 
 // Start writing data of length Len at the specified address in BL24CXX
@@ -351,4 +354,139 @@ void BL24CXX::write(uint16_t WriteAddr, uint8_t *pBuffer, uint16_t NumToWrite) {
     writeOneByte(WriteAddr, *pBuffer++);
 }
 
+// Send the device address and the memory address for a write or a dummy write
+void BL24CXX::sendAddress(const uint16_t addr) {
+  IIC::start();
+  if (EE_TYPE > BL24C16) {
+    IIC::send_byte(EEPROM_DEVICE_ADDRESS);
+    IIC::wait_ack();
+    IIC::send_byte(addr >> 8);
+  }
+  else
+    IIC::send_byte(EEPROM_DEVICE_ADDRESS + ((addr >> 8) << 1));
+  IIC::wait_ack();
+  IIC::send_byte(addr & 0xFF);
+  IIC::wait_ack();
+}
+
+// Read with the address counter of the device, which only wraps at the end of
+// memory. Blocks of 256 bytes have their own device address on the BL24C16.
+void BL24CXX::readBurst(uint16_t ReadAddr, uint8_t *pBuffer, uint16_t NumToRead) {
+  while (NumToRead) {
+    const uint16_t n = _MIN(NumToRead, 256 - (ReadAddr & 0xFF));
+    sendAddress(ReadAddr);
+    IIC::start();
+    IIC::send_byte((EE_TYPE > BL24C16 ? EEPROM_DEVICE_ADDRESS : EEPROM_DEVICE_ADDRESS + ((ReadAddr >> 8) << 1)) | 0x01);
+    IIC::wait_ack();
+    for (uint16_t i = 0; i < n; ++i) *pBuffer++ = IIC::read_byte(i < n - 1); // nACK the last byte
+    IIC::stop();
+    ReadAddr += n;
+    NumToRead -= n;
+  }
+}
+
+// Write up to a page. The write cycle starts at the stop condition, so use busy() to know when it ends.
+void BL24CXX::writePage(uint16_t WriteAddr, const uint8_t *pBuffer, uint8_t NumToWrite) {
+  sendAddress(WriteAddr);
+  while (NumToWrite--) {
+    IIC::send_byte(*pBuffer++);
+    IIC::wait_ack();
+  }
+  IIC::stop();
+}
+
+// The device doesn't acknowledge its address during a write cycle
+bool BL24CXX::busy() {
+  IIC::start();
+  IIC::send_byte(EEPROM_DEVICE_ADDRESS);
+  if (IIC::wait_ack()) return true;               // wait_ack sent the stop
+  IIC::stop();
+  return false;
+}
+
+#if ENABLED(EEPROM_BACKGROUND_WRITE)
+
+  #define BL24CXX_WRITE_TIMEOUT 20                  // (ms) The write cycle is 5ms at most
+  #define BL24CXX_RETRIES        3
+
+  uint8_t BL24CXX::image[MARLIN_EEPROM_SIZE];
+  uint8_t BL24CXX::dirty[(page_count + 7) / 8];
+  uint16_t BL24CXX::dirty_pages;
+  int16_t BL24CXX::verify_page = -1;
+  uint8_t BL24CXX::retries;
+  millis_t BL24CXX::write_ms;
+  bool BL24CXX::loaded;
+
+  void BL24CXX::load() {
+    if (loaded) return;
+    readBurst(0, image, MARLIN_EEPROM_SIZE);
+    loaded = true;
+  }
+
+  void BL24CXX::stage(const uint16_t addr, const uint8_t *data, uint16_t len) {
+    for (uint16_t a = addr; len--; ++a, ++data) {
+      if (image[a] == *data) continue;            // The EEPROM has ~100,000 write cycles. Only write changed pages.
+      image[a] = *data;
+      const uint16_t page = a / (BL24CXX_PAGE_SIZE);
+      if (!TEST(dirty[page >> 3], page & 7)) { SBI(dirty[page >> 3], page & 7); ++dirty_pages; }
+    }
+  }
+
+  void BL24CXX::task() {
+    if (!pending()) return;
+
+    if (busy()) {
+      if (ELAPSED(millis(), write_ms + BL24CXX_WRITE_TIMEOUT)) {
+        SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);    // The device stopped answering. Drop what's pending.
+        ZERO(dirty);
+        dirty_pages = 0;
+        verify_page = -1;
+      }
+      return;
+    }
+
+    // Check the page written last, unless it changed again since
+    if (verify_page >= 0) {
+      const uint16_t page = verify_page;
+      verify_page = -1;
+      if (!TEST(dirty[page >> 3], page & 7)) {
+        uint8_t data[BL24CXX_PAGE_SIZE];
+        readBurst(page * (BL24CXX_PAGE_SIZE), data, BL24CXX_PAGE_SIZE);
+        if (memcmp(data, &image[page * (BL24CXX_PAGE_SIZE)], BL24CXX_PAGE_SIZE)) {
+          if (++retries > BL24CXX_RETRIES) {
+            retries = 0;
+            SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
+          }
+          else {
+            SBI(dirty[page >> 3], page & 7);
+            ++dirty_pages;
+          }
+        }
+        else
+          retries = 0;
+      }
+      return;
+    }
+
+    for (uint16_t page = 0; page < page_count; ++page) {
+      if (!TEST(dirty[page >> 3], page & 7)) continue;
+      CBI(dirty[page >> 3], page & 7);
+      --dirty_pages;
+      writePage(page * (BL24CXX_PAGE_SIZE), &image[page * (BL24CXX_PAGE_SIZE)], BL24CXX_PAGE_SIZE);
+      verify_page = page;
+      write_ms = millis();
+      break;
+    }
+  }
+
+  void BL24CXX::flush() {
+    const millis_t end_ms = millis() + page_count * (BL24CXX_WRITE_TIMEOUT);
+    while (pending() && PENDING(millis(), end_ms)) {
+      task();
+      hal.watchdog_refresh();
+    }
+  }
+
+#endif // EEPROM_BACKGROUND_WRITE
+
 #endif // IIC_BL24CXX_EEPROM
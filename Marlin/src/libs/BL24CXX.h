@@ -57,9 +57,20 @@ protected:
 #define BL24C256  32767
 #define EE_TYPE BL24C16
 
+#if EE_TYPE <= BL24C02
+  #define BL24CXX_PAGE_SIZE  8
+#elif EE_TYPE <= BL24C16
+  #define BL24CXX_PAGE_SIZE 16
+#elif EE_TYPE <= BL24C64
+  #define BL24CXX_PAGE_SIZE 32
+#else
+  #define BL24CXX_PAGE_SIZE 64
+#endif
+
 class BL24CXX {
 private:
   static bool _check();                                                             // Check the device
+  static void sendAddress(const uint16_t addr);                                     // Start a write or dummy write at the address
 public:
   static void init();                                                               // Initialize IIC
   static bool check();                                                              // Check / recheck the device
@@ -69,4 +80,32 @@ public:
   static uint32_t readLenByte(uint16_t ReadAddr, uint8_t Len);                      // The specified address starts to read the data of the specified length
   static void write(uint16_t WriteAddr, uint8_t *pBuffer, uint16_t NumToWrite);     // Write the specified length of data from the specified address
   static void read(uint16_t ReadAddr, uint8_t *pBuffer, uint16_t NumToRead);        // Read the data of the specified length from the specified address
+
+  static void readBurst(uint16_t ReadAddr, uint8_t *pBuffer, uint16_t NumToRead);   // Sequential read, with one address phase per 256-byte block
+  static void writePage(uint16_t WriteAddr, const uint8_t *pBuffer, uint8_t NumToWrite); // Write within one page and return during the write cycle
+  static bool busy();                                                               // Acknowledge polling. True during a write cycle.
+
+  #if ENABLED(EEPROM_BACKGROUND_WRITE)
+    /**
+     * A RAM image of the EEPROM for PersistentStore. Writes change the image
+     * and mark its pages, and task() writes one marked page per call from
+     * idle(), reading it back once the write cycle ends.
+     */
+    static void load();                                                             // Read the image, once
+    static uint8_t cached(const uint16_t addr) { return image[addr]; }
+    static void stage(const uint16_t addr, const uint8_t *data, uint16_t len);      // Change the image
+    static bool pending() { return dirty_pages || verify_page >= 0; }
+    static void task();                                                             // Write or verify one page
+    static void flush();                                                            // Write all pending pages now
+
+  private:
+    static constexpr uint16_t page_count = (MARLIN_EEPROM_SIZE) / (BL24CXX_PAGE_SIZE);
+    static uint8_t image[MARLIN_EEPROM_SIZE];
+    static uint8_t dirty[(page_count + 7) / 8];
+    static uint16_t dirty_pages;
+    static int16_t verify_page;
+    static uint8_t retries;
+    static millis_t write_ms;
+    static bool loaded;
+  #endif
 };
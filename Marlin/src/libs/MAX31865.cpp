@@ -361,26 +361,18 @@ inline uint16_t MAX31865::readRawImmediate() {
   return rtd;
 }
 
-/**
- * Read the raw 16-bit value from the RTD_REG in one shot mode. This will include
- * the fault bit, D0.
- *
- * @return The raw unsigned 16-bit register value with ERROR bit attached, NOT temperature!
- */
-uint16_t MAX31865::readRaw() {
-
-  #if ENABLED(MAX31865_USE_AUTO_MODE)
-
-    readRawImmediate();
-
-  #else
+#if DISABLED(MAX31865_USE_AUTO_MODE)
 
+  /**
+   * Take the next step of a 1-shot conversion if its wait is over:
+   * bias voltage on, start the conversion, then read the RTD register.
+   * The conversion is read when DRDY goes low, if the pin is set, or
+   * after the longest conversion time.
+   */
+  void MAX31865::update() {
     const millis_t ms = millis();
 
-    if (PENDING(ms, nextEventStamp)) {
-      DEBUG_ECHOLNPGM("MAX31865 waiting for event ", nextEvent);
-      return lastRead;
-    }
+    if (PENDING(ms, nextEventStamp)) return;
 
     switch (nextEvent) {
       case SETUP_BIAS_VOLTAGE:
@@ -392,13 +384,23 @@ uint16_t MAX31865::readRaw() {
 
       case SETUP_1_SHOT_MODE:
         oneShot();
-        nextEventStamp = ms + TERN(MAX31865_50HZ_FILTER, 63, 52); // wait at least 52msec for 60Hz (63msec for 50Hz) before reading RTD register
+        oneShotStamp = ms;
+        if (drdyPin != TERN(LARGE_PINMAP, -1UL, 255))
+          nextEventStamp = ms + 1;  // Poll DRDY
+        else
+          nextEventStamp = ms + TERN(MAX31865_50HZ_FILTER, 63, 52); // wait at least 52msec for 60Hz (63msec for 50Hz) before reading RTD register
         nextEvent = READ_RTD_REG;
         DEBUG_ECHOLNPGM("MAX31865 1 shot mode enabled");
         break;
 
       case READ_RTD_REG:
 
+        // DRDY is high until the conversion is done. Don't trust it past the longest conversion time.
+        if (drdyPin != TERN(LARGE_PINMAP, -1UL, 255) && digitalRead(drdyPin) && PENDING(ms, oneShotStamp, TERN(MAX31865_50HZ_FILTER, 63UL, 52UL))) {
+          nextEventStamp = ms + 1;
+          break;
+        }
+
         if (!(readRawImmediate() & 1))   // if clearFault() was not invoked, need to clear the bias voltage and 1-shot flags
           resetFlags();
 
@@ -406,9 +408,18 @@ uint16_t MAX31865::readRaw() {
         nextEventStamp = ms + (MAX31865_MIN_SAMPLING_TIME_MSEC); // next step should not occur within less than MAX31865_MIN_SAMPLING_TIME_MSEC from the last one
         break;
     }
+  }
 
-  #endif
+#endif // !MAX31865_USE_AUTO_MODE
 
+/**
+ * Read the raw 16-bit value from the RTD_REG in one shot mode. This will include
+ * the fault bit, D0.
+ *
+ * @return The raw unsigned 16-bit register value with ERROR bit attached, NOT temperature!
+ */
+uint16_t MAX31865::readRaw() {
+  TERN(MAX31865_USE_AUTO_MODE, readRawImmediate(), update());
   return lastRead;
 }
 
@@ -106,8 +106,9 @@ private:
   uint8_t lastFault = 0;
 
   #if DISABLED(MAX31865_USE_AUTO_MODE)
-    millis_t nextEventStamp;
+    millis_t nextEventStamp, oneShotStamp;
     one_shot_event_t nextEvent;
+    TERN(LARGE_PINMAP, uint32_t, uint8_t) drdyPin = TERN(LARGE_PINMAP, -1UL, 255);
   #endif
 
   #ifdef MAX31865_IGNORE_INITIAL_FAULTY_READS
@@ -158,6 +159,14 @@ public:
   uint8_t readFault();
   void clearFault();
 
+  #if DISABLED(MAX31865_USE_AUTO_MODE)
+    // Use the DRDY pin to read each 1-shot conversion as soon as it's done
+    void setDrdyPin(const TERN(LARGE_PINMAP, uint32_t, uint8_t) pin) { drdyPin = pin; pinMode(pin, INPUT); }
+
+    // Advance the 1-shot conversion without waiting. Call as often as possible.
+    void update();
+  #endif
+
   uint16_t readRaw();
   float readResistance();
   float temperature();
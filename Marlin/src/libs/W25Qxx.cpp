@@ -136,6 +136,8 @@ uint16_t W25QXXFlash::W25QXX_ReadID(void) {
 }
 
 void W25QXXFlash::SPI_FLASH_WriteEnable() {
+  // A write that didn't wait may still be in progress
+  SPI_FLASH_WaitForWriteEnd();
   // Select the FLASH: Chip Select low
   SPI_FLASH_CS_L();
   // Send "Write Enable" instruction
@@ -172,7 +174,16 @@ void W25QXXFlash::SPI_FLASH_WaitForWriteEnd() {
   SPI_FLASH_CS_H();
 }
 
-void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr) {
+// Read the status register once. True while an erase or program is in progress.
+bool W25QXXFlash::SPI_FLASH_IsBusy() {
+  SPI_FLASH_CS_L();
+  spi_flash_Send(W25X_ReadStatusReg);
+  const uint8_t FLASH_Status = spi_flash_Rec();
+  SPI_FLASH_CS_H();
+  return FLASH_Status & WIP_Flag;
+}
+
+void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr, const bool wait/*=true*/) {
   // Send write enable instruction
   SPI_FLASH_WriteEnable();
 
@@ -191,7 +202,7 @@ void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr) {
 
   SPI_FLASH_CS_H();
   // Wait the end of Flash writing
-  SPI_FLASH_WaitForWriteEnd();
+  if (wait) SPI_FLASH_WaitForWriteEnd();
 }
 
 void W25QXXFlash::SPI_FLASH_BlockErase(uint32_t BlockAddr) {
@@ -247,7 +258,7 @@ void W25QXXFlash::SPI_FLASH_BulkErase() {
 * Output         : None
 * Return         : None
 *******************************************************************************/
-void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite) {
+void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite, const bool wait/*=true*/) {
   // Enable the write access to the FLASH
   SPI_FLASH_WriteEnable();
 
@@ -276,7 +287,7 @@ void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint
   SPI_FLASH_CS_H();
 
   // Wait the end of Flash writing
-  SPI_FLASH_WaitForWriteEnd();
+  if (wait) SPI_FLASH_WaitForWriteEnd();
 }
 
 /*******************************************************************************
@@ -355,6 +366,9 @@ void W25QXXFlash::SPI_FLASH_BufferWrite(uint8_t *pBuffer, uint32_t WriteAddr, ui
 * Return         : None
 *******************************************************************************/
 void W25QXXFlash::SPI_FLASH_BufferRead(uint8_t *pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead) {
+  // Reads are invalid while a write is in progress
+  SPI_FLASH_WaitForWriteEnd();
+
   // Select the FLASH: Chip Select low
   SPI_FLASH_CS_L();
 
@@ -63,10 +63,11 @@ public:
   static uint16_t W25QXX_ReadID(void);
   static void SPI_FLASH_WriteEnable();
   static void SPI_FLASH_WaitForWriteEnd();
-  static void SPI_FLASH_SectorErase(uint32_t SectorAddr);
+  static bool SPI_FLASH_IsBusy();
+  static void SPI_FLASH_SectorErase(uint32_t SectorAddr, const bool wait=true);
   static void SPI_FLASH_BlockErase(uint32_t BlockAddr);
   static void SPI_FLASH_BulkErase();
-  static void SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
+  static void SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite, const bool wait=true);
   static void SPI_FLASH_BufferWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
   static void SPI_FLASH_BufferRead(uint8_t *pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
 };
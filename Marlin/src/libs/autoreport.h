@@ -26,22 +26,27 @@
 template <typename Helper>
 struct AutoReporter {
   millis_t next_report_ms;
-  uint8_t report_interval;
+  uint16_t report_ms;   // Report interval in ms. 0 for no reports.
   #if HAS_MULTI_SERIAL
     SerialMask report_port_mask;
     AutoReporter() : report_port_mask(SerialMask::All) {}
   #endif
 
   inline void set_interval(uint8_t seconds, const uint8_t limit=60) {
-    report_interval = _MIN(seconds, limit);
-    next_report_ms = millis() + SEC_TO_MS(seconds);
+    set_interval_ms(SEC_TO_MS(_MIN(seconds, limit)));
+  }
+
+  // For reports faster than once a second
+  inline void set_interval_ms(const uint16_t ms) {
+    report_ms = ms;
+    next_report_ms = millis() + ms;
   }
 
   inline void tick() {
-    if (!report_interval) return;
+    if (!report_ms) return;
     const millis_t ms = millis();
     if (ELAPSED(ms, next_report_ms)) {
-      next_report_ms = ms + SEC_TO_MS(report_interval);
+      next_report_ms = ms + report_ms;
       PORT_REDIRECT(report_port_mask);
       Helper::report();
       PORT_RESTORE();
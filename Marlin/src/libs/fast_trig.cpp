@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * fast_trig.cpp - Table-interpolated arctangent
+ *
+ * The table holds atan(t) for t from 0 to 1 and is built by the compiler.
+ * Other octants follow from symmetry. Linear interpolation between
+ * 129 entries keeps the error under 6e-6 radians.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(KINEMATICS_TRIG_TABLE)
+
+#include "fast_trig.h"
+
+#define ATAN_TABLE_SIZE 128
+
+namespace {
+
+  constexpr double c_sqrt(const double x) {
+    double r = x > 1 ? x : 1;
+    for (uint8_t i = 0; i < 30; ++i) r = 0.5 * (r + x / r);
+    return r;
+  }
+
+  // Halve the angle twice, to below tan(π/16), where the series converges quickly
+  constexpr double c_atan(const double x) {
+    double t = x / (1 + c_sqrt(1 + x * x));
+    t /= 1 + c_sqrt(1 + t * t);
+    double s = 0, p = t;
+    for (uint8_t n = 0; n < 12; ++n) {
+      s += (n & 1 ? -p : p) / (2 * n + 1);
+      p *= t * t;
+    }
+    return 4 * s;
+  }
+
+  struct atan_table_t { float v[ATAN_TABLE_SIZE + 1]; };
+
+  constexpr atan_table_t make_atan_table() {
+    atan_table_t table{};
+    for (uint16_t i = 0; i <= ATAN_TABLE_SIZE; ++i)
+      table.v[i] = float(c_atan(double(i) / (ATAN_TABLE_SIZE)));
+    return table;
+  }
+
+  constexpr atan_table_t atan_table PROGMEM = make_atan_table();
+
+  // atan(t) for t from 0 to 1
+  float atan_unit(const float t) {
+    const float f = t * (ATAN_TABLE_SIZE);
+    const uint8_t i = _MIN(uint8_t(f), ATAN_TABLE_SIZE - 1);
+    const float a = pgm_read_float(&atan_table.v[i]), b = pgm_read_float(&atan_table.v[i + 1]);
+    return a + (b - a) * (f - i);
+  }
+
+}
+
+float fast_atan2(const float y, const float x) {
+  const float ax = ABS(x), ay = ABS(y);
+  if (!ax && !ay) return 0;
+  float a = ay > ax ? float(M_PI_2) - atan_unit(ax / ay) : atan_unit(ay / ax);
+  if (x < 0) a = float(M_PI) - a;
+  return y < 0 ? -a : a;
+}
+
+#endif // KINEMATICS_TRIG_TABLE
@@ -0,0 +1,39 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Table-interpolated arctangent for kinematics (KINEMATICS_TRIG_TABLE)
+ *
+ * Much faster than atan2f on an MCU without an FPU, within 0.0004°.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(KINEMATICS_TRIG_TABLE)
+  float fast_atan2(const float y, const float x);
+  #define KIN_ATAN2(y, x) fast_atan2(y, x)
+  #define KIN_ACOS(x)     fast_atan2(SQRT(1.0f - sq(x)), x)
+#else
+  #define KIN_ATAN2(y, x) ATAN2(y, x)
+  #define KIN_ACOS(x)     ACOS(x)
+#endif
@@ -15,7 +15,7 @@
 #else
   // Required parameters for static configuration
   #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
-  #define HEATSHRINK_STATIC_WINDOW_BITS 8
+  #define HEATSHRINK_STATIC_WINDOW_BITS TERN(SD_BINARY_GCODE, 12, 8) // Binary G-code uses 12
   #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
 #endif
 
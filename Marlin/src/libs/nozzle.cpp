@@ -30,11 +30,37 @@ Nozzle nozzle;
 
 #include "../MarlinCore.h"
 #include "../module/motion.h"
+#include "../module/planner.h"
 
 #if NOZZLE_CLEAN_MIN_TEMP > 20
   #include "../module/temperature.h"
 #endif
 
+/**
+ * Buffer a move without waiting for it to finish, so a whole clean or park
+ * path is planned at once and blended at the junctions. Callers synchronize
+ * at the end. Kinematic moves need segmenting, so they still block.
+ */
+static void buffer_move_to_xy(const float rx, const float ry, const feedRate_t fr_mm_s=feedRate_t(XY_PROBE_FEEDRATE_MM_S)) {
+  #if IS_KINEMATIC
+    do_blocking_move_to_xy(rx, ry, fr_mm_s);
+  #else
+    current_position.set(rx, ry);
+    line_to_current_position(fr_mm_s);
+  #endif
+}
+
+#if ALL(NOZZLE_PARK_FEATURE, HAS_Z_AXIS)
+  static void buffer_move_to_z(const float rz, const feedRate_t fr_mm_s) {
+    #if IS_KINEMATIC
+      do_blocking_move_to_z(rz, fr_mm_s);
+    #else
+      current_position.z = rz;
+      line_to_current_position(fr_mm_s);
+    #endif
+  }
+#endif
+
 #if ENABLED(NOZZLE_CLEAN_FEATURE)
 
   #if ENABLED(NOZZLE_CLEAN_PATTERN_LINE)
@@ -58,17 +84,8 @@ Nozzle nozzle;
 
       // Run the stroke pattern
       for (uint8_t i = 0; i <= strokes; ++i) {
-        #if ENABLED(NOZZLE_CLEAN_NO_Y)
-          if (i & 1)
-            do_blocking_move_to_x(end.x);
-          else
-            do_blocking_move_to_x(start.x);
-        #else
-          if (i & 1)
-            do_blocking_move_to_xy(end);
-          else
-            do_blocking_move_to_xy(start);
-        #endif
+        const xyz_pos_t &side = (i & 1) ? end : start;
+        buffer_move_to_xy(side.x, TERN(NOZZLE_CLEAN_NO_Y, current_position.y, side.y));
       }
 
       TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(oldpos));
@@ -107,16 +124,16 @@ Nozzle nozzle;
         for (int8_t i = 0; i < zigs; i++) {
           side = (i & 1) ? &end : &start;
           if (horiz)
-            do_blocking_move_to_xy(start.x + i * P, side->y);
+            buffer_move_to_xy(start.x + i * P, side->y);
           else
-            do_blocking_move_to_xy(side->x, start.y + i * P);
+            buffer_move_to_xy(side->x, start.y + i * P);
         }
         for (int8_t i = zigs; i >= 0; i--) {
           side = (i & 1) ? &end : &start;
           if (horiz)
-            do_blocking_move_to_xy(start.x + i * P, side->y);
+            buffer_move_to_xy(start.x + i * P, side->y);
           else
-            do_blocking_move_to_xy(side->x, start.y + i * P);
+            buffer_move_to_xy(side->x, start.y + i * P);
         }
       }
 
@@ -143,7 +160,7 @@ Nozzle nozzle;
 
       for (uint8_t s = 0; s < strokes; ++s)
         for (uint8_t i = 0; i < NOZZLE_CLEAN_CIRCLE_FN; ++i)
-          do_blocking_move_to_xy(
+          buffer_move_to_xy(
             middle.x + sin((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius,
             middle.y + cos((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius
           );
@@ -239,6 +256,8 @@ Nozzle nozzle;
         case 2: circle(start[arrPos], middle[arrPos], strokes, radius); break;
       #endif
     }
+
+    planner.synchronize();
   }
 
 #endif // NOZZLE_CLEAN_FEATURE
@@ -265,15 +284,15 @@ Nozzle nozzle;
 
       switch (z_action) {
         case 1:   // Go to Z-park height
-          do_blocking_move_to_z(park.z, fr_z);
+          buffer_move_to_z(park.z, fr_z);
           break;
 
         case 2:   // Raise by Z-park height
-          do_blocking_move_to_z(_MIN(current_position.z + park.z, Z_MAX_POS), fr_z);
+          buffer_move_to_z(_MIN(current_position.z + park.z, Z_MAX_POS), fr_z);
           break;
 
         case 3: { // Raise by NOZZLE_PARK_Z_RAISE_MIN, bypass XY-park position
-          do_blocking_move_to_z(park_mode_0_height(0), fr_z);
+          buffer_move_to_z(park_mode_0_height(0), fr_z);
           goto SKIP_XY_MOVE;
         } break;
 
@@ -281,7 +300,7 @@ Nozzle nozzle;
           break;
 
         default:  // Raise by NOZZLE_PARK_Z_RAISE_MIN, use park.z as a minimum height
-          do_blocking_move_to_z(park_mode_0_height(park.z), fr_z);
+          buffer_move_to_z(park_mode_0_height(park.z), fr_z);
           break;
       }
     #endif // HAS_Z_AXIS
@@ -292,17 +311,18 @@ Nozzle nozzle;
       #endif
       constexpr feedRate_t fr_xy = NOZZLE_PARK_XY_FEEDRATE;
       switch (NOZZLE_PARK_MOVE) {
-        case 0: do_blocking_move_to_xy(park, fr_xy); break;
-        case 1: do_blocking_move_to_x(park.x, fr_xy); break;
-        case 2: do_blocking_move_to_y(park.y, fr_xy); break;
-        case 3: do_blocking_move_to_x(park.x, fr_xy);
-                do_blocking_move_to_y(park.y, fr_xy); break;
-        case 4: do_blocking_move_to_y(park.y, fr_xy);
-                do_blocking_move_to_x(park.x, fr_xy); break;
+        case 0: buffer_move_to_xy(park.x, park.y, fr_xy); break;
+        case 1: buffer_move_to_xy(park.x, current_position.y, fr_xy); break;
+        case 2: buffer_move_to_xy(current_position.x, park.y, fr_xy); break;
+        case 3: buffer_move_to_xy(park.x, current_position.y, fr_xy);
+                buffer_move_to_xy(park.x, park.y, fr_xy); break;
+        case 4: buffer_move_to_xy(current_position.x, park.y, fr_xy);
+                buffer_move_to_xy(park.x, park.y, fr_xy); break;
       }
     }
 
     SKIP_XY_MOVE:
+    planner.synchronize();
     report_current_position();
   }
 
@@ -0,0 +1,119 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include "../core/types.h"
+
+/**
+ * @brief   Single-producer / single-consumer queue
+ * @details A ring buffer that hands items between an interrupt and the main
+ *          loop without disabling interrupts. Only the producer writes the
+ *          head and only the consumer writes the tail, and an item is stored
+ *          (or copied out) before the index that hands it over is changed.
+ *          A compiler barrier is all the ordering this needs on single-core
+ *          AVR and Cortex-M. One slot stays empty, so it holds N - 1 items.
+ *          On AVR keep N <= 256 when one side is an interrupt, so the index
+ *          is a single byte and its reads and writes can't be torn.
+ */
+template<typename T, uint16_t N>
+class SPSCQueue {
+  public:
+    typedef uvalue_t(N - 1) index_t;
+
+  private:
+    T queue[N];
+    volatile index_t head, tail;
+
+    static void barrier() { __asm__ __volatile__("" : : : "memory"); }
+    static index_t next(const index_t i) { return i + 1 < N ? i + 1 : 0; }
+
+  public:
+    SPSCQueue() : head(0), tail(0) {}
+
+    /**
+     * @brief   Adds an item to the queue (producer)
+     * @details Returns false, leaving the queue as it was, if it's full.
+     * @param   item Item to be added to the queue
+     * @return  true if the operation was successful
+     */
+    bool enqueue(const T &item) {
+      const index_t h = head, n = next(h);
+      if (n == tail) return false;
+      queue[h] = item;
+      barrier();
+      head = n;
+      return true;
+    }
+
+    /**
+     * @brief   Removes the oldest item from the queue (consumer)
+     * @param   item Set to the removed item
+     * @return  false if the queue was empty
+     */
+    bool dequeue(T &item) {
+      const index_t t = tail;
+      if (t == head) return false;
+      barrier();
+      item = queue[t];
+      barrier();
+      tail = next(t);
+      return true;
+    }
+
+    /**
+     * @brief   Gets the oldest item without removing it (consumer)
+     * @details Only valid when the queue isn't empty.
+     */
+    const T& peek() { barrier(); return queue[tail]; }
+
+    /**
+     * @brief   Drops every queued item (consumer)
+     */
+    void clear() { tail = head; }
+
+    bool isEmpty() { return head == tail; }
+    bool isFull() { return next(head) == tail; }
+
+    /**
+     * @brief   Gets the number of items on the queue
+     * @details Exact from either side of the queue, while the other side
+     *          may only make it larger (producer) or smaller (consumer).
+     */
+    index_t count() {
+      const index_t h = head, t = tail;
+      return h >= t ? h - t : N - t + h;
+    }
+
+    // Number of items that can still be added
+    index_t space() { return N - 1 - count(); }
+
+    /**
+     * @brief   Raw access for non-destructive diagnostics
+     * @details Read entries from tail_index() up to head_index(), stepping
+     *          with next_index(). Entries may be overwritten once consumed.
+     */
+    index_t head_index() { return head; }
+    index_t tail_index() { return tail; }
+    static index_t next_index(const index_t i) { return next(i); }
+    const T& at(const index_t i) { barrier(); return queue[i]; }
+};
@@ -37,7 +37,7 @@ bool Stopwatch::stop() {
   debug(F("stop"));
 
   if (isRunning() || isPaused()) {
-    TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStopped());
+    TERN_(EXTENSIBLE_UI, ExtUI::queuePrintTimerStopped());
     state = STOPPED;
     stopTimestamp = millis();
     return true;
@@ -49,7 +49,7 @@ bool Stopwatch::pause() {
   debug(F("pause"));
 
   if (isRunning()) {
-    TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerPaused());
+    TERN_(EXTENSIBLE_UI, ExtUI::queuePrintTimerPaused());
     state = PAUSED;
     stopTimestamp = millis();
     return true;
@@ -60,7 +60,7 @@ bool Stopwatch::pause() {
 bool Stopwatch::start() {
   debug(F("start"));
 
-  TERN_(EXTENSIBLE_UI, ExtUI::onPrintTimerStarted());
+  TERN_(EXTENSIBLE_UI, ExtUI::queuePrintTimerStarted());
 
   if (!isRunning()) {
     if (isPaused()) accumulator = duration();
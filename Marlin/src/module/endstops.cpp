@@ -43,6 +43,10 @@
   #include HAL_PATH(.., endstop_interrupts.h)
 #endif
 
+#if ENABLED(PROBE_FILTERED_SAMPLING)
+  #include "../HAL/shared/Delay.h"
+#endif
+
 #if ENABLED(SD_ABORT_ON_ENDSTOP_HIT)
   #include "printcounter.h" // for print_job_timer
   #include "temperature.h"
@@ -78,10 +82,14 @@ volatile Endstops::endstop_mask_t Endstops::hit_state;
 Endstops::endstop_mask_t Endstops::live_state = 0;
 
 // Definitions for trigger log ring buffer declared in endstops.h
-volatile Endstops::trigger_entry_t Endstops::trigger_log[16];
-volatile uint8_t Endstops::trigger_log_head = 0;
-volatile uint8_t Endstops::trigger_log_tail = 0;
-volatile uint32_t Endstops::trigger_log_seq = 0;
+SPSCQueue<Endstops::trigger_entry_t, 16> Endstops::trigger_log;
+uint32_t Endstops::trigger_log_seq = 0;
+
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+  xyze_long_t Endstops::edge_position[NUM_ENDSTOP_STATES];
+  uint32_t Endstops::edge_us[NUM_ENDSTOP_STATES];
+  Endstops::endstop_mask_t Endstops::edge_state; // = 0
+#endif
 
 #if ENABLED(BD_SENSOR)
   bool Endstops::bdp_state; // = false
@@ -103,6 +111,12 @@ volatile uint32_t Endstops::trigger_log_seq = 0;
   volatile bool Endstops::z_probe_enabled = false;
 #endif
 
+#if ENABLED(PROBE_FILTERED_SAMPLING)
+  #define PROBE_ES ES_ENUM(Z, TERN(USE_Z_MIN_PROBE, MIN_PROBE, MIN))
+  bool Endstops::probe_filtered; // = false
+  uint8_t Endstops::probe_history; // = 0
+#endif
+
 #if ENABLED(CALIBRATION_GCODE)
   volatile bool Endstops::calibration_probe_enabled = false;
   volatile bool Endstops::calibration_stop_state;
@@ -297,13 +311,53 @@ void Endstops::poll() {
 
   TERN_(PINS_DEBUGGING, run_monitor()); // Report changes in endstop status
 
+  #if ENABLED(PROBE_FILTERED_SAMPLING)
+    const bool probe_changed = z_probe_enabled && sample_probe();
+  #else
+    constexpr bool probe_changed = false;
+  #endif
+
   #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    UNUSED(probe_changed);
     update();
   #elif ENDSTOP_NOISE_THRESHOLD
-    if (endstop_poll_count) update();
+    if (endstop_poll_count || probe_changed) update();
+  #else
+    if (probe_changed) update();
   #endif
 }
 
+#if ENABLED(PROBE_FILTERED_SAMPLING)
+
+  /**
+   * Called from poll() at 1kHz while the probe is enabled. Read the probe a
+   * few times in quick succession and keep the majority, then agree on a new
+   * state once enough of the last polls saw it. A trigger is confirmed in
+   * PROBE_SAMPLE_VOTES ms and a single noisy poll can't end or start one.
+   * Return true if the filtered state changed.
+   */
+  bool Endstops::sample_probe() {
+    uint8_t hits = 0;
+    for (uint8_t i = 0; i < PROBE_SAMPLE_BURST; ++i) {
+      if (i) DELAY_US(PROBE_SAMPLE_GAP_US);
+      if (READ_ENDSTOP(TERN(USE_Z_MIN_PROBE, Z_MIN_PROBE_PIN, Z_MIN_PIN)) == TERN(USE_Z_MIN_PROBE, Z_MIN_PROBE_ENDSTOP_HIT_STATE, Z_MIN_ENDSTOP_HIT_STATE))
+        hits++;
+    }
+    probe_history = (probe_history << 1) | (hits > (PROBE_SAMPLE_BURST) / 2);
+
+    uint8_t votes = 0;
+    for (uint8_t h = probe_history & (_BV(PROBE_SAMPLE_WINDOW) - 1); h; h &= h - 1) votes++;
+
+    const bool was = probe_filtered;
+    if (votes >= PROBE_SAMPLE_VOTES)
+      probe_filtered = true;
+    else if (votes <= (PROBE_SAMPLE_WINDOW) - (PROBE_SAMPLE_VOTES))
+      probe_filtered = false;
+    return probe_filtered != was;
+  }
+
+#endif
+
 void Endstops::enable_globally(const bool onoff) {
   enabled_globally = enabled = onoff;
   resync();
@@ -335,6 +389,10 @@ void Endstops::not_homing() {
 // Enable / disable endstop z-probe checking
 #if HAS_BED_PROBE
   void Endstops::enable_z_probe(const bool onoff) {
+    #if ENABLED(PROBE_FILTERED_SAMPLING)
+      if (onoff && !z_probe_enabled) probe_filtered = false; // Start over from untriggered
+      probe_history = 0;
+    #endif
     z_probe_enabled = onoff;
     #if PIN_EXISTS(PROBE_ENABLE)
       WRITE(PROBE_ENABLE_PIN, onoff);
@@ -361,6 +419,9 @@ void Endstops::resync() {
   // Wait for Temperature ISR to run at least once (runs at 1kHz)
   TERN(ENDSTOP_INTERRUPTS_FEATURE, update(), safe_delay(2));
   while (TERN0(ENDSTOP_NOISE_THRESHOLD, endstop_poll_count)) safe_delay(1);
+
+  // Let the probe filter see a full window
+  TERN_(PROBE_FILTERED_SAMPLING, if (z_probe_enabled) safe_delay(PROBE_SAMPLE_WINDOW));
 }
 
 #if ENABLED(PINS_DEBUGGING)
@@ -678,43 +739,66 @@ void Endstops::dump_trigger_log() {
       default: return "UNKNOWN";
     }
   };
-  uint8_t t = trigger_log_tail;
-  const uint8_t h = trigger_log_head;
-  while (t != h) {
-    // Copy volatile entry fields individually to avoid volatile->nonvolatile binding issues
-    Endstops::trigger_entry_t e;
-    e.state = trigger_log[t].state;
-    e.bit_index = trigger_log[t].bit_index;
-    e.seq = trigger_log[t].seq;
-    e.ts = trigger_log[t].ts;
+  Endstops::trigger_entry_t e;
+  while (trigger_log.dequeue(e)) {
     SERIAL_ECHO(" seq:"); SERIAL_ECHO((unsigned long)e.seq);
     SERIAL_ECHO(" ms:"); SERIAL_ECHO((unsigned long)e.ts);
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      SERIAL_ECHO(" edge:-"); SERIAL_ECHO((unsigned long)e.lag_us); SERIAL_ECHO("us");
+    #endif
     SERIAL_ECHO(" bit:"); SERIAL_ECHO((int)e.bit_index);
     SERIAL_ECHO(" ("); SERIAL_ECHO(es_name(e.bit_index)); SERIAL_ECHO(")");
     SERIAL_ECHO(" state:"); SERIAL_ECHOLN((unsigned long)e.state);
-    t = (t + 1) & 0x0F;
   }
-  // Mark consumed
-  trigger_log_tail = h;
 }
 
 // Public API: peek the circular buffer bounds (non-destructive)
 void Endstops::peek_trigger_log_bounds(uint8_t &head, uint8_t &tail) {
-  head = trigger_log_head;
-  tail = trigger_log_tail;
+  head = trigger_log.head_index();
+  tail = trigger_log.tail_index();
 }
 
 // Public API: peek an entry from the trigger_log by raw index (non-destructive)
 Endstops::trigger_entry_public_t Endstops::peek_trigger_log_entry(uint8_t idx) {
+  const Endstops::trigger_entry_t &e = trigger_log.at(idx);
   Endstops::trigger_entry_public_t out;
-  // Copy volatile entry fields individually to avoid volatile->nonvolatile binding issues
-  out.state = trigger_log[idx].state;
-  out.bit_index = trigger_log[idx].bit_index;
-  out.seq = trigger_log[idx].seq;
-  out.ts = trigger_log[idx].ts;
+  out.state = e.state;
+  out.bit_index = e.bit_index;
+  out.seq = e.seq;
+  out.ts = e.ts;
+  TERN_(ENDSTOP_EDGE_CAPTURE, out.lag_us = e.lag_us);
   return out;
 }
 
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+
+  /**
+   * Called from update() in interrupt context. Record the stepper position
+   * and time for each endstop that changed since the last call.
+   */
+  void Endstops::capture_edges() {
+    const endstop_mask_t changed = live_state ^ edge_state;
+    if (!changed) return;
+    edge_state = live_state;
+    const uint32_t us = micros();
+    const xyze_long_t pos = stepper.edge_position();
+    for (uint8_t es = 0; es < NUM_ENDSTOP_STATES; ++es)
+      if (TEST(changed, es)) { edge_position[es] = pos; edge_us[es] = us; }
+  }
+
+  /**
+   * The edge position to use for a trigger of an endstop, if its last change
+   * is recent enough to be the one the noise filter just confirmed. An older
+   * change (e.g., the switch was already pressed when the move started) gives
+   * no position, so the current position is used.
+   */
+  const xyze_long_t* Endstops::edge_for_trigger(const uint8_t es) {
+    constexpr uint32_t max_lag_us = (ENDSTOP_NOISE_THRESHOLD + 2) * 1000UL;
+    return micros() - edge_us[es] <= max_lag_us ? &edge_position[es] : nullptr;
+  }
+
+#endif
+
 /**
  * Called from interrupt context by the Endstop ISR or Stepper ISR!
  * Read endstops to get their current states, register hits for all
@@ -843,8 +927,14 @@ void Endstops::update() {
 
   #if HAS_REAL_BED_PROBE
     // When closing the gap check the enabled probe
-    if (probe_switch_activated())
+    if (probe_switch_activated()) {
+      #if ENABLED(PROBE_FILTERED_SAMPLING)
+        if (z_probe_enabled)
+          SET_BIT_TO(live_state, PROBE_ES, probe_filtered);
+        else
+      #endif
       UPDATE_LIVE_STATE(Z, TERN(USE_Z_MIN_PROBE, MIN_PROBE, MIN));
+    }
   #endif
 
   #if USE_Z_MAX
@@ -903,6 +993,9 @@ void Endstops::update() {
     UPDATE_LIVE_STATE(W, MAX);
   #endif
 
+  // Note the position of any endstop change before filtering
+  TERN_(ENDSTOP_EDGE_CAPTURE, capture_edges());
+
   #if ENDSTOP_NOISE_THRESHOLD
 
     /**
@@ -915,13 +1008,21 @@ void Endstops::update() {
      * still exist. The only way to reduce them further is to increase the number of samples.
      * To reduce the chance to 1% (1/128th) requires 7 samples (adding 7ms of delay).
      */
+    #if ENABLED(PROBE_FILTERED_SAMPLING)
+      // The enabled probe is already filtered so it skips the delay
+      const endstop_mask_t filtered_mask = z_probe_enabled ? endstop_mask_t(_BV(PROBE_ES)) : 0;
+      if (filtered_mask) SET_BIT_TO(validated_live_state, PROBE_ES, TEST(live_state, PROBE_ES));
+    #else
+      constexpr endstop_mask_t filtered_mask = 0;
+    #endif
+
     static endstop_mask_t old_live_state;
-    if (old_live_state != live_state) {
+    if ((old_live_state ^ live_state) & ~filtered_mask) {
       endstop_poll_count = ENDSTOP_NOISE_THRESHOLD;
       old_live_state = live_state;
     }
     else if (endstop_poll_count && !--endstop_poll_count)
-      validated_live_state = live_state;
+      validated_live_state = (live_state & ~filtered_mask) | (validated_live_state & filtered_mask);
 
     if (!abort_enabled()) return;
 
@@ -933,24 +1034,31 @@ void Endstops::update() {
   // Record endstop was hit
   #define _ENDSTOP_HIT(AXIS, MINMAX) SBI(hit_state, ES_ENUM(AXIS, MINMAX))
 
-  // Record a trigger event into the small ISR-safe ring buffer.
-  // Keep this very small and lock-free for use from interrupt context.
+  // Record a trigger event into the small ISR-safe queue.
+  // The ISR is the only producer, so this needs no locking.
   #define RECORD_TRIGGER(ESBIT) do { \
-    const uint8_t _h = trigger_log_head; \
-    trigger_log[_h].state = live_state; \
-    trigger_log[_h].bit_index = ESBIT; \
-    trigger_log[_h].seq = ++trigger_log_seq; \
-    trigger_log[_h].ts = (uint32_t)millis(); \
-    trigger_log_head = (_h + 1) & 0x0F; \
-    if (trigger_log_head == trigger_log_tail) trigger_log_tail = (trigger_log_tail + 1) & 0x0F; \
+    trigger_entry_t _e; \
+    _e.state = live_state; \
+    _e.bit_index = ESBIT; \
+    _e.seq = ++trigger_log_seq; \
+    _e.ts = (uint32_t)millis(); \
+    TERN_(ENDSTOP_EDGE_CAPTURE, _e.lag_us = micros() - edge_us[ESBIT]); \
+    trigger_log.enqueue(_e); \
   } while(0)
 
+  // Stop the axis at the position of the endstop edge, if captured
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+    #define _ENDSTOP_TRIGGERED(AXIS, MINMAX) planner.endstop_triggered(_AXIS(AXIS), edge_for_trigger(ES_ENUM(AXIS, MINMAX)))
+  #else
+    #define _ENDSTOP_TRIGGERED(AXIS, MINMAX) planner.endstop_triggered(_AXIS(AXIS))
+  #endif
+
   // Call the endstop triggered routine for single endstops
   #define PROCESS_ENDSTOP(AXIS, MINMAX) do { \
     if (TEST_ENDSTOP(ES_ENUM(AXIS, MINMAX))) { \
       _ENDSTOP_HIT(AXIS, MINMAX); \
       RECORD_TRIGGER(ES_ENUM(AXIS, MINMAX)); \
-      planner.endstop_triggered(_AXIS(AXIS)); \
+      _ENDSTOP_TRIGGERED(AXIS, MINMAX); \
     } \
   }while(0)
 
@@ -970,7 +1078,7 @@ void Endstops::update() {
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
       if (!stepper.separate_multi_axis || dual_hit == 0b11) \
-        planner.endstop_triggered(_AXIS(A)); \
+        _ENDSTOP_TRIGGERED(A, MINMAX); \
     } \
   }while(0)
 
@@ -980,7 +1088,7 @@ void Endstops::update() {
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
       if (!stepper.separate_multi_axis || triple_hit == 0b111) \
-        planner.endstop_triggered(_AXIS(A)); \
+        _ENDSTOP_TRIGGERED(A, MINMAX); \
     } \
   }while(0)
 
@@ -990,7 +1098,7 @@ void Endstops::update() {
       _ENDSTOP_HIT(A, MINMAX); \
       /* if not performing home or if both endstops were triggered during homing... */ \
       if (!stepper.separate_multi_axis || quad_hit == 0b1111) \
-        planner.endstop_triggered(_AXIS(A)); \
+        _ENDSTOP_TRIGGERED(A, MINMAX); \
     } \
   }while(0)
 
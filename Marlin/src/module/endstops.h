@@ -26,6 +26,7 @@
  */
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/spscqueue.h"
 #include <stdint.h>
 
 #define _ES_ENUM(A,M) A##_##M
@@ -146,6 +147,9 @@ class Endstops {
       uint32_t ts;
       uint8_t bit_index;
       endstop_mask_t state;
+      #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+        uint32_t lag_us;  // Time from the endstop edge to the trigger
+      #endif
     } trigger_entry_public_t;
 
     // Peek the circular buffer bounds (head and tail). Non-destructive.
@@ -153,6 +157,7 @@ class Endstops {
 
     // Read a single trigger-log entry by index (non-destructive). The index
     // is the raw buffer index (0..15) and must be obtained via peek_trigger_log_bounds.
+    // Step to the next entry with (idx + 1) & 0x0F.
     static trigger_entry_public_t peek_trigger_log_entry(uint8_t idx);
 
     #if ENABLED(X_DUAL_ENDSTOPS)
@@ -181,17 +186,33 @@ class Endstops {
       static uint8_t endstop_poll_count;    // Countdown from threshold for polling
     #endif
 
-    // Ring buffer to record trigger events from ISR context. Kept small to be safe in ISR.
+    // Queue to record trigger events from ISR context. Kept small to be safe in ISR.
     typedef struct {
       endstop_mask_t state;
       uint8_t bit_index; // ES_ENUM value
       uint32_t seq;
       uint32_t ts; // timestamp in ms when recorded
+      #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+        uint32_t lag_us; // time in µs from the endstop edge to the trigger
+      #endif
     } trigger_entry_t;
-    static volatile trigger_entry_t trigger_log[16];
-    static volatile uint8_t trigger_log_head;
-    static volatile uint8_t trigger_log_tail;
-    static volatile uint32_t trigger_log_seq;
+    static SPSCQueue<trigger_entry_t, 16> trigger_log; // Newest events are dropped when full
+    static uint32_t trigger_log_seq;                  // A gap in seq shows dropped events
+
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      // Stepper position and time of the last change of each endstop
+      static xyze_long_t edge_position[NUM_ENDSTOP_STATES];
+      static uint32_t edge_us[NUM_ENDSTOP_STATES];
+      static endstop_mask_t edge_state;
+      static void capture_edges();
+      static const xyze_long_t* edge_for_trigger(const uint8_t es);
+    #endif
+
+    #if ENABLED(PROBE_FILTERED_SAMPLING)
+      static bool probe_filtered;           // The probe state agreed by the filter
+      static uint8_t probe_history;         // Burst results of the last polls, newest in bit 0
+      static bool sample_probe();
+    #endif
 
   public:
     Endstops() {};
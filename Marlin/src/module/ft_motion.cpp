@@ -50,6 +50,12 @@ bool FTMotion::stepperCmdBuffHasData = false;   // The stepper buffer has items
 XYZEval<millis_t> FTMotion::axis_move_end_ti = { 0 };
 AxisBits FTMotion::axis_move_dir;
 
+#if ENABLED(FTM_BUDGET_REPORT)
+  uint32_t FTMotion::batch_us,                  // (µs) Time taken to generate and interpolate the last batch
+           FTMotion::batch_us_max;              // (µs) Slowest batch since the last report
+  static uint32_t batch_us_sum;                 // (µs) Time spent on the batch in progress
+#endif
+
 // Private variables.
 
 // NOTE: These are sized for Ulendo FBS use.
@@ -69,7 +75,15 @@ bool FTMotion::batchRdyForInterp = false;       // Indicates the batch is done b
 xyze_pos_t   FTMotion::startPos,                    // (mm) Start position of block
              FTMotion::endPos_prevBlock = { 0.0f }; // (mm) End position of previous block
 xyze_float_t FTMotion::ratio;                       // (ratio) Axis move ratio of block
-float FTMotion::tau = 0.0f;                         // (s) Time since start of block
+#if ENABLED(FTM_FIXED_POINT)
+  int32_t FTMotion::tau = 0;                        // (Q8 samples) Time since start of block
+  xyze_long_t FTMotion::startPos_fixed,             // (Q12 mm) Start position of block
+              FTMotion::ratio_fixed;                // (Q24) Axis move ratio of block
+  FTFixed::Trajectory FTMotion::fixedTraj;          // Trajectory of the block as fixed-point polynomials
+  FTFixed::scale_t FTMotion::steps_scale[DISTINCT_AXES]; // (q10 steps / Q12 mm) Axis steps-per-mm
+#else
+  float FTMotion::tau = 0.0f;                       // (s) Time since start of block
+#endif
 
 // Trajectory generators
 TrapezoidalTrajectoryGenerator FTMotion::trapezoidalGenerator;
@@ -100,16 +114,16 @@ uint32_t FTMotion::interpIdx = 0;               // Index of current data point b
   FTMotion::shaping_t FTMotion::shaping = {
     zi_idx: 0
     #if HAS_X_AXIS
-      , X:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 } // ena, d_zi[], Ai[], Ni[], max_i
+      , X:{ false, { 0 }, { 0.0f }, { 0 }, 0 } // ena, d_zi[], Ai[], Ni[], max_i
     #endif
     #if HAS_Y_AXIS
-      , Y:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 }
+      , Y:{ false, { 0 }, { 0.0f }, { 0 }, 0 }
     #endif
     #if ENABLED(FTM_SHAPER_Z)
-      , Z:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 }
+      , Z:{ false, { 0 }, { 0.0f }, { 0 }, 0 }
     #endif
     #if ENABLED(FTM_SHAPER_E)
-      , E:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 }
+      , E:{ false, { 0 }, { 0.0f }, { 0 }, 0 }
     #endif
   };
 #endif
@@ -117,27 +131,45 @@ uint32_t FTMotion::interpIdx = 0;               // Index of current data point b
 #if ENABLED(FTM_SMOOTHING)
   FTMotion::smoothing_t FTMotion::smoothing = {
     #if HAS_X_AXIS
-      X:{ { 0.0f }, 0.0f, 0 },  // smoothing_pass[], alpha, delay_samples
+      X:{ { 0 }, 0.0f, 0 },  // smoothing_pass[], alpha, delay_samples
     #endif
     #if HAS_Y_AXIS
-      Y:{ { 0.0f }, 0.0f, 0 },
+      Y:{ { 0 }, 0.0f, 0 },
     #endif
     #if HAS_Z_AXIS
-      Z:{ { 0.0f }, 0.0f, 0 },
+      Z:{ { 0 }, 0.0f, 0 },
     #endif
     #if HAS_EXTRUDERS
-      E:{ { 0.0f }, 0.0f, 0 }
+      E:{ { 0 }, 0.0f, 0 }
     #endif
   };
 #endif
 
 #if HAS_EXTRUDERS
   // Linear advance variables.
-  float FTMotion::prev_traj_e = 0.0f;     // (ms) Unit delay of raw extruder position.
+  ft_pos_t FTMotion::prev_traj_e = 0;    // (ms) Unit delay of raw extruder position.
+  #if ENABLED(FTM_FIXED_POINT)
+    FTFixed::scale_t FTMotion::la_scale;  // Linear advance gain times FTM_FS
+  #endif
 #endif
 
 constexpr uint32_t BATCH_SIDX_IN_WINDOW = (FTM_WINDOW_SIZE) - (FTM_BATCH_SIZE); // Batch start index in window.
 
+#if ENABLED(FTM_FIXED_POINT)
+  constexpr int32_t TAU_STEP = _BV(FTFixed::TIME_FRAC);                 // One sample in Q8 samples
+  constexpr float TAU_TO_S = (FTM_TS) / float(_BV(FTFixed::TIME_FRAC)); // (s) per Q8 sample
+  #define FTM_TOTAL_DURATION()    int32_t(fixedTraj.total)
+  #define FTM_SHAPER_GAIN(S, I)   (S).Ai_fixed[I]
+  #define FTM_SHAPED(ACC)         FTFixed::round_gain(ACC)
+  #define FTM_POS_TO_MM(P)        FTFixed::to_mm(P)
+#else
+  constexpr float TAU_STEP = FTM_TS, TAU_TO_S = 1.0f;
+  #define FTM_TOTAL_DURATION()    currentGenerator.getTotalDuration()
+  #define FTM_SHAPER_GAIN(S, I)   (S).Ai[I]
+  #define FTM_SHAPED(ACC)         (ACC)
+  #define FTM_POS_TO_MM(P)        (P)
+#endif
+
 //-----------------------------------------------------------------
 // Function definitions.
 //-----------------------------------------------------------------
@@ -184,6 +216,8 @@ void FTMotion::loop() {
     #endif
   }
 
+  TERN_(FTM_BUDGET_REPORT, uint32_t start_us = micros());
+
   if (blockProcRdy) {
 
     if (!batchRdy) generateTrajectoryPointsFromBlock(); // may clear blockProcRdy
@@ -221,6 +255,11 @@ void FTMotion::loop() {
     batchRdy = false; // Clear so generateTrajectoryPointsFromBlock() can resume generating points.
   }
 
+  #if ENABLED(FTM_BUDGET_REPORT)
+    batch_us_sum += micros() - start_us;
+    start_us = micros();
+  #endif
+
   // Interpolation (generation of step commands from fixed time trajectory).
   while (batchRdyForInterp
     && (stepperCmdBuffItems() < (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME))) {
@@ -228,18 +267,40 @@ void FTMotion::loop() {
     if (++interpIdx == FTM_BATCH_SIZE) {
       batchRdyForInterp = false;
       interpIdx = 0;
+      #if ENABLED(FTM_BUDGET_REPORT)
+        const uint32_t now = micros();
+        batch_us = batch_us_sum + (now - start_us);
+        NOLESS(batch_us_max, batch_us);
+        batch_us_sum = 0;
+        start_us = now;
+      #endif
     }
   }
 
+  TERN_(FTM_BUDGET_REPORT, batch_us_sum += micros() - start_us);
+
   // Report busy status to planner.
   busy = (stepperCmdBuffHasData || blockProcRdy || batchRdy || batchRdyForInterp);
 
 }
 
+#if ENABLED(FTM_BUDGET_REPORT)
+
+  // Report the time taken per batch against the time it covers, and reset the max.
+  void FTMotion::report_budget() {
+    constexpr uint32_t budget_us = uint32_t(FTM_BATCH_SIZE) * 1000000UL / (FTM_FS);
+    SERIAL_ECHOLNPGM("Batch time ", batch_us, "us (max ", batch_us_max, "us) of ", budget_us, "us");
+    batch_us_max = 0;
+  }
+
+#endif
+
 #if HAS_FTM_SHAPING
 
   // Refresh the gains used by shaping functions.
-  void FTMotion::AxisShaping::set_axis_shaping_A(const ftMotionShaper_t shaper, const float zeta, const float vtol) {
+  void FTMotion::AxisShaping::set_axis_shaping_A(const ftMotionShaper_t shaper, const float zeta, const float vtol
+    OPTARG(FTM_CUSTOM_SHAPER, const ft_custom_shaper_t &custom)
+  ) {
 
     const float K = exp(-zeta * M_PI / sqrt(1.f - sq(zeta))),
                 K2 = sq(K),
@@ -322,12 +383,33 @@ void FTMotion::loop() {
       }
       break;
 
+      #if ENABLED(FTM_CUSTOM_SHAPER)
+        case ftMotionShaper_CUSTOM: {
+          // Kernel from the impulse table, with times relative to the first impulse
+          const uint8_t count = _MIN(custom.count, FTM_CUSTOM_IMPULSES);
+          float sum = 0.0f;
+          for (uint8_t i = 0; i < count; i++) sum += custom.amp[i];
+          if (sum > 0.0f) {
+            max_i = count - 1;
+            const float adj = 1.0f / sum;
+            for (uint8_t i = 0; i < count; i++) {
+              Ai[i] = custom.amp[i] * adj;
+              Ci[i] = custom.time[i] - custom.time[0];
+            }
+            break;
+          }
+        } // Fall-through: An empty table doesn't shape
+      #endif
+
       case ftMotionShaper_NONE:
         max_i = 0;
         Ai[0] = 1.0f; // No echoes so the whole impulse is applied in the first tap
         break;
     }
 
+    #if ENABLED(FTM_FIXED_POINT)
+      for (uint32_t i = 0; i <= max_i; i++) Ai_fixed[i] = FTFixed::to_gain(Ai[i]);
+    #endif
   }
 
   // Refresh the indices used by shaping functions.
@@ -361,6 +443,12 @@ void FTMotion::loop() {
         Ni[1] = round((0.375f / f / df) * (FTM_FS));
         Ni[2] = Ni[1] + Ni[1];
         break;
+      #if ENABLED(FTM_CUSTOM_SHAPER)
+        case ftMotionShaper_CUSTOM:
+          // Measured times are already damped periods. M495 limits them to 2 periods, within FTM_ZMAX.
+          for (uint8_t i = 1; i <= max_i; ++i) Ni[i] = round((Ci[i] / f) * (FTM_FS));
+          break;
+      #endif
       case ftMotionShaper_NONE:
         // No echoes.
         // max_i is set to 0 by set_axis_shaping_A, so delay centroid (Ni[0]) will also correctly be 0
@@ -390,13 +478,14 @@ void FTMotion::loop() {
         alpha = 0.0f;
         delay_samples = 0;
       }
+      TERN_(FTM_FIXED_POINT, alpha_fixed = lroundf(alpha * _BV(FTFixed::ALPHA_FRAC)));
     }
   #endif
 
   void FTMotion::update_shaping_params() {
     #define UPDATE_SHAPER(A) \
       shaping.A.ena = ftMotion.cfg.shaper.A != ftMotionShaper_NONE; \
-      shaping.A.set_axis_shaping_A(cfg.shaper.A, cfg.zeta.A, cfg.vtol.A); \
+      shaping.A.set_axis_shaping_A(cfg.shaper.A, cfg.zeta.A, cfg.vtol.A OPTARG(FTM_CUSTOM_SHAPER, cfg.custom.A)); \
       shaping.A.set_axis_shaping_N(cfg.shaper.A, cfg.baseFreq.A, cfg.zeta.A);
 
     SHAPED_MAP(UPDATE_SHAPER);
@@ -440,6 +529,7 @@ void FTMotion::reset() {
   steps.reset();
   step_error_q10.reset();
   interpIdx = 0;
+  TERN_(FTM_BUDGET_REPORT, batch_us_sum = 0);
 
   #if HAS_FTM_SHAPING
     #define _RESET_ZI(A) ZERO(shaping.A.d_zi);
@@ -447,7 +537,7 @@ void FTMotion::reset() {
     shaping.zi_idx = 0;
   #endif
 
-  TERN_(HAS_EXTRUDERS, prev_traj_e = 0.0f);  // Reset linear advance variables.
+  TERN_(HAS_EXTRUDERS, prev_traj_e = 0);    // Reset linear advance variables.
   TERN_(DISTINCT_E_FACTORS, block_extruder_axis = E_AXIS);
 
   axis_move_end_ti.reset();
@@ -491,12 +581,17 @@ void FTMotion::runoutBlock() {
 
   ratio.reset();
   uint32_t max_intervals = PROP_BATCHES * (FTM_BATCH_SIZE) + n_to_settle_shaper + n_to_fill_batch_after_settling;
-  const float reminder_from_last_block = - tau;
+  const float reminder_from_last_block = - tau * TAU_TO_S;
   const float total_duration = max_intervals * FTM_TS + reminder_from_last_block;
 
   // Plan a zero-motion trajectory for runout
   currentGenerator.planRunout(total_duration);
 
+  #if ENABLED(FTM_FIXED_POINT)
+    loadFixedBlockData();
+    fixedTraj.set_runout(max_intervals * TAU_STEP - tau); // Exactly max_intervals samples
+  #endif
+
   blockProcRdy = true; // since ratio is 0, the trajectory positions won't advance in any axis
 }
 
@@ -547,8 +642,10 @@ void FTMotion::loadBlockData(block_t * const current_block) {
   // Plan the trajectory using the trajectory generator
   currentGenerator.plan(initial_speed, final_speed, accel, nominal_speed, totalLength);
 
+  TERN_(FTM_FIXED_POINT, loadFixedBlockData());
+
   // Accel + Coasting + Decel + datapoints
-  const float reminder_from_last_block = - tau;
+  const float reminder_from_last_block = - tau * TAU_TO_S;
 
   endPos_prevBlock += moveDist;
 
@@ -569,10 +666,38 @@ void FTMotion::loadBlockData(block_t * const current_block) {
   LOGICAL_AXIS_MAP(_SET_MOVE_END);
 }
 
+#if ENABLED(FTM_FIXED_POINT)
+
+  // Convert the planned block for the fixed-point samples.
+  // Apart from planning this is the only float math for a block.
+  void FTMotion::loadFixedBlockData() {
+    #define _SET_FIXED(A) do{ \
+      startPos_fixed.A = FTFixed::to_pos(startPos.A); \
+      ratio_fixed.A = FTFixed::to_ratio(ratio.A); \
+    }while(0);
+    LOGICAL_AXIS_MAP_LC(_SET_FIXED);
+
+    float c[7], t = 0.0f;
+    uint32_t start = 0;
+    for (uint8_t i = 0; i < 3; ++i) {
+      t += currentGenerator.getPhasePolynomial(i, c);
+      const uint32_t end = lroundf(t * float((FTM_FS) * _BV(FTFixed::TIME_FRAC)));
+      fixedTraj.set_phase(i, start, end, c);
+      start = end;
+    }
+
+    // Steps-per-mm and Linear Advance gain may change between blocks
+    for (uint8_t a = 0; a < DISTINCT_AXES; ++a)
+      steps_scale[a] = FTFixed::to_scale(planner.settings.axis_steps_per_mm[a], 10 - FTFixed::POS_FRAC);
+    TERN_(HAS_EXTRUDERS, la_scale = FTFixed::to_scale((FTM_FS) * cfg.linearAdvK));
+  }
+
+#endif // FTM_FIXED_POINT
+
 // Generate data points of the trajectory.
 void FTMotion::generateTrajectoryPointsFromBlock() {
-  const float total_duration = currentGenerator.getTotalDuration();
-  if (tau + FTM_TS > total_duration) {
+  const auto total_duration = FTM_TOTAL_DURATION();
+  if (tau + TAU_STEP > total_duration) {
     // TODO: refactor code so this thing is not twice.
     // the reason of it being in the beginning, is that a block can be so short that it has
     // zero trajectories.
@@ -583,23 +708,32 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
     return;
   }
   do {
-    tau += FTM_TS;                // (s) Time since start of block
+    tau += TAU_STEP;              // (s) Time since start of block
                                   // If the end of the last block doesn't exactly land on a trajectory index,
                                   // tau can start negative, but it always holds that `tau > -FTM_TS`
 
-    // Get distance from trajectory generator
-    const float dist = currentGenerator.getDistanceAtTime(tau);
-
-    #define _SET_TRAJ(q) traj.q[traj_idx_set] = startPos.q + ratio.q * dist;
+    #if ENABLED(FTM_FIXED_POINT)
+      // Get distance from the fixed-point trajectory
+      const ft_pos_t dist = fixedTraj.distance(tau);
+      #define _SET_TRAJ(q) traj.q[traj_idx_set] = startPos_fixed.q + FTFixed::mul_ratio(dist, ratio_fixed.q);
+    #else
+      // Get distance from trajectory generator
+      const float dist = currentGenerator.getDistanceAtTime(tau);
+      #define _SET_TRAJ(q) traj.q[traj_idx_set] = startPos.q + ratio.q * dist;
+    #endif
     LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
     #if FTM_HAS_LIN_ADVANCE
       if (cfg.linearAdvEna) {
-        float traj_e = traj.e[traj_idx_set];
+        const ft_pos_t traj_e = traj.e[traj_idx_set];
         if (use_advance_lead) {
           // Don't apply LA to retract/unretract blocks
-          float e_rate = (traj_e - prev_traj_e) * (FTM_FS);
-          traj.e[traj_idx_set] += e_rate * cfg.linearAdvK;
+          #if ENABLED(FTM_FIXED_POINT)
+            traj.e[traj_idx_set] += ft_pos_t(FTFixed::mul_scale(traj_e - prev_traj_e, la_scale));
+          #else
+            float e_rate = (traj_e - prev_traj_e) * (FTM_FS);
+            traj.e[traj_idx_set] += e_rate * cfg.linearAdvK;
+          #endif
         }
         prev_traj_e = traj_e;
       }
@@ -612,7 +746,7 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
       #if HAS_DYNAMIC_FREQ_MM
         case dynFreqMode_Z_BASED: {
           static float oldz = 0.0f;
-          const float z = traj.z[traj_idx_set];
+          const float z = FTM_POS_TO_MM(traj.z[traj_idx_set]);
           if (z != oldz) { // Only update if Z changed.
             oldz = z;
             #if HAS_X_AXIS
@@ -632,10 +766,10 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
           // Update constantly. The optimization done for Z value makes
           // less sense for E, as E is expected to constantly change.
           #if HAS_X_AXIS
-            shaping.X.set_axis_shaping_N(cfg.shaper.x, cfg.baseFreq.x + cfg.dynFreqK.x * traj.e[traj_idx_set], cfg.zeta.x);
+            shaping.X.set_axis_shaping_N(cfg.shaper.x, cfg.baseFreq.x + cfg.dynFreqK.x * FTM_POS_TO_MM(traj.e[traj_idx_set]), cfg.zeta.x);
           #endif
           #if HAS_Y_AXIS
-            shaping.Y.set_axis_shaping_N(cfg.shaper.y, cfg.baseFreq.y + cfg.dynFreqK.y * traj.e[traj_idx_set], cfg.zeta.y);
+            shaping.Y.set_axis_shaping_N(cfg.shaper.y, cfg.baseFreq.y + cfg.dynFreqK.y * FTM_POS_TO_MM(traj.e[traj_idx_set]), cfg.zeta.y);
           #endif
           break;
       #endif
@@ -645,15 +779,27 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
     uint32_t max_total_delay = 0;
 
     #if ENABLED(FTM_SMOOTHING)
-      #define _SMOOTHEN(A) /* Approximate gaussian smoothing via chained EMAs */ \
-        if (smoothing.A.alpha > 0.0f) { \
-          float smooth_val = traj.A[traj_idx_set]; \
-          for (uint8_t _i = 0; _i < FTM_SMOOTHING_ORDER; ++_i) { \
-            smoothing.A.smoothing_pass[_i] += (smooth_val - smoothing.A.smoothing_pass[_i]) * smoothing.A.alpha; \
-            smooth_val = smoothing.A.smoothing_pass[_i]; \
-          } \
-          traj.A[traj_idx_set] = smooth_val; \
-        }
+      #if ENABLED(FTM_FIXED_POINT)
+        #define _SMOOTHEN(A) /* Approximate gaussian smoothing via chained EMAs */ \
+          if (smoothing.A.alpha_fixed) { \
+            int64_t smooth_val = int64_t(traj.A[traj_idx_set]) << FTFixed::ALPHA_FRAC; \
+            for (uint8_t _i = 0; _i < FTM_SMOOTHING_ORDER; ++_i) { \
+              FTFixed::ema(smoothing.A.smoothing_pass[_i], smooth_val, smoothing.A.alpha_fixed); \
+              smooth_val = smoothing.A.smoothing_pass[_i]; \
+            } \
+            traj.A[traj_idx_set] = ft_pos_t((smooth_val + _BV(FTFixed::ALPHA_FRAC - 1)) >> FTFixed::ALPHA_FRAC); \
+          }
+      #else
+        #define _SMOOTHEN(A) /* Approximate gaussian smoothing via chained EMAs */ \
+          if (smoothing.A.alpha > 0.0f) { \
+            float smooth_val = traj.A[traj_idx_set]; \
+            for (uint8_t _i = 0; _i < FTM_SMOOTHING_ORDER; ++_i) { \
+              smoothing.A.smoothing_pass[_i] += (smooth_val - smoothing.A.smoothing_pass[_i]) * smoothing.A.alpha; \
+              smooth_val = smoothing.A.smoothing_pass[_i]; \
+            } \
+            traj.A[traj_idx_set] = smooth_val; \
+          }
+      #endif
 
       CARTES_MAP(_SMOOTHEN);
       max_total_delay += _MAX(CARTES_LIST(
@@ -680,15 +826,16 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
               : -shaping.A.Ni[0]; \
           /* α=1−exp(−(dt / (τ / order))) */ \
           shaping.A.d_zi[shaping.zi_idx] = traj.A[traj_idx_set]; \
-          traj.A[traj_idx_set] = 0; \
+          ft_acc_t shaped = 0; \
           for (uint32_t i = 0; i <= shaping.A.max_i; i++) { \
             /* echo_delay is always positive since Ni[i] = echo_relative_delay - group_delay + max_total_delay */ \
             /* where echo_relative_delay > 0 and group_delay ≤ max_total_delay */ \
             const uint32_t echo_delay = group_delay + shaping.A.Ni[i]; \
             int32_t udiff = shaping.zi_idx - echo_delay; \
             if (udiff < 0) udiff += FTM_ZMAX; \
-            traj.A[traj_idx_set] += shaping.A.Ai[i] * shaping.A.d_zi[udiff]; \
+            shaped += ft_acc_t(FTM_SHAPER_GAIN(shaping.A, i)) * shaping.A.d_zi[udiff]; \
           } \
+          traj.A[traj_idx_set] = FTM_SHAPED(shaped); \
         } while (0);
 
       SHAPED_MAP(_SHAPE);
@@ -703,7 +850,7 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
       batchRdy = true;
     }
     traj_idx_get++;
-    if (tau + FTM_TS > total_duration) {
+    if (tau + TAU_STEP > total_duration) {
       // the next iteration will fall beyond this block
       blockProcRdy = false;
       traj_idx_get = 0;
@@ -721,16 +868,21 @@ void FTMotion::generateTrajectoryPointsFromBlock() {
  * Add up to one stepper command to the buffer with STEP/DIR bits for all axes.
  */
 void FTMotion::generateStepsFromTrajectory(const uint32_t idx) {
-  constexpr float INV_FTM_STEPS_PER_UNIT_TIME = 1.0f / (FTM_STEPS_PER_UNIT_TIME);
-
   // q10 per-stepper-slot increment toward this sample’s target step count.
   // (traj * steps_per_mm - steps) = steps still due at the start of this UNIT_TIME.
   // Convert to q10 (×2^10), then subtract the current accumulator error: step_error_q10 / FTM_STEPS_PER_UNIT_TIME.
   // Over FTM_STEPS_PER_UNIT_TIME stepper-slots this sums to the exact target (no drift).
   // Any fraction of a step that may remain will be accounted for by the next UNIT_TIME
-  #define TOSTEPS_q10(A, B) int32_t( \
-    (trajMod.A[idx] * planner.settings.axis_steps_per_mm[B] - steps.A) * _BV(10) \
-     - step_error_q10.A * INV_FTM_STEPS_PER_UNIT_TIME )
+  #if ENABLED(FTM_FIXED_POINT)
+    #define TOSTEPS_q10(A, B) int32_t( \
+      FTFixed::mul_scale(trajMod.A[idx], steps_scale[B]) - (int64_t(steps.A) << 10) \
+       - step_error_q10.A / int32_t(FTM_STEPS_PER_UNIT_TIME) )
+  #else
+    constexpr float INV_FTM_STEPS_PER_UNIT_TIME = 1.0f / (FTM_STEPS_PER_UNIT_TIME);
+    #define TOSTEPS_q10(A, B) int32_t( \
+      (trajMod.A[idx] * planner.settings.axis_steps_per_mm[B] - steps.A) * _BV(10) \
+       - step_error_q10.A * INV_FTM_STEPS_PER_UNIT_TIME )
+  #endif
 
   xyze_long_t delta_q10 = LOGICAL_AXIS_ARRAY(
     TOSTEPS_q10(e, block_extruder_axis),
@@ -66,6 +66,10 @@ typedef struct FTConfig {
       static constexpr dynFreqMode_t dynFreqMode = dynFreqMode_DISABLED;
     #endif
 
+    #if ENABLED(FTM_CUSTOM_SHAPER)
+      ft_shaped_custom_t custom = {};                     // Impulse tables for the Custom shaper (M495)
+    #endif
+
   #endif // HAS_FTM_SHAPING
 
   #if HAS_EXTRUDERS
@@ -95,6 +99,7 @@ class FTMotion {
           cfg.baseFreq.A = FTM_SHAPING_DEFAULT_FREQ_##A; \
           cfg.zeta.A     = FTM_SHAPING_ZETA_##A; \
           cfg.vtol.A     = FTM_SHAPING_V_TOL_##A; \
+          TERN_(FTM_CUSTOM_SHAPER, cfg.custom.A = {}); \
         }while(0);
 
         SHAPED_MAP(_SET_CFG_DEFAULTS);
@@ -168,6 +173,11 @@ class FTMotion {
       return cfg.active ? axis_move_dir[axis] : stepper.last_direction_bits[axis];
     }
 
+    #if ENABLED(FTM_BUDGET_REPORT)
+      static uint32_t batch_us, batch_us_max; // (µs) Time taken to generate and interpolate the last / slowest batch
+      static void report_budget();
+    #endif
+
   private:
 
     static xyze_trajectory_t traj;
@@ -180,7 +190,15 @@ class FTMotion {
     static xyze_pos_t   startPos,         // (mm) Start position of block
                         endPos_prevBlock; // (mm) End position of previous block
     static xyze_float_t ratio;            // (ratio) Axis move ratio of block
-    static float tau;                     // (s) Time since start of block
+    #if ENABLED(FTM_FIXED_POINT)
+      static int32_t tau;                 // (Q8 samples) Time since start of block
+      static xyze_long_t startPos_fixed,  // (Q12 mm) Start position of block
+                         ratio_fixed;     // (Q24) Axis move ratio of block
+      static FTFixed::Trajectory fixedTraj;                     // Trajectory of the block as fixed-point polynomials
+      static FTFixed::scale_t steps_scale[DISTINCT_AXES];       // (q10 steps / Q12 mm) Axis steps-per-mm
+    #else
+      static float tau;                   // (s) Time since start of block
+    #endif
 
     // Trajectory generators
     static TrapezoidalTrajectoryGenerator trapezoidalGenerator;
@@ -213,13 +231,21 @@ class FTMotion {
       // Shaping data
       typedef struct AxisShaping {
         bool ena = false;                 // Enabled indication
-        float d_zi[FTM_ZMAX] = { 0.0f };  // Data point delay vector
-        float Ai[5];                      // Shaping gain vector
-        int32_t Ni[5];                    // Shaping time index vector
+        ft_pos_t d_zi[FTM_ZMAX] = { 0 };  // Data point delay vector
+        float Ai[FTM_SHAPER_IMPULSES];    // Shaping gain vector
+        int32_t Ni[FTM_SHAPER_IMPULSES];  // Shaping time index vector
         uint32_t max_i;                   // Vector length for the selected shaper
+        #if ENABLED(FTM_FIXED_POINT)
+          ft_gain_t Ai_fixed[FTM_SHAPER_IMPULSES]; // (Q30) Shaping gain vector
+        #endif
+        #if ENABLED(FTM_CUSTOM_SHAPER)
+          float Ci[FTM_SHAPER_IMPULSES];  // Custom impulse times after the first, in periods of the base frequency
+        #endif
 
         void set_axis_shaping_N(const ftMotionShaper_t shaper, const float f, const float zeta);    // Sets the gains used by shaping functions.
-        void set_axis_shaping_A(const ftMotionShaper_t shaper, const float zeta, const float vtol); // Sets the indices used by shaping functions.
+        void set_axis_shaping_A(const ftMotionShaper_t shaper, const float zeta, const float vtol   // Sets the indices used by shaping functions.
+          OPTARG(FTM_CUSTOM_SHAPER, const ft_custom_shaper_t &custom)
+        );
 
       } axis_shaping_t;
 
@@ -235,9 +261,16 @@ class FTMotion {
     #if ENABLED(FTM_SMOOTHING)
       // Smoothing data for each axis
       typedef struct AxisSmoothing {
-        float smoothing_pass[FTM_SMOOTHING_ORDER] = { 0.0f }; // Last value of each of the exponential smoothing passes
+        #if ENABLED(FTM_FIXED_POINT)
+          int64_t smoothing_pass[FTM_SMOOTHING_ORDER] = { 0 }; // (Q28 mm) Last value of each of the exponential smoothing passes
+        #else
+          float smoothing_pass[FTM_SMOOTHING_ORDER] = { 0.0f }; // Last value of each of the exponential smoothing passes
+        #endif
         float alpha = 0.0f;               // Pre-calculated alpha for smoothing.
         uint32_t delay_samples = 0;       // Pre-calculated delay in samples for smoothing.
+        #if ENABLED(FTM_FIXED_POINT)
+          int32_t alpha_fixed = 0;        // (Q16) Alpha for smoothing
+        #endif
         void set_smoothing_time(const float s_time); // Set smoothing time, recalculate alpha and delay.
       } axis_smoothing_t;
 
@@ -250,7 +283,10 @@ class FTMotion {
 
     // Linear advance variables.
     #if HAS_EXTRUDERS
-      static float prev_traj_e;
+      static ft_pos_t prev_traj_e;
+      #if ENABLED(FTM_FIXED_POINT)
+        static FTFixed::scale_t la_scale; // Linear advance gain times FTM_FS
+      #endif
     #endif
 
     // Private methods
@@ -260,6 +296,9 @@ class FTMotion {
     static void loadBlockData(block_t *const current_block);
     static void generateTrajectoryPointsFromBlock();
     static void generateStepsFromTrajectory(const uint32_t idx);
+    #if ENABLED(FTM_FIXED_POINT)
+      static void loadFixedBlockData();
+    #endif
 
     FORCE_INLINE static int32_t num_samples_shaper_settle() {
       #define _OR_ENA(A) || shaping.A.ena
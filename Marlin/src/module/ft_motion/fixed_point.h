@@ -0,0 +1,142 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fixed_point.h - Fixed-point kernels for FT Motion
+ *
+ * With FTM_FIXED_POINT each trajectory sample is evaluated, shaped, smoothed and
+ * interpolated into steps with integers, so MCUs without an FPU (e.g., STM32F103)
+ * only use soft-float once per block instead of for every sample and axis.
+ *
+ * Positions are mm in Q12 (~0.24µm, up to ±524m) so an absolute E doesn't overflow.
+ * Shaper gains are Q30, axis ratios Q24, and times Q8 samples from the start of a block.
+ * Only standard types are used so the kernels can be tested natively against float.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+namespace FTFixed {
+
+  typedef int32_t pos_t;
+
+  constexpr uint8_t POS_FRAC   = 12,  // Fractional bits of a position [mm]
+                    GAIN_FRAC  = 30,  // Fractional bits of a shaper gain
+                    RATIO_FRAC = 24,  // Fractional bits of an axis ratio. E may move more than XYZ.
+                    ALPHA_FRAC = 16,  // Fractional bits of a smoothing alpha
+                    TIME_FRAC  = 8;   // Fractional bits of a time [samples]
+
+  inline pos_t to_pos(const float mm) { return pos_t(lroundf(mm * float(1UL << POS_FRAC))); }
+  inline float to_mm(const pos_t p) { return float(p) * (1.0f / float(1UL << POS_FRAC)); }
+
+  // Gains and ratios, with |g| < 2
+  inline int32_t to_gain(const float g) { return int32_t(lroundf(g * float(1UL << GAIN_FRAC))); }
+  inline pos_t round_gain(const int64_t acc) { return pos_t((acc + (int64_t(1) << (GAIN_FRAC - 1))) >> GAIN_FRAC); }
+
+  // Axis ratios, with |r| < 128
+  inline int32_t to_ratio(const float r) {
+    constexpr float lim = float(1UL << (31 - RATIO_FRAC)) - 1.0f;
+    return int32_t(lroundf((r > lim ? lim : r < -lim ? -lim : r) * float(1UL << RATIO_FRAC)));
+  }
+  inline pos_t mul_ratio(const pos_t p, const int32_t r) {
+    return pos_t((int64_t(p) * r + (int64_t(1) << (RATIO_FRAC - 1))) >> RATIO_FRAC);
+  }
+
+  // A positive factor as m / 2^shift, with m normalized to [2^30, 2^31). Exact for any float.
+  typedef struct { uint32_t m; uint8_t shift; } scale_t;
+
+  // Scale for k * 2^frac
+  inline scale_t to_scale(const float k, const int8_t frac=0) {
+    if (!(k > 0.0f)) return { 0, 0 };
+    int e;
+    const float f = frexpf(k, &e);    // k = f * 2^e with f in [0.5, 1)
+    const int s = 31 - e - frac;
+    if (s < 0) return { 0x7FFFFFFFUL, 0 };
+    if (s > 63) return { 0, 0 };
+    return { uint32_t(ldexpf(f, 31)), uint8_t(s) };
+  }
+
+  // floor(x * scale)
+  inline int64_t mul_scale(const int32_t x, const scale_t &s) { return (int64_t(x) * s.m) >> s.shift; }
+
+  // One pass of exponential smoothing, with the pass held in Q(POS_FRAC + ALPHA_FRAC)
+  inline void ema(int64_t &pass, const int64_t val, const int32_t alpha) {
+    pass += ((val - pass) * alpha) >> ALPHA_FRAC;
+  }
+
+  /**
+   * A block trajectory as three polynomial phases (accel, coast, decel).
+   * Each phase is a polynomial of up to 6th degree in u = (t - start) / (end - start),
+   * so the samples of a block are found with a few 32x32 multiplies each.
+   */
+  class Trajectory {
+    public:
+      typedef struct {
+        uint32_t start, end;  // Times of the phase [Q8 samples]
+        uint64_t inv;         // 2^62 / (end - start)
+        pos_t c[7];           // Coefficients of u^0 to u^6 [Q12 mm]
+        uint8_t degree;
+      } phase_t;
+
+      phase_t phase[3];
+      uint32_t total;         // Duration of the block [Q8 samples]
+
+      // Set a phase from float coefficients. Phases must be set in order.
+      void set_phase(const uint8_t i, const uint32_t start, const uint32_t end, const float (&c)[7]) {
+        phase_t &p = phase[i];
+        p.start = start;
+        p.end = end;
+        p.degree = 0;
+        p.c[0] = to_pos(c[0]);
+        if (end > start) {
+          p.inv = (uint64_t(1) << 62) / (end - start);
+          for (uint8_t k = 1; k < 7; ++k) if ((p.c[k] = to_pos(c[k]))) p.degree = k;
+        }
+        else {
+          p.inv = 0;                    // Empty phase. Only u = 0 is used, if ever.
+          for (uint8_t k = 1; k < 7; ++k) p.c[k] = 0;
+        }
+        total = end;
+      }
+
+      // A runout (or dwell) of the given duration without motion
+      void set_runout(const uint32_t duration) {
+        constexpr float none[7] = { 0 };
+        set_phase(0, 0, 0, none);
+        set_phase(1, 0, duration, none);
+        set_phase(2, duration, duration, none);
+      }
+
+      // Distance traveled at time t
+      pos_t distance(const uint32_t t) const {
+        const phase_t &p = phase[t < phase[0].end ? 0 : t <= phase[1].end ? 1 : 2];
+        const uint32_t len = p.end - p.start, d = t - p.start;
+        const uint32_t u = uint32_t(((uint64_t)(d < len ? d : len) * p.inv) >> 32);   // Q30
+        int64_t acc = p.c[p.degree];
+        for (int8_t k = p.degree - 1; k >= 0; --k)
+          acc = p.c[k] + ((acc * u) >> 30);
+        return pos_t(acc);
+      }
+  };
+
+} // namespace FTFixed
@@ -101,6 +101,35 @@ public:
 
   float getTotalDuration() const override { return T1 + T2 + T3; }
 
+  #if ENABLED(FTM_FIXED_POINT)
+    float getPhasePolynomial(const uint8_t phase, float (&c)[7]) const override {
+      for (float &v : c) v = 0.0f;
+      switch (phase) {
+        case 0: {
+          const float T1_2 = T1 * T1, T1_3 = T1_2 * T1;
+          c[1] = acc_c1 * T1;
+          c[3] = acc_c3 * T1_3;
+          c[4] = acc_c4 * T1_3 * T1;
+          c[5] = acc_c5 * T1_3 * T1_2;
+          return T1;
+        }
+        case 1:
+          c[0] = pos_before_coast;
+          c[1] = this->nominal_speed * T2;
+          return T2;
+        default: {
+          const float T3_2 = T3 * T3, T3_3 = T3_2 * T3;
+          c[0] = pos_after_coast;
+          c[1] = dec_c1 * T3;
+          c[3] = dec_c3 * T3_3;
+          c[4] = dec_c4 * T3_3 * T3;
+          c[5] = dec_c5 * T3_3 * T3_2;
+          return T3;
+        }
+      }
+    }
+  #endif
+
   void reset() override {
     acc_c1 = acc_c3 = acc_c4 = acc_c5 = 0.0f;
     dec_c1 = dec_c3 = dec_c4 = dec_c5 = 0.0f;
@@ -129,6 +129,36 @@ float Poly6TrajectoryGenerator::getDistanceAtTime(const float t) const {
 
 float Poly6TrajectoryGenerator::getTotalDuration() const { return T1 + T2 + T3; }
 
+#if ENABLED(FTM_FIXED_POINT)
+
+  // The quintic plus c6 * u^3 (1 - u)^3 = c6 * (u^3 - 3u^4 + 3u^5 - u^6)
+  float Poly6TrajectoryGenerator::getPhasePolynomial(const uint8_t phase, float (&c)[7]) const {
+    for (float &v : c) v = 0.0f;
+    switch (phase) {
+      case 0:
+        c[1] = initial_speed * T1;
+        c[3] = acc_c3 + acc_c6;
+        c[4] = acc_c4 - 3.0f * acc_c6;
+        c[5] = acc_c5 + 3.0f * acc_c6;
+        c[6] = -acc_c6;
+        return T1;
+      case 1:
+        c[0] = pos_before_coast;
+        c[1] = nominal_speed * T2;
+        return T2;
+      default:
+        c[0] = pos_after_coast;
+        c[1] = nominal_speed * T3;
+        c[3] = dec_c3 + dec_c6;
+        c[4] = dec_c4 - 3.0f * dec_c6;
+        c[5] = dec_c5 + 3.0f * dec_c6;
+        c[6] = -dec_c6;
+        return T3;
+    }
+  }
+
+#endif
+
 void Poly6TrajectoryGenerator::reset() {
   T1 = T2 = T3 = 0.0f;
   initial_speed = nominal_speed = 0.0f;
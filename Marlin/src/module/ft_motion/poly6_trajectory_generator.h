@@ -45,6 +45,10 @@ public:
 
   void reset() override;
 
+  #if ENABLED(FTM_FIXED_POINT)
+    float getPhasePolynomial(const uint8_t phase, float (&c)[7]) const override;
+  #endif
+
 private:
   // ===== Utilities (position domain) =====
   // Base quintic in position (end accel = 0): s5(u) = s0 + v0*Ts*u + c3 u^3 + c4 u^4 + c5 u^5
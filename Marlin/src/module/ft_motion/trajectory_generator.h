@@ -65,6 +65,16 @@ public:
    */
   virtual void reset() = 0;
 
+  #if ENABLED(FTM_FIXED_POINT)
+    /**
+     * Get one phase of the trajectory as a polynomial in u = (t - phase start) / phase duration.
+     * @param phase Phase index (0: Accel, 1: Coast, 2: Decel)
+     * @param c Coefficients of u^0 to u^6 [mm]
+     * @return Duration of the phase [s]
+     */
+    virtual float getPhasePolynomial(const uint8_t phase, float (&c)[7]) const = 0;
+  #endif
+
 protected:
   // Protected constructor to prevent direct instantiation
   TrajectoryGenerator() = default;
@@ -74,6 +74,27 @@ public:
     return T1 + T2 + T3;
   }
 
+  #if ENABLED(FTM_FIXED_POINT)
+    float getPhasePolynomial(const uint8_t phase, float (&c)[7]) const override {
+      for (float &v : c) v = 0.0f;
+      switch (phase) {
+        case 0:
+          c[1] = this->initial_speed * T1;
+          c[2] = 0.5f * this->acceleration * T1 * T1;
+          return T1;
+        case 1:
+          c[0] = pos_before_coast;
+          c[1] = this->nominal_speed * T2;
+          return T2;
+        default:
+          c[0] = pos_after_coast;
+          c[1] = this->nominal_speed * T3;
+          c[2] = -0.5f * this->acceleration * T3 * T3;
+          return T3;
+      }
+    }
+  #endif
+
   void planRunout(float duration) override {
     reset();
     T2 = duration; // Coast at zero speed for the entire duration
@@ -33,6 +33,9 @@ enum ftMotionShaper_t : uint8_t {
   ftMotionShaper_2HEI  = 6, // 2-Hump Extra-Intensive
   ftMotionShaper_3HEI  = 7, // 3-Hump Extra-Intensive
   ftMotionShaper_MZV   = 8  // Modified Zero Vibration
+  #if ENABLED(FTM_CUSTOM_SHAPER)
+    , ftMotionShaper_CUSTOM = 9 // Impulse table set with M495
+  #endif
 };
 
 enum dynFreqMode_t : uint8_t {
@@ -44,8 +47,17 @@ enum dynFreqMode_t : uint8_t {
 #define AXIS_IS_SHAPING(A)    TERN0(FTM_SHAPER_##A, (ftMotion.cfg.shaper.A != ftMotionShaper_NONE))
 #define AXIS_IS_EISHAPING(A)  TERN0(FTM_SHAPER_##A, WITHIN(ftMotion.cfg.shaper.A, ftMotionShaper_EI, ftMotionShaper_3HEI))
 
-typedef struct XYZEarray<float, FTM_WINDOW_SIZE> xyze_trajectory_t;
-typedef struct XYZEarray<float, FTM_BATCH_SIZE> xyze_trajectoryMod_t;
+#if ENABLED(FTM_FIXED_POINT)
+  #include "ft_motion/fixed_point.h"
+  typedef FTFixed::pos_t ft_pos_t;  // (Q12 mm) Trajectory position
+  typedef int32_t ft_gain_t;        // (Q30) Shaper gain
+  typedef int64_t ft_acc_t;         // Sum of gain * position
+#else
+  typedef float ft_pos_t, ft_gain_t, ft_acc_t;
+#endif
+
+typedef struct XYZEarray<ft_pos_t, FTM_WINDOW_SIZE> xyze_trajectory_t;
+typedef struct XYZEarray<ft_pos_t, FTM_BATCH_SIZE> xyze_trajectoryMod_t;
 
 // TODO: Convert ft_command_t to a struct with bitfields instead of using a primitive type
 enum {
@@ -104,6 +116,15 @@ typedef FTShapedAxes<float>            ft_shaped_float_t;
 typedef FTShapedAxes<ftMotionShaper_t> ft_shaped_shaper_t;
 typedef FTShapedAxes<dynFreqMode_t>    ft_shaped_dfm_t;
 
+#if ENABLED(FTM_CUSTOM_SHAPER)
+  typedef struct FTCustomShaper {
+    uint8_t count;                      // Number of impulses. 0 for no shaping.
+    float amp[FTM_CUSTOM_IMPULSES];     // Impulse amplitudes, normalized to a sum of 1 when applied
+    float time[FTM_CUSTOM_IMPULSES];    // Impulse times in periods of the base frequency, ascending
+  } ft_custom_shaper_t;
+  typedef FTShapedAxes<ft_custom_shaper_t> ft_shaped_custom_t;
+#endif
+
 #if ENABLED(FTM_SMOOTHING)
   typedef struct FTSmoothedAxes {
     float CARTES_AXIS_NAMES;
@@ -71,7 +71,7 @@
   #include "../feature/fwretract.h"
 #endif
 
-#if ENABLED(BABYSTEP_DISPLAY_TOTAL)
+#if ANY(BABYSTEP_DISPLAY_TOTAL, BABYSTEP_PLANNER)
   #include "../feature/babystep.h"
 #endif
 
@@ -727,6 +727,25 @@ void quickstop_stepper() {
     //planner.synchronize();
   }
 
+  #if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+
+    // Step the feedrate percentage up or down, or restore 100% for 0
+    void realtime_feedrate_override(const int8_t step) {
+      feedrate_percentage = step ? constrain(feedrate_percentage + step, 10, 999) : 100;
+    }
+
+    // Step the flow percentage of the active extruder, or restore 100% for 0
+    void realtime_flow_override(const int8_t step) {
+      #if HAS_EXTRUDERS
+        const int16_t flow = planner.flow_percentage[active_extruder];
+        planner.set_flow(active_extruder, step ? constrain(flow + step, 10, 999) : 100);
+      #else
+        UNUSED(step);
+      #endif
+    }
+
+  #endif
+
 #endif
 
 /**
@@ -1628,20 +1647,87 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     SERIAL_EOL();
     //*/
 
-    // Get the current position as starting point
-    xyze_pos_t raw = current_position;
+    #if ENABLED(DELTA_IK_INTERPOLATION)
+
+      // The modifiers and kinematics of a point 'k' segments along the move
+      const xyze_pos_t start = current_position;
+      auto joints_at = [&](const float k) {
+        xyze_pos_t machine = start + segment_distance * k;
+        TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+        inverse_kinematics(machine);
+        return abc_pos_t(delta);
+      };
+
+      // The E added by the modifiers is the same for the whole move
+      float e_offset = 0;
+      #if ALL(HAS_EXTRUDERS, HAS_POSITION_MODIFIERS)
+        xyze_pos_t e_mod = start;
+        planner.apply_modifiers(e_mod);
+        e_offset = e_mod.e - start.e;
+      #endif
 
-    // Calculate and execute the segments
-    millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
+      // Fit a quadratic through the joints at the start, middle, and end of a span
+      // of segments, accepted if it matches the joints at a quarter of the span.
+      TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+      millis_t next_idle_ms = millis() + 200UL;
+      abc_pos_t j0 = joints_at(0);
+      for (uint16_t k0 = 0; k0 < segments;) {
+        uint16_t n = _MIN(uint16_t(DELTA_IK_KNOT_SEGMENTS), segments - k0);
+        abc_pos_t b, c, j2;
+        for (;;) {
+          j2 = joints_at(k0 + n);
+          b.reset(); c.reset();
+          if (n == 1) break;
+          const abc_pos_t jm = joints_at(k0 + n * 0.5f);
+          b = jm * 4 - j0 * 3 - j2;
+          c = (j0 + j2) * 2 - jm * 4;
+          const abc_pos_t err = j0 + b * 0.25f + c * 0.0625f - joints_at(k0 + n * 0.25f);
+          if (ABS(err.a) <= DELTA_IK_MAX_ERROR && ABS(err.b) <= DELTA_IK_MAX_ERROR && ABS(err.c) <= DELTA_IK_MAX_ERROR) break;
+          n >>= 1;
+        }
 
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+        const float inv_n = 1.0f / n;
+        for (uint16_t i = 1; i <= n; ++i) {
+          segment_idle(next_idle_ms);
+          const uint16_t k = k0 + i;
+          const xyze_pos_t raw = k == segments ? destination : start + segment_distance * k;
+          if (i == n)
+            delta.set(j2.a, j2.b, j2.c);
+          else {
+            const float t = i * inv_n;
+            const abc_pos_t j = j0 + (b + c * t) * t;
+            delta.set(j.a, j.b, j.c);
+          }
+          if (!planner.buffer_line_joints(raw, e_offset, scaled_fr_mm_s, active_extruder, hints) && k < segments) {
+            // Ensure the move arrives at the target, as below
+            planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+            return false;
+          }
+        }
+
+        j0 = j2;
+        k0 += n;
+      }
+
+    #else
+
+      // Get the current position as starting point
+      xyze_pos_t raw = current_position;
+
+      // Calculate and execute the segments
+      TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+      millis_t next_idle_ms = millis() + 200UL;
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+      // Ensure last segment arrives at target location.
+      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+
+    #endif // !DELTA_IK_INTERPOLATION
 
     return false; // caller will update current_position
   }
@@ -1701,6 +1787,7 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
       xyze_pos_t raw = current_position;
 
       // Calculate and execute the segments
+      TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
       millis_t next_idle_ms = millis() + 200UL;
       while (--segments) {
         segment_idle(next_idle_ms);
@@ -1744,6 +1831,7 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
            * Otherwise fall through to do a direct single move.
            */
           if (xy_pos_t(current_position) != xy_pos_t(destination)) {
+            TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
             #if ENABLED(MESH_BED_LEVELING)
               bedlevel.line_to_destination(scaled_fr_mm_s);
             #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
@@ -1887,6 +1975,131 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
 
 #endif // DUAL_X_CARRIAGE
 
+#if HAS_ADAPTIVE_CURVE_SEGMENTS
+
+  /**
+   * Segment length for a curve with the given local radius, shared by G2/G3 and G5.
+   * The longest chord that stays within the tolerance of the curve: 2 * sqrt(2 * r * tol - tol^2),
+   * no shorter than ARC_SEGMENTS_PER_SEC allows at the feedrate, within MIN/MAX_ARC_SEGMENT_MM.
+   */
+  float curve_segment_mm(const float radius, const feedRate_t scaled_fr_mm_s) {
+    #ifdef ARC_CHORD_TOLERANCE
+      constexpr float arc_tol = ARC_CHORD_TOLERANCE;
+    #else
+      const float arc_tol = planner.junction_deviation_mm;
+    #endif
+    float chord_mm = radius > arc_tol ? 2 * SQRT(arc_tol * (2 * radius - arc_tol)) : float(MAX_ARC_SEGMENT_MM);
+    #if ARC_SEGMENTS_PER_SEC
+      NOLESS(chord_mm, scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC)); // Limit the segments per second
+    #else
+      UNUSED(scaled_fr_mm_s);
+    #endif
+    return constrain(chord_mm, MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM);
+  }
+
+#endif
+
+/**
+ * Buffer the move from current_position to destination with the
+ * method suited to the machine and leveling system.
+ *
+ * Return true if 'current_position' was set to 'destination'
+ */
+inline bool buffer_line_to_destination() {
+  return (
+    #if UBL_SEGMENTED
+      #if IS_KINEMATIC // UBL using Kinematic / Cartesian cases as a workaround for now.
+        bedlevel.line_to_destination_segmented(MMS_SCALED(feedrate_mm_s))
+      #else
+        line_to_destination_cartesian()
+      #endif
+    #elif IS_KINEMATIC
+      line_to_destination_kinematic()
+    #else
+      line_to_destination_cartesian()
+    #endif
+  );
+}
+
+#if ENABLED(SEGMENT_MERGE)
+
+  /**
+   * Collinear segment merging
+   *
+   * A short move is held back so that following short moves on the same line,
+   * at the same feedrate and with an even extrusion ratio, can be added to it.
+   * Each point must lie within SEGMENT_MERGE_DEVIATION of the line of the first
+   * segment, so all points are within twice that of the combined move.
+   *
+   * The held move is buffered before any other command or planner change,
+   * and when the command queue runs dry.
+   */
+  static struct {
+    bool pending;               // A merged move is waiting to be buffered
+    xyze_pos_t start, end;      // Start and end of the merged move
+    xyz_float_t dir;            // Unit direction of the first segment
+    float e_per_mm,             // Extrusion ratio of the first segment
+          along;                // Length of the merged move along 'dir'
+    feedRate_t fr_mm_s;         // Unscaled feedrate of the merged move
+  } merge;
+
+  void flush_segment_merge() {
+    if (!merge.pending) return;
+    merge.pending = false;
+
+    // Buffer the held move from where it started, leaving the current state as it was
+    const xyze_pos_t cpos = current_position, dest = destination;
+    const feedRate_t old_fr_mm_s = feedrate_mm_s;
+    current_position = merge.start;
+    destination = merge.end;
+    feedrate_mm_s = merge.fr_mm_s;
+    buffer_line_to_destination();
+    current_position = cpos;
+    destination = dest;
+    feedrate_mm_s = old_fr_mm_s;
+  }
+
+  void discard_segment_merge() { merge.pending = false; }
+
+  /**
+   * Add the move to the held move, or hold it for the next ones.
+   * Return false if the move should be buffered as usual.
+   */
+  static bool merge_line_to_destination() {
+    const xyz_float_t seg = xyz_pos_t(destination) - xyz_pos_t(current_position);
+    const float len = seg.magnitude();
+    const bool is_short = WITHIN(len, 0.0001f, SEGMENT_MERGE_MAX_LENGTH);
+
+    if (merge.pending) {
+      if (is_short && feedrate_mm_s == merge.fr_mm_s && current_position == merge.end) {
+        const xyz_float_t v = xyz_pos_t(destination) - xyz_pos_t(merge.start);
+        const float along = v.x * merge.dir.x + v.y * merge.dir.y + v.z * merge.dir.z;
+        if (along > merge.along
+          && v.x * v.x + v.y * v.y + v.z * v.z - sq(along) <= sq(SEGMENT_MERGE_DEVIATION)
+          && ABS(destination.e - merge.start.e - merge.e_per_mm * along) <= (SEGMENT_MERGE_E_DEVIATION)
+        ) {
+          merge.end = destination;
+          merge.along = along;
+          return true;
+        }
+      }
+      flush_segment_merge();
+    }
+
+    if (!is_short) return false;
+
+    merge.pending = true;
+    merge.start = current_position;
+    merge.end = destination;
+    merge.dir = seg / len;
+    merge.e_per_mm = (destination.e - current_position.e) / len;
+    merge.along = len;
+    merge.fr_mm_s = feedrate_mm_s;
+    return true;
+  }
+
+#endif // SEGMENT_MERGE
+
 /**
  * Prepare a single move and get ready for the next one
  *
@@ -1937,19 +2150,12 @@ void prepare_line_to_destination() {
 
   if (TERN0(DUAL_X_CARRIAGE, dual_x_carriage_unpark())) return;
 
-  if (
-    #if UBL_SEGMENTED
-      #if IS_KINEMATIC // UBL using Kinematic / Cartesian cases as a workaround for now.
-        bedlevel.line_to_destination_segmented(MMS_SCALED(feedrate_mm_s))
-      #else
-        line_to_destination_cartesian()
-      #endif
-    #elif IS_KINEMATIC
-      line_to_destination_kinematic()
-    #else
-      line_to_destination_cartesian()
-    #endif
-  ) return;
+  if (TERN0(SEGMENT_MERGE, merge_line_to_destination())) {
+    current_position = destination;
+    return;
+  }
+
+  if (buffer_line_to_destination()) return;
 
   current_position = destination;
 }
@@ -2541,8 +2747,17 @@ void prepare_line_to_destination() {
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Home Fast: ", move_length, "mm");
     do_homing_move(axis, move_length, 0.0, !use_probe_bump);
 
+    #if ENABLED(SINGLE_PASS_HOMING)
+      // Distance the axis moved past the captured endstop edge before it stopped
+      const float overshoot = planner.get_axis_position_mm(axis) - planner.triggered_position_mm(axis);
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Single-pass overshoot: ", overshoot, "mm");
+      const bool two_pass = bump && ENABLED(SINGLE_PASS_HOMING_VERIFY);
+    #else
+      const bool two_pass = bump;
+    #endif
+
     // If a second homing move is configured...
-    if (bump) {
+    if (two_pass) {
       #if ALL(HOMING_Z_WITH_PROBE, BLTOUCH)
         if (axis == Z_AXIS && !bltouch.high_speed_mode) bltouch.stow(); // Intermediate STOW (in LOW SPEED MODE)
       #endif
@@ -2586,6 +2801,13 @@ void prepare_line_to_destination() {
       const float rebump = bump * 2;
       if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Re-bump: ", rebump, "mm");
       do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
+
+      #if ENABLED(SINGLE_PASS_HOMING_VERIFY)
+        // Where the single pass puts the end of the re-bump, and its edge, relative to home
+        const float rel = overshoot - bump;
+        SERIAL_ECHOLNPGM("Single-pass ", C(AXIS_CHAR(axis)), " vs two-pass: ", rel + planner.get_axis_position_mm(axis),
+                         "mm (edges: ", rel + planner.triggered_position_mm(axis), "mm)");
+      #endif
     }
 
     #if ALL(HOMING_Z_WITH_PROBE, BLTOUCH)
@@ -2747,6 +2969,8 @@ void prepare_line_to_destination() {
     #else // CARTESIAN / CORE / MARKFORGED_XY / MARKFORGED_YX
 
       set_axis_is_at_home(axis);
+      // Home is at the edge, so after a single pass the axis is past it
+      TERN_(SINGLE_PASS_HOMING, if (!two_pass) current_position[axis] += overshoot);
       sync_plan_position();
 
       destination[axis] = current_position[axis];
@@ -2793,6 +3017,107 @@ void prepare_line_to_destination() {
 
   } // homeaxis()
 
+  #if ENABLED(HOME_XY_TOGETHER)
+
+    /**
+     * Move X and Y together by the given distances, each at its own feedrate.
+     * A hit on one endstop ends the whole block, so continue with the axis
+     * that hasn't hit until both are done. Used by homeaxes_xy() only.
+     */
+    static void do_homing_move_xy(const xy_float_t &distance, const xy_feedrate_t &fr_mm_s) {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("do_homing_move_xy(", distance.x, ", ", distance.y, ")");
+
+      const bool is_home_dir = (home_dir(X_AXIS) > 0) == (distance.x > 0);
+      xy_float_t left = distance;
+
+      while (left.x || left.y) {
+        abce_pos_t target = planner.get_axis_positions_mm();
+        target.x = target.y = 0;                  // Set the homing axes to 0
+        planner.set_machine_position_mm(target);
+
+        // Feedrate so each axis moves at its own homing speed
+        const float t = _MAX(ABS(left.x) / fr_mm_s.x, ABS(left.y) / fr_mm_s.y);
+        target.x = left.x; target.y = left.y;
+        #if HAS_DIST_MM_ARG
+          const xyze_float_t cart_dist_mm{0};
+        #endif
+        planner.buffer_segment(target OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), HYPOT(left.x, left.y) / t, active_extruder);
+        planner.synchronize();
+
+        if (!is_home_dir) break;                  // No endstops away from home
+
+        // Fail like a single homing move if neither endstop triggered
+        const Endstops::endstop_mask_t hit = endstops.trigger_state();
+        if (!hit) { endstops.validate_homing_move(); return; }
+        endstops.hit_on_purpose();
+
+        // A stopped axis is done, the other carries on from where it stopped
+        if (TEST(hit, X_ENDSTOP)) left.x = 0; else left.x -= planner.get_axis_position_mm(X_AXIS);
+        if (TEST(hit, Y_ENDSTOP)) left.y = 0; else left.y -= planner.get_axis_position_mm(Y_AXIS);
+      }
+    }
+
+    /**
+     * Home X and Y at the same time with the same fast move, move away and
+     * bump as homeaxis() does for each axis. Cartesian machines only.
+     */
+    void homeaxes_xy() {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM(">>> homeaxes_xy()");
+
+      #if HAS_HOMING_CURRENT
+        set_homing_current(X_AXIS);
+        set_homing_current(Y_AXIS);
+      #endif
+
+      const xy_int8_t axis_home_dir = { home_dir(X_AXIS), home_dir(Y_AXIS) };
+      const xy_float_t bump = { axis_home_dir.x * home_bump_mm(X_AXIS), axis_home_dir.y * home_bump_mm(Y_AXIS) };
+
+      // Fast move towards the endstops until both trigger
+      do_homing_move_xy(
+        { 1.5f * max_length(X_AXIS) * axis_home_dir.x, 1.5f * max_length(Y_AXIS) * axis_home_dir.y },
+        { homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS) }
+      );
+
+      // Move away together, then bump slowly. Both axes bump or neither does.
+      if (bump.x && bump.y) {
+        do_homing_move_xy(-bump, { homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS) });
+
+        #if ENABLED(DETECT_BROKEN_ENDSTOP)
+          if (TEST(endstops.state(), X_ENDSTOP) || TEST(endstops.state(), Y_ENDSTOP)) {
+            SERIAL_ECHO_MSG("Bad ", C(TEST(endstops.state(), X_ENDSTOP) ? 'X' : 'Y'), " Endstop?");
+            kill(GET_TEXT_F(MSG_KILL_HOMING_FAILED));
+          }
+        #endif
+
+        do_homing_move_xy(bump * 2, { get_homing_bump_feedrate(X_AXIS), get_homing_bump_feedrate(Y_AXIS) });
+      }
+
+      set_axis_is_at_home(X_AXIS);
+      set_axis_is_at_home(Y_AXIS);
+      sync_plan_position();
+      destination.set(current_position.x, current_position.y);
+
+      if (DEBUGGING(LEVELING)) DEBUG_POS("> AFTER set_axis_is_at_home", current_position);
+
+      #ifdef HOMING_BACKOFF_POST_MM
+        const xyz_float_t endstop_backoff = HOMING_BACKOFF_POST_MM;
+        if (endstop_backoff.x || endstop_backoff.y) {
+          current_position.x -= ABS(endstop_backoff.x) * axis_home_dir.x;
+          current_position.y -= ABS(endstop_backoff.y) * axis_home_dir.y;
+          line_to_current_position(_MIN(homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS)));
+        }
+      #endif
+
+      #if HAS_HOMING_CURRENT
+        restore_homing_current(X_AXIS);
+        restore_homing_current(Y_AXIS);
+      #endif
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< homeaxes_xy()");
+    }
+
+  #endif // HOME_XY_TOGETHER
+
 #endif // HAS_ENDSTOPS
 
 /**
@@ -2857,6 +3182,9 @@ void set_axis_is_at_home(const AxisEnum axis) {
 
   TERN_(BABYSTEP_DISPLAY_TOTAL, babystep.reset_total(axis));
 
+  // Z homing drops the physical offset, as it would drop stepped babysteps
+  TERN_(BABYSTEP_PLANNER, if (axis == Z_AXIS) babystep.reset_z_offset());
+
   TERN_(HAS_WORKSPACE_OFFSET, workspace_offset[axis] = 0);
 
   if (DEBUGGING(LEVELING)) {
@@ -315,6 +315,10 @@ void report_current_position_projected();
 
   void quickpause_stepper();
   void quickresume_stepper();
+  #if ENABLED(REALTIME_OVERRIDE_COMMANDS)
+    void realtime_feedrate_override(const int8_t step);
+    void realtime_flow_override(const int8_t step);
+  #endif
 #endif // REALTIME_REPORTING_COMMANDS
 
 float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool &is_cartesian_move));
@@ -346,6 +350,15 @@ void line_to_current_position(const feedRate_t fr_mm_s=feedrate_mm_s);
 
 void prepare_line_to_destination();
 
+#if HAS_ADAPTIVE_CURVE_SEGMENTS
+  float curve_segment_mm(const float radius, const feedRate_t scaled_fr_mm_s);
+#endif
+
+#if ENABLED(SEGMENT_MERGE)
+  void flush_segment_merge();
+  void discard_segment_merge();
+#endif
+
 void _internal_move_to_destination(const feedRate_t fr_mm_s=0.0f OPTARG(IS_KINEMATIC, const bool is_fast=false));
 
 inline void prepare_internal_move_to_destination(const feedRate_t fr_mm_s=0.0f) {
@@ -459,6 +472,9 @@ void set_axis_is_at_home(const AxisEnum axis);
    */
   extern main_axes_bits_t axes_homed, axes_trusted;
   void homeaxis(const AxisEnum axis);
+  #if ENABLED(HOME_XY_TOGETHER)
+    void homeaxes_xy();
+  #endif
   void set_axis_never_homed(const AxisEnum axis);
   main_axes_bits_t axes_should_home(main_axes_bits_t axes_mask=main_axes_mask);
   bool homing_needed_error(main_axes_bits_t axes_mask=main_axes_mask);
@@ -77,6 +77,10 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(BUFFER_ARENA)
+  #include "../gcode/queue.h"
+#endif
+
 #if HAS_LEVELING
   #include "../feature/bedlevel/bedlevel.h"
 #endif
@@ -101,6 +105,10 @@
   #include "../feature/backlash.h"
 #endif
 
+#if ENABLED(BABYSTEP_PLANNER)
+  #include "../feature/babystep.h"
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "../feature/cancel_object.h"
 #endif
@@ -113,6 +121,26 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT_TRAPEZOID)
+  #include "planner_fixed.h"
+#endif
+
+#if ENABLED(PLANNER_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
+#if ENABLED(LAYER_TIME_FAN)
+  #include "../feature/layer_fan.h"
+#endif
+
+#if ENABLED(POWER_BUDGET)
+  #include "../feature/power_monitor.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -125,13 +153,35 @@ Planner planner;
 /**
  * A ring buffer of moves described in steps
  */
-block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
+block_t Planner::block_buffer[BLOCK_ARENA_SIZE];
+#ifdef PLANNER_BLOCK_MAX_BYTES
+  static_assert(sizeof(block_t) <= (PLANNER_BLOCK_MAX_BYTES), "block_t has grown past PLANNER_BLOCK_MAX_BYTES.");
+#endif
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_tail;    // Index of the busy block, if any
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
+#if ENABLED(BUFFER_ARENA)
+  uint8_t block_buffer_size = BLOCK_BUFFER_SIZE;
+  uint8_t Planner::arena_blocks = BLOCK_BUFFER_SIZE;
+#endif
+
+#if ENABLED(PLANNER_INCREMENTAL_LOOKAHEAD)
+  uint8_t Planner::block_buffer_planned;        // Index of the last block the reverse pass left unchanged
+#endif
+
+#if ENABLED(PLANNER_SEGMENT_BATCH)
+  uint8_t Planner::segment_batch,               // Depth of nested segment batches
+          Planner::batch_pending;               // Blocks buffered since the last recalculate()
+  float Planner::batch_exit_speed_sqr;          // Safe exit speed of the newest pending block
+#endif
+
+#if ENABLED(PLANNER_LOOKAHEAD_STATS)
+  Planner::lookahead_stats_t Planner::lookahead_stats;
+#endif
+
 #if ENABLED(EDITABLE_STEPS_PER_UNIT)
   float Planner::mm_per_step[DISTINCT_AXES];    // (mm) Millimeters per step
 #else
@@ -156,6 +206,10 @@ uint32_t Planner::max_acceleration_steps_per_s2[DISTINCT_AXES]; // (steps/s^2) D
   #if HAS_LINEAR_E_JERK
     float Planner::max_e_jerk[DISTINCT_E];      // Calculated from junction_deviation_mm
   #endif
+  #if ENABLED(JD_JUNCTION_CACHE)
+    Planner::junction_cache_t Planner::junction_cache[JD_JUNCTION_CACHE_SIZE];
+    uint8_t Planner::junction_cache_next;
+  #endif
 #else // CLASSIC_JERK
   xyze_pos_t Planner::max_jerk;
 #endif
@@ -201,7 +255,8 @@ uint32_t Planner::max_acceleration_steps_per_s2[DISTINCT_AXES]; // (steps/s^2) D
   #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
     float Planner::z_fade_height,      // Initialized by settings.load
           Planner::inverse_z_fade_height,
-          Planner::last_fade_z;
+          Planner::last_fade_z,
+          Planner::z_fade_factor = 1;
   #endif
 #else
   constexpr bool Planner::leveling_active;
@@ -253,14 +308,37 @@ float Planner::previous_nominal_speed;
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(PLANNER_TIME_ESTIMATE)
+  volatile uint64_t Planner::executed_time_us = 0;
+#endif
+
 /**
  * Class and Instance Methods
  */
 
 Planner::Planner() { init(); }
 
+#if ENABLED(BUFFER_ARENA)
+
+  static_assert(sizeof(Planner::block_buffer) <= UINT16_MAX, "BLOCK_BUFFER_SIZE and COMMAND_POOL_SIZE are too large for BUFFER_ARENA.");
+
+  /**
+   * Take the saved number of blocks and give the rest of the block buffer
+   * to the command pool. Only at boot, before any block or command is queued.
+   * Until then the command queue has no pool and reports full.
+   */
+  void Planner::apply_arena() {
+    block_buffer_size = constrain(arena_blocks, BUFFER_ARENA_MIN_BLOCKS, BLOCK_BUFFER_SIZE);
+    clear_block_buffer();
+    queue.ring_buffer.pool = (char*)&block_buffer[block_buffer_size];
+    queue.ring_buffer.pool_size = sizeof(block_buffer) - block_buffer_size * sizeof(block_t);
+  }
+
+#endif
+
 void Planner::init() {
   position.reset();
+  TERN_(JD_JUNCTION_CACHE, junction_cache_reset());
   TERN_(HAS_POSITION_FLOAT, position_float.reset());
   TERN_(IS_KINEMATIC, position_cart.reset());
 
@@ -765,6 +843,9 @@ block_t* Planner::get_current_block() {
     // We can't be sure how long an active block will take, so don't count it.
     TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
 
+    // Count the busy block as executed for the remaining time estimate
+    TERN_(PLANNER_TIME_ESTIMATE, executed_time_us += block->move_time_us);
+
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
 
@@ -809,7 +890,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
   NOLESS(final_rate,          stepper.minimal_step_rate);
   NOLESS(block->nominal_rate, stepper.minimal_step_rate);
 
-  #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+  #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, PLANNER_TIME_ESTIMATE)
     // If we have some plateau time, the cruise rate will be the nominal rate
     uint32_t cruise_rate = block->nominal_rate;
   #endif
@@ -819,45 +900,93 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
           accelerate_steps = 0,
           decelerate_steps = 0;
 
-  const int32_t accel = block->acceleration_steps_per_s2;
-  float inverse_accel = 0.0f;
-  if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
-                accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
-    // Aims to fully reach nominal and final rates
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = CEIL(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
-      #endif
+  const int32_t accel = block->get_acceleration_steps_per_s2();
+
+  #if ENABLED(PLANNER_FIXED_POINT_TRAPEZOID)
+
+    // Same as below using only integer math. See planner_fixed.h.
+    PlannerFixed::recip_t inverse_accel = { 0, 32 };
+    if (accel != 0) {
+      inverse_accel = PlannerFixed::reciprocal(accel);
+      const int64_t decelerate_steps_q8 = PlannerFixed::accel_distance_q8(block->nominal_rate, final_rate, inverse_accel),
+                    accelerate_steps_q8 = PlannerFixed::accel_distance_q8(block->nominal_rate, initial_rate, inverse_accel);
+      accelerate_steps = PlannerFixed::ceil_steps(accelerate_steps_q8);
+      decelerate_steps = PlannerFixed::ceil_steps(decelerate_steps_q8);
+
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      if (plateau_steps < 0) {
+        accelerate_steps = PlannerFixed::round_steps(((int64_t(block->step_event_count) << PlannerFixed::STEP_FRAC) + accelerate_steps_q8 - decelerate_steps_q8) / 2);
+        LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, PLANNER_TIME_ESTIMATE)
+          NOMORE(cruise_rate, PlannerFixed::final_rate(initial_rate, accel, accelerate_steps));
+        #endif
+      }
     }
-  }
 
-  #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
-    const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
-             deceleration_time = rate_factor * float(cruise_rate - final_rate);
+    #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
+      uint32_t acceleration_time = PlannerFixed::accel_ticks(cruise_rate - initial_rate, STEPPER_TIMER_RATE, inverse_accel),
+               deceleration_time = PlannerFixed::accel_ticks(cruise_rate - final_rate, STEPPER_TIMER_RATE, inverse_accel);
+    #endif
+
+  #else // !PLANNER_FIXED_POINT_TRAPEZOID
+
+    float inverse_accel = 0.0f;
+    if (accel != 0) {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
+                  accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
+      // Aims to fully reach nominal and final rates
+      accelerate_steps = CEIL(accelerate_steps_float);
+      decelerate_steps = CEIL(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, PLANNER_TIME_ESTIMATE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
+        #endif
+      }
+    }
+
+    #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
+      const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
+               deceleration_time = rate_factor * float(cruise_rate - final_rate);
+    #endif
+
+  #endif // !PLANNER_FIXED_POINT_TRAPEZOID
+
+  #if ENABLED(PLANNER_TIME_ESTIMATE)
+    // Time of each phase at its average rate. Exact for both linear and S-Curve ramps.
+    const uint32_t plateau = _MAX(plateau_steps, 0),
+                   move_time_us = TERN(PLANNER_FIXED_POINT_TRAPEZOID,
+                     uint32_t( uint64_t(accelerate_steps) * 2000000UL / (initial_rate + cruise_rate)
+                             + uint64_t(plateau) * 1000000UL / cruise_rate
+                             + uint64_t(decelerate_steps) * 2000000UL / (cruise_rate + final_rate) ),
+                     LROUND(1000000.0f * ( 2.0f * accelerate_steps / float(initial_rate + cruise_rate)
+                                         + float(plateau) / float(cruise_rate)
+                                         + 2.0f * decelerate_steps / float(cruise_rate + final_rate) ))
+                   );
   #endif
-  #if ENABLED(S_CURVE_ACCELERATION)
+
+  #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(COMPACT_PLANNER_BLOCKS)
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
     uint32_t acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
@@ -868,18 +997,22 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
   block->decelerate_start = block->step_event_count - decelerate_steps;
   block->initial_rate = initial_rate;
   block->final_rate = final_rate;
+  TERN_(PLANNER_TIME_ESTIMATE, block->move_time_us = move_time_us);
 
   #if ANY(S_CURVE_ACCELERATION, SMOOTH_LIN_ADVANCE)
     block->acceleration_time = acceleration_time;
     block->deceleration_time = deceleration_time;
     block->cruise_rate = cruise_rate;
   #endif
-  #if ENABLED(S_CURVE_ACCELERATION)
+  #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(COMPACT_PLANNER_BLOCKS)
     block->acceleration_time_inverse = acceleration_time_inverse;
     block->deceleration_time_inverse = deceleration_time_inverse;
   #endif
   #if ENABLED(SMOOTH_LIN_ADVANCE)
-    block->cruise_time = plateau_steps > 0 ? float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate) : 0;
+    block->cruise_time = plateau_steps > 0 ? TERN(PLANNER_FIXED_POINT_TRAPEZOID,
+      uint32_t(uint64_t(plateau_steps) * (STEPPER_TIMER_RATE) / cruise_rate),
+      float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate)
+    ) : 0;
   #endif
 
   #if HAS_ROUGH_LIN_ADVANCE
@@ -921,6 +1054,10 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
         float laser_pwr = block->laser.power * (final_rate / float(block->nominal_rate));
         NOLESS(laser_pwr, laser_power_floor);
         block->laser.trap_ramp_exit_decr = (block->laser.power - laser_pwr) / decelerate_steps;
+        #if ENABLED(LASER_POWER_TRAP_RATE)
+          block->laser.trap_rate_slope = (uint32_t(block->laser.power - laser_power_floor) << 16) / block->nominal_rate;
+          block->laser.trap_rate_floor = laser_power_floor;
+        #endif
         #if ENABLED(DEBUG_LASER_TRAP)
           SERIAL_ECHO_MSG("lp:", block->laser.power);
           SERIAL_ECHO_MSG("as:", accelerate_steps);
@@ -934,6 +1071,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
         block->laser.trap_ramp_active_pwr = 0;
         block->laser.trap_ramp_entry_incr = 0;
         block->laser.trap_ramp_exit_decr = 0;
+        TERN_(LASER_POWER_TRAP_RATE, block->laser.trap_rate_slope = block->laser.trap_rate_floor = 0);
       }
     }
   #endif // LASER_POWER_TRAP
@@ -978,6 +1116,9 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
  *       so it's never updated again
  *    5. We use speed squared (ex: entry_speed_sqr in mm^2/s^2) in acceleration limit computations
  *    6. We don't recompute sqrt(entry_speed_sqr) if the block's entry speed didn't change
+ *    7. With PLANNER_INCREMENTAL_LOOKAHEAD the block that ended the reverse pass is remembered
+ *       (block_buffer_planned) and the forward pass starts from it instead of from the tail.
+ *       No block before it was modified, so there is nothing for the forward pass to do there.
  *
  *  Planner buffer index mapping:
  *  - block_buffer_tail: Points to the beginning of the planner buffer. First to be executed or being executed.
@@ -1053,6 +1194,9 @@ void Planner::reverse_pass(const float safe_exit_speed_sqr) {
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
   uint8_t nonbusy_block_index = block_buffer_nonbusy;
 
+  // Unless the pass ends early, the forward pass has to start from the tail
+  TERN_(PLANNER_INCREMENTAL_LOOKAHEAD, block_buffer_planned = block_buffer_tail);
+
   const block_t *next = nullptr;
   // Don't try to change the entry speed of the first non-busy block.
   while (block_index != nonbusy_block_index) {
@@ -1060,8 +1204,18 @@ void Planner::reverse_pass(const float safe_exit_speed_sqr) {
 
     // Only process movement blocks
     if (current->is_move()) {
+      TERN_(PLANNER_LOOKAHEAD_STATS, ++lookahead_stats.reverse_walked);
+
       // If no entry speed increase was possible we end the reverse pass.
-      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return;
+      // Blocks of a segment batch are all new, so the pass carries on through them.
+      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr) && !TERN0(PLANNER_SEGMENT_BATCH, batch_pending && current->flag.recalculate)) {
+        // Every block before this one is unchanged, so it is the last optimal junction.
+        // The newest block is still waiting for its first trapezoid, so it can't be used.
+        #if ENABLED(PLANNER_INCREMENTAL_LOOKAHEAD)
+          if (!current->flag.recalculate) block_buffer_planned = block_index;
+        #endif
+        return;
+      }
       next = current;
     }
 
@@ -1112,10 +1266,19 @@ void Planner::recalculate_trapezoids(const float safe_exit_speed_sqr) {
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
 
+  #if ENABLED(PLANNER_INCREMENTAL_LOOKAHEAD)
+    // Skip ahead to the last optimal junction, unless the ISR has already consumed it
+    const uint8_t planned_index = block_buffer_planned;
+    if (block_dec_mod(planned_index, block_index) < block_dec_mod(head_block_index, block_index))
+      block_index = planned_index;
+  #endif
+
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
   while (block_index != head_block_index) {
 
+    TERN_(PLANNER_LOOKAHEAD_STATS, ++lookahead_stats.forward_walked);
+
     next = &block_buffer[block_index];
 
     if (next->is_move()) {
@@ -1183,11 +1346,132 @@ void Planner::recalculate_trapezoids(const float safe_exit_speed_sqr) {
 
 // Requires there's at least one block with flag.recalculate in the buffer
 void Planner::recalculate(const float safe_exit_speed_sqr) {
+  TERN_(PLANNER_LOOKAHEAD_STATS, ++lookahead_stats.recalcs);
+  TERN_(PLANNER_MONITOR, const uint32_t start_us = micros());
   reverse_pass(safe_exit_speed_sqr);
   // The forward pass is done as part of recalculate_trapezoids()
   recalculate_trapezoids(safe_exit_speed_sqr);
+  TERN_(PLANNER_SEGMENT_BATCH, batch_pending = 0);
+  TERN_(PLANNER_MONITOR, planner_monitor.recalc_done(micros() - start_us));
 }
 
+#if ENABLED(PLANNER_SEGMENT_BATCH)
+
+  /**
+   * Leave the new block unplanned for now if it's part of a segment batch.
+   * Unplanned blocks are held back from the stepper, so the batch is planned
+   * once it's full, the buffer is full (the next block would wait with the
+   * stepper stuck behind the batch), or the stepper is down to its last block.
+   */
+  bool Planner::defer_recalculate(const float safe_exit_speed_sqr) {
+    if (!segment_batch) return false;
+    batch_exit_speed_sqr = safe_exit_speed_sqr;
+    return ++batch_pending < (PLANNER_SEGMENT_BATCH) && moves_free() && nonbusy_movesplanned() > batch_pending + 1;
+  }
+
+#endif
+
+#if ENABLED(FEEDRATE_OVERRIDE_REPLAN)
+
+  /**
+   * Scale the moves already in the buffer after a change to feedrate_percentage.
+   * Called from idle() so any source of the change (M220, LCD, host) is caught.
+   */
+  void Planner::apply_feedrate_override() {
+    static int16_t planned_percentage = 100;
+    if (feedrate_percentage == planned_percentage) return;
+    if (!cleaning_buffer_counter && has_blocks_queued() && !TERN0(FT_MOTION, ftMotion.cfg.active))
+      scale_planned_feedrate(float(feedrate_percentage) / planned_percentage);
+    planned_percentage = feedrate_percentage;
+  }
+
+  /**
+   * Scale the nominal speed of the queued moves and re-plan them.
+   *
+   * Every queued block is flagged for recalculation first so the Stepper ISR
+   * can't take one while its speeds are changing. The block being executed keeps
+   * its speed and the next block can't drop below its entry speed, which is the
+   * exit speed the running block already decelerates to.
+   *
+   * Junction speeds are only ever lowered, and faster moves are limited to the
+   * axis maximum feedrates. Other limits applied to new moves are not re-checked.
+   */
+  void Planner::scale_planned_feedrate(const float ratio) {
+    const uint8_t head = block_buffer_head;
+    block_t *last = nullptr;
+    float prev_nominal = 0, last_ratio = 1;
+
+    for (uint8_t b = block_buffer_nonbusy; b != head; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move()) continue;
+
+      // Hold the block for recalculate_trapezoids(), unless the stepper already took it
+      block->flag.recalculate = true;
+      if (stepper.is_block_busy(block)) {
+        block->flag.recalculate = false;
+        continue;
+      }
+
+      float speed = block->nominal_speed * ratio;
+      if (ratio > 1.0f) {
+        LOOP_LOGICAL_AXES(a) if (block->steps[a]) {
+          const uint8_t i = TERN(HAS_EXTRUDERS, a == E_AXIS ? uint8_t(E_AXIS_N(block->extruder)) : a, a);
+          NOMORE(speed, settings.max_feedrate_mm_s[i] * block->millimeters / (block->steps[a] * mm_per_step[i]));
+        }
+        NOLESS(speed, block->nominal_speed);
+      }
+
+      // The first block's entry is fixed by the block being executed
+      if (!last) NOLESS(speed, SQRT(block->min_entry_speed_sqr));
+
+      const float r = speed / block->nominal_speed;
+      block->nominal_speed = speed;
+      block->nominal_rate = uint32_t(block->nominal_rate * r);
+
+      if (last) {
+        // A slower block must also enter slower
+        NOMORE(block->max_entry_speed_sqr, _MIN(sq(speed), sq(prev_nominal)));
+        NOMORE(block->entry_speed_sqr, block->max_entry_speed_sqr);
+        NOMORE(block->min_entry_speed_sqr, block->entry_speed_sqr);
+      }
+
+      prev_nominal = speed;
+      last_ratio = r;
+      last = block;
+    }
+
+    if (!last) return;
+
+    // Junctions with the next new move use the scaled speeds
+    if (last == &block_buffer[prev_block_index(head)]) {
+      previous_nominal_speed = last->nominal_speed;
+      TERN_(CLASSIC_JERK, previous_speed *= last_ratio);
+    }
+
+    // As in _buffer_steps() the last block must be able to stop
+    recalculate(_MIN(0.5f * last->acceleration / last->steps_per_mm, sq(last->nominal_speed)));
+  }
+
+#endif
+
+#if ENABLED(PLANNER_LOOKAHEAD_STATS)
+
+  /**
+   * Report the average number of blocks visited by each look-ahead pass
+   * for every move added to the planner since the last reset.
+   */
+  void Planner::report_lookahead_stats() {
+    const lookahead_stats_t s = lookahead_stats;
+    const float per_block = s.recalcs ? 1.0f / s.recalcs : 0.0f;
+    SERIAL_ECHOLNPGM(
+      "Look-ahead blocks:", s.recalcs,
+      " reverse:", s.reverse_walked, " (", p_float_t(s.reverse_walked * per_block, 2), "/blk)"
+      " forward:", s.forward_walked, " (", p_float_t(s.forward_walked * per_block, 2), "/blk)"
+    );
+  }
+
+#endif
+
 /**
  * Apply fan speeds
  */
@@ -1571,24 +1855,30 @@ void Planner::check_axes_activity() {
 
 #endif // HAS_LEVELING
 
-#if ENABLED(FWRETRACT)
+#if HAS_PLANNER_OFFSETS
   /**
-   * rz, e - Cartesian positions in mm
+   * The Z offset of babysteps and retract hop and the E offset of retraction,
+   * added together so a move pays for one call.
    */
-  void Planner::apply_retract(float &rz, float &e) {
-    rz += fwretract.current_hop;
-    e -= fwretract.current_retract[active_extruder];
+  void Planner::apply_offsets(xyze_pos_t &raw) {
+    raw.z += TERN0(BABYSTEP_PLANNER, babystep.z_offset) + TERN0(FWRETRACT, fwretract.current_hop);
+    TERN_(FWRETRACT, raw.e -= fwretract.current_retract[active_extruder]);
   }
 
-  void Planner::unapply_retract(float &rz, float &e) {
-    rz -= fwretract.current_hop;
-    e += fwretract.current_retract[active_extruder];
+  void Planner::unapply_offsets(xyze_pos_t &raw) {
+    raw.z -= TERN0(BABYSTEP_PLANNER, babystep.z_offset) + TERN0(FWRETRACT, fwretract.current_hop);
+    TERN_(FWRETRACT, raw.e += fwretract.current_retract[active_extruder]);
   }
-
 #endif
 
 void Planner::quick_stop() {
 
+  // Drop a move held back for merging
+  TERN_(SEGMENT_MERGE, discard_segment_merge());
+
+  // Forget the blocks of a segment batch
+  TERN_(PLANNER_SEGMENT_BATCH, batch_pending = 0);
+
   /**
    * Remove all the queued blocks.
    * NOTE: This function is NOT called from the Stepper ISR,
@@ -1640,9 +1930,9 @@ void Planner::quick_stop() {
 
 #endif
 
-void Planner::endstop_triggered(const AxisEnum axis) {
+void Planner::endstop_triggered(const AxisEnum axis OPTARG(ENDSTOP_EDGE_CAPTURE, const xyze_long_t * const edge_pos/*=nullptr*/)) {
   // Record stepper position and discard the current block
-  stepper.endstop_triggered(axis);
+  stepper.endstop_triggered(axis OPTARG(ENDSTOP_EDGE_CAPTURE, edge_pos));
 }
 
 float Planner::triggered_position_mm(const AxisEnum axis) {
@@ -1719,7 +2009,11 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(SEGMENT_MERGE, flush_segment_merge());
+  TERN_(PLANNER_SEGMENT_BATCH, flush_segments());
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1782,7 +2076,11 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   );
 
   // Recalculate and optimize trapezoidal speed profiles
-  recalculate(safe_exit_speed_sqr);
+  if (!TERN0(PLANNER_SEGMENT_BATCH, defer_recalculate(safe_exit_speed_sqr)))
+    recalculate(safe_exit_speed_sqr);
+
+  TERN_(PLANNER_MONITOR, planner_monitor.block_planned());
+  TERN_(FLIGHT_RECORDER, flight_recorder.record(FR_BLOCK_PLANNED, movesplanned()));
 
   // Movement successfully queued!
   return true;
@@ -1939,6 +2237,8 @@ bool Planner::_populate_block(
   // Clear all flags, including the "busy" bit
   block->flag.clear();
 
+  TERN_(BACKLASH_STEPPER, block->backlash_steps.reset());
+
   // Set direction bits
   block->direction_bits = dm;
 
@@ -2198,7 +2498,7 @@ bool Planner::_populate_block(
         #define ENABLE_ONE_E(N) do{ \
           if (N == E_STEPPER_INDEX(extruder) || _IS_DUPE(N)) {  /* N is 'extruder', or N is duplicating */ \
             stepper.ENABLE_EXTRUDER(N);                         /* Enable the relevant E stepper... */ \
-            extruder_last_move[N] = (BLOCK_BUFFER_SIZE) * 2;    /* ...and reset its counter */ \
+            extruder_last_move[N] = block_buffer_size * 2;      /* ...and reset its counter */ \
           } \
           else if (!extruder_last_move[N])                      /* Counter expired since last E stepper enable */ \
             stepper.DISABLE_EXTRUDER(N);                        /* Disable the E stepper */ \
@@ -2251,7 +2551,7 @@ bool Planner::_populate_block(
     #ifndef SLOWDOWN_DIVISOR
       #define SLOWDOWN_DIVISOR 2
     #endif
-    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
+    if (WITHIN(moves_queued, 2, block_buffer_size / (SLOWDOWN_DIVISOR) - 1)) {
       #ifdef MAX7219_DEBUG_SLOWDOWN
         slowdown_count = (slowdown_count + 1) & 0x0F;
       #endif
@@ -2280,6 +2580,8 @@ bool Planner::_populate_block(
   block->nominal_speed = block->millimeters * inverse_secs;           // (mm/sec) Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
+  TERN_(LAYER_TIME_FAN, layer_fan.block_planned(1.0f / inverse_secs, block->fan_speed));
+
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     if (extruder == FILAMENT_SENSOR_EXTRUDER_NUM)   // Only for extruder with filament sensor
       filwidth.advance_e(dist_mm.e);
@@ -2332,6 +2634,13 @@ bool Planner::_populate_block(
         }
       }
     #endif
+
+    #if ENABLED(MPC_FLOW_LIMIT)
+      // Respect the melt capacity of a hotend that is out of heater headroom
+      const feedRate_t max_hfr = MUL_TERN(HAS_MIXER_SYNC_CHANNEL, thermalManager.temp_hotend[TERN0(HAS_MULTI_HOTEND, extruder)].flow_limit, MIXING_STEPPERS);
+      if (max_hfr > 0 && cs > max_hfr && (block->steps.a || block->steps.b || block->steps.c))
+        NOMORE(speed_factor, max_hfr / cs);
+    #endif
   }
   #endif // HAS_EXTRUDERS
 
@@ -2381,6 +2690,9 @@ bool Planner::_populate_block(
   #if ANY(LIN_ADVANCE, FTM_HAS_LIN_ADVANCE)
     bool use_adv_lead = false;
   #endif
+  #if ENABLED(LA_JUNCTION_LIMIT)
+    float e_ratio = 0;  // Filament per mm of path, with advance
+  #endif
   if (!ANY_AXIS_MOVES(block)) {                                   // Is this a retract / recover move?
     accel = CEIL(settings.retract_acceleration * steps_per_mm);   // Convert to: acceleration steps/sec^2
   }
@@ -2402,6 +2714,11 @@ bool Planner::_populate_block(
     // Start with print or travel acceleration
     accel = CEIL((esteps ? settings.acceleration : settings.travel_acceleration) * steps_per_mm);
 
+    #if ENABLED(POWER_BUDGET) && defined(POWER_BUDGET_MIN_VOLTS)
+      // Draw less current from a sagging supply
+      if (power_monitor.volts_low) accel = accel * (POWER_BUDGET_SAG_ACCEL) / 100;
+    #endif
+
     #if ANY(LIN_ADVANCE, FTM_HAS_LIN_ADVANCE)
       // Linear advance is currently not ready for HAS_I_AXIS
       #define MAX_E_JERK(N) TERN(HAS_LINEAR_E_JERK, max_e_jerk[E_INDEX_N(N)], max_jerk.e)
@@ -2432,6 +2749,7 @@ bool Planner::_populate_block(
           // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm
           //   and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
           use_adv_lead = e_D_ratio <= 3.0f;
+          TERN_(LA_JUNCTION_LIMIT, if (use_adv_lead) e_ratio = e_D_ratio);
           if (use_adv_lead && TERN0(HAS_ROUGH_LIN_ADVANCE, !ftm_active)) {
             // For Standard Motion LA: Scale E acceleration so it'll be possible to jump to the advance speed
             const uint32_t max_accel_steps_per_s2 = (MAX_E_JERK(extruder) / (advK * e_D_ratio)) * steps_per_mm;
@@ -2462,7 +2780,7 @@ bool Planner::_populate_block(
       );
     }
   }
-  block->acceleration_steps_per_s2 = accel;
+  IF_DISABLED(COMPACT_PLANNER_BLOCKS, block->acceleration_steps_per_s2 = accel);
   block->acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = uint32_t(accel * (float(_BV32(24)) / (STEPPER_TIMER_RATE)));
@@ -2473,7 +2791,7 @@ bool Planner::_populate_block(
     block->la_scaling = 0;
     if (use_adv_lead) {
       // The Bresenham algorithm will convert this step rate into extruder steps
-      block->la_advance_rate = extruder_advance_K[E_INDEX_N(extruder)] * block->acceleration_steps_per_s2;
+      block->la_advance_rate = extruder_advance_K[E_INDEX_N(extruder)] * accel;
 
       // Reduce LA ISR frequency by calling it only often enough to ensure that there will
       // never be more than four extruder steps per call
@@ -2545,6 +2863,7 @@ bool Planner::_populate_block(
 
     // Unit vector of previous path line segment
     static xyze_float_t prev_unit_vec;
+    TERN_(LA_JUNCTION_LIMIT, static float prev_e_ratio);
 
     xyze_float_t unit_vec =
       #if HAS_DIST_MM_ARG
@@ -2570,139 +2889,174 @@ bool Planner::_populate_block(
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
-      // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
-      // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-      float junction_cos_theta = LOGICAL_AXIS_GANG(
-                                 + (-prev_unit_vec.e * unit_vec.e),
-                                 + (-prev_unit_vec.x * unit_vec.x),
-                                 + (-prev_unit_vec.y * unit_vec.y),
-                                 + (-prev_unit_vec.z * unit_vec.z),
-                                 + (-prev_unit_vec.i * unit_vec.i),
-                                 + (-prev_unit_vec.j * unit_vec.j),
-                                 + (-prev_unit_vec.k * unit_vec.k),
-                                 + (-prev_unit_vec.u * unit_vec.u),
-                                 + (-prev_unit_vec.v * unit_vec.v),
-                                 + (-prev_unit_vec.w * unit_vec.w)
-                               );
-
-      // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-      if (junction_cos_theta > 0.999999f) {
-        // For a 0 degree acute junction, just set minimum junction speed.
-        vmax_junction_sqr = minimum_planner_speed_sqr;
+      if (TERN0(HINTS_JUNCTION_SPEED, hints.junction_speed_sqr)) {
+        // Junctions inside an arc all have the same speed, already known
+        TERN_(HINTS_JUNCTION_SPEED, vmax_junction_sqr = hints.junction_speed_sqr);
       }
       else {
-        // Convert delta vector to unit vector
-        xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
-        normalize_junction_vector(junction_unit_vec);
-
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
-
-        if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
-          TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
+        // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
+        // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
+        float junction_cos_theta = LOGICAL_AXIS_GANG(
+                                   + (-prev_unit_vec.e * unit_vec.e),
+                                   + (-prev_unit_vec.x * unit_vec.x),
+                                   + (-prev_unit_vec.y * unit_vec.y),
+                                   + (-prev_unit_vec.z * unit_vec.z),
+                                   + (-prev_unit_vec.i * unit_vec.i),
+                                   + (-prev_unit_vec.j * unit_vec.j),
+                                   + (-prev_unit_vec.k * unit_vec.k),
+                                   + (-prev_unit_vec.u * unit_vec.u),
+                                   + (-prev_unit_vec.v * unit_vec.v),
+                                   + (-prev_unit_vec.w * unit_vec.w)
+                                 );
+
+        // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
+        if (junction_cos_theta > 0.999999f) {
+          // For a 0 degree acute junction, just set minimum junction speed.
+          vmax_junction_sqr = minimum_planner_speed_sqr;
         }
         else {
-          NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
-
-          const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
-
-          vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
-
-          #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
-
-            // For small moves with >135° junction (octagon) find speed for approximate arc
-            if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
-
-              #if ENABLED(JD_USE_MATH_ACOS)
-
-                #error "TODO: Inline maths with the MCU / FPU."
-
-              #elif ENABLED(JD_USE_LOOKUP_TABLE)
-
-                // Fast acos approximation (max. error +-0.01 rads)
-                // Based on LUT table and linear interpolation
-
-                /**
-                 *  // Generate the JD Lookup Table
-                 *  constexpr float c = 1.00751495f; // Correction factor to center error around 0
-                 *  for (int i = 0; i < jd_lut_count - 1; ++i) {
-                 *    const float x0 = (sq(i) - 1) / sq(i),
-                 *                y0 = acos(x0) * (i == 0 ? 1 : c),
-                 *                x1 = i < jd_lut_count - 1 ?  0.5 * x0 + 0.5 : 0.999999f,
-                 *                y1 = acos(x1) * (i < jd_lut_count - 1 ? c : 1);
-                 *    jd_lut_k[i] = (y0 - y1) / (x0 - x1);
-                 *    jd_lut_b[i] = (y1 * x0 - y0 * x1) / (x0 - x1);
-                 *  }
-                 *
-                 *  // Compute correction factor (Set c to 1.0f first!)
-                 *  float min = INFINITY, max = -min;
-                 *  for (float t = 0; t <= 1; t += 0.0003f) {
-                 *    const float e = acos(t) / approx(t);
-                 *    if (isfinite(e)) {
-                 *      if (e < min) min = e;
-                 *      if (e > max) max = e;
-                 *    }
-                 *  }
-                 *  fprintf(stderr, "%.9gf, ", (min + max) / 2);
-                 */
-                static constexpr int16_t  jd_lut_count = 16;
-                static constexpr uint16_t jd_lut_tll   = _BV(jd_lut_count - 1);
-                static constexpr int16_t  jd_lut_tll0  = __builtin_clz(jd_lut_tll) + 1; // i.e., 16 - jd_lut_count + 1
-                static constexpr float jd_lut_k[jd_lut_count] PROGMEM = {
-                  -1.03145837f, -1.30760646f, -1.75205851f, -2.41705704f,
-                  -3.37769222f, -4.74888992f, -6.69649887f, -9.45661736f,
-                  -13.3640480f, -18.8928222f, -26.7136841f, -37.7754593f,
-                  -53.4201813f, -75.5458374f, -106.836761f, -218.532821f };
-                static constexpr float jd_lut_b[jd_lut_count] PROGMEM = {
-                   1.57079637f,  1.70887053f,  2.04220939f,  2.62408352f,
-                   3.52467871f,  4.85302639f,  6.77020454f,  9.50875854f,
-                   13.4009285f,  18.9188995f,  26.7321243f,  37.7885055f,
-                   53.4293975f,  75.5523529f,  106.841369f,  218.534011f };
-
-                const float neg = junction_cos_theta < 0 ? -1 : 1,
-                            t = neg * junction_cos_theta;
-
-                const int16_t idx = (t < 0.00000003f) ? 0 : __builtin_clz(uint16_t((1.0f - t) * jd_lut_tll)) - jd_lut_tll0;
-
-                float junction_theta = t * pgm_read_float(&jd_lut_k[idx]) + pgm_read_float(&jd_lut_b[idx]);
-                if (neg > 0) junction_theta = RADIANS(180) - junction_theta; // acos(-t)
-
-              #else
-
-                // Fast acos(-t) approximation (max. error +-0.033rad = 1.89°)
-                // Based on MinMax polynomial published by W. Randolph Franklin, see
-                // https://wrf.ecse.rpi.edu/Research/Short_Notes/arcsin/onlyelem.html
-                //  acos( t) = pi / 2 - asin(x)
-                //  acos(-t) = pi - acos(t) ... pi / 2 + asin(x)
-
-                const float neg = junction_cos_theta < 0 ? -1 : 1,
-                            t = neg * junction_cos_theta,
-                            asinx =       0.032843707f
-                                  + t * (-1.451838349f
-                                  + t * ( 29.66153956f
-                                  + t * (-131.1123477f
-                                  + t * ( 262.8130562f
-                                  + t * (-242.7199627f
-                                  + t * ( 84.31466202f ) ))))),
-                            junction_theta = RADIANS(90) + neg * asinx; // acos(-t)
-
-                // NOTE: junction_theta bottoms out at 0.033 which avoids divide by 0.
-
-              #endif
-
-              const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
-              NOMORE(vmax_junction_sqr, limit_sqr);
+          // Convert delta vector to unit vector
+          xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+
+          #if ENABLED(JD_JUNCTION_CACHE)
+            // Repeated corners, like the turns of an infill zigzag, reuse the limits found before
+            const junction_cache_t *jc = junction_cache_find(junction_unit_vec, block->acceleration);
+            if (!jc) {
+              junction_cache_t &entry = junction_cache[junction_cache_next];
+              if (++junction_cache_next >= JD_JUNCTION_CACHE_SIZE) junction_cache_next = 0;
+              entry.delta = junction_unit_vec;
+              entry.acceleration = block->acceleration;
+              normalize_junction_vector(junction_unit_vec);
+              entry.junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+              const float sin_theta_d2 = SQRT(0.5f * (1.0f - _MAX(junction_cos_theta, -0.999999f)));
+              entry.jd_factor = sin_theta_d2 / (1.0f - sin_theta_d2);
+              jc = &entry;
             }
+            const float junction_acceleration = jc->junction_acceleration;
+          #else
+            normalize_junction_vector(junction_unit_vec);
+            const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+          #endif
 
-          #endif // JD_HANDLE_SMALL_SEGMENTS
+          if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
+            TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
+          }
+          else {
+            NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
+
+            #if ENABLED(JD_JUNCTION_CACHE)
+              vmax_junction_sqr = junction_acceleration * junction_deviation_mm * jc->jd_factor;
+            #else
+              const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
+
+              vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+            #endif
+
+            #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+
+              // For small moves with >135° junction (octagon) find speed for approximate arc
+              if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+
+                #if ENABLED(JD_USE_MATH_ACOS)
+
+                  #error "TODO: Inline maths with the MCU / FPU."
+
+                #elif ENABLED(JD_USE_LOOKUP_TABLE)
+
+                  // Fast acos approximation (max. error +-0.01 rads)
+                  // Based on LUT table and linear interpolation
+
+                  /**
+                   *  // Generate the JD Lookup Table
+                   *  constexpr float c = 1.00751495f; // Correction factor to center error around 0
+                   *  for (int i = 0; i < jd_lut_count - 1; ++i) {
+                   *    const float x0 = (sq(i) - 1) / sq(i),
+                   *                y0 = acos(x0) * (i == 0 ? 1 : c),
+                   *                x1 = i < jd_lut_count - 1 ?  0.5 * x0 + 0.5 : 0.999999f,
+                   *                y1 = acos(x1) * (i < jd_lut_count - 1 ? c : 1);
+                   *    jd_lut_k[i] = (y0 - y1) / (x0 - x1);
+                   *    jd_lut_b[i] = (y1 * x0 - y0 * x1) / (x0 - x1);
+                   *  }
+                   *
+                   *  // Compute correction factor (Set c to 1.0f first!)
+                   *  float min = INFINITY, max = -min;
+                   *  for (float t = 0; t <= 1; t += 0.0003f) {
+                   *    const float e = acos(t) / approx(t);
+                   *    if (isfinite(e)) {
+                   *      if (e < min) min = e;
+                   *      if (e > max) max = e;
+                   *    }
+                   *  }
+                   *  fprintf(stderr, "%.9gf, ", (min + max) / 2);
+                   */
+                  static constexpr int16_t  jd_lut_count = 16;
+                  static constexpr uint16_t jd_lut_tll   = _BV(jd_lut_count - 1);
+                  static constexpr int16_t  jd_lut_tll0  = __builtin_clz(jd_lut_tll) + 1; // i.e., 16 - jd_lut_count + 1
+                  static constexpr float jd_lut_k[jd_lut_count] PROGMEM = {
+                    -1.03145837f, -1.30760646f, -1.75205851f, -2.41705704f,
+                    -3.37769222f, -4.74888992f, -6.69649887f, -9.45661736f,
+                    -13.3640480f, -18.8928222f, -26.7136841f, -37.7754593f,
+                    -53.4201813f, -75.5458374f, -106.836761f, -218.532821f };
+                  static constexpr float jd_lut_b[jd_lut_count] PROGMEM = {
+                     1.57079637f,  1.70887053f,  2.04220939f,  2.62408352f,
+                     3.52467871f,  4.85302639f,  6.77020454f,  9.50875854f,
+                     13.4009285f,  18.9188995f,  26.7321243f,  37.7885055f,
+                     53.4293975f,  75.5523529f,  106.841369f,  218.534011f };
+
+                  const float neg = junction_cos_theta < 0 ? -1 : 1,
+                              t = neg * junction_cos_theta;
+
+                  const int16_t idx = (t < 0.00000003f) ? 0 : __builtin_clz(uint16_t((1.0f - t) * jd_lut_tll)) - jd_lut_tll0;
+
+                  float junction_theta = t * pgm_read_float(&jd_lut_k[idx]) + pgm_read_float(&jd_lut_b[idx]);
+                  if (neg > 0) junction_theta = RADIANS(180) - junction_theta; // acos(-t)
+
+                #else
+
+                  // Fast acos(-t) approximation (max. error +-0.033rad = 1.89°)
+                  // Based on MinMax polynomial published by W. Randolph Franklin, see
+                  // https://wrf.ecse.rpi.edu/Research/Short_Notes/arcsin/onlyelem.html
+                  //  acos( t) = pi / 2 - asin(x)
+                  //  acos(-t) = pi - acos(t) ... pi / 2 + asin(x)
+
+                  const float neg = junction_cos_theta < 0 ? -1 : 1,
+                              t = neg * junction_cos_theta,
+                              asinx =       0.032843707f
+                                    + t * (-1.451838349f
+                                    + t * ( 29.66153956f
+                                    + t * (-131.1123477f
+                                    + t * ( 262.8130562f
+                                    + t * (-242.7199627f
+                                    + t * ( 84.31466202f ) ))))),
+                              junction_theta = RADIANS(90) + neg * asinx; // acos(-t)
+
+                  // NOTE: junction_theta bottoms out at 0.033 which avoids divide by 0.
+
+                #endif
+
+                const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+                NOMORE(vmax_junction_sqr, limit_sqr);
+              }
+
+            #endif // JD_HANDLE_SMALL_SEGMENTS
+          }
         }
       }
 
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, sq(block->nominal_speed), sq(previous_nominal_speed));
+
+      #if ENABLED(LA_JUNCTION_LIMIT)
+        // Where the flow per mm changes the extruder speed steps by v * (change in ratio).
+        // Keep that step within the E jerk so the extruder can follow the corner.
+        const float e_ratio_step = ABS(e_ratio - prev_e_ratio);
+        if (e_ratio_step > 0.0001f) NOMORE(vmax_junction_sqr, sq(MAX_E_JERK(extruder) / e_ratio_step));
+      #endif
     }
     else vmax_junction_sqr = minimum_planner_speed_sqr;
 
     prev_unit_vec = unit_vec;
+    TERN_(LA_JUNCTION_LIMIT, prev_e_ratio = e_ratio);
 
   #else // CLASSIC_JERK
 
@@ -2773,6 +3127,12 @@ bool Planner::_populate_block(
     }
     vmax_junction_sqr = sq(vmax_junction * v_factor);
 
+    #if ENABLED(HINTS_JUNCTION_SPEED)
+      // Junctions inside an arc follow the curve, not the corner between two chords
+      if (hints.junction_speed_sqr && moves_queued && !UNEAR_ZERO(previous_nominal_speed))
+        vmax_junction_sqr = _MIN(hints.junction_speed_sqr, sq(block->nominal_speed), sq(previous_nominal_speed));
+    #endif
+
   #endif // CLASSIC_JERK
 
   // High acceleration limits override low jerk/junction deviation limits (as fixing trapezoids
@@ -2803,6 +3163,7 @@ bool Planner::_populate_block(
 
   TERN_(HAS_POSITION_FLOAT, position_float = target_float);
   TERN_(GRADIENT_MIX, mixer.gradient_control(target_float.z));
+  TERN_(GRADIENT_MIX_PER_STEP, mixer.populate_block(block->b_color_end));
 
   return true;        // Movement was accepted
 
@@ -2816,6 +3177,9 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  // A held move goes first
+  TERN_(SEGMENT_MERGE, flush_segment_merge());
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -2878,6 +3242,9 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // A held move goes first
+  TERN_(SEGMENT_MERGE, flush_segment_merge());
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -2999,11 +3366,37 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
   , const uint8_t extruder/*=active_extruder*/
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
+  TERN_(BABYSTEP_PLANNER, babystep.ramp_z_offset(cart));
+  TERN_(LAYER_TIME_FAN, layer_fan.next_move(cart));
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
   #if IS_KINEMATIC
 
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    return buffer_kinematic(cart, machine, fr_mm_s, extruder, hints);
+
+  #else // !IS_KINEMATIC
+
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+
+  #endif
+
+} // buffer_line()
+
+#if IS_KINEMATIC
+
+  /**
+   * Add a move to 'cart' with its joint positions already in 'delta'.
+   * Only the E of the modified position 'machine' is used.
+   */
+  bool Planner::buffer_kinematic(const xyze_pos_t &cart, const xyze_pos_t &machine, const feedRate_t fr_mm_s
+    , const uint8_t extruder, const PlannerHints &hints
+  ) {
+    UNUSED(machine);
+
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
         cart.e - position_cart.e,
@@ -3019,9 +3412,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = get_move_distance(xyze_pos_t(cart_dist_mm) OPTARG(HAS_ROTATIONAL_AXES, ph.cartesian_move));
@@ -3088,14 +3478,24 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
       return true;
     }
     return false;
+  }
 
-  #else // !IS_KINEMATIC
+  #if ENABLED(DELTA_IK_INTERPOLATION)
 
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
+    bool Planner::buffer_line_joints(const xyze_pos_t &cart, const float e_offset, const feedRate_t fr_mm_s
+      , const uint8_t extruder/*=active_extruder*/
+      , const PlannerHints &hints/*=PlannerHints()*/
+    ) {
+      TERN_(LAYER_TIME_FAN, layer_fan.next_move(cart));
+      xyze_pos_t machine = cart;
+      TERN_(HAS_EXTRUDERS, machine.e += e_offset);
+      UNUSED(e_offset);
+      return buffer_kinematic(cart, machine, fr_mm_s, extruder, hints);
+    }
 
   #endif
 
-} // buffer_line()
+#endif // IS_KINEMATIC
 
 #if ENABLED(DIRECT_STEPPING)
 
@@ -3159,6 +3559,9 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
 
+  // A held move ends at the old position
+  TERN_(SEGMENT_MERGE, flush_segment_merge());
+
   // When FT Motion is enabled, call synchronize() here instead of generating a sync block
   if (TERN0(FT_MOTION, ftMotion.cfg.active)) synchronize();
 
@@ -3222,6 +3625,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Special setter for planner E position (also setting E stepper position).
    */
   void Planner::set_e_position_mm(const float e) {
+    TERN_(SEGMENT_MERGE, flush_segment_merge());
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3251,8 +3655,27 @@ void Planner::refresh_acceleration_rates() {
   }
   acceleration_long_cutoff = 4294967295UL / highest_rate; // 0xFFFFFFFFUL
   TERN_(HAS_LINEAR_E_JERK, recalculate_max_e_jerk());
+  TERN_(JD_JUNCTION_CACHE, junction_cache_reset()); // Cached junction accelerations used the old limits
 }
 
+#if ENABLED(JD_JUNCTION_CACHE)
+
+  /**
+   * Find a cached junction with the same acceleration and a junction vector
+   * within 0.0001 per axis (about 0.006°) of the given one, or nullptr.
+   */
+  const Planner::junction_cache_t* Planner::junction_cache_find(const xyze_float_t &delta, const float accel) {
+    for (const auto &jc : junction_cache) {
+      if (jc.acceleration != accel) continue;
+      bool same = true;
+      LOOP_LOGICAL_AXES(i) if (!WITHIN(jc.delta[i] - delta[i], -0.0001f, 0.0001f)) { same = false; break; }
+      if (same) return &jc;
+    }
+    return nullptr;
+  }
+
+#endif
+
 /**
  * Recalculate 'position' and 'mm_per_step'.
  * Must be called whenever settings.axis_steps_per_mm changes!
@@ -3391,3 +3814,48 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
   }
 
 #endif
+
+#if ENABLED(PLANNER_TIME_ESTIMATE)
+
+  void Planner::reset_print_time() {
+    const bool was_enabled = stepper.suspend();
+    executed_time_us = 0;
+    if (was_enabled) stepper.wake_up();
+  }
+
+  /**
+   * Planned time of the blocks executed since the job started
+   * and of the blocks still waiting in the buffer, in µs.
+   */
+  uint64_t Planner::planned_print_time_us(uint64_t &queued_us) {
+    const bool was_enabled = stepper.suspend();
+    const uint64_t executed_us = executed_time_us;
+    queued_us = 0;
+    for (uint8_t b = block_buffer_nonbusy; b != block_buffer_head; b = next_block_index(b))
+      queued_us += block_buffer[b].move_time_us;
+    if (was_enabled) stepper.wake_up();
+    return executed_us + queued_us;
+  }
+
+  /**
+   * Remaining print time in seconds, or 0 if there's no estimate.
+   *
+   * The file read so far took the planned time of all executed and queued blocks,
+   * so the rest of the file is assumed to take the same time per byte. The blocks
+   * still in the buffer are added at their exact planned time.
+   */
+  uint32_t Planner::remaining_print_time() {
+    #if HAS_MEDIA
+      if (!card.isStillPrinting()) return 0;
+      const uint32_t done = card.getIndex(), size = card.getFileSize();
+      if (!done || done >= size) return 0;
+      uint64_t queued_us;
+      const uint64_t planned_us = planned_print_time_us(queued_us);
+      if (!planned_us) return 0;
+      return uint32_t((float(planned_us) * float(size - done) / float(done) + float(queued_us)) * 1e-6f);
+    #else
+      return 0;
+    #endif
+  }
+
+#endif // PLANNER_TIME_ESTIMATE
@@ -192,6 +192,10 @@ typedef struct {
       float trap_ramp_entry_incr;                     // Acceleration per step laser power increment (trap entry)
       float trap_ramp_exit_decr;                      // Deceleration per step laser power decrement (trap exit)
     #endif
+    #if ENABLED(LASER_POWER_TRAP_RATE)
+      uint32_t trap_rate_slope;                       // Power above the floor per step/s, as 16.16 fixed-point
+      uint8_t trap_rate_floor;                        // Power at zero speed
+    #endif
   } block_laser_t;
 
 #endif
@@ -216,6 +220,28 @@ typedef struct PlannerBlock {
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
 
+  // Byte-sized fields are kept together so they share words instead of each one being padded
+
+  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
+
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;                       // The extruder to move (if E move)
+  #else
+    static constexpr uint8_t extruder = 0;
+  #endif
+
+  #if HAS_ROUGH_LIN_ADVANCE
+    uint8_t la_scaling;                     // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
   // Fields used by the motion planner to manage acceleration
   float nominal_speed,                      // The nominal speed for this block in (mm/sec)
         entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
@@ -231,14 +257,15 @@ typedef struct PlannerBlock {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  #if HAS_MULTI_EXTRUDER
-    uint8_t extruder;                       // The extruder to move (if E move)
-  #else
-    static constexpr uint8_t extruder = 0;
+  #if ENABLED(BACKLASH_STEPPER)
+    xyz_long_t backlash_steps;              // Backlash correction steps played by the stepper with this block
   #endif
 
   #if ENABLED(MIXING_EXTRUDER)
     mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
+    #if ENABLED(GRADIENT_MIX_PER_STEP)
+      mixer_comp_t b_color_end[MIXING_STEPPERS]; // Gradient color at the end of the block
+    #endif
   #endif
 
   // Settings for the trapezoid generator
@@ -258,14 +285,20 @@ typedef struct PlannerBlock {
              deceleration_time;
   #endif
   #if ENABLED(S_CURVE_ACCELERATION)
-    uint32_t acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
-             deceleration_time_inverse;
+    #if ENABLED(COMPACT_PLANNER_BLOCKS)
+      // Found with a hardware divide by the Stepper when it starts each half of the curve
+      uint32_t get_acceleration_time_inverse() const { return acceleration_time ? 0xFFFFFFFF / acceleration_time : 0xFFFFFFFF; }
+      uint32_t get_deceleration_time_inverse() const { return deceleration_time ? 0xFFFFFFFF / deceleration_time : 0xFFFFFFFF; }
+    #else
+      uint32_t acceleration_time_inverse,   // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
+               deceleration_time_inverse;
+      uint32_t get_acceleration_time_inverse() const { return acceleration_time_inverse; }
+      uint32_t get_deceleration_time_inverse() const { return deceleration_time_inverse; }
+    #endif
   #else
     uint32_t acceleration_rate;             // Acceleration rate in (2^24 steps)/timer_ticks*s
   #endif
 
-  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
-
   #if ENABLED(FT_MOTION)
     xyze_pos_t dist_mm;                     // The distance traveled in mm along each axis
   #endif
@@ -277,7 +310,6 @@ typedef struct PlannerBlock {
   #if ENABLED(LIN_ADVANCE)
     #if HAS_ROUGH_LIN_ADVANCE
       uint32_t la_advance_rate;             // The rate at which steps are added whilst accelerating
-      uint8_t  la_scaling;                  // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
       uint16_t max_adv_steps,               // Max advance steps to get cruising speed pressure
                final_adv_steps;             // Advance steps for exit speed pressure
     #endif
@@ -285,8 +317,14 @@ typedef struct PlannerBlock {
 
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+           final_rate;                      // The minimal rate at exit
+
+  #if ENABLED(COMPACT_PLANNER_BLOCKS)
+    uint32_t get_acceleration_steps_per_s2() const { return LROUND(acceleration * steps_per_mm); }
+  #else
+    uint32_t acceleration_steps_per_s2;     // acceleration steps/sec^2
+    uint32_t get_acceleration_steps_per_s2() const { return acceleration_steps_per_s2; }
+  #endif
 
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
@@ -296,18 +334,14 @@ typedef struct PlannerBlock {
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
-
   #if HAS_WIRED_LCD
     uint32_t segment_time_us;
   #endif
 
+  #if ENABLED(PLANNER_TIME_ESTIMATE)
+    uint32_t move_time_us;                  // Planned time of the whole trapezoid
+  #endif
+
   #if ENABLED(POWER_LOSS_RECOVERY)
     uint32_t sdpos;
     xyze_pos_t start_position;
@@ -325,15 +359,29 @@ typedef struct PlannerBlock {
   #define HAS_POSITION_FLOAT 1
 #endif
 
-constexpr uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
-  return v1 >= v2 ? v1 - v2 : v1 - v2 + BLOCK_BUFFER_SIZE;
+#if ENABLED(BUFFER_ARENA)
+  // Blocks used by the planner, set at boot. The rest of the block buffer holds the command pool.
+  extern uint8_t block_buffer_size;
+  #define BLOCK_ARENA_SIZE ((BLOCK_BUFFER_SIZE) + CEILING(COMMAND_POOL_SIZE, sizeof(block_t)))
+  #define BUFFER_ARENA_MIN_BLOCKS _MAX(4, TERN0(SMOOTH_LIN_ADVANCE, SMOOTH_LIN_ADV_LOOKAHEAD), TERN0(PLANNER_SEGMENT_BATCH, 2 * (PLANNER_SEGMENT_BATCH)))
+  #define BLOCK_CONSTEXPR inline
+#else
+  constexpr uint8_t block_buffer_size = BLOCK_BUFFER_SIZE;
+  #define BLOCK_ARENA_SIZE (BLOCK_BUFFER_SIZE)
+  #define BLOCK_CONSTEXPR constexpr
+#endif
+
+BLOCK_CONSTEXPR uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
+  return v1 >= v2 ? v1 - v2 : v1 - v2 + block_buffer_size;
 }
 
-constexpr uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
-  return v1 + v2 < BLOCK_BUFFER_SIZE ? v1 + v2 : v1 + v2 - BLOCK_BUFFER_SIZE;
+BLOCK_CONSTEXPR uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
+  return v1 + v2 < block_buffer_size ? v1 + v2 : v1 + v2 - block_buffer_size;
 }
 
-#if IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
+#if ENABLED(BUFFER_ARENA)
+  #define BLOCK_MOD(n) ((n)%block_buffer_size)
+#elif IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
   #define BLOCK_MOD(n) ((n)&((BLOCK_BUFFER_SIZE)-1))
 #else
   #define BLOCK_MOD(n) ((n)%(BLOCK_BUFFER_SIZE))
@@ -417,6 +465,9 @@ typedef struct PlannerSettings {
 #if ENABLED(ARC_SUPPORT)
   #define HINTS_CURVE_RADIUS
   #define HINTS_SAFE_EXIT_SPEED
+  #if ENABLED(ARC_ADAPTIVE_SEGMENTS)
+    #define HINTS_JUNCTION_SPEED
+  #endif
 #endif
 
 struct PlannerHints {
@@ -429,6 +480,9 @@ struct PlannerHints {
   #else
     static constexpr float curve_radius = 0.0;
   #endif
+  #if ENABLED(HINTS_JUNCTION_SPEED)
+    float junction_speed_sqr = 0.0;   // Square of the entry speed for a junction inside a constant curvature path, if known
+  #endif
   #if ENABLED(HINTS_SAFE_EXIT_SPEED)
     float safe_exit_speed_sqr = 0.0;  // Square of the speed considered "safe" at the end of the segment
                                       // i.e., at or below the exit speed of the segment that the planner
@@ -459,13 +513,39 @@ class Planner {
      *  Writer of head is Planner::buffer_segment().
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
-    static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    static block_t block_buffer[BLOCK_ARENA_SIZE];
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(BUFFER_ARENA)
+      static uint8_t arena_blocks;                  // M227 B: Blocks for the planner from the next boot
+      static void apply_arena();
+    #endif
+
+    #if ENABLED(PLANNER_INCREMENTAL_LOOKAHEAD)
+      static uint8_t block_buffer_planned;          // Index of the last block the reverse pass left unchanged. The forward pass starts here.
+    #endif
+
+    #if ENABLED(PLANNER_SEGMENT_BATCH)
+      static uint8_t segment_batch,                 // Depth of nested segment batches
+                     batch_pending;                 // Blocks buffered since the last recalculate()
+      static float batch_exit_speed_sqr;            // Safe exit speed of the newest pending block
+    #endif
+
+    #if ENABLED(PLANNER_LOOKAHEAD_STATS)
+      typedef struct {
+        uint32_t recalcs,                           // Number of calls to recalculate(), one per queued move
+                 reverse_walked,                    // Move blocks visited by all reverse passes
+                 forward_walked;                    // Blocks visited by all forward passes
+        void reset() { recalcs = reverse_walked = forward_walked = 0; }
+      } lookahead_stats_t;
+      static lookahead_stats_t lookahead_stats;
+      static void report_lookahead_stats();
+    #endif
+
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
     #endif
@@ -611,7 +691,7 @@ class Planner {
     #endif
 
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
-      static float last_fade_z;
+      static float last_fade_z, z_fade_factor;  // The fade factor for the current layer
     #endif
 
     #if ENABLED(DISABLE_OTHER_EXTRUDERS)
@@ -623,6 +703,10 @@ class Planner {
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
+    #if ENABLED(PLANNER_TIME_ESTIMATE)
+      volatile static uint64_t executed_time_us;        // Planned time of blocks taken by the stepper since the job started
+    #endif
+
     #if ENABLED(SMOOTH_LIN_ADVANCE)
       static uint32_t extruder_advance_K_q27[DISTINCT_E];
     #endif
@@ -735,18 +819,18 @@ class Planner {
 
       /**
        * Get the Z leveling fade factor based on the given Z height,
-       * re-calculating only when needed.
+       * re-calculating only when Z changes, so moves within a layer
+       * cost a single compare.
        *
        *  Returns 1.0 if planner.z_fade_height is 0.0.
        *  Returns 0.0 if Z is past the specified 'Fade Height'.
        */
-      static float fade_scaling_factor_for_z(const float rz) {
-        static float z_fade_factor = 1;
-        if (!z_fade_height || rz <= 0) return 1;
-        if (rz >= z_fade_height) return 0;
+      FORCE_INLINE static float fade_scaling_factor_for_z(const float rz) {
         if (last_fade_z != rz) {
           last_fade_z = rz;
-          z_fade_factor = 1 - rz * inverse_z_fade_height;
+          z_fade_factor = (!z_fade_height || rz <= 0) ? 1.0f
+                        : rz >= z_fade_height ? 0.0f
+                        : 1.0f - rz * inverse_z_fade_height;
         }
         return z_fade_factor;
       }
@@ -814,16 +898,15 @@ class Planner {
       FORCE_INLINE static void unapply_leveling(xyz_pos_t&) {}
     #endif
 
-    #if ENABLED(FWRETRACT)
-      static void apply_retract(float &rz, float &e);
-      FORCE_INLINE static void apply_retract(xyze_pos_t &raw) { apply_retract(raw.z, raw.e); }
-      static void unapply_retract(float &rz, float &e);
-      FORCE_INLINE static void unapply_retract(xyze_pos_t &raw) { unapply_retract(raw.z, raw.e); }
+    #if HAS_PLANNER_OFFSETS
+      // The babystep Z offset, retract hop, and retracted E
+      static void apply_offsets(xyze_pos_t &raw);
+      static void unapply_offsets(xyze_pos_t &raw);
     #endif
 
     #if HAS_POSITION_MODIFIERS
       /**
-       * @brief   Apply Skew, Leveling, and Retraction modifiers to the given cartesian position.
+       * @brief   Apply Skew, Leveling, Babystep, and Retraction modifiers to the given cartesian position.
        * @details By default leveling is only applied if the planner is the leveling handler (i.e., PLANNER_LEVELING).
        *
        * @param pos       The position to modify
@@ -831,20 +914,20 @@ class Planner {
        */
       FORCE_INLINE static void apply_modifiers(xyze_pos_t &pos, const bool leveling=ENABLED(PLANNER_LEVELING)) {
         TERN_(SKEW_CORRECTION, skew(pos));
-        if (leveling) apply_leveling(pos);
-        TERN_(FWRETRACT, apply_retract(pos));
+        if (leveling && TERN0(HAS_LEVELING, leveling_active)) apply_leveling(pos);
+        TERN_(HAS_PLANNER_OFFSETS, apply_offsets(pos));
       }
 
       /**
-       * @brief   Un-apply Skew, Leveling, and Retraction modifiers to the given cartesian position.
+       * @brief   Un-apply Skew, Leveling, Babystep, and Retraction modifiers to the given cartesian position.
        * @details By default leveling is only un-applied if the planner is the leveling handler (i.e., PLANNER_LEVELING).
        *
        * @param pos       The position to un-modify
        * @param leveling  Optional bool whether to include the leveling modifier
        */
       FORCE_INLINE static void unapply_modifiers(xyze_pos_t &pos, const bool leveling=ENABLED(PLANNER_LEVELING)) {
-        TERN_(FWRETRACT, unapply_retract(pos));
-        if (leveling) unapply_leveling(pos);
+        TERN_(HAS_PLANNER_OFFSETS, unapply_offsets(pos));
+        if (leveling && TERN0(HAS_LEVELING, leveling_active)) unapply_leveling(pos);
         TERN_(SKEW_CORRECTION, unskew(pos));
       }
     #endif // HAS_POSITION_MODIFIERS
@@ -866,7 +949,7 @@ class Planner {
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
+    FORCE_INLINE static uint8_t moves_free() { return block_buffer_size - 1 - movesplanned(); }
 
     /**
      * @fn Planner::get_next_free_block
@@ -984,6 +1067,18 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if ENABLED(DELTA_IK_INTERPOLATION)
+      /**
+       * @brief Add a new linear movement with its joint positions already in 'delta'.
+       * @details As buffer_line, for a 'cart' whose modifiers and kinematics were applied
+       *          by the caller. e_offset is the E added by the modifiers (i.e., retraction).
+       */
+      static bool buffer_line_joints(const xyze_pos_t &cart, const float e_offset, const feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -1040,6 +1135,20 @@ class Planner {
     // a Full Shutdown is required, or when endstops are hit)
     static void quick_stop();
 
+    #if ENABLED(FEEDRATE_OVERRIDE_REPLAN)
+      // Re-plan the queued moves after a change to feedrate_percentage
+      static void apply_feedrate_override();
+      static void scale_planned_feedrate(const float ratio);
+    #endif
+
+    #if ENABLED(PLANNER_SEGMENT_BATCH)
+      // Plan the segments of a split move in batches. Use PlannerSegmentBatch to scope a loop.
+      static void begin_segments() { ++segment_batch; }
+      static void end_segments() { if (segment_batch && !--segment_batch) flush_segments(); }
+      static void flush_segments() { if (batch_pending) recalculate(batch_exit_speed_sqr); }
+      static bool defer_recalculate(const float safe_exit_speed_sqr);
+    #endif
+
     #if ENABLED(REALTIME_REPORTING_COMMANDS)
       // Force a quick pause of the machine (e.g., when a pause is required in the middle of move).
       // NOTE: Hard-stops will lose steps so encoders are highly recommended if using these!
@@ -1048,7 +1157,7 @@ class Planner {
     #endif
 
     // Called when an endstop is triggered. Causes the machine to stop immediately
-    static void endstop_triggered(const AxisEnum axis);
+    static void endstop_triggered(const AxisEnum axis OPTARG(ENDSTOP_EDGE_CAPTURE, const xyze_long_t * const edge_pos=nullptr));
 
     // Triggered position of an axis in mm (not core-savvy)
     static float triggered_position_mm(const AxisEnum axis);
@@ -1103,6 +1212,12 @@ class Planner {
       static void clear_block_buffer_runtime();
     #endif
 
+    #if ENABLED(PLANNER_TIME_ESTIMATE)
+      static void reset_print_time();
+      static uint64_t planned_print_time_us(uint64_t &queued_us);
+      static uint32_t remaining_print_time();
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static autotemp_t autotemp;
       static void autotemp_update();
@@ -1120,6 +1235,12 @@ class Planner {
 
   private:
 
+    #if IS_KINEMATIC
+      static bool buffer_kinematic(const xyze_pos_t &cart, const xyze_pos_t &machine, const feedRate_t fr_mm_s
+        , const uint8_t extruder, const PlannerHints &hints
+      );
+    #endif
+
     #if ENABLED(AUTOTEMP)
       #if ENABLED(AUTOTEMP_PROPORTIONAL)
         static void _autotemp_update_from_hotend();
@@ -1131,8 +1252,8 @@ class Planner {
     /**
      * Get the index of the next / previous block in the ring buffer
      */
-    static constexpr uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
-    static constexpr uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
+    static BLOCK_CONSTEXPR uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
+    static BLOCK_CONSTEXPR uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
 
     /**
      * Calculate the maximum allowable speed squared at this point, in order
@@ -1168,8 +1289,29 @@ class Planner {
       friend void do_homing_move(const AxisEnum, const float, const feedRate_t, const bool);
     #endif
 
+    #if ENABLED(MARLIN_TEST_BUILD)
+      // Allow the kernel benchmark to time internal functions
+      friend void benchmarkKernels(const uint16_t);
+    #endif
+
     #if HAS_JUNCTION_DEVIATION
 
+      #if ENABLED(JD_JUNCTION_CACHE)
+        // A recent junction with the limits that only depend on its geometry
+        typedef struct {
+          xyze_float_t delta;           // unit_vec - prev_unit_vec, before normalizing
+          float acceleration,           // The block acceleration the limits were found for
+                junction_acceleration,  // The acceleration limited along the junction vector
+                jd_factor;              // sin(theta/2) / (1 - sin(theta/2))
+        } junction_cache_t;
+
+        static junction_cache_t junction_cache[JD_JUNCTION_CACHE_SIZE];
+        static uint8_t junction_cache_next;
+
+        static const junction_cache_t* junction_cache_find(const xyze_float_t &delta, const float accel);
+        static void junction_cache_reset() { for (auto &jc : junction_cache) jc.acceleration = 0; }
+      #endif
+
       FORCE_INLINE static void normalize_junction_vector(xyze_float_t &vector) {
         float magnitude_sq = 0;
         LOOP_LOGICAL_AXES(idx) if (vector[idx]) magnitude_sq += sq(vector[idx]);
@@ -1205,3 +1347,11 @@ class Planner {
   || BLOCK->steps.u, || BLOCK->steps.v, || BLOCK->steps.w))
 
 extern Planner planner;
+
+#if ENABLED(PLANNER_SEGMENT_BATCH)
+  // Batch the segments buffered during the life of this object
+  struct PlannerSegmentBatch {
+    PlannerSegmentBatch() { planner.begin_segments(); }
+    ~PlannerSegmentBatch() { planner.end_segments(); }
+  };
+#endif
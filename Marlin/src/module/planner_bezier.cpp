@@ -66,6 +66,31 @@ static inline float eval_bezier(const float a, const float b, const float c, con
  */
 static inline float dist1(const float x1, const float y1, const float x2, const float y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
 
+#if ENABLED(BEZIER_ADAPTIVE_SEGMENTS)
+
+  // First and second derivatives of a cubic Bézier by t
+  static inline float bezier_d1(const float a, const float b, const float c, const float d, const float t) {
+    const float it = 1 - t;
+    return 3 * (it * it * (b - a) + 2 * it * t * (c - b) + t * t * (d - c));
+  }
+  static inline float bezier_d2(const float a, const float b, const float c, const float d, const float t) {
+    return 6 * ((1 - t) * (c - 2 * b + a) + t * (d - 2 * c + b));
+  }
+
+  /**
+   * Radius of curvature of the XY curve at t, |B'|^3 / |B' x B''|,
+   * and its speed (length per unit of t) |B'|.
+   */
+  static float bezier_radius(const xy_pos_t &p0, const xy_pos_t &p1, const xy_pos_t &p2, const xy_pos_t &p3, const float t, float &speed) {
+    const float dx = bezier_d1(p0.x, p1.x, p2.x, p3.x, t), dy = bezier_d1(p0.y, p1.y, p2.y, p3.y, t),
+                ddx = bezier_d2(p0.x, p1.x, p2.x, p3.x, t), ddy = bezier_d2(p0.y, p1.y, p2.y, p3.y, t),
+                cross = ABS(dx * ddy - dy * ddx);
+    speed = HYPOT(dx, dy);
+    return cross > 0 ? speed * speed * speed / cross : __FLT_MAX__;
+  }
+
+#endif
+
 /**
  * The algorithm for computing the step is loosely based on the one in Kig
  * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
@@ -104,6 +129,13 @@ static inline float dist1(const float x1, const float y1, const float x2, const
  * estimates; however, given the improbability of such configurations,
  * the mitigation offered by MIN_STEP and the small computational
  * power available on Arduino, I think it is not wise to implement it.
+ *
+ * With BEZIER_ADAPTIVE_SEGMENTS the step is instead derived from the
+ * local radius of curvature, as for G2/G3 with ARC_ADAPTIVE_SEGMENTS.
+ * The segment length comes from curve_segment_mm() for the tighter
+ * radius at the start and the middle of the step, and is converted
+ * to a step in t by the speed of the curve. Gentle curves produce few
+ * segments and tight curves many, within ARC_CHORD_TOLERANCE.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -124,6 +156,8 @@ void cubic_b_spline(
   // Hints to help optimize the move
   PlannerHints hints;
 
+  TERN_(PLANNER_SEGMENT_BATCH, const PlannerSegmentBatch segment_batch);
+
   for (float t = 0; t < 1;) {
 
     thermalManager.task();
@@ -133,54 +167,80 @@ void cubic_b_spline(
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
+    #if ENABLED(BEZIER_ADAPTIVE_SEGMENTS)
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+      // Step for the tightest curvature at the start and middle of the segment
+      float speed, mid_speed;
+      const float radius = bezier_radius(position, first, second, target, t, speed);
+      float seg_mm = curve_segment_mm(radius, scaled_fr_mm_s);
+      step = speed > 0 ? seg_mm / speed : MIN_STEP;
+      const float mid_radius = bezier_radius(position, first, second, target, _MIN(t + 0.5f * step, 1.0f), mid_speed);
+      if (mid_radius < radius) seg_mm = curve_segment_mm(mid_radius, scaled_fr_mm_s);
+      NOLESS(speed, mid_speed);
+      step = speed > 0 ? seg_mm / speed : MIN_STEP;
+      NOLESS(step, MIN_STEP);
+
+      float new_t = t + step;
+      NOMORE(new_t, 1);
+      const float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
+                  new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
+
+      // Cornering speed at the start of the segment follows the curve
+      if (t > 0) hints.curve_radius = radius;
+
+    #else
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
+      // First try to reduce the step in order to make it sufficiently
+      // close to a linear interpolation.
+      bool did_reduce = false;
+      float new_t = t + step;
+      NOMORE(new_t, 1);
+      float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
+            new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
+      for (;;) {
+        if (new_t - t < (MIN_STEP)) break;
+        const float candidate_t = 0.5f * (t + new_t),
+                    candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
+                    candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
+                    interp_pos0 = 0.5f * (bez_target.x + new_pos0),
+                    interp_pos1 = 0.5f * (bez_target.y + new_pos1);
+        if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
+        new_t = candidate_t;
+        new_pos0 = candidate_pos0;
+        new_pos1 = candidate_pos1;
+        did_reduce = true;
       }
-    */
 
-    hints.millimeters = new_t - t;
+      // If we did not reduce the step, maybe we should enlarge it.
+      if (!did_reduce) for (;;) {
+        if (new_t - t > MAX_STEP) break;
+        const float candidate_t = t + 2 * (new_t - t);
+        if (candidate_t >= 1) break;
+        const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
+                    candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
+                    interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
+                    interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
+        if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
+        new_t = candidate_t;
+        new_pos0 = candidate_pos0;
+        new_pos1 = candidate_pos1;
+      }
+
+      // Check some postcondition; they are disabled in the actual
+      // Marlin build, but if you test the same code on a computer you
+      // may want to check they are respect.
+      /*
+        assert(new_t <= 1.0);
+        if (new_t < 1.0) {
+          assert(new_t - t >= (MIN_STEP) / 2.0);
+          assert(new_t - t <= (MAX_STEP) * 2.0);
+        }
+      */
+
+      hints.millimeters = new_t - t;
+
+    #endif // !BEZIER_ADAPTIVE_SEGMENTS
+
     t = new_t;
 
     // Compute and send new position
@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_fixed.h - Fixed-point kernels for Planner::calculate_trapezoid_for_block
+ *
+ * With PLANNER_FIXED_POINT_TRAPEZOID these replace the float divisions and square
+ * roots used to build a block's trapezoid, so MCUs without an FPU (e.g., STM32F103)
+ * don't spend their time in soft-float routines.
+ *
+ * The acceleration of a block is converted once into a normalized Q32 reciprocal,
+ * so each "divide by acceleration" becomes two 32x32->64 multiplies and a shift.
+ * Step counts are produced in Q8 (1/256 step) so ceil / round behave like the
+ * float code. Only standard integer types are used so the kernels can be tested
+ * natively against the float path.
+ */
+
+#include <stdint.h>
+
+namespace PlannerFixed {
+
+  // 1/a ~= r / 2^shift, with r normalized to [2^31, 2^32) for 31+ bits of precision
+  typedef struct { uint32_t r; uint8_t shift; } recip_t;
+
+  // Number of fractional bits of step counts in Q8 format
+  constexpr uint8_t STEP_FRAC = 8;
+
+  // Reciprocal of a non-zero acceleration. This is the only division per block.
+  inline recip_t reciprocal(const uint32_t a) {
+    const uint8_t shift = 63 - __builtin_clz(a);
+    return { uint32_t(((uint64_t(1) << shift) - 1) / a), shift };
+  }
+
+  // floor(v * rc / 2^frac) for v < 2^48, without a 128-bit product
+  inline uint64_t mul_recip(const uint64_t v, const recip_t &rc, const uint8_t frac=0) {
+    const uint64_t hi = uint64_t(uint32_t(v >> 32)) * rc.r,
+                   lo = uint64_t(uint32_t(v)) * rc.r;
+    const uint8_t s = rc.shift - frac;
+    return s >= 32 ? (hi + (lo >> 32)) >> (s - 32) : (hi << (32 - s)) + (lo >> s);
+  }
+
+  // Signed (r1^2 - r0^2) / (2 * a) in Q8 steps. The distance to change from rate r0 to r1.
+  inline int64_t accel_distance_q8(const uint32_t r1, const uint32_t r0, const recip_t &rc) {
+    const uint64_t s1 = uint64_t(r1) * r1, s0 = uint64_t(r0) * r0;
+    return s1 >= s0 ? int64_t(mul_recip(s1 - s0, rc, STEP_FRAC - 1))
+                    : -int64_t(mul_recip(s0 - s1, rc, STEP_FRAC - 1));
+  }
+
+  // Convert Q8 steps to whole steps, rounding up / to nearest
+  constexpr int32_t ceil_steps(const int64_t q8) { return int32_t((q8 + (1 << STEP_FRAC) - 1) >> STEP_FRAC); }
+  constexpr int32_t round_steps(const int64_t q8) { return int32_t((q8 + (1 << (STEP_FRAC - 1))) >> STEP_FRAC); }
+
+  // Integer square root, rounded to the nearest integer
+  inline uint32_t isqrt(uint64_t v) {
+    uint64_t res = 0, bit = uint64_t(1) << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+      if (v >= res + bit) { v -= res + bit; res = (res >> 1) + bit; }
+      else res >>= 1;
+      bit >>= 2;
+    }
+    return uint32_t(v > res ? res + 1 : res);
+  }
+
+  // Rate reached after accelerating from r0 at a for the given steps: sqrt(r0^2 + 2 * a * steps)
+  inline uint32_t final_rate(const uint32_t r0, const uint32_t a, const uint32_t steps) {
+    return isqrt(uint64_t(r0) * r0 + 2 * uint64_t(a) * steps);
+  }
+
+  // Timer ticks taken to change rate by 'delta' at a: delta * timer_rate / a
+  inline uint32_t accel_ticks(const uint32_t delta, const uint32_t timer_rate, const recip_t &rc) {
+    return uint32_t(mul_recip(uint64_t(delta) * timer_rate, rc));
+  }
+
+} // namespace PlannerFixed
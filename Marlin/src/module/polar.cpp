@@ -42,6 +42,7 @@
 #include "polar.h"
 #include "motion.h"
 #include "planner.h"
+#include "../libs/fast_trig.h"
 
 #include "../inc/MarlinConfig.h"
 
@@ -65,7 +66,7 @@ void forward_kinematics(const float r, const float theta) {
 void inverse_kinematics(const xyz_pos_t &raw) {
     const float x = raw.x, y = raw.y,
                 rawRadius = HYPOT(x,y),
-                posTheta = DEGREES(ATAN2(y, x));
+                posTheta = DEGREES(KIN_ATAN2(y, x));
 
     static float current_polar_theta = 0;
 
@@ -75,7 +76,7 @@ void inverse_kinematics(const xyz_pos_t &raw) {
 
     if (polar_center_offset > 0.0) {
       const float offsetRadius = SQRT(ABS(sq(r) - sq(polar_center_offset)));
-      float offsetTheta = absoluteAngle(DEGREES(ATAN2(polar_center_offset, offsetRadius)));
+      float offsetTheta = absoluteAngle(DEGREES(KIN_ATAN2(polar_center_offset, offsetRadius)));
       theta = absoluteAngle(offsetTheta + theta);
     }
 
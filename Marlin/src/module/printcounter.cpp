@@ -68,6 +68,11 @@ PrintCounter print_job_timer;   // Global Print Job Timer instance
 
 printStatistics PrintCounter::data;
 
+#if ENABLED(PRINTCOUNTER_JOB_STATS)
+  jobStatistics PrintCounter::job;
+  #define NO_LAYER_Z -999.0f
+#endif
+
 const PrintCounter::eeprom_address_t PrintCounter::address = STATS_EEPROM_ADDRESS;
 
 millis_t PrintCounter::lastDuration;
@@ -88,6 +93,32 @@ millis_t PrintCounter::deltaDuration() {
     if (!isLoaded()) return;
 
     data.filamentUsed += amount; // mm
+
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      job.filamentUsed += amount;
+      // The first extrusion above the current layer starts a new one
+      if (amount > 0 && job.moveZ > job.layerZ && isRunning()) {
+        const millis_t now = duration();
+        if (job.layers) {
+          job.lastLayer = now - job.layerStart;
+          NOLESS(job.longestLayer, job.lastLayer);
+        }
+        job.layers++;
+        job.layerStart = now;
+        job.layerZ = job.moveZ;
+      }
+    #endif
+  }
+#endif
+
+#if ENABLED(PRINTCOUNTER_JOB_STATS)
+  void PrintCounter::resumeJob(const float filament, const uint16_t layers) {
+    job.filamentUsed = filament;
+    job.layers = layers;
+    job.layerStart = duration();
+    job.layerZ = job.moveZ;         // The layer being resumed
+    data.filamentUsed += filament;
+    data.totalPrints++;
   }
 #endif
 
@@ -223,6 +254,21 @@ void PrintCounter::showStats() {
 
   SERIAL_EOL();
 
+  #if ENABLED(PRINTCOUNTER_JOB_STATS)
+    // The current job, or the last one
+    const millis_t job_time = duration();
+    SERIAL_ECHOPGM(STR_STATS "Job: ", duration_t(job_time).toString(buffer));
+    #if HAS_EXTRUDERS
+      SERIAL_ECHOPGM(", Filament: ", job.filamentUsed / 1000, "m, Average: ", job_time ? job.filamentUsed * 60 / job_time : 0.0f, "mm/min");
+    #endif
+    SERIAL_ECHOPGM(", Layers: ", job.layers);
+    if (job.layers > 1) {
+      SERIAL_ECHOPGM(", Last layer: ", duration_t(job.lastLayer).toString(buffer));
+      SERIAL_ECHOPGM(", Longest layer: ", duration_t(job.longestLayer).toString(buffer));
+    }
+    SERIAL_EOL();
+  #endif
+
   #if SERVICE_INTERVAL_1 > 0
     _service_when(buffer, PSTR(SERVICE_NAME_1), data.nextService1);
   #endif
@@ -278,6 +324,10 @@ bool PrintCounter::start() {
     if (!paused) {
       data.totalPrints++;
       lastDuration = 0;
+      #if ENABLED(PRINTCOUNTER_JOB_STATS)
+        job = { 0 };
+        job.layerZ = job.moveZ = NO_LAYER_Z;
+      #endif
     }
     return true;
   }
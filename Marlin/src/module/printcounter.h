@@ -51,6 +51,18 @@ struct printStatistics {    // 16 bytes
   #endif
 };
 
+#if ENABLED(PRINTCOUNTER_JOB_STATS)
+  struct jobStatistics {
+    float    filamentUsed;    // Filament used by this job in mm
+    uint16_t layers;          // Layers started, counted by extruding above the last layer
+    millis_t layerStart,      // Print time when the current layer started
+             lastLayer,       // Print time of the last complete layer
+             longestLayer;    // Print time of the longest layer
+    float    layerZ,          // Z of the current layer
+             moveZ;           // Z of the last move to a new Z
+  };
+#endif
+
 class PrintCounter: public Stopwatch {
   private:
     typedef Stopwatch super;
@@ -58,6 +70,10 @@ class PrintCounter: public Stopwatch {
 
     static printStatistics data;
 
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      static jobStatistics job;
+    #endif
+
     /**
      * @brief EEPROM address
      * @details Defines the start offset address where the data is stored.
@@ -131,6 +147,28 @@ class PrintCounter: public Stopwatch {
       static void incFilamentUsed(float const &amount);
     #endif
 
+    #if ENABLED(PRINTCOUNTER_JOB_STATS)
+      /**
+       * @brief Note a move to a new Z
+       * @details The next extrusion above the current layer starts a new layer.
+       *
+       * @param z The Z of the move
+       */
+      static void zMove(const float z) { job.moveZ = z; }
+
+      /**
+       * @brief Continue a job after power-loss recovery
+       * @details Restore the job's filament and layers, which were never saved
+       * to EEPROM, and count the job again.
+       */
+      static void resumeJob(const float filament, const uint16_t layers);
+
+      /**
+       * @brief Return the statistics of the current or last job
+       */
+      static jobStatistics getJobStats() { return job; }
+    #endif
+
     /**
      * @brief Reset the Print Statistics
      * @details Reset the statistics to zero and saves them to EEPROM creating
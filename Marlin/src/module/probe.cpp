@@ -71,6 +71,10 @@
   #endif
 #endif
 
+#if ANY(PROBE_PIPELINED_TRAVEL, PROBE_DEPLOY_IN_TRAVEL)
+  #include "planner.h"
+#endif
+
 #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
   #include "../feature/backlash.h"
 #endif
@@ -128,10 +132,29 @@ static float probe_safe_clearance_for_z(const float requested_clearance) {
   return requested_clearance;
 }
 
+#if ENABLED(PROBE_ADAPTIVE_APPROACH)
+  // Retract before the slow probe, learned from the previous point
+  static float probe_approach = Z_CLEARANCE_MULTI_PROBE;
+#endif
+
 Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load
 
+#if ENABLED(PROBE_PIPELINED_TRAVEL)
+  static bool pipelined_lift,   // The last probe only lifted, so raise during the next travel
+              tared_in_travel;  // The probe was tared during the travel to this point
+#endif
+
+#if ENABLED(PROBE_DEPLOY_IN_TRAVEL)
+  // The nozzle height set_deployed raises to before a deploy or stow
+  static float probe_deploy_height() {
+    float zdest = DIFF_TERN(HAS_HOTEND_OFFSET, Z_CLEARANCE_DEPLOY_PROBE, hotend_offset[active_extruder].z);
+    if (Probe::offset.z < 0) zdest -= Probe::offset.z;
+    return _MIN(zdest, Z_MAX_POS);
+  }
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #else
@@ -1023,6 +1046,10 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
       }
     #endif
 
+    #if ENABLED(PROBE_PIPELINED_TRAVEL)
+      if (tared_in_travel) { tared_in_travel = false; return false; }
+    #endif
+
     SERIAL_ECHOLNPGM("Taring probe");
     SERIAL_ECHOLNPGM("DBG_PROBE: toggling PROBE_TARE_PIN");
     WRITE(PROBE_TARE_PIN, PROBE_TARE_STATE);
@@ -1089,6 +1116,9 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const float z_min_poi
     // Do a first probe at the fast speed
     const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s),              // No probe trigger?
                early_fail = (scheck && current_position.z > zoffs + error_tolerance); // Probe triggered too high?
+    #if ENABLED(PROBE_ADAPTIVE_APPROACH)
+      if (probe_fail || early_fail) probe_approach = Z_CLEARANCE_MULTI_PROBE;
+    #endif
     #if ENABLED(DEBUG_LEVELING_FEATURE)
       if (DEBUGGING(LEVELING) && (probe_fail || early_fail)) {
         DEBUG_ECHOPGM(" Probe fail! - ");
@@ -1120,7 +1150,14 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const float z_min_poi
 
     // Raise to give the probe clearance
     const float clearance_needed = probe_safe_clearance_for_z(Z_CLEARANCE_MULTI_PROBE);
-    do_z_clearance(z1 + clearance_needed, true);
+    #if ENABLED(PROBE_ADAPTIVE_APPROACH)
+      // Raise only as far as the previous point needed, then approach slowly from there
+      const float retract = _MIN(probe_safe_clearance_for_z(probe_approach), clearance_needed);
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Slow Approach:", retract);
+      do_z_clearance(z1 + retract, true);
+    #else
+      do_z_clearance(z1 + clearance_needed, true);
+    #endif
 
   #elif Z_PROBE_FEEDRATE_FAST != Z_PROBE_FEEDRATE_SLOW
 
@@ -1209,12 +1246,37 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const float z_min_poi
 
   #elif TOTAL_PROBING == 2
 
-    const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+    #if ENABLED(PROBE_ADAPTIVE_APPROACH)
+
+      float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+
+      // Triggered with hardly any travel? The probe never released, so retry from full clearance.
+      if (retract < clearance_needed && z1 + retract - z2 < (PROBE_APPROACH_MIN) * 0.5f) {
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Probe not released. Retry from ", clearance_needed);
+        do_z_clearance(z1 + clearance_needed, true);
+        if (TERN0(PROBE_TARE, tare())) return NAN;
+        if (try_to_probe(PSTR("SLOW"), z_probe_low_point, z_probe_slow_mm_s, sanity_check)) return NAN;
+        z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      }
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", z1 - z2);
+
+      // The next point only needs to clear the fast probe overshoot, with some margin
+      probe_approach = _MAX(ABS(z1 - z2) * (PROBE_APPROACH_FACTOR), PROBE_APPROACH_MIN);
 
-    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", z1 - z2);
+      // The fast probe only bounds the contact height. Return the slow probe.
+      const float measured_z = z2;
 
-    // Return a weighted average of the fast and slow probes
-    const float measured_z = (z2 * 3.0f + z1 * 2.0f) * 0.2f;
+    #else
+
+      const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", z1 - z2);
+
+      // Return a weighted average of the fast and slow probes
+      const float measured_z = (z2 * 3.0f + z1 * 2.0f) * 0.2f;
+
+    #endif
 
   #else
 
@@ -1306,6 +1368,45 @@ float Probe::probe_at_point(
   }
   if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM(" point");
 
+  #if ENABLED(PROBE_DEPLOY_IN_TRAVEL)
+    bool deployed_in_travel = false, deploy_failed = false;
+  #endif
+
+  #if ENABLED(PROBE_PIPELINED_TRAVEL)
+    if (pipelined_lift) {
+      pipelined_lift = false;
+
+      // Rise to the clearance for probing along the way to the point
+      float zdest = probe_safe_clearance_for_z(z_clearance);
+      if (offset.z < 0) zdest -= offset.z;
+      NOMORE(zdest, Z_MAX_POS);
+      NOLESS(npos.z, zdest);
+
+      // One move from the lifted position. Tare while it runs.
+      current_position.set(npos.x, npos.y, npos.z);
+      line_to_current_position(feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+      tared_in_travel = TERN0(PROBE_TARE, !tare());
+      planner.synchronize();
+    }
+    else
+  #endif
+  #if ENABLED(PROBE_DEPLOY_IN_TRAVEL)
+    if (!endstops.z_probe_enabled) {
+      // Travel at the deploy height and deploy along the way, so the
+      // deploy delay runs during the move. deploy() waits for the move.
+      NOLESS(npos.z, probe_deploy_height());
+
+      #if ENABLED(BLTOUCH)
+        if (bltouch.triggered()) bltouch._reset(); // Clear an alarm before deploying
+      #endif
+
+      current_position.set(npos.x, npos.y, npos.z);
+      line_to_current_position(feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+      deploy_failed = deploy();
+      deployed_in_travel = true;
+    }
+    else
+  #endif
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
@@ -1331,12 +1432,12 @@ float Probe::probe_at_point(
       // Now at the safe_z if it is still triggered it may be in an alarm
       // condition.  Reset to clear alarm has a side effect of stowing the probe,
       // which the following deploy will handle.
-      if (bltouch.triggered()) bltouch._reset();
+      if (!TERN0(PROBE_DEPLOY_IN_TRAVEL, deployed_in_travel) && bltouch.triggered()) bltouch._reset();
     #endif
 
     // Debug: capture deploy() result and probe trigger state to diagnose failures
     {
-      const bool did_deploy = deploy();
+      const bool did_deploy = TERN0(PROBE_DEPLOY_IN_TRAVEL, deployed_in_travel) ? TERN0(PROBE_DEPLOY_IN_TRAVEL, deploy_failed) : deploy();
       // Always print deploy() return so it's visible in any build
       SERIAL_ECHOLNPGM("DBG_PROBE: deploy() returned:", did_deploy ? 1 : 0);
       #if ENABLED(BLTOUCH)
@@ -1377,8 +1478,23 @@ float Probe::probe_at_point(
             do_z_clearance(probe_safe_clearance_for_z(z_clearance));
           break;
         case PROBE_PT_STOW: case PROBE_PT_LAST_STOW:
+          #if ENABLED(PROBE_DEPLOY_IN_TRAVEL)
+            // Stow while rising to the deploy height
+            if (current_position.z < probe_deploy_height()) {
+              current_position.z = probe_deploy_height();
+              line_to_current_position(z_probe_fast_mm_s);
+            }
+          #endif
           if (stow()) measured_z = NAN;   // Error on stow?
           break;
+        #if ENABLED(PROBE_PIPELINED_TRAVEL)
+          case PROBE_PT_LIFT:
+            // Queue a short lift without waiting for it
+            current_position.z += PROBE_PIPELINE_LIFT;
+            line_to_current_position(homing_feedrate(Z_AXIS));
+            pipelined_lift = true;
+            break;
+        #endif
       }
     }
 
@@ -1410,6 +1526,8 @@ float Probe::probe_at_point(
   // Restore the Z homing current
   TERN_(PROBING_USE_CURRENT_HOME, restore_homing_current(Z_AXIS));
 
+  TERN_(PROBE_PIPELINED_TRAVEL, tared_in_travel = false);
+
   return measured_z;
 }
 
@@ -42,6 +42,9 @@
     PROBE_PT_STOW,      // Do a complete stow after run_z_probe
     PROBE_PT_LAST_STOW, // Stow for sure, even in BLTouch HS mode
     PROBE_PT_RAISE      // Raise to "between" clearance after run_z_probe
+    #if ENABLED(PROBE_PIPELINED_TRAVEL)
+      , PROBE_PT_LIFT   // Lift PROBE_PIPELINE_LIFT and leave the raise to the next probe_at_point
+    #endif
   };
 #endif
 
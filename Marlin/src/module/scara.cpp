@@ -31,6 +31,7 @@
 #include "scara.h"
 #include "motion.h"
 #include "planner.h"
+#include "../libs/fast_trig.h"
 
 #if ENABLED(AXEL_TPARA)
   #include "endstops.h"
@@ -122,10 +123,10 @@ float segments_per_second = DEFAULT_SEGMENTS_PER_SECOND;
     SK2 = L2 * S2;
 
     // Angle of Arm1 is the difference between Center-to-End angle and the Center-to-Elbow
-    THETA = ATAN2(SK1, SK2) - ATAN2(spos.x, spos.y);
+    THETA = KIN_ATAN2(SK1, SK2) - KIN_ATAN2(spos.x, spos.y);
 
     // Angle of Arm2
-    PSI = ATAN2(S2, C2);
+    PSI = KIN_ATAN2(S2, C2);
 
     delta.set(DEGREES(THETA), DEGREES(SUM_TERN(MORGAN_SCARA, PSI, THETA)), raw.z);
 
@@ -163,9 +164,9 @@ float segments_per_second = DEFAULT_SEGMENTS_PER_SECOND;
 
   void inverse_kinematics(const xyz_pos_t &raw) {
     const float x = raw.x, y = raw.y, c = HYPOT(x, y),
-                THETA3 = ATAN2(y, x),
-                THETA1 = THETA3 + ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
-                THETA2 = THETA3 - ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
+                THETA3 = KIN_ATAN2(y, x),
+                THETA1 = THETA3 + KIN_ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
+                THETA2 = THETA3 - KIN_ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
 
     delta.set(DEGREES(THETA1), DEGREES(THETA2), raw.z);
 
@@ -278,15 +279,15 @@ float segments_per_second = DEFAULT_SEGMENTS_PER_SECOND;
                 K2 = L2 * SG,
 
                 // Angle of Body Joint
-                THETA = ATAN2(spos.y, spos.x),
+                THETA = KIN_ATAN2(spos.y, spos.x),
 
                 // Angle of Elbow Joint
                 //GAMMA = ACOS(CG),
-                GAMMA = ATAN2(SG, CG), // Method 2
+                GAMMA = KIN_ATAN2(SG, CG), // Method 2
 
                 // Angle of Shoulder Joint, elevation angle measured from horizontal (r+)
                 //PHI = asin(spos.z/RHO) + asin(L2 * sin(GAMMA) / RHO),
-                PHI = ATAN2(spos.z, RXY) + ATAN2(K2, K1),   // Method 2
+                PHI = KIN_ATAN2(spos.z, RXY) + KIN_ATAN2(K2, K1),   // Method 2
 
                 // Elbow motor angle measured from horizontal, same frame as shoulder  (r+)
                 PSI = PHI + GAMMA;
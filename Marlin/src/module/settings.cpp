@@ -78,6 +78,14 @@
   #include "../feature/z_stepper_align.h"
 #endif
 
+#if ENABLED(LOOP_LATENCY_MONITOR)
+  #include "../feature/loop_latency.h"
+#endif
+
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
 #if ENABLED(DWIN_LCD_PROUI)
   #include "../lcd/e3v2/proui/dwin.h"
   #include "../lcd/e3v2/proui/bedlevel_tools.h"
@@ -218,6 +226,9 @@ typedef struct SettingsDataStruct {
     uint32_t build_hash;                                // Unique build hash
   #endif
   uint16_t  crc;                                        // Data Checksum for validation
+  #if ENABLED(EEPROM_LAZY_LOAD)
+    uint16_t mesh_crc;                                  // Bilinear mesh Checksum, checked on first use
+  #endif
   uint16_t  data_size;                                  // Data Size for validation
 
   //
@@ -305,7 +316,7 @@ typedef struct SettingsDataStruct {
   uint16_t grid_check;                                  // Hash to check against X/Y
   xy_pos_t bilinear_grid_spacing, bilinear_start;       // G29 L F
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-    bed_mesh_t z_values;                                // G29
+    TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bed_mesh_t) z_values; // G29
   #else
     float z_values[3][3];
   #endif
@@ -667,14 +678,30 @@ typedef struct SettingsDataStruct {
   #if ENABLED(INPUT_SHAPING_X)
     float shaping_x_frequency,                          // M593 X F
           shaping_x_zeta;                               // M593 X D
+    #if HAS_MULTI_IMPULSE_SHAPING
+      shaping_type_t shaping_x_type;                    // M593 X T
+    #endif
   #endif
   #if ENABLED(INPUT_SHAPING_Y)
     float shaping_y_frequency,                          // M593 Y F
           shaping_y_zeta;                               // M593 Y D
+    #if HAS_MULTI_IMPULSE_SHAPING
+      shaping_type_t shaping_y_type;                    // M593 Y T
+    #endif
   #endif
   #if ENABLED(INPUT_SHAPING_Z)
     float shaping_z_frequency,                          // M593 Z F
           shaping_z_zeta;                               // M593 Z D
+    #if HAS_MULTI_IMPULSE_SHAPING
+      shaping_type_t shaping_z_type;                    // M593 Z T
+    #endif
+  #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    float shaping_e_frequency,                          // M593 E F
+          shaping_e_zeta;                               // M593 E D
+    #if HAS_MULTI_IMPULSE_SHAPING
+      shaping_type_t shaping_e_type;                    // M593 E T
+    #endif
   #endif
 
   //
@@ -691,6 +718,13 @@ typedef struct SettingsDataStruct {
     nonlinear_settings_t stepper_ne_settings;           // M592 S A B C
   #endif
 
+  //
+  // Buffer Arena
+  //
+  #if ENABLED(BUFFER_ARENA)
+    uint8_t planner_arena_blocks;                       // M227 B
+  #endif
+
   //
   // MMU3
   //
@@ -895,9 +929,40 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
   #endif
 
   bool MarlinSettings::validating;
+  #if ENABLED(EEPROM_LAZY_LOAD)
+    bool MarlinSettings::mesh_pending; // = false
+  #endif
   int MarlinSettings::eeprom_index;
   uint16_t MarlinSettings::working_crc;
 
+  #if ENABLED(EEPROM_SECTION_SAVE)
+
+    bool MarlinSettings::stored_valid; // = false
+    int MarlinSettings::section_start, MarlinSettings::section_end; // = 0
+
+    /**
+     * Write the part of a value that falls within the section and skip the rest.
+     * The CRC is linear, so CRC(new) = CRC(old) ^ CRC(old ^ new). Accumulate the
+     * CRC of the changes here, with zeros for all the bytes outside the section,
+     * so only the section itself has to be read back from the EEPROM.
+     */
+    void MarlinSettings::section_write(const uint8_t *value, size_t size) {
+      while (size--) {
+        const uint8_t v = *value++;
+        uint8_t delta = 0;
+        if (WITHIN(eeprom_index, section_start, section_end - 1)) {
+          uint8_t old;
+          persistentStore.read_data(eeprom_index, &old);
+          delta = old ^ v;
+          if (delta) persistentStore.write_data(eeprom_index, v);
+        }
+        crc16(&working_crc, &delta, 1);
+        eeprom_index++;
+      }
+    }
+
+  #endif
+
   EEPROM_Error MarlinSettings::size_error(const uint16_t size) {
     if (size != datasize()) {
       DEBUG_WARN_MSG("EEPROM datasize error."
@@ -914,8 +979,13 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
    * M500 - Store Configuration
    */
   bool MarlinSettings::save() {
+    TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(EEPROM));
+    TERN_(FLIGHT_RECORDER, FLIGHT_SCOPE(EEPROM_WRITE, 0, true));
+
     float dummyf = 0;
 
+    TERN_(EEPROM_LAZY_LOAD, lazy_load_mesh()); // Don't overwrite the stored mesh with an empty one
+
     if (!EEPROM_START(EEPROM_OFFSET)) return false;
 
     EEPROM_Error eeprom_error = ERR_EEPROM_NOERR;
@@ -929,6 +999,9 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     #endif
 
     EEPROM_SKIP(working_crc);   // Skip the checksum slot
+    #if ENABLED(EEPROM_LAZY_LOAD)
+      EEPROM_SKIP(working_crc); // Skip the mesh checksum slot
+    #endif
 
     //
     // Clear after skipping CRC and before writing the CRC'ed data
@@ -1126,6 +1199,11 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     //
     // Bilinear Auto Bed Leveling
     //
+    #if ENABLED(EEPROM_LAZY_LOAD)
+      // The mesh has its own CRC so it can be skipped at boot
+      const uint16_t settings_crc = working_crc;
+      working_crc = 0;
+    #endif
     {
       #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
         static_assert(
@@ -1152,13 +1230,21 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         EEPROM_WRITE(bilinear_start);
       #endif
 
-      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      #if ALL(AUTO_BED_LEVELING_BILINEAR, OPTIMIZED_MESH_STORAGE)
+        mesh_store_t z_mesh_store;
+        set_store_from_mesh(bedlevel.z_values, z_mesh_store);
+        EEPROM_WRITE(z_mesh_store);                   // 1 float, 9-256 shorts
+      #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
         EEPROM_WRITE(bedlevel.z_values);              // 9-256 floats
       #else
         dummyf = 0;
         for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_WRITE(dummyf);
       #endif
     }
+    #if ENABLED(EEPROM_LAZY_LOAD)
+      const uint16_t mesh_crc = working_crc;
+      working_crc = settings_crc;
+    #endif
 
     //
     // X Axis Twist Compensation
@@ -1831,14 +1917,22 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
       #if ENABLED(INPUT_SHAPING_X)
         EEPROM_WRITE(stepper.get_shaping_frequency(X_AXIS));
         EEPROM_WRITE(stepper.get_shaping_damping_ratio(X_AXIS));
+        TERN_(HAS_MULTI_IMPULSE_SHAPING, EEPROM_WRITE(stepper.get_shaping_type(X_AXIS)));
       #endif
       #if ENABLED(INPUT_SHAPING_Y)
         EEPROM_WRITE(stepper.get_shaping_frequency(Y_AXIS));
         EEPROM_WRITE(stepper.get_shaping_damping_ratio(Y_AXIS));
+        TERN_(HAS_MULTI_IMPULSE_SHAPING, EEPROM_WRITE(stepper.get_shaping_type(Y_AXIS)));
       #endif
       #if ENABLED(INPUT_SHAPING_Z)
         EEPROM_WRITE(stepper.get_shaping_frequency(Z_AXIS));
         EEPROM_WRITE(stepper.get_shaping_damping_ratio(Z_AXIS));
+        TERN_(HAS_MULTI_IMPULSE_SHAPING, EEPROM_WRITE(stepper.get_shaping_type(Z_AXIS)));
+      #endif
+      #if ENABLED(INPUT_SHAPING_E)
+        EEPROM_WRITE(stepper.get_shaping_frequency(E_AXIS));
+        EEPROM_WRITE(stepper.get_shaping_damping_ratio(E_AXIS));
+        TERN_(HAS_MULTI_IMPULSE_SHAPING, EEPROM_WRITE(stepper.get_shaping_type(E_AXIS)));
       #endif
     #endif
 
@@ -1856,6 +1950,13 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
       EEPROM_WRITE(stepper.ne.settings);
     #endif
 
+    //
+    // Buffer Arena
+    //
+    #if ENABLED(BUFFER_ARENA)
+      EEPROM_WRITE(planner.arena_blocks);
+    #endif
+
     //
     // MMU3
     //
@@ -1876,6 +1977,33 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     //
     // Report final CRC and Data Size
     //
+    #if ENABLED(EEPROM_SECTION_SAVE)
+      if (section_end) {
+        if (eeprom_error == ERR_EEPROM_NOERR) {
+          // Apply the CRC of the changes to the stored CRC. The rest of the header is unchanged.
+          const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET);
+          uint16_t stored_crc;
+          persistentStore.read_data(EEPROM_OFFSETOF(crc), (uint8_t*)&stored_crc, sizeof(stored_crc));
+          const uint16_t final_crc = stored_crc ^ working_crc;
+          if (final_crc != stored_crc)
+            persistentStore.write_data(EEPROM_OFFSETOF(crc), (uint8_t*)&final_crc, sizeof(final_crc));
+          #if ENABLED(EEPROM_LAZY_LOAD)
+            if (mesh_crc) {
+              uint16_t stored_mesh_crc;
+              persistentStore.read_data(EEPROM_OFFSETOF(mesh_crc), (uint8_t*)&stored_mesh_crc, sizeof(stored_mesh_crc));
+              stored_mesh_crc ^= mesh_crc;
+              persistentStore.write_data(EEPROM_OFFSETOF(mesh_crc), (uint8_t*)&stored_mesh_crc, sizeof(stored_mesh_crc));
+            }
+          #endif
+          DEBUG_ECHO_MSG("Section Stored (", section_end - section_start, " bytes; crc ", (uint32_t)final_crc, ")");
+          eeprom_error = size_error(eeprom_size);
+        }
+        EEPROM_FINISH();
+        stored_valid = (eeprom_error == ERR_EEPROM_NOERR);
+        return stored_valid;
+      }
+    #endif
+
     if (eeprom_error == ERR_EEPROM_NOERR) {
       const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET),
                      final_crc = working_crc;
@@ -1888,6 +2016,7 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         EEPROM_WRITE(build_hash);
       #endif
       EEPROM_WRITE(final_crc);
+      TERN_(EEPROM_LAZY_LOAD, EEPROM_WRITE(mesh_crc));
 
       // Report storage size
       DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
@@ -1905,6 +2034,7 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     #endif
 
     const bool success = (eeprom_error == ERR_EEPROM_NOERR);
+    TERN_(EEPROM_SECTION_SAVE, stored_valid = success);
     if (success) {
       LCD_MESSAGE(MSG_SETTINGS_STORED);
       TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_SETTINGS_STORED)));
@@ -1915,6 +2045,42 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     return success;
   }
 
+  #if ENABLED(EEPROM_SECTION_SAVE)
+
+    #define SECTION_RANGE(FIRST, LAST) do{ section_start = EEPROM_OFFSETOF(FIRST); section_end = EEPROM_OFFSETOF(LAST) + sizeof(SettingsData::LAST); }while(0)
+
+    /**
+     * Save a single section of the settings, e.g., after a Z offset change or PID autotune.
+     * Only the bytes of the section (and the CRC) are read and written, which is much
+     * quicker than a full save on an I2C EEPROM. Fall back to a full save if the stored
+     * data isn't known to be valid, since the new CRC is derived from the stored one.
+     */
+    bool MarlinSettings::save(const SettingsSection section) {
+      if (!stored_valid) return save();
+
+      switch (section) {
+        default: return save();
+        #if NUM_AXES
+          case SECTION_PROBE_OFFSET: SECTION_RANGE(probe_offset, m905_step_settle_ms); break;
+        #endif
+        #if ENABLED(MESH_BED_LEVELING)
+          case SECTION_MESH: SECTION_RANGE(mbl_z_offset, mbl_z_values); break;
+        #else
+          case SECTION_MESH: SECTION_RANGE(grid_max_x, z_values); break;
+        #endif
+        case SECTION_PID: SECTION_RANGE(hotendPID, chamberPID); break;
+        #if ENABLED(EXTENSIBLE_UI)
+          case SECTION_EXTUI: SECTION_RANGE(extui_data, extui_data); break;
+        #endif
+      }
+
+      const bool success = save();
+      section_start = section_end = 0;
+      return success;
+    }
+
+  #endif // EEPROM_SECTION_SAVE
+
   EEPROM_Error MarlinSettings::check_version() {
     if (!EEPROM_START(EEPROM_OFFSET)) return ERR_EEPROM_NOPROM;
     char stored_ver[4];
@@ -1967,6 +2133,9 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
       // Get the stored CRC to compare at the end
       //
       EEPROM_READ_ALWAYS(stored_crc);
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        EEPROM_SKIP(stored_crc);                       // Mesh CRC, checked by _load_mesh
+      #endif
 
       //
       // A temporary float for safe storage
@@ -2201,6 +2370,10 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
       //
       // Bilinear Auto Bed Leveling
       //
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        // Skip the mesh for now. It has its own CRC and is loaded on first use.
+        eeprom_index = EEPROM_OFFSETOF(z_values) + sizeof(SettingsData::z_values);
+      #else
       {
         uint8_t grid_max_x, grid_max_y;
         EEPROM_READ_ALWAYS(grid_max_x);                // 1 byte
@@ -2221,7 +2394,13 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
           if (grid_max_x == (GRID_MAX_POINTS_X) && grid_max_y == (GRID_MAX_POINTS_Y)) {
             if (!validating) set_bed_leveling_enabled(false);
             bedlevel.set_grid(spacing, start);
-            EEPROM_READ(bedlevel.z_values);            // 9 to 256 floats
+            #if ENABLED(OPTIMIZED_MESH_STORAGE)
+              mesh_store_t z_mesh_store;
+              EEPROM_READ(z_mesh_store);               // 1 float, 9 to 256 shorts
+              if (!validating) set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+            #else
+              EEPROM_READ(bedlevel.z_values);          // 9 to 256 floats
+            #endif
           }
           else if (grid_max_x > (GRID_MAX_POINTS_X) || grid_max_y > (GRID_MAX_POINTS_Y)) {
             eeprom_error = ERR_EEPROM_CORRUPT;
@@ -2231,9 +2410,16 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         #endif // AUTO_BED_LEVELING_BILINEAR
           {
             // Skip past disabled (or stale) Bilinear Grid data
-            for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
+            #if ALL(AUTO_BED_LEVELING_BILINEAR, OPTIMIZED_MESH_STORAGE)
+              int16_t dummys;
+              EEPROM_READ(dummyf);
+              for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummys);
+            #else
+              for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
+            #endif
           }
       }
+      #endif // !EEPROM_LAZY_LOAD
 
       //
       // X Axis Twist Compensation
@@ -2289,7 +2475,7 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         #if ENABLED(PTC_HOTEND)
           EEPROM_READ(ptc.z_offsets_hotend);
         #endif
-        if (!validating) ptc.reset_index();
+        if (!validating) { ptc.reset_index(); TERN_(PTC_POLYNOMIAL, ptc.fit_all()); }
       #else
         // No placeholder data for this feature
       #endif
@@ -2968,9 +3154,10 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
       //
       #if ENABLED(INPUT_SHAPING_X)
       {
-        struct { float freq, damp; } _data;
+        struct { float freq, damp; OPTCODE(HAS_MULTI_IMPULSE_SHAPING, shaping_type_t type) } _data;
         EEPROM_READ(_data);
         if (!validating) {
+          TERN_(HAS_MULTI_IMPULSE_SHAPING, if (_data.type < SHAPING_TYPE_COUNT) stepper.set_shaping_type(X_AXIS, _data.type));
           stepper.set_shaping_frequency(X_AXIS, _data.freq);
           stepper.set_shaping_damping_ratio(X_AXIS, _data.damp);
         }
@@ -2979,9 +3166,10 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
 
       #if ENABLED(INPUT_SHAPING_Y)
       {
-        struct { float freq, damp; } _data;
+        struct { float freq, damp; OPTCODE(HAS_MULTI_IMPULSE_SHAPING, shaping_type_t type) } _data;
         EEPROM_READ(_data);
         if (!validating) {
+          TERN_(HAS_MULTI_IMPULSE_SHAPING, if (_data.type < SHAPING_TYPE_COUNT) stepper.set_shaping_type(Y_AXIS, _data.type));
           stepper.set_shaping_frequency(Y_AXIS, _data.freq);
           stepper.set_shaping_damping_ratio(Y_AXIS, _data.damp);
         }
@@ -2990,15 +3178,28 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
 
       #if ENABLED(INPUT_SHAPING_Z)
       {
-        struct { float freq, damp; } _data;
+        struct { float freq, damp; OPTCODE(HAS_MULTI_IMPULSE_SHAPING, shaping_type_t type) } _data;
         EEPROM_READ(_data);
         if (!validating) {
+          TERN_(HAS_MULTI_IMPULSE_SHAPING, if (_data.type < SHAPING_TYPE_COUNT) stepper.set_shaping_type(Z_AXIS, _data.type));
           stepper.set_shaping_frequency(Z_AXIS, _data.freq);
           stepper.set_shaping_damping_ratio(Z_AXIS, _data.damp);
         }
       }
       #endif
 
+      #if ENABLED(INPUT_SHAPING_E)
+      {
+        struct { float freq, damp; OPTCODE(HAS_MULTI_IMPULSE_SHAPING, shaping_type_t type) } _data;
+        EEPROM_READ(_data);
+        if (!validating) {
+          TERN_(HAS_MULTI_IMPULSE_SHAPING, if (_data.type < SHAPING_TYPE_COUNT) stepper.set_shaping_type(E_AXIS, _data.type));
+          stepper.set_shaping_frequency(E_AXIS, _data.freq);
+          stepper.set_shaping_damping_ratio(E_AXIS, _data.damp);
+        }
+      }
+      #endif
+
       //
       // HOTEND_IDLE_TIMEOUT
       //
@@ -3013,6 +3214,17 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         EEPROM_READ(stepper.ne.settings);
       #endif
 
+      //
+      // Buffer Arena (applied at the next boot)
+      //
+      #if ENABLED(BUFFER_ARENA)
+      {
+        uint8_t blocks;
+        EEPROM_READ(blocks);
+        if (!validating && WITHIN(blocks, BUFFER_ARENA_MIN_BLOCKS, BLOCK_BUFFER_SIZE)) planner.arena_blocks = blocks;
+      }
+      #endif
+
       //
       // MMU3
       //
@@ -3101,9 +3313,19 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
 
     EEPROM_FINISH();
 
+    TERN_(EEPROM_SECTION_SAVE, stored_valid = (eeprom_error == ERR_EEPROM_NOERR));
+
     switch (eeprom_error) {
       case ERR_EEPROM_NOERR:
-        if (!validating) postprocess();
+        if (!validating) {
+          #if ENABLED(EEPROM_LAZY_LOAD)
+            // No mesh until the stored one is needed
+            set_bed_leveling_enabled(false);
+            bedlevel.reset();
+            mesh_pending = true;
+          #endif
+          postprocess();
+        }
         break;
       case ERR_EEPROM_SIZE:
         DEBUG_ECHO_MSG("Index: ", eeprom_index - (EEPROM_OFFSET), " Size: ", datasize());
@@ -3148,6 +3370,61 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
     return (err == ERR_EEPROM_NOERR);
   }
 
+  #if ENABLED(EEPROM_LAZY_LOAD)
+
+    /**
+     * Read the bilinear mesh skipped by _load and check it against its own CRC.
+     * The grid size is already covered by the datasize check. Keep the empty
+     * mesh if the stored one is bad, since the other settings are still good.
+     */
+    void MarlinSettings::_load_mesh() {
+      mesh_pending = false;
+      if (!EEPROM_START(EEPROM_OFFSETOF(mesh_crc))) return;
+
+      uint16_t stored_crc;
+      EEPROM_READ_ALWAYS(stored_crc);
+
+      eeprom_index = EEPROM_OFFSETOF(grid_max_x);
+      working_crc = 0;
+
+      uint8_t grid_max_x, grid_max_y;
+      uint16_t grid_check;
+      xy_pos_t spacing, start;
+      EEPROM_READ_ALWAYS(grid_max_x);
+      EEPROM_READ_ALWAYS(grid_max_y);
+      EEPROM_READ_ALWAYS(grid_check);
+      EEPROM_READ_ALWAYS(spacing);
+      EEPROM_READ_ALWAYS(start);
+      #if ENABLED(OPTIMIZED_MESH_STORAGE)
+        mesh_store_t z_mesh_store;
+        EEPROM_READ_ALWAYS(z_mesh_store);
+      #else
+        bed_mesh_t z_values;
+        EEPROM_READ_ALWAYS(z_values);
+      #endif
+      EEPROM_FINISH();
+
+      if (working_crc != stored_crc) {
+        DEBUG_WARN_MSG("Mesh CRC mismatch - (stored) ", stored_crc, " != ", working_crc, " (calculated)!");
+        return;
+      }
+      if (grid_check != TWO_BYTE_HASH(grid_max_x, grid_max_y) || grid_max_x != (GRID_MAX_POINTS_X) || grid_max_y != (GRID_MAX_POINTS_Y)) {
+        DEBUG_WARN_MSG(STR_ERR_EEPROM_CORRUPT);
+        return;
+      }
+
+      bedlevel.set_grid(spacing, start);
+      #if ENABLED(OPTIMIZED_MESH_STORAGE)
+        set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+      #else
+        COPY(bedlevel.z_values, z_values);
+      #endif
+      bedlevel.refresh_bed_level();
+      DEBUG_ECHO_MSG("Mesh loaded (crc ", working_crc, ")");
+    }
+
+  #endif // EEPROM_LAZY_LOAD
+
   #if HAS_EARLY_LCD_SETTINGS
 
     #if HAS_LCD_CONTRAST
@@ -3169,6 +3446,8 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
   #endif // HAS_EARLY_LCD_SETTINGS
 
   bool MarlinSettings::load() {
+    TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(EEPROM));
+
     // If the EEPROM data is valid load it
     if (validate()) {
       const EEPROM_Error err = _load();
@@ -3233,8 +3512,8 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         uint16_t crc = 0;
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-          bedlevel.set_store_from_mesh(bedlevel.z_values, z_mesh_store);
+          mesh_store_t z_mesh_store;
+          set_store_from_mesh(bedlevel.z_values, z_mesh_store);
           uint8_t * const src = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const src = (uint8_t*)&bedlevel.z_values;
@@ -3269,7 +3548,7 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         int pos = mesh_slot_offset(slot);
         uint16_t crc = 0;
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+          mesh_store_t z_mesh_store;
           uint8_t * const dest = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&bedlevel.z_values;
@@ -3282,11 +3561,11 @@ uint16_t MarlinSettings::get_m905_step_settle_ms() {
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
           if (into) {
             float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-            bedlevel.set_mesh_from_store(z_mesh_store, z_values);
+            set_mesh_from_store(z_mesh_store, z_values);
             memcpy(into, z_values, sizeof(z_values));
           }
           else
-            bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+            set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
         #if ENABLED(DWIN_LCD_PROUI)
@@ -3509,6 +3788,7 @@ void MarlinSettings::reset() {
   //
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, new_z_fade_height = DEFAULT_LEVELING_FADE_HEIGHT);
   TERN_(HAS_LEVELING, reset_bed_level());
+  TERN_(EEPROM_LAZY_LOAD, mesh_pending = false);
 
   //
   // AUTOTEMP
@@ -3852,17 +4132,25 @@ void MarlinSettings::reset() {
   //
   #if HAS_ZV_SHAPING
     #if ENABLED(INPUT_SHAPING_X)
+      TERN_(HAS_MULTI_IMPULSE_SHAPING, stepper.set_shaping_type(X_AXIS, SHAPING_ZV));
       stepper.set_shaping_frequency(X_AXIS, SHAPING_FREQ_X);
       stepper.set_shaping_damping_ratio(X_AXIS, SHAPING_ZETA_X);
     #endif
     #if ENABLED(INPUT_SHAPING_Y)
+      TERN_(HAS_MULTI_IMPULSE_SHAPING, stepper.set_shaping_type(Y_AXIS, SHAPING_ZV));
       stepper.set_shaping_frequency(Y_AXIS, SHAPING_FREQ_Y);
       stepper.set_shaping_damping_ratio(Y_AXIS, SHAPING_ZETA_Y);
     #endif
     #if ENABLED(INPUT_SHAPING_Z)
+      TERN_(HAS_MULTI_IMPULSE_SHAPING, stepper.set_shaping_type(Z_AXIS, SHAPING_ZV));
       stepper.set_shaping_frequency(Z_AXIS, SHAPING_FREQ_Z);
       stepper.set_shaping_damping_ratio(Z_AXIS, SHAPING_ZETA_Z);
     #endif
+    #if ENABLED(INPUT_SHAPING_E)
+      TERN_(HAS_MULTI_IMPULSE_SHAPING, stepper.set_shaping_type(E_AXIS, SHAPING_ZV));
+      stepper.set_shaping_frequency(E_AXIS, SHAPING_FREQ_E);
+      stepper.set_shaping_damping_ratio(E_AXIS, SHAPING_ZETA_E);
+    #endif
   #endif
 
   //
@@ -3881,6 +4169,11 @@ void MarlinSettings::reset() {
   //
   TERN_(HOTEND_IDLE_TIMEOUT, hotend_idle.cfg.set_defaults());
 
+  //
+  // Buffer Arena
+  //
+  TERN_(BUFFER_ARENA, planner.arena_blocks = BLOCK_BUFFER_SIZE);
+
   postprocess();
 
   #if ANY(EEPROM_CHITCHAT, DEBUG_LEVELING_FEATURE)
@@ -4147,6 +4440,7 @@ void MarlinSettings::reset() {
     // Fixed-Time Motion
     //
     TERN_(FT_MOTION, gcode.M493_report(forReplay));
+    TERN_(FTM_CUSTOM_SHAPER, gcode.M495_report(forReplay));
 
     //
     // Nonlinear Extrusion
@@ -4211,6 +4505,11 @@ void MarlinSettings::reset() {
     //
     TERN_(MPCTEMP, gcode.M306_report(forReplay));
 
+    //
+    // Buffer Arena
+    //
+    TERN_(BUFFER_ARENA, gcode.M227_report(forReplay));
+
     //
     // MMU3
     //
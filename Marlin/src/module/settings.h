@@ -45,6 +45,21 @@ class MarlinSettings {
 
     static void reset();
     static bool save();    // Return 'true' if data was saved
+
+    #if ENABLED(EEPROM_SECTION_SAVE)
+      // Sections that can be saved on their own
+      enum SettingsSection : uint8_t {
+        SECTION_PROBE_OFFSET,   // M851 and M905
+        SECTION_MESH,           // Bilinear or MBL mesh
+        SECTION_PID,            // Hotend, bed and chamber PID
+        #if ENABLED(EXTENSIBLE_UI)
+          SECTION_EXTUI,        // ExtUI::onStoreSettings data
+        #endif
+        SECTION_COUNT
+      };
+      static bool save(const SettingsSection section); // Save only one section, or all if not known to be valid
+    #endif
+
     // Probe enable-off height helpers (M905)
     static void set_probe_en_off_height(const float v);
     static float get_probe_en_off_height();
@@ -82,6 +97,11 @@ class MarlinSettings {
         if (!loaded && load()) loaded = true;
       }
 
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        // Read and check the stored mesh the first time it's needed
+        static void lazy_load_mesh() { if (mesh_pending) _load_mesh(); }
+      #endif
+
       #if HAS_EARLY_LCD_SETTINGS
         // Special cases for LCD contrast and brightness, so
         // some LCDs can display bootscreens earlier in setup().
@@ -140,11 +160,21 @@ class MarlinSettings {
       #endif
 
       static EEPROM_Error _load();
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        static bool mesh_pending;                   // The stored mesh is not loaded yet
+        static void _load_mesh();
+      #endif
       static EEPROM_Error size_error(const uint16_t size);
 
       static int eeprom_index;
       static uint16_t working_crc;
 
+      #if ENABLED(EEPROM_SECTION_SAVE)
+        static bool stored_valid;                   // EEPROM was loaded or saved without error
+        static int section_start, section_end;      // Byte range of a section save. 0 to save all.
+        static void section_write(const uint8_t *value, size_t size);
+      #endif
+
       static bool EEPROM_START(int eeprom_offset) {
         if (!persistentStore.access_start()) { SERIAL_ECHO_MSG("No EEPROM."); return false; }
         eeprom_index = eeprom_offset;
@@ -159,6 +189,9 @@ class MarlinSettings {
 
       template<typename T>
       static void EEPROM_WRITE(const T &VAR) {
+        #if ENABLED(EEPROM_SECTION_SAVE)
+          if (section_end) return section_write((const uint8_t *) &VAR, sizeof(VAR));
+        #endif
         persistentStore.write_data(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR), &working_crc);
       }
 
@@ -92,6 +92,8 @@ Stepper stepper; // Singleton
 #include "stepper/cycles.h"
 #ifdef __AVR__
   #include "stepper/speed_lookuptable.h"
+#elif ENABLED(STEP_INTERVAL_TABLE)
+  #include "stepper/interval_table.h"
 #endif
 
 #include "endstops.h"
@@ -136,6 +138,20 @@ Stepper stepper; // Singleton
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(PLANNER_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+  #include "../feature/isr_profiler.h"
+#else
+  #define ISR_PROFILE(P, V...) V
+#endif
+
 #if HAS_CUTTER
   #include "../feature/spindle_laser.h"
 #endif
@@ -146,6 +162,12 @@ Stepper stepper; // Singleton
 
 #if ENABLED(I2S_STEPPER_STREAM)
   #include "../HAL/ESP32/i2s.h"
+  #define STREAM_PUSH_SAMPLE() i2s_push_sample()
+#elif ENABLED(STEP_DMA_STREAM)
+  #include "../HAL/STM32F1/step_stream.h"
+  #define STREAM_PUSH_SAMPLE() step_stream_push_sample()
+#else
+  #define STREAM_PUSH_SAMPLE() NOOP
 #endif
 
 // public:
@@ -194,7 +216,7 @@ uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
   uint8_t Stepper::steps_per_isr = 1; // Count of steps to perform per Stepper ISR call
 #endif
 
-#if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
+#if !HAS_RATE_MULTISTEPPING
   hal_timer_t Stepper::time_spent_in_isr = 0, Stepper::time_spent_out_isr = 0;
 #endif
 
@@ -260,6 +282,42 @@ uint32_t Stepper::advance_divisor = 0,
 #endif
 
 #if HAS_ZV_SHAPING
+  // No echoes are pending for any impulse
+  #if SHAPING_MAX_ECHOES == 3
+    #define SHAPING_PEEK_INIT { shaping_time_t(-1), shaping_time_t(-1), shaping_time_t(-1) }
+  #elif SHAPING_MAX_ECHOES == 2
+    #define SHAPING_PEEK_INIT { shaping_time_t(-1), shaping_time_t(-1) }
+  #else
+    #define SHAPING_PEEK_INIT { shaping_time_t(-1) }
+  #endif
+  #if HAS_MULTI_IMPULSE_SHAPING
+    #define SHAPING_ECHOES_DEF(AXIS) uint8_t ShapingQueue::echoes_##AXIS = 1;
+  #else
+    #define SHAPING_ECHOES_DEF(AXIS)
+  #endif
+#endif
+
+#if ALL(HAS_ZV_SHAPING, SHAPING_RUN_QUEUE)
+  shaping_time_t ShapingQueue::now = 0;
+
+  #define SHAPING_VAR_DEFS(AXIS)                                                        \
+    shaping_run_t   ShapingQueue::runs_##AXIS[shaping_runs];                            \
+    shaping_time_t  ShapingQueue::delay_##AXIS[SHAPING_MAX_ECHOES];                     \
+    shaping_time_t  ShapingQueue::_peek_##AXIS[SHAPING_MAX_ECHOES] = SHAPING_PEEK_INIT; \
+    shaping_time_t  ShapingQueue::head_time_##AXIS[SHAPING_MAX_ECHOES];                 \
+    shaping_time_t  ShapingQueue::next_time_##AXIS;                                     \
+    uint16_t        ShapingQueue::head_##AXIS[SHAPING_MAX_ECHOES] = { 0 };              \
+    uint16_t        ShapingQueue::tail_##AXIS = 0;                                      \
+    uint8_t         ShapingQueue::head_step_##AXIS[SHAPING_MAX_ECHOES] = { 0 };         \
+    uint16_t        ShapingQueue::_free_count_##AXIS = shaping_runs - 1;                \
+    SHAPING_ECHOES_DEF(AXIS)                                                            \
+    ShapeParams     Stepper::shaping_##AXIS;
+
+  TERN_(INPUT_SHAPING_X, SHAPING_VAR_DEFS(x))
+  TERN_(INPUT_SHAPING_Y, SHAPING_VAR_DEFS(y))
+  TERN_(INPUT_SHAPING_Z, SHAPING_VAR_DEFS(z))
+  TERN_(INPUT_SHAPING_E, SHAPING_VAR_DEFS(e))
+#elif HAS_ZV_SHAPING
   shaping_time_t      ShapingQueue::now = 0;
   #if ANY(MCU_LPC1768, MCU_LPC1769) && DISABLED(NO_LPC_ETHERNET_BUFFER)
     // Use the 16K LPC Ethernet buffer: https://github.com/MarlinFirmware/Marlin/issues/25432#issuecomment-1450420638
@@ -271,22 +329,30 @@ uint32_t Stepper::advance_divisor = 0,
   shaping_echo_axis_t ShapingQueue::echo_axes[shaping_echoes];
   uint16_t            ShapingQueue::tail = 0;
 
-  #define SHAPING_VAR_DEFS(AXIS)                                           \
-    shaping_time_t  ShapingQueue::delay_##AXIS;                            \
-    shaping_time_t  ShapingQueue::_peek_##AXIS = shaping_time_t(-1);       \
-    uint16_t        ShapingQueue::head_##AXIS = 0;                         \
-    uint16_t        ShapingQueue::_free_count_##AXIS = shaping_echoes - 1; \
+  #define SHAPING_VAR_DEFS(AXIS)                                                        \
+    shaping_time_t  ShapingQueue::delay_##AXIS[SHAPING_MAX_ECHOES];                     \
+    shaping_time_t  ShapingQueue::_peek_##AXIS[SHAPING_MAX_ECHOES] = SHAPING_PEEK_INIT; \
+    uint16_t        ShapingQueue::head_##AXIS[SHAPING_MAX_ECHOES] = { 0 };              \
+    uint16_t        ShapingQueue::_free_count_##AXIS = shaping_echoes - 1;              \
+    SHAPING_ECHOES_DEF(AXIS)                                                            \
     ShapeParams     Stepper::shaping_##AXIS;
 
   TERN_(INPUT_SHAPING_X, SHAPING_VAR_DEFS(x))
   TERN_(INPUT_SHAPING_Y, SHAPING_VAR_DEFS(y))
   TERN_(INPUT_SHAPING_Z, SHAPING_VAR_DEFS(z))
+  TERN_(INPUT_SHAPING_E, SHAPING_VAR_DEFS(e))
 #endif
 
 #if ENABLED(BABYSTEPPING)
   hal_timer_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(BACKLASH_STEPPER)
+  hal_timer_t Stepper::nextBacklashISR = BACKLASH_NEVER,
+              Stepper::backlash_interval; // = 0
+  xyz_long_t Stepper::backlash_pending{0};
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
@@ -298,6 +364,9 @@ hal_timer_t Stepper::ticks_nominal = 0;
 
 xyz_long_t Stepper::endstops_trigsteps;
 xyze_long_t Stepper::count_position{0};
+#if ENABLED(FILAMENT_MOTION_TRACKING)
+  volatile uint8_t Stepper::position_sets; // = 0
+#endif
 xyze_int8_t Stepper::count_direction{0};
 
 #define MINDIR(A) (count_direction[_AXIS(A)] < 0)
@@ -1498,7 +1567,7 @@ HAL_STEP_TIMER_ISR() {
 
   HAL_timer_isr_prologue(MF_TIMER_STEP);
 
-  Stepper::isr();
+  ISR_PROFILE(TOTAL, Stepper::isr());
 
   HAL_timer_isr_epilogue(MF_TIMER_STEP);
 }
@@ -1513,7 +1582,7 @@ HAL_STEP_TIMER_ISR() {
   FORCE_INLINE static constexpr int32_t MULT_Q(uint8_t q, int32_t x, int32_t y) { return (int64_t(x) * y) >> q; }
 #endif
 
-void Stepper::isr() {
+HAL_RAMFUNC void Stepper::isr() {
 
   static hal_timer_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
@@ -1567,22 +1636,26 @@ void Stepper::isr() {
 
     if (!using_ftMotion) {
 
-      TERN_(HAS_ZV_SHAPING, shaping_isr());               // Do Shaper stepping, if needed
+      TERN_(HAS_ZV_SHAPING, ISR_PROFILE(SHAPING, shaping_isr()));   // Do Shaper stepping, if needed
 
-      if (!nextMainISR) pulse_phase_isr();                // 0 = Do coordinated axes Stepper pulses
+      if (!nextMainISR) ISR_PROFILE(PULSE, pulse_phase_isr());      // 0 = Do coordinated axes Stepper pulses
 
       #if ENABLED(LIN_ADVANCE)
         if (!nextAdvanceISR) {                            // 0 = Do Linear Advance E Stepper pulses
-          advance_isr();
+          ISR_PROFILE(ADVANCE, advance_isr());
           nextAdvanceISR = la_interval;
         }
         else if (nextAdvanceISR > la_interval)            // Start/accelerate LA steps if necessary
           nextAdvanceISR = la_interval;
       #endif
 
+      #if ENABLED(BACKLASH_STEPPER)
+        if (!nextBacklashISR) nextBacklashISR = backlash_isr(); // 0 = Do a Backlash correction step
+      #endif
+
       #if ENABLED(BABYSTEPPING)
         const bool is_babystep = (nextBabystepISR == 0);  // 0 = Do Babystepping (XY)Z pulses
-        if (is_babystep) nextBabystepISR = babystepping_isr();
+        if (is_babystep) ISR_PROFILE(BABYSTEP, nextBabystepISR = babystepping_isr());
       #endif
 
       // Enable ISRs to reduce latency for higher priority ISRs, or all ISRs if no prioritization.
@@ -1590,7 +1663,7 @@ void Stepper::isr() {
 
       // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-      if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+      if (!nextMainISR) ISR_PROFILE(BLOCK, nextMainISR = block_phase_isr());  // Manage acc/deceleration, get next block
       #if ENABLED(SMOOTH_LIN_ADVANCE)
         if (!smoothLinAdvISR) smoothLinAdvISR = smooth_lin_adv_isr();  // Manage la
       #endif
@@ -1608,8 +1681,10 @@ void Stepper::isr() {
       TERN_(INPUT_SHAPING_X, NOMORE(interval, ShapingQueue::peek_x()));   // Time until next input shaping echo for X
       TERN_(INPUT_SHAPING_Y, NOMORE(interval, ShapingQueue::peek_y()));   // Time until next input shaping echo for Y
       TERN_(INPUT_SHAPING_Z, NOMORE(interval, ShapingQueue::peek_z()));   // Time until next input shaping echo for Z
+      TERN_(INPUT_SHAPING_E, NOMORE(interval, ShapingQueue::peek_e()));   // Time until next input shaping echo for E
       TERN_(LIN_ADVANCE, NOMORE(interval, nextAdvanceISR));               // Come back early for Linear Advance?
       TERN_(SMOOTH_LIN_ADVANCE, NOMORE(interval, smoothLinAdvISR));       // Come back early for Linear Advance rate update?
+      TERN_(BACKLASH_STEPPER, NOMORE(interval, nextBacklashISR));         // Come back early for Backlash correction?
       TERN_(BABYSTEPPING, NOMORE(interval, nextBabystepISR));             // Come back early for Babystepping?
 
       //
@@ -1623,6 +1698,7 @@ void Stepper::isr() {
       TERN_(HAS_ZV_SHAPING, ShapingQueue::decrement_delays(interval));
       TERN_(LIN_ADVANCE, if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval);
       TERN_(SMOOTH_LIN_ADVANCE, if (smoothLinAdvISR != LA_ADV_NEVER) smoothLinAdvISR -= interval);
+      TERN_(BACKLASH_STEPPER, if (nextBacklashISR != BACKLASH_NEVER) nextBacklashISR -= interval);
       TERN_(BABYSTEPPING, if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval);
 
     } // standard motion control
@@ -1671,7 +1747,7 @@ void Stepper::isr() {
      */
     min_ticks = HAL_timer_get_count(MF_TIMER_STEP) + hal_timer_t(TERN(__AVR__, 8, 1) * (STEPPER_TIMER_TICKS_PER_US));
 
-    #if ENABLED(OLD_ADAPTIVE_MULTISTEPPING)
+    #if HAS_RATE_MULTISTEPPING
       /**
        * NB: If for some reason the stepper monopolizes the MPU, eventually the
        * timer will wrap around (and so will 'next_isr_ticks'). So, limit the
@@ -1682,9 +1758,9 @@ void Stepper::isr() {
     #endif
 
     // Advance pulses if not enough time to wait for the next ISR
-  } while (TERN(OLD_ADAPTIVE_MULTISTEPPING, true, --max_loops) && next_isr_ticks < min_ticks);
+  } while (TERN(HAS_RATE_MULTISTEPPING, true, --max_loops) && next_isr_ticks < min_ticks);
 
-  #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
+  #if !HAS_RATE_MULTISTEPPING
 
     // Track the time spent in the ISR
     const hal_timer_t time_spent = HAL_timer_get_count(MF_TIMER_STEP);
@@ -1708,7 +1784,7 @@ void Stepper::isr() {
       time_spent_out_isr -= time_spent;
     }
 
-  #endif // !OLD_ADAPTIVE_MULTISTEPPING
+  #endif // !HAS_RATE_MULTISTEPPING
 
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
@@ -1723,7 +1799,8 @@ void Stepper::isr() {
   #endif
 }
 
-#if MINIMUM_STEPPER_PULSE_NS || MAXIMUM_STEPPER_RATE
+// With STEP_DMA_STREAM every pulse is one sample long
+#if (MINIMUM_STEPPER_PULSE_NS || MAXIMUM_STEPPER_RATE) && DISABLED(STEP_DMA_STREAM)
   #define ISR_PULSE_CONTROL 1
 #endif
 #if ISR_PULSE_CONTROL && MULTISTEPPING_LIMIT > 1 && DISABLED(I2S_STEPPER_STREAM)
@@ -1737,7 +1814,7 @@ void Stepper::isr() {
  * call to this method that might cause variation in the timing. The aim
  * is to keep pulse timing as regular as possible.
  */
-void Stepper::pulse_phase_isr() {
+HAL_RAMFUNC void Stepper::pulse_phase_isr() {
 
   // If we must abort the current block, do so!
   if (abort_current_block) {
@@ -1758,6 +1835,10 @@ void Stepper::pulse_phase_isr() {
           shaping_z.delta_error = 0;
           shaping_z.last_block_end_pos = count_position.z;
         #endif
+        #if ENABLED(INPUT_SHAPING_E)
+          shaping_e.delta_error = 0;
+          shaping_e.last_block_end_pos = count_position.e;
+        #endif
       #endif
     }
   }
@@ -1824,6 +1905,12 @@ void Stepper::pulse_phase_isr() {
     #else
       #define HYSTERESIS_Z 0
     #endif
+    #if AXIS_DRIVER_TYPE_E0(TMC2208) || AXIS_DRIVER_TYPE_E0(TMC2208_STANDALONE) || \
+        AXIS_DRIVER_TYPE_E0(TMC5160) || AXIS_DRIVER_TYPE_E0(TMC5160_STANDALONE)
+      #define HYSTERESIS_E 64
+    #else
+      #define HYSTERESIS_E 0
+    #endif
     #define _HYSTERESIS(AXIS) HYSTERESIS_##AXIS
     #define HYSTERESIS(AXIS) _HYSTERESIS(AXIS)
 
@@ -2020,9 +2107,13 @@ void Stepper::pulse_phase_isr() {
         // record an echo if a step is needed in the primary bresenham
         const bool x_step = TERN0(INPUT_SHAPING_X, step_needed.x && shaping_x.enabled),
                    y_step = TERN0(INPUT_SHAPING_Y, step_needed.y && shaping_y.enabled),
-                   z_step = TERN0(INPUT_SHAPING_Z, step_needed.z && shaping_z.enabled);
-        if (x_step || y_step || z_step)
-          ShapingQueue::enqueue(x_step, TERN0(INPUT_SHAPING_X, shaping_x.forward), y_step, TERN0(INPUT_SHAPING_Y, shaping_y.forward), z_step, TERN0(INPUT_SHAPING_Z, shaping_z.forward));
+                   z_step = TERN0(INPUT_SHAPING_Z, step_needed.z && shaping_z.enabled),
+                   e_step = TERN0(INPUT_SHAPING_E, step_needed.e && shaping_e.enabled);
+        if (x_step || y_step || z_step || e_step)
+          ShapingQueue::enqueue(
+            x_step, TERN0(INPUT_SHAPING_X, shaping_x.forward), y_step, TERN0(INPUT_SHAPING_Y, shaping_y.forward),
+            z_step, TERN0(INPUT_SHAPING_Z, shaping_z.forward), e_step, TERN0(INPUT_SHAPING_E, shaping_e.forward)
+          );
 
         // do the first part of the secondary bresenham
         #if ENABLED(INPUT_SHAPING_X)
@@ -2037,6 +2128,10 @@ void Stepper::pulse_phase_isr() {
           if (z_step)
             PULSE_PREP_SHAPING(Z, shaping_z.delta_error, shaping_z.forward ? shaping_z.factor1 : -shaping_z.factor1);
         #endif
+        #if ENABLED(INPUT_SHAPING_E)
+          if (e_step)
+            PULSE_PREP_SHAPING(E, shaping_e.delta_error, shaping_e.forward ? shaping_e.factor1 : -shaping_e.factor1);
+        #endif
       #endif
     }
 
@@ -2048,14 +2143,32 @@ void Stepper::pulse_phase_isr() {
     #endif
 
     // Pulse start
-    #if HAS_X_STEP
-      PULSE_START(X);
-    #endif
-    #if HAS_Y_STEP
-      PULSE_START(Y);
-    #endif
-    #if HAS_Z_STEP
-      PULSE_START(Z);
+    #if ENABLED(STEP_PORT_BATCHING)
+      // Gather the X, Y, Z, and E step bits by port and write each port once
+      uint32_t pulse_start[4] = { 0 }, pulse_stop[4] = { 0 };
+      #define PULSE_GATHER(AXIS, SLOT) do{ \
+        if (step_needed.test(_AXIS(AXIS))) { \
+          count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          const uint8_t p = StepPortBatch::index[SLOT]; \
+          pulse_start[p] |= StepPortBatch::start_bits[SLOT]; \
+          pulse_stop[p] |= StepPortBatch::stop_bits[SLOT]; \
+        } \
+      }while(0)
+      TERN_(HAS_X_STEP,  PULSE_GATHER(X, 0));
+      TERN_(HAS_Y_STEP,  PULSE_GATHER(Y, 1));
+      TERN_(HAS_Z_STEP,  PULSE_GATHER(Z, 2));
+      TERN_(HAS_E0_STEP, PULSE_GATHER(E, 3));
+      StepPortBatch::write(pulse_start);
+    #else
+      #if HAS_X_STEP
+        PULSE_START(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_START(Y);
+      #endif
+      #if HAS_Z_STEP
+        PULSE_START(Z);
+      #endif
     #endif
     #if HAS_I_STEP
       PULSE_START(I);
@@ -2081,11 +2194,11 @@ void Stepper::pulse_phase_isr() {
         count_position.e += count_direction.e;
         E_STEP_WRITE(mixer.get_next_stepper(), STEP_STATE_E);
       }
-    #elif HAS_E0_STEP
+    #elif HAS_E0_STEP && DISABLED(STEP_PORT_BATCHING)
       PULSE_START(E);
     #endif
 
-    TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+    STREAM_PUSH_SAMPLE();
 
     // TODO: need to deal with MINIMUM_STEPPER_PULSE_NS over i2s
     #if ISR_PULSE_CONTROL
@@ -2094,14 +2207,18 @@ void Stepper::pulse_phase_isr() {
     #endif
 
     // Pulse stop
-    #if HAS_X_STEP
-      PULSE_STOP(X);
-    #endif
-    #if HAS_Y_STEP
-      PULSE_STOP(Y);
-    #endif
-    #if HAS_Z_STEP
-      PULSE_STOP(Z);
+    #if ENABLED(STEP_PORT_BATCHING)
+      StepPortBatch::write(pulse_stop);
+    #else
+      #if HAS_X_STEP
+        PULSE_STOP(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_STOP(Y);
+      #endif
+      #if HAS_Z_STEP
+        PULSE_STOP(Z);
+      #endif
     #endif
     #if HAS_I_STEP
       PULSE_STOP(I);
@@ -2124,7 +2241,7 @@ void Stepper::pulse_phase_isr() {
 
     #if ENABLED(MIXING_EXTRUDER)
       if (step_needed.e) E_STEP_WRITE(mixer.get_stepper(), !STEP_STATE_E);
-    #elif HAS_E0_STEP
+    #elif HAS_E0_STEP && DISABLED(STEP_PORT_BATCHING)
       PULSE_STOP(E);
     #endif
 
@@ -2137,40 +2254,49 @@ void Stepper::pulse_phase_isr() {
 
 #if HAS_ZV_SHAPING
 
-  void Stepper::shaping_isr() {
+  HAL_RAMFUNC void Stepper::shaping_isr() {
     AxisFlags step_needed{0};
 
     // Clear the echoes that are ready to process. If the buffers are too full and risk overflow, also apply echoes early.
     TERN_(INPUT_SHAPING_X, step_needed.x = !ShapingQueue::peek_x() || ShapingQueue::free_count_x() < steps_per_isr);
     TERN_(INPUT_SHAPING_Y, step_needed.y = !ShapingQueue::peek_y() || ShapingQueue::free_count_y() < steps_per_isr);
     TERN_(INPUT_SHAPING_Z, step_needed.z = !ShapingQueue::peek_z() || ShapingQueue::free_count_z() < steps_per_isr);
+    TERN_(INPUT_SHAPING_E, step_needed.e = !ShapingQueue::peek_e() || ShapingQueue::free_count_e() < steps_per_isr);
 
     if (bool(step_needed)) while (true) {
       #if ENABLED(INPUT_SHAPING_X)
         if (step_needed.x) {
-          const bool forward = ShapingQueue::dequeue_x();
-          PULSE_PREP_SHAPING(X, shaping_x.delta_error, (forward ? shaping_x.factor2 : -shaping_x.factor2));
+          const int16_t dividend = ShapingQueue::dequeue_x(shaping_x.echo_factor, ShapingQueue::free_count_x() < steps_per_isr);
+          PULSE_PREP_SHAPING(X, shaping_x.delta_error, dividend);
           PULSE_START(X);
         }
       #endif
 
       #if ENABLED(INPUT_SHAPING_Y)
         if (step_needed.y) {
-          const bool forward = ShapingQueue::dequeue_y();
-          PULSE_PREP_SHAPING(Y, shaping_y.delta_error, (forward ? shaping_y.factor2 : -shaping_y.factor2));
+          const int16_t dividend = ShapingQueue::dequeue_y(shaping_y.echo_factor, ShapingQueue::free_count_y() < steps_per_isr);
+          PULSE_PREP_SHAPING(Y, shaping_y.delta_error, dividend);
           PULSE_START(Y);
         }
       #endif
 
       #if ENABLED(INPUT_SHAPING_Z)
         if (step_needed.z) {
-          const bool forward = ShapingQueue::dequeue_z();
-          PULSE_PREP_SHAPING(Z, shaping_z.delta_error, (forward ? shaping_z.factor2 : -shaping_z.factor2));
+          const int16_t dividend = ShapingQueue::dequeue_z(shaping_z.echo_factor, ShapingQueue::free_count_z() < steps_per_isr);
+          PULSE_PREP_SHAPING(Z, shaping_z.delta_error, dividend);
           PULSE_START(Z);
         }
       #endif
 
-      TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+      #if ENABLED(INPUT_SHAPING_E)
+        if (step_needed.e) {
+          const int16_t dividend = ShapingQueue::dequeue_e(shaping_e.echo_factor, ShapingQueue::free_count_e() < steps_per_isr);
+          PULSE_PREP_SHAPING(E, shaping_e.delta_error, dividend);
+          PULSE_START(E);
+        }
+      #endif
+
+      STREAM_PUSH_SAMPLE();
 
       USING_TIMED_PULSE();
       if (bool(step_needed)) {
@@ -2187,11 +2313,15 @@ void Stepper::pulse_phase_isr() {
         #if ENABLED(INPUT_SHAPING_Z)
           PULSE_STOP(Z);
         #endif
+        #if ENABLED(INPUT_SHAPING_E)
+          PULSE_STOP(E);
+        #endif
       }
 
       TERN_(INPUT_SHAPING_X, step_needed.x = !ShapingQueue::peek_x() || ShapingQueue::free_count_x() < steps_per_isr);
       TERN_(INPUT_SHAPING_Y, step_needed.y = !ShapingQueue::peek_y() || ShapingQueue::free_count_y() < steps_per_isr);
       TERN_(INPUT_SHAPING_Z, step_needed.z = !ShapingQueue::peek_z() || ShapingQueue::free_count_z() < steps_per_isr);
+      TERN_(INPUT_SHAPING_E, step_needed.e = !ShapingQueue::peek_e() || ShapingQueue::free_count_e() < steps_per_isr);
 
       if (!bool(step_needed)) break;
 
@@ -2203,12 +2333,17 @@ void Stepper::pulse_phase_isr() {
 #endif // HAS_ZV_SHAPING
 
 // Calculate timer interval, with all limits applied.
-hal_timer_t Stepper::calc_timer_interval(uint32_t step_rate) {
+HAL_RAMFUNC hal_timer_t Stepper::calc_timer_interval(uint32_t step_rate) {
 
   #ifdef CPU_32_BIT
 
-    // A fast processor can just do integer division
-    return step_rate > minimal_step_rate ? uint32_t(STEPPER_TIMER_RATE) / step_rate : HAL_TIMER_TYPE_MAX;
+    #if ENABLED(STEP_INTERVAL_TABLE)
+      // Where division is slow use a reciprocal table with interpolation
+      return step_rate > minimal_step_rate ? StepInterval::interval(step_rate) : HAL_TIMER_TYPE_MAX;
+    #else
+      // A fast processor can just do integer division
+      return step_rate > minimal_step_rate ? uint32_t(STEPPER_TIMER_RATE) / step_rate : HAL_TIMER_TYPE_MAX;
+    #endif
 
   #else
 
@@ -2248,9 +2383,9 @@ hal_timer_t Stepper::calc_timer_interval(uint32_t step_rate) {
 #endif
 
 // Get the timer interval and the number of loops to perform per tick
-hal_timer_t Stepper::calc_multistep_timer_interval(uint32_t step_rate) {
+HAL_RAMFUNC hal_timer_t Stepper::calc_multistep_timer_interval(uint32_t step_rate) {
 
-  #if ENABLED(OLD_ADAPTIVE_MULTISTEPPING)
+  #if HAS_RATE_MULTISTEPPING
 
     #if MULTISTEPPING_LIMIT == 1
 
@@ -2283,13 +2418,60 @@ hal_timer_t Stepper::calc_multistep_timer_interval(uint32_t step_rate) {
         #endif
       };
 
-      // Find a doable step rate using multistepping
-      uint8_t multistep = 1;
-      for (uint8_t i = 0; i < COUNT(limit) && step_rate > uint32_t(pgm_read_dword(&limit[i])); ++i) {
-        step_rate >>= 1;
-        multistep <<= 1;
-      }
-      steps_per_isr = multistep;
+      #if ENABLED(SMOOTH_MULTISTEPPING)
+
+        // The rates to drop back under, MULTISTEPPING_HYSTERESIS percent below the limits
+        #define _MS_LOWER(S) uint32_t(max_step_isr_frequency_sh(S) * (100UL - (MULTISTEPPING_HYSTERESIS)) / 100UL)
+        static const uint32_t lower[] PROGMEM = {
+              _MS_LOWER(0)
+            , _MS_LOWER(1)
+          #if MULTISTEPPING_LIMIT >= 4
+            , _MS_LOWER(2)
+          #endif
+          #if MULTISTEPPING_LIMIT >= 8
+            , _MS_LOWER(3)
+          #endif
+          #if MULTISTEPPING_LIMIT >= 16
+            , _MS_LOWER(4)
+          #endif
+          #if MULTISTEPPING_LIMIT >= 32
+            , _MS_LOWER(5)
+          #endif
+          #if MULTISTEPPING_LIMIT >= 64
+            , _MS_LOWER(6)
+          #endif
+          #if MULTISTEPPING_LIMIT >= 128
+            , _MS_LOWER(7)
+          #endif
+        };
+        #undef _MS_LOWER
+
+        /**
+         * Keep the multistepping rate of the last interval unless the step rate
+         * has moved out of its band: over the limit to step up, or well under the
+         * limit of the next rate down to step back. A rate hovering around one
+         * limit, as in a slow ramp or a segmented curve, doesn't toggle the burst
+         * size on every interval.
+         */
+        static uint8_t shift = 0;
+        while (shift < COUNT(limit) - 1 && (step_rate >> shift) > uint32_t(pgm_read_dword(&limit[shift]))) ++shift;
+        while (shift && (step_rate >> (shift - 1)) < uint32_t(pgm_read_dword(&lower[shift - 1]))) --shift;
+
+        step_rate >>= shift;
+        NOMORE(step_rate, uint32_t(pgm_read_dword(&limit[shift])));
+        steps_per_isr = _BV(shift);
+
+      #else
+
+        // Find a doable step rate using multistepping
+        uint8_t multistep = 1;
+        for (uint8_t i = 0; i < COUNT(limit) && step_rate > uint32_t(pgm_read_dword(&limit[i])); ++i) {
+          step_rate >>= 1;
+          multistep <<= 1;
+        }
+        steps_per_isr = multistep;
+
+      #endif
 
     #endif
 
@@ -2389,13 +2571,22 @@ void Stepper::set_axis_moved_for_current_block() {
   axis_did_move = didmove;
 }
 
+#if ENABLED(LASER_POWER_TRAP_RATE)
+  // Laser power in proportion to the given step rate, using the slope set by the planner
+  FORCE_INLINE static uint8_t laser_trap_rate_power(const block_t * const block, const uint32_t step_rate) {
+    if (!block->laser.power) return 0;
+    const uint32_t pwr = block->laser.trap_rate_floor + uint32_t((uint64_t(step_rate) * block->laser.trap_rate_slope) >> 16);
+    return _MIN(pwr, uint32_t(block->laser.power));
+  }
+#endif
+
 /**
  * This last phase of the stepper interrupt processes and properly
  * schedules planner blocks. This is executed after the step pulses
  * have been done, so it is less time critical.
  */
-hal_timer_t Stepper::block_phase_isr() {
-  #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
+HAL_RAMFUNC hal_timer_t Stepper::block_phase_isr() {
+  #if !HAS_RATE_MULTISTEPPING
     // If the ISR uses < 50% of MPU time, halve multi-stepping
     const hal_timer_t time_spent = HAL_timer_get_count(MF_TIMER_STEP);
     #if MULTISTEPPING_LIMIT > 1
@@ -2481,10 +2672,14 @@ hal_timer_t Stepper::block_phase_isr() {
         #if ENABLED(LASER_POWER_TRAP)
           if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {
             if (planner.laser_inline.status.isPowered && planner.laser_inline.status.isEnabled) {
-              if (current_block->laser.trap_ramp_entry_incr > 0) {
-                cutter.apply_power(current_block->laser.trap_ramp_active_pwr);
-                current_block->laser.trap_ramp_active_pwr += current_block->laser.trap_ramp_entry_incr * steps_per_isr;
-              }
+              #if ENABLED(LASER_POWER_TRAP_RATE)
+                cutter.apply_power(laser_trap_rate_power(current_block, acc_step_rate));
+              #else
+                if (current_block->laser.trap_ramp_entry_incr > 0) {
+                  cutter.apply_power(current_block->laser.trap_ramp_active_pwr);
+                  current_block->laser.trap_ramp_active_pwr += current_block->laser.trap_ramp_entry_incr * steps_per_isr;
+                }
+              #endif
             }
             // Not a powered move.
             else cutter.apply_power(0);
@@ -2500,7 +2695,7 @@ hal_timer_t Stepper::block_phase_isr() {
           // If this is the 1st time we process the 2nd half of the trapezoid...
           if (!bezier_2nd_half) {
             // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->get_deceleration_time_inverse());
             bezier_2nd_half = true;
           }
           // Calculate the next speed to use
@@ -2532,6 +2727,10 @@ hal_timer_t Stepper::block_phase_isr() {
               const bool forward_e = la_step_rate < step_rate;
               la_interval = calc_timer_interval((forward_e ? step_rate - la_step_rate : la_step_rate - step_rate) >> current_block->la_scaling);
 
+              #if ENABLED(INPUT_SHAPING_E)
+                if (shaping_e.enabled) shaping_e.forward = forward_e; // The echoes reverse the motor when they get to it
+                else
+              #endif
               if (forward_e != motor_direction(E_AXIS)) {
                 last_direction_bits.toggle(E_AXIS);
                 count_direction.e = -count_direction.e;
@@ -2554,12 +2753,16 @@ hal_timer_t Stepper::block_phase_isr() {
         #if ENABLED(LASER_POWER_TRAP)
           if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {
             if (planner.laser_inline.status.isPowered && planner.laser_inline.status.isEnabled) {
-              if (current_block->laser.trap_ramp_exit_decr > 0) {
-                current_block->laser.trap_ramp_active_pwr -= current_block->laser.trap_ramp_exit_decr * steps_per_isr;
-                cutter.apply_power(current_block->laser.trap_ramp_active_pwr);
-              }
-              // Not a powered move.
-              else cutter.apply_power(0);
+              #if ENABLED(LASER_POWER_TRAP_RATE)
+                cutter.apply_power(laser_trap_rate_power(current_block, step_rate));
+              #else
+                if (current_block->laser.trap_ramp_exit_decr > 0) {
+                  current_block->laser.trap_ramp_active_pwr -= current_block->laser.trap_ramp_exit_decr * steps_per_isr;
+                  cutter.apply_power(current_block->laser.trap_ramp_active_pwr);
+                }
+                // Not a powered move.
+                else cutter.apply_power(0);
+              #endif
             }
           }
         #endif
@@ -2587,7 +2790,7 @@ hal_timer_t Stepper::block_phase_isr() {
           #if ENABLED(LASER_POWER_TRAP)
             if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {
               if (planner.laser_inline.status.isPowered && planner.laser_inline.status.isEnabled) {
-                if (current_block->laser.trap_ramp_entry_incr > 0) {
+                if (TERN(LASER_POWER_TRAP_RATE, current_block->laser.power, current_block->laser.trap_ramp_entry_incr > 0)) {
                   current_block->laser.trap_ramp_active_pwr = current_block->laser.power;
                   cutter.apply_power(current_block->laser.power);
                 }
@@ -2659,10 +2862,15 @@ hal_timer_t Stepper::block_phase_isr() {
         discard_current_block();
 
         // Try to get a new block. Exit if there are no more.
-        if (!(current_block = planner.get_current_block()))
+        if (!(current_block = planner.get_current_block())) {
+          TERN_(PLANNER_MONITOR, planner_monitor.block_missed());
           return interval; // No more queued movements!
+        }
       }
 
+      TERN_(PLANNER_MONITOR, planner_monitor.block_consumed(planner.movesplanned()));
+      TERN_(FLIGHT_RECORDER, flight_recorder.record(FR_BLOCK_STARTED, planner.movesplanned()));
+
       // For non-inline cutter, grossly apply power
       #if HAS_CUTTER
         if (cutter.cutter_mode == CUTTER_MODE_STANDARD) {
@@ -2752,6 +2960,15 @@ hal_timer_t Stepper::block_phase_isr() {
         }
       #endif
 
+      #if ENABLED(INPUT_SHAPING_E)
+        if (shaping_e.enabled) {
+          const int64_t steps = current_block->direction_bits.e ? int64_t(current_block->steps.e) : -int64_t(current_block->steps.e);
+          shaping_e.last_block_end_pos += steps;
+          shaping_e.forward = current_block->direction_bits.e;
+          if (!ShapingQueue::empty_e()) current_block->direction_bits.e = last_direction_bits.e;
+        }
+      #endif
+
       // No step events completed so far
       step_events_completed = 0;
 
@@ -2759,7 +2976,11 @@ hal_timer_t Stepper::block_phase_isr() {
       accelerate_before = current_block->accelerate_before << oversampling_factor;
       decelerate_start = current_block->decelerate_start << oversampling_factor;
 
-      TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color));
+      #if ENABLED(GRADIENT_MIX_PER_STEP)
+        mixer.stepper_setup(current_block->b_color, current_block->b_color_end, current_block->steps.e);
+      #else
+        TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color));
+      #endif
 
       E_TERN_(stepper_extruder = current_block->extruder);
 
@@ -2818,7 +3039,7 @@ hal_timer_t Stepper::block_phase_isr() {
 
       #if ENABLED(S_CURVE_ACCELERATION)
         // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->get_acceleration_time_inverse());
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
@@ -2842,6 +3063,8 @@ hal_timer_t Stepper::block_phase_isr() {
         }
       #endif
 
+      TERN_(BACKLASH_STEPPER, if (current_block->backlash_steps) queue_backlash_steps());
+
       // Calculate the initial timer interval
       interval = calc_multistep_timer_interval(current_block->initial_rate << oversampling_factor);
       // Initialize ac/deceleration time as if half the time passed.
@@ -2860,6 +3083,10 @@ hal_timer_t Stepper::block_phase_isr() {
         #endif
       #endif
     }
+    #if ENABLED(PLANNER_MONITOR)
+      else
+        planner_monitor.block_missed();
+    #endif
   } // !current_block
 
   // Return the interval to wait
@@ -2891,6 +3118,10 @@ hal_timer_t Stepper::block_phase_isr() {
         #endif
 
         la_interval = calc_timer_interval(uint32_t(ABS(step_rate)));
+        #if ENABLED(INPUT_SHAPING_E)
+          if (shaping_e.enabled) shaping_e.forward = forward_e; // The echoes reverse the motor when they get to it
+          else
+        #endif
         if (forward_e != motor_direction(E_AXIS)) {
           last_direction_bits.toggle(E_AXIS);
           count_direction.e = -count_direction.e;
@@ -2904,7 +3135,7 @@ hal_timer_t Stepper::block_phase_isr() {
 
     #if ENABLED(INPUT_SHAPING_E_SYNC)
 
-      constexpr uint16_t IS_COMPENSATION_BUFFER_SIZE = uint16_t(float(SMOOTH_LIN_ADV_HZ) / (2.0f * (SHAPING_MIN_FREQ)) + 0.5f);
+      constexpr uint16_t IS_COMPENSATION_BUFFER_SIZE = uint16_t(float(SMOOTH_LIN_ADV_HZ) * (SHAPING_MAX_ECHOES) / (2.0f * (SHAPING_MIN_FREQ)) + 0.5f);
 
       typedef struct {
         xy_long_t buffer[IS_COMPENSATION_BUFFER_SIZE];
@@ -2947,14 +3178,24 @@ hal_timer_t Stepper::block_phase_isr() {
       }
     #endif
 
+    /**
+     * Get the E step rate planned for 'stepper_ticks' from the start of the current block.
+     * At most SMOOTH_LIN_ADV_LOOKAHEAD blocks are searched so the cost is bounded with many
+     * short segments. Beyond the window (or the end of the queue) the final rate of the last
+     * block is held, so the target pressure follows the planned junction speed rather than
+     * dropping to zero and spiking back up at each block boundary.
+     */
     int32_t Stepper::smooth_lin_adv_lookahead(uint32_t stepper_ticks) {
-      for (uint8_t i = 0; block_t *block = planner.get_future_block(i); i++) {
+      int32_t end_rate = 0;
+      for (uint8_t i = 0; i < SMOOTH_LIN_ADV_LOOKAHEAD; i++) {
+        block_t * const block = planner.get_future_block(i);
+        if (!block) break;
         if (block->is_sync()) continue;
         if (stepper_ticks <= block->acceleration_time) {
           if (!block->use_advance_lead) return 0;
           uint32_t rate;
           #if ENABLED(S_CURVE_ACCELERATION)
-            rate = calc_bezier_curve(block->initial_rate, block->cruise_rate, block->acceleration_time_inverse, stepper_ticks);
+            rate = calc_bezier_curve(block->initial_rate, block->cruise_rate, block->get_acceleration_time_inverse(), stepper_ticks);
           #else
             rate = STEP_MULTIPLY(stepper_ticks, block->acceleration_rate) + block->initial_rate;
             NOMORE(rate, block->nominal_rate);
@@ -2973,7 +3214,7 @@ hal_timer_t Stepper::block_phase_isr() {
           if (!block->use_advance_lead) return 0;
           uint32_t rate;
           #if ENABLED(S_CURVE_ACCELERATION)
-            rate = calc_bezier_curve(block->cruise_rate, block->final_rate, block->deceleration_time_inverse, stepper_ticks);
+            rate = calc_bezier_curve(block->cruise_rate, block->final_rate, block->get_deceleration_time_inverse(), stepper_ticks);
           #else
             rate = STEP_MULTIPLY(stepper_ticks, block->acceleration_rate);
             if (rate < block->cruise_rate) {
@@ -2986,11 +3227,12 @@ hal_timer_t Stepper::block_phase_isr() {
           return MULT_Q(30, rate, block->e_step_ratio_q30);
         }
         stepper_ticks -= block->deceleration_time;
+        end_rate = block->use_advance_lead ? MULT_Q(30, block->final_rate, block->e_step_ratio_q30) : 0;
       }
-      return 0;
+      return end_rate;
     }
 
-    hal_timer_t Stepper::smooth_lin_adv_isr() {
+    HAL_RAMFUNC hal_timer_t Stepper::smooth_lin_adv_isr() {
       int32_t target_adv_steps = 0;
       if (current_block) {
         const uint32_t stepper_ticks = extruder_advance_tau_ticks[E_INDEX_N(active_extruder)] + curr_timer_tick;
@@ -3034,10 +3276,16 @@ hal_timer_t Stepper::block_phase_isr() {
           });
         }
 
-        const xy_long_t second_pulse_rate = xy_long_t({
-          TERN0(INPUT_SHAPING_X, shaping_x.enabled ? (smooth_lin_adv_lookback(ShapingQueue::get_delay_x()).x * shaping_x.factor2) >> 7 : 0),
-          TERN0(INPUT_SHAPING_Y, shaping_y.enabled ? (smooth_lin_adv_lookback(ShapingQueue::get_delay_y()).y * shaping_y.factor2) >> 7 : 0)
-        });
+        // The rates of earlier moves, echoed by each later shaper impulse
+        xy_long_t second_pulse_rate{0};
+        #if ENABLED(INPUT_SHAPING_X)
+          if (shaping_x.enabled) for (uint8_t e = 0; e < ShapingQueue::echo_count_x(); ++e)
+            second_pulse_rate.x += (smooth_lin_adv_lookback(ShapingQueue::get_delay_x(e)).x * shaping_x.echo_factor[e]) >> 7;
+        #endif
+        #if ENABLED(INPUT_SHAPING_Y)
+          if (shaping_y.enabled) for (uint8_t e = 0; e < ShapingQueue::echo_count_y(); ++e)
+            second_pulse_rate.y += (smooth_lin_adv_lookback(ShapingQueue::get_delay_y(e)).y * shaping_y.echo_factor[e]) >> 7;
+        #endif
 
         delayBuffer.add(pre_shaping_rate);
 
@@ -3056,7 +3304,7 @@ hal_timer_t Stepper::block_phase_isr() {
   #endif // SMOOTH_LIN_ADVANCE
 
   // Timer interrupt for E. LA_steps is set in the main routine
-  void Stepper::advance_isr() {
+  HAL_RAMFUNC void Stepper::advance_isr() {
     // Apply Bresenham algorithm so that linear advance can piggy back on
     // the acceleration and speed values calculated in block_phase_isr().
     // This helps keep LA in sync with, for example, S_CURVE_ACCELERATION.
@@ -3067,6 +3315,36 @@ hal_timer_t Stepper::block_phase_isr() {
       constexpr bool e_step_needed = true;
     #endif
 
+    #if ENABLED(INPUT_SHAPING_E)
+      // Shape the advance steps like the Bresenham E steps, so they follow the shaped XY motion.
+      // The echoes decide the motor direction, so only the logical direction is kept here.
+      if (shaping_e.enabled) {
+        if (!e_step_needed) return;
+        #if HAS_ROUGH_LIN_ADVANCE
+          la_advance_steps += shaping_e.forward ? 1 : -1;
+          la_delta_error -= advance_divisor;
+        #endif
+        ShapingQueue::enqueue(false, false, false, false, false, false, true, shaping_e.forward);
+
+        AxisFlags step_needed{0};
+        step_needed.e = true;
+        PULSE_PREP_SHAPING(E, shaping_e.delta_error, shaping_e.forward ? shaping_e.factor1 : -shaping_e.factor1);
+        PULSE_START(E);
+
+        STREAM_PUSH_SAMPLE();
+
+        if (step_needed.e) {
+          #if ISR_PULSE_CONTROL
+            USING_TIMED_PULSE();
+            START_TIMED_PULSE();
+            AWAIT_HIGH_PULSE();
+          #endif
+          PULSE_STOP(E);
+        }
+        return;
+      }
+    #endif
+
     if (e_step_needed) {
       count_position.e += count_direction.e;
       #if HAS_ROUGH_LIN_ADVANCE
@@ -3078,7 +3356,7 @@ hal_timer_t Stepper::block_phase_isr() {
       E_STEP_WRITE(TERN(MIXING_EXTRUDER, mixer.get_next_stepper(), stepper_extruder), STEP_STATE_E);
     }
 
-    TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+    STREAM_PUSH_SAMPLE();
 
     if (e_step_needed) {
       // Enforce a minimum duration for STEP pulse ON
@@ -3095,10 +3373,75 @@ hal_timer_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(BACKLASH_STEPPER)
+
+  /**
+   * Take the backlash correction of a new block, spreading its steps over
+   * the time the block takes at its nominal rate. The block is never shorter
+   * than that, so the correction is normally done before the next block.
+   * Any steps left over are kept, since the final position only depends on
+   * their sum.
+   */
+  void Stepper::queue_backlash_steps() {
+    backlash_pending += current_block->backlash_steps;
+    uint32_t most = 0;
+    LOOP_NUM_AXES(a) NOLESS(most, uint32_t(ABS(backlash_pending[a])));
+    if (!most) { nextBacklashISR = BACKLASH_NEVER; return; }
+    backlash_interval = _MAX(current_block->step_event_count / most, 1UL) * calc_timer_interval(current_block->nominal_rate);
+    nextBacklashISR = backlash_interval / 2;
+  }
+
+  /**
+   * Step each axis that has correction pending in the direction its motor
+   * is set to turn, counting the steps in the position. The steps of an
+   * axis whose motor turns the other way (e.g., held back by input shaping)
+   * wait for the direction to come back.
+   */
+  void Stepper::backlash_step() {
+    AxisFlags step_needed{0};
+    #define _BACKLASH_STEP_NEEDED(A,a) (step_needed.a = backlash_pending.a && (backlash_pending.a > 0) == motor_direction(_AXIS(A)))
+    #define _BACKLASH_STEP_START(A,a) do{ if (step_needed.a) _APPLY_STEP(A, _STEP_STATE(A), false); }while(0)
+    #define _BACKLASH_STEP_STOP(A,a) do{ if (step_needed.a) { \
+      _APPLY_STEP(A, !_STEP_STATE(A), false); \
+      const int8_t d = backlash_pending.a > 0 ? 1 : -1; \
+      backlash_pending.a -= d; \
+      count_position.a += d; \
+    } }while(0)
+
+    XYZ_CODE(_BACKLASH_STEP_NEEDED(X, x), _BACKLASH_STEP_NEEDED(Y, y), _BACKLASH_STEP_NEEDED(Z, z));
+    if (!step_needed) return;
+
+    // The Pulse phase may have just ended a pulse on the same axis
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      START_TIMED_PULSE();
+      AWAIT_LOW_PULSE();
+    #endif
+
+    XYZ_CODE(_BACKLASH_STEP_START(X, x), _BACKLASH_STEP_START(Y, y), _BACKLASH_STEP_START(Z, z));
+
+    STREAM_PUSH_SAMPLE();
+
+    #if ISR_PULSE_CONTROL
+      START_TIMED_PULSE();
+      AWAIT_HIGH_PULSE();
+    #endif
+
+    XYZ_CODE(_BACKLASH_STEP_STOP(X, x), _BACKLASH_STEP_STOP(Y, y), _BACKLASH_STEP_STOP(Z, z));
+  }
+
+  // Timer interrupt for backlash correction
+  hal_timer_t Stepper::backlash_isr() {
+    backlash_step();
+    return backlash_pending ? backlash_interval : BACKLASH_NEVER;
+  }
+
+#endif // BACKLASH_STEPPER
+
 #if ENABLED(BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
-  hal_timer_t Stepper::babystepping_isr() {
+  HAL_RAMFUNC hal_timer_t Stepper::babystepping_isr() {
     babystep.task();
     return babystep.has_steps() ? BABYSTEP_TICKS : BABYSTEP_NEVER;
   }
@@ -3255,7 +3598,12 @@ void Stepper::init() {
   TERN_(HAS_E6_STEP, E_AXIS_INIT(6));
   TERN_(HAS_E7_STEP, E_AXIS_INIT(7));
 
-  #if DISABLED(I2S_STEPPER_STREAM)
+  TERN_(STEP_PORT_BATCHING, StepPortBatch::init());
+
+  #if ENABLED(STEP_DMA_STREAM)
+    step_stream_init();
+    wake_up();
+  #elif DISABLED(I2S_STEPPER_STREAM)
     HAL_timer_start(MF_TIMER_STEP, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
     sei();
@@ -3272,31 +3620,93 @@ void Stepper::init() {
 
 #if HAS_ZV_SHAPING
 
+  #if HAS_MULTI_IMPULSE_SHAPING
+
+    void Stepper::set_shaping_type(const AxisEnum axis, const shaping_type_t type) {
+      TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) shaping_x.type = type);
+      TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) shaping_y.type = type);
+      TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) shaping_z.type = type);
+      TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) shaping_e.type = type);
+      // Apply the impulse times and amplitudes of the new type
+      set_shaping_frequency(axis, get_shaping_frequency(axis));
+      set_shaping_damping_ratio(axis, get_shaping_damping_ratio(axis));
+    }
+
+    shaping_type_t Stepper::get_shaping_type(const AxisEnum axis) {
+      TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) return shaping_x.type);
+      TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) return shaping_y.type);
+      TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) return shaping_z.type);
+      TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) return shaping_e.type);
+      return SHAPING_ZV;
+    }
+
+  #endif
+
   /**
-   * Calculate a fixed point factor to apply to the signal and its echo
+   * Calculate fixed point factors to apply to the signal and its echoes
    * when shaping an axis.
    */
   void Stepper::set_shaping_damping_ratio(const AxisEnum axis, const float zeta) {
-    // From the damping ratio, get a factor that can be applied to advance_dividend for fixed-point maths.
-    // For ZV, we use amplitudes 1/(1+K) and K/(1+K) where K = exp(-zeta * π / sqrt(1.0f - zeta * zeta))
-    // which can be converted to 1:7 fixed point with an excellent fit with a 3rd-order polynomial.
-    float factor2;
-    if (zeta <= 0.0f) factor2 = 64.0f;
-    else if (zeta >= 1.0f) factor2 = 0.0f;
-    else {
-      factor2 = 64.44056192 + -99.02008832 * zeta;
-      const float zeta2 = sq(zeta);
-      factor2 += -7.58095488 * zeta2;
-      const float zeta3 = zeta2 * zeta;
-      factor2 += 43.073216 * zeta3;
-      factor2 = FLOOR(factor2);
+    uint8_t echo_factor[SHAPING_MAX_ECHOES] = { 0 };
+
+    #if HAS_MULTI_IMPULSE_SHAPING
+      const shaping_type_t type = get_shaping_type(axis);
+      if (type != SHAPING_ZV) {
+        // Impulse amplitudes as used by Klipper, with K = exp(-zeta * π / sqrt(1.0f - zeta * zeta))
+        // and a vibration tolerance of 5% for the Extra-Insensitive shapers.
+        constexpr float v = 0.05f;
+        const float K = zeta <= 0.0f ? 1.0f : zeta >= 1.0f ? 0.0f : expf(-zeta * M_PI / SQRT(1.0f - sq(zeta)));
+        float a[SHAPING_MAX_IMPULSES] = { 1.0f };
+        switch (type) {
+          default: break;
+          case SHAPING_ZVD: a[1] = 2.0f * K; a[2] = sq(K); break;
+          case SHAPING_MZV: {
+            const float Km = powf(K, 0.75f);
+            a[0] = 1.0f - 0.70710678f; a[1] = (1.41421356f - 1.0f) * Km; a[2] = a[0] * sq(Km);
+          } break;
+          case SHAPING_EI: a[0] = 0.25f * (1.0f + v); a[1] = 0.5f * (1.0f - v) * K; a[2] = a[0] * sq(K); break;
+          #if HAS_4_IMPULSE_SHAPING
+            case SHAPING_ZVDD: a[1] = 3.0f * K; a[2] = 3.0f * sq(K); a[3] = K * sq(K); break;
+            case SHAPING_2HEI: {
+              const float x = cbrtf(sq(v) * (SQRT(1.0f - sq(v)) + 1.0f));
+              a[0] = (3.0f * sq(x) + 2.0f * x + 3.0f * sq(v)) / (16.0f * x);
+              a[1] = (0.5f - a[0]) * K; a[2] = a[1] * K; a[3] = a[0] * K * sq(K);
+            } break;
+          #endif
+        }
+        float sum = 0.0f;
+        for (uint8_t i = 0; i < SHAPING_MAX_IMPULSES; ++i) sum += a[i];
+        for (uint8_t e = 0; e < SHAPING_MAX_ECHOES; ++e) echo_factor[e] = FLOOR(128.0f * a[e + 1] / sum);
+      }
+      else
+    #endif
+    {
+      // From the damping ratio, get a factor that can be applied to advance_dividend for fixed-point maths.
+      // For ZV, we use amplitudes 1/(1+K) and K/(1+K) where K = exp(-zeta * π / sqrt(1.0f - zeta * zeta))
+      // which can be converted to 1:7 fixed point with an excellent fit with a 3rd-order polynomial.
+      float factor2;
+      if (zeta <= 0.0f) factor2 = 64.0f;
+      else if (zeta >= 1.0f) factor2 = 0.0f;
+      else {
+        factor2 = 64.44056192 + -99.02008832 * zeta;
+        const float zeta2 = sq(zeta);
+        factor2 += -7.58095488 * zeta2;
+        const float zeta3 = zeta2 * zeta;
+        factor2 += 43.073216 * zeta3;
+        factor2 = FLOOR(factor2);
+      }
+      echo_factor[0] = factor2;
     }
 
+    uint8_t factor1 = 128;
+    for (uint8_t e = 0; e < SHAPING_MAX_ECHOES; ++e) factor1 -= echo_factor[e];
+
     const bool was_on = hal.isr_state();
     hal.isr_off();
-    TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) { shaping_x.factor2 = factor2; shaping_x.factor1 = 128 - factor2; shaping_x.zeta = zeta; })
-    TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) { shaping_y.factor2 = factor2; shaping_y.factor1 = 128 - factor2; shaping_y.zeta = zeta; })
-    TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) { shaping_z.factor2 = factor2; shaping_z.factor1 = 128 - factor2; shaping_z.zeta = zeta; })
+    TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) { COPY(shaping_x.echo_factor, echo_factor); shaping_x.factor1 = factor1; shaping_x.zeta = zeta; })
+    TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) { COPY(shaping_y.echo_factor, echo_factor); shaping_y.factor1 = factor1; shaping_y.zeta = zeta; })
+    TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) { COPY(shaping_z.echo_factor, echo_factor); shaping_z.factor1 = factor1; shaping_z.zeta = zeta; })
+    TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) { COPY(shaping_e.echo_factor, echo_factor); shaping_e.factor1 = factor1; shaping_e.zeta = zeta; })
     if (was_on) hal.isr_on();
   }
 
@@ -3304,6 +3714,7 @@ void Stepper::init() {
     TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) return shaping_x.zeta);
     TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) return shaping_y.zeta);
     TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) return shaping_z.zeta);
+    TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) return shaping_e.zeta);
     return -1;
   }
 
@@ -3311,13 +3722,23 @@ void Stepper::init() {
     // enabling or disabling shaping whilst moving can result in lost steps
     planner.synchronize();
 
+    // Echoes are delayed by eighths of the resonant period. MZV uses 3/8 steps, all others 1/2.
+    #if HAS_MULTI_IMPULSE_SHAPING
+      const shaping_type_t type = get_shaping_type(axis);
+      const uint8_t echoes = type == SHAPING_ZV ? 1 : TERN_(HAS_4_IMPULSE_SHAPING, type >= SHAPING_ZVDD ? 3 :) 2,
+                    eighths = type == SHAPING_MZV ? 3 : 4;
+    #else
+      constexpr uint8_t eighths = 4;
+    #endif
+
     const bool was_on = hal.isr_state();
     hal.isr_off();
 
-    const shaping_time_t delay = freq ? float(uint32_t(STEPPER_TIMER_RATE) / 2) / freq : shaping_time_t(-1);
     #define SHAPING_SET_FREQ_FOR_AXIS(AXISN, AXISL)                                 \
       if (axis == AXISN) {                                                          \
-        ShapingQueue::set_delay(AXISN, delay);                                      \
+        for (uint8_t e = 0; e < SHAPING_MAX_ECHOES; ++e)                                             \
+          ShapingQueue::set_delay(AXISN, e, freq ? float(uint32_t(STEPPER_TIMER_RATE)) * eighths * (e + 1) / 8 / freq : shaping_time_t(-1)); \
+        TERN_(HAS_MULTI_IMPULSE_SHAPING, ShapingQueue::set_echoes(AXISN, echoes));  \
         shaping_##AXISL.frequency = freq;                                           \
         shaping_##AXISL.enabled = !!freq;                                           \
         shaping_##AXISL.delta_error = 0;                                            \
@@ -3327,6 +3748,7 @@ void Stepper::init() {
     TERN_(INPUT_SHAPING_X, SHAPING_SET_FREQ_FOR_AXIS(X_AXIS, x))
     TERN_(INPUT_SHAPING_Y, SHAPING_SET_FREQ_FOR_AXIS(Y_AXIS, y))
     TERN_(INPUT_SHAPING_Z, SHAPING_SET_FREQ_FOR_AXIS(Z_AXIS, z))
+    TERN_(INPUT_SHAPING_E, SHAPING_SET_FREQ_FOR_AXIS(E_AXIS, e))
 
     if (was_on) hal.isr_on();
   }
@@ -3335,6 +3757,7 @@ void Stepper::init() {
     TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) return shaping_x.frequency);
     TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) return shaping_y.frequency);
     TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) return shaping_z.frequency);
+    TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) return shaping_e.frequency);
     return -1;
   }
 
@@ -3350,6 +3773,8 @@ void Stepper::init() {
  * derive the current XYZE position later on.
  */
 void Stepper::_set_position(const abce_long_t &spos) {
+  TERN_(FILAMENT_MOTION_TRACKING, position_sets++);
+
   #if ENABLED(INPUT_SHAPING_X)
     const int32_t x_shaping_delta = count_position.x - shaping_x.last_block_end_pos;
   #endif
@@ -3359,6 +3784,9 @@ void Stepper::_set_position(const abce_long_t &spos) {
   #if ENABLED(INPUT_SHAPING_Z)
     const int32_t z_shaping_delta = count_position.z - shaping_z.last_block_end_pos;
   #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    const int32_t e_shaping_delta = count_position.e - shaping_e.last_block_end_pos;
+  #endif
 
   #if ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
     // Core equations follow the form of the dA and dB equations at https://www.corexy.com/theory.html
@@ -3405,6 +3833,12 @@ void Stepper::_set_position(const abce_long_t &spos) {
       shaping_z.last_block_end_pos = spos.z;
     }
   #endif
+  #if ENABLED(INPUT_SHAPING_E)
+    if (shaping_e.enabled) {
+      count_position.e += e_shaping_delta;
+      shaping_e.last_block_end_pos = spos.e;
+    }
+  #endif
 }
 
 // AVR requires guards to ensure any atomic memory operation greater than 8 bits
@@ -3439,16 +3873,18 @@ void Stepper::set_position(const xyze_long_t &spos) {
 void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
   planner.synchronize();
 
-  #if ANY(__AVR__, INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z)
+  #if ANY(__AVR__, INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z, INPUT_SHAPING_E)
     ATOMIC_SECTION_START();
   #endif
 
   count_position[a] = v;
+  TERN_(FILAMENT_MOTION_TRACKING, position_sets++);
   TERN_(INPUT_SHAPING_X, if (a == X_AXIS) shaping_x.last_block_end_pos = v);
   TERN_(INPUT_SHAPING_Y, if (a == Y_AXIS) shaping_y.last_block_end_pos = v);
   TERN_(INPUT_SHAPING_Z, if (a == Z_AXIS) shaping_z.last_block_end_pos = v);
+  TERN_(INPUT_SHAPING_E, if (a == E_AXIS) shaping_e.last_block_end_pos = v);
 
-  #if ANY(__AVR__, INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z)
+  #if ANY(__AVR__, INPUT_SHAPING_X, INPUT_SHAPING_Y, INPUT_SHAPING_Z, INPUT_SHAPING_E)
     ATOMIC_SECTION_END();
   #endif
 }
@@ -3460,6 +3896,7 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
 
     AVR_ATOMIC_SECTION_START();
     count_position.e = v;
+    TERN_(FILAMENT_MOTION_TRACKING, position_sets++);
     AVR_ATOMIC_SECTION_END();
   }
 
@@ -3485,26 +3922,29 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
  * If the Stepper ISR is preempted (e.g., by the endstop ISR) we
  * must ensure the move is properly canceled before the ISR resumes.
  */
-void Stepper::endstop_triggered(const AxisEnum axis) {
+void Stepper::endstop_triggered(const AxisEnum axis OPTARG(ENDSTOP_EDGE_CAPTURE, const xyze_long_t * const edge_pos/*=nullptr*/)) {
 
   ATOMIC_SECTION_START();   // Suspend the Stepper ISR on all platforms
 
+  // Use the position captured at the endstop edge, if given
+  const xyze_long_t &pos = TERN(ENDSTOP_EDGE_CAPTURE, edge_pos ? *edge_pos : count_position, count_position);
+
   endstops_trigsteps[axis] = (
     #if IS_CORE
       (axis == CORE_AXIS_2
-        ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-        : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+        ? CORESIGN(pos[CORE_AXIS_1] - pos[CORE_AXIS_2])
+        : pos[CORE_AXIS_1] + pos[CORE_AXIS_2]
       ) * double(0.5)
     #elif ENABLED(MARKFORGED_XY)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1] TERN(MARKFORGED_INVERSE, +, -) count_position[CORE_AXIS_2]
-        : count_position[CORE_AXIS_2]
+        ? pos[CORE_AXIS_1] TERN(MARKFORGED_INVERSE, +, -) pos[CORE_AXIS_2]
+        : pos[CORE_AXIS_2]
     #elif ENABLED(MARKFORGED_YX)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1]
-        : count_position[CORE_AXIS_2] TERN(MARKFORGED_INVERSE, +, -) count_position[CORE_AXIS_1]
+        ? pos[CORE_AXIS_1]
+        : pos[CORE_AXIS_2] TERN(MARKFORGED_INVERSE, +, -) pos[CORE_AXIS_1]
     #else // !IS_CORE
-      count_position[axis]
+      pos[axis]
     #endif
   );
 
@@ -3514,6 +3954,30 @@ void Stepper::endstop_triggered(const AxisEnum axis) {
   ATOMIC_SECTION_END();     // Suspend the Stepper ISR on all platforms
 }
 
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+
+  // Copy all step counts at an endstop edge, for endstop_triggered
+  xyze_long_t Stepper::edge_position() {
+    ATOMIC_SECTION_START();
+    const xyze_long_t pos = count_position;
+    ATOMIC_SECTION_END();
+    return pos;
+  }
+
+#endif
+
+#if ENABLED(TMC_CRUISE_CURRENT)
+
+  uint32_t Stepper::cruise_ms_left() {
+    ATOMIC_SECTION_START();
+    const uint32_t done = step_events_completed, cruise_end = decelerate_start,
+                   rate = current_block && done >= accelerate_before && done < cruise_end ? current_block->nominal_rate : 0;
+    ATOMIC_SECTION_END();
+    return rate ? uint32_t((uint64_t(cruise_end - done) * 1000UL) / (uint64_t(rate) << oversampling_factor)) : 0;
+  }
+
+#endif
+
 // Return the "triggered" position for an axis (that hit an endstop)
 int32_t Stepper::triggered_position(const AxisEnum axis) {
   AVR_ATOMIC_SECTION_START();
@@ -3604,8 +4068,8 @@ void Stepper::report_positions() {
     #define _FTM_STEP_START(A) A##_APPLY_STEP(_FTM_STEP(A), false);
     LOGICAL_AXIS_MAP(_FTM_STEP_START);
 
-    // Apply steps via I2S
-    TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+    // Apply steps via I2S or the DMA step stream
+    STREAM_PUSH_SAMPLE();
 
     // Begin waiting for the minimum pulse duration
     START_TIMED_PULSE();
@@ -144,7 +144,8 @@ constexpr ena_mask_t enable_overlap[] = {
     constexpr feedRate_t _ISDMF[] = DEFAULT_MAX_FEEDRATE;
     constexpr float max_shaped_rate = TERN0(INPUT_SHAPING_X, _ISDMF[X_AXIS] * _ISDASU[X_AXIS]) +
                                       TERN0(INPUT_SHAPING_Y, _ISDMF[Y_AXIS] * _ISDASU[Y_AXIS]) +
-                                      TERN0(INPUT_SHAPING_Z, _ISDMF[Z_AXIS] * _ISDASU[Z_AXIS]);
+                                      TERN0(INPUT_SHAPING_Z, _ISDMF[Z_AXIS] * _ISDASU[Z_AXIS]) +
+                                      TERN0(INPUT_SHAPING_E, _ISDMF[E_AXIS] * _ISDASU[E_AXIS]);
     #if defined(__AVR__) || !defined(ADAPTIVE_STEP_SMOOTHING)
       // min_step_isr_frequency is known at compile time on AVRs and any reduction in SRAM is welcome
       template<int INDEX=DISTINCT_AXES> constexpr float max_isr_rate() {
@@ -160,17 +161,196 @@ constexpr ena_mask_t enable_overlap[] = {
   #endif
 
   #ifndef SHAPING_MIN_FREQ
-    #define SHAPING_MIN_FREQ _MIN(__FLT_MAX__ OPTARG(INPUT_SHAPING_X, SHAPING_FREQ_X) OPTARG(INPUT_SHAPING_Y, SHAPING_FREQ_Y) OPTARG(INPUT_SHAPING_Z, SHAPING_FREQ_Z))
+    #define SHAPING_MIN_FREQ _MIN(__FLT_MAX__ OPTARG(INPUT_SHAPING_X, SHAPING_FREQ_X) OPTARG(INPUT_SHAPING_Y, SHAPING_FREQ_Y) OPTARG(INPUT_SHAPING_Z, SHAPING_FREQ_Z) OPTARG(INPUT_SHAPING_E, SHAPING_FREQ_E))
   #endif
   constexpr float shaping_min_freq = SHAPING_MIN_FREQ;
-  constexpr uint16_t shaping_echoes = FLOOR(max_step_rate / shaping_min_freq / 2) + 3;
+  // The last echo of the longest shaper is delayed by SHAPING_MAX_ECHOES half periods
+  constexpr uint16_t shaping_echoes = FLOOR(max_step_rate / shaping_min_freq / 2 * (SHAPING_MAX_ECHOES)) + 3;
 
   typedef hal_timer_t shaping_time_t;
-  enum shaping_echo_t { ECHO_NONE = 0, ECHO_FWD = 1, ECHO_BWD = 2 };
+
+  // Echoes of the selected shaper, or a constant if only ZV is available
+  #if HAS_MULTI_IMPULSE_SHAPING
+    #define SHAPING_QUEUE_ECHOES_VAR(AXIS) static uint8_t echoes_##AXIS;
+  #else
+    #define SHAPING_QUEUE_ECHOES_VAR(AXIS) static constexpr uint8_t echoes_##AXIS = 1;
+  #endif
+
+  /**
+   * Each echo of a shaped axis has its own head in the queue, with its own delay.
+   * The first echo has the shortest delay and the last echo is furthest behind,
+   * so the last head is the one that frees queue entries.
+   */
+  #define SHAPING_QUEUE_COMMON(AXIS)                                                            \
+    static void decrement_##AXIS(const shaping_time_t interval) {                               \
+      for (uint8_t e = 0; e < echoes_##AXIS; ++e)                                               \
+        if (_peek_##AXIS[e] != shaping_time_t(-1)) _peek_##AXIS[e] -= interval;                 \
+    }                                                                                           \
+    public:                                                                                     \
+    /* Time until the next echo of any impulse */                                               \
+    static shaping_time_t peek_##AXIS() {                                                       \
+      shaping_time_t p = _peek_##AXIS[0];                                                       \
+      for (uint8_t e = 1; e < echoes_##AXIS; ++e) NOMORE(p, _peek_##AXIS[e]);                   \
+      return p;                                                                                 \
+    }                                                                                           \
+    /* Dequeue the echoes that are due, or all pending echoes if forced. Return the signed sum of their factors. */ \
+    HAL_RAMFUNC static int16_t dequeue_##AXIS(const uint8_t (&factor)[SHAPING_MAX_ECHOES], const bool force) { \
+      int16_t dividend = 0;                                                                     \
+      for (uint8_t e = 0; e < echoes_##AXIS; ++e)                                               \
+        if (force ? !empty_##AXIS(e) : !_peek_##AXIS[e])                                        \
+          dividend += _dequeue_##AXIS(e) ? factor[e] : -factor[e];                              \
+      return dividend;                                                                          \
+    }                                                                                           \
+    static bool empty_##AXIS() { return empty_##AXIS(echoes_##AXIS - 1); }                      \
+    static uint16_t free_count_##AXIS() { return _free_count_##AXIS; }                          \
+    static uint8_t echo_count_##AXIS() { return echoes_##AXIS; }                                \
+    static uint16_t get_delay_##AXIS(const uint8_t e=0) { return delay_##AXIS[e]; }             \
+    private:
+
+#if ENABLED(SHAPING_RUN_QUEUE)
+
+  /**
+   * Each shaped axis queues runs of evenly spaced steps in one direction, so a
+   * cruise or a gentle ramp needs a few entries instead of one per step.
+   * A step extends the last run if it lands within SHAPING_RUN_TOLERANCE of
+   * the time predicted by the run's interval, so echo times are never off by more.
+   */
+  typedef struct {
+    shaping_time_t time;      // Time of the first step
+    uint16_t interval;        // Ticks between steps
+    uint8_t count;            // Number of steps
+    bool forward;             // Direction of the steps
+  } shaping_run_t;
+
+  constexpr uint16_t shaping_runs = SHAPING_QUEUE_RUNS;
+  constexpr shaping_time_t shaping_run_tolerance = (STEPPER_TIMER_TICKS_PER_US) * (SHAPING_RUN_TOLERANCE);
+
+  class ShapingQueue {
+    private:
+      static shaping_time_t now;
+
+      #define SHAPING_QUEUE_AXIS_VARS(AXIS)                                                     \
+        static shaping_run_t  runs_##AXIS[shaping_runs];                                        \
+        static shaping_time_t delay_##AXIS[SHAPING_MAX_ECHOES]; /* = shaping_time_t(-1) to disable queueing*/ \
+        static shaping_time_t _peek_##AXIS[SHAPING_MAX_ECHOES];                                 \
+        static shaping_time_t head_time_##AXIS[SHAPING_MAX_ECHOES]; /* Time of the next step to echo */ \
+        static shaping_time_t next_time_##AXIS; /* Predicted time of the next step in the last run */ \
+        static uint16_t head_##AXIS[SHAPING_MAX_ECHOES], tail_##AXIS;                           \
+        static uint8_t head_step_##AXIS[SHAPING_MAX_ECHOES]; /* Steps of the head run already echoed */ \
+        static uint16_t _free_count_##AXIS;                                                     \
+        SHAPING_QUEUE_ECHOES_VAR(AXIS)                                                          \
+        static bool empty_##AXIS(const uint8_t e) { return head_##AXIS[e] == tail_##AXIS; }     \
+        static bool _dequeue_##AXIS(const uint8_t e) {                                          \
+          const shaping_run_t &run = runs_##AXIS[head_##AXIS[e]];                               \
+          const bool forward = run.forward;                                                     \
+          if (++head_step_##AXIS[e] < run.count)                                                \
+            head_time_##AXIS[e] += run.interval;                                                \
+          else {                                                                                \
+            head_step_##AXIS[e] = 0;                                                            \
+            if (++head_##AXIS[e] == shaping_runs) head_##AXIS[e] = 0;                           \
+            head_time_##AXIS[e] = runs_##AXIS[head_##AXIS[e]].time;                             \
+            if (e == echoes_##AXIS - 1) _free_count_##AXIS++;                                   \
+          }                                                                                     \
+          /* A new run may start up to the tolerance before the predicted end of the last one, so it's overdue */ \
+          const shaping_time_t due = head_time_##AXIS[e] + delay_##AXIS[e] - now;               \
+          _peek_##AXIS[e] = empty_##AXIS(e) ? shaping_time_t(-1)                                \
+                          : due > delay_##AXIS[e] + shaping_run_tolerance ? 0 : due;            \
+          return forward;                                                                       \
+        }                                                                                       \
+        SHAPING_QUEUE_COMMON(AXIS)
+
+      TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_AXIS_VARS(x))
+      TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_AXIS_VARS(y))
+      TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_AXIS_VARS(z))
+      TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_AXIS_VARS(e))
+
+      #define SHAPING_QUEUE_PURGE(AXIS)                                                         \
+        for (uint8_t e = 0; e < SHAPING_MAX_ECHOES; ++e) {                                      \
+          head_##AXIS[e] = tail_##AXIS; head_step_##AXIS[e] = 0; _peek_##AXIS[e] = shaping_time_t(-1); \
+        }                                                                                       \
+        _free_count_##AXIS = shaping_runs - 1;
+
+    public:
+      static void decrement_delays(const shaping_time_t interval) {
+        now += interval;
+        TERN_(INPUT_SHAPING_X, decrement_x(interval));
+        TERN_(INPUT_SHAPING_Y, decrement_y(interval));
+        TERN_(INPUT_SHAPING_Z, decrement_z(interval));
+        TERN_(INPUT_SHAPING_E, decrement_e(interval));
+      }
+      static void set_delay(const AxisEnum axis, const uint8_t e, const shaping_time_t delay) {
+        TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) delay_x[e] = delay);
+        TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) delay_y[e] = delay);
+        TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) delay_z[e] = delay);
+        TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) delay_e[e] = delay);
+      }
+      #if HAS_MULTI_IMPULSE_SHAPING
+        // Call with the queue empty. Heads that were unused may have been left behind.
+        static void set_echoes(const AxisEnum axis, const uint8_t n) {
+          TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) { echoes_x = n; SHAPING_QUEUE_PURGE(x) });
+          TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) { echoes_y = n; SHAPING_QUEUE_PURGE(y) });
+          TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) { echoes_z = n; SHAPING_QUEUE_PURGE(z) });
+          TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) { echoes_e = n; SHAPING_QUEUE_PURGE(e) });
+        }
+      #endif
+
+      static void enqueue(const bool x_step, const bool x_forward, const bool y_step, const bool y_forward, const bool z_step, const bool z_forward, const bool e_step=false, const bool e_forward=false) {
+        #define SHAPING_QUEUE_ENQUEUE(AXIS)                                                       \
+          if (AXIS##_step) {                                                                      \
+            bool extended = false;                                                                \
+            if (!empty_##AXIS(0)) {                                                               \
+              shaping_run_t &run = runs_##AXIS[(tail_##AXIS ?: shaping_runs) - 1];                \
+              if (run.forward == AXIS##_forward && run.count < UINT8_MAX) {                       \
+                if (run.count == 1) {                                                             \
+                  /* The second step sets the interval of the run */                              \
+                  const shaping_time_t interval = now - run.time;                                 \
+                  if ((extended = interval <= UINT16_MAX)) {                                      \
+                    run.interval = interval;                                                      \
+                    next_time_##AXIS = now + interval;                                            \
+                  }                                                                               \
+                }                                                                                 \
+                else {                                                                            \
+                  const shaping_time_t error = now - next_time_##AXIS;                            \
+                  if ((extended = error <= shaping_run_tolerance || error >= shaping_time_t(-shaping_run_tolerance))) \
+                    next_time_##AXIS += run.interval;                                             \
+                }                                                                                 \
+                if (extended) run.count++;                                                        \
+              }                                                                                   \
+            }                                                                                     \
+            if (!extended) {                                                                      \
+              for (uint8_t e = 0; e < echoes_##AXIS; ++e)                                         \
+                if (empty_##AXIS(e)) {                                                            \
+                  _peek_##AXIS[e] = delay_##AXIS[e];                                              \
+                  head_time_##AXIS[e] = now;                                                      \
+                }                                                                                 \
+              runs_##AXIS[tail_##AXIS] = { now, 0, 1, AXIS##_forward };                           \
+              if (++tail_##AXIS == shaping_runs) tail_##AXIS = 0;                                 \
+              _free_count_##AXIS--;                                                               \
+            }                                                                                     \
+          }
+
+        TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_ENQUEUE(x))
+        TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_ENQUEUE(y))
+        TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_ENQUEUE(z))
+        TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_ENQUEUE(e))
+      }
+
+      static void purge() {
+        TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_PURGE(x))
+        TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_PURGE(y))
+        TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_PURGE(z))
+        TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_PURGE(e))
+      }
+  };
+
+#else // !SHAPING_RUN_QUEUE
+
+  enum shaping_echo_t : uint8_t { ECHO_NONE = 0, ECHO_FWD = 1, ECHO_BWD = 2 };
   struct shaping_echo_axis_t {
     TERN_(INPUT_SHAPING_X, shaping_echo_t x:2);
     TERN_(INPUT_SHAPING_Y, shaping_echo_t y:2);
     TERN_(INPUT_SHAPING_Z, shaping_echo_t z:2);
+    TERN_(INPUT_SHAPING_E, shaping_echo_t e:2);
   };
 
   class ShapingQueue {
@@ -181,95 +361,106 @@ constexpr ena_mask_t enable_overlap[] = {
       static uint16_t             tail;
 
       #define SHAPING_QUEUE_AXIS_VARS(AXIS)                                                     \
-        static shaping_time_t delay_##AXIS;    /* = shaping_time_t(-1) to disable queueing*/    \
-        static shaping_time_t _peek_##AXIS;                                                     \
-        static uint16_t head_##AXIS;                                                            \
-        static uint16_t _free_count_##AXIS;
+        static shaping_time_t delay_##AXIS[SHAPING_MAX_ECHOES]; /* = shaping_time_t(-1) to disable queueing*/ \
+        static shaping_time_t _peek_##AXIS[SHAPING_MAX_ECHOES];                                 \
+        static uint16_t head_##AXIS[SHAPING_MAX_ECHOES];                                        \
+        static uint16_t _free_count_##AXIS;                                                     \
+        SHAPING_QUEUE_ECHOES_VAR(AXIS)                                                          \
+        static bool empty_##AXIS(const uint8_t e) { return head_##AXIS[e] == tail; }            \
+        static bool _dequeue_##AXIS(const uint8_t e) {                                          \
+          const bool forward = echo_axes[head_##AXIS[e]].AXIS == ECHO_FWD, last = e == echoes_##AXIS - 1; \
+          do {                                                                                  \
+            if (last) _free_count_##AXIS++;                                                     \
+            if (++head_##AXIS[e] == shaping_echoes) head_##AXIS[e] = 0;                         \
+          } while (!empty_##AXIS(e) && echo_axes[head_##AXIS[e]].AXIS == ECHO_NONE);            \
+          _peek_##AXIS[e] = empty_##AXIS(e) ? shaping_time_t(-1) : times[head_##AXIS[e]] + delay_##AXIS[e] - now; \
+          return forward;                                                                       \
+        }                                                                                       \
+        SHAPING_QUEUE_COMMON(AXIS)
 
       TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_AXIS_VARS(x))
       TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_AXIS_VARS(y))
       TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_AXIS_VARS(z))
+      TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_AXIS_VARS(e))
+
+      #define SHAPING_QUEUE_PURGE(AXIS)                                                         \
+        for (uint8_t e = 0; e < SHAPING_MAX_ECHOES; ++e) {                                      \
+          head_##AXIS[e] = tail; _peek_##AXIS[e] = shaping_time_t(-1);                          \
+        }                                                                                       \
+        _free_count_##AXIS = shaping_echoes - 1;
 
     public:
       static void decrement_delays(const shaping_time_t interval) {
         now += interval;
-        TERN_(INPUT_SHAPING_X, if (_peek_x != shaping_time_t(-1)) _peek_x -= interval);
-        TERN_(INPUT_SHAPING_Y, if (_peek_y != shaping_time_t(-1)) _peek_y -= interval);
-        TERN_(INPUT_SHAPING_Z, if (_peek_z != shaping_time_t(-1)) _peek_z -= interval);
+        TERN_(INPUT_SHAPING_X, decrement_x(interval));
+        TERN_(INPUT_SHAPING_Y, decrement_y(interval));
+        TERN_(INPUT_SHAPING_Z, decrement_z(interval));
+        TERN_(INPUT_SHAPING_E, decrement_e(interval));
       }
-      static void set_delay(const AxisEnum axis, const shaping_time_t delay) {
-        TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) delay_x = delay);
-        TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) delay_y = delay);
-        TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) delay_z = delay);
+      static void set_delay(const AxisEnum axis, const uint8_t e, const shaping_time_t delay) {
+        TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) delay_x[e] = delay);
+        TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) delay_y[e] = delay);
+        TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) delay_z[e] = delay);
+        TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) delay_e[e] = delay);
       }
+      #if HAS_MULTI_IMPULSE_SHAPING
+        // Call with the queue empty. Heads that were unused may have been left behind.
+        static void set_echoes(const AxisEnum axis, const uint8_t n) {
+          TERN_(INPUT_SHAPING_X, if (axis == X_AXIS) { echoes_x = n; SHAPING_QUEUE_PURGE(x) });
+          TERN_(INPUT_SHAPING_Y, if (axis == Y_AXIS) { echoes_y = n; SHAPING_QUEUE_PURGE(y) });
+          TERN_(INPUT_SHAPING_Z, if (axis == Z_AXIS) { echoes_z = n; SHAPING_QUEUE_PURGE(z) });
+          TERN_(INPUT_SHAPING_E, if (axis == E_AXIS) { echoes_e = n; SHAPING_QUEUE_PURGE(e) });
+        }
+      #endif
 
-      static void enqueue(const bool x_step, const bool x_forward, const bool y_step, const bool y_forward, const bool z_step, const bool z_forward) {
-        #define SHAPING_QUEUE_ENQUEUE(AXIS)                              \
-          if (AXIS##_step) {                                             \
-            if (head_##AXIS == tail) _peek_##AXIS = delay_##AXIS;        \
-            echo_axes[tail].AXIS = AXIS##_forward ? ECHO_FWD : ECHO_BWD; \
-            _free_count_##AXIS--;                                        \
-          }                                                              \
-          else {                                                         \
-            echo_axes[tail].AXIS = ECHO_NONE;                            \
-            if (head_##AXIS != tail)                                     \
-              _free_count_##AXIS--;                                      \
-            else if (++head_##AXIS == shaping_echoes)                    \
-              head_##AXIS = 0;                                           \
+      static void enqueue(const bool x_step, const bool x_forward, const bool y_step, const bool y_forward, const bool z_step, const bool z_forward, const bool e_step=false, const bool e_forward=false) {
+        #define SHAPING_QUEUE_ENQUEUE(AXIS)                                  \
+          if (AXIS##_step) {                                                 \
+            for (uint8_t e = 0; e < echoes_##AXIS; ++e)                      \
+              if (empty_##AXIS(e)) _peek_##AXIS[e] = delay_##AXIS[e];        \
+            echo_axes[tail].AXIS = AXIS##_forward ? ECHO_FWD : ECHO_BWD;     \
+            _free_count_##AXIS--;                                            \
+          }                                                                  \
+          else {                                                             \
+            echo_axes[tail].AXIS = ECHO_NONE;                                \
+            if (!empty_##AXIS())                                             \
+              _free_count_##AXIS--;                                          \
+            for (uint8_t e = 0; e < echoes_##AXIS; ++e)                      \
+              if (empty_##AXIS(e) && ++head_##AXIS[e] == shaping_echoes)     \
+                head_##AXIS[e] = 0;                                          \
           }
 
         TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_ENQUEUE(x))
         TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_ENQUEUE(y))
         TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_ENQUEUE(z))
+        TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_ENQUEUE(e))
 
         times[tail] = now;
         if (++tail == shaping_echoes) tail = 0;
       }
 
-      #define SHAPING_QUEUE_DEQUEUE(AXIS)                                                                  \
-        bool forward = echo_axes[head_##AXIS].AXIS == ECHO_FWD;                                            \
-        do {                                                                                               \
-          _free_count_##AXIS++;                                                                            \
-          if (++head_##AXIS == shaping_echoes) head_##AXIS = 0;                                            \
-        } while (head_##AXIS != tail && echo_axes[head_##AXIS].AXIS == ECHO_NONE);                         \
-        _peek_##AXIS = head_##AXIS == tail ? shaping_time_t(-1) : times[head_##AXIS] + delay_##AXIS - now; \
-        return forward;
-
-      #if ENABLED(INPUT_SHAPING_X)
-        static shaping_time_t peek_x() { return _peek_x; }
-        static bool dequeue_x() { SHAPING_QUEUE_DEQUEUE(x) }
-        static bool empty_x() { return head_x == tail; }
-        static uint16_t free_count_x() { return _free_count_x; }
-        static uint16_t get_delay_x() { return delay_x; }
-      #endif
-      #if ENABLED(INPUT_SHAPING_Y)
-        static shaping_time_t peek_y() { return _peek_y; }
-        static bool dequeue_y() { SHAPING_QUEUE_DEQUEUE(y) }
-        static bool empty_y() { return head_y == tail; }
-        static uint16_t free_count_y() { return _free_count_y; }
-        static uint16_t get_delay_y() { return delay_y; }
-      #endif
-      #if ENABLED(INPUT_SHAPING_Z)
-        static shaping_time_t peek_z() { return _peek_z; }
-        static bool dequeue_z() { SHAPING_QUEUE_DEQUEUE(z) }
-        static bool empty_z() { return head_z == tail; }
-        static uint16_t free_count_z() { return _free_count_z; }
-        static uint16_t get_delay_z() { return delay_z; }
-      #endif
       static void purge() {
-        const auto st = shaping_time_t(-1);
-        #if ENABLED(INPUT_SHAPING_X)
-          head_x = tail; _free_count_x = shaping_echoes - 1; _peek_x = st;
-        #endif
-        #if ENABLED(INPUT_SHAPING_Y)
-          head_y = tail; _free_count_y = shaping_echoes - 1; _peek_y = st;
-        #endif
-        #if ENABLED(INPUT_SHAPING_Z)
-          head_z = tail; _free_count_z = shaping_echoes - 1; _peek_z = st;
-        #endif
+        TERN_(INPUT_SHAPING_X, SHAPING_QUEUE_PURGE(x))
+        TERN_(INPUT_SHAPING_Y, SHAPING_QUEUE_PURGE(y))
+        TERN_(INPUT_SHAPING_Z, SHAPING_QUEUE_PURGE(z))
+        TERN_(INPUT_SHAPING_E, SHAPING_QUEUE_PURGE(e))
       }
   };
 
+#endif // !SHAPING_RUN_QUEUE
+
+  // Shaper types for M593 T. Impulse counts are 2, 3, 3, 3, 4, 4.
+  enum shaping_type_t : uint8_t {
+    SHAPING_ZV,
+    #if HAS_MULTI_IMPULSE_SHAPING
+      SHAPING_ZVD, SHAPING_MZV, SHAPING_EI,
+    #endif
+    #if HAS_4_IMPULSE_SHAPING
+      SHAPING_ZVDD, SHAPING_2HEI,
+    #endif
+    SHAPING_TYPE_COUNT
+  };
+
   struct ShapeParams {
     float frequency;
     float zeta;
@@ -277,7 +468,8 @@ constexpr ena_mask_t enable_overlap[] = {
     bool forward : 1;
     int16_t delta_error = 0;    // delta_error for seconday bresenham mod 128
     uint8_t factor1;
-    uint8_t factor2;
+    uint8_t echo_factor[SHAPING_MAX_ECHOES];
+    shaping_type_t type = SHAPING_ZV;
     int32_t last_block_end_pos = 0;
   };
 
@@ -326,6 +518,7 @@ class Stepper {
   friend class FTMotion;
   friend class MarlinSettings;
   friend void stepperTask(void *);
+  friend void step_stream_fill();
 
   public:
 
@@ -430,7 +623,7 @@ class Stepper {
       static uint8_t steps_per_isr;
     #endif
 
-    #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
+    #if !HAS_RATE_MULTISTEPPING
       static hal_timer_t time_spent_in_isr, time_spent_out_isr;
     #endif
 
@@ -477,6 +670,9 @@ class Stepper {
       #if ENABLED(INPUT_SHAPING_Z)
         static ShapeParams shaping_z;
       #endif
+      #if ENABLED(INPUT_SHAPING_E)
+        static ShapeParams shaping_e;
+      #endif
     #endif
 
     #if ENABLED(LIN_ADVANCE)
@@ -502,6 +698,13 @@ class Stepper {
       static hal_timer_t nextBabystepISR;
     #endif
 
+    #if ENABLED(BACKLASH_STEPPER)
+      static constexpr hal_timer_t BACKLASH_NEVER = HAL_TIMER_TYPE_MAX;
+      static hal_timer_t nextBacklashISR,   // Ticks until the next backlash correction step
+                         backlash_interval; // Ticks between correction steps for the current block
+      static xyz_long_t backlash_pending;   // Correction steps still to play, signed by direction
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -521,6 +724,10 @@ class Stepper {
     static xyze_int8_t count_direction;
 
   public:
+    #if ENABLED(FILAMENT_MOTION_TRACKING)
+      static volatile uint8_t position_sets;  // Counts each time count_position is set, so followers of E can start over
+    #endif
+
     // Initialize stepper hardware
     static void init();
 
@@ -567,6 +774,13 @@ class Stepper {
       #endif
     #endif
 
+    #if ENABLED(BACKLASH_STEPPER)
+      // The Backlash correction ISR phase
+      static hal_timer_t backlash_isr();
+      static void backlash_step();
+      static void queue_backlash_steps();
+    #endif
+
     #if ENABLED(BABYSTEPPING)
       // The Babystepping ISR phase
       static hal_timer_t babystepping_isr();
@@ -587,7 +801,7 @@ class Stepper {
         const bool was_on = hal.isr_state();
         hal.isr_off();
 
-        const bool result = TERN0(INPUT_SHAPING_X, !ShapingQueue::empty_x()) || TERN0(INPUT_SHAPING_Y, !ShapingQueue::empty_y()) || TERN0(INPUT_SHAPING_Z, !ShapingQueue::empty_z());
+        const bool result = TERN0(INPUT_SHAPING_X, !ShapingQueue::empty_x()) || TERN0(INPUT_SHAPING_Y, !ShapingQueue::empty_y()) || TERN0(INPUT_SHAPING_Z, !ShapingQueue::empty_z()) || TERN0(INPUT_SHAPING_E, !ShapingQueue::empty_e());
 
         if (was_on) hal.isr_on();
 
@@ -631,12 +845,22 @@ class Stepper {
     // The last movement direction was not null on the specified axis. Note that motor direction is not necessarily the same.
     FORCE_INLINE static bool axis_is_moving(const AxisEnum axis) { return axis_did_move[axis]; }
 
-    // Handle a triggered endstop
-    static void endstop_triggered(const AxisEnum axis);
+    // Handle a triggered endstop, optionally at a captured edge position
+    static void endstop_triggered(const AxisEnum axis OPTARG(ENDSTOP_EDGE_CAPTURE, const xyze_long_t * const edge_pos=nullptr));
+
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      // Step counts for an endstop edge. May be called from ISR context.
+      static xyze_long_t edge_position();
+    #endif
 
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
+    #if ENABLED(TMC_CRUISE_CURRENT)
+      // Time left at constant speed in the current block (ms), or 0 if it isn't cruising
+      static uint32_t cruise_ms_left();
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void set_digipot_value_spi(const int16_t address, const int16_t value);
       static void set_digipot_current(const uint8_t driver, const int16_t current);
@@ -753,6 +977,10 @@ class Stepper {
       static float get_shaping_damping_ratio(const AxisEnum axis);
       static void set_shaping_frequency(const AxisEnum axis, const float freq);
       static float get_shaping_frequency(const AxisEnum axis);
+      #if HAS_MULTI_IMPULSE_SHAPING
+        static void set_shaping_type(const AxisEnum axis, const shaping_type_t type);
+        static shaping_type_t get_shaping_type(const AxisEnum axis);
+      #endif
     #endif
 
   private:
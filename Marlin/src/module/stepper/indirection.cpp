@@ -44,3 +44,30 @@ void reset_stepper_drivers() {
   // Flags to optimize axis enabled state
   xyz_bool_t axis_sw_enabled; // = { false, false, false }
 #endif
+
+#if ENABLED(STEP_PORT_BATCHING)
+
+  uint8_t StepPortBatch::ports; // = 0
+  GPIO_TypeDef *StepPortBatch::port[4];
+  uint8_t StepPortBatch::index[4];
+  uint32_t StepPortBatch::start_bits[4], StepPortBatch::stop_bits[4];
+
+  void StepPortBatch::init() {
+    ports = 0;
+    auto add_pin = [](const uint8_t slot, const pin_t pin, const bool state) {
+      GPIO_TypeDef * const p = FASTIO_PORT(pin);
+      uint8_t i = 0;
+      while (i < ports && port[i] != p) ++i;
+      if (i == ports) port[ports++] = p;
+      const uint32_t bit = FASTIO_BIT(pin);
+      index[slot] = i;
+      start_bits[slot] = state ? bit : bit << 16;   // BSRR upper half resets the pin
+      stop_bits[slot]  = state ? bit << 16 : bit;
+    };
+    TERN_(HAS_X_STEP,  add_pin(0, X_STEP_PIN,  STEP_STATE_X));
+    TERN_(HAS_Y_STEP,  add_pin(1, Y_STEP_PIN,  STEP_STATE_Y));
+    TERN_(HAS_Z_STEP,  add_pin(2, Z_STEP_PIN,  STEP_STATE_Z));
+    TERN_(HAS_E0_STEP, add_pin(3, E0_STEP_PIN, STEP_STATE_E));
+  }
+
+#endif
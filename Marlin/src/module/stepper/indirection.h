@@ -78,6 +78,18 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
 
 #define INVERT_DIR(AXIS, D) (TERN_(INVERT_## AXIS ##_DIR, !)(D))
 
+// STEP and DIR pins go through the step stream, if any
+#if ENABLED(STEP_DMA_STREAM)
+  #include "../../HAL/STM32F1/step_stream.h"
+  #define STEP_PIN_WRITE(IO,V) step_stream_write(IO, V, false)
+  #define DIR_PIN_WRITE(IO,V) step_stream_write(IO, V, true)
+  #define STEPPER_PIN_READ(IO) step_stream_read(IO)
+#else
+  #define STEP_PIN_WRITE WRITE
+  #define DIR_PIN_WRITE WRITE
+  #define STEPPER_PIN_READ READ
+#endif
+
 // X Stepper
 #if HAS_X_AXIS
   #ifndef X_ENABLE_INIT_STATE
@@ -90,14 +102,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef X_DIR_INIT
     #define X_DIR_INIT() SET_OUTPUT(X_DIR_PIN)
-    #define X_DIR_WRITE(STATE) WRITE(X_DIR_PIN,INVERT_DIR(X, STATE))
-    #define X_DIR_READ() INVERT_DIR(X, bool(READ(X_DIR_PIN)))
+    #define X_DIR_WRITE(STATE) DIR_PIN_WRITE(X_DIR_PIN,INVERT_DIR(X, STATE))
+    #define X_DIR_READ() INVERT_DIR(X, bool(STEPPER_PIN_READ(X_DIR_PIN)))
   #endif
   #define X_STEP_INIT() SET_OUTPUT(X_STEP_PIN)
   #ifndef X_STEP_WRITE
-    #define X_STEP_WRITE(STATE) WRITE(X_STEP_PIN,STATE)
+    #define X_STEP_WRITE(STATE) STEP_PIN_WRITE(X_STEP_PIN,STATE)
   #endif
-  #define X_STEP_READ() bool(READ(X_STEP_PIN))
+  #define X_STEP_READ() bool(STEPPER_PIN_READ(X_STEP_PIN))
 #endif
 
 // Y Stepper
@@ -112,14 +124,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Y_DIR_INIT
     #define Y_DIR_INIT() SET_OUTPUT(Y_DIR_PIN)
-    #define Y_DIR_WRITE(STATE) WRITE(Y_DIR_PIN,INVERT_DIR(Y, STATE))
-    #define Y_DIR_READ() INVERT_DIR(Y, bool(READ(Y_DIR_PIN)))
+    #define Y_DIR_WRITE(STATE) DIR_PIN_WRITE(Y_DIR_PIN,INVERT_DIR(Y, STATE))
+    #define Y_DIR_READ() INVERT_DIR(Y, bool(STEPPER_PIN_READ(Y_DIR_PIN)))
   #endif
   #define Y_STEP_INIT() SET_OUTPUT(Y_STEP_PIN)
   #ifndef Y_STEP_WRITE
-    #define Y_STEP_WRITE(STATE) WRITE(Y_STEP_PIN,STATE)
+    #define Y_STEP_WRITE(STATE) STEP_PIN_WRITE(Y_STEP_PIN,STATE)
   #endif
-  #define Y_STEP_READ() bool(READ(Y_STEP_PIN))
+  #define Y_STEP_READ() bool(STEPPER_PIN_READ(Y_STEP_PIN))
 #endif
 
 // Z Stepper
@@ -134,14 +146,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Z_DIR_INIT
     #define Z_DIR_INIT() SET_OUTPUT(Z_DIR_PIN)
-    #define Z_DIR_WRITE(STATE) WRITE(Z_DIR_PIN,INVERT_DIR(Z, STATE))
-    #define Z_DIR_READ() INVERT_DIR(Z, bool(READ(Z_DIR_PIN)))
+    #define Z_DIR_WRITE(STATE) DIR_PIN_WRITE(Z_DIR_PIN,INVERT_DIR(Z, STATE))
+    #define Z_DIR_READ() INVERT_DIR(Z, bool(STEPPER_PIN_READ(Z_DIR_PIN)))
   #endif
   #define Z_STEP_INIT() SET_OUTPUT(Z_STEP_PIN)
   #ifndef Z_STEP_WRITE
-    #define Z_STEP_WRITE(STATE) WRITE(Z_STEP_PIN,STATE)
+    #define Z_STEP_WRITE(STATE) STEP_PIN_WRITE(Z_STEP_PIN,STATE)
   #endif
-  #define Z_STEP_READ() bool(READ(Z_STEP_PIN))
+  #define Z_STEP_READ() bool(STEPPER_PIN_READ(Z_STEP_PIN))
 #endif
 
 // X2 Stepper
@@ -156,14 +168,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef X2_DIR_INIT
     #define X2_DIR_INIT() SET_OUTPUT(X2_DIR_PIN)
-    #define X2_DIR_WRITE(STATE) WRITE(X2_DIR_PIN,INVERT_DIR(X2, STATE))
-    #define X2_DIR_READ() INVERT_DIR(X2, bool(READ(X2_DIR_PIN)))
+    #define X2_DIR_WRITE(STATE) DIR_PIN_WRITE(X2_DIR_PIN,INVERT_DIR(X2, STATE))
+    #define X2_DIR_READ() INVERT_DIR(X2, bool(STEPPER_PIN_READ(X2_DIR_PIN)))
   #endif
   #define X2_STEP_INIT() SET_OUTPUT(X2_STEP_PIN)
   #ifndef X2_STEP_WRITE
-    #define X2_STEP_WRITE(STATE) WRITE(X2_STEP_PIN,STATE)
+    #define X2_STEP_WRITE(STATE) STEP_PIN_WRITE(X2_STEP_PIN,STATE)
   #endif
-  #define X2_STEP_READ() bool(READ(X2_STEP_PIN))
+  #define X2_STEP_READ() bool(STEPPER_PIN_READ(X2_STEP_PIN))
 #endif
 
 // Y2 Stepper
@@ -178,14 +190,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Y2_DIR_INIT
     #define Y2_DIR_INIT() SET_OUTPUT(Y2_DIR_PIN)
-    #define Y2_DIR_WRITE(STATE) WRITE(Y2_DIR_PIN,INVERT_DIR(Y2, STATE))
-    #define Y2_DIR_READ() INVERT_DIR(Y2, bool(READ(Y2_DIR_PIN)))
+    #define Y2_DIR_WRITE(STATE) DIR_PIN_WRITE(Y2_DIR_PIN,INVERT_DIR(Y2, STATE))
+    #define Y2_DIR_READ() INVERT_DIR(Y2, bool(STEPPER_PIN_READ(Y2_DIR_PIN)))
   #endif
   #define Y2_STEP_INIT() SET_OUTPUT(Y2_STEP_PIN)
   #ifndef Y2_STEP_WRITE
-    #define Y2_STEP_WRITE(STATE) WRITE(Y2_STEP_PIN,STATE)
+    #define Y2_STEP_WRITE(STATE) STEP_PIN_WRITE(Y2_STEP_PIN,STATE)
   #endif
-  #define Y2_STEP_READ() bool(READ(Y2_STEP_PIN))
+  #define Y2_STEP_READ() bool(STEPPER_PIN_READ(Y2_STEP_PIN))
 #else
   #define Y2_DIR_WRITE(STATE) NOOP
 #endif
@@ -202,14 +214,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Z2_DIR_INIT
     #define Z2_DIR_INIT() SET_OUTPUT(Z2_DIR_PIN)
-    #define Z2_DIR_WRITE(STATE) WRITE(Z2_DIR_PIN,INVERT_DIR(Z2, STATE))
-    #define Z2_DIR_READ() INVERT_DIR(Z2, bool(READ(Z2_DIR_PIN)))
+    #define Z2_DIR_WRITE(STATE) DIR_PIN_WRITE(Z2_DIR_PIN,INVERT_DIR(Z2, STATE))
+    #define Z2_DIR_READ() INVERT_DIR(Z2, bool(STEPPER_PIN_READ(Z2_DIR_PIN)))
   #endif
   #define Z2_STEP_INIT() SET_OUTPUT(Z2_STEP_PIN)
   #ifndef Z2_STEP_WRITE
-    #define Z2_STEP_WRITE(STATE) WRITE(Z2_STEP_PIN,STATE)
+    #define Z2_STEP_WRITE(STATE) STEP_PIN_WRITE(Z2_STEP_PIN,STATE)
   #endif
-  #define Z2_STEP_READ() bool(READ(Z2_STEP_PIN))
+  #define Z2_STEP_READ() bool(STEPPER_PIN_READ(Z2_STEP_PIN))
 #else
   #define Z2_DIR_WRITE(STATE) NOOP
 #endif
@@ -226,14 +238,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Z3_DIR_INIT
     #define Z3_DIR_INIT() SET_OUTPUT(Z3_DIR_PIN)
-    #define Z3_DIR_WRITE(STATE) WRITE(Z3_DIR_PIN,INVERT_DIR(Z3, STATE))
-    #define Z3_DIR_READ() INVERT_DIR(Z3, bool(READ(Z3_DIR_PIN)))
+    #define Z3_DIR_WRITE(STATE) DIR_PIN_WRITE(Z3_DIR_PIN,INVERT_DIR(Z3, STATE))
+    #define Z3_DIR_READ() INVERT_DIR(Z3, bool(STEPPER_PIN_READ(Z3_DIR_PIN)))
   #endif
   #define Z3_STEP_INIT() SET_OUTPUT(Z3_STEP_PIN)
   #ifndef Z3_STEP_WRITE
-    #define Z3_STEP_WRITE(STATE) WRITE(Z3_STEP_PIN,STATE)
+    #define Z3_STEP_WRITE(STATE) STEP_PIN_WRITE(Z3_STEP_PIN,STATE)
   #endif
-  #define Z3_STEP_READ() bool(READ(Z3_STEP_PIN))
+  #define Z3_STEP_READ() bool(STEPPER_PIN_READ(Z3_STEP_PIN))
 #else
   #define Z3_DIR_WRITE(STATE) NOOP
 #endif
@@ -250,14 +262,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef Z4_DIR_INIT
     #define Z4_DIR_INIT() SET_OUTPUT(Z4_DIR_PIN)
-    #define Z4_DIR_WRITE(STATE) WRITE(Z4_DIR_PIN,INVERT_DIR(Z4, STATE))
-    #define Z4_DIR_READ() INVERT_DIR(Z4, bool(READ(Z4_DIR_PIN)))
+    #define Z4_DIR_WRITE(STATE) DIR_PIN_WRITE(Z4_DIR_PIN,INVERT_DIR(Z4, STATE))
+    #define Z4_DIR_READ() INVERT_DIR(Z4, bool(STEPPER_PIN_READ(Z4_DIR_PIN)))
   #endif
   #define Z4_STEP_INIT() SET_OUTPUT(Z4_STEP_PIN)
   #ifndef Z4_STEP_WRITE
-    #define Z4_STEP_WRITE(STATE) WRITE(Z4_STEP_PIN,STATE)
+    #define Z4_STEP_WRITE(STATE) STEP_PIN_WRITE(Z4_STEP_PIN,STATE)
   #endif
-  #define Z4_STEP_READ() bool(READ(Z4_STEP_PIN))
+  #define Z4_STEP_READ() bool(STEPPER_PIN_READ(Z4_STEP_PIN))
 #else
   #define Z4_DIR_WRITE(STATE) NOOP
 #endif
@@ -274,14 +286,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef I_DIR_INIT
     #define I_DIR_INIT() SET_OUTPUT(I_DIR_PIN)
-    #define I_DIR_WRITE(STATE) WRITE(I_DIR_PIN,INVERT_DIR(I, STATE))
-    #define I_DIR_READ() INVERT_DIR(I, bool(READ(I_DIR_PIN)))
+    #define I_DIR_WRITE(STATE) DIR_PIN_WRITE(I_DIR_PIN,INVERT_DIR(I, STATE))
+    #define I_DIR_READ() INVERT_DIR(I, bool(STEPPER_PIN_READ(I_DIR_PIN)))
   #endif
   #define I_STEP_INIT() SET_OUTPUT(I_STEP_PIN)
   #ifndef I_STEP_WRITE
-    #define I_STEP_WRITE(STATE) WRITE(I_STEP_PIN,STATE)
+    #define I_STEP_WRITE(STATE) STEP_PIN_WRITE(I_STEP_PIN,STATE)
   #endif
-  #define I_STEP_READ() bool(READ(I_STEP_PIN))
+  #define I_STEP_READ() bool(STEPPER_PIN_READ(I_STEP_PIN))
 #endif
 
 // J Stepper
@@ -296,14 +308,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef J_DIR_INIT
     #define J_DIR_INIT() SET_OUTPUT(J_DIR_PIN)
-    #define J_DIR_WRITE(STATE) WRITE(J_DIR_PIN,INVERT_DIR(J, STATE))
-    #define J_DIR_READ() INVERT_DIR(J, bool(READ(J_DIR_PIN)))
+    #define J_DIR_WRITE(STATE) DIR_PIN_WRITE(J_DIR_PIN,INVERT_DIR(J, STATE))
+    #define J_DIR_READ() INVERT_DIR(J, bool(STEPPER_PIN_READ(J_DIR_PIN)))
   #endif
   #define J_STEP_INIT() SET_OUTPUT(J_STEP_PIN)
   #ifndef J_STEP_WRITE
-    #define J_STEP_WRITE(STATE) WRITE(J_STEP_PIN,STATE)
+    #define J_STEP_WRITE(STATE) STEP_PIN_WRITE(J_STEP_PIN,STATE)
   #endif
-  #define J_STEP_READ() bool(READ(J_STEP_PIN))
+  #define J_STEP_READ() bool(STEPPER_PIN_READ(J_STEP_PIN))
 #endif
 
 // K Stepper
@@ -318,14 +330,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef K_DIR_INIT
     #define K_DIR_INIT() SET_OUTPUT(K_DIR_PIN)
-    #define K_DIR_WRITE(STATE) WRITE(K_DIR_PIN,INVERT_DIR(K, STATE))
-    #define K_DIR_READ() INVERT_DIR(K, bool(READ(K_DIR_PIN)))
+    #define K_DIR_WRITE(STATE) DIR_PIN_WRITE(K_DIR_PIN,INVERT_DIR(K, STATE))
+    #define K_DIR_READ() INVERT_DIR(K, bool(STEPPER_PIN_READ(K_DIR_PIN)))
   #endif
   #define K_STEP_INIT() SET_OUTPUT(K_STEP_PIN)
   #ifndef K_STEP_WRITE
-    #define K_STEP_WRITE(STATE) WRITE(K_STEP_PIN,STATE)
+    #define K_STEP_WRITE(STATE) STEP_PIN_WRITE(K_STEP_PIN,STATE)
   #endif
-  #define K_STEP_READ() bool(READ(K_STEP_PIN))
+  #define K_STEP_READ() bool(STEPPER_PIN_READ(K_STEP_PIN))
 #endif
 
 // U Stepper
@@ -340,14 +352,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef U_DIR_INIT
     #define U_DIR_INIT() SET_OUTPUT(U_DIR_PIN)
-    #define U_DIR_WRITE(STATE) WRITE(U_DIR_PIN,INVERT_DIR(U, STATE))
-    #define U_DIR_READ() INVERT_DIR(U, bool(READ(U_DIR_PIN)))
+    #define U_DIR_WRITE(STATE) DIR_PIN_WRITE(U_DIR_PIN,INVERT_DIR(U, STATE))
+    #define U_DIR_READ() INVERT_DIR(U, bool(STEPPER_PIN_READ(U_DIR_PIN)))
   #endif
   #define U_STEP_INIT() SET_OUTPUT(U_STEP_PIN)
   #ifndef U_STEP_WRITE
-    #define U_STEP_WRITE(STATE) WRITE(U_STEP_PIN,STATE)
+    #define U_STEP_WRITE(STATE) STEP_PIN_WRITE(U_STEP_PIN,STATE)
   #endif
-  #define U_STEP_READ() bool(READ(U_STEP_PIN))
+  #define U_STEP_READ() bool(STEPPER_PIN_READ(U_STEP_PIN))
 #endif
 
 // V Stepper
@@ -362,14 +374,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef V_DIR_INIT
     #define V_DIR_INIT() SET_OUTPUT(V_DIR_PIN)
-    #define V_DIR_WRITE(STATE) WRITE(V_DIR_PIN,INVERT_DIR(V, STATE))
-    #define V_DIR_READ() INVERT_DIR(V, bool(READ(V_DIR_PIN)))
+    #define V_DIR_WRITE(STATE) DIR_PIN_WRITE(V_DIR_PIN,INVERT_DIR(V, STATE))
+    #define V_DIR_READ() INVERT_DIR(V, bool(STEPPER_PIN_READ(V_DIR_PIN)))
   #endif
   #define V_STEP_INIT() SET_OUTPUT(V_STEP_PIN)
   #ifndef V_STEP_WRITE
-    #define V_STEP_WRITE(STATE) WRITE(V_STEP_PIN,STATE)
+    #define V_STEP_WRITE(STATE) STEP_PIN_WRITE(V_STEP_PIN,STATE)
   #endif
-  #define V_STEP_READ() bool(READ(V_STEP_PIN))
+  #define V_STEP_READ() bool(STEPPER_PIN_READ(V_STEP_PIN))
 #endif
 
 // W Stepper
@@ -384,14 +396,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef W_DIR_INIT
     #define W_DIR_INIT() SET_OUTPUT(W_DIR_PIN)
-    #define W_DIR_WRITE(STATE) WRITE(W_DIR_PIN,INVERT_DIR(W, STATE))
-    #define W_DIR_READ() INVERT_DIR(W, bool(READ(W_DIR_PIN)))
+    #define W_DIR_WRITE(STATE) DIR_PIN_WRITE(W_DIR_PIN,INVERT_DIR(W, STATE))
+    #define W_DIR_READ() INVERT_DIR(W, bool(STEPPER_PIN_READ(W_DIR_PIN)))
   #endif
   #define W_STEP_INIT() SET_OUTPUT(W_STEP_PIN)
   #ifndef W_STEP_WRITE
-    #define W_STEP_WRITE(STATE) WRITE(W_STEP_PIN,STATE)
+    #define W_STEP_WRITE(STATE) STEP_PIN_WRITE(W_STEP_PIN,STATE)
   #endif
-  #define W_STEP_READ() bool(READ(W_STEP_PIN))
+  #define W_STEP_READ() bool(STEPPER_PIN_READ(W_STEP_PIN))
 #endif
 
 // E0 Stepper
@@ -409,14 +421,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E0_DIR_INIT
     #define E0_DIR_INIT() SET_OUTPUT(E0_DIR_PIN)
-    #define E0_DIR_WRITE(STATE) WRITE(E0_DIR_PIN,INVERT_DIR(E0, STATE))
-    #define E0_DIR_READ() INVERT_DIR(E0, bool(READ(E0_DIR_PIN)))
+    #define E0_DIR_WRITE(STATE) DIR_PIN_WRITE(E0_DIR_PIN,INVERT_DIR(E0, STATE))
+    #define E0_DIR_READ() INVERT_DIR(E0, bool(STEPPER_PIN_READ(E0_DIR_PIN)))
   #endif
   #define E0_STEP_INIT() SET_OUTPUT(E0_STEP_PIN)
   #ifndef E0_STEP_WRITE
-    #define E0_STEP_WRITE(STATE) WRITE(E0_STEP_PIN,STATE)
+    #define E0_STEP_WRITE(STATE) STEP_PIN_WRITE(E0_STEP_PIN,STATE)
   #endif
-  #define E0_STEP_READ() bool(READ(E0_STEP_PIN))
+  #define E0_STEP_READ() bool(STEPPER_PIN_READ(E0_STEP_PIN))
 #endif
 
 // E1 Stepper
@@ -431,14 +443,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E1_DIR_INIT
     #define E1_DIR_INIT() SET_OUTPUT(E1_DIR_PIN)
-    #define E1_DIR_WRITE(STATE) WRITE(E1_DIR_PIN,INVERT_DIR(E1, STATE))
-    #define E1_DIR_READ() INVERT_DIR(E1, bool(READ(E1_DIR_PIN)))
+    #define E1_DIR_WRITE(STATE) DIR_PIN_WRITE(E1_DIR_PIN,INVERT_DIR(E1, STATE))
+    #define E1_DIR_READ() INVERT_DIR(E1, bool(STEPPER_PIN_READ(E1_DIR_PIN)))
   #endif
   #define E1_STEP_INIT() SET_OUTPUT(E1_STEP_PIN)
   #ifndef E1_STEP_WRITE
-    #define E1_STEP_WRITE(STATE) WRITE(E1_STEP_PIN,STATE)
+    #define E1_STEP_WRITE(STATE) STEP_PIN_WRITE(E1_STEP_PIN,STATE)
   #endif
-  #define E1_STEP_READ() bool(READ(E1_STEP_PIN))
+  #define E1_STEP_READ() bool(STEPPER_PIN_READ(E1_STEP_PIN))
 #endif
 
 // E2 Stepper
@@ -453,14 +465,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E2_DIR_INIT
     #define E2_DIR_INIT() SET_OUTPUT(E2_DIR_PIN)
-    #define E2_DIR_WRITE(STATE) WRITE(E2_DIR_PIN,INVERT_DIR(E2, STATE))
-    #define E2_DIR_READ() INVERT_DIR(E2, bool(READ(E2_DIR_PIN)))
+    #define E2_DIR_WRITE(STATE) DIR_PIN_WRITE(E2_DIR_PIN,INVERT_DIR(E2, STATE))
+    #define E2_DIR_READ() INVERT_DIR(E2, bool(STEPPER_PIN_READ(E2_DIR_PIN)))
   #endif
   #define E2_STEP_INIT() SET_OUTPUT(E2_STEP_PIN)
   #ifndef E2_STEP_WRITE
-    #define E2_STEP_WRITE(STATE) WRITE(E2_STEP_PIN,STATE)
+    #define E2_STEP_WRITE(STATE) STEP_PIN_WRITE(E2_STEP_PIN,STATE)
   #endif
-  #define E2_STEP_READ() bool(READ(E2_STEP_PIN))
+  #define E2_STEP_READ() bool(STEPPER_PIN_READ(E2_STEP_PIN))
 #endif
 
 // E3 Stepper
@@ -475,14 +487,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E3_DIR_INIT
     #define E3_DIR_INIT() SET_OUTPUT(E3_DIR_PIN)
-    #define E3_DIR_WRITE(STATE) WRITE(E3_DIR_PIN,INVERT_DIR(E3, STATE))
-    #define E3_DIR_READ() INVERT_DIR(E3, bool(READ(E3_DIR_PIN)))
+    #define E3_DIR_WRITE(STATE) DIR_PIN_WRITE(E3_DIR_PIN,INVERT_DIR(E3, STATE))
+    #define E3_DIR_READ() INVERT_DIR(E3, bool(STEPPER_PIN_READ(E3_DIR_PIN)))
   #endif
   #define E3_STEP_INIT() SET_OUTPUT(E3_STEP_PIN)
   #ifndef E3_STEP_WRITE
-    #define E3_STEP_WRITE(STATE) WRITE(E3_STEP_PIN,STATE)
+    #define E3_STEP_WRITE(STATE) STEP_PIN_WRITE(E3_STEP_PIN,STATE)
   #endif
-  #define E3_STEP_READ() bool(READ(E3_STEP_PIN))
+  #define E3_STEP_READ() bool(STEPPER_PIN_READ(E3_STEP_PIN))
 #endif
 
 // E4 Stepper
@@ -497,14 +509,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E4_DIR_INIT
     #define E4_DIR_INIT() SET_OUTPUT(E4_DIR_PIN)
-    #define E4_DIR_WRITE(STATE) WRITE(E4_DIR_PIN,INVERT_DIR(E4, STATE))
-    #define E4_DIR_READ() INVERT_DIR(E4, bool(READ(E4_DIR_PIN)))
+    #define E4_DIR_WRITE(STATE) DIR_PIN_WRITE(E4_DIR_PIN,INVERT_DIR(E4, STATE))
+    #define E4_DIR_READ() INVERT_DIR(E4, bool(STEPPER_PIN_READ(E4_DIR_PIN)))
   #endif
   #define E4_STEP_INIT() SET_OUTPUT(E4_STEP_PIN)
   #ifndef E4_STEP_WRITE
-    #define E4_STEP_WRITE(STATE) WRITE(E4_STEP_PIN,STATE)
+    #define E4_STEP_WRITE(STATE) STEP_PIN_WRITE(E4_STEP_PIN,STATE)
   #endif
-  #define E4_STEP_READ() bool(READ(E4_STEP_PIN))
+  #define E4_STEP_READ() bool(STEPPER_PIN_READ(E4_STEP_PIN))
 #endif
 
 // E5 Stepper
@@ -519,14 +531,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E5_DIR_INIT
     #define E5_DIR_INIT() SET_OUTPUT(E5_DIR_PIN)
-    #define E5_DIR_WRITE(STATE) WRITE(E5_DIR_PIN,INVERT_DIR(E5, STATE))
-    #define E5_DIR_READ() INVERT_DIR(E5, bool(READ(E5_DIR_PIN)))
+    #define E5_DIR_WRITE(STATE) DIR_PIN_WRITE(E5_DIR_PIN,INVERT_DIR(E5, STATE))
+    #define E5_DIR_READ() INVERT_DIR(E5, bool(STEPPER_PIN_READ(E5_DIR_PIN)))
   #endif
   #define E5_STEP_INIT() SET_OUTPUT(E5_STEP_PIN)
   #ifndef E5_STEP_WRITE
-    #define E5_STEP_WRITE(STATE) WRITE(E5_STEP_PIN,STATE)
+    #define E5_STEP_WRITE(STATE) STEP_PIN_WRITE(E5_STEP_PIN,STATE)
   #endif
-  #define E5_STEP_READ() bool(READ(E5_STEP_PIN))
+  #define E5_STEP_READ() bool(STEPPER_PIN_READ(E5_STEP_PIN))
 #endif
 
 // E6 Stepper
@@ -541,14 +553,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E6_DIR_INIT
     #define E6_DIR_INIT() SET_OUTPUT(E6_DIR_PIN)
-    #define E6_DIR_WRITE(STATE) WRITE(E6_DIR_PIN,INVERT_DIR(E6, STATE))
-    #define E6_DIR_READ() INVERT_DIR(E6, bool(READ(E6_DIR_PIN)))
+    #define E6_DIR_WRITE(STATE) DIR_PIN_WRITE(E6_DIR_PIN,INVERT_DIR(E6, STATE))
+    #define E6_DIR_READ() INVERT_DIR(E6, bool(STEPPER_PIN_READ(E6_DIR_PIN)))
   #endif
   #define E6_STEP_INIT() SET_OUTPUT(E6_STEP_PIN)
   #ifndef E6_STEP_WRITE
-    #define E6_STEP_WRITE(STATE) WRITE(E6_STEP_PIN,STATE)
+    #define E6_STEP_WRITE(STATE) STEP_PIN_WRITE(E6_STEP_PIN,STATE)
   #endif
-  #define E6_STEP_READ() bool(READ(E6_STEP_PIN))
+  #define E6_STEP_READ() bool(STEPPER_PIN_READ(E6_STEP_PIN))
 #endif
 
 // E7 Stepper
@@ -563,14 +575,14 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #ifndef E7_DIR_INIT
     #define E7_DIR_INIT() SET_OUTPUT(E7_DIR_PIN)
-    #define E7_DIR_WRITE(STATE) WRITE(E7_DIR_PIN,INVERT_DIR(E7, STATE))
-    #define E7_DIR_READ() INVERT_DIR(E7, bool(READ(E7_DIR_PIN)))
+    #define E7_DIR_WRITE(STATE) DIR_PIN_WRITE(E7_DIR_PIN,INVERT_DIR(E7, STATE))
+    #define E7_DIR_READ() INVERT_DIR(E7, bool(STEPPER_PIN_READ(E7_DIR_PIN)))
   #endif
   #define E7_STEP_INIT() SET_OUTPUT(E7_STEP_PIN)
   #ifndef E7_STEP_WRITE
-    #define E7_STEP_WRITE(STATE) WRITE(E7_STEP_PIN,STATE)
+    #define E7_STEP_WRITE(STATE) STEP_PIN_WRITE(E7_STEP_PIN,STATE)
   #endif
-  #define E7_STEP_READ() bool(READ(E7_STEP_PIN))
+  #define E7_STEP_READ() bool(STEPPER_PIN_READ(E7_STEP_PIN))
 #endif
 
 /**
@@ -1144,3 +1156,25 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
 #ifndef DISABLE_AXIS_E7
   #define DISABLE_AXIS_E7() TERN(HAS_E7_ENABLE, DISABLE_STEPPER_E7(), NOOP)
 #endif
+
+#if ENABLED(STEP_PORT_BATCHING)
+  /**
+   * X, Y, Z, and E step pins grouped by GPIO port, so the Stepper ISR can
+   * start or stop all the pulses on one port together with a single write.
+   * Slots are 0:X 1:Y 2:Z 3:E. The ports are found by init() at startup.
+   */
+  class StepPortBatch {
+  public:
+    static uint8_t ports;                         // Number of ports in use
+    static GPIO_TypeDef *port[4];                 // Ports having step pins
+    static uint8_t index[4];                      // Port index for each slot
+    static uint32_t start_bits[4], stop_bits[4];  // BSRR bits to start / stop each slot's pulse
+
+    static void init();
+
+    // Write the gathered BSRR bits to each port
+    FORCE_INLINE static void write(const uint32_t (&bits)[4]) {
+      for (uint8_t i = 0; i < ports; ++i) if (bits[i]) port[i]->BSRR = bits[i];
+    }
+  };
+#endif
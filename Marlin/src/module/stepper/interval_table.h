@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * interval_table.h - Step interval from a reciprocal table
+ *
+ * With STEP_INTERVAL_TABLE, 32-bit MCUs get STEPPER_TIMER_RATE / step_rate
+ * from a table instead of a division, like speed_lookuptable.h does for AVR.
+ *
+ * The step rate is normalized so its top bits index a table of
+ * (STEPPER_TIMER_RATE << Q) / x for x in [2^K, 2^(K+1)]. The bits below are used
+ * to interpolate between two entries and the result is shifted back by the
+ * normalization. The table is generated at compile time for the stepper timer
+ * rate of the HAL and the relative error is below 2e-5, i.e., within one tick
+ * for intervals under 50000 ticks.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+namespace StepInterval {
+
+  constexpr uint8_t log2_floor(const uint32_t v) { return v > 1 ? 1 + log2_floor(v >> 1) : 0; }
+
+  constexpr uint8_t K = 7,                                        // 128 entries per octave
+                    Q = K + 31 - log2_floor(STEPPER_TIMER_RATE);  // Largest scale that fits in 32 bits
+
+  struct table_t {
+    uint32_t v[(1 << K) + 1];
+    constexpr table_t() : v() {
+      for (uint16_t i = 0; i <= (1 << K); ++i) {
+        const uint64_t x = (1 << K) + i;
+        v[i] = uint32_t(((uint64_t(STEPPER_TIMER_RATE) << Q) + x / 2) / x);
+      }
+    }
+  };
+
+  static constexpr table_t table;
+
+  // STEPPER_TIMER_RATE / rate for a non-zero rate
+  FORCE_INLINE uint32_t interval(const uint32_t rate) {
+    const int8_t s = (31 - __builtin_clz(rate)) - K;              // Normalize: 2^K <= (rate >> s) < 2^(K+1)
+    uint32_t val;
+    if (s <= 0)
+      val = table.v[(rate << -s) - (1 << K)];
+    else {
+      const uint32_t i = (rate >> s) - (1 << K), frac = rate & ((1UL << s) - 1);
+      val = table.v[i] - uint32_t((uint64_t(table.v[i] - table.v[i + 1]) * frac) >> s);
+    }
+    const uint8_t shift = Q + s;
+    return shift < 32 ? val >> shift : 0;
+  }
+
+} // namespace StepInterval
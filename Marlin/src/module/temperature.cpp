@@ -220,10 +220,23 @@
   #include "../feature/power_monitor.h"
 #endif
 
+// Heater duty held back by the power budget
+#if ENABLED(POWER_BUDGET)
+  #define BUDGET_HOTEND(D) power_monitor.hotend_duty(D)
+  #define BUDGET_BED(D)    power_monitor.bed_duty(D)
+#else
+  #define BUDGET_HOTEND(D) (D)
+  #define BUDGET_BED(D)    (D)
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
 
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
 #if ENABLED(PRINTER_EVENT_LEDS)
   #include "../feature/leds/printer_event_leds.h"
 #endif
@@ -245,7 +258,68 @@
   #define HAS_HOTEND_THERMISTOR 1
 #endif
 
-#if HAS_HOTEND_THERMISTOR
+#if ENABLED(THERMISTOR_FAST_LOOKUP)
+
+  #include "thermistor/thermistor_lookup.h"
+
+  // Resample each thermistor table at compile time
+  #define _LOOKUP_TABLE(N) constexpr ThermistorLookup therm_lookup_##N PROGMEM(TEMPTABLE_##N, TEMPTABLE_##N##_LEN)
+  #define _LOOKUP_PTR(N) TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, &therm_lookup_##N, nullptr)
+
+  #if TEMP_SENSOR_0_IS_THERMISTOR
+    _LOOKUP_TABLE(0);
+  #endif
+  #if TEMP_SENSOR_1_IS_THERMISTOR
+    _LOOKUP_TABLE(1);
+  #endif
+  #if TEMP_SENSOR_2_IS_THERMISTOR
+    _LOOKUP_TABLE(2);
+  #endif
+  #if TEMP_SENSOR_3_IS_THERMISTOR
+    _LOOKUP_TABLE(3);
+  #endif
+  #if TEMP_SENSOR_4_IS_THERMISTOR
+    _LOOKUP_TABLE(4);
+  #endif
+  #if TEMP_SENSOR_5_IS_THERMISTOR
+    _LOOKUP_TABLE(5);
+  #endif
+  #if TEMP_SENSOR_6_IS_THERMISTOR
+    _LOOKUP_TABLE(6);
+  #endif
+  #if TEMP_SENSOR_7_IS_THERMISTOR
+    _LOOKUP_TABLE(7);
+  #endif
+  #if TEMP_SENSOR_BED_IS_THERMISTOR
+    _LOOKUP_TABLE(BED);
+  #endif
+  #if TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+    _LOOKUP_TABLE(CHAMBER);
+  #endif
+  #if TEMP_SENSOR_COOLER_IS_THERMISTOR
+    _LOOKUP_TABLE(COOLER);
+  #endif
+  #if TEMP_SENSOR_PROBE_IS_THERMISTOR
+    _LOOKUP_TABLE(PROBE);
+  #endif
+  #if TEMP_SENSOR_BOARD_IS_THERMISTOR
+    _LOOKUP_TABLE(BOARD);
+  #endif
+  #if TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
+    _LOOKUP_TABLE(REDUNDANT);
+  #endif
+
+  #if HAS_HOTEND_THERMISTOR
+    #define NEXT_LOOKUP_PTR(N) ,_LOOKUP_PTR(N)
+    static const ThermistorLookup* heater_lookup_map[HOTENDS] = ARRAY_BY_HOTENDS(_LOOKUP_PTR(0) REPEAT_S(1, HOTENDS, NEXT_LOOKUP_PTR));
+  #endif
+
+  #if HAS_USER_THERMISTORS
+    // Custom thermistors are resampled into RAM whenever their settings change
+    static int16_t user_lookup[USER_THERMISTORS][THERMISTOR_LOOKUP_SIZE];
+  #endif
+
+#elif HAS_HOTEND_THERMISTOR
   #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
   #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
   static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
@@ -432,6 +506,40 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
 #endif
 #define INIT_FAN_PIN(P) do{ _INIT_FAN_PIN(P); SET_FAST_PWM_FREQ(P); }while(0)
 
+#if ENABLED(HEATER_HW_PWM)
+  // Heaters and soft PWM fans that may be driven by a hardware timer
+  enum HWPWMIndex : uint8_t {
+    HWPWM_0, HWPWM_1, HWPWM_2, HWPWM_3, HWPWM_4, HWPWM_5, HWPWM_6, HWPWM_7, HWPWM_BED, HWPWM_CHAMBER,
+    HWPWM_FAN0, HWPWM_FAN1, HWPWM_FAN2, HWPWM_FAN3, HWPWM_FAN4, HWPWM_FAN5, HWPWM_FAN6, HWPWM_FAN7,
+    HWPWM_COUNT
+  };
+  static uint32_t hw_pwm_pins;              // Bits of the outputs on a hardware timer. Others use soft PWM.
+  static uint8_t hw_pwm_duty[HWPWM_COUNT];  // The duty last given to each timer channel
+
+  // Give the output to its timer, if the pin has a free one
+  static void hw_pwm_init(const HWPWMIndex i, const pin_t pin, const bool invert) {
+    if (!hal.pwm_timer_free(pin)) return;
+    hal.set_pwm_frequency(pin, HEATER_HW_PWM_FREQUENCY);
+    hal.set_pwm_duty(pin, 0, 255, invert);
+    hw_pwm_duty[i] = 0;
+    SBI(hw_pwm_pins, i);
+  }
+
+  // Update the timer only when the duty changes
+  static void hw_pwm_write(const HWPWMIndex i, const pin_t pin, const uint8_t duty, const bool invert) {
+    if (duty == hw_pwm_duty[i]) return;
+    hw_pwm_duty[i] = duty;
+    hal.set_pwm_duty(pin, duty, 255, invert);
+  }
+
+  #define HW_PWM(N) TEST(hw_pwm_pins, HWPWM_##N)
+  #define HW_HEATER_DUTY(A) ((A) >= 127 ? 255 : (A) << 1)  // Soft PWM amount 0-127 to duty 0-255
+  #define WRITE_HEATER_OFF(N) do{ if (HW_PWM(N)) hw_pwm_write(HWPWM_##N, HEATER_##N##_PIN, 0, ENABLED(HEATER_##N##_INVERTING)); else WRITE_HEATER_##N(LOW); }while(0)
+#else
+  #define HW_PWM(N) false
+  #define WRITE_HEATER_OFF(N) WRITE_HEATER_##N(LOW)
+#endif
+
 // HAS_FAN does not include CONTROLLER_FAN
 #if HAS_FAN
 
@@ -537,6 +645,11 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
   Temperature::heater_idle_t Temperature::heater_idle[NR_HEATER_IDLE]; // = { { 0 } }
 #endif
 
+#ifdef THERMAL_CHECK_INTERVAL
+  millis_t Temperature::next_protection_ms;
+  bool Temperature::protection_due;
+#endif
+
 #if HAS_HEATED_BED
   bed_info_t Temperature::temp_bed; // = { 0 }
   // Init min and max temp with extreme values to prevent false errors during startup
@@ -825,6 +938,13 @@ void Temperature::factory_reset() {
     raw_pid_t tune_pid = { 0, 0, 0 };
     celsius_float_t maxT = 0, minT = 10000;
 
+    #if ENABLED(PID_AUTOTUNE_FIT)
+      // The time of each extreme, which lags the relay switch by the dead time
+      millis_t t_maxT = next_temp_ms, t_minT = next_temp_ms;
+      raw_pid_t fit_pid = { 0, 0, 0 };
+      bool converged = false;
+    #endif
+
     const bool isbed = (heater_id == H_BED),
            ischamber = (heater_id == H_CHAMBER);
 
@@ -907,8 +1027,13 @@ void Temperature::factory_reset() {
 
         // Get the current temperature and constrain it
         current_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
-        NOLESS(maxT, current_temp);
-        NOMORE(minT, current_temp);
+        #if ENABLED(PID_AUTOTUNE_FIT)
+          if (current_temp > maxT) { maxT = current_temp; t_maxT = ms; }
+          if (current_temp < minT) { minT = current_temp; t_minT = ms; }
+        #else
+          NOLESS(maxT, current_temp);
+          NOMORE(minT, current_temp);
+        #endif
 
         #if ENABLED(PRINTER_EVENT_LEDS)
           ONHEATING(start_temp, current_temp, target);
@@ -920,10 +1045,15 @@ void Temperature::factory_reset() {
           t1 = ms;
           t_high = t1 - t2;
           maxT = target;
+          TERN_(PID_AUTOTUNE_FIT, t_maxT = ms);
         }
 
         if (!heating && current_temp < target && ELAPSED(ms, t1, 5000UL)) {
           heating = true;
+          #if ENABLED(PID_AUTOTUNE_FIT)
+            // Mean dead time of the last overshoot and undershoot, in seconds
+            const float lag = float((t_maxT - t1) + (t_minT - t2)) * 0.0005f;
+          #endif
           t2 = ms;
           t_low = t2 - t1;
           if (cycles > 0) {
@@ -933,7 +1063,7 @@ void Temperature::factory_reset() {
             d = (bias > max_pow >> 1) ? max_pow - 1 - bias : bias;
 
             SERIAL_ECHOPGM(STR_BIAS, bias, STR_D_COLON, d, STR_T_MIN, minT, STR_T_MAX, maxT);
-            if (cycles > 2) {
+            if (cycles > TERN(PID_AUTOTUNE_FIT, 1, 2)) { // A fit needs a single settled cycle
               const float Ku = (4.0f * d) / (float(M_PI) * (maxT - minT) * 0.5f),
                           Tu = float(t_low + t_high) * 0.001f,
                           pf = (ischamber || isbed) ? 0.2f : 0.6f,
@@ -944,10 +1074,40 @@ void Temperature::factory_reset() {
               tune_pid.d = tune_pid.p * Tu * df;
 
               SERIAL_ECHOLNPGM(STR_KU, Ku, STR_TU, Tu);
-              if (ischamber || isbed)
-                SERIAL_ECHOLNPGM(" No overshoot");
-              else
-                SERIAL_ECHOLNPGM(STR_CLASSIC_PID);
+
+              #if ENABLED(PID_AUTOTUNE_FIT)
+                /**
+                 * A process K e^(-Ls) / (Ts + 1) oscillates under the relay where its phase
+                 * reaches -180°, so atan(wT) = PI - wL, and its gain there is 1 / Ku.
+                 * A lag too short or too long for that to hold keeps the Ziegler-Nichols result.
+                 */
+                const float w = 2.0f * float(M_PI) / Tu, phi = float(M_PI) - w * lag;
+                if (lag > 0 && phi > 0 && phi < float(M_PI) * 0.5f) {
+                  const float T = tanf(phi) / w, K = SQRT(1.0f + sq(w * T)) / Ku,
+                              Ti = lag * (0.4f * lag + 0.8f * T) / (lag + 0.1f * T),
+                              Td = 0.5f * lag * T / (0.3f * lag + T);
+                  const raw_pid_t prev_pid = fit_pid;
+                  fit_pid.p = (0.2f + 0.45f * T / lag) / K;
+                  fit_pid.i = fit_pid.p / Ti;
+                  fit_pid.d = fit_pid.p * Td;
+                  tune_pid = fit_pid;
+
+                  auto settled = [](const float a, const float b) { return ABS(a - b) <= (PID_AUTOTUNE_FIT_TOLERANCE) * ABS(a); };
+                  converged = settled(fit_pid.p, prev_pid.p) && settled(fit_pid.i, prev_pid.i) && settled(fit_pid.d, prev_pid.d);
+
+                  SERIAL_ECHOLNPGM(" FOPDT K: ", K, " T: ", T, " L: ", lag);
+                }
+                else {
+                  fit_pid = { 0, 0, 0 };
+                  converged = false;
+                  SERIAL_ECHOLNPGM(STR_CLASSIC_PID);
+                }
+              #else
+                if (ischamber || isbed)
+                  SERIAL_ECHOLNPGM(" No overshoot");
+                else
+                  SERIAL_ECHOLNPGM(STR_CLASSIC_PID);
+              #endif
               SERIAL_ECHOLNPGM(STR_KP, tune_pid.p, STR_KI, tune_pid.i, STR_KD, tune_pid.d);
             }
           }
@@ -955,6 +1115,7 @@ void Temperature::factory_reset() {
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PID_CYCLE), cycles, ncycles));
           cycles++;
           minT = target;
+          TERN_(PID_AUTOTUNE_FIT, t_minT = ms);
         }
       }
 
@@ -1012,7 +1173,7 @@ void Temperature::factory_reset() {
         break;
       }
 
-      if (cycles > ncycles && cycles > 2) {
+      if ((cycles > ncycles || TERN0(PID_AUTOTUNE_FIT, converged)) && cycles > 2) {
         SERIAL_ECHOPGM(STR_PID_AUTOTUNE); SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_FINISHED);
         TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_AUTOTUNE_DONE)));
 
@@ -1561,17 +1722,19 @@ int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
         #endif
         default:
           #if ANY(AUTO_POWER_E_FANS, HAS_FANCHECK)
-            autofan_speed[realFan] = fan_on ? EXTRUDER_AUTO_FAN_SPEED : 0;
+            autofan_speed[realFan] = fan_on ? TERN(HAS_FAN_TACHO_CONTROL, fan_check.autofan_speed(realFan), EXTRUDER_AUTO_FAN_SPEED) : 0;
           #endif
           break;
       }
 
       #if ALL(HAS_FANCHECK, HAS_PWMFANCHECK)
-        #define _AUTOFAN_SPEED() fan_check.is_measuring() ? 255 : EXTRUDER_AUTO_FAN_SPEED
+        #define _AUTOFAN_SPEED(N) fan_check.is_measuring() ? 255 : EXTRUDER_AUTO_FAN_SPEED
+      #elif HAS_FAN_TACHO_CONTROL
+        #define _AUTOFAN_SPEED(N) fan_check.autofan_speed(N)
       #else
-        #define _AUTOFAN_SPEED() EXTRUDER_AUTO_FAN_SPEED
+        #define _AUTOFAN_SPEED(N) EXTRUDER_AUTO_FAN_SPEED
       #endif
-      #define _AUTOFAN_CASE(N) case N: _UPDATE_AUTO_FAN(E##N, fan_on, _AUTOFAN_SPEED()); break;
+      #define _AUTOFAN_CASE(N) case N: _UPDATE_AUTO_FAN(E##N, fan_on, _AUTOFAN_SPEED(N)); break;
       #define _AUTOFAN_NOT(N)
       #define AUTOFAN_CASE(N) TERN(HAS_AUTO_FAN_##N, _AUTOFAN_CASE, _AUTOFAN_NOT)(N)
 
@@ -1802,6 +1965,30 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
 #if HAS_HOTEND
 
+  #if ENABLED(MPC_FEEDFORWARD)
+    /**
+     * Average extrusion speed (mm/s) of the queued moves for a hotend
+     * over the next MPC_FEEDFORWARD_MS, from the nominal block speeds.
+     */
+    static float mpc_e_speed_ahead(const uint8_t ee) {
+      constexpr float window = (MPC_FEEDFORWARD_MS) * 0.001f;
+      float t = 0.0f, e_mm = 0.0f;
+      const uint8_t head = planner.block_buffer_head;
+      for (uint8_t b = planner.block_buffer_tail; b != head && t < window; b = block_inc_mod(b, 1)) {
+        block_t * const block = &planner.block_buffer[b];
+        if (!block->is_move() || block->nominal_speed <= 0.0f) continue;
+        const float bt = block->millimeters / block->nominal_speed;
+        if (block->steps.e && block->direction_bits.e && TERN1(HAS_MULTI_EXTRUDER, block->extruder == ee)) {
+          const float be = block->steps.e * planner.mm_per_step[E_AXIS];
+          e_mm += (t + bt > window) ? be * (window - t) / bt : be;
+        }
+        t += bt;
+      }
+      UNUSED(ee);
+      return e_mm * (1.0f / window);
+    }
+  #endif
+
   /**
    * PID Output Hotend
    * @brief Calculate the power output for the hotend (using PID or MPC)
@@ -1853,10 +2040,13 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         const float fan_fraction = TERN0(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend) ? 0.0f : fan_speed[fan_index] * RECIPROCAL(255);
         ambient_xfer_coeff += fan_fraction * mpc.fan255_adjustment;
       #endif
+      TERN_(MPC_FLOW_LIMIT, const float base_xfer_coeff = ambient_xfer_coeff);
 
+      float feedforward_xfer_coeff = 0.0f;
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
         const float e_speed = (e_position - MPC::e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
+        float e_speed_now = 0.0f;
 
         // The position can appear to make big jumps when, e.g., homing
         if (fabs(e_speed) > planner.settings.max_feedrate_mm_s[E_AXIS])
@@ -1864,7 +2054,19 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         else if (e_speed > 0.0f) {  // Ignore retract/recover moves
           if (!MPC::e_paused) ambient_xfer_coeff += e_speed * mpc.filament_heat_capacity_permm;
           MPC::e_position = e_position;
+          e_speed_now = e_speed;
         }
+
+        #if ENABLED(MPC_FEEDFORWARD)
+          // Plan for the filament heat loss of the moves about to run
+          if (!MPC::e_paused) {
+            const float e_speed_ahead = mpc_e_speed_ahead(ee);
+            if (e_speed_ahead > e_speed_now)
+              feedforward_xfer_coeff = (e_speed_ahead - e_speed_now) * mpc.filament_heat_capacity_permm * (MPC_FEEDFORWARD_GAIN);
+          }
+        #else
+          UNUSED(e_speed_now);
+        #endif
       }
 
       // Update the modeled temperatures
@@ -1890,12 +2092,33 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       if (hotend.target != 0 && !is_idling) {
         // Plan power level to get to target temperature in 2 seconds
         power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
-        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
+        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * (ambient_xfer_coeff + feedforward_xfer_coeff);
       }
 
       float pid_output = power * 254.0f / _heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
       LIMIT(pid_output, 0, MPC_MAX);
 
+      #if ENABLED(MPC_FLOW_LIMIT)
+        // Near full power, limit new moves to the filament speed the heater can still melt
+        if (this_hotend && hotend.target != 0 && !is_idling) {
+          if (pid_output >= (MPC_MAX) * (MPC_FLOW_LIMIT_DUTY) * 0.01f)
+            hotend.flow_limited = true;
+          else if (pid_output < (MPC_MAX) * ((MPC_FLOW_LIMIT_DUTY) - 10) * 0.01f)
+            hotend.flow_limited = false;
+        }
+        else
+          hotend.flow_limited = false;
+
+        if (hotend.flow_limited) {
+          const float rise = hotend.target - hotend.modeled_ambient_temp,
+                      headroom = _heater_power * (MPC_MAX) * RECIPROCAL(255) - rise * base_xfer_coeff,
+                      melt_speed = headroom * RECIPROCAL(mpc.filament_heat_capacity_permm * rise);
+          hotend.flow_limit = _MAX(melt_speed * (MPC_FLOW_LIMIT_MARGIN), MPC_FLOW_LIMIT_MIN);
+        }
+        else
+          hotend.flow_limit = 0;
+      #endif
+
       /* <-- add a slash to enable
         static uint32_t nexttime = millis() + 1000;
         if (ELAPSED(millis(), nexttime)) {
@@ -1932,6 +2155,35 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
    */
   float Temperature::get_pid_output_bed() {
     static PIDRunner<bed_info_t> bed_pid(temp_bed);
+
+    #ifdef BED_PREHEAT_COAST_TIME
+      // Heat up at full power until the measured heating rate says the bed will coast to the target
+      static bool preheat_boost; // = false
+      static celsius_t boost_target; // = 0
+      static celsius_float_t rate_temp;
+      static float heat_rate; // (°C/s)
+      static millis_t next_rate_ms;
+      const millis_t ms = millis();
+      if (temp_bed.target != boost_target) {
+        boost_target = temp_bed.target;
+        preheat_boost = temp_bed.target > temp_bed.celsius + (PID_FUNCTIONAL_RANGE);
+        heat_rate = 0;
+        rate_temp = temp_bed.celsius;
+        next_rate_ms = ms + 1000;
+      }
+      if (preheat_boost) {
+        if (ELAPSED(ms, next_rate_ms)) {
+          next_rate_ms = ms + 1000;
+          heat_rate += (float(temp_bed.celsius - rate_temp) - heat_rate) * 0.5f;
+          rate_temp = temp_bed.celsius;
+        }
+        if (temp_bed.celsius + heat_rate * (BED_PREHEAT_COAST_TIME) < temp_bed.target)
+          return temp_bed.pid.high();
+        preheat_boost = false;
+        temp_bed.pid.reset();           // Start without integral windup
+      }
+    #endif
+
     const float pid_output = bed_pid.get_pid_output();
     TERN_(PID_BED_DEBUG, bed_pid.debug(temp_bed.celsius, pid_output, F("(Bed)")));
     return pid_output;
@@ -1979,15 +2231,15 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
       #if ENABLED(THERMAL_PROTECTION_HOTENDS)
         // Check for thermal runaway
-        tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
+        if (protection_due) tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
       temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_hotend_preheating(e))
-        && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+        && temp_hotend[e].celsius < temp_range[e].maxtemp ? BUDGET_HOTEND((int)get_pid_output_hotend(e) >> 1) : 0;
 
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
-        if (watch_hotend[e].elapsed(ms)) {          // Enabled and time to check?
+        if (protection_due && watch_hotend[e].elapsed(ms)) { // Enabled and time to check?
           auto temp = degHotend(e);
           if (watch_hotend[e].check(temp))          // Increased enough?
             start_watching_hotend(e);               // If temp reached, turn off elapsed check
@@ -2027,7 +2279,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
     #if WATCH_BED
     {
       // Make sure temperature is increasing
-      if (watch_bed.elapsed(ms)) {              // Time to check the bed?
+      if (protection_due && watch_bed.elapsed(ms)) { // Time to check the bed?
         const auto deg = degBed();
         if (watch_bed.check(deg))               // Increased enough?
           start_watching_bed();                 // If temp reached, turn off elapsed check
@@ -2062,14 +2314,14 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       TERN_(HEATER_IDLE_HANDLER, heater_idle[IDLE_INDEX_BED].update(ms));
 
       #if ENABLED(THERMAL_PROTECTION_BED)
-        tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
+        if (protection_due) tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
       #endif
 
       #if HEATER_IDLE_HANDLER
         const bool bed_timed_out = heater_idle[IDLE_INDEX_BED].timed_out;
         if (bed_timed_out) {
           temp_bed.soft_pwm_amount = 0;
-          if (DISABLED(PIDTEMPBED)) WRITE_HEATER_BED(LOW);
+          if (DISABLED(PIDTEMPBED)) WRITE_HEATER_OFF(BED);
         }
       #else
         constexpr bool bed_timed_out = false;
@@ -2078,7 +2330,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       if (bed_timed_out) break;
 
       if (is_bed_preheating()) {
-        temp_bed.soft_pwm_amount = MAX_BED_POWER >> 1;
+        temp_bed.soft_pwm_amount = BUDGET_BED(MAX_BED_POWER >> 1);
         break;
       }
 
@@ -2087,7 +2339,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         //
         // PID Bed Heating
         //
-        temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
+        temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? BUDGET_BED((int)get_pid_output_bed() >> 1) : 0;
 
       #else // !PIDTEMPBED
 
@@ -2098,7 +2350,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         // Bed Off if the current bed temperature is outside the allowed range
         if (!WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP)) {
           temp_bed.soft_pwm_amount = 0;
-          WRITE_HEATER_BED(LOW);
+          WRITE_HEATER_OFF(BED);
           break;
         }
 
@@ -2124,9 +2376,9 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
             if (temp_bed.is_above_target(BED_HYSTERESIS))       // Cooling (implicit off)
               temp_bed.soft_pwm_amount = 0;
             else if (temp_bed.is_below_target(BED_HYSTERESIS))  // Heating
-              temp_bed.soft_pwm_amount = MAX_BED_POWER >> 1;
+              temp_bed.soft_pwm_amount = BUDGET_BED(MAX_BED_POWER >> 1);
           #else                                                 // Not bed limit switching
-            temp_bed.soft_pwm_amount = temp_bed.is_below_target() ? MAX_BED_POWER >> 1 : 0;
+            temp_bed.soft_pwm_amount = temp_bed.is_below_target() ? BUDGET_BED(MAX_BED_POWER >> 1) : 0;
           #endif
 
         #endif // !PELTIER_BED
@@ -2379,6 +2631,22 @@ void Temperature::task() {
     #endif
   #endif
 
+  #if HAS_MAX31865_ONE_SHOT
+    // Keep the 1-shot conversions going between readings
+    #if TEMP_SENSOR_IS_MAX(0, 31865)
+      max31865_0.update();
+    #endif
+    #if TEMP_SENSOR_IS_MAX(1, 31865)
+      max31865_1.update();
+    #endif
+    #if TEMP_SENSOR_IS_MAX(2, 31865)
+      max31865_2.update();
+    #endif
+    #if TEMP_SENSOR_IS_MAX(BED, 31865)
+      max31865_BED.update();
+    #endif
+  #endif
+
   if (!updateTemperaturesIfReady()) return; // Will also reset the watchdog if temperatures are ready
 
   #if DISABLED(IGNORE_THERMOCOUPLE_ERRORS)
@@ -2421,6 +2689,14 @@ void Temperature::task() {
 
   const millis_t ms = millis();
 
+  #ifdef THERMAL_CHECK_INTERVAL
+    protection_due = ELAPSED(ms, next_protection_ms);
+    if (protection_due) next_protection_ms = ms + (THERMAL_CHECK_INTERVAL);
+  #endif
+
+  // Set the heater duty allowed by the power budget
+  TERN_(POWER_BUDGET, power_monitor.budget_task(ms));
+
   // Handle Hotend Temp Errors, Heating Watch, etc.
   TERN_(HAS_HOTEND, manage_hotends(ms));
 
@@ -2487,6 +2763,13 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+// Convert with the resampled table, or search the table of sensor N
+#if ENABLED(THERMISTOR_FAST_LOOKUP)
+  #define CONVERT_THERMISTOR_TABLE(N) return therm_lookup_##N.celsius(raw)
+#else
+  #define CONVERT_THERMISTOR_TABLE(N) SCAN_THERMISTOR_TABLE(TEMPTABLE_##N, TEMPTABLE_##N##_LEN)
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load
@@ -2571,20 +2854,8 @@ void Temperature::task() {
     );
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
-
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
-
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
-
+  // Steinhart-Hart (or Beta) equation for a custom thermistor
+  static celsius_float_t user_thermistor_formula(const user_thermistor_t &t, const raw_adc_t raw) {
     // Maximum ADC value .. take into account the over sampling
     constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
     const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -2602,6 +2873,33 @@ void Temperature::task() {
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    user_thermistor_t &t = user_thermistor[t_index];
+    if (t.pre_calc) { // pre-calculate some variables
+      t.pre_calc     = false;
+      t.res_25_recip = 1.0f / t.res_25;
+      t.res_25_log   = logf(t.res_25);
+      t.beta_recip   = 1.0f / t.beta;
+      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      #if ENABLED(THERMISTOR_FAST_LOOKUP)
+        for (uint16_t i = 0; i < THERMISTOR_LOOKUP_SIZE; ++i)
+          user_lookup[t_index][i] = ThermistorLookup::to_c16(user_thermistor_formula(t, _MIN(uint32_t(i) << THERMISTOR_LOOKUP_SHIFT, uint32_t(MAX_RAW_THERMISTOR_VALUE))));
+      #endif
+    }
+
+    #if ENABLED(THERMISTOR_FAST_LOOKUP)
+      const uint16_t i = raw >> THERMISTOR_LOOKUP_SHIFT;
+      if (i >= THERMISTOR_LOOKUP_SIZE - 1) return user_lookup[t_index][THERMISTOR_LOOKUP_SIZE - 1] * (1.0f / 16);
+      return ThermistorLookup::lerp(user_lookup[t_index][i], user_lookup[t_index][i + 1], raw);
+    #else
+      return user_thermistor_formula(t, raw);
+    #endif
+  }
 #endif
 
 #if ANY_THERMISTOR_IS(-1)
@@ -2745,8 +3043,12 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(THERMISTOR_FAST_LOOKUP)
+        if (heater_lookup_map[e]) return heater_lookup_map[e]->celsius(raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2768,7 +3070,7 @@ void Temperature::task() {
         return (int16_t)raw * 0.25f;
       #endif
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      CONVERT_THERMISTOR_TABLE(BED);
     #elif TEMP_SENSOR_BED_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2786,7 +3088,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      CONVERT_THERMISTOR_TABLE(CHAMBER);
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2804,7 +3106,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      CONVERT_THERMISTOR_TABLE(COOLER);
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -2822,7 +3124,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      CONVERT_THERMISTOR_TABLE(PROBE);
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -2840,7 +3142,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_BOARD_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BOARD, raw);
     #elif TEMP_SENSOR_BOARD_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
+      CONVERT_THERMISTOR_TABLE(BOARD);
     #elif TEMP_SENSOR_BOARD_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_BOARD_IS_AD8495
@@ -2875,7 +3177,7 @@ void Temperature::task() {
     #elif TEMP_SENSOR_IS_MAX_TC(REDUNDANT) && REDUNDANT_TEMP_MATCH(SOURCE, E2)
       return TERN(TEMP_SENSOR_REDUNDANT_IS_MAX31865, max31865_2.temperature(raw), (int16_t)raw * 0.25f);
     #elif TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
+      CONVERT_THERMISTOR_TABLE(REDUNDANT);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD595
       return temp_ad595(raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD8495
@@ -3044,6 +3346,9 @@ void Temperature::init() {
         MAX31865_WIRES(MAX31865_SENSOR_WIRES_0) // MAX31865_2WIRE, MAX31865_3WIRE, MAX31865_4WIRE
         OPTARG(LIB_INTERNAL_MAX31865, MAX31865_SENSOR_OHMS_0, MAX31865_CALIBRATION_OHMS_0, MAX31865_WIRE_OHMS_0)
       );
+      #if HAS_MAX31865_ONE_SHOT && PIN_EXISTS(TEMP_0_DRDY)
+        max31865_0.setDrdyPin(TEMP_0_DRDY_PIN);
+      #endif
     #endif
 
     #if TEMP_SENSOR_IS_MAX(1, 6675) && HAS_MAX6675_LIBRARY
@@ -3055,6 +3360,9 @@ void Temperature::init() {
         MAX31865_WIRES(MAX31865_SENSOR_WIRES_1) // MAX31865_2WIRE, MAX31865_3WIRE, MAX31865_4WIRE
         OPTARG(LIB_INTERNAL_MAX31865, MAX31865_SENSOR_OHMS_1, MAX31865_CALIBRATION_OHMS_1, MAX31865_WIRE_OHMS_1)
       );
+      #if HAS_MAX31865_ONE_SHOT && PIN_EXISTS(TEMP_1_DRDY)
+        max31865_1.setDrdyPin(TEMP_1_DRDY_PIN);
+      #endif
     #endif
 
     #if TEMP_SENSOR_IS_MAX(2, 6675) && HAS_MAX6675_LIBRARY
@@ -3066,6 +3374,9 @@ void Temperature::init() {
         MAX31865_WIRES(MAX31865_SENSOR_WIRES_2) // MAX31865_2WIRE, MAX31865_3WIRE, MAX31865_4WIRE
         OPTARG(LIB_INTERNAL_MAX31865, MAX31865_SENSOR_OHMS_2, MAX31865_CALIBRATION_OHMS_2, MAX31865_WIRE_OHMS_2)
       );
+      #if HAS_MAX31865_ONE_SHOT && PIN_EXISTS(TEMP_2_DRDY)
+        max31865_2.setDrdyPin(TEMP_2_DRDY_PIN);
+      #endif
     #endif
 
     #if TEMP_SENSOR_IS_MAX(BED, 6675) && HAS_MAX6675_LIBRARY
@@ -3077,6 +3388,9 @@ void Temperature::init() {
         MAX31865_WIRES(MAX31865_SENSOR_WIRES_BED) // MAX31865_BEDWIRE, MAX31865_3WIRE, MAX31865_4WIRE
         OPTARG(LIB_INTERNAL_MAX31865, MAX31865_SENSOR_OHMS_BED, MAX31865_CALIBRATION_OHMS_BED, MAX31865_WIRE_OHMS_BED)
       );
+      #if HAS_MAX31865_ONE_SHOT && PIN_EXISTS(TEMP_BED_DRDY)
+        max31865_BED.setDrdyPin(TEMP_BED_DRDY_PIN);
+      #endif
     #endif
 
     #undef MAX31865_WIRES
@@ -3202,6 +3516,17 @@ void Temperature::init() {
     INIT_FAN_PIN(CONTROLLER_FAN_PIN);
   #endif
 
+  #if ENABLED(HEATER_HW_PWM)
+    #define _HW_PWM_INIT_E(N) hw_pwm_init(HWPWM_##N, HEATER_##N##_PIN, ENABLED(HEATER_##N##_INVERTING));
+    REPEAT(HOTENDS, _HW_PWM_INIT_E);
+    TERN_(HAS_HEATED_BED, hw_pwm_init(HWPWM_BED, HEATER_BED_PIN, ENABLED(HEATER_BED_INVERTING)));
+    TERN_(HAS_HEATED_CHAMBER, hw_pwm_init(HWPWM_CHAMBER, HEATER_CHAMBER_PIN, ENABLED(HEATER_CHAMBER_INVERTING)));
+    #if ENABLED(FAN_SOFT_PWM)
+      #define _HW_PWM_INIT_FAN(N) TERN_(HAS_FAN##N, hw_pwm_init(HWPWM_FAN##N, FAN##N##_PIN, ENABLED(FAN_INVERTING)));
+      REPEAT(8, _HW_PWM_INIT_FAN);
+    #endif
+  #endif
+
   TERN_(HAS_MAXTC_SW_SPI, max_tc_spi.init());
 
   hal.adc_init();
@@ -3417,6 +3742,16 @@ void Temperature::init() {
       const IdleIndex idle_index = idle_index_for_id(heater_id);
     #endif
 
+    #if defined(THERMAL_CHECK_INTERVAL) && NONE(THERMAL_PROTECTION_VARIANCE_MONITOR, ADAPTIVE_FAN_SLOWING)
+      // Stable within the hysteresis of an unchanged target, as for most of a print. Only push back the timer.
+      if (state == TRStable && running_temp == target && current >= stable_temp
+        && !TERN0(HEATER_IDLE_HANDLER, heater_idle[idle_index].timed_out)
+      ) {
+        timer = millis() + SEC_TO_MS(period_seconds);
+        return;
+      }
+    #endif
+
     /**
       SERIAL_ECHO_START();
       SERIAL_ECHOPGM("Thermal Runaway Running. Heater ID: ");
@@ -3475,6 +3810,9 @@ void Temperature::init() {
       case TRFirstHeating:
         if (current < running_temp) break;
         state = TRStable;
+        #ifdef THERMAL_CHECK_INTERVAL
+          stable_temp = running_temp - hysteresis_degc;
+        #endif
 
       // While the temperature is stable watch for a bad temperature
       case TRStable: {
@@ -3568,20 +3906,20 @@ void Temperature::disable_all_heaters() {
   #endif
 
   #if HAS_TEMP_HOTEND
-    #define DISABLE_HEATER(N) WRITE_HEATER_##N(LOW);
+    #define DISABLE_HEATER(N) WRITE_HEATER_OFF(N);
     REPEAT(HOTENDS, DISABLE_HEATER);
   #endif
 
   #if HAS_HEATED_BED
     setTargetBed(0);
     temp_bed.soft_pwm_amount = 0;
-    WRITE_HEATER_BED(LOW);
+    WRITE_HEATER_OFF(BED);
   #endif
 
   #if HAS_HEATED_CHAMBER
     setTargetChamber(0);
     temp_chamber.soft_pwm_amount = 0;
-    WRITE_HEATER_CHAMBER(LOW);
+    WRITE_HEATER_OFF(CHAMBER);
   #endif
 
   #if HAS_COOLER
@@ -4077,7 +4415,16 @@ public:
  *  - Endstop polling
  *  - Planner clean buffer
  */
-void Temperature::isr() {
+HAL_RAMFUNC void Temperature::isr() {
+
+  #if ENABLED(FLIGHT_RECORDER)
+    // Note a temperature ISR that ran more than one period late
+    static uint32_t last_isr_us = 0;
+    const uint32_t now_us = micros(), gap_us = now_us - last_isr_us;
+    if (last_isr_us && gap_us > 2UL * 1000000UL / (TEMP_TIMER_FREQUENCY))
+      flight_recorder.record(FR_TEMP_ISR_LATE, 0, uint16_t(_MIN(gap_us, 65535UL)));
+    last_isr_us = now_us;
+  #endif
 
   // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
   #if LASER_SAFETY_TIMEOUT_MS > 0
@@ -4129,10 +4476,21 @@ void Temperature::isr() {
 
     #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
       constexpr uint8_t pwm_mask = TERN0(SOFT_PWM_DITHER, _BV(SOFT_PWM_SCALE) - 1);
-      #define _PWM_MOD(N,S,T) do{                           \
-        const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
-        WRITE_HEATER_##N(on);                               \
-      }while(0)
+      #if ENABLED(HEATER_HW_PWM)
+        #define _PWM_MOD(N,S,T) do{                         \
+          if (HW_PWM(N))                                    \
+            hw_pwm_write(HWPWM_##N, HEATER_##N##_PIN, HW_HEATER_DUTY(T.soft_pwm_amount), ENABLED(HEATER_##N##_INVERTING)); \
+          else {                                            \
+            const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
+            WRITE_HEATER_##N(on);                           \
+          }                                                 \
+        }while(0)
+      #else
+        #define _PWM_MOD(N,S,T) do{                           \
+          const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
+          WRITE_HEATER_##N(on);                               \
+        }while(0)
+      #endif
     #endif
 
     /**
@@ -4147,7 +4505,18 @@ void Temperature::isr() {
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #if ENABLED(HEATER_PWM_INTERLEAVE)
+          // The bed on-time is at the end of the cycle, after the hotends
+          soft_pwm_bed.add(pwm_mask, temp_bed.soft_pwm_amount);
+          #if ENABLED(HEATER_PWM_EXCLUSIVE)
+            uint8_t hotend_on = 0;
+            HOTEND_LOOP() NOLESS(hotend_on, soft_pwm_hotend[e].count);
+            NOMORE(soft_pwm_bed.count, hotend_on < 127 ? 127 - hotend_on : 0);
+          #endif
+          WRITE_HEATER_BED(soft_pwm_bed.count >= 127);
+        #else
+          _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #endif
         #if ENABLED(PELTIER_BED)
           WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
         #endif
@@ -4167,11 +4536,23 @@ void Temperature::isr() {
           WRITE(CONTROLLER_FAN_PIN, soft_pwm_controller.add(pwm_mask, controllerFan.soft_pwm_speed));
         #endif
 
-        #define _FAN_PWM(N) do{                                     \
-          uint8_t &spcf = soft_pwm_count_fan[N];                    \
-          spcf = (spcf & pwm_mask) + (soft_pwm_amount_fan[N] >> 1); \
-          WRITE_FAN(N, spcf > pwm_mask ? HIGH : LOW);               \
-        }while(0)
+        #if ENABLED(HEATER_HW_PWM)
+          #define _FAN_PWM(N) do{                                     \
+            if (HW_PWM(FAN##N))                                       \
+              hw_pwm_write(HWPWM_FAN##N, FAN##N##_PIN, soft_pwm_amount_fan[N], ENABLED(FAN_INVERTING)); \
+            else {                                                    \
+              uint8_t &spcf = soft_pwm_count_fan[N];                  \
+              spcf = (spcf & pwm_mask) + (soft_pwm_amount_fan[N] >> 1); \
+              WRITE_FAN(N, spcf > pwm_mask ? HIGH : LOW);             \
+            }                                                         \
+          }while(0)
+        #else
+          #define _FAN_PWM(N) do{                                     \
+            uint8_t &spcf = soft_pwm_count_fan[N];                    \
+            spcf = (spcf & pwm_mask) + (soft_pwm_amount_fan[N] >> 1); \
+            WRITE_FAN(N, spcf > pwm_mask ? HIGH : LOW);               \
+          }while(0)
+        #endif
 
         #if HAS_FAN0
           _FAN_PWM(0);
@@ -4200,14 +4581,18 @@ void Temperature::isr() {
       #endif
     }
     else {
-      #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
+      #define _PWM_LOW(N,S) do{ if (!HW_PWM(N) && S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
       #if HAS_HOTEND
         #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
         REPEAT(HOTENDS, _PWM_LOW_E);
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
+        #if ENABLED(HEATER_PWM_INTERLEAVE)
+          if (soft_pwm_bed.count > pwm_mask && pwm_count_tmp + soft_pwm_bed.count >= 127) WRITE_HEATER_BED(HIGH);
+        #else
+          _PWM_LOW(BED, soft_pwm_bed);
+        #endif
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -4220,28 +4605,28 @@ void Temperature::isr() {
 
       #if ENABLED(FAN_SOFT_PWM)
         #if HAS_FAN0
-          if (soft_pwm_count_fan[0] <= pwm_count_tmp) WRITE_FAN(0, LOW);
+          if (!HW_PWM(FAN0) && soft_pwm_count_fan[0] <= pwm_count_tmp) WRITE_FAN(0, LOW);
         #endif
         #if HAS_FAN1
-          if (soft_pwm_count_fan[1] <= pwm_count_tmp) WRITE_FAN(1, LOW);
+          if (!HW_PWM(FAN1) && soft_pwm_count_fan[1] <= pwm_count_tmp) WRITE_FAN(1, LOW);
         #endif
         #if HAS_FAN2
-          if (soft_pwm_count_fan[2] <= pwm_count_tmp) WRITE_FAN(2, LOW);
+          if (!HW_PWM(FAN2) && soft_pwm_count_fan[2] <= pwm_count_tmp) WRITE_FAN(2, LOW);
         #endif
         #if HAS_FAN3
-          if (soft_pwm_count_fan[3] <= pwm_count_tmp) WRITE_FAN(3, LOW);
+          if (!HW_PWM(FAN3) && soft_pwm_count_fan[3] <= pwm_count_tmp) WRITE_FAN(3, LOW);
         #endif
         #if HAS_FAN4
-          if (soft_pwm_count_fan[4] <= pwm_count_tmp) WRITE_FAN(4, LOW);
+          if (!HW_PWM(FAN4) && soft_pwm_count_fan[4] <= pwm_count_tmp) WRITE_FAN(4, LOW);
         #endif
         #if HAS_FAN5
-          if (soft_pwm_count_fan[5] <= pwm_count_tmp) WRITE_FAN(5, LOW);
+          if (!HW_PWM(FAN5) && soft_pwm_count_fan[5] <= pwm_count_tmp) WRITE_FAN(5, LOW);
         #endif
         #if HAS_FAN6
-          if (soft_pwm_count_fan[6] <= pwm_count_tmp) WRITE_FAN(6, LOW);
+          if (!HW_PWM(FAN6) && soft_pwm_count_fan[6] <= pwm_count_tmp) WRITE_FAN(6, LOW);
         #endif
         #if HAS_FAN7
-          if (soft_pwm_count_fan[7] <= pwm_count_tmp) WRITE_FAN(7, LOW);
+          if (!HW_PWM(FAN7) && soft_pwm_count_fan[7] <= pwm_count_tmp) WRITE_FAN(7, LOW);
         #endif
         #if ENABLED(USE_CONTROLLER_FAN)
           if (soft_pwm_controller.count <= pwm_count_tmp) WRITE(CONTROLLER_FAN_PIN, LOW);
@@ -4624,7 +5009,9 @@ void Temperature::isr() {
   //
 
   // Check fan tachometers
-  TERN_(HAS_FANCHECK, fan_check.update_tachometers());
+  #if HAS_FANCHECK && DISABLED(FAN_TACHO_INTERRUPTS)
+    fan_check.update_tachometers();
+  #endif
 
   // Poll endstops state, if required
   endstops.poll();
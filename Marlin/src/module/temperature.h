@@ -458,6 +458,10 @@ struct PIDHeaterInfo : public HeaterInfo {
     float modeled_ambient_temp,
           modeled_block_temp,
           modeled_sensor_temp;
+    #if ENABLED(MPC_FLOW_LIMIT)
+      float flow_limit;   // (mm/s) Filament speed limit for new moves, 0 for none
+      bool flow_limited;  // Out of heater headroom
+    #endif
     float fanCoefficient() { return mpc.fanCoefficient(); }
     void applyFanAdjustment(const float cf) { mpc.applyFanAdjustment(cf); }
   };
@@ -738,6 +742,13 @@ class Temperature {
 
   private:
 
+    #ifdef THERMAL_CHECK_INTERVAL
+      static millis_t next_protection_ms;
+      static bool protection_due;         // Runaway and watch checks are due on this reading
+    #else
+      static constexpr bool protection_due = true;
+    #endif
+
     #if ENABLED(WATCH_HOTENDS)
       static hotend_watch_t watch_hotend[HOTENDS];
     #endif
@@ -1421,6 +1432,9 @@ class Temperature {
         millis_t timer = 0;
         TRState state = TRInactive;
         celsius_float_t running_temp;
+        #ifdef THERMAL_CHECK_INTERVAL
+          celsius_float_t stable_temp;      // Lowest temperature that is stable at running_temp
+        #endif
         #if ENABLED(THERMAL_PROTECTION_VARIANCE_MONITOR)
           millis_t variance_timer = 0;
           celsius_float_t last_temp = 0.0, variance = 0.0;
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * thermistor_lookup.h - Uniformly spaced thermistor tables for THERMISTOR_FAST_LOOKUP
+ *
+ * Each thermistor table is resampled at compile time every 2^THERMISTOR_LOOKUP_SHIFT
+ * raw ADC counts (oversampled), using the same linear interpolation as the table
+ * search. A conversion is then an index by shift and one lerp, with no search.
+ * Temperatures are kept in 1/16 °C.
+ */
+
+#include "thermistors.h"
+
+namespace ThermistorLookupConst {
+  constexpr uint8_t log2(const uint32_t v) { return v > 1 ? 1 + log2(v >> 1) : 0; }
+  constexpr uint32_t RAW_SPAN = uint32_t(HAL_ADC_RANGE) * (OVERSAMPLENR);
+  constexpr uint8_t RAW_BITS = log2(RAW_SPAN);
+}
+
+static_assert(_BV32(ThermistorLookupConst::RAW_BITS) == ThermistorLookupConst::RAW_SPAN, "THERMISTOR_FAST_LOOKUP requires a power of 2 raw ADC range.");
+static_assert(THERMISTOR_LOOKUP_BITS <= ThermistorLookupConst::RAW_BITS, "THERMISTOR_LOOKUP_BITS is larger than the raw ADC range.");
+
+#define THERMISTOR_LOOKUP_SHIFT (ThermistorLookupConst::RAW_BITS - (THERMISTOR_LOOKUP_BITS))
+#define THERMISTOR_LOOKUP_SIZE  (_BV(THERMISTOR_LOOKUP_BITS) + 1)
+
+class ThermistorLookup {
+  public:
+    // Resample a table sorted by raw value
+    constexpr ThermistorLookup(const temp_entry_t * const tbl, const uint8_t len) : c16{} {
+      for (uint16_t i = 0; i < THERMISTOR_LOOKUP_SIZE; ++i)
+        c16[i] = to_c16(scan(tbl, len, float(uint32_t(i) << THERMISTOR_LOOKUP_SHIFT)));
+    }
+
+    // Convert a raw reading. The object lives in PROGMEM.
+    celsius_float_t celsius(const raw_adc_t raw) const {
+      const uint16_t i = raw >> THERMISTOR_LOOKUP_SHIFT;
+      if (i >= THERMISTOR_LOOKUP_SIZE - 1) return pgm_read_word(&c16[THERMISTOR_LOOKUP_SIZE - 1]) * (1.0f / 16);
+      return lerp(pgm_read_word(&c16[i]), pgm_read_word(&c16[i + 1]), raw);
+    }
+
+    // Interpolate between two neighboring entries for the low bits of 'raw'
+    static celsius_float_t lerp(const int16_t a, const int16_t b, const raw_adc_t raw) {
+      const uint16_t f = raw & (_BV(THERMISTOR_LOOKUP_SHIFT) - 1);
+      return (int32_t(a) * _BV(THERMISTOR_LOOKUP_SHIFT) + int32_t(b - a) * f) * (1.0f / (16 * _BV(THERMISTOR_LOOKUP_SHIFT)));
+    }
+
+    // °C to 1/16 °C, rounded and limited to the int16_t range
+    static constexpr int16_t to_c16(const float c) {
+      return c >= 2047 ? 2047 * 16 : c <= -2047 ? -2047 * 16 : int16_t(c >= 0 ? c * 16 + 0.5f : c * 16 - 0.5f);
+    }
+
+  private:
+    int16_t c16[THERMISTOR_LOOKUP_SIZE];
+
+    // As SCAN_THERMISTOR_TABLE: clamp outside the table, else interpolate
+    static constexpr float scan(const temp_entry_t * const tbl, const uint8_t len, const float raw) {
+      if (raw <= tbl[0].value) return tbl[0].celsius;
+      for (uint8_t i = 1; i < len; ++i)
+        if (raw <= tbl[i].value)
+          return tbl[i - 1].celsius + (raw - tbl[i - 1].value) * float(tbl[i].celsius - tbl[i - 1].celsius) / float(tbl[i].value - tbl[i - 1].value);
+      return tbl[len - 1].celsius;
+    }
+};
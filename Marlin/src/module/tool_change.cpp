@@ -33,6 +33,10 @@
 #include "../MarlinCore.h"
 #include "../gcode/gcode.h"
 
+#if HAS_TOOLCHANGE_PREHEAT
+  #include "../gcode/queue.h"
+#endif
+
 //#define DEBUG_TOOL_CHANGE
 //#define DEBUG_TOOLCHANGE_FILAMENT_SWAP
 
@@ -155,6 +159,46 @@ void _line_to_current(const AxisEnum fr_axis, const float fscale=1) {
 void slow_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.2f); }
 void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.5f); }
 
+#if ENABLED(TOOLCHANGE_PLANNED_MOVES)
+  // Like do_blocking_move_to_xy_z but leave the moves in the planner
+  static void plan_move_to_xy_z(const xy_pos_t &xy, const float z, const feedRate_t xy_feedrate, const feedRate_t z_feedrate) {
+    if (current_position.z < z) { current_position.z = z; line_to_current_position(z_feedrate); }
+    current_position.set(xy.x, xy.y); line_to_current_position(xy_feedrate);
+    if (current_position.z > z) { current_position.z = z; line_to_current_position(z_feedrate); }
+  }
+#endif
+
+#if HAS_TOOLCHANGE_PREHEAT
+
+  // The target temperature of each tool when it was last put away. Zero once it's been restored.
+  static celsius_t toolchange_preheat_temp[HOTENDS];
+
+  /**
+   * Look for a tool-change in the next TOOLCHANGE_PREHEAT_LINES queued commands and
+   * heat that tool back to the temperature it had when it was put away, so it's ready,
+   * or closer to it, when the tool-change comes.
+   */
+  void toolchange_preheat_lookahead() {
+    const GCodeQueue::RingBuffer &rb = queue.ring_buffer;
+    const uint8_t n = _MIN(rb.length, uint8_t(TOOLCHANGE_PREHEAT_LINES));
+    for (uint8_t i = 0, r = rb.index_r; i < n; ++i, r = (r + 1) % (BUFSIZE)) {
+      const char *cmd = rb.commands[r].buffer;
+      while (*cmd == ' ') cmd++;
+      if (*cmd == 'N') {                            // Skip the line number
+        do cmd++; while (NUMERIC(*cmd));
+        while (*cmd == ' ') cmd++;
+      }
+      if (*cmd != 'T' || !NUMERIC(cmd[1])) continue;
+      const uint8_t e = atoi(cmd + 1);
+      if (e < HOTENDS && e != active_extruder && toolchange_preheat_temp[e] > thermalManager.degTargetHotend(e))
+        thermalManager.setTargetHotend(toolchange_preheat_temp[e], e);
+      if (e < HOTENDS) toolchange_preheat_temp[e] = 0;
+      break;                                        // Only the next tool-change
+    }
+  }
+
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_TOOL_CHANGE)
 #include "../core/debug_out.h"
 
@@ -1192,6 +1236,8 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
     if (new_tool != old_tool || TERN0(PARKING_EXTRUDER, extruder_parked)) { // PARKING_EXTRUDER may need to attach old_tool when homing
       destination = current_position;
 
+      TERN_(HAS_TOOLCHANGE_PREHEAT, if (old_tool < HOTENDS) toolchange_preheat_temp[old_tool] = thermalManager.degTargetHotend(old_tool));
+
       #if ALL(TOOLCHANGE_FILAMENT_SWAP, HAS_FAN) && TOOLCHANGE_FS_FAN >= 0
         // Store and stop fan. Restored on any exit.
         REMEMBER(fan, thermalManager.fan_speed[TOOLCHANGE_FS_FAN], 0);
@@ -1204,7 +1250,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           current_position.z += toolchange_settings.z_raise;
           TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(current_position.z, soft_endstop.max.z));
           fast_line_to_current(Z_AXIS);
-          planner.synchronize();
+          IF_DISABLED(TOOLCHANGE_PLANNED_MOVES, planner.synchronize());
         }
       #endif
 
@@ -1265,7 +1311,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             );
           #endif
           planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), old_tool);
-          planner.synchronize();
+          IF_DISABLED(TOOLCHANGE_PLANNED_MOVES, planner.synchronize());
         }
       #endif
 
@@ -1363,15 +1409,29 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             // Just move back down
             DEBUG_ECHOLNPGM("Move back Z only");
 
-            if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park))
-              do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+            if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park)) {
+              #if ENABLED(TOOLCHANGE_PLANNED_MOVES)
+                current_position.z = destination.z;
+                line_to_current_position(planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              #else
+                do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              #endif
+            }
 
           #else
             // Move back to the original (or adjusted) position
             DEBUG_POS("Move back", destination);
 
             #if ENABLED(TOOLCHANGE_PARK)
-              if (toolchange_settings.enable_park) do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+              if (toolchange_settings.enable_park) {
+                #if ENABLED(TOOLCHANGE_PLANNED_MOVES)
+                  plan_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+                #else
+                  do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+                #endif
+              }
+            #elif ENABLED(TOOLCHANGE_PLANNED_MOVES)
+              plan_move_to_xy_z(destination, destination.z, planner.settings.max_feedrate_mm_s[X_AXIS] * 0.5f, planner.settings.max_feedrate_mm_s[Z_AXIS]);
             #else
               do_blocking_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]* 0.5f);
 
@@ -132,3 +132,7 @@
  * previous tool out of the way and the new tool into place.
  */
 void tool_change(const uint8_t tmp_extruder, bool no_move=false);
+
+#if HAS_TOOLCHANGE_PREHEAT
+  void toolchange_preheat_lookahead();
+#endif
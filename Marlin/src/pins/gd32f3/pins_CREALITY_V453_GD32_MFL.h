@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Creality MFL GD32 V4.5.3 (GD32F303RE) board pin assignments
+ * Same layout as the STM32F103RE board. The GD32F303RE runs at 120MHz.
+ */
+
+#if HAS_MULTI_HOTEND || E_STEPPERS > 1
+  #error "Creality v4.5.3 only supports 1 hotend / E stepper."
+#endif
+
+#define ALLOW_GD32F3
+
+#define BOARD_INFO_NAME "Creality V4.5.3 MFL"
+
+#define HEATER_0_PIN                        PB14  // HEATER1
+#define HEATER_BED_PIN                      PB13  // HOT BED
+#define FAN0_PIN                            PB15  // FAN
+
+#if ENABLED(PROBE_ACTIVATION_SWITCH)
+  #ifndef PROBE_ACTIVATION_SWITCH_PIN
+    #define PROBE_ACTIVATION_SWITCH_PIN     PB2   // Optoswitch to Enable Z Probe
+  #endif
+#endif
+
+#include "../stm32f1/pins_CREALITY_V45x.h"
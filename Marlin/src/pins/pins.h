@@ -934,6 +934,8 @@
   #include "gd32f3/pins_CREALITY_V422_GD32_MFL.h"   // GD32F303RE                           env:GD32F303RE_creality_mfl
 #elif MB(CREALITY_V427_GD32_MFL)
   #include "gd32f3/pins_CREALITY_V427_GD32_MFL.h"   // GD32F303RE                           env:GD32F303RE_creality_mfl
+#elif MB(CREALITY_V453_GD32_MFL)
+  #include "gd32f3/pins_CREALITY_V453_GD32_MFL.h"   // GD32F303RE                           env:GD32F303RE_creality_mfl env:GD32F303RE_creality_v453_mfl
 
 //
 // Raspberry Pi RP2040
@@ -53,6 +53,7 @@
 #if NO_EEPROM_SELECTED
   #define IIC_BL24CXX_EEPROM                      // EEPROM on I2C-0
   //#define SDCARD_EEPROM_EMULATION
+  //#define FLASH_EEPROM_EMULATION                // Use with FLASH_EEPROM_JOURNAL
   #undef NO_EEPROM_SELECTED
 #endif
 
@@ -64,7 +65,7 @@
     #define IIC_EEPROM_SCL                  PA12
   #endif
   #define MARLIN_EEPROM_SIZE              0x800U  // 2K (24C16)
-#elif ENABLED(SDCARD_EEPROM_EMULATION)
+#elif ANY(SDCARD_EEPROM_EMULATION, FLASH_EEPROM_JOURNAL)
   #define MARLIN_EEPROM_SIZE              0x800U  // 2K
 #endif
 
@@ -121,6 +121,11 @@
 // Send command and return error code. Return zero for OK
 uint8_t DiskIODriver_SPI_SD::cardCommand(const uint8_t cmd, const uint32_t arg) {
 
+  #if ENABLED(SD_MULTIBLOCK_READ)
+    if (cmd != CMD12) endSeqRead(); // Any other command ends a multi-block read
+  #endif
+  TERN_(SD_MULTIBLOCK_WRITE, endSeqWrite()); // Any command ends a multi-block write
+
   #if ENABLED(SDCARD_COMMANDS_SPLIT)
     if (cmd != CMD12) chipDeselect();
   #endif
@@ -286,6 +291,8 @@ bool DiskIODriver_SPI_SD::init(const uint8_t sckRateID, const pin_t chipSelectPi
 
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+  TERN_(SD_MULTIBLOCK_READ, seqRead_ = false);
+  TERN_(SD_MULTIBLOCK_WRITE, seqWrite_ = false);
 
   // 16-bit init start time allows over a minute
   #if SD_INIT_TIMEOUT
@@ -400,6 +407,17 @@ bool DiskIODriver_SPI_SD::readBlock(uint32_t blockNumber, uint8_t * const dst) {
     return 0 == SDHC_CardReadBlock(dst, blockNumber);
   #endif
 
+  #if ENABLED(SD_MULTIBLOCK_READ)
+    // Continue a multi-block read, or start one when the previous read was the block before
+    if (blockNumber == seqBlock_) {
+      if (!seqRead_) seqRead_ = readStart(blockNumber);
+      if (seqRead_ && readData(dst)) { seqBlock_++; return true; }
+      endSeqRead();                                     // Fall back to a single block read
+      errorCode_ = 0;
+    }
+    seqBlock_ = blockNumber + 1;
+  #endif
+
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
 
   #if ENABLED(SD_CHECK_AND_RETRY)
@@ -630,6 +648,18 @@ bool DiskIODriver_SPI_SD::writeBlock(uint32_t blockNumber, const uint8_t * const
     return 0 == SDHC_CardWriteBlock(src, blockNumber);
   #endif
 
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    // Continue a multi-block write, or start one when the previous write was the block before.
+    // The card programs each block while the next one is prepared.
+    if (blockNumber == seqWriteBlock_) {
+      if (!seqWrite_) seqWrite_ = writeStart(blockNumber, 1);
+      if (seqWrite_ && writeData(src)) { seqWriteBlock_++; return true; }
+      endSeqWrite();                                  // Fall back to a single block write
+      errorCode_ = 0;
+    }
+    seqWriteBlock_ = blockNumber + 1;
+  #endif
+
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9; // Use address if not SDHC card
   bool success = !cardCommand(CMD24, blockNumber);
   if (!success) {
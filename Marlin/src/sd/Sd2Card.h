@@ -165,7 +165,11 @@ public:
 
   bool isReady() override { return ready; };
 
-  void idle() override {}
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    void idle() override { endSeqWrite(); } // Finish an open multi-block write
+  #else
+    void idle() override {}
+  #endif
 
 private:
   bool ready = false;
@@ -189,4 +193,15 @@ private:
   inline void type(const uint8_t value) { type_ = value; }
   bool waitNotBusy(const millis_t timeout_ms);
   bool writeData(const uint8_t token, const uint8_t * const src);
+
+  #if ENABLED(SD_MULTIBLOCK_READ)
+    bool seqRead_ = false;  // A CMD18 multi-block read is open
+    uint32_t seqBlock_ = 0; // Next block of the open read, or the one after the last single block read
+    void endSeqRead() { if (seqRead_) { seqRead_ = false; readStop(); } }
+  #endif
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    bool seqWrite_ = false;       // A CMD25 multi-block write is open
+    uint32_t seqWriteBlock_ = 0;  // Next block of the open write, or the one after the last single block write
+    void endSeqWrite() { if (seqWrite_) { seqWrite_ = false; writeStop(); } }
+  #endif
 };
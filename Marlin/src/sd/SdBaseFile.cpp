@@ -1390,10 +1390,25 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
       uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
       if (offset == 0 && blockOfCluster == 0) {
         // start of new cluster
+        #if ENABLED(SD_FAT_RUN_CACHE)
+          const bool in_run = runChanges_ == vol_->fatChanges_ && curCluster_ >= runStart_;
+        #endif
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
+        #if ENABLED(SD_FAT_RUN_CACHE)
+          else if (in_run && curCluster_ < runEnd_)
+            curCluster_++;                                  // next cluster of a known run
+        #endif
         else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
           return -1;
+        #if ENABLED(SD_FAT_RUN_CACHE)
+          // Find the run of contiguous clusters that follows
+          if (!in_run || curCluster_ < runStart_ || curCluster_ > runEnd_) {
+            runChanges_ = vol_->fatChanges_;
+            runStart_ = curCluster_;
+            if (!vol_->fatRunEnd(curCluster_, &runEnd_)) return -1;
+          }
+        #endif
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     }
@@ -1402,6 +1417,20 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
     // amount to be read from current block
     NOMORE(n, 512 - offset);
 
+    #if ENABLED(SD_MULTIBLOCK_READ)
+      // Whole blocks up to the end of the cluster in one read, stopping short of the cached block
+      uint16_t nb = 1;
+      if (n == 512 && toRead >= 1024 && type_ != FAT_FILE_TYPE_ROOT_FIXED) {
+        nb = _MIN(uint16_t(toRead >> 9), uint16_t(vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_)));
+        const uint32_t cached = vol_->cacheBlockNumber();
+        if (cached >= block && cached < block + nb) nb = cached - block;
+      }
+      if (nb > 1) {
+        if (!vol_->readBlocks(block, dst, nb)) return -1;
+        n = nb << 9;
+      }
+      else
+    #endif
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
       if (!vol_->readBlock(block, dst)) return -1;
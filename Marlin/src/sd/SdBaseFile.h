@@ -367,6 +367,11 @@ class SdBaseFile {
   uint8_t   dirIndex_;      // index of directory entry in dirBlock
   uint32_t  fileSize_;      // file size in bytes
   uint32_t  firstCluster_;  // first cluster of file
+  #if ENABLED(SD_FAT_RUN_CACHE)
+    uint32_t runStart_ = 0,   // run of contiguous clusters around the current cluster
+             runEnd_ = 0,
+             runChanges_ = 0; // SdVolume FAT changes when the run was found
+  #endif
   SdVolume  *vol_;          // volume where file is located
 
   /**
@@ -37,6 +37,10 @@
 
 #include "../MarlinCore.h"
 
+#if HAS_SD_READ_STATS
+  uint32_t SdReadTimer::max_us; // = 0
+#endif
+
 #if !USE_MULTIPLE_CARDS
   // raw block cache
   uint32_t SdVolume::cacheBlockNumber_;  // current block number
@@ -123,6 +127,7 @@ bool SdVolume::allocContiguous(const uint32_t count, uint32_t * const curCluster
 bool SdVolume::cacheFlush() {
   #if DISABLED(SDCARD_READONLY)
     if (cacheDirty_) {
+      MEDIA_LOCK();
       if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data))
         return false;
 
@@ -139,8 +144,10 @@ bool SdVolume::cacheFlush() {
 }
 
 bool SdVolume::cacheRawBlock(const uint32_t blockNumber, const bool dirty) {
+  MEDIA_LOCK();
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheFlush()) return false;
+    TERN_(FLIGHT_RECORDER, FLIGHT_SCOPE(SD_READ, 1)); SD_READ_TIMER();
     if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
     cacheBlockNumber_ = blockNumber;
   }
@@ -194,10 +201,30 @@ bool SdVolume::fatGet(const uint32_t cluster, uint32_t * const value) {
   return true;
 }
 
+#if ENABLED(SD_FAT_RUN_CACHE)
+
+  // Find the last cluster of the contiguous run starting at cluster, looking at one FAT block
+  bool SdVolume::fatRunEnd(const uint32_t cluster, uint32_t * const end) {
+    const uint8_t shift = fatType_ == 32 ? 7 : fatType_ == 16 ? 8 : 0;
+    uint32_t c = cluster;
+    if (shift) {
+      for (uint32_t next; (c >> shift) == (cluster >> shift); c = next) {
+        if (!fatGet(c, &next)) return false;
+        if (next != c + 1) break;
+      }
+    }
+    *end = c;
+    return true;
+  }
+
+#endif
+
 // Store a FAT entry
 bool SdVolume::fatPut(const uint32_t cluster, const uint32_t value) {
   if (ENABLED(SDCARD_READONLY)) return false;
 
+  TERN_(SD_FAT_RUN_CACHE, fatChanges_++);
+
   uint32_t lba;
   // error if reserved cluster
   if (cluster < 2) return false;
@@ -336,6 +363,7 @@ bool SdVolume::init(DiskIODriver * const dev, const uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_FAT_RUN_CACHE, fatChanges_++); // Expire the cluster runs of the last volume
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
@@ -47,6 +47,28 @@
 #include "SdFatConfig.h"
 #include "SdFatStructs.h"
 
+#if ENABLED(FLIGHT_RECORDER)
+  #include "../feature/flight_recorder.h"
+#endif
+
+#if ENABLED(MSC_SHARED_PRINTING)
+  #include "../feature/media_share.h"
+#else
+  #define MEDIA_LOCK() NOOP
+#endif
+
+#if HAS_SD_READ_STATS
+  // Keep the longest block read until a reader clears max_us
+  struct SdReadTimer {
+    static uint32_t max_us;
+    const uint32_t start_us = micros();
+    ~SdReadTimer() { NOLESS(max_us, micros() - start_us); }
+  };
+  #define SD_READ_TIMER() SdReadTimer _sd_read_timer
+#else
+  #define SD_READ_TIMER() NOOP
+#endif
+
 //==============================================================================
 // SdVolume class
 
@@ -129,9 +151,24 @@ class SdVolume {
    */
   bool dbgFat(const uint32_t n, uint32_t * const v) { return fatGet(n, v); }
 
+  #if ENABLED(MSC_SHARED_PRINTING)
+    /**
+     * The USB host is writing blocks. Drop a clean cached block it overwrites.
+     * \return false if it would overwrite changes still in the cache.
+     */
+    bool hostWrite(const uint32_t block, const uint16_t count) {
+      const bool hit = cacheBlockNumber_ - block < count,
+                 mirror_hit = cacheMirrorBlock_ && cacheMirrorBlock_ - block < count;
+      if (cacheDirty_ && (hit || mirror_hit)) return false;
+      if (hit) cacheBlockNumber_ = 0xFFFFFFFF;
+      return true;
+    }
+  #endif
+
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
+  TERN_(MSC_SHARED_PRINTING, friend class MediaShare);
 
   // value for dirty argument in cacheRawBlock to indicate read from cache
   static bool const CACHE_FOR_READ = false;
@@ -163,6 +200,9 @@ class SdVolume {
   uint8_t fatType_;             // volume type (12, 16, OR 32)
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
+  #if ENABLED(SD_FAT_RUN_CACHE)
+    uint32_t fatChanges_;       // count of FAT writes, to expire cluster runs
+  #endif
 
   bool allocContiguous(const uint32_t count, uint32_t * const curCluster);
   uint8_t blockOfCluster(const uint32_t position) const { return (position >> 9) & (blocksPerCluster_ - 1); }
@@ -188,6 +228,9 @@ class SdVolume {
   void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
   bool chainSize(uint32_t cluster, uint32_t * const size);
   bool fatGet(const uint32_t cluster, uint32_t * const value);
+  #if ENABLED(SD_FAT_RUN_CACHE)
+    bool fatRunEnd(const uint32_t cluster, uint32_t * const end);
+  #endif
   bool fatPut(const uint32_t cluster, const uint32_t value);
   bool fatPutEOC(const uint32_t cluster) { return fatPut(cluster, 0x0FFFFFFF); }
   bool freeChain(uint32_t cluster);
@@ -196,8 +239,15 @@ class SdVolume {
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
     return cluster >= FAT32EOC_MIN;
   }
-  bool readBlock(const uint32_t block, uint8_t * const dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(const uint32_t block, const uint8_t * const dst) { return sdCard_->writeBlock(block, dst); }
+  bool readBlock(const uint32_t block, uint8_t * const dst) {
+    MEDIA_LOCK(); TERN_(FLIGHT_RECORDER, FLIGHT_SCOPE(SD_READ, 1)); SD_READ_TIMER();
+    return sdCard_->readBlock(block, dst);
+  }
+  bool readBlocks(const uint32_t block, uint8_t * const dst, const uint16_t count) {
+    MEDIA_LOCK(); TERN_(FLIGHT_RECORDER, FLIGHT_SCOPE(SD_READ, uint8_t(_MIN(count, 255U)))); SD_READ_TIMER();
+    return sdCard_->readBlocks(block, dst, count);
+  }
+  bool writeBlock(const uint32_t block, const uint8_t * const dst) { MEDIA_LOCK(); return sdCard_->writeBlock(block, dst); }
 };
 
 using MarlinVolume = SdVolume;
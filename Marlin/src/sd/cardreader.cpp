@@ -68,6 +68,18 @@
 
 #include "../gcode/custom/M1125.h"
 
+#if ENABLED(LOOP_LATENCY_MONITOR)
+  #include "../feature/loop_latency.h"
+#endif
+
+#if ENABLED(GCODE_METADATA_INDEX)
+  #include "../feature/gcode_metadata.h"
+#endif
+
+#if ENABLED(SD_BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 #define DEBUG_OUT ANY(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -94,6 +106,9 @@ IF_DISABLED(NO_SD_AUTOSTART, uint8_t CardReader::autofile_index); // = 0
 MediaFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 int16_t CardReader::nrItems = -1;
+#if ENABLED(SD_DIR_INDEX)
+  uint16_t CardReader::dir_index[SD_DIR_INDEX_LIMIT];
+#endif
 
 #if ENABLED(SDCARD_SORT_ALPHA)
 
@@ -163,6 +178,19 @@ MediaFile CardReader::myfile;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ra_buf[SD_READ_AHEAD_BUFFERS][512];
+  uint16_t CardReader::ra_len[SD_READ_AHEAD_BUFFERS], CardReader::ra_index;
+  uint8_t CardReader::ra_head, CardReader::ra_tail, CardReader::ra_count;
+#endif
+
+#if HAS_MEDIA_DECODER
+  heatshrink_decoder CardReader::hsd;
+  uint8_t CardReader::hs_buf[SD_DECODE_BUFFER];
+  uint16_t CardReader::hs_len, CardReader::hs_index;
+  uint32_t CardReader::hs_pos;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -235,17 +263,33 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || ( binFiles && fileIsBinary())                    // BIN files are accepted
     || (!binFiles && p.name[8] == 'G'
                   && p.name[9] != '~')                  // Non-backup *.G* files are accepted
+    #if ENABLED(SD_HEATSHRINK)
+      || (!binFiles && p.name[8] == 'H' && p.name[9] == 'S' && p.name[10] == ' ') // Compressed *.HS files are accepted
+    #endif
+    #if ENABLED(SD_BINARY_GCODE)
+      || (!binFiles && p.name[8] == 'B' && p.name[9] == 'G' && p.name[10] == 'C') // Binary *.BGC(ODE) files are accepted
+    #endif
   );
 }
 
 //
-// Get the number of (compliant) items in the folder
+// Get the number of (compliant) items in the folder.
+// With SD_DIR_INDEX also index their directory entries (for the workDir).
 //
 int16_t CardReader::countVisibleItems(MediaFile dir) {
   dir_t p;
   int16_t c = 0;
   dir.rewind();
-  while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #if ENABLED(SD_DIR_INDEX)
+    for (uint32_t pos = 0; dir.readDir(&p, longFilename) > 0; pos = dir.curPosition()) {
+      if (is_visible_entity(p)) {
+        if (c < SD_DIR_INDEX_LIMIT) dir_index[c] = pos >> 5; // Entry (or its long name) starts here
+        c++;
+      }
+    }
+  #else
+    while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #endif
   return c;
 }
 
@@ -292,6 +336,9 @@ void CardReader::printListing(MediaFile parent, const char * const prepend, cons
   OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong/*=nullptr*/)
 ) {
   const bool includeTime = TERN0(M20_TIMESTAMP_SUPPORT, TEST(lsflags, LS_TIMESTAMP));
+  #if ENABLED(GCODE_METADATA_INDEX)
+    const bool includeMeta = TEST(lsflags, LS_METADATA);
+  #endif
   #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
     const bool includeLong = TEST(lsflags, LS_LONG_FILENAME);
   #endif
@@ -344,6 +391,12 @@ void CardReader::printListing(MediaFile parent, const char * const prepend, cons
         SERIAL_ECHOPGM(" 0x", hex_word(crmodDate));
         print_hex_word(crmodTime);
       }
+      #if ENABLED(GCODE_METADATA_INDEX)
+        if (includeMeta) {
+          gcode_metadata_t meta;
+          if (gcodemeta.get(&parent, filename, meta, &p)) gcodemeta.print(meta);
+        }
+      #endif
       #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
         if (includeLong) {
           SERIAL_CHAR(' ');
@@ -480,16 +533,22 @@ void CardReader::printSelectedFilename() {
 }
 
 void CardReader::mount() {
+  TERN_(LOOP_LATENCY_MONITOR, LOOP_LATENCY_SCOPE(MEDIA));
+
   flag.mounted = false;
   nrItems = -1;
   if (root.isOpen()) root.close();
 
-  const bool driver_init = (
-    driver->init(SD_SPI_SPEED, SD_SS_PIN)
-    #if PIN_EXISTS(LCD_SDSS) && (LCD_SDSS_PIN != SD_SS_PIN)
-      || driver->init(SD_SPI_SPEED, LCD_SDSS_PIN)
-    #endif
-  );
+  bool driver_init;
+  {
+    MEDIA_LOCK();
+    driver_init = (
+      driver->init(SD_SPI_SPEED, SD_SS_PIN)
+      #if PIN_EXISTS(LCD_SDSS) && (LCD_SDSS_PIN != SD_SS_PIN)
+        || driver->init(SD_SPI_SPEED, LCD_SDSS_PIN)
+      #endif
+    );
+  }
 
   if (!driver_init)
     SERIAL_ECHO_MSG(STR_SD_INIT_FAIL);
@@ -587,7 +646,20 @@ void CardReader::manage_media() {
     #endif
   );
 
-  if (stat == prev_stat) return;    // Already checked and still no change?
+  #if ENABLED(SD_ASYNC_MOUNT)
+    static bool boot_wait = true,   // Show "loading" on the first check and mount on the next
+                prefetch = false;   // Read the directory on the idle after the boot mount
+  #endif
+
+  if (stat == prev_stat) {          // Already checked and still no change?
+    #if ENABLED(SD_ASYNC_MOUNT)
+      if (prefetch) {
+        prefetch = false;
+        if (isMounted() && !isFileOpen()) get_num_items();
+      }
+    #endif
+    return;
+  }
 
   DEBUG_SECTION(cmm, "CardReader::manage_media()", true);
   DEBUG_ECHOLNPGM("Media present: ", prev_stat, " -> ", stat);
@@ -595,6 +667,16 @@ void CardReader::manage_media() {
   // Without a UI there's no auto-mount or release
   if (!ui.detected()) { DEBUG_ECHOLNPGM("SD: No UI Detected."); return; }
 
+  #if ENABLED(SD_ASYNC_MOUNT)
+    if (boot_wait) {
+      boot_wait = false;
+      if (stat != INSERT_NONE && DISABLED(SD_IGNORE_AT_STARTUP)) {
+        LCD_MESSAGE(MSG_MEDIA_LOADING);
+        return;                     // Let the UI draw before the mount blocks
+      }
+    }
+  #endif
+
   const MediaPresence old_stat = prev_stat,
                       old_real = old_stat == MEDIA_BOOT ? INSERT_NONE : old_stat;
   prev_stat = stat;                 // Change now to prevent re-entry in safe_delay
@@ -626,8 +708,15 @@ void CardReader::manage_media() {
           else if (vadd & INSERT_USB) selectMediaFlashDrive();
         #endif
       #endif
-      safe_delay(500);                  // Time for inserted media to settle. May re-enter for multiple media?
+      // Time for inserted media to settle. May re-enter for multiple media?
+      if (TERN1(SD_ASYNC_MOUNT, old_stat > MEDIA_BOOT)) safe_delay(500);
       mount();
+      #if ENABLED(SD_ASYNC_MOUNT)
+        if (old_stat == MEDIA_BOOT) {
+          ui.reset_status();
+          prefetch = isMounted();
+        }
+      #endif
     }
 
     // If the selected media isn't mounted throw an alert in ui.media_changed
@@ -690,8 +779,12 @@ void CardReader::manage_media() {
 void CardReader::release() {
   if (!flag.mounted) return;
 
+  // A job copied to SPI flash goes on without the media
+  if (TERN0(SD_JOB_CACHE, isFileOpen() && jobcache.complete())) {
+    SERIAL_ECHO_MSG("Printing from job cache");
+  }
   // Card removed while printing or while a start is pending? Abort!
-  if (isStillPrinting() || flag.pending_print_start) {
+  else if (isStillPrinting() || flag.pending_print_start) {
     // If the canonical PrintSource indicates the job is coming from SD,
     // or a start was recently requested from SD (pending M24), the print
     // becomes unrecoverable when media is removed. Abort immediately so
@@ -763,6 +856,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   flag.abort_sd_printing = false;
   // Clear any pending-start marker; print is ending.
   flag.pending_print_start = false;
+  TERN_(SD_LAYER_INDEX, layerindex.end(false));
   if (isFileOpen()) myfile.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 
@@ -861,10 +955,10 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
 
         // Store current filename (based on workDirParents) and position
         getAbsFilenameInCWD(proc_filenames[file_subcall_ctr]);
-        filespos[file_subcall_ctr] = sdpos;
+        filespos[file_subcall_ctr] = getIndex();
 
         // For sub-procedures say 'SUBROUTINE CALL target: "..." parent: "..." pos12345'
-        SERIAL_ECHO_MSG("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", sdpos);
+        SERIAL_ECHO_MSG("SUBROUTINE CALL target:\"", path, "\" parent:\"", proc_filenames[file_subcall_ctr], "\" pos", filespos[file_subcall_ctr]);
         file_subcall_ctr++;
         break;
 
@@ -884,6 +978,29 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (myfile.open(diveDir, fname, O_READ)) {
     filesize = myfile.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, reset_read_ahead());
+    #if HAS_MEDIA_DECODER
+      #if ENABLED(SD_HEATSHRINK)
+        dir_t d;
+        flag.compressed = myfile.dirEntry(&d) && d.name[8] == 'H' && d.name[9] == 'S' && d.name[10] == ' ';
+      #else
+        flag.compressed = false;
+      #endif
+      #if ENABLED(SD_BINARY_GCODE)
+        flag.binary_gcode = !flag.compressed && BinaryGcode::start(); // Any file with the binary G-code header
+        if (flag.binary_gcode) flag.compressed = true;
+      #endif
+      if (flag.compressed) hs_reset();
+    #endif
+    #if ENABLED(SD_LAYER_INDEX)
+      if (subcall_type == 0) layerindex.start(diveDir, fname);
+    #endif
+    #if ENABLED(SD_JOB_CACHE)
+      if (subcall_type == 0) jobcache.start(diveDir, fname, filesize);
+    #endif
+    #if ENABLED(MSC_SHARED_PRINTING)
+      if (subcall_type == 0) mediashare.job_start(myfile);
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -926,6 +1043,7 @@ void CardReader::openFileWrite(const char * const path) {
   #if DISABLED(SDCARD_READONLY)
     if (myfile.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      nrItems = -1;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -981,6 +1099,7 @@ void CardReader::removeFile(const char * const name) {
     if (myfile.remove(itsDirPtr, fname)) {
       SERIAL_ECHOLNPGM("File deleted:", fname);
       sdpos = 0;
+      nrItems = -1;
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -998,8 +1117,16 @@ void CardReader::report_status(TERN_(QUIETER_AUTO_REPORT_SD_STATUS, const bool i
     if (has_job) old_sdpos = sdpos;
   #endif
 
-  if (has_job)
+  if (has_job) {
     SERIAL_ECHOLN(F(STR_SD_PRINTING_BYTE), sdpos, C('/'), filesize);
+    #if ENABLED(SD_LAYER_INDEX)
+      if (layerindex.layer()) {
+        SERIAL_ECHOPGM("Layer ", layerindex.layer());
+        if (layerindex.layers()) SERIAL_ECHOPGM("/", layerindex.layers());
+        SERIAL_EOL();
+      }
+    #endif
+  }
   else
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
 }
@@ -1007,6 +1134,68 @@ void CardReader::report_status(TERN_(QUIETER_AUTO_REPORT_SD_STATUS, const bool i
 //
 // Write a command to the log file
 //
+#if ENABLED(SD_COMPACT_MOVES)
+
+  static bool is_move_param(const char c) {
+    if (c == 'F') return true;
+    LOOP_LOGICAL_AXES(i) if (c == AXIS_CHAR(i)) return true;
+    return false;
+  }
+
+  /**
+   * Copy a plain G0/G1 line (only axis and F parameters, each with a numeric value)
+   * with no spaces and values rounded to 5 decimal places, without trailing zeros.
+   * e.g., "G1 X10.500 Y-0.2500001 F3000.0" is written as "G1X10.5Y-.25F3000".
+   * Return false for any other line, to write it as it is.
+   */
+  static bool compact_move(const char *p, char *out) {
+    if (p[0] != 'G' || (p[1] != '0' && p[1] != '1') || NUMERIC(p[2]) || p[2] == '.') return false;
+    *out++ = 'G'; *out++ = p[1];
+    p += 2;
+    for (;;) {
+      while (*p == ' ') p++;
+      if (!*p) break;
+      const char param = *p++;
+      if (!is_move_param(param)) return false;
+      *out++ = param;
+
+      while (*p == ' ') p++;
+      const bool neg = *p == '-';
+      if (neg || *p == '+') p++;
+      if (!NUMERIC(*p) && !(*p == '.' && NUMERIC(p[1]))) return false;
+
+      // The value in units of 0.00001, rounded
+      uint64_t m = 0;
+      uint8_t digits = 0, places = 0;
+      for (; NUMERIC(*p); ++p) if (++digits > 9) return false; else m = m * 10 + (*p - '0');
+      if (*p == '.') {
+        for (++p; NUMERIC(*p); ++p) {
+          if (places < 5) { m = m * 10 + (*p - '0'); places++; }
+          else if (places == 5) { if (*p >= '5') m++; places++; }
+        }
+      }
+      if (*p && *p != ' ') return false;
+      for (; places < 5; ++places) m *= 10;
+
+      uint32_t ipart = m / 100000UL, fpart = m % 100000UL;
+      if (neg && m) *out++ = '-';
+      char d[10];
+      uint8_t n = 0;
+      do { d[n++] = '0' + ipart % 10; ipart /= 10; } while (ipart);
+      if (n == 1 && d[0] == '0' && fpart) n = 0;                // ".5", like the original at most
+      while (n) *out++ = d[--n];
+      if (fpart) {
+        *out++ = '.';
+        uint32_t div = 10000UL;
+        while (fpart) { *out++ = '0' + fpart / div; fpart %= div; div /= 10; }
+      }
+    }
+    *out = '\0';
+    return true;
+  }
+
+#endif // SD_COMPACT_MOVES
+
 void CardReader::write_command(char * const buf) {
   char *begin = buf,
        *npos = nullptr,
@@ -1017,6 +1206,16 @@ void CardReader::write_command(char * const buf) {
     begin = strchr(npos, ' ') + 1;
     end = strchr(npos, '*') - 1;
   }
+
+  #if ENABLED(SD_COMPACT_MOVES)
+    char line[MAX_CMD_SIZE + 3];  // Never longer than the command, plus the EOL
+    end[1] = '\0';
+    if (compact_move(begin, line)) {
+      begin = line;
+      end = line + strlen(line) - 1;
+    }
+  #endif
+
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
@@ -1143,13 +1342,144 @@ void CardReader::write_command(char * const buf) {
 
 #endif // ONE_CLICK_PRINT
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read the next part of the open file into a free read-ahead buffer.
+   * A read after a seek ends on a block boundary, so the reads that follow
+   * are whole blocks that go straight from the card into the buffers.
+   * Return false if there is no free buffer or nothing left to read.
+   */
+  bool CardReader::fill_read_ahead() {
+    if (ra_count >= SD_READ_AHEAD_BUFFERS || !myfile.isOpen()) return false;
+    #if ENABLED(SD_JOB_CACHE)
+      // The file position after the buffered data
+      uint32_t pos = sdpos - ra_index;
+      for (uint8_t i = 0, b = ra_tail; i < ra_count; ++i, b = (b + 1) % (SD_READ_AHEAD_BUFFERS)) pos += ra_len[b];
+      const uint16_t len = 512 - (pos & 0x1FF);
+      // Read the copy in SPI flash, or the media for a part not copied yet
+      int16_t n = jobcache.read(pos, ra_buf[ra_head], len);
+      if (n < 0) {
+        if (myfile.curPosition() != pos && !myfile.seekSet(pos)) return false;
+        n = myfile.read(ra_buf[ra_head], len);
+      }
+    #else
+      const int16_t n = myfile.read(ra_buf[ra_head], 512 - (myfile.curPosition() & 0x1FF));
+    #endif
+    if (n <= 0) return false;
+    ra_len[ra_head] = n;
+    ra_head = (ra_head + 1) % (SD_READ_AHEAD_BUFFERS);
+    ra_count++;
+    return true;
+  }
+
+  // Called from idle. Fill one buffer per call while printing and copy the job to SPI flash.
+  void CardReader::read_ahead() {
+    if (isStillPrinting()) fill_read_ahead();
+    TERN_(SD_JOB_CACHE, jobcache.task());
+  }
+
+  // Get the next byte, reading the card only when the buffers have run dry
+  int16_t CardReader::raw_get() {
+    if (!ra_count && !fill_read_ahead()) return -1;
+    const uint8_t c = ra_buf[ra_tail][ra_index];
+    if (++ra_index >= ra_len[ra_tail]) {
+      ra_index = 0;
+      ra_tail = (ra_tail + 1) % (SD_READ_AHEAD_BUFFERS);
+      ra_count--;
+    }
+    sdpos++;
+    return c;
+  }
+
+  // Direct reads continue from the current index
+  int16_t CardReader::read(void *buf, uint16_t nbyte) {
+    if (!myfile.isOpen()) return -1;
+    flush_read_ahead();
+    const int16_t n = myfile.read(buf, nbyte);
+    sdpos = myfile.curPosition();
+    return n;
+  }
+
+#endif // SD_READ_AHEAD
+
+#if HAS_MEDIA_DECODER
+
+  void CardReader::hs_reset() {
+    heatshrink_decoder_reset(&hsd);
+    hs_len = hs_index = 0;
+    hs_pos = 0;
+  }
+
+  /**
+   * Decode the next part of the file into the G-code buffer, feeding the
+   * decoder from the card whenever it runs out of input.
+   * Return false at the end of the file.
+   */
+  bool CardReader::hs_fill() {
+    hs_index = 0;
+    #if ENABLED(SD_BINARY_GCODE)
+      if (flag.binary_gcode) return (hs_len = BinaryGcode::fill(hs_buf, sizeof(hs_buf)));
+    #endif
+    hs_len = 0;
+    for (;;) {
+      size_t count;
+      if (heatshrink_decoder_poll(&hsd, hs_buf, sizeof(hs_buf), &count) < 0) return false;
+      if (count) { hs_len = count; return true; }
+
+      // The decoder input is empty, so a whole input buffer can be sunk
+      uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      uint8_t n = 0;
+      while (n < sizeof(in) && sdpos < filesize) {
+        const int16_t c = raw_get();
+        if (c < 0) break;
+        in[n++] = c;
+      }
+      if (!n) return false;
+      heatshrink_decoder_sink(&hsd, in, n, &count);
+    }
+  }
+
+  int16_t CardReader::hs_get() {
+    if (hs_index >= hs_len && !hs_fill()) return -1;
+    hs_pos++;
+    return hs_buf[hs_index++];
+  }
+
+  /**
+   * A compressed file can only be decoded from the start. Go back within the
+   * decoded buffer (e.g., to read a line again) or else start over, then decode
+   * up to the new index.
+   */
+  void CardReader::hs_seek(const uint32_t index) {
+    const uint32_t buf_start = hs_pos - hs_index;
+    if (index >= buf_start && index < hs_pos) {
+      hs_index = index - buf_start;
+      hs_pos = index;
+      return;
+    }
+    if (index < hs_pos) {
+      if (TERN0(SD_BINARY_GCODE, flag.binary_gcode)) BinaryGcode::start(); else raw_seek(0);
+      hs_reset();
+    }
+    while (hs_pos < index && hs_get() >= 0)
+      if (!(hs_pos & 0x3FFF)) hal.watchdog_refresh();
+  }
+
+#endif // HAS_MEDIA_DECODER
+
 //
 // Close the working file.
 //
 void CardReader::closefile(const bool store_location/*=false*/) {
   myfile.sync();
   myfile.close();
+  TERN_(SD_MULTIBLOCK_WRITE, driver->idle()); // Finish any open transfer
   flag.saving = flag.logging = false;
+  TERN_(HAS_MEDIA_DECODER, flag.compressed = false);
+  TERN_(SD_BINARY_GCODE, flag.binary_gcode = false);
+  TERN_(SD_JOB_CACHE, jobcache.stop());
+  TERN_(MSC_SHARED_PRINTING, mediashare.job_end());
   sdpos = 0;
 
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
@@ -1173,6 +1503,13 @@ void CardReader::selectFileByIndex(const int16_t nr) {
       return;
     }
   #endif
+  #if ENABLED(SD_DIR_INDEX)
+    if (nr >= 0 && nr < _MIN(get_num_items(), SD_DIR_INDEX_LIMIT)) {
+      workDir.seekSet(uint32_t(dir_index[nr]) << 5);
+      selectByIndex(workDir, 0);
+      return;
+    }
+  #endif
   workDir.rewind();
   selectByIndex(workDir, nr);
   hal.watchdog_refresh(); // Prevent watchdog reset in long listings
@@ -1600,6 +1937,7 @@ void CardReader::fileHasFinished() {
     }
   #endif
 
+  TERN_(SD_LAYER_INDEX, layerindex.end(true)); // Reached the end, so all layers are indexed
   endFilePrintNow(TERN_(SD_RESORT, true));
 
   flag.sdprintdone = true;                    // Stop getting bytes from the SD card
@@ -1623,6 +1961,20 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Keep the preallocated file so writes only replace sectors, without FAT updates
+      if (!read) {
+        if (recovery.file.open(&root, recovery.filename, O_RDWR)) {
+          if (recovery.file.fileSize() >= recovery.file_size) return;
+          recovery.file.remove();
+        }
+        if (!recovery.file.createContiguous(&root, recovery.filename, recovery.file_size))
+          openFailed(recovery.filename);
+        else
+          echo_write_to_file(recovery.filename);
+        return;
+      }
+    #endif
     if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
       openFailed(recovery.filename);
     else if (!read)
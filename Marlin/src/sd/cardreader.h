@@ -60,6 +60,18 @@ extern const char M23_STR[], M24_STR[];
   #include "Sd2Card.h"
 #endif
 
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../feature/layer_index.h"
+#endif
+
+#if ENABLED(SD_JOB_CACHE)
+  #include "../feature/job_cache.h"
+#endif
+
+#if HAS_MEDIA_DECODER
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 #if ANY(DO_LIST_BIN_FILES, CUSTOM_FIRMWARE_UPLOAD)
   #define MEDIA_SUPPORT_BIN_FILES 1
 #endif
@@ -80,6 +92,12 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1        // Use the serial line buffer as BinaryStream input
        #endif
+       #if HAS_MEDIA_DECODER
+         , compressed:1         // The open file is decoded as it's read (*.HS or binary G-code)
+       #endif
+       #if ENABLED(SD_BINARY_GCODE)
+         , binary_gcode:1       // The open file is binary G-code, decoded by BinaryGcode
+       #endif
     ;
 } card_flags_t;
 
@@ -91,7 +109,7 @@ enum MediaPresence : int8_t {
   INSERT_USB    = TERN(HAS_MULTI_VOLUME, 0x04, 0x00)
 };
 
-enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP };
+enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP, LS_METADATA };
 enum SortFlag : int8_t { AS_REV = -1, AS_OFF, AS_FWD, AS_ALSO_REV };
 
 #if ENABLED(AUTO_REPORT_SD_STATUS)
@@ -314,15 +332,31 @@ public:
 
   // Print File stats
   static uint32_t getFileSize()  { return filesize; }
-  static uint32_t getIndex()     { return sdpos; }
-  static bool isFileOpen()       { return isMounted() && myfile.isOpen(); }
-  static bool eof()              { return getIndex() >= getFileSize(); }
+  // A job copied to SPI flash stays open without the media
+  static bool isFileOpen()       { return (isMounted() || TERN0(SD_JOB_CACHE, jobcache.complete())) && myfile.isOpen(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return myfile.isOpen() ? myfile.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { myfile.seekSet((sdpos = index)); }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t read(void *buf, uint16_t nbyte);
+    static int16_t write(void *buf, uint16_t nbyte) { if (!myfile.isOpen()) return -1; flush_read_ahead(); return myfile.write(buf, nbyte); }
+    static void read_ahead();
+  #else
+    static int16_t read(void *buf, uint16_t nbyte)  { return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+    static int16_t write(void *buf, uint16_t nbyte) { return myfile.isOpen() ? myfile.write(buf, nbyte) : -1; }
+  #endif
+
+  #if HAS_MEDIA_DECODER
+    // A compressed file is decoded as it's read. Its index is the position in the decoded G-code.
+    static uint32_t getIndex()                      { return flag.compressed ? hs_pos : sdpos; }
+    static bool eof()                               { return flag.compressed ? hs_eof() : sdpos >= filesize; }
+    static int16_t get()                            { return flag.compressed ? hs_get() : raw_get(); }
+    static void setIndex(const uint32_t index)      { if (flag.compressed) hs_seek(index); else raw_seek(index); TERN_(SD_LAYER_INDEX, layerindex.moved(index)); }
+  #else
+    static uint32_t getIndex()                      { return sdpos; }
+    static bool eof()                               { return sdpos >= filesize; }
+    static int16_t get()                            { return raw_get(); }
+    static void setIndex(const uint32_t index)      { raw_seek(index); TERN_(SD_LAYER_INDEX, layerindex.moved(index)); }
+  #endif
 
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     //
@@ -333,6 +367,9 @@ public:
   #endif
 
 private:
+  TERN_(MSC_SHARED_PRINTING, friend class MediaShare);
+  TERN_(MEMORY_MONITOR, friend class MemoryMonitor);
+
   //
   // Driver, volume, and temporary file
   //
@@ -343,12 +380,48 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_READ_AHEAD)
+    //
+    // Read-ahead buffers. The file position is sdpos plus the unread buffered bytes.
+    //
+    static uint8_t ra_buf[SD_READ_AHEAD_BUFFERS][512];
+    static uint16_t ra_len[SD_READ_AHEAD_BUFFERS], ra_index;
+    static uint8_t ra_head, ra_tail, ra_count;
+    static bool fill_read_ahead();
+    static void reset_read_ahead() { ra_head = ra_tail = ra_count = 0; ra_index = 0; }
+    static void flush_read_ahead() { if (ra_count) myfile.seekSet(sdpos); reset_read_ahead(); }
+    static int16_t raw_get();
+    static void raw_seek(const uint32_t index) { reset_read_ahead(); myfile.seekSet((sdpos = index)); }
+  #else
+    static int16_t raw_get() { int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
+    static void raw_seek(const uint32_t index) { myfile.seekSet((sdpos = index)); }
+  #endif
+
+  #if HAS_MEDIA_DECODER
+    //
+    // Decoder for a compressed file. sdpos stays the position in the file, for progress.
+    //
+    friend class BinaryGcode;
+    static heatshrink_decoder hsd;
+    static uint8_t hs_buf[SD_DECODE_BUFFER];     // Decoded G-code
+    static uint16_t hs_len, hs_index;
+    static uint32_t hs_pos;                       // Decoded bytes read so far
+    static void hs_reset();
+    static bool hs_fill();
+    static int16_t hs_get();
+    static void hs_seek(const uint32_t index);
+    static bool hs_eof() { return hs_index >= hs_len && !hs_fill() && !flag.abort_sd_printing; } // A decoding error aborts instead
+  #endif
+
   //
   // Working directory and parents
   //
   static MediaFile root, workDir, workDirParents[MAX_DIR_DEPTH];
   static uint8_t workDirDepth;
   static int16_t nrItems; // Cache the total count
+  #if ENABLED(SD_DIR_INDEX)
+    static uint16_t dir_index[SD_DIR_INDEX_LIMIT]; // Directory entry of each item, valid with nrItems
+  #endif
 
   //
   // Alphabetical file and folder sorting
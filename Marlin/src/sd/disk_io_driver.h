@@ -60,6 +60,16 @@ public:
   virtual bool readBlock(const uint32_t block, uint8_t * const dst) = 0;
   virtual bool writeBlock(const uint32_t blockNumber, const uint8_t * const src) = 0;
 
+  /**
+   * Read contiguous blocks. Drivers that can read them in one transfer override this.
+   *
+   * \return true for success or false for failure.
+   */
+  virtual bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count) {
+    for (uint16_t i = 0; i < count; ++i, dst += 512) if (!readBlock(block + i, dst)) return false;
+    return true;
+  }
+
   virtual uint32_t cardSize() = 0;
 
   virtual bool isReady() = 0;
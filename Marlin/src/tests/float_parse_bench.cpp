@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Fast float parser benchmark
+ *
+ * Parse typical slicer G-code lines and fetch their values with
+ * GCodeParser::decimal_value and with strtof. Reports any values that
+ * differ and the throughput of each method in lines per second.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ALL(MARLIN_TEST_BUILD, FAST_FLOAT_PARSER)
+
+#include "marlin_tests.h"
+#include "../gcode/parser.h"
+
+static const char * const bench_lines[] = {
+  "G1 X123.456 Y78.9 E1.23456",
+  "G1 X-12.5 Y0.125 Z0.2 F1800",
+  "G0 F9000 X110.123 Y115.678",
+  "G1 X98.765 Y101.234 E1234.56789",
+  "G1 E-0.8 F2100",
+  "G1 X.5 Y-.25 E+3"
+};
+
+// Parse every line and fetch its axis values. Return the time taken in µs.
+static uint32_t parse_lines(const uint16_t count, const bool fast, float &sink) {
+  char buffer[MAX_CMD_SIZE];
+  const uint32_t start = micros();
+  for (uint16_t i = 0; i < count; ++i) {
+    strcpy(buffer, bench_lines[i % COUNT(bench_lines)]);
+    parser.parse(buffer);
+    for (const char c : { 'X', 'Y', 'Z', 'E', 'F' }) {
+      if (!parser.seenval(c)) continue;
+      if (fast) sink += parser.value_float();
+      else      sink += parser.value_float_strtof();
+    }
+  }
+  return micros() - start;
+}
+
+void benchmarkFloatParsing() {
+  // Compare each value with strtof
+  uint16_t mismatches = 0;
+  char buffer[MAX_CMD_SIZE];
+  for (const char * const line : bench_lines) {
+    strcpy(buffer, line);
+    parser.parse(buffer);
+    for (char c = 'A'; c <= 'Z'; ++c) {
+      if (!parser.seenval(c)) continue;
+      const float fast = parser.value_float(), ref = parser.value_float_strtof();
+      if (fast != ref) {
+        ++mismatches;
+        SERIAL_ECHOLNPGM("Float parser mismatch: ", parser.value_string(), " fast ", p_float_t(fast, 6), " strtof ", p_float_t(ref, 6));
+      }
+    }
+  }
+  SERIAL_ECHOLNPGM("Float parser: ", mismatches, " mismatches");
+
+  // Throughput
+  constexpr uint16_t count = 5000;
+  float sink = 0;
+  const uint32_t strtof_us = parse_lines(count, false, sink),
+                 fast_us = parse_lines(count, true, sink);
+  UNUSED(sink);
+
+  SERIAL_ECHOLNPGM("Float parser lines/s: strtof ", uint32_t(count * 1000000ULL / _MAX(strtof_us, 1UL)),
+                                        " fast ", uint32_t(count * 1000000ULL / _MAX(fast_us, 1UL)));
+}
+
+#endif // MARLIN_TEST_BUILD && FAST_FLOAT_PARSER
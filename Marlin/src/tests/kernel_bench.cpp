@@ -0,0 +1,156 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Core kernel benchmark
+ *
+ * Call each kernel a number of times and report its average CPU cycles per
+ * call, to compare boards, compilers and build flags. Run by M222.
+ *
+ * Cycles come from the DWT cycle counter on STM32 (Cortex-M3 and up) and are
+ * estimated from micros() elsewhere. Each figure includes the loop overhead,
+ * reported first as "loop". Interrupts stay enabled so the temperature ISR
+ * adds a little to every figure.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+#include "marlin_tests.h"
+#include "../gcode/parser.h"
+#include "../libs/numtostr.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+#if HAS_MESH
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if defined(__arm__) && (defined(ARDUINO_ARCH_STM32) || defined(__STM32F1__)) && !defined(__ARM_ARCH_6M__)
+  #define KERNEL_BENCH_DWT 1
+#endif
+
+// Results are stored here so the kernels aren't optimized away
+static volatile uint32_t sink_u;
+static volatile float sink_f;
+
+static uint32_t cycles() {
+  #if KERNEL_BENCH_DWT
+    return *(volatile uint32_t *)0xE0001004;    // DWT_CYCCNT, enabled by calibrate_delay_loop()
+  #else
+    return micros() * (F_CPU / 1000000UL);      // Wraps with the counter, so differences stay valid
+  #endif
+}
+
+// Call a kernel 'count' times with the call index and report the cycles per call
+template<typename F>
+static void bench(FSTR_P const name, const uint16_t count, F kernel) {
+  const uint32_t start = cycles();
+  for (uint16_t i = 0; i < count; ++i) kernel(i);
+  const uint32_t total = cycles() - start;
+  SERIAL_ECHOLN(name, F(": "), total / count, F(" cycles/call"));
+  hal.watchdog_refresh();
+}
+
+void benchmarkKernels(const uint16_t count) {
+  SERIAL_ECHOLNPGM("Kernel benchmark: ", count, " calls at ", uint32_t(F_CPU / 1000000UL), " MHz");
+
+  bench(F("loop"), count, [](const uint16_t i) { sink_u = i; });
+
+  // Parse a typical move (faster with FAST_MOVE_PARSER), then fetch one of its values on each call.
+  // The buffer stays valid for the parser after M222 is done with it.
+  static char line[] = "G1 X123.456 Y78.9 E1.23456";
+  bench(F("parse_G1"), count, [](const uint16_t) { parser.parse(line); });
+  parser.seen('X');
+  bench(F("value_float"), count, [](const uint16_t) { sink_f = parser.value_float(); });
+
+  #if HAS_HOTEND
+    // Readings spread over the whole table
+    bench(F("analog_to_celsius_hotend"), count, [](const uint16_t i) {
+      sink_f = thermalManager.analog_to_celsius_hotend(raw_adc_t((i * 37UL) % (MAX_RAW_THERMISTOR_VALUE)), 0);
+    });
+  #endif
+
+  #if HAS_MESH
+    // Points spread over the bed. Load a mesh for representative figures.
+    bench(F("get_z_correction"), count, [](const uint16_t i) {
+      const xy_pos_t pos = { float(i % (X_BED_SIZE)), float((i * 7) % (Y_BED_SIZE)) };
+      sink_f = bedlevel.get_z_correction(pos);
+    });
+  #endif
+
+  // A 100mm move at 100mm/s with varying entry and exit speeds
+  static block_t block;
+  block.reset();
+  block.steps_per_mm = 80;
+  block.step_event_count = 8000;
+  block.nominal_rate = 8000;
+  block.initial_rate = 80;
+  block.acceleration = 1000;
+  IF_DISABLED(COMPACT_PLANNER_BLOCKS, block.acceleration_steps_per_s2 = 80 * 1000);
+  bench(F("calculate_trapezoid_for_block"), count, [](const uint16_t i) {
+    Planner::calculate_trapezoid_for_block(&block, float((i & 31) + 1), float(((i >> 5) & 31) + 1));
+    sink_u = block.accelerate_before;
+  });
+
+  #if HAS_JUNCTION_DEVIATION
+    // The junction speed between moves 112.5° apart in XY, as in Planner::_populate_block
+    static xyze_float_t dirs[16];
+    for (uint8_t d = 0; d < COUNT(dirs); ++d) {
+      dirs[d].reset();
+      const float a = RADIANS(d * 22.5f);
+      dirs[d].x = cos(a);
+      TERN_(HAS_Y_AXIS, dirs[d].y = sin(a));
+    }
+    bench(F("junction_deviation"), count, [](const uint16_t i) {
+      const xyze_float_t &prev_unit_vec = dirs[i & 15], &unit_vec = dirs[(i + 5) & 15];
+      float junction_cos_theta = 0;
+      LOOP_LOGICAL_AXES(a) junction_cos_theta -= prev_unit_vec[a] * unit_vec[a];
+      xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+      Planner::normalize_junction_vector(junction_unit_vec);
+      const float junction_acceleration = Planner::limit_value_by_axis_maximum(planner.settings.acceleration, junction_unit_vec);
+      NOLESS(junction_cos_theta, -0.999999f);
+      const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+      sink_f = junction_acceleration * Planner::junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+    });
+
+    #if ENABLED(JD_JUNCTION_CACHE)
+      // The same junctions found in the cache, in the last entry searched
+      Planner::junction_cache_reset();
+      auto &last = Planner::junction_cache[JD_JUNCTION_CACHE_SIZE - 1];
+      last.delta = dirs[5] - dirs[0];
+      last.acceleration = planner.settings.acceleration;
+      bench(F("junction_cache_find"), count, [](const uint16_t) {
+        const xyze_float_t delta = dirs[5] - dirs[0];
+        const Planner::junction_cache_t * const jc = Planner::junction_cache_find(delta, planner.settings.acceleration);
+        sink_u = jc != nullptr;
+      });
+      Planner::junction_cache_reset();
+    #endif
+  #endif
+
+  bench(F("ftostr52sign"), count, [](const uint16_t i) { sink_u = *ftostr52sign(i * 0.37f - 100.0f); });
+  bench(F("i16tostr3rj"), count, [](const uint16_t i) { sink_u = *i16tostr3rj(int16_t(i % 1000)); });
+}
+
+#endif // MARLIN_TEST_BUILD
@@ -31,12 +31,16 @@
 #include "../module/stepper.h"
 #include "../module/temperature.h"
 
+#include "marlin_tests.h"
+
 // Individual tests are localized in each module.
 // Each test produces its own report.
 
 // Startup tests are run at the end of setup()
 void runStartupTests() {
   // Call post-setup tests here to validate behaviors.
+  TERN_(STEP_INTERVAL_TABLE, benchmarkStepIntervalTable());
+  TERN_(FAST_FLOAT_PARSER, benchmarkFloatParsing());
 }
 
 // Periodic tests are run from within loop()
@@ -23,3 +23,12 @@
 
 void runStartupTests();
 void runPeriodicTests();
+void benchmarkKernels(const uint16_t count);
+
+#if ENABLED(STEP_INTERVAL_TABLE)
+  void benchmarkStepIntervalTable();
+#endif
+
+#if ENABLED(FAST_FLOAT_PARSER)
+  void benchmarkFloatParsing();
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Step Interval Table benchmark
+ *
+ * Compare StepInterval::interval() with the division it replaces in
+ * Stepper::calc_timer_interval. Reports the largest error in timer ticks
+ * and the time per call of each method.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ALL(MARLIN_TEST_BUILD, STEP_INTERVAL_TABLE)
+
+#include "marlin_tests.h"
+#include "../module/stepper/interval_table.h"
+
+void benchmarkStepIntervalTable() {
+  // Accuracy over every step rate up to one step per 8 timer ticks
+  uint32_t max_err = 0, worst_rate = 0;
+  for (uint32_t rate = 1; rate <= (STEPPER_TIMER_RATE) / 8; ++rate) {
+    const uint32_t ref = uint32_t(STEPPER_TIMER_RATE) / rate,
+                   val = StepInterval::interval(rate),
+                   err = val > ref ? val - ref : ref - val;
+    if (err > max_err) { max_err = err; worst_rate = rate; }
+    if (!(rate & 0x3FFF)) hal.watchdog_refresh();
+  }
+  SERIAL_ECHOLNPGM("Step interval table: max error ", max_err, " ticks at ", worst_rate, " steps/s");
+
+  // Time per call for step rates typical of accel / decel
+  constexpr uint16_t count = 10000;
+  volatile uint32_t sink = 0, rate = 1000;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < count; ++i) sink = uint32_t(STEPPER_TIMER_RATE) / (rate + i * 7);
+  const uint32_t div_us = micros() - start;
+  start = micros();
+  for (uint16_t i = 0; i < count; ++i) sink = StepInterval::interval(rate + i * 7);
+  const uint32_t table_us = micros() - start;
+  UNUSED(sink);
+
+  SERIAL_ECHOLNPGM("Step interval ns/call: divide ", div_us * 1000UL / count, " table ", table_us * 1000UL / count);
+}
+
+#endif // MARLIN_TEST_BUILD && STEP_INTERVAL_TABLE
@@ -61,6 +61,11 @@ class Protocol(object):
 
     response_timeout = 1000
 
+    window = 1          # packets that may be sent before an 'ok', from the SYNC response
+    selective = False   # the client holds packets received out of order, only send the missing ones again
+    inflight = deque()  # sent packets waiting for an 'ok'
+    window_progress = 0
+
     applications = []
     responses = deque()
 
@@ -130,6 +135,7 @@ class Protocol(object):
         self.applications.append((tokens, callback))
 
     def send(self, protocol, packet_type, data = bytearray()):
+        self.flush_window()
         self.packet_transit = self.build_packet(protocol, packet_type, data)
         self.packet_status = 0
         self.transmit_attempt = 0
@@ -146,6 +152,39 @@ class Protocol(object):
                 #print("Packetloss detected..")
         self.packet_transit = None
 
+    # Send a packet without waiting for its 'ok' while the window has room
+    def send_windowed(self, protocol, packet_type, data = bytearray()):
+        if self.window < 2:
+            return self.send(protocol, packet_type, data)
+        if not len(self.inflight):
+            self.window_progress = millis()
+        packet = self.build_packet(protocol, packet_type, data, (self.sync + len(self.inflight)) % 256)
+        self.inflight.append(packet)
+        self.transmit_packet(packet)
+        while len(self.inflight) >= self.window:
+            self.await_window()
+
+    def flush_window(self):
+        while len(self.inflight):
+            self.await_window()
+
+    def await_window(self):
+        try:
+            self.await_response()
+        except ReadTimeout:
+            if millis() - self.window_progress > self.response_timeout * 20:
+                raise ConnectionLost()
+            self.errors += 1
+            self.resend_window()
+
+    # Go back to the oldest packet without an 'ok' and send them all again,
+    # or only that one if the client holds the packets after it
+    def resend_window(self):
+        if self.selective:
+            return self.transmit_packet(self.inflight[0])
+        for packet in list(self.inflight):
+            self.transmit_packet(packet)
+
     def await_response(self):
         timeout = TimeOut(self.response_timeout)
         while not len(self.responses):
@@ -210,7 +249,7 @@ class Protocol(object):
         self.port.write(packet)
         self.transmit_attempt += 1
 
-    def build_packet(self, protocol, packet_type, data = bytearray()):
+    def build_packet(self, protocol, packet_type, data = bytearray(), sync = None):
         PACKET_TOKEN = 0xB5AD
 
         if len(data) > self.max_block_size:
@@ -218,7 +257,7 @@ class Protocol(object):
 
         packet_buffer = bytearray()
 
-        packet_buffer += self.pack_int8(self.sync)                           # 8bit sync id
+        packet_buffer += self.pack_int8(self.sync if sync is None else sync) # 8bit sync id
         packet_buffer += self.pack_int4_2(protocol, packet_type)             # 4 bit protocol id, 4 bit packet type
         packet_buffer += self.pack_int16(len(data))                          # 16bit packet length
         packet_buffer += self.pack_int16(self.build_checksum(packet_buffer)) # 16bit header checksum
@@ -268,6 +307,12 @@ class Protocol(object):
             packet_id = int(data)
         except ValueError:
             return
+        if len(self.inflight):
+            if packet_id == self.sync:  # ignore repeated 'ok's for packets sent again
+                self.inflight.popleft()
+                self.sync = (self.sync + 1) % 256
+                self.window_progress = millis()
+            return
         if packet_id != self.sync:
             raise SycronisationError()
         self.sync = (self.sync + 1) % 256
@@ -276,20 +321,29 @@ class Protocol(object):
     def response_resend(self, data):
         packet_id = int(data)
         self.errors += 1
-        if not self.syncronised:
+        if len(self.inflight):
+            index = (packet_id - self.sync) % 256
+            if self.selective and index < len(self.inflight):
+                self.transmit_packet(self.inflight[index])
+            else:
+                self.resend_window()
+        elif not self.syncronised:
             print("Retrying syncronisation")
         elif packet_id != self.sync:
             raise SycronisationError()
 
     def response_stream_sync(self, data):
-        sync, max_block_size, protocol_version = data.split(',')
+        fields = data.split(',')
+        sync, max_block_size, protocol_version = fields[:3]
+        self.window = int(fields[3]) if len(fields) > 3 else 1
+        self.selective = len(fields) > 4 and fields[4] == '1'
         self.sync = int(sync)
         self.max_block_size = int(max_block_size)
         self.block_size = self.max_block_size if self.max_block_size < self.block_size else self.block_size
         self.protocol_version = protocol_version
         self.packet_status = 1
         self.syncronised = True
-        print("Connection synced [{0}], binary protocol version {1}, {2} byte payload buffer".format(self.sync, self.protocol_version, self.max_block_size))
+        print("Connection synced [{0}], binary protocol version {1}, {2} byte payload buffer, window {3}{4}".format(self.sync, self.protocol_version, self.max_block_size, self.window, " (selective repeat)" if self.selective else ""))
 
     def response_fatal_error(self, data):
         raise FatalError()
@@ -367,7 +421,7 @@ class FileTransferProtocol(object):
         raise ReadTimeout()
 
     def write(self, data):
-        self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE, data)
+        self.protocol.send_windowed(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE, data)
 
     def close(self):
         self.protocol.send(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.CLOSE)
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# createStringDictionary.py
+#
+# Pick the dictionary used by COMPRESSED_STRINGS from the serial messages in the
+# Marlin source and write it to Marlin/src/core/strz_dict.h.
+#
+# Each of the 127 words is a fragment that saves the most bytes over all the
+# literal strings given to SERIAL_ECHOPGM, SERIAL_ECHOLNPGM and the SERIAL_*_MSG
+# macros, counting the bytes the word itself takes. Run it again after adding
+# many messages, from the root of the repository:
+#
+#   buildroot/share/scripts/createStringDictionary.py
+#
+
+import re
+from pathlib import Path
+
+WORDS = 127          # Tokens 0x80-0xFE. 0xFF escapes a raw byte.
+MIN_LEN, MAX_LEN = 3, 12
+
+root = Path(__file__).resolve().parents[3] / 'Marlin'
+src = root / 'src'
+out = src / 'core' / 'strz_dict.h'
+
+macro_re = re.compile(r'SERIAL_(?:ECHO|ECHOLN)PGM\s*\(|SERIAL_(?:ECHO|ERROR|WARN)_MSG\s*\(')
+string_re = re.compile(r'"((?:[^"\\]|\\.)*)"')
+define_re = re.compile(r'^\s*#define\s+(STR_\w+)\s+(.*)$')
+
+def unescape(s):
+    return s.encode('latin-1', 'backslashreplace').decode('unicode_escape')
+
+# The STR_ strings are counted once for every use
+defines = {}
+for line in (src / 'core' / 'language.h').read_text(errors='ignore').splitlines():
+    m = define_re.match(line)
+    if m: defines[m[1]] = ''.join(unescape(s) for s in string_re.findall(m[2]))
+
+corpus = []
+for path in sorted(src.rglob('*')):
+    if path.suffix not in ('.cpp', '.h') or path == out: continue
+    text = path.read_text(errors='ignore')
+    for m in macro_re.finditer(text):
+        # The macro arguments, up to the closing parenthesis
+        depth, i = 1, m.end()
+        while i < len(text) and depth:
+            if text[i] == '"':
+                i += 1
+                while i < len(text) and text[i] != '"': i += 2 if text[i] == '\\' else 1
+            elif text[i] == '(': depth += 1
+            elif text[i] == ')': depth -= 1
+            i += 1
+        args = text[m.end():i - 1]
+        corpus += [unescape(s) for s in string_re.findall(args)]
+        corpus += [defines[d] for d in re.findall(r'\bSTR_\w+', args) if d in defines]
+
+corpus = [s for s in corpus if s.isascii()]
+words = []
+for _ in range(WORDS):
+    counts = {}
+    for s in corpus:
+        for n in range(MIN_LEN, MAX_LEN + 1):
+            for i in range(len(s) - n + 1):
+                w = s[i:i + n]
+                if '\0' not in w: counts[w] = counts.get(w, 0) + 1
+    if not counts: break
+    best = max(counts, key=lambda w: counts[w] * (len(w) - 1) - len(w) - 1)
+    if counts[best] * (len(best) - 1) <= len(best) + 1: break
+    words.append(best)
+    corpus = [s.replace(best, '\0') for s in corpus]   # Taken words can't be part of another
+
+def c_string(w):
+    return '"' + w.replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n') + '\\0"'
+
+with out.open('w') as f:
+    f.write('''/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The COMPRESSED_STRINGS dictionary, as words separated by '\\0'.
+ * Generated by buildroot/share/scripts/createStringDictionary.py
+ */
+#define STRZ_DICT_WORDS %d
+#define STRZ_DICT \\
+''' % len(words))
+    for w in words: f.write('  %s \\\n' % c_string(w))
+    f.write('  ""\n')
+
+print('%d words written to %s' % (len(words), out))
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+#
+# flightRecorder.py
+#
+# Decode a FLIGHT_RECORDER dump into a readable timeline. Give it either the
+# FLIGHT.BIN file written by 'M230 S' or a serial log holding the 'FR:' lines
+# printed by 'M230':
+#
+#   buildroot/share/scripts/flightRecorder.py FLIGHT.BIN
+#   buildroot/share/scripts/flightRecorder.py serial.log
+#
+# Times are shown in ms relative to the first event, with the gap from the
+# previous event. Keep EVENTS in sync with Marlin/src/feature/flight_recorder.h.
+#
+
+import re, struct, sys
+
+# Event name and the meaning of the A and B fields
+EVENTS = [
+    ('NONE',          None,       None),
+    ('BLOCK_PLANNED', 'blocks',   None),
+    ('BLOCK_STARTED', 'blocks',   None),
+    ('COMMAND',       'queued',   None),
+    ('SD_READ',       'blocks',   'us'),
+    ('EEPROM_WRITE',  None,       'ms'),
+    ('DGUS_HANDLER',  'ms',       'vp'),
+    ('TEMP_ISR_LATE', None,       'gap_us'),
+]
+
+def read_bin(data):
+    if data[:3] != b'MFR': raise ValueError('not a flight recorder file')
+    version, count, size = data[3], data[4] | data[5] << 8, data[6]
+    if version != 1 or size != 8: raise ValueError('unsupported format %d / %d' % (version, size))
+    return [struct.unpack_from('<IBBH', data, 8 + n * size) for n in range(count)]
+
+def read_log(text):
+    return [(int(m[1], 16), int(m[2], 16), int(m[3], 16), int(m[4], 16))
+            for m in re.finditer(r'FR:([0-9A-Fa-f]{8})([0-9A-Fa-f]{2})([0-9A-Fa-f]{2})([0-9A-Fa-f]{4})', text)]
+
+def describe(kind, a, b):
+    name, a_name, b_name = EVENTS[kind] if kind < len(EVENTS) else ('EVENT_%d' % kind, 'a', 'b')
+    if kind == 6: b = '0x%04X' % b
+    fields = ['%s=%s' % (n, v) for n, v in ((a_name, a), (b_name, b)) if n]
+    return '%-14s %s' % (name, ' '.join(fields))
+
+def main(path):
+    data = open(path, 'rb').read()
+    events = read_bin(data) if data[:3] == b'MFR' else read_log(data.decode('latin-1'))
+    if not events:
+        print('No events found in %s' % path)
+        return
+    first = prev = events[0][0]
+    for us, kind, a, b in events:
+        # micros() wraps after ~71 minutes
+        t, dt = (us - first) & 0xFFFFFFFF, (us - prev) & 0xFFFFFFFF
+        print('%12.3f ms  +%9.3f  %s' % (t / 1000, dt / 1000, describe(kind, a, b)))
+        prev = us
+    print('%d events over %.3f ms' % (len(events), ((prev - first) & 0xFFFFFFFF) / 1000))
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print('Usage: %s FLIGHT.BIN|serial.log' % sys.argv[0])
+        sys.exit(1)
+    main(sys.argv[1])
@@ -0,0 +1,16 @@
+; Motion trace reference: arcs and short collinear and curved segments
+M302 P1           ; Allow cold extrusion
+G92 X100 Y100 Z10 E0
+M83
+G1 F3000
+G2 X120 Y100 I10 J0 E1
+G3 X100 Y100 I-10 J0 E1
+G1 X100.5 Y100.5 E0.03
+G1 X101 Y101 E0.03
+G1 X101.5 Y101.5 E0.03
+G1 X102 Y102 E0.03
+G1 X102.5 Y102.2 E0.03
+G1 X103 Y102.2 E0.03
+G1 X103.5 Y102 E0.03
+G1 X104 Y101.5 E0.03
+M400
@@ -0,0 +1,14 @@
+; Motion trace reference: square with extrusion and a Z hop
+; No homing so the trace doesn't depend on the simulated endstops
+M302 P1           ; Allow cold extrusion
+G92 X100 Y100 Z10 E0
+M83
+G1 F6000
+G1 X140 Y100 E2
+G1 X140 Y140 E2
+G1 X100 Y140 E2
+G1 X100 Y100 E2
+G1 Z10.4 E-1 F1200
+G1 X120 Y120 F9000
+G1 Z10 E1 F1200
+M400
@@ -0,0 +1,195 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * test_ft_fixed.cpp - Unit tests for the FT Motion fixed-point kernels
+ *
+ * Compares the integer kernels used with FTM_FIXED_POINT
+ * (Marlin/src/module/ft_motion/fixed_point.h) against the float math of FTMotion.
+ *
+ * Tests cover:
+ * - Position, gain and ratio conversions
+ * - Exact steps-per-mm scaling to q10 steps
+ * - Phase polynomials against the float trapezoid and quintic profiles
+ * - Shaper convolution and exponential smoothing
+ */
+
+#include <unity.h>
+#include <cmath>
+#include <cstdint>
+
+#include "../../Marlin/src/module/ft_motion/fixed_point.h"
+
+// Unity test registration macros for standalone tests
+#define TEST_CASE(suite, name) void test_##suite##_##name(void)
+
+#define FTM_FS 1000   // (Hz) Trajectory sample rate
+
+using namespace FTFixed;
+
+constexpr double POS_LSB = 1.0 / (1 << POS_FRAC);
+
+// A small pseudo-random generator so the sweeps are repeatable
+static uint32_t rng_state = 12345;
+static float rngf(const float lo, const float hi) {
+  rng_state = rng_state * 1664525UL + 1013904223UL;
+  return lo + (hi - lo) * float(rng_state >> 8) / float(1UL << 24);
+}
+
+// Q8 samples from seconds
+static uint32_t to_time(const double s) { return uint32_t(lround(s * FTM_FS * (1 << TIME_FRAC))); }
+
+// Test: Conversions round trip within half an LSB
+TEST_CASE(ft_fixed, conversions) {
+  const float mm[] = { 0.0f, 0.1f, -0.1f, 12.3456f, -250.0f, 1000.0f, 300000.0f };
+  for (const float v : mm) TEST_ASSERT_FLOAT_WITHIN(fabs(v) * 1e-7 + POS_LSB / 2, v, to_mm(to_pos(v)));
+  TEST_ASSERT_EQUAL_INT32(1L << GAIN_FRAC, to_gain(1.0f));
+  TEST_ASSERT_EQUAL_INT32(to_pos(12.5f), round_gain(int64_t(to_pos(25.0f)) * to_gain(0.5f)));
+  TEST_ASSERT_EQUAL_INT32(to_pos(-50.0f), mul_ratio(to_pos(10.0f), to_ratio(-5.0f)));
+  // Ratios saturate rather than wrap
+  TEST_ASSERT_TRUE(to_ratio(1000.0f) > 0);
+  TEST_ASSERT_TRUE(to_ratio(-1000.0f) < 0);
+}
+
+// Test: Steps-per-mm scaling matches float math for any factor
+TEST_CASE(ft_fixed, steps_scale) {
+  const float spm[] = { 80.0f, 93.0f, 100.0f, 400.0f, 415.3f, 1600.0f, 0.5f };
+  for (const float k : spm) {
+    const scale_t sc = to_scale(k, 10 - POS_FRAC);
+    for (int i = 0; i < 1000; ++i) {
+      const pos_t p = to_pos(rngf(-400.0f, 400.0f));
+      const double ref = double(p) * POS_LSB * k * 1024.0;   // q10 steps
+      TEST_ASSERT_TRUE(fabs(double(mul_scale(p, sc)) - ref) <= 1.0);
+    }
+  }
+  // Zero (e.g., no Linear Advance gain) gives nothing
+  TEST_ASSERT_EQUAL_INT64(0, mul_scale(to_pos(10.0f), to_scale(0.0f)));
+}
+
+// Test: A trapezoid as phase polynomials matches the float generator
+TEST_CASE(ft_fixed, trapezoid_matches_float) {
+  for (int n = 0; n < 200; ++n) {
+    const float v0 = rngf(0.0f, 50.0f), vn = rngf(60.0f, 300.0f), v1 = rngf(0.0f, 50.0f),
+                a = rngf(500.0f, 5000.0f), len = rngf(5.0f, 300.0f);
+
+    // As TrapezoidalTrajectoryGenerator::plan
+    const float inv_a = 1.0f / a, ldiff = len + 0.5f * inv_a * (v0 * v0 + v1 * v1);
+    float T2 = ldiff / vn - inv_a * vn, nominal = vn;
+    if (T2 < 0.0f) { T2 = 0.0f; nominal = sqrtf(ldiff * a); }
+    const float T1 = (nominal - v0) * inv_a, T3 = (nominal - v1) * inv_a,
+                p1 = v0 * T1 + 0.5f * a * T1 * T1, p2 = p1 + nominal * T2;
+
+    const float c0[7] = { 0.0f, v0 * T1, 0.5f * a * T1 * T1 },
+                c1[7] = { p1, nominal * T2 },
+                c2[7] = { p2, nominal * T3, -0.5f * a * T3 * T3 };
+    Trajectory tr;
+    const uint32_t e0 = to_time(T1), e1 = to_time(T1 + T2), e2 = to_time(T1 + T2 + T3);
+    tr.set_phase(0, 0, e0, c0);
+    tr.set_phase(1, e0, e1, c1);
+    tr.set_phase(2, e1, e2, c2);
+    TEST_ASSERT_EQUAL_UINT32(e2, tr.total);
+
+    for (uint32_t t = 128; t <= tr.total; t += 1 << TIME_FRAC) {
+      const double s = double(t) / ((1 << TIME_FRAC) * FTM_FS);
+      double ref;
+      if (s < T1) ref = v0 * s + 0.5 * a * s * s;
+      else if (s <= T1 + T2) ref = p1 + nominal * (s - T1);
+      else { const double d = s - T1 - T2; ref = p2 + nominal * d - 0.5 * a * d * d; }
+      // Phase times are rounded to 1/256 sample (~4µs)
+      TEST_ASSERT_FLOAT_WITHIN(0.002, ref, to_mm(tr.distance(t)));
+    }
+  }
+}
+
+// Test: A quintic phase is evaluated to a few LSB
+TEST_CASE(ft_fixed, quintic_phase) {
+  const float c[7] = { 10.0f, 20.0f, 0.0f, 30.0f, -45.0f, 18.0f };
+  Trajectory tr;
+  tr.set_phase(0, 0, 0, c);
+  tr.set_phase(1, 0, 0, c);
+  tr.set_phase(2, 0, 100000, c);
+  for (uint32_t t = 0; t <= 100000; t += 997) {
+    const double u = t / 100000.0, ref = 10 + u * (20 + u * u * (30 + u * (-45 + u * 18)));
+    TEST_ASSERT_FLOAT_WITHIN(8 * POS_LSB, ref, to_mm(tr.distance(t)));
+  }
+  // Past the end stays at the end
+  TEST_ASSERT_EQUAL_INT32(tr.distance(100000), tr.distance(100000 + 1000));
+}
+
+// Test: A runout holds the position for exactly its duration
+TEST_CASE(ft_fixed, runout) {
+  Trajectory tr;
+  tr.set_runout(5 << TIME_FRAC);
+  TEST_ASSERT_EQUAL_UINT32(5 << TIME_FRAC, tr.total);
+  for (uint32_t t = 0; t <= tr.total; t += 64) TEST_ASSERT_EQUAL_INT32(0, tr.distance(t));
+}
+
+// Test: Shaper convolution matches float
+TEST_CASE(ft_fixed, shaping_matches_float) {
+  const float K = 0.7f, Ai[3] = { 1.0f / (1 + 2 * K + K * K), 2 * K / (1 + 2 * K + K * K), K * K / (1 + 2 * K + K * K) };
+  int32_t Ag[3];
+  for (int i = 0; i < 3; ++i) Ag[i] = to_gain(Ai[i]);
+  for (int n = 0; n < 1000; ++n) {
+    float p[3]; double ref = 0; int64_t acc = 0;
+    for (int i = 0; i < 3; ++i) {
+      p[i] = rngf(-300.0f, 300.0f);
+      ref += double(Ai[i]) * p[i];
+      acc += int64_t(Ag[i]) * to_pos(p[i]);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(2 * POS_LSB, ref, to_mm(round_gain(acc)));
+  }
+}
+
+// Test: Chained exponential smoothing matches float and settles on the input
+TEST_CASE(ft_fixed, smoothing_matches_float) {
+  const float alpha = 1.0f - expf(-0.001f * 5 / 0.02f);
+  const int32_t alpha_fixed = int32_t(lroundf(alpha * (1 << ALPHA_FRAC)));
+  double fpass[5] = { 0 };
+  int64_t pass[5] = { 0 };
+  for (int n = 0; n < 2000; ++n) {
+    const float in = n < 1000 ? 123.456f : -7.5f;
+    double fv = in;
+    int64_t v = int64_t(to_pos(in)) << ALPHA_FRAC;
+    for (int i = 0; i < 5; ++i) {
+      fpass[i] += (fv - fpass[i]) * alpha; fv = fpass[i];
+      ema(pass[i], v, alpha_fixed); v = pass[i];
+    }
+    const pos_t out = pos_t((v + (1 << (ALPHA_FRAC - 1))) >> ALPHA_FRAC);
+    // Alpha is rounded to 1/65536, which shows while following a 130mm step
+    TEST_ASSERT_FLOAT_WITHIN(0.01, fv, to_mm(out));
+  }
+  TEST_ASSERT_INT32_WITHIN(2, to_pos(-7.5f), pos_t(pass[4] >> ALPHA_FRAC));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ft_fixed_conversions);
+  RUN_TEST(test_ft_fixed_steps_scale);
+  RUN_TEST(test_ft_fixed_trapezoid_matches_float);
+  RUN_TEST(test_ft_fixed_quintic_phase);
+  RUN_TEST(test_ft_fixed_runout);
+  RUN_TEST(test_ft_fixed_shaping_matches_float);
+  RUN_TEST(test_ft_fixed_smoothing_matches_float);
+
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * test_motion_trace.cpp - Unit tests for the golden motion trace comparison
+ *
+ * Tests the MotionTrace class (Marlin/src/HAL/LINUX/hardware/MotionTrace.h)
+ * used by the linux_native_trace build to check step traces against golden
+ * traces recorded from the reference files in test/motion.
+ *
+ * Tests cover:
+ * - Identical traces match bit-for-bit, from any start time
+ * - Step times within / beyond the tolerance
+ * - Missing, extra and reversed steps
+ * - Axes compared independently of their interleaving
+ * - CSV save / load round trip and net positions
+ */
+
+#include <unity.h>
+#include <cstdio>
+
+#include "../../Marlin/src/HAL/LINUX/hardware/MotionTrace.h"
+
+MotionTrace *motion_trace = nullptr;
+
+// Unity test registration macros for standalone tests
+#define TEST_CASE(suite, name) void test_##suite##_##name(void)
+
+// A short move: X and Y stepping together, then X alone back
+static MotionTrace sample(const uint64_t start=1000) {
+  MotionTrace t;
+  for (uint64_t i = 0; i < 20; ++i) {
+    t.add(start + i * 100, 'X', 1);
+    if (i % 2) t.add(start + i * 100, 'Y', 1);
+  }
+  for (uint64_t i = 0; i < 10; ++i) t.add(start + 3000 + i * 150, 'X', -1);
+  return t;
+}
+
+// Test: A trace matches itself, and a copy that started later
+TEST_CASE(motion_trace, identical_match) {
+  const MotionTrace g = sample();
+  MotionTrace::result_t res = MotionTrace::compare(g, g, 0);
+  TEST_ASSERT_TRUE(res.ok);
+  TEST_ASSERT_EQUAL_UINT64(0, res.max_dt);
+
+  res = MotionTrace::compare(g, sample(123456), 0);
+  TEST_ASSERT_TRUE(res.ok);
+}
+
+// Test: Step times are checked against the tolerance
+TEST_CASE(motion_trace, tolerance) {
+  const MotionTrace g = sample();
+  MotionTrace t = sample();
+  t.steps[10].ticks += 7;
+
+  MotionTrace::result_t res = MotionTrace::compare(g, t, 10);
+  TEST_ASSERT_TRUE(res.ok);
+  TEST_ASSERT_EQUAL_UINT64(7, res.max_dt);
+
+  res = MotionTrace::compare(g, t, 5);
+  TEST_ASSERT_FALSE(res.ok);
+  TEST_ASSERT_TRUE(res.message.find("step") != std::string::npos);
+}
+
+// Test: A missing or extra step fails
+TEST_CASE(motion_trace, step_count) {
+  const MotionTrace g = sample();
+  MotionTrace t = sample();
+  t.steps.pop_back();
+  MotionTrace::result_t res = MotionTrace::compare(g, t, 1000);
+  TEST_ASSERT_FALSE(res.ok);
+  TEST_ASSERT_EQUAL_STRING("X: 29 steps, expected 30", res.message.c_str());
+
+  t = sample();
+  t.add(9000, 'Z', 1);
+  res = MotionTrace::compare(g, t, 1000);
+  TEST_ASSERT_FALSE(res.ok);
+  TEST_ASSERT_EQUAL_STRING("Z: 1 steps, expected 0", res.message.c_str());
+}
+
+// Test: A step in the wrong direction fails
+TEST_CASE(motion_trace, direction) {
+  const MotionTrace g = sample();
+  MotionTrace t = sample();
+  for (MotionTrace::step_t &s : t.steps) if (s.axis == 'Y') { s.dir = -1; break; }
+  const MotionTrace::result_t res = MotionTrace::compare(g, t, 1000);
+  TEST_ASSERT_FALSE(res.ok);
+  TEST_ASSERT_EQUAL_STRING("Y step 0: direction -1, expected 1", res.message.c_str());
+}
+
+// Test: Steps of different axes at the same time may be recorded in any order
+TEST_CASE(motion_trace, axis_order) {
+  MotionTrace g, t;
+  g.add(0, 'X', 1); g.add(0, 'Y', 1); g.add(50, 'X', 1);
+  t.add(0, 'Y', 1); t.add(0, 'X', 1); t.add(50, 'X', 1);
+  TEST_ASSERT_TRUE(MotionTrace::compare(g, t, 0).ok);
+}
+
+// Test: A trace saved to CSV loads back the same
+TEST_CASE(motion_trace, save_load) {
+  const MotionTrace g = sample();
+  const char * const path = "test_motion_trace.csv";
+  TEST_ASSERT_TRUE(g.save(path));
+  MotionTrace t;
+  TEST_ASSERT_TRUE(t.load(path));
+  remove(path);
+
+  TEST_ASSERT_EQUAL_UINT32(g.steps.size(), t.steps.size());
+  TEST_ASSERT_TRUE(MotionTrace::compare(g, t, 0).ok);
+  TEST_ASSERT_EQUAL_INT32(10, t.position('X'));
+  TEST_ASSERT_EQUAL_INT32(10, t.position('Y'));
+  TEST_ASSERT_EQUAL_INT32(0, t.position('Z'));
+  TEST_ASSERT_FALSE(t.load("no_such_trace.csv"));
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_motion_trace_identical_match);
+  RUN_TEST(test_motion_trace_tolerance);
+  RUN_TEST(test_motion_trace_step_count);
+  RUN_TEST(test_motion_trace_direction);
+  RUN_TEST(test_motion_trace_axis_order);
+  RUN_TEST(test_motion_trace_save_load);
+
+  return UNITY_END();
+}
@@ -0,0 +1,174 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * test_planner_fixed.cpp - Unit tests for the fixed-point trapezoid kernels
+ *
+ * Compares the integer kernels used with PLANNER_FIXED_POINT_TRAPEZOID
+ * (Marlin/src/module/planner_fixed.h) against the float expressions used
+ * by Planner::calculate_trapezoid_for_block.
+ *
+ * Tests cover:
+ * - Reciprocal multiply accuracy over the full acceleration range
+ * - Acceleration / deceleration step counts (ceil), signed distances
+ * - Triangle profile split (round) when the nominal rate can't be reached
+ * - Integer square root and reached rate for S-Curve / Linear Advance
+ * - S-Curve acceleration time in stepper timer ticks
+ */
+
+#include <unity.h>
+#include <cmath>
+#include <cstdint>
+
+#include "../../Marlin/src/module/planner_fixed.h"
+
+// Unity test registration macros for standalone tests
+#define TEST_CASE(suite, name) void test_##suite##_##name(void)
+
+#define STEPPER_TIMER_RATE 2000000UL  // STM32 / STM32F1 stepper timer
+
+// Float reference, as in Planner::calculate_trapezoid_for_block
+static int32_t float_accel_steps(const uint32_t r1, const uint32_t r0, const uint32_t accel) {
+  const float half_inverse_accel = 0.5f * (1.0f / accel);
+  return int32_t(ceilf(half_inverse_accel * (float(r1) * float(r1) - float(r0) * float(r0))));
+}
+
+// A small pseudo-random generator so the sweeps are repeatable
+static uint32_t rng_state = 12345;
+static uint32_t rng(const uint32_t lo, const uint32_t hi) {
+  rng_state = rng_state * 1664525UL + 1013904223UL;
+  return lo + (rng_state >> 8) % (hi - lo + 1);
+}
+
+// Test: The normalized reciprocal is exact enough for any acceleration
+TEST_CASE(planner_fixed, reciprocal_accuracy) {
+  const uint32_t accels[] = { 1, 2, 3, 7, 100, 255, 256, 1000, 32768, 65535, 500000, 3450000, 0x7FFFFFFFUL, 0xFFFFFFFFUL };
+  for (const uint32_t a : accels) {
+    const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(a);
+    TEST_ASSERT_TRUE(rc.r >= 0x80000000UL);
+    const uint64_t v = 1000000000000ULL;   // 1e12, a typical rate squared
+    const double expected = double(v) / a, got = double(PlannerFixed::mul_recip(v, rc));
+    TEST_ASSERT_TRUE(fabs(got - expected) <= expected * 1e-9 + 1.0);
+  }
+}
+
+// Test: Step counts for a full trapezoid match the float path
+TEST_CASE(planner_fixed, accel_steps_match_float) {
+  for (int i = 0; i < 5000; ++i) {
+    const uint32_t accel = rng(200, 4000000),
+                   nominal = rng(100, 400000),
+                   initial = rng(1, nominal);
+    const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(accel);
+    const int32_t fixed = PlannerFixed::ceil_steps(PlannerFixed::accel_distance_q8(nominal, initial, rc)),
+                  ref = float_accel_steps(nominal, initial, accel);
+    // Float has only 24 bits of mantissa so allow for its own rounding
+    TEST_ASSERT_INT32_WITHIN(1 + ref / 1000000, ref, fixed);
+  }
+}
+
+// Test: Known values
+TEST_CASE(planner_fixed, accel_steps_known_values) {
+  const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(1000);
+  // (2000^2 - 1000^2) / 2000 = 1500 exactly
+  TEST_ASSERT_EQUAL_INT32(1500, PlannerFixed::ceil_steps(PlannerFixed::accel_distance_q8(2000, 1000, rc)));
+  // No change in rate takes no steps
+  TEST_ASSERT_EQUAL_INT32(0, PlannerFixed::ceil_steps(PlannerFixed::accel_distance_q8(1234, 1234, rc)));
+}
+
+// Test: A final rate above the nominal rate gives a negative distance, as in float
+TEST_CASE(planner_fixed, accel_steps_signed) {
+  const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(500);
+  const int64_t q8 = PlannerFixed::accel_distance_q8(1000, 1010, rc);
+  TEST_ASSERT_TRUE(q8 < 0);
+  TEST_ASSERT_EQUAL_INT32(float_accel_steps(1000, 1010, 500), PlannerFixed::ceil_steps(q8));
+}
+
+// Test: Triangle profile split where the nominal rate is never reached
+TEST_CASE(planner_fixed, triangle_split_matches_float) {
+  for (int i = 0; i < 5000; ++i) {
+    const uint32_t accel = rng(200, 4000000),
+                   nominal = rng(1000, 400000),
+                   initial = rng(1, nominal), final = rng(1, nominal),
+                   step_event_count = rng(1, 2000);
+    const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(accel);
+    const int64_t acc_q8 = PlannerFixed::accel_distance_q8(nominal, initial, rc),
+                  dec_q8 = PlannerFixed::accel_distance_q8(nominal, final, rc);
+    const int32_t fixed = PlannerFixed::round_steps(((int64_t(step_event_count) << PlannerFixed::STEP_FRAC) + acc_q8 - dec_q8) / 2);
+
+    const float half_inverse_accel = 0.5f / accel,
+                nominal_rate_sq = float(nominal) * nominal,
+                acc_f = half_inverse_accel * (nominal_rate_sq - float(initial) * initial),
+                dec_f = half_inverse_accel * (nominal_rate_sq - float(final) * final);
+    const int32_t ref = int32_t(lroundf((step_event_count + acc_f - dec_f) * 0.5f));
+    TEST_ASSERT_INT32_WITHIN(1 + abs(ref) / 1000000, ref, fixed);
+  }
+}
+
+// Test: Integer square root is exact (rounded to nearest)
+TEST_CASE(planner_fixed, isqrt_rounded) {
+  TEST_ASSERT_EQUAL_UINT32(0, PlannerFixed::isqrt(0));
+  TEST_ASSERT_EQUAL_UINT32(1, PlannerFixed::isqrt(1));
+  TEST_ASSERT_EQUAL_UINT32(1, PlannerFixed::isqrt(2));
+  TEST_ASSERT_EQUAL_UINT32(2, PlannerFixed::isqrt(3));
+  TEST_ASSERT_EQUAL_UINT32(1000000, PlannerFixed::isqrt(1000000000000ULL));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFUL, PlannerFixed::isqrt(0xFFFFFFFE00000001ULL));
+  for (int i = 0; i < 5000; ++i) {
+    const uint64_t v = (uint64_t(rng(0, 0xFFFFFF)) << 24) | rng(0, 0xFFFFFF);
+    TEST_ASSERT_EQUAL_UINT32(uint32_t(llround(sqrt(double(v)))), PlannerFixed::isqrt(v));
+  }
+}
+
+// Test: Rate reached by a partial acceleration matches Planner::final_speed
+TEST_CASE(planner_fixed, final_rate_matches_float) {
+  for (int i = 0; i < 5000; ++i) {
+    const uint32_t accel = rng(200, 4000000), initial = rng(1, 400000), steps = rng(0, 20000);
+    const float ref = sqrtf(float(initial) * initial + 2.0f * accel * steps);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f + ref * 1e-6f, ref, float(PlannerFixed::final_rate(initial, accel, steps)));
+  }
+}
+
+// Test: S-Curve acceleration time matches the float path
+TEST_CASE(planner_fixed, accel_ticks_match_float) {
+  for (int i = 0; i < 5000; ++i) {
+    const uint32_t accel = rng(200, 4000000), delta = rng(0, 400000);
+    const PlannerFixed::recip_t rc = PlannerFixed::reciprocal(accel);
+    const float rate_factor = (1.0f / accel) * (STEPPER_TIMER_RATE);
+    const uint32_t ref = uint32_t(rate_factor * float(delta)),
+                   fixed = PlannerFixed::accel_ticks(delta, STEPPER_TIMER_RATE, rc);
+    TEST_ASSERT_UINT32_WITHIN(1 + ref / 1000000, ref, fixed);
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_planner_fixed_reciprocal_accuracy);
+  RUN_TEST(test_planner_fixed_accel_steps_match_float);
+  RUN_TEST(test_planner_fixed_accel_steps_known_values);
+  RUN_TEST(test_planner_fixed_accel_steps_signed);
+  RUN_TEST(test_planner_fixed_triangle_split_matches_float);
+  RUN_TEST(test_planner_fixed_isqrt_rounded);
+  RUN_TEST(test_planner_fixed_final_rate_matches_float);
+  RUN_TEST(test_planner_fixed_accel_ticks_match_float);
+
+  return UNITY_END();
+}